@@ -0,0 +1,162 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * benchmark_harness.cpp - minimal microbenchmark runner shared by all benchmark executables
+ */
+
+#include "benchmark_harness.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace benchmark_common
+{
+  // repeat each case until it accumulates this much wall time, then keep the fastest pass
+  static const double MIN_SAMPLE_SECONDS = 0.2;
+  static const int SAMPLE_COUNT = 3;
+
+  runner::runner (int argc, char **argv)
+    : m_baseline_path ()
+    , m_dump_path ()
+    , m_threshold_percent (10.0)
+    , m_results ()
+  {
+    for (int i = 1; i < argc; i++)
+      {
+	if (strcmp (argv[i], "--baseline") == 0 && i + 1 < argc)
+	  {
+	    m_baseline_path = argv[++i];
+	  }
+	else if (strcmp (argv[i], "--dump") == 0 && i + 1 < argc)
+	  {
+	    m_dump_path = argv[++i];
+	  }
+	else if (strcmp (argv[i], "--threshold") == 0 && i + 1 < argc)
+	  {
+	    m_threshold_percent = atof (argv[++i]);
+	  }
+	else
+	  {
+	    std::cerr << "usage: " << argv[0] << " [--baseline file] [--dump file] [--threshold percent]" << std::endl;
+	    exit (2);
+	  }
+      }
+  }
+
+  double
+  runner::time_body_once (std::size_t ops_per_call, const std::function<void ()> &body)
+  {
+    std::size_t calls = 0;
+    double elapsed_sec = 0.0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+    do
+      {
+	body ();
+	calls++;
+	elapsed_sec = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+      }
+    while (elapsed_sec < MIN_SAMPLE_SECONDS);
+
+    return elapsed_sec * 1.0e9 / ((double) calls * (double) ops_per_call);
+  }
+
+  void
+  runner::run (const std::string &name, std::size_t ops_per_call, const std::function<void ()> &body)
+  {
+    // warm up caches and branch predictors before measuring
+    body ();
+
+    double best_nsec_per_op = time_body_once (ops_per_call, body);
+    for (int sample = 1; sample < SAMPLE_COUNT; sample++)
+      {
+	double nsec_per_op = time_body_once (ops_per_call, body);
+	if (nsec_per_op < best_nsec_per_op)
+	  {
+	    best_nsec_per_op = nsec_per_op;
+	  }
+      }
+
+    m_results.push_back ({ name, best_nsec_per_op });
+    std::cout << name << " " << best_nsec_per_op << " ns/op" << std::endl;
+  }
+
+  int
+  runner::finish (void)
+  {
+    if (!m_dump_path.empty ())
+      {
+	std::ofstream dump_file (m_dump_path);
+	if (!dump_file)
+	  {
+	    std::cerr << "cannot write baseline file " << m_dump_path << std::endl;
+	    return 2;
+	  }
+	for (const result &res : m_results)
+	  {
+	    dump_file << res.m_name << " " << res.m_nsec_per_op << std::endl;
+	  }
+      }
+
+    if (m_baseline_path.empty ())
+      {
+	return 0;
+      }
+
+    std::ifstream baseline_file (m_baseline_path);
+    if (!baseline_file)
+      {
+	std::cerr << "cannot read baseline file " << m_baseline_path << std::endl;
+	return 2;
+      }
+
+    std::map<std::string, double> baseline;
+    std::string name;
+    double nsec_per_op;
+    while (baseline_file >> name >> nsec_per_op)
+      {
+	baseline[name] = nsec_per_op;
+      }
+
+    int regression_count = 0;
+    for (const result &res : m_results)
+      {
+	std::map<std::string, double>::iterator it = baseline.find (res.m_name);
+	if (it == baseline.end ())
+	  {
+	    // new case; nothing to compare against
+	    continue;
+	  }
+	double change_percent = (res.m_nsec_per_op - it->second) * 100.0 / it->second;
+	if (change_percent > m_threshold_percent)
+	  {
+	    std::cerr << "REGRESSION: " << res.m_name << " " << it->second << " -> " << res.m_nsec_per_op
+		      << " ns/op (+" << change_percent << "%)" << std::endl;
+	    regression_count++;
+	  }
+      }
+
+    return regression_count > 0 ? 1 : 0;
+  }
+} // namespace benchmark_common
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * benchmark_harness.hpp - minimal microbenchmark runner shared by all benchmark executables
+ *
+ * Each executable registers its cases with runner::run; the runner times them, prints nanoseconds per operation and,
+ * when a baseline file is supplied, fails the process if any case regressed past the threshold. Typical CI usage:
+ *
+ *    benchmark_xyz --dump baseline.txt            # record a baseline on the reference build
+ *    benchmark_xyz --baseline baseline.txt        # fail if >10% slower than the baseline
+ *    benchmark_xyz --baseline baseline.txt --threshold 25
+ */
+
+#ifndef _BENCHMARK_HARNESS_HPP_
+#define _BENCHMARK_HARNESS_HPP_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+namespace benchmark_common
+{
+  class runner
+  {
+    public:
+      runner (int argc, char **argv);
+
+      // time body (which must perform ops_per_call operations) and record nanoseconds per operation under name
+      void run (const std::string &name, std::size_t ops_per_call, const std::function<void ()> &body);
+
+      // dump results, compare against the baseline when one was given; returns the process exit code
+      int finish (void);
+
+    private:
+      struct result
+      {
+	std::string m_name;
+	double m_nsec_per_op;
+      };
+
+      double time_body_once (std::size_t ops_per_call, const std::function<void ()> &body);
+
+      std::string m_baseline_path;
+      std::string m_dump_path;
+      double m_threshold_percent;
+      std::vector<result> m_results;
+  };
+} // namespace benchmark_common
+
+#endif // _BENCHMARK_HARNESS_HPP_
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * benchmark_cqueue.cpp - microbenchmarks for lockfree::circular_queue
+ */
+
+#include "benchmark_harness.hpp"
+
+#include "lockfree_circular_queue.hpp"
+
+#include <thread>
+#include <vector>
+
+// operations per timed call; keeps clock overhead out of the numbers
+static const std::size_t BATCH_SIZE = 1024;
+static const std::size_t QUEUE_CAPACITY = 16 * 1024;
+
+static void
+benchmark_single_thread_produce_consume (void)
+{
+  static lockfree::circular_queue<int> queue (QUEUE_CAPACITY);
+  int element = 0;
+
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      queue.produce ((int) i);
+    }
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      queue.consume (element);
+    }
+}
+
+static void
+benchmark_contended_produce_consume (void)
+{
+  static lockfree::circular_queue<int> queue (QUEUE_CAPACITY);
+  static const std::size_t THREAD_COUNT = 4;
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < THREAD_COUNT; t++)
+    {
+      threads.emplace_back ([]
+      {
+	int element = 0;
+	for (std::size_t i = 0; i < BATCH_SIZE / THREAD_COUNT; i++)
+	  {
+	    queue.force_produce ((int) i);
+	    while (!queue.consume (element))
+	      ;
+	  }
+      });
+    }
+  for (std::thread &th : threads)
+    {
+      th.join ();
+    }
+}
+
+int
+main (int argc, char **argv)
+{
+  benchmark_common::runner runner (argc, argv);
+
+  runner.run ("cqueue_single_thread_produce_consume", 2 * BATCH_SIZE, benchmark_single_thread_produce_consume);
+  // contended case counts a produce+consume pair per loop iteration across all threads
+  runner.run ("cqueue_contended_produce_consume", 2 * BATCH_SIZE, benchmark_contended_produce_consume);
+
+  return runner.finish ();
+}
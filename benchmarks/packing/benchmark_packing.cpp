@@ -0,0 +1,97 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * benchmark_packing.cpp - microbenchmarks for or_pack/or_unpack round trips
+ */
+
+#include "benchmark_harness.hpp"
+
+#include "object_representation.h"
+
+#include <cstring>
+
+// operations per timed call; keeps clock overhead out of the numbers
+static const std::size_t BATCH_SIZE = 1024;
+
+static void
+benchmark_pack_int_round_trip (void)
+{
+  char buffer[BATCH_SIZE * OR_INT_SIZE];
+  char *ptr = buffer;
+  int value = 0;
+
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      ptr = or_pack_int (ptr, (int) i);
+    }
+  ptr = buffer;
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      ptr = or_unpack_int (ptr, &value);
+    }
+}
+
+static void
+benchmark_pack_int64_round_trip (void)
+{
+  char buffer[BATCH_SIZE * (OR_INT64_SIZE + MAX_ALIGNMENT)];
+  char *ptr = buffer;
+  INT64 value = 0;
+
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      ptr = or_pack_int64 (ptr, (INT64) i);
+    }
+  ptr = buffer;
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      ptr = or_unpack_int64 (ptr, &value);
+    }
+}
+
+static void
+benchmark_pack_string_round_trip (void)
+{
+  static const char *sample = "a fairly typical identifier-sized string";
+  char buffer[BATCH_SIZE * 64];
+  char *ptr = buffer;
+  char *unpacked = NULL;
+
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      ptr = or_pack_string (ptr, sample);
+    }
+  ptr = buffer;
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      ptr = or_unpack_string_nocopy (ptr, &unpacked);
+    }
+}
+
+int
+main (int argc, char **argv)
+{
+  benchmark_common::runner runner (argc, argv);
+
+  runner.run ("or_pack_int_round_trip", BATCH_SIZE, benchmark_pack_int_round_trip);
+  runner.run ("or_pack_int64_round_trip", BATCH_SIZE, benchmark_pack_int64_round_trip);
+  runner.run ("or_pack_string_round_trip", BATCH_SIZE, benchmark_pack_string_round_trip);
+
+  return runner.finish ();
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * benchmark_tp_compare.cpp - microbenchmarks for tp_value_compare on common domains
+ */
+
+#include "benchmark_harness.hpp"
+
+#include "dbtype.h"
+#include "language_support.h"
+#include "object_domain.h"
+
+// operations per timed call; keeps clock overhead out of the numbers
+static const std::size_t BATCH_SIZE = 1024;
+
+static DB_VALUE Int_values[2];
+static DB_VALUE Double_values[2];
+static DB_VALUE String_values[2];
+static volatile int Compare_sink;
+
+static void
+benchmark_compare_int (void)
+{
+  int sink = 0;
+
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      sink += tp_value_compare (&Int_values[i & 1], &Int_values[(i + 1) & 1], 0, 1);
+    }
+  Compare_sink = sink;
+}
+
+static void
+benchmark_compare_double (void)
+{
+  int sink = 0;
+
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      sink += tp_value_compare (&Double_values[i & 1], &Double_values[(i + 1) & 1], 0, 1);
+    }
+  Compare_sink = sink;
+}
+
+static void
+benchmark_compare_string (void)
+{
+  int sink = 0;
+
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      sink += tp_value_compare (&String_values[i & 1], &String_values[(i + 1) & 1], 0, 1);
+    }
+  Compare_sink = sink;
+}
+
+static void
+benchmark_compare_int_coerce_double (void)
+{
+  int sink = 0;
+
+  for (std::size_t i = 0; i < BATCH_SIZE; i++)
+    {
+      sink += tp_value_compare (&Int_values[i & 1], &Double_values[(i + 1) & 1], 1, 1);
+    }
+  Compare_sink = sink;
+}
+
+int
+main (int argc, char **argv)
+{
+  benchmark_common::runner runner (argc, argv);
+
+  lang_init ();
+  tp_init ();
+
+  db_make_int (&Int_values[0], 42);
+  db_make_int (&Int_values[1], 43);
+  db_make_double (&Double_values[0], 42.0);
+  db_make_double (&Double_values[1], 43.0);
+  db_make_string (&String_values[0], "a fairly typical string value");
+  db_make_string (&String_values[1], "a fairly typical string walue");
+
+  runner.run ("tp_value_compare_int", BATCH_SIZE, benchmark_compare_int);
+  runner.run ("tp_value_compare_double", BATCH_SIZE, benchmark_compare_double);
+  runner.run ("tp_value_compare_string", BATCH_SIZE, benchmark_compare_string);
+  runner.run ("tp_value_compare_int_coerce_double", BATCH_SIZE, benchmark_compare_int_coerce_double);
+
+  return runner.finish ();
+}
@@ -40,6 +40,13 @@ struct db_session
   bool is_subsession_for_prepared;	/* whether this session is created for running a prepared statement, as a
 					 * sub-session of a "true" client session */
   DB_SESSION *next;		/* subsessions for prepared statements */
+
+  const char *stmt_fingerprint;	/* canonical text of a single SELECT statement, used as the key of the client
+				 * prepare cache; NULL when the session is not a cache candidate */
+  unsigned int compile_local_schema_id;	/* schema version stamps observed when the statement was compiled; the
+					 * compiled tree may only be re-used while they still match */
+  unsigned int compile_global_schema_id;
+  MOP compile_user;		/* user the statement was compiled as */
 };
 
 #endif /* _API_COMPAT_H_ */
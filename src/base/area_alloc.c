@@ -84,11 +84,44 @@ pthread_mutex_t area_List_lock = PTHREAD_MUTEX_INITIALIZER;
  */
 #define VOLATILE_ACCESS(v,t)		(*((t volatile *) &(v)))
 
+/* Maximum number of areas that may opt into the per-thread magazine cache.
+ * Indices are handed out once and never reused, so a stale magazine of a
+ * destroyed area can never be reached through a new area. */
+#define AREA_THREAD_CACHE_MAX_AREAS 8
+
+/* Elements kept per thread and area; half of it is moved to or from the
+ * shared block bitmaps when the magazine runs full or empty. */
+#define AREA_THREAD_CACHE_CAPACITY 32
+
+/*
+ * AREA_MAGAZINE - Per-thread cache of free elements of one area.
+ *   Owned exclusively by one thread; the shared layer is only touched
+ *   when the magazine runs full or empty.
+ */
+typedef struct area_magazine AREA_MAGAZINE;
+struct area_magazine
+{
+  int count;			/* used slots */
+  void *slots[AREA_THREAD_CACHE_CAPACITY];	/* cached free elements */
+};
+
+/* Allotted thread cache slots; protected by area_List_lock */
+static int area_Thread_cache_count = 0;
+
+/* Per-thread magazine table, indexed by AREA.thread_cache_index.  Magazines
+ * are allocated lazily on first use and kept until the thread exits; worker
+ * threads are pooled and long-lived, so the elements parked here stay
+ * reusable. */
+static thread_local AREA_MAGAZINE *area_Tls_magazines[AREA_THREAD_CACHE_MAX_AREAS] = { NULL };
+
 static void area_info (AREA * area, FILE * fp);
 static AREA_BLOCK *area_alloc_block (AREA * area);
 static AREA_BLOCKSET_LIST *area_alloc_blockset (AREA * area);
 static int area_insert_block (AREA * area, AREA_BLOCK * new_block);
 static AREA_BLOCK *area_find_block (AREA * area, const void *ptr);
+static AREA_MAGAZINE *area_get_magazine (AREA * area);
+static void *area_alloc_shared (AREA * area);
+static int area_free_shared (AREA * area, void *ptr);
 
 /*
  * area_init - Initialize the area manager
@@ -190,6 +223,8 @@ area_create (const char *name, size_t element_size, size_t alloc_count)
   area->alloc_count = LF_BITMAP_COUNT_ALIGN (alloc_count);
   area->block_size = area->element_size * area->alloc_count;
 
+  area->thread_cache_index = -1;
+
   area->n_allocs = 0;
   area->n_frees = 0;
 #if defined (SERVER_MODE)
@@ -238,6 +273,68 @@ error:
   return NULL;
 }
 
+/*
+ * area_enable_thread_cache - Opt an area into the per-thread magazine cache
+ *   return: none
+ *   area(in): AREA returned by area_create
+ *
+ * Note: Call right after area_create, before the area is used concurrently.
+ *       Allocations and frees then go through a small per-thread magazine
+ *       first and only fall back to the shared block bitmaps when the
+ *       magazine runs empty or full, which keeps hot alloc/free traffic off
+ *       the shared cache lines.  Cache slots are limited; when none is left
+ *       the area silently stays on the shared path.
+ */
+void
+area_enable_thread_cache (AREA * area)
+{
+#if defined (SERVER_MODE)
+  int rv;
+#endif /* SERVER_MODE */
+
+  assert (area != NULL && area->thread_cache_index == -1);
+
+  rv = pthread_mutex_lock (&area_List_lock);
+
+  if (area_Thread_cache_count < AREA_THREAD_CACHE_MAX_AREAS)
+    {
+      area->thread_cache_index = area_Thread_cache_count++;
+    }
+
+  pthread_mutex_unlock (&area_List_lock);
+}
+
+/*
+ * area_get_magazine - Get this thread's magazine for an area
+ *   return: the magazine, or NULL when its allocation failed
+ *   area(in): AREA with an assigned thread cache slot
+ *
+ * Note: The magazine is allocated lazily on the first access of each
+ *       thread.  An allocation failure is not an error; the caller simply
+ *       stays on the shared path.
+ */
+static AREA_MAGAZINE *
+area_get_magazine (AREA * area)
+{
+  AREA_MAGAZINE *magazine;
+
+  assert (area->thread_cache_index >= 0 && area->thread_cache_index < AREA_THREAD_CACHE_MAX_AREAS);
+
+  magazine = area_Tls_magazines[area->thread_cache_index];
+  if (magazine == NULL)
+    {
+      magazine = (AREA_MAGAZINE *) malloc (sizeof (AREA_MAGAZINE));
+      if (magazine == NULL)
+	{
+	  return NULL;
+	}
+      magazine->count = 0;
+      area_Tls_magazines[area->thread_cache_index] = magazine;
+    }
+
+  return magazine;
+}
+
 /*
  * area_destroy - Removes an area
  *   return: none
@@ -348,7 +445,7 @@ area_alloc_blockset (AREA * area)
 }
 
 /*
- * area_alloc - Allocate a new element from an area
+ * area_alloc_shared - Allocate a new element from the shared blocks of an area
  *   return: pointer to the element allocated
  *   area(in):
  *
@@ -356,8 +453,8 @@ area_alloc_blockset (AREA * area)
  *       otherwise a new block will be allocated and the element
  *       taken from there
  */
-void *
-area_alloc (AREA * area)
+static void *
+area_alloc_shared (AREA * area)
 {
   AREA_BLOCKSET_LIST *blockset;
   AREA_BLOCK *block, *hint_block;
@@ -472,6 +569,62 @@ found:
   return ((void *) entry_ptr);
 }
 
+/*
+ * area_alloc - Allocate a new element from an area
+ *   return: pointer to the element allocated
+ *   area(in):
+ *
+ * Note: When the area opted into the thread cache (area_enable_thread_cache),
+ *       the element is popped from this thread's magazine; an empty magazine
+ *       is refilled with a batch from the shared blocks first.
+ */
+void *
+area_alloc (AREA * area)
+{
+  AREA_MAGAZINE *magazine;
+  void *entry_ptr;
+  int i;
+
+  assert (area != NULL);
+
+  if (area->thread_cache_index != -1)
+    {
+      magazine = area_get_magazine (area);
+      if (magazine != NULL)
+	{
+	  if (magazine->count == 0)
+	    {
+	      /* refill with a batch so the next allocations stay local */
+	      for (i = 0; i < AREA_THREAD_CACHE_CAPACITY / 2; i++)
+		{
+		  entry_ptr = area_alloc_shared (area);
+		  if (entry_ptr == NULL)
+		    {
+		      break;
+		    }
+#if !defined (NDEBUG)
+		  /* elements parked in a magazine are marked free */
+		  *(int *) (((char *) entry_ptr) - AREA_PREFIX_SIZE) = AREA_PREFIX_FREED;
+#endif /* !NDEBUG */
+		  magazine->slots[magazine->count++] = entry_ptr;
+		}
+	    }
+
+	  if (magazine->count > 0)
+	    {
+	      entry_ptr = magazine->slots[--magazine->count];
+#if !defined (NDEBUG)
+	      assert (*(int *) (((char *) entry_ptr) - AREA_PREFIX_SIZE) == AREA_PREFIX_FREED);
+	      *(int *) (((char *) entry_ptr) - AREA_PREFIX_SIZE) = AREA_PREFIX_INITED;
+#endif /* !NDEBUG */
+	      return entry_ptr;
+	    }
+	}
+    }
+
+  return area_alloc_shared (area);
+}
+
 /*
  * area_validate - validate that a pointer is within range in an area
  *   return: NO_ERROR if ok (address in range) or ER_AREA_ILLEGAL_POINTER
@@ -503,15 +656,15 @@ area_validate (AREA * area, const void *address)
 }
 
 /*
- * area_free - Free an element in an area
+ * area_free_shared - Free an element into the shared blocks of an area
  *   return: error code
  *   area(in): AREA
  *   ptr(in): pointer to the element
  *
  * Note: Validation is performed; the element is simply pushed on the free list
  */
-int
-area_free (AREA * area, void *ptr)
+static int
+area_free_shared (AREA * area, void *ptr)
 {
   AREA_BLOCK *block, *hint_block;
   char *entry_ptr;
@@ -586,6 +739,75 @@ area_free (AREA * area, void *ptr)
   return NO_ERROR;
 }
 
+/*
+ * area_free - Free an element in an area
+ *   return: error code
+ *   area(in): AREA
+ *   ptr(in): pointer to the element
+ *
+ * Note: When the area opted into the thread cache (area_enable_thread_cache),
+ *       the element is pushed onto this thread's magazine; a full magazine
+ *       returns half of its elements to the shared blocks first.
+ */
+int
+area_free (AREA * area, void *ptr)
+{
+  AREA_MAGAZINE *magazine;
+  int i, keep;
+#if !defined (NDEBUG)
+  int *prefix;
+#endif /* !NDEBUG */
+
+  assert (area != NULL);
+
+  if (ptr == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_AREA_ILLEGAL_POINTER, 0);
+      assert (ptr != NULL);
+      return ER_AREA_ILLEGAL_POINTER;
+    }
+
+  if (area->thread_cache_index != -1)
+    {
+      magazine = area_get_magazine (area);
+      if (magazine != NULL)
+	{
+	  if (magazine->count == AREA_THREAD_CACHE_CAPACITY)
+	    {
+	      /* return the older half to the shared blocks */
+	      keep = AREA_THREAD_CACHE_CAPACITY / 2;
+	      for (i = 0; i < keep; i++)
+		{
+#if !defined (NDEBUG)
+		  /* restore the allocated mark expected by the shared layer */
+		  *(int *) (((char *) magazine->slots[i]) - AREA_PREFIX_SIZE) = AREA_PREFIX_INITED;
+#endif /* !NDEBUG */
+		  (void) area_free_shared (area, magazine->slots[i]);
+		}
+	      memmove (magazine->slots, magazine->slots + keep, keep * sizeof (void *));
+	      magazine->count = keep;
+	    }
+
+#if !defined (NDEBUG)
+	  prefix = (int *) (((char *) ptr) - AREA_PREFIX_SIZE);
+	  if ((*prefix) != AREA_PREFIX_INITED)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_AREA_FREE_TWICE, 0);
+	      assert ((*prefix) == AREA_PREFIX_INITED);
+	      return ER_AREA_FREE_TWICE;
+	    }
+	  *prefix = AREA_PREFIX_FREED;
+#endif /* !NDEBUG */
+
+	  magazine->slots[magazine->count++] = ptr;
+
+	  return NO_ERROR;
+	}
+    }
+
+  return area_free_shared (area, ptr);
+}
+
 /*
  * area_flush - Free all storage allocated for an area
  *   return: none
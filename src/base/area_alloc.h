@@ -80,6 +80,8 @@ struct area
   size_t alloc_count;
   size_t block_size;
 
+  int thread_cache_index;	/* slot in the per-thread magazine table, or -1 when the thread cache is disabled */
+
   AREA_BLOCKSET_LIST *blockset_list;	/* the blockset list */
   AREA_BLOCK *hint_block;	/* the hint block which may include free slot */
   pthread_mutex_t area_mutex;	/* only used for insert new block */
@@ -102,6 +104,7 @@ extern "C"
 
 /* area definition */
   extern AREA *area_create (const char *name, size_t element_size, size_t alloc_count);
+  extern void area_enable_thread_cache (AREA * area);
   extern void area_destroy (AREA * area);
 
 /* allocation functions */
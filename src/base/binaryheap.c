@@ -17,7 +17,7 @@
  */
 
 /*
- * binaryheap.c - binary heap implementation
+ * binaryheap.c - bounded heap implementation
  */
 #include <stdlib.h>
 #include <assert.h>
@@ -25,9 +25,14 @@
 #include "memory_alloc.h"
 #include "error_manager.h"
 
-#define BH_PARENT(i)	((i - 1)/2)
-#define BH_LEFT(i)	(2*(i) + 1)
-#define BH_RIGHT(i)	(2*(i)+2)
+/* The heap is laid out d-ary rather than binary: all the children of a node
+ * are adjacent in the element array, so a sift-down touches one contiguous
+ * block per level and the tree is half as deep. A fanout of 4 keeps the
+ * comparisons per level cheap while the children of small elements still
+ * share a cache line. */
+#define BH_FANOUT	4
+#define BH_PARENT(i)	(((i) - 1) / BH_FANOUT)
+#define BH_FIRST_CHILD(i)	(BH_FANOUT * (i) + 1)
 #define BH_ELEMENT_COPY(heap, dest, src) (memcpy (dest, src, (heap)->elem_size))
 
 #define BH_SWAP(heap, left, right)						      \
@@ -55,17 +60,11 @@ static void bh_replace_max (BINARY_HEAP * heap, void *elem);
 static void
 bh_up_heap (BINARY_HEAP * heap, int index)
 {
-  if (index == 0)
+  while (index > 0 && BH_CMP (heap, BH_PARENT (index), index) == BH_LT)
     {
-      return;
-    }
-
-  if (BH_CMP (heap, BH_PARENT (index), index) == BH_LT)
-    {
-      /* swap element with parent */
+      /* swap element with parent and shift parent */
       BH_SWAP (heap, index, BH_PARENT (index));
-      /* shift parent */
-      bh_up_heap (heap, BH_PARENT (index));
+      index = BH_PARENT (index);
     }
 }
 
@@ -78,24 +77,32 @@ bh_up_heap (BINARY_HEAP * heap, int index)
 void
 bh_down_heap (BINARY_HEAP * heap, int index)
 {
-  int left = BH_LEFT (index);
-  int right = BH_RIGHT (index);
-  int largest = index;
+  int child, last_child, largest;
 
-  if (left <= heap->element_count - 1 && BH_CMP (heap, left, largest) == BH_GT)
+  for (;;)
     {
-      largest = left;
-    }
+      largest = index;
 
-  if (right <= heap->element_count - 1 && BH_CMP (heap, right, largest) == BH_GT)
-    {
-      largest = right;
-    }
+      /* the children occupy one contiguous block of the element array */
+      last_child = BH_FIRST_CHILD (index) + BH_FANOUT;
+      if (last_child > heap->element_count)
+	{
+	  last_child = heap->element_count;
+	}
+      for (child = BH_FIRST_CHILD (index); child < last_child; child++)
+	{
+	  if (BH_CMP (heap, child, largest) == BH_GT)
+	    {
+	      largest = child;
+	    }
+	}
 
-  if (largest != index)
-    {
+      if (largest == index)
+	{
+	  return;
+	}
       BH_SWAP (heap, index, largest);
-      bh_down_heap (heap, largest);
+      index = largest;
     }
 }
 
@@ -1698,7 +1698,9 @@
 
 #define ER_LOG_TOO_SANE_TO_RECREATE                 -1332
 
-#define ER_LAST_ERROR                               -1333
+#define ER_IO_PAGE_CHECKSUM_MISMATCH                -1333
+
+#define ER_LAST_ERROR                               -1334
 /*
  * CAUTION!
  *
@@ -138,6 +138,12 @@ namespace cuberr
   void
   er_message::clear_error ()
   {
+    if (err_id == NO_ERROR && file_name == NULL)
+      {
+	// already clear. bail out without touching the message area, which may live in a cold heap allocation;
+	// every setter (set_error, er_emergency) fills file_name, so this signature cannot hide a set error.
+	return;
+      }
     err_id = NO_ERROR;
     severity = ER_WARNING_SEVERITY;
     file_name = NULL;
@@ -171,6 +177,34 @@ namespace cuberr
       }
   }
 
+  char *
+  er_message::release_message_area (std::size_t &size)
+  {
+    if (msg_area == msg_buffer)
+      {
+	return NULL;
+      }
+
+    char *area = msg_area;
+    size = msg_area_size;
+
+    msg_area = msg_buffer;
+    msg_area_size = sizeof (msg_buffer);
+
+    return area;
+  }
+
+  void
+  er_message::adopt_message_area (char *area, std::size_t size)
+  {
+    assert (area != NULL && size > sizeof (msg_buffer));
+    assert (msg_area == msg_buffer);    // only a pristine message may adopt an area
+
+    msg_area = area;
+    msg_area_size = size;
+    msg_area[0] = '\0';
+  }
+
   void
   er_message::clear_args (void)
   {
@@ -208,6 +242,8 @@ namespace cuberr
   context::context (bool automatic_registration, bool logging)
     : m_base_level (m_logging)
     , m_stack ()
+    , m_spare_area (NULL)
+    , m_spare_area_size (0)
     , m_automatic_registration (automatic_registration)
     , m_logging (LOG_ME && logging)
     , m_destroyed (false)
@@ -224,6 +260,10 @@ namespace cuberr
     assert (!m_destroyed);
     m_destroyed = true;
 
+    delete [] m_spare_area;
+    m_spare_area = NULL;
+    m_spare_area_size = 0;
+
     if (tl_Context_p == this)
       {
 	assert (m_automatic_registration);
@@ -276,6 +316,14 @@ namespace cuberr
   context::push_error_stack (void)
   {
     m_stack.emplace (m_logging);
+
+    if (m_spare_area != NULL)
+      {
+	// seed the new level with the recycled area instead of growing a new one on demand
+	m_stack.top ().adopt_message_area (m_spare_area, m_spare_area_size);
+	m_spare_area = NULL;
+	m_spare_area_size = 0;
+      }
   }
 
   void
@@ -296,6 +344,12 @@ namespace cuberr
     er_message temp (m_logging);
     pop_error_stack (temp);
 
+    if (m_spare_area == NULL)
+      {
+	// keep the grown area for the next push instead of freeing it
+	m_spare_area = temp.release_message_area (m_spare_area_size);
+      }
+
     // popped memory is freed
   }
 
@@ -54,6 +54,8 @@ namespace cuberr
       void set_error (int error_id, int error_severity, const char *filename, int line_no);  // set error
       void reserve_message_area (std::size_t size);
       void clear_message_area (void);
+      char *release_message_area (std::size_t &size);   // give up heap message area (NULL if none); caller owns it
+      void adopt_message_area (char *area, std::size_t size);   // take ownership of a recycled heap message area
       void clear_args (void);
 
       int err_id;			/* Error identifier of the current message */
@@ -109,6 +111,8 @@ namespace cuberr
 
       er_message m_base_level;
       std::stack<er_message> m_stack;
+      char *m_spare_area;                           // heap message area recycled between stack levels
+      std::size_t m_spare_area_size;
       bool m_automatic_registration;
       bool m_logging;                               // activate logging
       bool m_destroyed;                             // set to true on destruction
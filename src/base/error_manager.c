@@ -1494,8 +1494,8 @@ er_set_internal (int severity, const char *file_name, const int line_no, int err
     }
 
   /* Call the logging function if any */
-  if (severity <= prm_get_integer_value (PRM_ID_ER_LOG_LEVEL)
-      && !(prm_get_bool_value (PRM_ID_ER_LOG_WARNING) == false && severity == ER_WARNING_SEVERITY)
+  if (severity <= sysprm_get_hot_params ()->er_log_level
+      && !(sysprm_get_hot_params ()->er_log_warning == false && severity == ER_WARNING_SEVERITY)
       && er_Fnlog[severity] != NULL)
     {
       // *INDENT-OFF*
@@ -2173,8 +2173,8 @@ er_set_area_error (char *server_area)
   memcpy (crt_error.msg_area, ptr, length);
 
   /* Call the logging function if any */
-  if (severity <= prm_get_integer_value (PRM_ID_ER_LOG_LEVEL)
-      && !(prm_get_bool_value (PRM_ID_ER_LOG_WARNING) == false && severity == ER_WARNING_SEVERITY)
+  if (severity <= sysprm_get_hot_params ()->er_log_level
+      && !(sysprm_get_hot_params ()->er_log_warning == false && severity == ER_WARNING_SEVERITY)
       && er_Fnlog[severity] != NULL)
     {
       // *INDENT-OFF*
@@ -58,6 +58,9 @@
 #define EUC_SPACE 0xa1		/* for euckr */
 #define ASCII_SPACE 0x20
 
+/* block size used when skipping the common prefix of two strings with memcmp */
+#define LANG_FASTCMP_MEMCMP_BLOCK 64
+
 static INTL_LANG lang_Lang_id = INTL_LANG_ENGLISH;
 static char lang_Loc_name[LANG_MAX_LANGNAME] = LANG_NAME_DEFAULT;
 static char lang_Msg_loc_name[LANG_MAX_LANGNAME] = LANG_NAME_DEFAULT;
@@ -5496,35 +5499,55 @@ static int
 lang_fastcmp_byte (const LANG_COLLATION * lang_coll, const unsigned char *string1, const int size1,
 		   const unsigned char *string2, const int size2, bool ignore_trailing_space)
 {
-  int n, i, cmp;
+  int n, i, j, block, cmp;
   unsigned int c1, c2;
   const unsigned int *weight = (ignore_trailing_space) ? lang_coll->coll.weights_ti : lang_coll->coll.weights;
 
 
   n = size1 < size2 ? size1 : size2;
-  for (i = 0, cmp = 0; i < n && cmp == 0; i++)
+  cmp = 0;
+  for (i = 0; i < n && cmp == 0;)
     {
-      c1 = *string1++;
-      if (c1 == SPACE)
+      block = n - i;
+      if (block > LANG_FASTCMP_MEMCMP_BLOCK)
 	{
-	  c1 = ZERO;
-	}
-      else
-	{
-	  c1 = weight[c1];
+	  block = LANG_FASTCMP_MEMCMP_BLOCK;
 	}
 
-      c2 = *string2++;
-      if (c2 == SPACE)
+      /* identical bytes always have identical weights, no matter the collation; let memcmp skip the common prefix
+       * whole words at a time and apply weights only around the first difference */
+      if (memcmp (string1, string2, block) == 0)
 	{
-	  c2 = ZERO;
+	  string1 += block;
+	  string2 += block;
+	  i += block;
+	  continue;
 	}
-      else
+
+      for (j = 0; j < block && cmp == 0; j++, i++)
 	{
-	  c2 = weight[c2];
-	}
+	  c1 = *string1++;
+	  if (c1 == SPACE)
+	    {
+	      c1 = ZERO;
+	    }
+	  else
+	    {
+	      c1 = weight[c1];
+	    }
 
-      cmp = c1 - c2;
+	  c2 = *string2++;
+	  if (c2 == SPACE)
+	    {
+	      c2 = ZERO;
+	    }
+	  else
+	    {
+	      c2 = weight[c2];
+	    }
+
+	  cmp = c1 - c2;
+	}
     }
 
   if (cmp || size1 == size2)
@@ -6458,21 +6481,18 @@ static int
 lang_fastcmp_binary (const LANG_COLLATION * lang_coll, const unsigned char *string1, const int size1,
 		     const unsigned char *string2, const int size2, bool ignore_trailing_space)
 {
-  int i, size;
+  int i, size, cmp;
 
   size = size1 < size2 ? size1 : size2;
-  for (i = 0; i < size; i++, string1++, string2++)
+
+  /* weights are the bytes themselves; memcmp compares whole words at a time */
+  cmp = memcmp (string1, string2, size);
+  if (cmp != 0)
     {
-      /* compare weights of the two chars */
-      if (*string1 > *string2)
-	{
-	  return 1;
-	}
-      else if (*string1 < *string2)
-	{
-	  return -1;
-	}
+      return (cmp > 0) ? 1 : -1;
     }
+  string1 += size;
+  string2 += size;
 
   if (size1 < size2)
     {
@@ -6532,6 +6552,21 @@ lang_strmatch_binary (const LANG_COLLATION * lang_coll, bool is_match, const uns
   str1_begin = str1;
   str1_end = str1 + size1;
   str2_end = str2 + size2;
+
+  if (!is_match || escape == NULL)
+    {
+      /* no escape processing needed; memcmp compares whole words at a time */
+      int size = (size1 < size2) ? size1 : size2;
+      int cmp = memcmp (str1, str2, size);
+
+      if (cmp != 0)
+	{
+	  return (cmp < 0) ? -1 : 1;
+	}
+      str1 += size;
+      str2 += size;
+    }
+
   for (; str1 < str1_end && str2 < str2_end; str1++, str2++)
     {
       assert (str1_end - str1 > 0);
@@ -47,6 +47,7 @@ LF_TRAN_SYSTEM spage_saving_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 LF_TRAN_SYSTEM obj_lock_res_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 LF_TRAN_SYSTEM obj_lock_ent_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 LF_TRAN_SYSTEM catalog_Ts = LF_TRAN_SYSTEM_INITIALIZER;
+LF_TRAN_SYSTEM catalog_snapshot_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 LF_TRAN_SYSTEM sessions_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 LF_TRAN_SYSTEM free_sort_list_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 LF_TRAN_SYSTEM global_unique_stats_Ts = LF_TRAN_SYSTEM_INITIALIZER;
@@ -469,6 +470,10 @@ lf_initialize_transaction_systems (int max_threads)
     {
       goto error;
     }
+  if (lf_tran_system_init (&catalog_snapshot_Ts, max_threads) != NO_ERROR)
+    {
+      goto error;
+    }
   if (lf_tran_system_init (&sessions_Ts, max_threads) != NO_ERROR)
     {
       goto error;
@@ -523,6 +528,7 @@ lf_destroy_transaction_systems (void)
   lf_tran_system_destroy (&obj_lock_res_Ts);
   lf_tran_system_destroy (&obj_lock_ent_Ts);
   lf_tran_system_destroy (&catalog_Ts);
+  lf_tran_system_destroy (&catalog_snapshot_Ts);
   lf_tran_system_destroy (&sessions_Ts);
   lf_tran_system_destroy (&free_sort_list_Ts);
   lf_tran_system_destroy (&global_unique_stats_Ts);
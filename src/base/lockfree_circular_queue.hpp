@@ -66,6 +66,15 @@ namespace lockfree
       inline bool produce (const T &element);         // produce an element to queue; returns false on fail
       inline void force_produce (const T &element);   // force produce (loop until successful)
 
+      // batched counterparts for producers/consumers that work in bursts. the produce/consume cursor - the contended
+      // atomic - is advanced once for the whole batch instead of once per element, so a burst of N elements costs one
+      // cursor compare & swap instead of N.
+      //
+      // both return the number of elements actually transferred, which may be less than count (down to 0) when the
+      // queue fills/empties or a concurrent operation cuts the batch short.
+      inline std::size_t produce_bulk (const T *elements, std::size_t count);
+      inline std::size_t consume_bulk (T *elements, std::size_t count);
+
       inline std::uint64_t get_consumer_cursor ();            // get consume cursor
 
       // note:
@@ -90,6 +99,7 @@ namespace lockfree
 
       inline cursor_type load_cursor (atomic_cursor_type &cursor);
       inline bool test_and_increment_cursor (atomic_cursor_type &cursor, cursor_type crt_value);
+      inline bool test_and_advance_cursor (atomic_cursor_type &cursor, cursor_type crt_value, cursor_type new_value);
 
       inline T load_data (cursor_type consume_cursor) const;
       inline void store_data (cursor_type index, const T &data);
@@ -296,6 +306,76 @@ namespace lockfree
       }
   }
 
+  template<class T>
+  inline std::size_t
+  circular_queue<T>::produce_bulk (const T *elements, std::size_t count)
+  {
+    cursor_type cc;
+    cursor_type pc;
+    std::size_t avail;
+    std::size_t blocked;
+    std::size_t index;
+
+    // batched produce:
+    //
+    // the slot-blocking protocol of produce () is kept, so bulk and single producers can share a queue. the batch
+    // starts like a single produce - block the slot at the produce cursor - and then extends by blocking as many
+    // following slots as possible. extension can only be stopped by a competing producer of the same generation
+    // winning a slot (slots within the available range always hold their expected cursor value; see produce ()), in
+    // which case the batch simply ends where the competitor starts.
+    //
+    // once the range [pc, pc + blocked) is owned, the produce cursor is advanced past it. a single compare & swap
+    // covers the whole range in the uncontended case; when competitors interleave their own increments (they advance
+    // the cursor as they skip our blocked slots), the cursor is pushed to the end of the range in a retry loop.
+    // consumers that reach a blocked slot before its data is stored treat the queue as empty, same as with single
+    // produce.
+
+    assert (count > 0);
+
+    while (true)
+      {
+	pc = load_cursor (m_produce_cursor);
+	cc = load_cursor (m_consume_cursor);
+
+	if (test_full_cursors (pc, cc))
+	  {
+	    /* cannot produce */
+	    return 0;
+	  }
+	avail = (std::size_t) (cc + m_capacity - pc);
+
+	if (!block (pc))
+	  {
+	    // lost the first slot; help advance the cursor and retry, like produce ()
+	    test_and_increment_cursor (m_produce_cursor, pc);
+	    continue;
+	  }
+
+	// first slot is ours; extend the batch while slots are free
+	for (blocked = 1; blocked < count && blocked < avail && block (pc + blocked); blocked++)
+	  ;
+
+	// advance produce cursor past the owned range
+	if (!test_and_advance_cursor (m_produce_cursor, pc, pc + blocked))
+	  {
+	    // competitors are stepping the cursor through our blocked slots; push it to the end of the range
+	    cursor_type crt_cursor;
+	    while ((crt_cursor = load_cursor (m_produce_cursor)) < pc + blocked)
+	      {
+		test_and_advance_cursor (m_produce_cursor, crt_cursor, pc + blocked);
+	      }
+	  }
+
+	// store data and publish the slots
+	for (index = 0; index < blocked; index++)
+	  {
+	    store_data (pc + index, elements[index]);
+	    unblock (pc + index);
+	  }
+	return blocked;
+      }
+  }
+
   template<class T>
   inline void
   circular_queue<T>::force_produce (const T &element)
@@ -369,6 +449,57 @@ namespace lockfree
     return true;
   }
 
+  template<class T>
+  inline std::size_t
+  circular_queue<T>::consume_bulk (T *elements, std::size_t count)
+  {
+    cursor_type cc;
+    cursor_type pc;
+    std::size_t ready;
+    std::size_t produced;
+
+    // batched consume:
+    //
+    // same protocol as consume (), amortized: all ready elements are copied out first and the consume cursor is then
+    // advanced over the whole batch with a single compare & swap. if the compare & swap fails, another consumer took
+    // elements from under us; the copies are discarded and everything is retried. the copy-then-advance order is what
+    // makes the discarded copies safe - producers cannot overwrite a slot before the consume cursor passes it.
+    //
+    // the batch is cut short at the first blocked slot (produce in progress), exactly like single consume stops there.
+
+    assert (count > 0);
+
+    while (true)
+      {
+	cc = load_cursor (m_consume_cursor);
+	pc = load_cursor (m_produce_cursor);
+
+	if (test_empty_cursors (pc, cc))
+	  {
+	    /* empty */
+	    return 0;
+	  }
+	produced = (std::size_t) (pc - cc);
+
+	for (ready = 0; ready < count && ready < produced && !is_blocked (cc + ready); ready++)
+	  {
+	    elements[ready] = load_data (cc + ready);
+	  }
+	if (ready == 0)
+	  {
+	    // first element is not yet produced. this means we can consider the queue still empty
+	    return 0;
+	  }
+
+	if (test_and_advance_cursor (m_consume_cursor, cc, cc + ready))
+	  {
+	    // consume is complete
+	    return ready;
+	  }
+	// lost the race to another consumer; retry
+      }
+  }
+
   template<class T>
   inline bool
   circular_queue<T>::is_empty () const
@@ -443,6 +574,15 @@ namespace lockfree
     return cursor.compare_exchange_strong (crt_value, crt_value + 1);
   }
 
+  template<class T>
+  inline bool
+  circular_queue<T>::test_and_advance_cursor (atomic_cursor_type &cursor, cursor_type crt_value, cursor_type new_value)
+  {
+    // like test_and_increment_cursor, but jumps the cursor over a whole bulk-owned range
+    assert (crt_value < new_value);
+    return cursor.compare_exchange_strong (crt_value, new_value);
+  }
+
   template<class T>
   inline std::size_t
   circular_queue<T>::get_cursor_index (cursor_type cursor) const
@@ -35,6 +35,8 @@
 #include <limits>
 #include <mutex>
 #include <ostream>
+#include <thread>
+#include <vector>
 
 namespace lockfree
 {
@@ -62,6 +64,11 @@ namespace lockfree
 
       void clear (tran::index tran_index);    // NOT LOCK-FREE
 
+      // grow the bucket array to new_size without blocking concurrent operations; see the implementation for details.
+      // NOT LOCK-FREE for the caller; finds/inserts/erases remain lock-free, except on the small batch of buckets
+      // being migrated at a given moment
+      void resize (size_t new_size);
+
       T *freelist_claim (tran::index tran_index);
       void freelist_retire (tran::index tran_index, T *&entry);
 
@@ -79,6 +86,9 @@ namespace lockfree
     private:
       using address_type = address_marker<T>;
 
+      // number of buckets migrated between two grace period waits during resize ()
+      static const size_t RESIZE_BUCKET_BATCH_SIZE = 64;
+
       // wrap T with on_reclaim functionality based on edesc.f_uninit
       struct freelist_node_data
       {
@@ -105,7 +115,13 @@ namespace lockfree
       size_t m_size;
 
       T **m_backbuffer;
-      std::mutex m_backbuffer_mutex;
+      std::mutex m_backbuffer_mutex;          // also serializes resize () against clear () and other resizes
+
+      // incremental resize state; see resize ()
+      T **volatile m_old_buckets;             // previous bucket array while a resize migrates it; NULL otherwise
+      volatile size_t m_old_size;
+      volatile unsigned int m_resize_count;   // incremented when a resize starts and again when it completes
+      std::vector<T **> m_retired_buckets;    // replaced bucket arrays; kept until destroy for late readers
 
       lf_entry_descriptor *m_edesc;
 
@@ -150,6 +166,9 @@ namespace lockfree
 
       size_t get_hash (Key &key) const;
       T *&get_bucket (Key &key);
+      T *&get_bucket_for_op (Key &key, T **&owner_buckets);
+      bool is_miss_final (Key &key, unsigned int resize_count, T **owner_buckets);
+      void wait_resize_grace_period ();
       tran::descriptor &get_tran_descriptor (tran::index tran_index);
 
       void list_find (tran::index tran_index, T *list_head, Key &key, int *behavior_flags, T *&found_node);
@@ -206,6 +225,10 @@ namespace lockfree
     , m_size (0)
     , m_backbuffer (NULL)
     , m_backbuffer_mutex ()
+    , m_old_buckets (NULL)
+    , m_old_size (0)
+    , m_resize_count (0)
+    , m_retired_buckets ()
     , m_edesc (NULL)
     , m_stat_find ()
     , m_stat_insert ()
@@ -246,6 +269,14 @@ namespace lockfree
 	  }
       }
 
+    // a resize completes before returning to its caller; no migration can be in progress here
+    assert (m_old_buckets == NULL);
+    for (size_t i = 0; i < m_retired_buckets.size (); i++)
+      {
+	delete [] m_retired_buckets[i];
+      }
+    m_retired_buckets.clear ();
+
     delete [] m_buckets;
     m_buckets = NULL;
     delete [] m_backbuffer;
@@ -281,18 +312,28 @@ namespace lockfree
     ct_stat_type::autotimer stat_autotimer (m_stat_find, m_active_stats);
 
     int bflags = 0;
-    bool restart = true;
     T *entry = NULL;
+    T **owner_buckets = NULL;
+    unsigned int resize_count;
 
-    while (restart)
+    while (true)
       {
-	T *&list_head = get_bucket (key);
+	resize_count = m_resize_count;
+	T *&list_head = get_bucket_for_op (key, owner_buckets);
 	entry = NULL;
 	bflags = LF_LIST_BF_RETURN_ON_RESTART;
 	list_find (tran_index, list_head, key, &bflags, entry);
-	restart = (bflags & LF_LIST_BR_RESTARTED) != 0;
+	if ((bflags & LF_LIST_BR_RESTARTED) != 0)
+	  {
+	    continue;
+	  }
+	if (entry == NULL && !is_miss_final (key, resize_count, owner_buckets))
+	  {
+	    // a concurrent resize moved the bucket content while it was scanned; the scan may have terminated early
+	    continue;
+	  }
+	return entry;
       }
-    return entry;
   }
 
   template <class Key, class T>
@@ -383,6 +424,9 @@ namespace lockfree
     /* lock mutex */
     std::unique_lock<std::mutex> ulock (m_backbuffer_mutex);
 
+    /* the mutex also excludes resize; no migration can be in progress */
+    assert (m_old_buckets == NULL);
+
     /* swap bucket pointer with current backbuffer */
     T **old_buckets = ATOMIC_TAS_ADDR (&m_buckets, m_backbuffer);
 
@@ -471,6 +515,194 @@ namespace lockfree
     return m_buckets[get_hash (key)];
   }
 
+  //
+  // incremental resize
+  //
+  // resize () grows the bucket array without blocking concurrent operations. the old bucket array is published as
+  // m_old_buckets and a new, larger array replaces m_buckets. the old buckets are then migrated in batches:
+  //
+  //   1. each bucket head in the batch gets the address mark set (frozen). operations that pick a bucket treat the
+  //      mark as ownership information: an unmarked old bucket is still authoritative, a marked NULL head means the
+  //      content moved to the current array, and a marked non-NULL head means the move is in progress.
+  //   2. one grace period is waited per batch: all lock-free transactions that started before the freeze - and could
+  //      still traverse or link into the frozen chains - must finish.
+  //   3. the frozen chains, now only reachable by the resizer, are relinked node by node into the current array and
+  //      the old heads become marked NULL.
+  //
+  // writers re-validate the bucket head after starting their transaction (see list_insert_internal / list_delete), so
+  // any write that lands in a frozen chain is covered by the grace period and gets migrated with it. readers never
+  // block on frozen chains; they may scan stale links during a move, and a missed key is detected by is_miss_final ()
+  // and the search restarted. replaced bucket arrays are kept until destroy (), so a late reader holding a stale
+  // pointer only ever sees marked NULL heads that redirect it to the current array.
+  //
+
+  template <class Key, class T>
+  T *&
+  hashmap<Key, T>::get_bucket_for_op (Key &key, T **&owner_buckets)
+  {
+    while (true)
+      {
+	T **old_buckets = m_old_buckets;
+	if (old_buckets == NULL)
+	  {
+	    // no resize in progress
+	    owner_buckets = m_buckets;
+	    return owner_buckets[get_hash (key)];
+	  }
+
+	T *&old_head_ref = old_buckets[m_edesc->f_hash (&key, (int) m_old_size)];
+	T *old_head = old_head_ref;
+	if (!address_type::is_address_marked (old_head))
+	  {
+	    // not migrated yet; the old generation owns the bucket
+	    owner_buckets = old_buckets;
+	    return old_head_ref;
+	  }
+	if (address_type::strip_address_mark (old_head) == NULL)
+	  {
+	    // fully migrated; the current generation owns the bucket
+	    owner_buckets = m_buckets;
+	    return owner_buckets[get_hash (key)];
+	  }
+
+	// the bucket is being moved right now; the window is short (one batch relink)
+	std::this_thread::yield ();
+      }
+  }
+
+  template <class Key, class T>
+  bool
+  hashmap<Key, T>::is_miss_final (Key &key, unsigned int resize_count, T **owner_buckets)
+  {
+    if (m_resize_count != resize_count)
+      {
+	// a resize started or completed while the bucket was scanned
+	return false;
+      }
+    T **old_buckets = m_old_buckets;
+    if (old_buckets == NULL)
+      {
+	// no resize was in progress during the scan
+	return true;
+      }
+    T *old_head = old_buckets[m_edesc->f_hash (&key, (int) m_old_size)];
+    if (!address_type::is_address_marked (old_head))
+      {
+	// the bucket was never frozen; the scan was valid if it targeted the old generation
+	return owner_buckets == old_buckets;
+      }
+    if (address_type::strip_address_mark (old_head) == NULL)
+      {
+	// the bucket was fully migrated; the scan was valid if it targeted the current generation
+	return owner_buckets == m_buckets;
+      }
+    // the bucket is being moved right now; nothing can be concluded from a miss
+    return false;
+  }
+
+  template <class Key, class T>
+  void
+  hashmap<Key, T>::wait_resize_grace_period ()
+  {
+    tran::table &tbl = m_freelist->get_transaction_table ();
+    tran::id fence_id = tbl.get_new_global_tranid ();
+
+    // transactions that started before the fence have smaller IDs; wait for all of them to finish. transactions
+    // starting from now get at least fence_id and cannot have seen the pre-freeze bucket heads.
+    while (tbl.refresh_min_active_tranid () < fence_id)
+      {
+	std::this_thread::yield ();
+      }
+  }
+
+  template <class Key, class T>
+  void
+  hashmap<Key, T>::resize (size_t new_size)
+  {
+    // serialize against other resizes and against clear ()
+    std::unique_lock<std::mutex> ulock (m_backbuffer_mutex);
+
+    if (new_size <= m_size)
+      {
+	// only growing is supported
+	return;
+      }
+
+    T **new_buckets = new T *[new_size] ();
+    T **old_buckets = m_buckets;
+    size_t old_size = m_size;
+
+    // publish the old generation first; concurrent operations keep using it until their bucket is frozen, so the
+    // current array/size can be replaced afterwards without a coherent snapshot of both
+    m_old_size = old_size;
+    ATOMIC_TAS_ADDR (&m_old_buckets, old_buckets);
+    m_buckets = new_buckets;
+    m_size = new_size;
+    ATOMIC_INC_32 (&m_resize_count, 1);
+
+    for (size_t batch_start = 0; batch_start < old_size; batch_start += RESIZE_BUCKET_BATCH_SIZE)
+      {
+	size_t batch_end = batch_start + RESIZE_BUCKET_BATCH_SIZE;
+	if (batch_end > old_size)
+	  {
+	    batch_end = old_size;
+	  }
+
+	/* freeze the batch */
+	for (size_t i = batch_start; i < batch_end; i++)
+	  {
+	    T *head;
+	    // warning: this may spin
+	    do
+	      {
+		head = old_buckets[i];
+	      }
+	    while (!ATOMIC_CAS_ADDR (&old_buckets[i], head, address_type::set_adress_mark (head)));
+	  }
+
+	/* wait for all operations that could still traverse or link into the frozen chains */
+	wait_resize_grace_period ();
+
+	/* relink the frozen chains; they are only reachable by this thread now */
+	for (size_t i = batch_start; i < batch_end; i++)
+	  {
+	    T *node = address_type::strip_address_mark (old_buckets[i]);
+	    T *next = NULL;
+	    while (node != NULL)
+	      {
+		next = address_type::strip_address_mark (get_nextp (node));
+
+		size_t new_index = m_edesc->f_hash (get_keyp (node), (int) new_size);
+		T *curr_head;
+		do
+		  {
+		    curr_head = new_buckets[new_index];
+		    get_nextp_ref (node) = curr_head;
+		  }
+		while (!ATOMIC_CAS_ADDR (&new_buckets[new_index], curr_head, node));
+
+		node = next;
+	      }
+	    // permanently mark the old bucket as migrated
+	    ATOMIC_TAS_ADDR (&old_buckets[i], address_type::set_adress_mark ((T *) NULL));
+	  }
+      }
+
+    /* the backbuffer used by clear () must match the new bucket count */
+    delete [] m_backbuffer;
+    m_backbuffer = new T *[new_size];
+    for (size_t i = 0; i < new_size; i++)
+      {
+	m_backbuffer[i] = address_type::set_adress_mark (NULL);
+      }
+
+    /* close the migration; bump the counter before hiding the old generation so that scans validated against the old
+     * value restart and re-check ownership */
+    m_retired_buckets.push_back (old_buckets);
+    ATOMIC_INC_32 (&m_resize_count, 1);
+    ATOMIC_TAS_ADDR (&m_old_buckets, (T **) NULL);
+  }
+
   template <class Key, class T>
   tran::descriptor &
   hashmap<Key, T>::get_tran_descriptor (tran::index tran_index)
@@ -906,6 +1138,21 @@ namespace lockfree
 	curr_p = &list_head;
 	curr = address_type::atomic_strip_address_mark (*curr_p);
 
+	/* an incremental resize (or a clear) may have frozen this bucket after it was selected. writing into a frozen
+	 * chain is not allowed; return to the caller to pick the bucket's current location. the check is done after
+	 * starting the transaction: any freeze from now on waits for us through the resize grace period. */
+	if (address_type::is_address_marked (*curr_p))
+	  {
+	    assert (behavior_flags != NULL && (*behavior_flags & LF_LIST_BF_RETURN_ON_RESTART) != 0);
+	    if (entry != NULL && !LF_LIST_BF_IS_FLAG_SET (behavior_flags, LF_LIST_BF_INSERT_GIVEN))
+	      {
+		save_temporary (tdes, entry);
+	      }
+	    LF_LIST_BR_SET_FLAG (behavior_flags, LF_LIST_BR_RESTARTED);
+	    end_tran_force (tdes);
+	    return false;
+	  }
+
 	/* search */
 	while (curr_p != NULL)    // this is always true actually...
 	  {
@@ -1118,6 +1365,17 @@ namespace lockfree
 	curr_p = &list_head;
 	curr = address_type::atomic_strip_address_mark (*curr_p);
 
+	/* an incremental resize (or a clear) may have frozen this bucket after it was selected. unlinking from a
+	 * frozen chain is not allowed; return to the caller to pick the bucket's current location. the check is done
+	 * after starting the transaction: any freeze from now on waits for us through the resize grace period. */
+	if (address_type::is_address_marked (*curr_p))
+	  {
+	    assert (behavior_flags != NULL && (*behavior_flags & LF_LIST_BF_RETURN_ON_RESTART) != 0);
+	    LF_LIST_BR_SET_FLAG (behavior_flags, LF_LIST_BR_RESTARTED);
+	    end_tran_force (tdes);
+	    return false;
+	  }
+
 	/* search */
 	while (curr != NULL)
 	  {
@@ -1263,10 +1521,11 @@ namespace lockfree
     ct_stat_type::autotimer stat_autotimer (m_stat_insert, m_active_stats);
 
     bool inserted = false;
+    T **owner_buckets = NULL;
 
     while (true)
       {
-	T *&list_head = get_bucket (key);
+	T *&list_head = get_bucket_for_op (key, owner_buckets);
 	if (LF_LIST_BF_IS_FLAG_SET (&bflags, LF_LIST_BF_INSERT_GIVEN))
 	  {
 	    assert (entry != NULL);
@@ -1299,10 +1558,11 @@ namespace lockfree
     ct_stat_type::autotimer stat_autotimer (m_stat_erase, m_active_stats);
 
     bool erased = false;
+    T **owner_buckets = NULL;
 
     while (true)
       {
-	T *&list_head = get_bucket (key);
+	T *&list_head = get_bucket_for_op (key, owner_buckets);
 	erased = list_delete (tran_index, list_head, key, locked_entry, &bflags);
 	if ((bflags & LF_LIST_BR_RESTARTED) != 0)
 	  {
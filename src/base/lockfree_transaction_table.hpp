@@ -68,6 +68,9 @@ namespace lockfree
 	id get_current_global_tranid () const;
 	id get_new_global_tranid ();
 	id get_min_active_tranid () const;
+	// recompute the minimum active transaction ID instead of waiting for the periodic refresh; used by callers that
+	// must wait until all transactions older than a known ID have finished
+	id refresh_min_active_tranid ();
 
 	size_t get_total_retire_count () const;
 	size_t get_total_reclaim_count () const;
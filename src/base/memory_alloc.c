@@ -286,6 +286,76 @@ db_ostk_free (HL_HEAPID heap_id, void *ptr)
 }
 #endif /* ENABLE_UNUSED_FUNCTION */
 
+/*
+ * db_create_region_heap () - create a region (arena) heap
+ *   return: memory heap identifier
+ *   chunk_size(in):
+ *
+ * Note: A region heap is a bump-pointer arena: allocations carry no header
+ *       and cannot be freed individually, which makes it the cheap choice
+ *       for memory whose lifetime is bounded by a transaction or request.
+ *       db_clear_region_heap releases everything at once; compare with the
+ *       private heap, which pays lea bookkeeping on every alloc and free.
+ */
+HL_HEAPID
+db_create_region_heap (int chunk_size)
+{
+  return hl_register_region_heap (chunk_size);
+}
+
+/*
+ * db_destroy_region_heap () - destroy a region heap
+ *   return:
+ *   heap_id(in): memory heap identifier to destroy
+ */
+void
+db_destroy_region_heap (HL_HEAPID heap_id)
+{
+  if (heap_id)
+    {
+      hl_unregister_region_heap (heap_id);
+    }
+}
+
+/*
+ * db_region_alloc () - call allocation function for the region heap
+ *   return: allocated memory pointer
+ *   heap_id(in): memory heap identifier
+ *   size(in): size to allocate
+ *
+ * Note: There is no matching free; the memory lives until the next
+ *       db_clear_region_heap or db_destroy_region_heap on this heap.
+ */
+void *
+db_region_alloc (HL_HEAPID heap_id, size_t size)
+{
+  void *ptr = NULL;
+
+  if (heap_id && size > 0)
+    {
+      ptr = hl_region_alloc (heap_id, size);
+      if (ptr == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+	}
+    }
+  return ptr;
+}
+
+/*
+ * db_clear_region_heap () - release every allocation of the region heap
+ *   return:
+ *   heap_id(in): memory heap identifier to clear
+ */
+void
+db_clear_region_heap (HL_HEAPID heap_id)
+{
+  if (heap_id)
+    {
+      hl_clear_region_heap (heap_id);
+    }
+}
+
 /*
  * db_create_private_heap () - create a thread specific heap
  *   return: memory heap identifier
@@ -217,6 +217,11 @@ extern void *db_ostk_alloc (HL_HEAPID heap_id, size_t size);
 extern void db_ostk_free (HL_HEAPID heap_id, void *ptr);
 #endif
 
+extern HL_HEAPID db_create_region_heap (int chunk_size);
+extern void db_destroy_region_heap (HL_HEAPID heap_id);
+extern void *db_region_alloc (HL_HEAPID heap_id, size_t size);
+extern void db_clear_region_heap (HL_HEAPID heap_id);
+
 extern HL_HEAPID db_create_private_heap (void);
 extern void db_clear_private_heap (THREAD_ENTRY * thread_p, HL_HEAPID heap_id);
 extern HL_HEAPID db_change_private_heap (THREAD_ENTRY * thread_p, HL_HEAPID heap_id);
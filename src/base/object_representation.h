@@ -1259,6 +1259,8 @@ extern int or_put_byte (OR_BUF * buf, int num);
 extern int or_put_short (OR_BUF * buf, int num);
 extern int or_put_int (OR_BUF * buf, int num);
 extern int or_put_bigint (OR_BUF * buf, DB_BIGINT num);
+extern int or_varint_length (DB_BIGINT value);
+extern int or_put_varint (OR_BUF * buf, DB_BIGINT value);
 extern int or_put_float (OR_BUF * buf, float num);
 extern int or_put_double (OR_BUF * buf, double num);
 extern int or_put_time (OR_BUF * buf, DB_TIME * timeval);
@@ -1289,6 +1291,7 @@ extern int or_get_byte (OR_BUF * buf, int *error);
 extern int or_get_short (OR_BUF * buf, int *error);
 extern int or_get_int (OR_BUF * buf, int *error);
 extern DB_BIGINT or_get_bigint (OR_BUF * buf, int *error);
+extern DB_BIGINT or_get_varint (OR_BUF * buf, int *error);
 extern float or_get_float (OR_BUF * buf, int *error);
 extern double or_get_double (OR_BUF * buf, int *error);
 extern int or_get_time (OR_BUF * buf, DB_TIME * timeval);
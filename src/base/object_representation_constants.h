@@ -45,6 +45,9 @@
 #define OR_FLOAT_SIZE           4
 #define OR_DOUBLE_SIZE          8
 
+/* maximum encoded size of a variable-length integer (64 bits in groups of 7) */
+#define OR_MAX_VARINT_SIZE      10
+
 #define OR_BIGINT_ALIGNED_SIZE  (OR_BIGINT_SIZE + MAX_ALIGNMENT)
 #define OR_DOUBLE_ALIGNED_SIZE  (OR_DOUBLE_SIZE + MAX_ALIGNMENT)
 #define OR_PTR_ALIGNED_SIZE     (OR_PTR_SIZE + MAX_ALIGNMENT)
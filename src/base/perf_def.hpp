@@ -23,6 +23,8 @@
 #ifndef _PERF_DEF_HPP_
 #define _PERF_DEF_HPP_
 
+#include "tsc_clock.hpp"
+
 #include <atomic>
 #include <chrono>
 
@@ -35,8 +37,8 @@
 
 namespace cubperf
 {
-  // clocking
-  using clock = std::chrono::high_resolution_clock;   // default clock
+  // clocking; the time-stamp counter clock keeps now () cheap enough for always-on statistics
+  using clock = tsc_clock;                            // default clock
   using time_point = clock::time_point;               // default time point
   using duration = clock::duration;                   // default duration
 
@@ -79,6 +79,7 @@
 #include "heap_file.h"
 #include "vacuum.h"
 #include "xasl_cache.h"
+#include "query_manager.h"
 #include "load_worker_manager.hpp"
 
 #if defined (SERVER_MODE)
@@ -129,6 +130,7 @@ static int f_load_Time_get_oldest_mvcc_acquire_time (void);
 static int f_load_Count_get_oldest_mvcc_retry (void);
 static int f_load_thread_stats (void);
 static int f_load_thread_daemon_stats (void);
+static int f_load_time_histogram (void);
 
 static void f_dump_in_file_Num_data_page_fix_ext (FILE *, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_data_page_promote_ext (FILE *, const UINT64 * stat_vals);
@@ -142,6 +144,7 @@ static void f_dump_in_file_Time_obj_lock_acquire_time (FILE *, const UINT64 * st
 static void f_dump_in_file_thread_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_thread_daemon_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_dwb_flushed_block_volumes (FILE *, const UINT64 * stat_vals);
+static void f_dump_in_file_time_histogram (FILE *, const UINT64 * stat_vals);
 
 static void f_dump_in_buffer_Num_data_page_fix_ext (char **, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_data_page_promote_ext (char **, const UINT64 * stat_vals, int *remaining_size);
@@ -155,6 +158,7 @@ static void f_dump_in_buffer_Time_obj_lock_acquire_time (char **, const UINT64 *
 static void f_dump_in_buffer_thread_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_thread_daemon_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_vals, int *remaining_size);
+static void f_dump_in_buffer_time_histogram (char **s, const UINT64 * stat_vals, int *remaining_size);
 
 static void perfmon_stat_dump_in_file_fix_page_array_stat (FILE *, const UINT64 * stats_ptr);
 static void perfmon_stat_dump_in_file_promote_page_array_stat (FILE *, const UINT64 * stats_ptr);
@@ -165,6 +169,7 @@ static void perfmon_stat_dump_in_file_page_fix_time_array_stat (FILE *, const UI
 static void perfmon_stat_dump_in_file_snapshot_array_stat (FILE *, const UINT64 * stats_ptr);
 static void perfmon_stat_dump_in_file_thread_stats (FILE * stream, const UINT64 * stats_ptr);
 static void perfmon_stat_dump_in_file_thread_daemon_stats (FILE * stream, const UINT64 * stats_ptr);
+static void perfmon_stat_dump_in_file_time_histogram_array_stat (FILE * stream, const UINT64 * stats_ptr);
 
 static void perfmon_stat_dump_in_buffer_fix_page_array_stat (const UINT64 * stats_ptr, char **s, int *remaining_size);
 static void perfmon_stat_dump_in_buffer_promote_page_array_stat (const UINT64 * stats_ptr, char **s,
@@ -179,6 +184,8 @@ static void perfmon_stat_dump_in_buffer_page_fix_time_array_stat (const UINT64 *
 static void perfmon_stat_dump_in_buffer_snapshot_array_stat (const UINT64 * stats_ptr, char **s, int *remaining_size);
 static void perfmon_stat_dump_in_buffer_thread_stats (const UINT64 * stats_ptr, char **s, int *remaining_size);
 static void perfmon_stat_dump_in_buffer_thread_daemon_stats (const UINT64 * stats_ptr, char **s, int *remaining_size);
+static void perfmon_stat_dump_in_buffer_time_histogram_array_stat (const UINT64 * stats_ptr, char **s,
+								    int *remaining_size);
 
 static void perfmon_print_timer_to_file (FILE * stream, int stat_index, UINT64 * stats_ptr);
 static void perfmon_print_timer_to_buffer (char **s, int stat_index, UINT64 * stats_ptr, int *remained_size);
@@ -293,6 +300,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_MJOINS, "Num_query_mjoins"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_OBJFETCHES, "Num_query_objfetches"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_QM_NUM_HOLDABLE_CURSORS, "Num_query_holdable_cursors"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_QM_NUM_HEAVY_QUERIES_WAITING, "Num_heavy_queries_waiting"),
 
   /* Execution statistics for external sort */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_SORT_NUM_IO_PAGES, "Num_sort_io_pages"),
@@ -482,6 +490,9 @@ PSTAT_METADATA pstat_Metadata[] = {
   /* hash anchor */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_HASH_ANCHOR_WAITS, "Num_data_page_hash_anchor_waits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_TIME_HASH_ANCHOR_WAIT, "Time_data_page_hash_anchor_wait"),
+  /* latch waits by priority class */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_TIME_LATCH_WAIT_TRAN, "Time_data_page_latch_wait_transaction"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_TIME_LATCH_WAIT_UTILITY, "Time_data_page_latch_wait_utility"),
   /* flushing */
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_PB_FLUSH_COLLECT, "flush_collect"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_PB_FLUSH_FLUSH, "flush_flush"),
@@ -604,7 +615,21 @@ PSTAT_METADATA pstat_Metadata[] = {
 			       &f_dump_in_buffer_Num_dwb_flushed_block_volumes,
 			       &f_load_Num_dwb_flushed_block_volumes),
   PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOAD_THREAD_STATS, "Thread_loaddb_stats_counters_timers",
-			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats)
+			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats),
+
+  /* latency histograms */
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOG_FLUSH_TIME_HISTOGRAM, "Time_histogram_log_flush",
+			       &f_dump_in_file_time_histogram, &f_dump_in_buffer_time_histogram,
+			       &f_load_time_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_PB_FIX_TIME_HISTOGRAM, "Time_histogram_data_page_fix_acquire",
+			       &f_dump_in_file_time_histogram, &f_dump_in_buffer_time_histogram,
+			       &f_load_time_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_OBJ_LOCK_WAIT_TIME_HISTOGRAM, "Time_histogram_obj_lock_waited",
+			       &f_dump_in_file_time_histogram, &f_dump_in_buffer_time_histogram,
+			       &f_load_time_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_QUERY_EXECUTE_TIME_HISTOGRAM, "Time_histogram_query_execute",
+			       &f_dump_in_file_time_histogram, &f_dump_in_buffer_time_histogram,
+			       &f_load_time_histogram)
 };
 
 STATIC_INLINE void perfmon_add_stat_at_offset (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, const int offset,
@@ -1299,6 +1324,29 @@ perfmon_db_flushed_block_volumes (THREAD_ENTRY * thread_p, int num_volumes)
     }
   perfmon_add_stat_at_offset (thread_p, PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES, offset, 1);
 }
+
+/*
+ *   perfmon_time_histogram - Count one duration into the log-linear latency histogram statistic
+ *   return: none
+ *
+ *   thread_p (in)      : thread entry
+ *   psid (in)          : histogram statistic id
+ *   duration_usec (in) : measured duration in microseconds
+ */
+void
+perfmon_time_histogram (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, UINT64 duration_usec)
+{
+  int offset = 0;
+
+  assert (pstat_Metadata[psid].valtype == PSTAT_COMPLEX_VALUE);
+
+  while (offset < PERF_TIME_HISTOGRAM_BUCKETS - 1 && duration_usec >= (((UINT64) 1) << (offset + 1)))
+    {
+      offset++;
+    }
+
+  perfmon_add_stat_at_offset (thread_p, psid, offset, 1);
+}
 #endif /* SERVER_MODE || SA_MODE */
 
 int
@@ -2907,6 +2955,90 @@ perfmon_stat_dump_in_file_flushed_block_volumes_array_stat (FILE * stream, const
     }
 }
 
+/*
+ * perfmon_stat_dump_in_file_time_histogram_array_stat () -
+ *
+ * stream(in): output file
+ * stats_ptr(in): start of array values
+ *
+ */
+static void
+perfmon_stat_dump_in_file_time_histogram_array_stat (FILE * stream, const UINT64 * stats_ptr)
+{
+  int bucket;
+  UINT64 counter = 0;
+  char buffer[32];
+
+  assert (stream != NULL);
+
+  for (bucket = 0; bucket < PERF_TIME_HISTOGRAM_BUCKETS; bucket++)
+    {
+      counter = stats_ptr[bucket];
+      if (counter == 0)
+	{
+	  continue;
+	}
+
+      if (bucket < PERF_TIME_HISTOGRAM_BUCKETS - 1)
+	{
+	  sprintf (buffer, "< %llu usec", (long long unsigned int) (((UINT64) 1) << (bucket + 1)));
+	}
+      else
+	{
+	  sprintf (buffer, ">= %llu usec", (long long unsigned int) (((UINT64) 1) << bucket));
+	}
+      fprintf (stream, "%-15s = %16llu\n", buffer, (long long unsigned int) counter);
+    }
+}
+
+/*
+ * perfmon_stat_dump_in_buffer_time_histogram_array_stat () -
+ *
+ * stats_ptr(in): start of array values
+ * s(in/out): output string (NULL if not used)
+ * remaining_size(in/out): remaining size in string s (NULL if not used)
+ *
+ */
+static void
+perfmon_stat_dump_in_buffer_time_histogram_array_stat (const UINT64 * stats_ptr, char **s, int *remaining_size)
+{
+  int bucket;
+  UINT64 counter = 0;
+  int ret;
+  char buffer[32];
+
+  assert (remaining_size != NULL);
+  assert (s != NULL);
+
+  if (*s != NULL)
+    {
+      for (bucket = 0; bucket < PERF_TIME_HISTOGRAM_BUCKETS; bucket++)
+	{
+	  counter = stats_ptr[bucket];
+	  if (counter == 0)
+	    {
+	      continue;
+	    }
+
+	  if (bucket < PERF_TIME_HISTOGRAM_BUCKETS - 1)
+	    {
+	      sprintf (buffer, "< %llu usec", (long long unsigned int) (((UINT64) 1) << (bucket + 1)));
+	    }
+	  else
+	    {
+	      sprintf (buffer, ">= %llu usec", (long long unsigned int) (((UINT64) 1) << bucket));
+	    }
+	  ret = snprintf (*s, *remaining_size, "%-15s = %16llu\n", buffer, (long long unsigned int) counter);
+	  *remaining_size -= ret;
+	  *s += ret;
+	  if (*remaining_size <= 0)
+	    {
+	      return;
+	    }
+	}
+    }
+}
+
 /*
  * perfmon_stat_dump_in_buffer_snapshot_array_stat () -
  *
@@ -3337,6 +3469,16 @@ f_load_Num_dwb_flushed_block_volumes (void)
   return PERF_DWB_FLUSHED_BLOCK_VOLUMES_CNT;
 }
 
+/*
+ * f_load_time_histogram () - Get the number of values of a latency histogram statistic
+ *
+ */
+static int
+f_load_time_histogram (void)
+{
+  return PERF_TIME_HISTOGRAM_BUCKETS;
+}
+
 /*
  * f_load_Time_get_snapshot_acquire_time () - Get the number of values for Time_get_snapshot_acquire_time statistic
  *
@@ -3525,6 +3667,18 @@ f_dump_in_file_Num_dwb_flushed_block_volumes (FILE * f, const UINT64 * stat_vals
     }
 }
 
+/*
+ * f_dump_in_file_time_histogram () - Write in file the buckets of a latency histogram statistic
+ * f (out): File handle
+ * stat_vals (in): statistics buffer
+ *
+ */
+static void
+f_dump_in_file_time_histogram (FILE * f, const UINT64 * stat_vals)
+{
+  perfmon_stat_dump_in_file_time_histogram_array_stat (f, stat_vals);
+}
+
 /*
  * f_dump_in_buffer_Num_data_page_fix_ext () - Write to a buffer the values for Num_data_page_fix_ext
  *					       statistic
@@ -3677,6 +3831,19 @@ f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_va
     }
 }
 
+/*
+ * f_dump_in_buffer_time_histogram () - Write to a buffer the buckets of a latency histogram statistic
+ * s (out): Buffer to write to
+ * stat_vals (in): statistics buffer
+ * remaining_size (in): size of input buffer
+ *
+ */
+static void
+f_dump_in_buffer_time_histogram (char **s, const UINT64 * stat_vals, int *remaining_size)
+{
+  perfmon_stat_dump_in_buffer_time_histogram_array_stat (stat_vals, s, remaining_size);
+}
+
 /*
  * perfmon_get_number_of_statistic_values () - Get the number of entries in the statistic array
  *
@@ -3805,6 +3972,7 @@ perfmon_get_peek_stats (UINT64 * stats)
   stats[pstat_Metadata[PSTAT_PC_NUM_CACHE_ENTRIES].start_offset] = xcache_get_entry_count ();
   stats[pstat_Metadata[PSTAT_HF_NUM_STATS_ENTRIES].start_offset] = heap_get_best_space_num_stats_entries ();
   stats[pstat_Metadata[PSTAT_QM_NUM_HOLDABLE_CURSORS].start_offset] = session_get_number_of_holdable_cursors ();
+  stats[pstat_Metadata[PSTAT_QM_NUM_HEAVY_QUERIES_WAITING].start_offset] = qmgr_get_num_heavy_queries_waiting ();
 #endif /* defined (SERVER_MODE) || defined (SA_MODE) */
 }
 
@@ -132,6 +132,10 @@ typedef enum
 #define PERF_OBJ_LOCK_STAT_COUNTERS (SCH_M_LOCK + 1)
 #define PERF_DWB_FLUSHED_BLOCK_VOLUMES_CNT 10
 
+/* number of log-linear buckets of the latency histogram statistics. bucket i counts durations in
+ * [2^i, 2^(i+1)) microseconds; the last bucket collects everything longer (about 8.4 seconds and up). */
+#define PERF_TIME_HISTOGRAM_BUCKETS 24
+
 #define SAFE_DIV(a, b) ((b) == 0 ? 0 : (a) / (b))
 
 /* Count & timer values. */
@@ -368,6 +372,7 @@ typedef enum
   PSTAT_QM_NUM_MJOINS,
   PSTAT_QM_NUM_OBJFETCHES,
   PSTAT_QM_NUM_HOLDABLE_CURSORS,
+  PSTAT_QM_NUM_HEAVY_QUERIES_WAITING,
 
   /* Execution statistics for external sort */
   PSTAT_SORT_NUM_IO_PAGES,
@@ -556,6 +561,9 @@ typedef enum
   /* hash anchor */
   PSTAT_PB_NUM_HASH_ANCHOR_WAITS,
   PSTAT_PB_TIME_HASH_ANCHOR_WAIT,
+  /* latch waits by priority class */
+  PSTAT_PB_TIME_LATCH_WAIT_TRAN,
+  PSTAT_PB_TIME_LATCH_WAIT_UTILITY,
   /* flushing */
   PSTAT_PB_FLUSH_COLLECT,
   PSTAT_PB_FLUSH_FLUSH,
@@ -649,6 +657,12 @@ typedef enum
   PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES,
   PSTAT_LOAD_THREAD_STATS,
 
+  /* latency histograms */
+  PSTAT_LOG_FLUSH_TIME_HISTOGRAM,
+  PSTAT_PB_FIX_TIME_HISTOGRAM,
+  PSTAT_OBJ_LOCK_WAIT_TIME_HISTOGRAM,
+  PSTAT_QUERY_EXECUTE_TIME_HISTOGRAM,
+
   PSTAT_COUNT
 } PERF_STAT_ID;
 
@@ -1476,6 +1490,7 @@ extern void perfmon_pbx_fix_acquire_time (THREAD_ENTRY * thread_p, int page_type
 					  int cond_type, UINT64 amount);
 extern void perfmon_mvcc_snapshot (THREAD_ENTRY * thread_p, int snapshot, int rec_type, int visibility);
 extern void perfmon_db_flushed_block_volumes (THREAD_ENTRY * thread_p, int num_volumes);
+extern void perfmon_time_histogram (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, UINT64 duration_usec);
 
 #endif /* SERVER_MODE || SA_MODE */
 
@@ -702,6 +702,76 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_THREAD_CORE_COUNT "thread_core_count"
 
+#define PRM_NAME_PB_NUMA_AWARE "data_buffer_numa_aware"
+
+#define PRM_NAME_IO_URING_ENABLE "io_uring_enable"
+
+#define PRM_NAME_PB_CLOCK_VICTIM "data_buffer_clock_victim"
+
+#define PRM_NAME_PB_WARM_START "data_buffer_warm_start"
+
+#define PRM_NAME_PB_HUGEPAGES "data_buffer_hugepages"
+
+#define PRM_NAME_PB_ACTIVE_PAGES "data_buffer_active_pages"
+
+#define PRM_NAME_PB_COMPRESSED_PAGES "data_buffer_compressed_pages"
+
+#define PRM_NAME_PB_ADAPTIVE_FLUSH "data_buffer_adaptive_flush"
+
+#define PRM_NAME_SORT_PARALLEL_ENABLE "sort_parallel_enable"
+
+#define PRM_NAME_HEAP_ONLINE_COMPACTION "heap_online_compaction"
+
+#define PRM_NAME_HEAP_ONLINE_COMPACTION_PAGES "heap_online_compaction_pages_per_cycle"
+
+#define PRM_NAME_DATA_PAGE_CHECKSUM "data_page_checksum"
+
+#define PRM_NAME_SYNCHRONIZED_HEAP_SCAN "synchronized_heap_scan"
+
+#define PRM_NAME_TEMP_MEM_BUFFER_EXTENSION_PAGES "temp_file_memory_extension_in_pages"
+
+#define PRM_NAME_MAX_HASH_DISTINCT_SIZE "max_hash_distinct_size"
+
+#define PRM_NAME_STATS_SAMPLING_PAGES "stats_sampling_pages"
+
+#define PRM_NAME_STATS_AUTO_UPDATE_INTERVAL "stats_auto_update_interval_in_secs"
+
+#define PRM_NAME_OPTIMIZER_TIME_BUDGET "optimizer_time_budget_in_msecs"
+
+#define PRM_NAME_OPTIMIZER_CPU_WEIGHT "optimizer_cpu_weight"
+
+#define PRM_NAME_ADAPTIVE_GROUP_COMMIT "adaptive_group_commit"
+
+#define PRM_NAME_RELAXED_COMMIT_DURABILITY "relaxed_commit_durability"
+
+#define PRM_NAME_RECOVERY_PREFETCH_THREAD_COUNT "recovery_prefetch_thread_count"
+
+#define PRM_NAME_LOG_ZSTD_COMPRESS_LEVEL "log_zstd_compress_level"
+
+#define PRM_NAME_LOG_ZSTD_DICTIONARY_FILE "log_zstd_dictionary_file"
+
+#define PRM_NAME_LOG_CHECKPOINT_TRICKLE_FLUSH "checkpoint_trickle_flush"
+
+#define PRM_NAME_DWB_ATOMIC_WRITE_BYPASS "double_write_buffer_atomic_write_bypass"
+
+#define PRM_NAME_THREAD_WORKER_ADAPTIVE_SIZING "thread_worker_adaptive_sizing"
+
+#define PRM_NAME_THREAD_WORKER_NUMA_AFFINITY "thread_worker_numa_affinity"
+
+#define PRM_NAME_CONNECTION_EVENT_LOOP "connection_event_loop"
+
+#define PRM_NAME_NET_RESULT_COMPRESSION "net_result_compression"
+
+#define PRM_NAME_HEAVY_QUERY_MAX_CONCURRENCY "heavy_query_max_concurrency"
+
+#define PRM_NAME_HEAVY_QUERY_PAGE_THRESHOLD "heavy_query_page_threshold"
+
+#define PRM_NAME_SAMPLING_PROFILER_INTERVAL_IN_MSECS "sampling_profiler_interval_in_msecs"
+
+#define PRM_NAME_DBLINK_FETCH_SIZE "dblink_fetch_size"
+
+#define PRM_NAME_USE_CLASS_CACHE_GENERATION "use_class_cache_generation"
+
 #define PRM_VALUE_DEFAULT "DEFAULT"
 #define PRM_VALUE_MAX "MAX"
 #define PRM_VALUE_MIN "MIN"
@@ -2390,6 +2460,208 @@ static int prm_thread_core_count_upper = 1024;
 int PRM_THREAD_CORE_COUNT = prm_thread_core_count_default;	// this value will be tuned
 static unsigned int prm_thread_core_count_flag = 0;
 
+bool PRM_PB_NUMA_AWARE = false;
+static bool prm_pb_numa_aware_default = false;
+static unsigned int prm_pb_numa_aware_flag = 0;
+
+bool PRM_IO_URING_ENABLE = false;
+static bool prm_io_uring_enable_default = false;
+static unsigned int prm_io_uring_enable_flag = 0;
+
+bool PRM_PB_CLOCK_VICTIM = false;
+static bool prm_pb_clock_victim_default = false;
+static unsigned int prm_pb_clock_victim_flag = 0;
+
+bool PRM_PB_WARM_START = false;
+static bool prm_pb_warm_start_default = false;
+static unsigned int prm_pb_warm_start_flag = 0;
+
+bool PRM_PB_HUGEPAGES = false;
+static bool prm_pb_hugepages_default = false;
+static unsigned int prm_pb_hugepages_flag = 0;
+
+/* 0 means that the whole configured pool is usable */
+int PRM_PB_ACTIVE_PAGES = 0;
+static int prm_pb_active_pages_default = 0;
+static int prm_pb_active_pages_lower = 0;
+static unsigned int prm_pb_active_pages_flag = 0;
+
+/* 0 disables the compressed cold page tier */
+int PRM_PB_COMPRESSED_PAGES = 0;
+static int prm_pb_compressed_pages_default = 0;
+static int prm_pb_compressed_pages_lower = 0;
+static unsigned int prm_pb_compressed_pages_flag = 0;
+
+bool PRM_PB_ADAPTIVE_FLUSH = false;
+static bool prm_pb_adaptive_flush_default = false;
+static unsigned int prm_pb_adaptive_flush_flag = 0;
+
+bool PRM_SORT_PARALLEL_ENABLE = false;
+static bool prm_sort_parallel_enable_default = false;
+static unsigned int prm_sort_parallel_enable_flag = 0;
+
+bool PRM_HEAP_ONLINE_COMPACTION = false;
+static bool prm_heap_online_compaction_default = false;
+static unsigned int prm_heap_online_compaction_flag = 0;
+
+/* pages examined per daemon wakeup; the knob that throttles compaction I/O */
+int PRM_HEAP_ONLINE_COMPACTION_PAGES = 32;
+static int prm_heap_online_compaction_pages_default = 32;
+static int prm_heap_online_compaction_pages_lower = 1;
+static unsigned int prm_heap_online_compaction_pages_flag = 0;
+
+bool PRM_DATA_PAGE_CHECKSUM = true;
+static bool prm_data_page_checksum_default = true;
+static unsigned int prm_data_page_checksum_flag = 0;
+
+bool PRM_SYNCHRONIZED_HEAP_SCAN = false;
+static bool prm_synchronized_heap_scan_default = false;
+static unsigned int prm_synchronized_heap_scan_flag = 0;
+
+/* in-memory growth allowed for a temporary file before it spills to a temp volume */
+int PRM_TEMP_MEM_BUFFER_EXTENSION_PAGES = 0;
+static int prm_temp_mem_buffer_extension_pages_default = 0;
+static int prm_temp_mem_buffer_extension_pages_lower = 0;
+static int prm_temp_mem_buffer_extension_pages_upper = 4096;
+static unsigned int prm_temp_mem_buffer_extension_pages_flag = 0;
+
+/* memory allowed for the hash table that eliminates DISTINCT duplicates; 0 disables hash-based elimination */
+UINT64 PRM_MAX_HASH_DISTINCT_SIZE = 2 * 1024 * 1024;	/* 2 MB */
+static UINT64 prm_max_hash_distinct_size_default = 2 * 1024 * 1024;	/* 2 MB */
+static UINT64 prm_max_hash_distinct_size_lower = 0;
+static UINT64 prm_max_hash_distinct_size_upper = 128 * 1024 * 1024;	/* 128 MB */
+static unsigned int prm_max_hash_distinct_size_flag = 0;
+
+/* number of leaf pages sampled per index when statistics are updated without WITH FULLSCAN */
+int PRM_STATS_SAMPLING_PAGES = 8;
+static int prm_stats_sampling_pages_default = 8;
+static int prm_stats_sampling_pages_lower = 1;
+static int prm_stats_sampling_pages_upper = 4096;
+static unsigned int prm_stats_sampling_pages_flag = 0;
+
+/* period of the background statistics refresh daemon; 0 disables it */
+int PRM_STATS_AUTO_UPDATE_INTERVAL = 0;
+static int prm_stats_auto_update_interval_default = 0;
+static int prm_stats_auto_update_interval_lower = 0;
+static int prm_stats_auto_update_interval_upper = INT_MAX;
+static unsigned int prm_stats_auto_update_interval_flag = 0;
+
+/* upper bound on the time the query optimizer may spend searching join orders; 0 means unlimited */
+int PRM_OPTIMIZER_TIME_BUDGET = 0;
+static int prm_optimizer_time_budget_default = 0;
+static int prm_optimizer_time_budget_lower = 0;
+static int prm_optimizer_time_budget_upper = INT_MAX;
+static unsigned int prm_optimizer_time_budget_flag = 0;
+
+/* ratio of the cost of one qualification comparison to the cost of one data page read; see the calibratedb utility */
+float PRM_OPTIMIZER_CPU_WEIGHT = 0.0025f;
+static float prm_optimizer_cpu_weight_default = 0.0025f;
+static float prm_optimizer_cpu_weight_lower = 0.0f;
+static float prm_optimizer_cpu_weight_upper = 1.0f;
+static unsigned int prm_optimizer_cpu_weight_flag = 0;
+
+/* when enabled, the log flush daemon tunes the group commit window from measured flush latency and commit arrival */
+bool PRM_ADAPTIVE_GROUP_COMMIT = false;
+static bool prm_adaptive_group_commit_default = false;
+static unsigned int prm_adaptive_group_commit_flag = 0;
+
+/* per-session hint: commit may return before its log records reach disk, like async_commit but per transaction */
+bool PRM_RELAXED_COMMIT_DURABILITY = false;
+static bool prm_relaxed_commit_durability_default = false;
+static unsigned int prm_relaxed_commit_durability_flag = 0;
+
+/* number of workers reading data pages ahead of the redo scan during crash recovery; 0 keeps recovery single-threaded */
+int PRM_RECOVERY_PREFETCH_THREAD_COUNT = 0;
+static int prm_recovery_prefetch_thread_count_default = 0;
+static int prm_recovery_prefetch_thread_count_lower = 0;
+static int prm_recovery_prefetch_thread_count_upper = 64;
+static unsigned int prm_recovery_prefetch_thread_count_flag = 0;
+
+/* zstd level for log record compression; 0 keeps the lz4 codec. Decompression always auto-detects the codec */
+int PRM_LOG_ZSTD_COMPRESS_LEVEL = 0;
+static int prm_log_zstd_compress_level_default = 0;
+static int prm_log_zstd_compress_level_lower = 0;
+static int prm_log_zstd_compress_level_upper = 19;
+static unsigned int prm_log_zstd_compress_level_flag = 0;
+
+/* raw-content dictionary shared by the zstd log codec; both ends of log shipping must point at the same file */
+const char *PRM_LOG_ZSTD_DICTIONARY_FILE = NULL;
+static const char *prm_log_zstd_dictionary_file_default = NULL;
+static unsigned int prm_log_zstd_dictionary_file_flag = 0;
+
+/* when enabled, the checkpoint daemon continuously flushes the oldest dirty pages between checkpoints so the
+ * checkpoint itself finds little left to flush */
+bool PRM_LOG_CHECKPOINT_TRICKLE_FLUSH = false;
+static bool prm_log_checkpoint_trickle_flush_default = false;
+static unsigned int prm_log_checkpoint_trickle_flush_flag = 0;
+
+/* attestation that the storage stack writes database pages atomically; skips double write buffer staging and relies
+ * on data_page_checksum to detect torn pages should the attestation be wrong */
+bool PRM_DWB_ATOMIC_WRITE_BYPASS = false;
+static bool prm_dwb_atomic_write_bypass_default = false;
+static unsigned int prm_dwb_atomic_write_bypass_flag = 0;
+
+/* when enabled, the server samples the transaction worker pool queueing statistics and adjusts the number of workers
+ * allowed to run concurrently between the core count and thread_worker_count */
+bool PRM_THREAD_WORKER_ADAPTIVE_SIZING = false;
+static bool prm_thread_worker_adaptive_sizing_default = false;
+static unsigned int prm_thread_worker_adaptive_sizing_flag = 0;
+
+/* when enabled (and the host exposes more than one NUMA node), transaction worker pool cores are split between the
+ * nodes, worker threads are bound to the node owning their core and a connection's requests are always dispatched to
+ * cores of its home node; pairs with data_buffer_numa_aware, which partitions the page buffer by node */
+bool PRM_THREAD_WORKER_NUMA_AFFINITY = false;
+static bool prm_thread_worker_numa_affinity_default = false;
+static unsigned int prm_thread_worker_numa_affinity_flag = 0;
+
+/* when enabled (linux only), client sockets are serviced by a small set of epoll event loop daemons instead of one
+ * dedicated polling thread per connection; see css_conn_event_start in server_support.c */
+bool PRM_CONNECTION_EVENT_LOOP = false;
+static bool prm_connection_event_loop_default = false;
+static unsigned int prm_connection_event_loop_flag = 0;
+
+/* when enabled on both sides of a connection, query result pages are LZ4-compressed before they are sent to the
+ * client; negotiated through the handshake capability bits, meant for bandwidth-bound (WAN) clients */
+bool PRM_NET_RESULT_COMPRESSION = false;
+static bool prm_net_result_compression_default = false;
+static unsigned int prm_net_result_compression_flag = 0;
+
+/* admission control: at most this many queries classified as heavy run concurrently, the rest queue in FIFO order;
+ * 0 turns the controller off */
+int PRM_HEAVY_QUERY_MAX_CONCURRENCY = 0;
+static int prm_heavy_query_max_concurrency_default = 0;
+static int prm_heavy_query_max_concurrency_lower = 0;
+static int prm_heavy_query_max_concurrency_upper = INT_MAX;
+static unsigned int prm_heavy_query_max_concurrency_flag = 0;
+
+/* a query is classified as heavy when the planner's page estimate for its referenced classes reaches this count */
+int PRM_HEAVY_QUERY_PAGE_THRESHOLD = 65536;
+static int prm_heavy_query_page_threshold_default = 65536;
+static int prm_heavy_query_page_threshold_lower = 1;
+static int prm_heavy_query_page_threshold_upper = INT_MAX;
+static unsigned int prm_heavy_query_page_threshold_flag = 0;
+
+/* sampling interval of the built-in thread profiler daemon; 0 disables sampling */
+int PRM_SAMPLING_PROFILER_INTERVAL_IN_MSECS = 0;
+static int prm_sampling_profiler_interval_in_msecs_default = 0;
+static int prm_sampling_profiler_interval_in_msecs_lower = 0;
+static int prm_sampling_profiler_interval_in_msecs_upper = INT_MAX;
+static unsigned int prm_sampling_profiler_interval_in_msecs_flag = 0;
+
+/* number of remote rows a dblink scan pulls per network round trip */
+int PRM_DBLINK_FETCH_SIZE = 4096;
+static int prm_dblink_fetch_size_default = 4096;
+static int prm_dblink_fetch_size_lower = 1;
+static int prm_dblink_fetch_size_upper = INT_MAX;
+static unsigned int prm_dblink_fetch_size_flag = 0;
+
+/* when enabled, clients keep trusting cached class objects while the server schema generation counter is unchanged,
+ * skipping the read-lock locator round trip; concurrent DDL is then detected at the next generation check instead of
+ * being blocked by the shared lock */
+bool PRM_USE_CLASS_CACHE_GENERATION = false;
+static bool prm_use_class_cache_generation_default = false;
+static unsigned int prm_use_class_cache_generation_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -6154,6 +6426,403 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_NUMA_AWARE,
+   PRM_NAME_PB_NUMA_AWARE,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_numa_aware_flag,
+   (void *) &prm_pb_numa_aware_default,
+   (void *) &PRM_PB_NUMA_AWARE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_IO_URING_ENABLE,
+   PRM_NAME_IO_URING_ENABLE,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_io_uring_enable_flag,
+   (void *) &prm_io_uring_enable_default,
+   (void *) &PRM_IO_URING_ENABLE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_CLOCK_VICTIM,
+   PRM_NAME_PB_CLOCK_VICTIM,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_clock_victim_flag,
+   (void *) &prm_pb_clock_victim_default,
+   (void *) &PRM_PB_CLOCK_VICTIM,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_WARM_START,
+   PRM_NAME_PB_WARM_START,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_warm_start_flag,
+   (void *) &prm_pb_warm_start_default,
+   (void *) &PRM_PB_WARM_START,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_HUGEPAGES,
+   PRM_NAME_PB_HUGEPAGES,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_hugepages_flag,
+   (void *) &prm_pb_hugepages_default,
+   (void *) &PRM_PB_HUGEPAGES,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_ACTIVE_PAGES,
+   PRM_NAME_PB_ACTIVE_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_pb_active_pages_flag,
+   (void *) &prm_pb_active_pages_default,
+   (void *) &PRM_PB_ACTIVE_PAGES,
+   (void *) NULL, (void *) &prm_pb_active_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_COMPRESSED_PAGES,
+   PRM_NAME_PB_COMPRESSED_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_compressed_pages_flag,
+   (void *) &prm_pb_compressed_pages_default,
+   (void *) &PRM_PB_COMPRESSED_PAGES,
+   (void *) NULL, (void *) &prm_pb_compressed_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_ADAPTIVE_FLUSH,
+   PRM_NAME_PB_ADAPTIVE_FLUSH,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_adaptive_flush_flag,
+   (void *) &prm_pb_adaptive_flush_default,
+   (void *) &PRM_PB_ADAPTIVE_FLUSH,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SORT_PARALLEL_ENABLE,
+   PRM_NAME_SORT_PARALLEL_ENABLE,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_sort_parallel_enable_flag,
+   (void *) &prm_sort_parallel_enable_default,
+   (void *) &PRM_SORT_PARALLEL_ENABLE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAP_ONLINE_COMPACTION,
+   PRM_NAME_HEAP_ONLINE_COMPACTION,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_heap_online_compaction_flag,
+   (void *) &prm_heap_online_compaction_default,
+   (void *) &PRM_HEAP_ONLINE_COMPACTION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAP_ONLINE_COMPACTION_PAGES,
+   PRM_NAME_HEAP_ONLINE_COMPACTION_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_heap_online_compaction_pages_flag,
+   (void *) &prm_heap_online_compaction_pages_default,
+   (void *) &PRM_HEAP_ONLINE_COMPACTION_PAGES,
+   (void *) NULL, (void *) &prm_heap_online_compaction_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DATA_PAGE_CHECKSUM,
+   PRM_NAME_DATA_PAGE_CHECKSUM,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_data_page_checksum_flag,
+   (void *) &prm_data_page_checksum_default,
+   (void *) &PRM_DATA_PAGE_CHECKSUM,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SYNCHRONIZED_HEAP_SCAN,
+   PRM_NAME_SYNCHRONIZED_HEAP_SCAN,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_synchronized_heap_scan_flag,
+   (void *) &prm_synchronized_heap_scan_default,
+   (void *) &PRM_SYNCHRONIZED_HEAP_SCAN,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TEMP_MEM_BUFFER_EXTENSION_PAGES,
+   PRM_NAME_TEMP_MEM_BUFFER_EXTENSION_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_temp_mem_buffer_extension_pages_flag,
+   (void *) &prm_temp_mem_buffer_extension_pages_default,
+   (void *) &PRM_TEMP_MEM_BUFFER_EXTENSION_PAGES,
+   (void *) &prm_temp_mem_buffer_extension_pages_upper,
+   (void *) &prm_temp_mem_buffer_extension_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_HASH_DISTINCT_SIZE,
+   PRM_NAME_MAX_HASH_DISTINCT_SIZE,
+   (PRM_FOR_SERVER | PRM_TEST_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_max_hash_distinct_size_flag,
+   (void *) &prm_max_hash_distinct_size_default,
+   (void *) &PRM_MAX_HASH_DISTINCT_SIZE,
+   (void *) &prm_max_hash_distinct_size_upper,
+   (void *) &prm_max_hash_distinct_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATS_SAMPLING_PAGES,
+   PRM_NAME_STATS_SAMPLING_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_stats_sampling_pages_flag,
+   (void *) &prm_stats_sampling_pages_default,
+   (void *) &PRM_STATS_SAMPLING_PAGES,
+   (void *) &prm_stats_sampling_pages_upper,
+   (void *) &prm_stats_sampling_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATS_AUTO_UPDATE_INTERVAL,
+   PRM_NAME_STATS_AUTO_UPDATE_INTERVAL,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_stats_auto_update_interval_flag,
+   (void *) &prm_stats_auto_update_interval_default,
+   (void *) &PRM_STATS_AUTO_UPDATE_INTERVAL,
+   (void *) &prm_stats_auto_update_interval_upper,
+   (void *) &prm_stats_auto_update_interval_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_TIME_BUDGET,
+   PRM_NAME_OPTIMIZER_TIME_BUDGET,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE | PRM_FOR_SESSION),
+   PRM_INTEGER,
+   &prm_optimizer_time_budget_flag,
+   (void *) &prm_optimizer_time_budget_default,
+   (void *) &PRM_OPTIMIZER_TIME_BUDGET,
+   (void *) &prm_optimizer_time_budget_upper,
+   (void *) &prm_optimizer_time_budget_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_CPU_WEIGHT,
+   PRM_NAME_OPTIMIZER_CPU_WEIGHT,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE | PRM_FOR_SESSION),
+   PRM_FLOAT,
+   &prm_optimizer_cpu_weight_flag,
+   (void *) &prm_optimizer_cpu_weight_default,
+   (void *) &PRM_OPTIMIZER_CPU_WEIGHT,
+   (void *) &prm_optimizer_cpu_weight_upper,
+   (void *) &prm_optimizer_cpu_weight_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_ADAPTIVE_GROUP_COMMIT,
+   PRM_NAME_ADAPTIVE_GROUP_COMMIT,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_adaptive_group_commit_flag,
+   (void *) &prm_adaptive_group_commit_default,
+   (void *) &PRM_ADAPTIVE_GROUP_COMMIT,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RELAXED_COMMIT_DURABILITY,
+   PRM_NAME_RELAXED_COMMIT_DURABILITY,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_FOR_SESSION),
+   PRM_BOOLEAN,
+   &prm_relaxed_commit_durability_flag,
+   (void *) &prm_relaxed_commit_durability_default,
+   (void *) &PRM_RELAXED_COMMIT_DURABILITY,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RECOVERY_PREFETCH_THREAD_COUNT,
+   PRM_NAME_RECOVERY_PREFETCH_THREAD_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_recovery_prefetch_thread_count_flag,
+   (void *) &prm_recovery_prefetch_thread_count_default,
+   (void *) &PRM_RECOVERY_PREFETCH_THREAD_COUNT,
+   (void *) &prm_recovery_prefetch_thread_count_upper,
+   (void *) &prm_recovery_prefetch_thread_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_ZSTD_COMPRESS_LEVEL,
+   PRM_NAME_LOG_ZSTD_COMPRESS_LEVEL,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_log_zstd_compress_level_flag,
+   (void *) &prm_log_zstd_compress_level_default,
+   (void *) &PRM_LOG_ZSTD_COMPRESS_LEVEL,
+   (void *) &prm_log_zstd_compress_level_upper,
+   (void *) &prm_log_zstd_compress_level_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_ZSTD_DICTIONARY_FILE,
+   PRM_NAME_LOG_ZSTD_DICTIONARY_FILE,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER),
+   PRM_STRING,
+   &prm_log_zstd_dictionary_file_flag,
+   (void *) &prm_log_zstd_dictionary_file_default,
+   (void *) &PRM_LOG_ZSTD_DICTIONARY_FILE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_CHECKPOINT_TRICKLE_FLUSH,
+   PRM_NAME_LOG_CHECKPOINT_TRICKLE_FLUSH,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_log_checkpoint_trickle_flush_flag,
+   (void *) &prm_log_checkpoint_trickle_flush_default,
+   (void *) &PRM_LOG_CHECKPOINT_TRICKLE_FLUSH,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DWB_ATOMIC_WRITE_BYPASS,
+   PRM_NAME_DWB_ATOMIC_WRITE_BYPASS,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_dwb_atomic_write_bypass_flag,
+   (void *) &prm_dwb_atomic_write_bypass_default,
+   (void *) &PRM_DWB_ATOMIC_WRITE_BYPASS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_WORKER_ADAPTIVE_SIZING,
+   PRM_NAME_THREAD_WORKER_ADAPTIVE_SIZING,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_thread_worker_adaptive_sizing_flag,
+   (void *) &prm_thread_worker_adaptive_sizing_default,
+   (void *) &PRM_THREAD_WORKER_ADAPTIVE_SIZING,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_WORKER_NUMA_AFFINITY,
+   PRM_NAME_THREAD_WORKER_NUMA_AFFINITY,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_thread_worker_numa_affinity_flag,
+   (void *) &prm_thread_worker_numa_affinity_default,
+   (void *) &PRM_THREAD_WORKER_NUMA_AFFINITY,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_CONNECTION_EVENT_LOOP,
+   PRM_NAME_CONNECTION_EVENT_LOOP,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_connection_event_loop_flag,
+   (void *) &prm_connection_event_loop_default,
+   (void *) &PRM_CONNECTION_EVENT_LOOP,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_NET_RESULT_COMPRESSION,
+   PRM_NAME_NET_RESULT_COMPRESSION,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_net_result_compression_flag,
+   (void *) &prm_net_result_compression_default,
+   (void *) &PRM_NET_RESULT_COMPRESSION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAVY_QUERY_MAX_CONCURRENCY,
+   PRM_NAME_HEAVY_QUERY_MAX_CONCURRENCY,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_heavy_query_max_concurrency_flag,
+   (void *) &prm_heavy_query_max_concurrency_default,
+   (void *) &PRM_HEAVY_QUERY_MAX_CONCURRENCY,
+   (void *) &prm_heavy_query_max_concurrency_upper,
+   (void *) &prm_heavy_query_max_concurrency_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAVY_QUERY_PAGE_THRESHOLD,
+   PRM_NAME_HEAVY_QUERY_PAGE_THRESHOLD,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_heavy_query_page_threshold_flag,
+   (void *) &prm_heavy_query_page_threshold_default,
+   (void *) &PRM_HEAVY_QUERY_PAGE_THRESHOLD,
+   (void *) &prm_heavy_query_page_threshold_upper,
+   (void *) &prm_heavy_query_page_threshold_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SAMPLING_PROFILER_INTERVAL_IN_MSECS,
+   PRM_NAME_SAMPLING_PROFILER_INTERVAL_IN_MSECS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_sampling_profiler_interval_in_msecs_flag,
+   (void *) &prm_sampling_profiler_interval_in_msecs_default,
+   (void *) &PRM_SAMPLING_PROFILER_INTERVAL_IN_MSECS,
+   (void *) &prm_sampling_profiler_interval_in_msecs_upper,
+   (void *) &prm_sampling_profiler_interval_in_msecs_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DBLINK_FETCH_SIZE,
+   PRM_NAME_DBLINK_FETCH_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_dblink_fetch_size_flag,
+   (void *) &prm_dblink_fetch_size_default,
+   (void *) &PRM_DBLINK_FETCH_SIZE,
+   (void *) &prm_dblink_fetch_size_upper,
+   (void *) &prm_dblink_fetch_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_USE_CLASS_CACHE_GENERATION,
+   PRM_NAME_USE_CLASS_CACHE_GENERATION,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_use_class_cache_generation_flag,
+   (void *) &prm_use_class_cache_generation_default,
+   (void *) &PRM_USE_CLASS_CACHE_GENERATION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
 };
 
 #define NUM_PRM ((int)(sizeof(prm_Def)/sizeof(prm_Def[0])))
@@ -6452,6 +7121,11 @@ static const int call_stack_dump_error_codes[] = {
   ER_LOG_CHECKPOINT_SKIP_INVALID_PAGE
 };
 
+/* generation counter advanced on every parameter value change; per-thread hot
+ * parameter snapshots compare against it to detect staleness.  starts at 1 so
+ * a zero-initialized snapshot is always refreshed on first use. */
+static volatile INT64 prm_Value_generation = 1;
+
 typedef enum
 {
   PRM_PRINT_NONE = 0,
@@ -8016,6 +8690,10 @@ sysprm_change_parameter_values (const SYSPRM_ASSIGN_VALUE * assignments, bool ch
 	{
 	  css_set_accessible_ip_info ();
 	}
+      if (sysprm_get_id (prm) == PRM_ID_PB_ACTIVE_PAGES)
+	{
+	  (void) pgbuf_adjust_active_pages (NULL);
+	}
 #endif
     }
 }
@@ -11175,6 +11853,56 @@ prm_get_bigint_value (PARAM_ID prm_id)
   return PRM_GET_BIGINT (prm_get_value (prm_id));
 }
 
+/*
+ * sysprm_get_value_generation () - current parameter value generation
+ *
+ * return : generation counter, advanced on every parameter value change
+ */
+INT64
+sysprm_get_value_generation (void)
+{
+  return prm_Value_generation;
+}
+
+/*
+ * sysprm_get_hot_params () - get the calling thread's snapshot of hot
+ *			      parameters, refreshing it if any parameter
+ *			      changed since it was captured
+ *
+ * return : snapshot; valid until the thread exits, fields may be refreshed by
+ *	    the next call
+ *
+ * NOTE: the generation is sampled before the values, so a concurrent change
+ *	 can produce a mixed snapshot at most once; the next call observes the
+ *	 advanced generation and refreshes again.
+ */
+const SYSPRM_HOT_PARAMS *
+sysprm_get_hot_params (void)
+{
+  /* *INDENT-OFF* */
+  static thread_local SYSPRM_HOT_PARAMS tl_hot_params = { 0 };
+  /* *INDENT-ON* */
+  INT64 generation = prm_Value_generation;
+
+  if (tl_hot_params.generation != generation)
+    {
+      tl_hot_params.er_log_level = prm_get_integer_value (PRM_ID_ER_LOG_LEVEL);
+      tl_hot_params.er_log_warning = prm_get_bool_value (PRM_ID_ER_LOG_WARNING);
+      tl_hot_params.pb_debug_page_validation_level = prm_get_integer_value (PRM_ID_PB_DEBUG_PAGE_VALIDATION_LEVEL);
+      tl_hot_params.pb_sequential_victim_flush = prm_get_bool_value (PRM_ID_PB_SEQUENTIAL_VICTIM_FLUSH);
+      tl_hot_params.log_pgbuf_victim_flush = prm_get_bool_value (PRM_ID_LOG_PGBUF_VICTIM_FLUSH);
+      tl_hot_params.data_page_checksum = prm_get_bool_value (PRM_ID_DATA_PAGE_CHECKSUM);
+      tl_hot_params.oracle_style_empty_string = prm_get_bool_value (PRM_ID_ORACLE_STYLE_EMPTY_STRING);
+      tl_hot_params.log_async_commit = prm_get_bool_value (PRM_ID_LOG_ASYNC_COMMIT);
+      tl_hot_params.log_group_commit_interval_msecs = prm_get_integer_value (PRM_ID_LOG_GROUP_COMMIT_INTERVAL_MSECS);
+      tl_hot_params.max_hash_list_scan_size = prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE);
+
+      tl_hot_params.generation = generation;
+    }
+
+  return &tl_hot_params;
+}
+
 /*
  * prm_set_integer_value () - set a new value to a parameter of type integer
  *
@@ -11371,10 +12099,14 @@ sysprm_find_fi_code_in_integer_list (PARAM_ID prm_id, int fi_code)
  * NOTE: Should be called whenever a system parameter changes value.
  *	 This only affects parameters on client (there is no use for this flag
  *	 on server side) that are also flagged with PRM_FOR_QRY_STRING.
+ *	 Also advances the value generation counter that invalidates the
+ *	 per-thread hot parameter snapshots (see sysprm_get_hot_params).
  */
 static void
 sysprm_update_flag_different (SYSPRM_PARAM * prm)
 {
+  ATOMIC_INC_64 (&prm_Value_generation, 1);
+
 #if defined (CS_MODE)
   if (!PRM_IS_FOR_QRY_STRING (prm->static_flag) && !PRM_IS_FOR_HA_CONTEXT (prm->static_flag))
     {
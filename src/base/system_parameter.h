@@ -458,8 +458,43 @@ enum param_id
   PRM_ID_RECOVERY_PROGRESS_LOGGING_INTERVAL,
   PRM_ID_FIRST_LOG_PAGEID,	/* Except for QA or TEST purposes, never use it. */
   PRM_ID_THREAD_CORE_COUNT,
+  PRM_ID_PB_NUMA_AWARE,
+  PRM_ID_IO_URING_ENABLE,
+  PRM_ID_PB_CLOCK_VICTIM,
+  PRM_ID_PB_WARM_START,
+  PRM_ID_PB_HUGEPAGES,
+  PRM_ID_PB_ACTIVE_PAGES,
+  PRM_ID_PB_COMPRESSED_PAGES,
+  PRM_ID_PB_ADAPTIVE_FLUSH,
+  PRM_ID_SORT_PARALLEL_ENABLE,
+  PRM_ID_HEAP_ONLINE_COMPACTION,
+  PRM_ID_HEAP_ONLINE_COMPACTION_PAGES,
+  PRM_ID_DATA_PAGE_CHECKSUM,
+  PRM_ID_SYNCHRONIZED_HEAP_SCAN,
+  PRM_ID_TEMP_MEM_BUFFER_EXTENSION_PAGES,
+  PRM_ID_MAX_HASH_DISTINCT_SIZE,
+  PRM_ID_STATS_SAMPLING_PAGES,
+  PRM_ID_STATS_AUTO_UPDATE_INTERVAL,
+  PRM_ID_OPTIMIZER_TIME_BUDGET,
+  PRM_ID_OPTIMIZER_CPU_WEIGHT,
+  PRM_ID_ADAPTIVE_GROUP_COMMIT,
+  PRM_ID_RELAXED_COMMIT_DURABILITY,
+  PRM_ID_RECOVERY_PREFETCH_THREAD_COUNT,
+  PRM_ID_LOG_ZSTD_COMPRESS_LEVEL,
+  PRM_ID_LOG_ZSTD_DICTIONARY_FILE,
+  PRM_ID_LOG_CHECKPOINT_TRICKLE_FLUSH,
+  PRM_ID_DWB_ATOMIC_WRITE_BYPASS,
+  PRM_ID_THREAD_WORKER_ADAPTIVE_SIZING,
+  PRM_ID_THREAD_WORKER_NUMA_AFFINITY,
+  PRM_ID_CONNECTION_EVENT_LOOP,
+  PRM_ID_NET_RESULT_COMPRESSION,
+  PRM_ID_HEAVY_QUERY_MAX_CONCURRENCY,
+  PRM_ID_HEAVY_QUERY_PAGE_THRESHOLD,
+  PRM_ID_SAMPLING_PROFILER_INTERVAL_IN_MSECS,
+  PRM_ID_DBLINK_FETCH_SIZE,
+  PRM_ID_USE_CLASS_CACHE_GENERATION,
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_THREAD_CORE_COUNT
+  PRM_LAST_ID = PRM_ID_USE_CLASS_CACHE_GENERATION
 };
 typedef enum param_id PARAM_ID;
 
@@ -541,6 +576,33 @@ extern "C"
   extern int *prm_get_integer_list_value (PARAM_ID prm_id);
   extern UINT64 prm_get_bigint_value (PARAM_ID prm_id);
 
+/* SYSPRM_HOT_PARAMS - thread-cached snapshot of parameters read on hot paths.
+ *
+ * Each thread keeps its own copy and revalidates it against a global value
+ * generation counter, so a hot read is a field load plus one counter compare
+ * instead of a trip through prm_Def.  Only server-global parameters belong
+ * here; session-scoped parameters must keep going through prm_get_*_value.
+ */
+  typedef struct sysprm_hot_params SYSPRM_HOT_PARAMS;
+  struct sysprm_hot_params
+  {
+    INT64 generation;		/* value generation this snapshot was captured at */
+
+    int er_log_level;		/* PRM_ID_ER_LOG_LEVEL */
+    bool er_log_warning;	/* PRM_ID_ER_LOG_WARNING */
+    int pb_debug_page_validation_level;	/* PRM_ID_PB_DEBUG_PAGE_VALIDATION_LEVEL */
+    bool pb_sequential_victim_flush;	/* PRM_ID_PB_SEQUENTIAL_VICTIM_FLUSH */
+    bool log_pgbuf_victim_flush;	/* PRM_ID_LOG_PGBUF_VICTIM_FLUSH */
+    bool data_page_checksum;	/* PRM_ID_DATA_PAGE_CHECKSUM */
+    bool oracle_style_empty_string;	/* PRM_ID_ORACLE_STYLE_EMPTY_STRING */
+    bool log_async_commit;	/* PRM_ID_LOG_ASYNC_COMMIT */
+    int log_group_commit_interval_msecs;	/* PRM_ID_LOG_GROUP_COMMIT_INTERVAL_MSECS */
+    UINT64 max_hash_list_scan_size;	/* PRM_ID_MAX_HASH_LIST_SCAN_SIZE */
+  };
+
+  extern INT64 sysprm_get_value_generation (void);
+  extern const SYSPRM_HOT_PARAMS *sysprm_get_hot_params (void);
+
   extern void prm_set_integer_value (PARAM_ID prm_id, int value);
   extern void prm_set_float_value (PARAM_ID prm_id, float value);
   extern void prm_set_bool_value (PARAM_ID prm_id, bool value);
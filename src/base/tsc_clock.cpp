@@ -0,0 +1,59 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// tsc_clock.cpp - calibration of the time-stamp counter backed clock
+//
+
+#include "tsc_clock.hpp"
+
+#include "tsc_timer.h"
+
+namespace cubperf
+{
+  bool tsc_clock::Use_tsc = false;
+  double tsc_clock::Nsecs_per_tick = 0.0;
+  tsc_clock::rep tsc_clock::Nsecs_offset = 0;
+
+  //
+  // init - calibrate the counter; keep the fallback clock when the counter cannot be trusted.
+  //
+  // the epoch of the counter is aligned with the fallback clock epoch, so time points taken before calibration
+  // remain comparable with time points taken after.
+  //
+  void
+  tsc_clock::init (void)
+  {
+    TSC_UINT64 freq = get_clock_freq ();
+
+    if (!tsc_is_reliable () || freq == 0)
+      {
+	// stick to the fallback clock
+	return;
+      }
+
+    Nsecs_per_tick = 1000000000.0 / (double) freq;
+
+    rep fallback_nsecs =
+	    std::chrono::duration_cast<duration> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+    rep counter_nsecs = (rep) ((double) getticks () * Nsecs_per_tick);
+    Nsecs_offset = fallback_nsecs - counter_nsecs;
+
+    Use_tsc = true;
+  }
+} // namespace cubperf
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// tsc_clock.hpp - chrono-compatible clock backed by the CPU time-stamp counter
+//
+
+#if !defined _TSC_CLOCK_HPP_
+#define _TSC_CLOCK_HPP_
+
+#include "cycle.h"
+
+#include <chrono>
+
+#include <cstdint>
+
+namespace cubperf
+{
+  // tsc_clock - cheap nanosecond-scale clock for hot-path timing.
+  //
+  // now () reads the CPU time-stamp counter (a single instruction) instead of entering the kernel or vdso, which
+  // makes always-on timing statistics affordable. the counter is calibrated once at boot (see tsc_init); until
+  // calibration, or when the counter rate is not trusted (power saving policies may vary it; see tsc_timer.c
+  // check_power_savings), every call falls back to std::chrono::steady_clock.
+  //
+  // note: readings taken on different cores may step backwards by a few ticks; like tsc_timer, we consider the
+  // error negligible. do not use this clock where strict monotonicity is required.
+  class tsc_clock
+  {
+    public:
+      using duration = std::chrono::nanoseconds;
+      using rep = duration::rep;
+      using period = duration::period;
+      using time_point = std::chrono::time_point<tsc_clock, duration>;
+      static const bool is_steady = false;
+
+      static void init (void);		  // calibrate against the fallback clock; called by tsc_init ()
+      static inline time_point now (void) noexcept;
+
+    private:
+      static bool Use_tsc;		  // true when the raw counter is calibrated and trusted
+      static double Nsecs_per_tick;	  // calibrated tick length
+      static rep Nsecs_offset;		  // aligns the counter epoch with the fallback clock epoch
+  };
+
+  //////////////////////////////////////////////////////////////////////////
+  // inline implementation
+  //////////////////////////////////////////////////////////////////////////
+
+  tsc_clock::time_point
+  tsc_clock::now (void) noexcept
+  {
+    if (Use_tsc)
+      {
+	return time_point (duration ((rep) ((double) getticks () * Nsecs_per_tick) + Nsecs_offset));
+      }
+    return time_point (std::chrono::duration_cast<duration> (std::chrono::steady_clock::now ().time_since_epoch ()));
+  }
+} // namespace cubperf
+
+#endif // _TSC_CLOCK_HPP_
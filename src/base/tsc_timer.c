@@ -26,6 +26,7 @@
 
 #include <fcntl.h>
 #include "tsc_timer.h"
+#include "tsc_clock.hpp"
 #if !defined(WINDOWS)
 #include <sys/time.h>
 #endif
@@ -68,9 +69,23 @@ tsc_init (void)
 {
   check_power_savings ();
   cpu_Clock_rate = get_clock_freq ();
+  cubperf::tsc_clock::init ();
   return;
 }
 
+/*
+ * tsc_is_reliable() - true when the raw Time Stamp Counter can be trusted as a time source
+ */
+bool
+tsc_is_reliable (void)
+{
+  if (power_Savings == -1)
+    {
+      check_power_savings ();
+    }
+  return power_Savings == 0;
+}
+
 /*
  * tsc_getticks() - get the current Time Stamp Counter
  *   tck(out): current CPU ticks or timeval
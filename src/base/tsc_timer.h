@@ -49,6 +49,7 @@ union tsc_ticks
 /* todo: inline functions */
 
 extern void tsc_init (void);
+extern bool tsc_is_reliable (void);
 extern void tsc_getticks (TSC_TICKS * tck);
 extern void tsc_elapsed_time_usec (TSCTIMEVAL * tv, TSC_TICKS end_tick, TSC_TICKS start_tick);
 extern UINT64 tsc_elapsed_utime (TSC_TICKS end_tick, TSC_TICKS start_tick);
@@ -126,6 +126,32 @@ static TZ_DATA tz_New_timezone_data = { 0, NULL, 0, NULL, NULL, 0, NULL, 0, NULL
 static const int tz_Days_of_month[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
 static const int tz_Days_up_to_month[] = { 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365 };
 
+/*
+ * Per-thread cache of resolved timezone offset rules.  One entry summarizes
+ * the resolution of a whole civil day of one zone in one time reference:
+ * outside of the (at most yearly-two) transition days, every datetime of a
+ * day resolves to the same offset and daylight saving rule, so the per-tuple
+ * conversion collapses to a lookup plus plain date arithmetic.  Entries are
+ * only created after probing that the day is uniform and the whole cache is
+ * dropped when the loaded timezone data changes (checksum mismatch).
+ */
+typedef struct tz_offset_cache_entry TZ_OFFSET_CACHE_ENTRY;
+struct tz_offset_cache_entry
+{
+  unsigned int zone_id;		/* geographical zone id */
+  int julian_date;		/* civil day the entry covers */
+  bool src_is_utc;		/* time reference the resolution was made in */
+  bool valid;
+  int offset_id;		/* resolved GMT offset rule id */
+  int ds_id;			/* resolved daylight saving rule id; -1 if none applied */
+  int total_offset_sec;		/* GMT offset plus daylight saving, in seconds */
+};
+
+#define TZ_OFFSET_CACHE_SIZE 64
+
+static thread_local TZ_OFFSET_CACHE_ENTRY tz_Offset_cache[TZ_OFFSET_CACHE_SIZE] = { {0, 0, false, false, 0, 0, 0} };
+static thread_local char tz_Offset_cache_checksum[TZ_CHECKSUM_SIZE + 1] = { 0 };
+
 #if defined (SA_MODE)
 bool tz_Is_backward_compatible_timezone[ZONE_MAX];
 bool tz_Compare_datetimetz_tz_id = false;
@@ -150,6 +176,13 @@ static bool tz_check_ds_match_string (const TZ_OFFSET_RULE * off_rule, const TZ_
 				      const char *ds_string, const char *default_abrev);
 static int tz_datetime_utc_conv (const DB_DATETIME * src_dt, TZ_DECODE_INFO * tz_info, bool src_is_utc,
 				 bool only_tz_adjust, DB_DATETIME * dest_dt);
+static int tz_datetime_utc_conv_internal (const DB_DATETIME * src_dt, TZ_DECODE_INFO * tz_info, bool src_is_utc,
+					  bool only_tz_adjust, DB_DATETIME * dest_dt, int *offset_id_out,
+					  int *ds_id_out, int *total_offset_sec_out);
+static TZ_OFFSET_CACHE_ENTRY *tz_offset_cache_get_slot (unsigned int zone_id, int julian_date);
+static TZ_OFFSET_CACHE_ENTRY *tz_offset_cache_find (unsigned int zone_id, int julian_date, bool src_is_utc);
+static void tz_offset_cache_insert (const DB_DATETIME * src_dt, const TZ_DECODE_INFO * tz_info, bool src_is_utc,
+				    int offset_id, int ds_id, int total_offset_sec);
 static int tz_conv_tz_datetime_w_zone_info (const DB_DATETIME * src_dt, const TZ_DECODE_INFO * src_zone_info_in,
 					    const TZ_DECODE_INFO * dest_zone_info_in, DB_DATETIME * dest_dt,
 					    TZ_DECODE_INFO * src_zone_info_out, TZ_DECODE_INFO * dest_zone_info_out);
@@ -2798,7 +2831,7 @@ get_year_to_apply_rule (const int src_year, const TZ_DS_RULE * ds_rule)
 }
 
 /*
- * tz_datetime_utc_conv () -
+ * tz_datetime_utc_conv_internal () -
  *
  * Return: error code
  * src_dt(in): object containing source datetime value;
@@ -2809,11 +2842,15 @@ get_year_to_apply_rule (const int src_year, const TZ_DS_RULE * ds_rule)
  * only_tz_adjust(in): true if only timezone adjustment is desired, datetime itself is not changed (used in context of
  *		       datetime arithmetic)
  * dt_dest(out): object containing destination datetime
+ * offset_id_out(out): if not NULL, the resolved GMT offset rule id (-1 for offset regions)
+ * ds_id_out(out): if not NULL, the resolved daylight saving rule id (-1 if none applied)
+ * total_offset_sec_out(out): if not NULL, the total offset applied, in seconds
  *
  */
 static int
-tz_datetime_utc_conv (const DB_DATETIME * src_dt, TZ_DECODE_INFO * tz_info, bool src_is_utc, bool only_tz_adjust,
-		      DB_DATETIME * dest_dt)
+tz_datetime_utc_conv_internal (const DB_DATETIME * src_dt, TZ_DECODE_INFO * tz_info, bool src_is_utc,
+			       bool only_tz_adjust, DB_DATETIME * dest_dt, int *offset_id_out, int *ds_id_out,
+			       int *total_offset_sec_out)
 {
   int src_julian_date, rule_julian_date;
   int src_time_sec, rule_time_sec;
@@ -3692,6 +3729,19 @@ exit:
 	    }
 	}
 
+      if (offset_id_out != NULL)
+	{
+	  *offset_id_out = curr_offset_id;
+	}
+      if (ds_id_out != NULL)
+	{
+	  *ds_id_out = applying_ds_id;
+	}
+      if (total_offset_sec_out != NULL)
+	{
+	  *total_offset_sec_out = total_offset_sec;
+	}
+
       if (only_tz_adjust == true)
 	{
 	  *dest_dt = *src_dt;
@@ -3715,6 +3765,176 @@ exit:
   return err_status;
 }
 
+/*
+ * tz_offset_cache_get_slot () - get the cache slot associated with a (zone, civil day) pair
+ *
+ * Return: cache slot (never NULL)
+ * zone_id(in): geographical zone id
+ * julian_date(in): julian date of the civil day
+ */
+static TZ_OFFSET_CACHE_ENTRY *
+tz_offset_cache_get_slot (unsigned int zone_id, int julian_date)
+{
+  unsigned int hash = zone_id * 31 + (unsigned int) julian_date;
+
+  return &tz_Offset_cache[hash % TZ_OFFSET_CACHE_SIZE];
+}
+
+/*
+ * tz_offset_cache_find () - find the cached offset rule resolution of a (zone, civil day) pair
+ *
+ * Return: cache entry, or NULL on cache miss
+ * zone_id(in): geographical zone id
+ * julian_date(in): julian date of the civil day
+ * src_is_utc(in): time reference the resolution must have been made in
+ */
+static TZ_OFFSET_CACHE_ENTRY *
+tz_offset_cache_find (unsigned int zone_id, int julian_date, bool src_is_utc)
+{
+  const TZ_DATA *tzd = tz_get_data ();
+  TZ_OFFSET_CACHE_ENTRY *entry;
+
+  if (tzd == NULL)
+    {
+      return NULL;
+    }
+
+  if (strcmp (tz_Offset_cache_checksum, tzd->checksum) != 0)
+    {
+      /* the timezone data was (re)loaded; all cached resolutions are stale */
+      memset (tz_Offset_cache, 0, sizeof (tz_Offset_cache));
+      strcpy (tz_Offset_cache_checksum, tzd->checksum);
+      return NULL;
+    }
+
+  entry = tz_offset_cache_get_slot (zone_id, julian_date);
+  if (entry->valid && entry->zone_id == zone_id && entry->julian_date == julian_date
+      && entry->src_is_utc == src_is_utc)
+    {
+      return entry;
+    }
+
+  return NULL;
+}
+
+/*
+ * tz_offset_cache_insert () - cache the offset rule resolution of a (zone, civil day) pair
+ *
+ * Return: void
+ * src_dt(in): source datetime the resolution was made for
+ * tz_info(in): decoded timezone info of the resolution (zone type, no user DST specifier)
+ * src_is_utc(in): time reference the resolution was made in
+ * offset_id(in): resolved GMT offset rule id
+ * ds_id(in): resolved daylight saving rule id, -1 if none applied
+ * total_offset_sec(in): total offset applied, in seconds
+ *
+ * Note: an entry stands for the whole civil day, so the day is first probed at several times for an identical
+ *	 resolution; offset and daylight saving rules change at most once per civil day, therefore matching probes
+ *	 mean the day is uniform. Transition days simply stay uncached.
+ */
+static void
+tz_offset_cache_insert (const DB_DATETIME * src_dt, const TZ_DECODE_INFO * tz_info, bool src_is_utc, int offset_id,
+			int ds_id, int total_offset_sec)
+{
+  const unsigned int probe_times[] = { 0, 8 * 3600 * 1000, 16 * 3600 * 1000, MILLIS_IN_A_DAY - 1 };
+  TZ_OFFSET_CACHE_ENTRY *entry;
+  size_t i;
+
+  for (i = 0; i < sizeof (probe_times) / sizeof (probe_times[0]); i++)
+    {
+      DB_DATETIME probe_dt, probe_dest;
+      TZ_DECODE_INFO probe_info = *tz_info;
+      int probe_offset_id, probe_ds_id, probe_total_offset_sec;
+
+      if (probe_times[i] == src_dt->time)
+	{
+	  continue;
+	}
+
+      probe_dt.date = src_dt->date;
+      probe_dt.time = probe_times[i];
+
+      if (tz_datetime_utc_conv_internal (&probe_dt, &probe_info, src_is_utc, true, &probe_dest, &probe_offset_id,
+					 &probe_ds_id, &probe_total_offset_sec) != NO_ERROR)
+	{
+	  /* the probe fell into a daylight saving gap or overlap; the day is not uniform */
+	  er_clear ();
+	  return;
+	}
+
+      if (probe_offset_id != offset_id || probe_ds_id != ds_id || probe_total_offset_sec != total_offset_sec)
+	{
+	  return;
+	}
+    }
+
+  entry = tz_offset_cache_get_slot (tz_info->zone.zone_id, src_dt->date);
+  entry->zone_id = tz_info->zone.zone_id;
+  entry->julian_date = src_dt->date;
+  entry->src_is_utc = src_is_utc;
+  entry->offset_id = offset_id;
+  entry->ds_id = ds_id;
+  entry->total_offset_sec = total_offset_sec;
+  entry->valid = true;
+}
+
+/*
+ * tz_datetime_utc_conv () - tz_datetime_utc_conv_internal with a per-thread cache of resolved offset rules
+ *
+ * Return: error code
+ * src_dt(in): object containing source datetime value
+ * tz_info(in/out): (partial) decoded timezone info associated with source datetime
+ * src_is_utc(in): true if 'src_dt' is in UTC time reference, false if src_dt is in local time reference
+ * only_tz_adjust(in): true if only timezone adjustment is desired, datetime itself is not changed
+ * dt_dest(out): object containing destination datetime
+ *
+ * Note: a cache hit reduces the conversion to table lookup plus date arithmetic. Conversions that depend on more
+ *	 than the (zone, civil day, time reference) triple - offset regions, user DST specifiers, zero dates and
+ *	 out-of-range times - take the full resolution path unconditionally.
+ */
+static int
+tz_datetime_utc_conv (const DB_DATETIME * src_dt, TZ_DECODE_INFO * tz_info, bool src_is_utc, bool only_tz_adjust,
+		      DB_DATETIME * dest_dt)
+{
+  TZ_OFFSET_CACHE_ENTRY *entry;
+  int offset_id, ds_id, total_offset_sec;
+  int err_status;
+
+  if (tz_info->type != TZ_REGION_ZONE || tz_info->zone.dst_str[0] != '\0' || src_dt->date == 0
+      || src_dt->time > MILLIS_IN_A_DAY)
+    {
+      return tz_datetime_utc_conv_internal (src_dt, tz_info, src_is_utc, only_tz_adjust, dest_dt, NULL, NULL, NULL);
+    }
+
+  entry = tz_offset_cache_find (tz_info->zone.zone_id, src_dt->date, src_is_utc);
+  if (entry != NULL)
+    {
+      tz_info->zone.offset_id = entry->offset_id;
+      if (entry->ds_id >= 0)
+	{
+	  tz_info->zone.dst_id = entry->ds_id;
+	}
+
+      if (only_tz_adjust == true)
+	{
+	  *dest_dt = *src_dt;
+	  return NO_ERROR;
+	}
+      return db_add_int_to_datetime ((DB_DATETIME *) src_dt, -1000 * TIME_OFFSET (src_is_utc, entry->total_offset_sec),
+				     dest_dt);
+    }
+
+  err_status =
+    tz_datetime_utc_conv_internal (src_dt, tz_info, src_is_utc, only_tz_adjust, dest_dt, &offset_id, &ds_id,
+				   &total_offset_sec);
+  if (err_status == NO_ERROR && offset_id >= 0)
+    {
+      tz_offset_cache_insert (src_dt, tz_info, src_is_utc, offset_id, ds_id, total_offset_sec);
+    }
+
+  return err_status;
+}
+
 /*
  * tz_conv_tz_datetime_w_zone_info () - Converts a source DATETIME from one timezone to another
  *
@@ -212,6 +212,10 @@ extern int xdisk_get_purpose_and_space_info (THREAD_ENTRY * thread_p, VOLID voli
 
 extern int xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID volid, PAGEID pageid,
 				      char *page_bufp, int *page_sizep);
+extern int xqfile_get_list_file_page_fragments (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID volid, PAGEID pageid,
+						QFILE_PAGE_FRAGMENT * fragments, int *num_fragments, int *page_sizep);
+extern void xqfile_free_list_file_page_fragments (THREAD_ENTRY * thread_p, QFILE_PAGE_FRAGMENT * fragments,
+						  int num_fragments);
 
 /* new query interface */
 extern int xqmgr_prepare_query (THREAD_ENTRY * thrd, compile_context * ctx, xasl_stream * stream);
@@ -285,6 +289,8 @@ extern int xchksum_insert_repl_log_and_demote_table_lock (THREAD_ENTRY * thread_
 							  const OID * class_oidp);
 extern bool xlogtb_does_active_user_exist (THREAD_ENTRY * thread_p, const char *user_name);
 extern int xlocator_demote_class_lock (THREAD_ENTRY * thread_p, const OID * class_oid, LOCK lock, LOCK * ex_lock);
+extern INT64 xlocator_get_schema_generation (THREAD_ENTRY * thread_p);
+extern INT64 xlocator_get_authorization_generation (THREAD_ENTRY * thread_p);
 extern bool xtran_should_connection_reset (THREAD_ENTRY * thread_p, bool has_updated);
 extern int xsession_set_tran_auto_commit (THREAD_ENTRY * thread_p, bool auto_commit);
 #endif /* _XSERVER_INTERFACE_H_ */
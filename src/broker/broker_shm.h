@@ -367,6 +367,7 @@ struct t_appl_server_info
   INT64 num_delete_queries;
 
   INT64 num_unique_error_queries;
+  INT64 num_stmt_cache_reuse;	/* prepares answered from the retained statement cache */
   int isolation_level;
   int lock_timeout;
 
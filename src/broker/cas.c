@@ -765,7 +765,11 @@ conn_retry:
 
 	if (as_info->cur_statement_pooling)
 	  {
+#if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL) && !defined(CAS_FOR_CGW) && !defined(LIBCAS_FOR_JSP)
+	    hm_srv_handle_cache_all ();
+#else
 	    hm_srv_handle_free_all (true);
+#endif
 	  }
 
 	if (!is_xa_prepared ())
@@ -1404,7 +1408,11 @@ cas_main (void)
 
 	    if (as_info->cur_statement_pooling)
 	      {
+#if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL) && !defined(CAS_FOR_CGW) && !defined(LIBCAS_FOR_JSP)
+		hm_srv_handle_cache_all ();
+#else
 		hm_srv_handle_free_all (true);
+#endif
 	      }
 
 	    if (!is_xa_prepared ())
@@ -2111,6 +2119,8 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
   cas_send_result_flag = TRUE;
 
 #if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+  ux_result_prefetch_clear ();
+
   /* for 9.0 driver */
   if (DOES_CLIENT_MATCH_THE_PROTOCOL (req_info->client_version, PROTOCOL_V2))
     {
@@ -2308,6 +2318,14 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 	{
 	  cas_log_write_and_end (0, true, "COMMUNICATION ERROR net_write_stream()");
 	}
+#if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+      else
+	{
+	  /* the client is now parsing the batch it just received; use that time
+	   * to pull the next page window from the server */
+	  ux_result_prefetch_run ();
+	}
+#endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
     }
 
   if (cas_shard_flag == OFF && cas_send_result_flag && net_buf->post_send_file != NULL)
@@ -431,6 +431,11 @@ static char database_passwd[SRV_CON_DBPASSWD_SIZE] = "";
 static char cas_db_sys_param[128] = "";
 static int saved_Optimization_level = -1;
 
+/* result whose next page window should be prefetched from the server after
+ * the fetch reply has been written to the client; set by fetch_result() and
+ * consumed by ux_result_prefetch_run() from the request loop */
+static DB_QUERY_RESULT *fetch_prefetch_result = NULL;
+
 /*****************************
   move from cas_log.c
  *****************************/
@@ -622,6 +627,15 @@ ux_database_connect (char *db_name, char *db_user, char *db_passwd, char **db_er
       /* Already connected to a database, make sure to clear errors from previous clients */
       er_clear ();
 
+#if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL) && !defined(CAS_FOR_CGW) && !defined(LIBCAS_FOR_JSP)
+      if (strcmp (database_user, db_user) != 0)
+	{
+	  /* statements are authorized when compiled; ones retained under the
+	   * previous user must not be adopted by the new one */
+	  hm_stmt_cache_free_all ();
+	}
+#endif
+
       err_code = au_login (db_user, db_passwd, true);
       if (err_code < 0)
 	{
@@ -757,6 +771,10 @@ ux_set_default_setting ()
 void
 ux_database_shutdown ()
 {
+#if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL) && !defined(CAS_FOR_CGW) && !defined(LIBCAS_FOR_JSP)
+  /* retained statement sessions die with the connection */
+  hm_stmt_cache_free_all ();
+#endif
 #if defined(CAS_FOR_CGW)
   cgw_database_disconnect ();
 #else
@@ -804,6 +822,28 @@ ux_prepare (char *sql_stmt, int flag, char auto_commit_mode, T_NET_BUF * net_buf
       goto prepare_error;
     }
 
+#ifndef LIBCAS_FOR_JSP
+  if (as_info->cur_statement_pooling && !(flag & (CCI_PREPARE_CALL | CCI_PREPARE_QUERY_INFO)))
+    {
+      srv_h_id = hm_stmt_cache_find (&srv_handle, sql_stmt, flag, query_seq_num);
+      if (srv_h_id > 0)
+	{
+	  /* a statement retained from a previous client session was compiled
+	   * from the same text with the same flag; only the per-session
+	   * attributes and the column info reply need to be rebuilt */
+	  session = (DB_SESSION *) srv_handle->session;
+	  srv_handle->session = NULL;
+	  stmt_id = srv_handle->q_result->stmt_id;
+	  stmt_type = srv_handle->q_result->stmt_type;
+	  num_markers = srv_handle->num_markers;
+	  hm_qresult_end (srv_handle, TRUE);
+	  srv_handle->auto_commit_mode = auto_commit_mode;
+	  as_info->num_stmt_cache_reuse++;
+	  goto prepare_result_set;
+	}
+    }
+#endif /* !LIBCAS_FOR_JSP */
+
   srv_h_id = hm_new_srv_handle (&srv_handle, query_seq_num);
 
   if (srv_h_id < 0)
@@ -3845,9 +3885,51 @@ ux_check_object (DB_OBJECT * obj, T_NET_BUF * net_buf)
 void
 ux_free_result (void *res)
 {
+  if (res != NULL && res == fetch_prefetch_result)
+    {
+      fetch_prefetch_result = NULL;
+    }
+
   db_query_end ((DB_QUERY_RESULT *) res);
 }
 
+/*
+ * ux_result_prefetch_clear - forget a prefetch left over from the previous
+ *                            request
+ */
+void
+ux_result_prefetch_clear (void)
+{
+  fetch_prefetch_result = NULL;
+}
+
+/*
+ * ux_result_prefetch_run - pull the next list file page window for the last
+ *                          fetched result from the server
+ *
+ * NOTE: Called from the request loop after the fetch reply has been written
+ *       to the client, so the server round trip overlaps with the client
+ *       consuming the batch it just received.
+ */
+void
+ux_result_prefetch_run (void)
+{
+  DB_QUERY_RESULT *result = fetch_prefetch_result;
+
+  fetch_prefetch_result = NULL;
+
+  if (result == NULL)
+    {
+      return;
+    }
+
+  if (db_query_prefetch_next_pages (result) < 0)
+    {
+      /* the next fetch will repeat the request and report the error */
+      cas_log_debug (ARG_FILE_LINE, "ux_result_prefetch_run: db_query_prefetch_next_pages() error");
+    }
+}
+
 char
 ux_db_type_to_cas_type (int db_type)
 {
@@ -6063,6 +6145,13 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
 
   srv_handle->cursor_pos = cursor_pos;
 
+  if (fetch_end_flag == 0)
+    {
+      /* more rows remain; request the next page window from the server while
+       * the client is still consuming this batch */
+      fetch_prefetch_result = result;
+    }
+
   return 0;
 }
 
@@ -152,6 +152,8 @@ extern void ux_get_default_setting (void);
 extern void ux_get_system_parameter (const char *param, bool * value);
 extern void ux_set_default_setting (void);
 extern int ux_check_object (DB_OBJECT * obj, T_NET_BUF * net_buf);
+extern void ux_result_prefetch_clear (void);
+extern void ux_result_prefetch_run (void);
 #endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
 extern void ux_free_result (void *res);
 #if defined(CAS_FOR_MYSQL)
@@ -48,6 +48,7 @@
 
 #define SRV_HANDLE_ALLOC_SIZE		256
 
+static int srv_handle_table_add (T_SRV_HANDLE * srv_handle);
 static void srv_handle_content_free (T_SRV_HANDLE * srv_handle);
 static void col_update_info_free (T_QUERY_RESULT * q_result);
 static void srv_handle_rm_tmp_file (int h_id, T_SRV_HANDLE * srv_handle);
@@ -59,33 +60,36 @@ static int max_handle_id = 0;
 static int current_handle_count = 0;
 #endif
 
+#if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL) && !defined(CAS_FOR_CGW) && !defined(LIBCAS_FOR_JSP)
+/* prepared statements retained across client sessions (STATEMENT_POOLING=ON) */
+#define STMT_CACHE_SIZE			64
+
+static int stmt_cache_put (T_SRV_HANDLE * srv_handle);
+static void stmt_cache_handle_free (T_SRV_HANDLE * srv_handle);
+
+static T_SRV_HANDLE *stmt_cache_table[STMT_CACHE_SIZE];
+static int stmt_cache_count = 0;
+static int stmt_cache_victim = 0;
+#endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL && !CAS_FOR_CGW && !LIBCAS_FOR_JSP */
+
 /* implemented in transaction_cl.c */
 extern bool tran_is_in_libcas (void);
 
 static cas_procedure_handle_table procedure_handle_table;
 static int current_handle_id = -1;	/* it is used for javasp */
 
-int
-hm_new_srv_handle (T_SRV_HANDLE ** new_handle, unsigned int seq_num)
+static int
+srv_handle_table_add (T_SRV_HANDLE * srv_handle)
 {
   int i;
   int new_max_srv_handle;
   int new_handle_id = 0;
   T_SRV_HANDLE **new_srv_handle_table = NULL;
-  T_SRV_HANDLE *srv_handle;
-
-#if !defined(LIBCAS_FOR_JSP)
-  if (cas_shard_flag == OFF && current_handle_count >= shm_appl->max_prepared_stmt_count)
-    {
-      return ERROR_INFO_SET (CAS_ER_MAX_PREPARED_STMT_COUNT_EXCEEDED, CAS_ERROR_INDICATOR);
-    }
-#endif /* !LIBCAS_FOR_JSP */
 
   for (i = 0; i < max_srv_handle; i++)
     {
       if (srv_handle_table[i] == NULL)
 	{
-	  *new_handle = srv_handle_table[i];
 	  new_handle_id = i + 1;
 	  break;
 	}
@@ -106,13 +110,41 @@ hm_new_srv_handle (T_SRV_HANDLE ** new_handle, unsigned int seq_num)
       srv_handle_table = new_srv_handle_table;
     }
 
+  srv_handle_table[new_handle_id - 1] = srv_handle;
+  if (new_handle_id > max_handle_id)
+    {
+      max_handle_id = new_handle_id;
+    }
+
+#if !defined(LIBCAS_FOR_JSP)
+  current_handle_count++;
+#endif
+
+  /* register handler id created from server-side JDBC */
+  cas_procedure_handle_add (procedure_handle_table, current_handle_id, new_handle_id);
+
+  return new_handle_id;
+}
+
+int
+hm_new_srv_handle (T_SRV_HANDLE ** new_handle, unsigned int seq_num)
+{
+  int new_handle_id;
+  T_SRV_HANDLE *srv_handle;
+
+#if !defined(LIBCAS_FOR_JSP)
+  if (cas_shard_flag == OFF && current_handle_count >= shm_appl->max_prepared_stmt_count)
+    {
+      return ERROR_INFO_SET (CAS_ER_MAX_PREPARED_STMT_COUNT_EXCEEDED, CAS_ERROR_INDICATOR);
+    }
+#endif /* !LIBCAS_FOR_JSP */
+
   srv_handle = (T_SRV_HANDLE *) MALLOC (sizeof (T_SRV_HANDLE));
   if (srv_handle == NULL)
     {
       return ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
     }
   memset (srv_handle, 0, sizeof (T_SRV_HANDLE));
-  srv_handle->id = new_handle_id;
   srv_handle->query_seq_num = seq_num;
   srv_handle->use_plan_cache = false;
   srv_handle->use_query_cache = false;
@@ -137,19 +169,15 @@ hm_new_srv_handle (T_SRV_HANDLE ** new_handle, unsigned int seq_num)
   srv_handle->cgw_handle = NULL;
 #endif /* CAS_FOR_CGW */
 
-  *new_handle = srv_handle;
-  srv_handle_table[new_handle_id - 1] = srv_handle;
-  if (new_handle_id > max_handle_id)
+  new_handle_id = srv_handle_table_add (srv_handle);
+  if (new_handle_id < 0)
     {
-      max_handle_id = new_handle_id;
+      FREE_MEM (srv_handle);
+      return new_handle_id;
     }
 
-#if !defined(LIBCAS_FOR_JSP)
-  current_handle_count++;
-#endif
-
-  /* register handler id created from server-side JDBC */
-  cas_procedure_handle_add (procedure_handle_table, current_handle_id, new_handle_id);
+  srv_handle->id = new_handle_id;
+  *new_handle = srv_handle;
 
   return new_handle_id;
 }
@@ -244,6 +272,153 @@ hm_srv_handle_free_all (bool free_holdable)
 #endif
 }
 
+#if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL) && !defined(CAS_FOR_CGW) && !defined(LIBCAS_FOR_JSP)
+/*
+ * hm_stmt_cache_find - adopt a statement retained by hm_srv_handle_cache_all.
+ *   A hit re-registers the handle in the handle table and returns its new id;
+ *   0 means the caller must prepare from scratch.
+ */
+int
+hm_stmt_cache_find (T_SRV_HANDLE ** found, const char *sql_stmt, char flag, unsigned int seq_num)
+{
+  T_SRV_HANDLE *srv_handle;
+  int i;
+  int h_id;
+
+  if (cas_shard_flag == OFF && current_handle_count >= shm_appl->max_prepared_stmt_count)
+    {
+      return 0;
+    }
+
+  for (i = 0; i < stmt_cache_count; i++)
+    {
+      srv_handle = stmt_cache_table[i];
+      if (srv_handle->prepare_flag != flag || strcmp (srv_handle->sql_stmt, sql_stmt) != 0)
+	{
+	  continue;
+	}
+
+      h_id = srv_handle_table_add (srv_handle);
+      if (h_id < 0)
+	{
+	  /* fall back to a normal prepare; the entry stays cached */
+	  return 0;
+	}
+
+      stmt_cache_table[i] = stmt_cache_table[--stmt_cache_count];
+      stmt_cache_table[stmt_cache_count] = NULL;
+
+      srv_handle->id = h_id;
+      srv_handle->query_seq_num = seq_num;
+      *found = srv_handle;
+      return h_id;
+    }
+
+  return 0;
+}
+
+/*
+ * hm_srv_handle_cache_all - session-end replacement for
+ *   hm_srv_handle_free_all (true): prepared statements worth keeping move
+ *   into the statement cache, everything else is freed.
+ */
+void
+hm_srv_handle_cache_all (void)
+{
+  T_SRV_HANDLE *srv_handle;
+  int i;
+
+  for (i = 0; i < max_handle_id; i++)
+    {
+      srv_handle = srv_handle_table[i];
+      if (srv_handle == NULL)
+	{
+	  continue;
+	}
+
+      if (stmt_cache_put (srv_handle) < 0)
+	{
+	  srv_handle_content_free (srv_handle);
+	  srv_handle_rm_tmp_file (i + 1, srv_handle);
+	  FREE_MEM (srv_handle);
+	}
+
+      srv_handle_table[i] = NULL;
+    }
+
+  max_handle_id = 0;
+  current_handle_count = 0;
+  as_info->num_holdable_results = 0;
+}
+
+void
+hm_stmt_cache_free_all (void)
+{
+  int i;
+
+  for (i = 0; i < stmt_cache_count; i++)
+    {
+      stmt_cache_handle_free (stmt_cache_table[i]);
+      stmt_cache_table[i] = NULL;
+    }
+
+  stmt_cache_count = 0;
+  stmt_cache_victim = 0;
+}
+
+/*
+ * stmt_cache_put - detach a handle from its client session and retain it.
+ *   Returns 0 when the cache took ownership, -1 when the handle is not
+ *   cacheable and the caller must free it.
+ */
+static int
+stmt_cache_put (T_SRV_HANDLE * srv_handle)
+{
+  int i;
+
+  if (srv_handle->schema_type >= 0 || !srv_handle->is_prepared || srv_handle->session == NULL
+      || srv_handle->sql_stmt == NULL || srv_handle->prepare_call_info != NULL || srv_handle->q_result == NULL
+      || srv_handle->is_holdable || srv_handle->query_info_flag == TRUE)
+    {
+      return -1;
+    }
+
+  /* a client may have prepared the same text twice; keep the first copy only */
+  for (i = 0; i < stmt_cache_count; i++)
+    {
+      if (stmt_cache_table[i]->prepare_flag == srv_handle->prepare_flag
+	  && strcmp (stmt_cache_table[i]->sql_stmt, srv_handle->sql_stmt) == 0)
+	{
+	  return -1;
+	}
+    }
+
+  hm_qresult_end (srv_handle, FALSE);
+
+  if (stmt_cache_count >= STMT_CACHE_SIZE)
+    {
+      stmt_cache_handle_free (stmt_cache_table[stmt_cache_victim]);
+      stmt_cache_table[stmt_cache_victim] = srv_handle;
+      stmt_cache_victim = (stmt_cache_victim + 1) % STMT_CACHE_SIZE;
+    }
+  else
+    {
+      stmt_cache_table[stmt_cache_count++] = srv_handle;
+    }
+
+  return 0;
+}
+
+static void
+stmt_cache_handle_free (T_SRV_HANDLE * srv_handle)
+{
+  srv_handle_content_free (srv_handle);
+  FREE_MEM (srv_handle->classes);
+  FREE_MEM (srv_handle->classes_chn);
+  FREE_MEM (srv_handle);
+}
+#endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL && !CAS_FOR_CGW && !LIBCAS_FOR_JSP */
+
 void
 hm_srv_handle_unset_prepare_flag_all (void)
 {
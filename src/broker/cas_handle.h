@@ -240,4 +240,10 @@ extern void hm_set_current_srv_handle (int h_id);
 
 extern int hm_srv_handle_get_current_count (void);
 extern void hm_srv_handle_unset_prepare_flag_all (void);
+
+#if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL) && !defined(CAS_FOR_CGW) && !defined(LIBCAS_FOR_JSP)
+extern int hm_stmt_cache_find (T_SRV_HANDLE ** found, const char *sql_stmt, char flag, unsigned int seq_num);
+extern void hm_srv_handle_cache_all (void);
+extern void hm_stmt_cache_free_all (void);
+#endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL && !CAS_FOR_CGW && !LIBCAS_FOR_JSP */
 #endif /* _CAS_HANDLE_H_ */
@@ -36,6 +36,7 @@
 #else
 #include <unistd.h>
 #include <sys/time.h>
+#include <pthread.h>
 #endif
 #include <assert.h>
 
@@ -56,6 +57,14 @@
 #endif
 #include "chartype.h"
 
+#ifndef LIBCAS_FOR_JSP
+/* *INDENT-OFF* */
+#include "lockfree_circular_queue.hpp"
+#include <atomic>
+#include <new>
+/* *INDENT-ON* */
+#endif /* !LIBCAS_FOR_JSP */
+
 #if defined(WINDOWS)
 typedef int mode_t;
 #endif /* WINDOWS */
@@ -93,6 +102,57 @@ static FILE *log_fp = NULL, *slow_log_fp = NULL;
 static char log_filepath[BROKER_PATH_MAX], slow_log_filepath[BROKER_PATH_MAX];
 static INT64 saved_log_fpos = 0;
 
+#ifndef LIBCAS_FOR_JSP
+/*
+ * Slow query logging is asynchronous.  The request thread only formats the record and pushes it onto a lock-free ring
+ * which a detached writer thread drains with buffered writes, so the disk never sits on the request path.  Data chunks
+ * are dropped when the ring overflows (a notice line is emitted once room returns); control chunks - open, close,
+ * reset and end-of-record - decide the state of the log file and are always delivered.
+ */
+#define SLOW_LOG_CHUNK_DATA_SIZE 256
+#define SLOW_LOG_QUEUE_SIZE 4096
+#define SLOW_LOG_DRAIN_MAX_WAIT_MSEC 5000
+
+enum
+{
+  SLOW_LOG_CHUNK_DATA = 0,
+  SLOW_LOG_CHUNK_END = 1,
+  SLOW_LOG_CHUNK_OPEN = 2,
+  SLOW_LOG_CHUNK_CLOSE = 3,
+  SLOW_LOG_CHUNK_RESET = 4
+};
+
+typedef struct t_slow_log_chunk T_SLOW_LOG_CHUNK;
+struct t_slow_log_chunk
+{
+  char type;
+  short length;
+  char data[SLOW_LOG_CHUNK_DATA_SIZE];
+};
+
+/* *INDENT-OFF* */
+static lockfree::circular_queue<T_SLOW_LOG_CHUNK> *slow_log_queue = NULL;
+static std::atomic<INT64> slow_log_produced {0};
+static std::atomic<INT64> slow_log_consumed {0};
+static std::atomic<INT64> slow_log_dropped {0};
+/* *INDENT-ON* */
+static bool slow_log_writer_started = false;
+static pthread_t slow_log_writer_tid;
+
+static bool cas_slow_log_async_start (void);
+static void cas_slow_log_enqueue_data (const char *buf, int size);
+static void cas_slow_log_enqueue_control (char type, const char *name);
+static void cas_slow_log_drain (void);
+static THREAD_FUNC slow_log_writer_thr_f (void *arg);
+#endif /* !LIBCAS_FOR_JSP */
+
+static int cas_log_make_record (char *buf, int bufsize, struct timeval *log_time, unsigned int seq_num,
+				const char *fmt, va_list ap);
+static void cas_slow_log_open_internal (const char *br_name);
+static void cas_slow_log_close_internal (void);
+static void cas_slow_log_reset_internal (const char *br_name);
+static void cas_slow_log_end_internal (void);
+
 static size_t cas_fwrite (const void *ptr, size_t size, size_t nmemb, FILE * stream);
 static INT64 cas_ftell (FILE * stream);
 static int cas_fseek (FILE * stream, INT64 offset, int whence);
@@ -400,15 +460,15 @@ cas_log_end (int mode, int run_time_sec, int run_time_msec)
 #endif /* LIBCAS_FOR_JSP */
 }
 
-static void
-cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_num, bool do_flush, const char *fmt,
-			va_list ap)
+static int
+cas_log_make_record (char *buf, int bufsize, struct timeval *log_time, unsigned int seq_num, const char *fmt,
+		     va_list ap)
 {
-  char *buf, *p;
+  char *p;
   int len, n;
 
-  p = buf = cas_log_buffer;
-  len = CAS_LOG_BUFFER_SIZE;
+  p = buf;
+  len = bufsize;
   n = ut_time_string (p, log_time);
   len -= n;
   p += n;
@@ -431,7 +491,18 @@ cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_nu
 	}
     }
 
-  cas_fwrite (buf, (p - buf), 1, fp);
+  return (int) (p - buf);
+}
+
+static void
+cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_num, bool do_flush, const char *fmt,
+			va_list ap)
+{
+  int n;
+
+  n = cas_log_make_record (cas_log_buffer, CAS_LOG_BUFFER_SIZE, log_time, seq_num, fmt, ap);
+
+  cas_fwrite (cas_log_buffer, n, 1, fp);
 
   if (do_flush == true)
     {
@@ -1170,13 +1241,13 @@ access_log_open (char *log_file_name)
   return fp;
 }
 
-void
-cas_slow_log_open (char *br_name)
+static void
+cas_slow_log_open_internal (const char *br_name)
 {
 #ifndef LIBCAS_FOR_JSP
   if (slow_log_fp != NULL)
     {
-      cas_slow_log_close ();
+      cas_slow_log_close_internal ();
     }
 
   if (as_info->cur_slow_log_mode != SLOW_LOG_MODE_OFF)
@@ -1203,14 +1274,29 @@ cas_slow_log_open (char *br_name)
 }
 
 void
-cas_slow_log_reset (char *br_name)
+cas_slow_log_open (char *br_name)
+{
+#ifndef LIBCAS_FOR_JSP
+  if (cas_slow_log_async_start ())
+    {
+      cas_slow_log_enqueue_control (SLOW_LOG_CHUNK_OPEN, br_name);
+    }
+  else
+    {
+      cas_slow_log_open_internal (br_name);
+    }
+#endif /* LIBCAS_FOR_JSP */
+}
+
+static void
+cas_slow_log_reset_internal (const char *br_name)
 {
 #ifndef LIBCAS_FOR_JSP
   if (as_info->cas_slow_log_reset)
     {
       if (slow_log_fp != NULL)
 	{
-	  cas_slow_log_close ();
+	  cas_slow_log_close_internal ();
 	}
       if ((as_info->cas_slow_log_reset & CAS_LOG_RESET_REMOVE) != 0)
 	{
@@ -1219,14 +1305,34 @@ cas_slow_log_reset (char *br_name)
 
       if (as_info->cur_slow_log_mode != SLOW_LOG_MODE_OFF)
 	{
-	  cas_slow_log_open (br_name);
+	  cas_slow_log_open_internal (br_name);
 	}
     }
 #endif /* LIBCAS_FOR_JSP */
 }
 
 void
-cas_slow_log_close ()
+cas_slow_log_reset (char *br_name)
+{
+#ifndef LIBCAS_FOR_JSP
+  if (as_info->cas_slow_log_reset == 0)
+    {
+      return;
+    }
+
+  if (cas_slow_log_async_start ())
+    {
+      cas_slow_log_enqueue_control (SLOW_LOG_CHUNK_RESET, br_name);
+    }
+  else
+    {
+      cas_slow_log_reset_internal (br_name);
+    }
+#endif /* LIBCAS_FOR_JSP */
+}
+
+static void
+cas_slow_log_close_internal (void)
 {
 #ifndef LIBCAS_FOR_JSP
   if (slow_log_fp != NULL)
@@ -1238,12 +1344,29 @@ cas_slow_log_close ()
 }
 
 void
-cas_slow_log_end ()
+cas_slow_log_close ()
+{
+#ifndef LIBCAS_FOR_JSP
+  if (slow_log_writer_started)
+    {
+      /* make sure the records of the ending session are on disk before the file is closed */
+      cas_slow_log_enqueue_control (SLOW_LOG_CHUNK_CLOSE, NULL);
+      cas_slow_log_drain ();
+    }
+  else
+    {
+      cas_slow_log_close_internal ();
+    }
+#endif /* LIBCAS_FOR_JSP */
+}
+
+static void
+cas_slow_log_end_internal (void)
 {
 #ifndef LIBCAS_FOR_JSP
   if (slow_log_fp == NULL && as_info->cur_slow_log_mode != SLOW_LOG_MODE_OFF)
     {
-      cas_slow_log_open (shm_appl->broker_name);
+      cas_slow_log_open_internal (shm_appl->broker_name);
     }
 
   if (slow_log_fp != NULL)
@@ -1253,9 +1376,9 @@ cas_slow_log_end ()
 
       if ((slow_log_fpos / 1000) > shm_appl->sql_log_max_size)
 	{
-	  cas_slow_log_close ();
+	  cas_slow_log_close_internal ();
 	  cas_log_backup (FID_SLOW_LOG_DIR);
-	  cas_slow_log_open (NULL);
+	  cas_slow_log_open_internal (NULL);
 	}
       else
 	{
@@ -1266,24 +1389,241 @@ cas_slow_log_end ()
 #endif /* LIBCAS_FOR_JSP */
 }
 
+void
+cas_slow_log_end ()
+{
+#ifndef LIBCAS_FOR_JSP
+  if (cas_slow_log_async_start ())
+    {
+      cas_slow_log_enqueue_control (SLOW_LOG_CHUNK_END, NULL);
+    }
+  else
+    {
+      cas_slow_log_end_internal ();
+    }
+#endif /* LIBCAS_FOR_JSP */
+}
+
+#ifndef LIBCAS_FOR_JSP
+static bool
+cas_slow_log_async_start (void)
+{
+  static bool attempted = false;
+
+  if (slow_log_writer_started)
+    {
+      return true;
+    }
+  if (attempted)
+    {
+      return false;
+    }
+  attempted = true;
+
+  /* *INDENT-OFF* */
+  slow_log_queue = new (std::nothrow) lockfree::circular_queue<T_SLOW_LOG_CHUNK> (SLOW_LOG_QUEUE_SIZE);
+  /* *INDENT-ON* */
+  if (slow_log_queue == NULL)
+    {
+      return false;
+    }
+
+  THREAD_BEGIN (slow_log_writer_tid, slow_log_writer_thr_f, NULL);
+  slow_log_writer_started = true;
+
+  return true;
+}
+
+static void
+cas_slow_log_enqueue_data (const char *buf, int size)
+{
+  T_SLOW_LOG_CHUNK chunk;
+  INT64 dropped;
+  int n;
+
+  /* announce previously dropped chunks once there is room again */
+  dropped = slow_log_dropped.load ();
+  if (dropped > 0)
+    {
+      chunk.type = SLOW_LOG_CHUNK_DATA;
+      chunk.length =
+	(short) snprintf (chunk.data, sizeof (chunk.data), "--- %lld slow query log chunk(s) dropped ---\n",
+			  (long long) dropped);
+      if (slow_log_queue->produce (chunk))
+	{
+	  slow_log_produced++;
+	  slow_log_dropped -= dropped;
+	}
+    }
+
+  chunk.type = SLOW_LOG_CHUNK_DATA;
+  do
+    {
+      n = (size > SLOW_LOG_CHUNK_DATA_SIZE) ? SLOW_LOG_CHUNK_DATA_SIZE : size;
+      chunk.length = (short) n;
+      memcpy (chunk.data, buf, n);
+
+      if (slow_log_queue->produce (chunk))
+	{
+	  slow_log_produced++;
+	}
+      else
+	{
+	  /* overload: drop the rest of this record rather than block the request */
+	  slow_log_dropped++;
+	  return;
+	}
+
+      buf += n;
+      size -= n;
+    }
+  while (size > 0);
+}
+
+static void
+cas_slow_log_enqueue_control (char type, const char *name)
+{
+  T_SLOW_LOG_CHUNK chunk;
+  size_t len;
+
+  chunk.type = type;
+  chunk.length = 0;
+  chunk.data[0] = '\0';
+  if (name != NULL)
+    {
+      len = strlen (name);
+      if (len >= sizeof (chunk.data))
+	{
+	  len = sizeof (chunk.data) - 1;
+	}
+      memcpy (chunk.data, name, len);
+      chunk.data[len] = '\0';
+      chunk.length = (short) (len + 1);
+    }
+
+  /* control chunks decide the state of the log file; losing one would wedge rotation or leak the descriptor, so wait
+   * for room instead of dropping */
+  slow_log_queue->force_produce (chunk);
+  slow_log_produced++;
+}
+
+static void
+cas_slow_log_drain (void)
+{
+  int i;
+
+  /* bounded wait: losing the tail of the log at shutdown beats hanging the CAS */
+  for (i = 0; i < SLOW_LOG_DRAIN_MAX_WAIT_MSEC; i++)
+    {
+      if (slow_log_consumed.load () >= slow_log_produced.load ())
+	{
+	  return;
+	}
+      SLEEP_MILISEC (0, 1);
+    }
+}
+
+static THREAD_FUNC
+slow_log_writer_thr_f (void *arg)
+{
+  T_SLOW_LOG_CHUNK chunk;
+  bool need_flush = false;
+
+  while (true)
+    {
+      if (!slow_log_queue->consume (chunk))
+	{
+	  /* the ring ran dry: flush what the batch accumulated, then wait for more work */
+	  if (need_flush)
+	    {
+	      if (slow_log_fp != NULL)
+		{
+		  cas_fflush (slow_log_fp);
+		}
+	      need_flush = false;
+	    }
+	  SLEEP_MILISEC (0, 10);
+	  continue;
+	}
+
+      switch (chunk.type)
+	{
+	case SLOW_LOG_CHUNK_DATA:
+	  if (slow_log_fp == NULL && as_info->cur_slow_log_mode != SLOW_LOG_MODE_OFF)
+	    {
+	      cas_slow_log_open_internal (shm_appl->broker_name);
+	    }
+	  if (slow_log_fp != NULL)
+	    {
+	      cas_fwrite (chunk.data, chunk.length, 1, slow_log_fp);
+	      need_flush = true;
+	    }
+	  break;
+	case SLOW_LOG_CHUNK_END:
+	  cas_slow_log_end_internal ();
+	  break;
+	case SLOW_LOG_CHUNK_OPEN:
+	  cas_slow_log_open_internal (chunk.length > 0 ? chunk.data : NULL);
+	  break;
+	case SLOW_LOG_CHUNK_RESET:
+	  cas_slow_log_reset_internal (chunk.length > 0 ? chunk.data : NULL);
+	  break;
+	case SLOW_LOG_CHUNK_CLOSE:
+	  cas_slow_log_close_internal ();
+	  break;
+	default:
+	  assert (false);
+	  break;
+	}
+
+      slow_log_consumed++;
+    }
+
+#if defined(WINDOWS)
+  return;
+#else
+  return NULL;
+#endif
+}
+#endif /* !LIBCAS_FOR_JSP */
+
 void
 cas_slow_log_write_and_end (struct timeval *log_time, unsigned int seq_num, const char *fmt, ...)
 {
 #ifndef LIBCAS_FOR_JSP
-  if (slow_log_fp == NULL && as_info->cur_slow_log_mode != SLOW_LOG_MODE_OFF)
+  va_list ap;
+
+  if (as_info->cur_slow_log_mode == SLOW_LOG_MODE_OFF)
     {
-      cas_slow_log_open (shm_appl->broker_name);
+      return;
     }
 
-  if (slow_log_fp != NULL)
+  if (cas_slow_log_async_start ())
     {
-      va_list ap;
+      int n;
+
+      /* formatting stays on the request thread (cas_log_buffer is shared with the sql log); only the write moves */
+      va_start (ap, fmt);
+      n = cas_log_make_record (cas_log_buffer, CAS_LOG_BUFFER_SIZE, log_time, seq_num, fmt, ap);
+      va_end (ap);
+
+      cas_slow_log_enqueue_data (cas_log_buffer, n);
+      cas_slow_log_enqueue_control (SLOW_LOG_CHUNK_END, NULL);
+      return;
+    }
 
+  if (slow_log_fp == NULL)
+    {
+      cas_slow_log_open_internal (shm_appl->broker_name);
+    }
+
+  if (slow_log_fp != NULL)
+    {
       va_start (ap, fmt);
       cas_log_write_internal (slow_log_fp, log_time, seq_num, false, fmt, ap);
       va_end (ap);
 
-      cas_slow_log_end ();
+      cas_slow_log_end_internal ();
     }
 
 #endif /* LIBCAS_FOR_JSP */
@@ -1293,15 +1633,32 @@ void
 cas_slow_log_write (struct timeval *log_time, unsigned int seq_num, bool unit_start, const char *fmt, ...)
 {
 #ifndef LIBCAS_FOR_JSP
-  if (slow_log_fp == NULL && as_info->cur_slow_log_mode != SLOW_LOG_MODE_OFF)
+  va_list ap;
+
+  if (as_info->cur_slow_log_mode == SLOW_LOG_MODE_OFF)
     {
-      cas_slow_log_open (shm_appl->broker_name);
+      return;
     }
 
-  if (slow_log_fp != NULL)
+  if (cas_slow_log_async_start ())
     {
-      va_list ap;
+      int n;
+
+      va_start (ap, fmt);
+      n = cas_log_make_record (cas_log_buffer, CAS_LOG_BUFFER_SIZE, log_time, seq_num, fmt, ap);
+      va_end (ap);
+
+      cas_slow_log_enqueue_data (cas_log_buffer, n);
+      return;
+    }
+
+  if (slow_log_fp == NULL)
+    {
+      cas_slow_log_open_internal (shm_appl->broker_name);
+    }
 
+  if (slow_log_fp != NULL)
+    {
       va_start (ap, fmt);
       cas_log_write_internal (slow_log_fp, log_time, seq_num, false, fmt, ap);
       va_end (ap);
@@ -1313,15 +1670,37 @@ void
 cas_slow_log_write2 (const char *fmt, ...)
 {
 #ifndef LIBCAS_FOR_JSP
-  if (slow_log_fp == NULL && as_info->cur_slow_log_mode != SLOW_LOG_MODE_OFF)
+  va_list ap;
+
+  if (as_info->cur_slow_log_mode == SLOW_LOG_MODE_OFF)
     {
-      cas_slow_log_open (shm_appl->broker_name);
+      return;
     }
 
-  if (slow_log_fp != NULL)
+  if (cas_slow_log_async_start ())
     {
-      va_list ap;
+      int n;
+
+      va_start (ap, fmt);
+      n = vsnprintf (cas_log_buffer, CAS_LOG_BUFFER_SIZE, fmt, ap);
+      va_end (ap);
+      if (n >= CAS_LOG_BUFFER_SIZE)
+	{
+	  /* string is truncated and trailing '\0' is included */
+	  n = CAS_LOG_BUFFER_SIZE - 1;
+	}
+
+      cas_slow_log_enqueue_data (cas_log_buffer, n);
+      return;
+    }
+
+  if (slow_log_fp == NULL)
+    {
+      cas_slow_log_open_internal (shm_appl->broker_name);
+    }
 
+  if (slow_log_fp != NULL)
+    {
       va_start (ap, fmt);
       cas_log_write2_internal (slow_log_fp, false, fmt, ap);
       va_end (ap);
@@ -1333,9 +1712,20 @@ void
 cas_slow_log_write_value_string (char *value, int size)
 {
 #ifndef LIBCAS_FOR_JSP
-  if (slow_log_fp == NULL && as_info->cur_slow_log_mode != SLOW_LOG_MODE_OFF)
+  if (as_info->cur_slow_log_mode == SLOW_LOG_MODE_OFF)
+    {
+      return;
+    }
+
+  if (cas_slow_log_async_start ())
     {
-      cas_slow_log_open (shm_appl->broker_name);
+      cas_slow_log_enqueue_data (value, size);
+      return;
+    }
+
+  if (slow_log_fp == NULL)
+    {
+      cas_slow_log_open_internal (shm_appl->broker_name);
     }
 
   if (slow_log_fp != NULL)
@@ -1349,15 +1739,44 @@ void
 cas_slow_log_write_query_string (char *query, int size)
 {
 #ifndef LIBCAS_FOR_JSP
-  if (slow_log_fp == NULL && as_info->cur_slow_log_mode != SLOW_LOG_MODE_OFF)
+  char *s;
+
+  if (as_info->cur_slow_log_mode == SLOW_LOG_MODE_OFF)
+    {
+      return;
+    }
+
+  if (query == NULL)
+    {
+      return;
+    }
+
+  if (cas_slow_log_async_start ())
     {
-      cas_slow_log_open (shm_appl->broker_name);
+      char buf[SLOW_LOG_CHUNK_DATA_SIZE];
+      int n = 0;
+
+      for (s = query; *s; s++)
+	{
+	  buf[n++] = (*s == '\n' || *s == '\r') ? ' ' : *s;
+	  if (n == SLOW_LOG_CHUNK_DATA_SIZE)
+	    {
+	      cas_slow_log_enqueue_data (buf, n);
+	      n = 0;
+	    }
+	}
+      buf[n++] = '\n';
+      cas_slow_log_enqueue_data (buf, n);
+      return;
     }
 
-  if (slow_log_fp != NULL && query != NULL)
+  if (slow_log_fp == NULL)
     {
-      char *s;
+      cas_slow_log_open_internal (shm_appl->broker_name);
+    }
 
+  if (slow_log_fp != NULL)
+    {
       for (s = query; *s; s++)
 	{
 	  if (*s == '\n' || *s == '\r')
@@ -1446,6 +1446,185 @@ execute_end:
   return error;
 }
 
+/*
+ * cci_execute_async - send an execute request without waiting for its reply.
+ *
+ * The caller is free to do other work (or run other connections) while the
+ * CAS executes the statement; the reply is collected with
+ * cci_execute_async_result, and cci_execute_async_poll tells whether that
+ * call would block.  Only one execute may be in flight per connection - the
+ * CAS protocol is strictly request/reply - and no other request may be
+ * issued on the connection until the result has been collected.
+ */
+int
+cci_execute_async (int mapped_stmt_id, char flag, int max_col_size, T_CCI_ERROR * err_buf)
+{
+  T_REQ_HANDLE *req_handle = NULL;
+  T_CON_HANDLE *con_handle = NULL;
+  int error = CCI_ER_NO_ERROR;
+
+#ifdef CCI_DEBUG
+  CCI_DEBUG_PRINT (print_debug_msg
+		   ("(%d:%d)exe_async: %d, %d", CON_ID (mapped_stmt_id), REQ_ID (mapped_stmt_id), flag, max_col_size));
+#endif
+
+  reset_error_buffer (err_buf);
+  error = hm_get_statement (mapped_stmt_id, &con_handle, &req_handle);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      set_error_buffer (err_buf, error, NULL);
+      return error;
+    }
+  reset_error_buffer (&(con_handle->err_buf));
+
+  if (con_handle->async_stmt_id != 0)
+    {
+      /* the previous async execute has not been collected yet */
+      error = CCI_ER_THREAD_RUNNING;
+      goto execute_async_end;
+    }
+
+  if (flag & CCI_EXEC_ONLY_QUERY_PLAN)
+    {
+      flag |= CCI_EXEC_QUERY_INFO;
+    }
+  flag &= ~CCI_EXEC_ASYNC;
+
+  con_handle->shard_id = CCI_SHARD_ID_INVALID;
+  req_handle->shard_id = CCI_SHARD_ID_INVALID;
+
+  API_SLOG (con_handle);
+  set_start_time_for_query (con_handle, req_handle);
+
+  if (IS_BROKER_STMT_POOL (con_handle) && req_handle->valid == false)
+    {
+      error =
+	qe_prepare (req_handle, con_handle, req_handle->sql_text, req_handle->prepare_flag, &(con_handle->err_buf), 1);
+    }
+
+  if (error >= 0)
+    {
+      error = qe_execute_send (req_handle, con_handle, flag, max_col_size, &(con_handle->err_buf));
+    }
+
+  if (error >= 0)
+    {
+      con_handle->async_stmt_id = mapped_stmt_id;
+    }
+  else
+    {
+      RESET_START_TIME (con_handle);
+    }
+
+execute_async_end:
+  API_ELOG (con_handle, error);
+
+  set_error_buffer (&(con_handle->err_buf), error, NULL);
+  get_last_error (con_handle, err_buf);
+  con_handle->used = false;
+
+  return error;
+}
+
+/*
+ * cci_execute_async_poll - has the reply of the pending async execute
+ *                          arrived?
+ *   return: 1 when cci_execute_async_result will not block, 0 when the reply
+ *           has not arrived yet, negative error code otherwise
+ */
+int
+cci_execute_async_poll (int mapped_stmt_id, T_CCI_ERROR * err_buf)
+{
+  T_REQ_HANDLE *req_handle = NULL;
+  T_CON_HANDLE *con_handle = NULL;
+  int error = CCI_ER_NO_ERROR;
+
+  reset_error_buffer (err_buf);
+  error = hm_get_statement (mapped_stmt_id, &con_handle, &req_handle);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      set_error_buffer (err_buf, error, NULL);
+      return error;
+    }
+
+  if (con_handle->async_stmt_id != mapped_stmt_id)
+    {
+      error = CCI_ER_INVALID_ARGS;
+    }
+  else
+    {
+      error = net_msg_available (con_handle);
+    }
+
+  if (error < 0)
+    {
+      set_error_buffer (&(con_handle->err_buf), error, NULL);
+      get_last_error (con_handle, err_buf);
+    }
+  con_handle->used = false;
+
+  return error;
+}
+
+/*
+ * cci_execute_async_result - wait for and decode the reply of the pending
+ *                            async execute
+ *   return: like cci_execute: the affected row / result count, or a negative
+ *           error code
+ */
+int
+cci_execute_async_result (int mapped_stmt_id, T_CCI_ERROR * err_buf)
+{
+  T_REQ_HANDLE *req_handle = NULL;
+  T_CON_HANDLE *con_handle = NULL;
+  int error = CCI_ER_NO_ERROR;
+
+#ifdef CCI_DEBUG
+  CCI_DEBUG_PRINT (print_debug_msg
+		   ("(%d:%d)exe_async_result", CON_ID (mapped_stmt_id), REQ_ID (mapped_stmt_id)));
+#endif
+
+  reset_error_buffer (err_buf);
+  error = hm_get_statement (mapped_stmt_id, &con_handle, &req_handle);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      set_error_buffer (err_buf, error, NULL);
+      return error;
+    }
+  reset_error_buffer (&(con_handle->err_buf));
+
+  if (con_handle->async_stmt_id != mapped_stmt_id)
+    {
+      error = CCI_ER_INVALID_ARGS;
+      goto async_result_end;
+    }
+
+  con_handle->async_stmt_id = 0;
+
+  error = qe_execute_receive (req_handle, con_handle, &(con_handle->err_buf));
+
+  RESET_START_TIME (con_handle);
+
+  if (error == CCI_ER_QUERY_TIMEOUT && con_handle->disconnect_on_query_timeout)
+    {
+      hm_force_close_connection (con_handle);
+    }
+
+  if (IS_OUT_TRAN (con_handle))
+    {
+      hm_check_rc_time (con_handle);
+    }
+
+async_result_end:
+  API_ELOG (con_handle, error);
+
+  set_error_buffer (&(con_handle->err_buf), error, NULL);
+  get_last_error (con_handle, err_buf);
+  con_handle->used = false;
+
+  return error;
+}
+
 /*
  * For the purpose of re-balancing existing connections, cci_prepare,
  * cci_execute, cci_execute_array, cci_prepare_and_execute,
@@ -1265,6 +1265,7 @@ init_con_handle (T_CON_HANDLE * con_handle, char *ip_str, int port, char *db_nam
   con_handle->lock_timeout = CCI_LOCK_TIMEOUT_DEFAULT;
   con_handle->is_retry = 0;
   con_handle->used = false;
+  con_handle->async_stmt_id = 0;
   con_handle->con_status = CCI_CON_STATUS_OUT_TRAN;
   con_handle->autocommit_mode = CCI_AUTOCOMMIT_TRUE;
   hm_make_empty_session (&con_handle->session_id);
@@ -1507,6 +1508,7 @@ hm_force_close_connection (T_CON_HANDLE * con_handle)
   con_handle->sock_fd = INVALID_SOCKET;
   con_handle->con_status = CCI_CON_STATUS_OUT_TRAN;
   con_handle->force_failback = 0;
+  con_handle->async_stmt_id = 0;
 }
 
 void
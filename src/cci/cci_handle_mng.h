@@ -175,6 +175,8 @@ typedef struct
   int is_from_current_transaction;
   int shard_id;
   char is_fetch_completed;	/* used only cas4oracle */
+  char exec_flag_pending;	/* execute flag of an async execute in flight */
+  int exec_recv_timeout;	/* receive timeout of the pending execute reply */
   void *prev;
   void *next;
 } T_REQ_HANDLE;
@@ -217,6 +219,7 @@ typedef struct
   char url[SRV_CON_URL_SIZE];
   SOCKET sock_fd;
   int max_req_handle;
+  int async_stmt_id;		/* mapped id of the statement whose execute reply is pending; 0 when none */
   T_EXEC_THR_ARG thr_arg;
   T_REQ_HANDLE **req_handle_table;
   int req_handle_count;
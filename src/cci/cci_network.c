@@ -618,6 +618,13 @@ net_send_msg (T_CON_HANDLE * con_handle, char *msg, int size)
   int err;
   struct timeval ts, te;
 
+  if (con_handle->async_stmt_id != 0)
+    {
+      /* the reply of an async execute is still on the wire; interleaving
+       * another request would corrupt the CAS protocol */
+      return CCI_ER_THREAD_RUNNING;
+    }
+
   init_msg_header (&send_msg_header);
 
   *(send_msg_header.msg_body_size_ptr) = size;
@@ -854,6 +861,64 @@ net_recv_msg (T_CON_HANDLE * con_handle, char **msg, int *msg_size, T_CCI_ERROR
   return net_recv_msg_timeout (con_handle, msg, msg_size, err_buf, 0);
 }
 
+/*
+ * net_msg_available - is (part of) a reply message ready to be read without
+ *                     blocking?
+ *   return: 1 if data is available, 0 if not, CCI_ER_COMMUNICATION on error
+ */
+int
+net_msg_available (T_CON_HANDLE * con_handle)
+{
+#if defined(WINDOWS)
+  fd_set rfds;
+  struct timeval tv;
+#else
+  struct pollfd po[1] = { {0, 0, 0} };
+#endif
+  int n;
+
+  if (IS_INVALID_SOCKET (con_handle->sock_fd))
+    {
+      return CCI_ER_COMMUNICATION;
+    }
+
+  if (con_handle->ssl_handle.is_connected == true && SSL_has_pending (con_handle->ssl_handle.ssl) > 0)
+    {
+      return 1;
+    }
+
+#if defined(WINDOWS)
+  FD_ZERO (&rfds);
+  FD_SET (con_handle->sock_fd, &rfds);
+  tv.tv_sec = 0;
+  tv.tv_usec = 0;
+
+  n = select (con_handle->sock_fd + 1, &rfds, NULL, NULL, &tv);
+#else
+  po[0].fd = con_handle->sock_fd;
+  po[0].events = POLLIN;
+
+  n = poll (po, 1, 0);
+#endif
+  if (n < 0)
+    {
+      if (errno == EINTR)
+	{
+	  return 0;
+	}
+
+      return CCI_ER_COMMUNICATION;
+    }
+#if !defined (WINDOWS)
+  if (po[0].revents & POLLERR || po[0].revents & POLLHUP)
+    {
+      return CCI_ER_COMMUNICATION;
+    }
+#endif /* !WINDOWS */
+
+  return (n > 0) ? 1 : 0;
+}
+
 bool
 net_peer_alive (unsigned char *ip_addr, int port, int timeout_msec)
 {
@@ -87,6 +87,7 @@ extern int net_send_msg (T_CON_HANDLE * con_handle, char *msg, int size);
 extern int net_recv_msg (T_CON_HANDLE * con_handle, char **msg, int *size, T_CCI_ERROR * err_buf);
 extern int net_recv_msg_timeout (T_CON_HANDLE * con_handle, char **msg, int *msg_size, T_CCI_ERROR * err_buf,
 				 int timeout);
+extern int net_msg_available (T_CON_HANDLE * con_handle);
 #if defined (ENABLE_UNUSED_FUNCTION)
 extern int net_send_file (SOCKET sock_fd, char *filename, int filesize);
 extern int net_recv_file (SOCKET sock_fd, int port, int file_size, int out_fd);
@@ -556,23 +556,35 @@ qe_bind_param (T_REQ_HANDLE * req_handle, int index, T_CCI_A_TYPE a_type, void *
 
 int
 qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size, T_CCI_ERROR * err_buf)
+{
+  int err_code;
+
+  err_code = qe_execute_send (req_handle, con_handle, flag, max_col_size, err_buf);
+  if (err_code < 0)
+    {
+      return err_code;
+    }
+
+  return qe_execute_receive (req_handle, con_handle, err_buf);
+}
+
+/*
+ * qe_execute_send - pack and send an execute request without waiting for its
+ *                   reply; the matching qe_execute_receive() consumes it
+ */
+int
+qe_execute_send (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size,
+		 T_CCI_ERROR * err_buf)
 {
   T_NET_BUF net_buf;
   char func_code = CAS_FC_EXECUTE;
   char autocommit_flag;
   int i;
   int err_code = 0;
-  int res_count;
-  char *result_msg = NULL, *msg;
-  int result_msg_size;
-  T_CCI_QUERY_RESULT *qr = NULL;
   char fetch_flag;
   char forward_only_cursor;
-  char include_column_info;
-  int remain_msg_size = 0;
   int remaining_time = 0;
   bool use_server_query_cancel = false;
-  int shard_id;
   T_BROKER_VERSION broker_ver;
 
   req_handle->is_fetch_completed = 0;
@@ -668,9 +680,36 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
 
   net_buf_clear (&net_buf);
 
-  res_count =
-    net_recv_msg_timeout (con_handle, &result_msg, &result_msg_size, err_buf,
-			  ((use_server_query_cancel) ? 0 : remaining_time));
+  req_handle->exec_flag_pending = flag;
+  req_handle->exec_recv_timeout = (use_server_query_cancel) ? 0 : remaining_time;
+
+  return CCI_ER_NO_ERROR;
+
+execute_error:
+  net_buf_clear (&net_buf);
+  return err_code;
+}
+
+/*
+ * qe_execute_receive - receive and decode the reply of an execute request
+ *                      sent with qe_execute_send()
+ */
+int
+qe_execute_receive (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, T_CCI_ERROR * err_buf)
+{
+  int err_code = 0;
+  int res_count;
+  char *result_msg = NULL, *msg;
+  int result_msg_size;
+  T_CCI_QUERY_RESULT *qr = NULL;
+  char include_column_info;
+  int remain_msg_size = 0;
+  int shard_id;
+  T_BROKER_VERSION broker_ver;
+
+  broker_ver = hm_get_broker_version (con_handle);
+
+  res_count = net_recv_msg_timeout (con_handle, &result_msg, &result_msg_size, err_buf, req_handle->exec_recv_timeout);
 
   if (res_count < 0)
     {
@@ -714,7 +753,7 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
       req_handle->num_tuple = -1;
     }
 
-  req_handle->execute_flag = flag;
+  req_handle->execute_flag = req_handle->exec_flag_pending;
 
   hm_req_handle_fetch_buf_free (req_handle);
   req_handle->cursor_pos = 0;
@@ -776,10 +815,6 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
   req_handle->is_from_current_transaction = 1;
 
   return res_count;
-
-execute_error:
-  net_buf_clear (&net_buf);
-  return err_code;
 }
 
 int
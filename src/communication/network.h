@@ -40,6 +40,10 @@
 
 #define EXECUTE_QUERY_MAX_ARGUMENT_DATA_SIZE  512
 
+/* Maximum number of simple requests that may be pipelined into a single
+   NET_SERVER_REQUEST_BATCH round trip.  Both sides must agree on it. */
+#define NET_REQUEST_BATCH_MAX 8
+
 /* These define the requests that the server will respond to */
 enum net_server_request
 {
@@ -158,6 +162,7 @@ enum net_server_request
 
   NET_SERVER_QM_QUERY_PREPARE,
   NET_SERVER_QM_QUERY_EXECUTE,
+  NET_SERVER_QM_QUERY_EXECUTE_ARRAY,
   NET_SERVER_QM_QUERY_PREPARE_AND_EXECUTE,
   NET_SERVER_QM_QUERY_END,
   NET_SERVER_QM_QUERY_DROP_ALL_PLANS,
@@ -261,6 +266,12 @@ enum net_server_request
   NET_SERVER_CDC_GET_LOGINFO,
   NET_SERVER_CDC_END_SESSION,
 
+  /* envelope carrying a pipelined batch of simple requests */
+  NET_SERVER_REQUEST_BATCH,
+
+  /* schema and authorization generation counters for the client caches */
+  NET_SERVER_LC_CACHE_GENERATIONS,
+
   /*
    * This is the last entry. It is also used for the end of an
    * array of statistics information on client/server communication.
@@ -281,6 +292,7 @@ enum net_server_request
 #define NET_CAP_HA_REPL_DELAY           0x00000008
 #define NET_CAP_HA_REPLICA              0x00000004
 #define NET_CAP_HA_IGNORE_REPL_DELAY	0x00000002
+#define NET_CAP_RESULT_COMPRESSION      0x00000040
 
 typedef enum
 {				/* Responses to a query */
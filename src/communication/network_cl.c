@@ -108,6 +108,32 @@ static char net_Server_host[CUB_MAXHOSTNAMELEN + 1] = "";
 /* Contains the name of the current server name. */
 static char net_Server_name[DB_MAX_IDENTIFIER_LENGTH + 1] = "";
 
+/*
+ * Pipelined request batch.  Simple requests (small argument buffer in, one
+ * fixed size reply out, no large data buffers and no callbacks) can be
+ * queued between net_client_request_batch_begin() and
+ * net_client_request_batch_flush() and are then sent to the server as a
+ * single NET_SERVER_REQUEST_BATCH envelope.  The server executes the
+ * entries in order and streams one reply per entry back on the envelope's
+ * request id, so a sequence of N requests costs one round trip instead
+ * of N.
+ */
+struct net_batch_entry
+{
+  int request;
+  char *argbuf;			/* private copy of the argument buffer */
+  int argsize;
+  char *replybuf;
+  int replysize;
+};
+static struct net_batch_entry net_Batch_entries[NET_REQUEST_BATCH_MAX];
+static int net_Batch_count = 0;
+static bool net_Batch_active = false;
+
+/* true when both sides of the connection negotiated LZ4 compression of
+ * query result pages during the handshake */
+static bool net_Server_result_compression = false;
+
 static void return_error_to_server (char *host, unsigned int eid);
 static int client_capabilities (void);
 static int check_server_capabilities (int server_cap, int client_type, int rel_compare,
@@ -118,6 +144,8 @@ static int compare_size_and_buffer (int *replysize, int size, char **replybuf, c
 				    const int line);
 static int net_client_request_internal (int request, char *argbuf, int argsize, char *replybuf, int replysize,
 					char *databuf, int datasize, char *replydata, int replydatasize);
+static int net_client_request_batch_send (void);
+static void net_client_request_batch_clear (void);
 static int set_server_error (int error);
 
 static void net_histo_setup_names (void);
@@ -242,6 +270,11 @@ client_capabilities (void)
       capabilities |= NET_CAP_HA_IGNORE_REPL_DELAY;
     }
 
+  if (prm_get_bool_value (PRM_ID_NET_RESULT_COMPRESSION))
+    {
+      capabilities |= NET_CAP_RESULT_COMPRESSION;
+    }
+
   return capabilities;
 }
 
@@ -584,6 +617,7 @@ net_histo_setup_names (void)
 
   net_Req_buffer[NET_SERVER_QM_QUERY_PREPARE].name = "NET_SERVER_QM_QUERY_PREPARE";
   net_Req_buffer[NET_SERVER_QM_QUERY_EXECUTE].name = "NET_SERVER_QM_QUERY_EXECUTE";
+  net_Req_buffer[NET_SERVER_QM_QUERY_EXECUTE_ARRAY].name = "NET_SERVER_QM_QUERY_EXECUTE_ARRAY";
   net_Req_buffer[NET_SERVER_QM_QUERY_PREPARE_AND_EXECUTE].name = "NET_SERVER_QM_QUERY_PREPARE_AND_EXECUTE";
   net_Req_buffer[NET_SERVER_QM_QUERY_END].name = "NET_SERVER_QM_QUERY_END";
   net_Req_buffer[NET_SERVER_QM_QUERY_DROP_ALL_PLANS].name = "NET_SERVER_QM_QUERY_DROP_ALL_PLANS";
@@ -665,6 +699,8 @@ net_histo_setup_names (void)
   net_Req_buffer[NET_SERVER_CDC_GET_LOGINFO_METADATA].name = "NET_SERVER_CDC_GET_LOGINFO_METADATA";
   net_Req_buffer[NET_SERVER_CDC_GET_LOGINFO].name = "NET_SERVER_CDC_GET_LOGINFO";
   net_Req_buffer[NET_SERVER_CDC_END_SESSION].name = "NET_SERVER_CDC_END_SESSION";
+
+  net_Req_buffer[NET_SERVER_REQUEST_BATCH].name = "NET_SERVER_REQUEST_BATCH";
 }
 
 /*
@@ -1069,6 +1105,252 @@ net_client_request (int request, char *argbuf, int argsize, char *replybuf, int
 				       replydatasize));
 }
 
+/*
+ * net_client_request_batch_clear - release the queued entries of the
+ *                                  current batch
+ *
+ * return: nothing
+ */
+static void
+net_client_request_batch_clear (void)
+{
+  int i;
+
+  for (i = 0; i < net_Batch_count; i++)
+    {
+      if (net_Batch_entries[i].argbuf != NULL)
+	{
+	  free_and_init (net_Batch_entries[i].argbuf);
+	}
+    }
+  net_Batch_count = 0;
+}
+
+/*
+ * net_client_request_batch_send - send the queued entries as one
+ *                                 NET_SERVER_REQUEST_BATCH envelope and
+ *                                 receive their replies in order
+ *
+ * return: error status
+ *
+ * Note: The envelope holds, for each entry, the request constant, the
+ *       original argument size and the argument stream.  The server runs
+ *       the entries in order and each one sends its usual reply on the
+ *       envelope's request id, so the replies are received back in queue
+ *       order.  The batch stays active; the caller is responsible for the
+ *       begin/flush bracket.
+ */
+static int
+net_client_request_batch_send (void)
+{
+  struct net_batch_entry *entry;
+  unsigned int rc;
+  int i, size, error, envelope_size;
+  char *envelope, *ptr, *start_ptr, *reply;
+
+  if (net_Batch_count == 0)
+    {
+      return NO_ERROR;
+    }
+
+  if (net_Server_name[0] == '\0')
+    {
+      /* need to have a more appropriate "unexpected disconnect" message */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_CRASHED, 0);
+      net_client_request_batch_clear ();
+      return -1;
+    }
+
+  if (net_Batch_count == 1)
+    {
+      /* a batch of one gains nothing from the envelope */
+      entry = &net_Batch_entries[0];
+      error = net_client_request_internal (entry->request, entry->argbuf, entry->argsize, entry->replybuf,
+					   entry->replysize, NULL, 0, NULL, 0);
+      net_client_request_batch_clear ();
+      return error;
+    }
+
+  envelope_size = OR_INT_SIZE;
+  for (i = 0; i < net_Batch_count; i++)
+    {
+      envelope_size += OR_INT_SIZE + OR_INT_SIZE + or_packed_stream_length (net_Batch_entries[i].argsize);
+    }
+
+  envelope = (char *) malloc (envelope_size + MAX_ALIGNMENT);
+  if (envelope == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) envelope_size);
+      net_client_request_batch_clear ();
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  ptr = start_ptr = PTR_ALIGN (envelope, MAX_ALIGNMENT);
+  ptr = or_pack_int (ptr, net_Batch_count);
+  for (i = 0; i < net_Batch_count; i++)
+    {
+      entry = &net_Batch_entries[i];
+      ptr = or_pack_int (ptr, entry->request);
+      ptr = or_pack_int (ptr, entry->argsize);
+      ptr = or_pack_stream (ptr, entry->argbuf, entry->argsize);
+#if defined(HISTO)
+      if (net_Histo_setup)
+	{
+	  net_histo_add_entry (entry->request, entry->argsize);
+	}
+#endif /* HISTO */
+    }
+  envelope_size = CAST_BUFLEN (ptr - start_ptr);
+
+  rc = css_send_req_to_server (net_Server_host, NET_SERVER_REQUEST_BATCH, start_ptr, envelope_size, NULL, 0,
+			       net_Batch_entries[0].replybuf, net_Batch_entries[0].replysize);
+  free_and_init (envelope);
+  if (rc == 0)
+    {
+      error = css_Errno;
+      net_client_request_batch_clear ();
+      return set_server_error (error);
+    }
+
+  for (i = 1; i < net_Batch_count; i++)
+    {
+      css_queue_receive_data_buffer (rc, net_Batch_entries[i].replybuf, net_Batch_entries[i].replysize);
+    }
+
+  for (i = 0; i < net_Batch_count; i++)
+    {
+      entry = &net_Batch_entries[i];
+      error = css_receive_data_from_server (rc, &reply, &size);
+      if (error != NO_ERROR)
+	{
+	  COMPARE_AND_FREE_BUFFER (entry->replybuf, reply);
+	  net_client_request_batch_clear ();
+	  return set_server_error (error);
+	}
+      error = COMPARE_SIZE_AND_BUFFER (&entry->replysize, size, &entry->replybuf, reply);
+      if (error != NO_ERROR)
+	{
+	  net_client_request_batch_clear ();
+	  return error;
+	}
+#if defined(HISTO)
+      if (net_Histo_setup)
+	{
+	  net_histo_request_finished (entry->request, entry->replysize);
+	}
+#endif /* HISTO */
+    }
+
+  net_client_request_batch_clear ();
+  return NO_ERROR;
+}
+
+/*
+ * net_client_request_batch_begin - start queueing simple requests for a
+ *                                  pipelined batch
+ *
+ * return: error status
+ *
+ * Note: Must be paired with net_client_request_batch_flush().  Batches do
+ *       not nest.
+ */
+int
+net_client_request_batch_begin (void)
+{
+  assert (!net_Batch_active);
+
+  net_Batch_active = true;
+  net_Batch_count = 0;
+
+  return NO_ERROR;
+}
+
+/*
+ * net_client_request_batch_add - queue one simple request on the active
+ *                                batch
+ *
+ * return: error status
+ *
+ *   request(in): server request id
+ *   argbuf(in): argument buffer (small); copied, may be freed by the caller
+ *   argsize(in): byte size of argbuf
+ *   replybuf(in): reply argument buffer (small); must stay valid until the
+ *                 batch is flushed
+ *   replysize(in): size of reply argument buffer
+ *
+ * Note: Only requests that send a single small argument buffer and expect a
+ *       single fixed size reply may be queued; the server handler must send
+ *       exactly one reply.  When the queue is full the pending entries are
+ *       sent first, which preserves the request order.
+ */
+int
+net_client_request_batch_add (int request, char *argbuf, int argsize, char *replybuf, int replysize)
+{
+  struct net_batch_entry *entry;
+  int error;
+
+  assert (net_Batch_active);
+  if (!net_Batch_active)
+    {
+      return net_client_request_internal (request, argbuf, argsize, replybuf, replysize, NULL, 0, NULL, 0);
+    }
+
+  if (net_Batch_count >= NET_REQUEST_BATCH_MAX)
+    {
+      error = net_client_request_batch_send ();
+      if (error != NO_ERROR)
+	{
+	  net_Batch_active = false;
+	  return error;
+	}
+    }
+
+  entry = &net_Batch_entries[net_Batch_count];
+  entry->request = request;
+  entry->argsize = argsize;
+  entry->replybuf = replybuf;
+  entry->replysize = replysize;
+  entry->argbuf = NULL;
+  if (argbuf != NULL && argsize > 0)
+    {
+      entry->argbuf = (char *) malloc (argsize);
+      if (entry->argbuf == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) argsize);
+	  net_client_request_batch_clear ();
+	  net_Batch_active = false;
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      memcpy (entry->argbuf, argbuf, argsize);
+    }
+  net_Batch_count++;
+
+  return NO_ERROR;
+}
+
+/*
+ * net_client_request_batch_flush - send the queued requests and receive
+ *                                  their replies, then end the batch
+ *
+ * return: error status
+ */
+int
+net_client_request_batch_flush (void)
+{
+  int error;
+
+  assert (net_Batch_active);
+  if (!net_Batch_active)
+    {
+      return NO_ERROR;
+    }
+
+  error = net_client_request_batch_send ();
+  net_Batch_active = false;
+
+  return error;
+}
+
 #if defined(ENABLE_UNUSED_FUNCTION)
 /*
  * net_client_request_send_large_data -
@@ -3898,9 +4180,25 @@ net_client_ping_server_with_handshake (int client_type, bool check_capabilities,
       return error;
     }
 
+  /* optional capability: result compression is used only when both sides asked for it */
+  net_Server_result_compression = ((client_capabilities () & NET_CAP_RESULT_COMPRESSION) != 0
+				   && (server_capabilities & NET_CAP_RESULT_COMPRESSION) != 0);
+
   return error;
 }
 
+/*
+ * net_client_result_compression_enabled - did the handshake negotiate LZ4
+ *                                         compression of query result pages?
+ *
+ * return: true when the server sends result pages compressed
+ */
+bool
+net_client_result_compression_enabled (void)
+{
+  return net_Server_result_compression;
+}
+
 #if defined(ENABLE_UNUSED_FUNCTION)
 /*
  * net_client_shutdown_server -
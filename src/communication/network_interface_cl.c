@@ -71,6 +71,8 @@
 #include "xasl.h"
 #include "lob_locator.hpp"
 #include "crypt_opfunc.h"
+
+#include "lz4.h"
 /*
  * Use db_clear_private_heap instead of db_destroy_private_heap
  */
@@ -2418,6 +2420,81 @@ log_reset_isolation (TRAN_ISOLATION isolation)
 #endif /* !CS_MODE */
 }
 
+/*
+ * log_reset_isolation_and_wait_msecs -
+ *
+ * return:
+ *
+ *   isolation(in):
+ *   wait_msecs(in):    in milliseconds
+ *
+ * NOTE: Resets both transaction settings in a single pipelined server
+ *       round trip instead of one request per setting.
+ */
+int
+log_reset_isolation_and_wait_msecs (TRAN_ISOLATION isolation, int wait_msecs)
+{
+#if defined(CS_MODE)
+  int req_error, error_code = ER_NET_CLIENT_DATA_RECEIVE;
+  int wait = -1;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_iso_request;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_wait_request;
+  char *iso_request, *wait_request;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_iso_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_wait_reply;
+  char *iso_reply, *wait_reply;
+
+  iso_request = OR_ALIGNED_BUF_START (a_iso_request);
+  wait_request = OR_ALIGNED_BUF_START (a_wait_request);
+  iso_reply = OR_ALIGNED_BUF_START (a_iso_reply);
+  wait_reply = OR_ALIGNED_BUF_START (a_wait_reply);
+
+  (void) or_pack_int (iso_request, (int) isolation);
+  (void) or_pack_int (wait_request, wait_msecs);
+
+  (void) net_client_request_batch_begin ();
+  req_error =
+    net_client_request_batch_add (NET_SERVER_LOG_RESET_ISOLATION, iso_request, OR_ALIGNED_BUF_SIZE (a_iso_request),
+				  iso_reply, OR_ALIGNED_BUF_SIZE (a_iso_reply));
+  if (req_error == NO_ERROR)
+    {
+      req_error =
+	net_client_request_batch_add (NET_SERVER_LOG_RESET_WAIT_MSECS, wait_request,
+				      OR_ALIGNED_BUF_SIZE (a_wait_request), wait_reply,
+				      OR_ALIGNED_BUF_SIZE (a_wait_reply));
+      if (req_error == NO_ERROR)
+	{
+	  req_error = net_client_request_batch_flush ();
+	}
+    }
+  if (!req_error)
+    {
+      (void) or_unpack_int (iso_reply, &error_code);
+      (void) or_unpack_int (wait_reply, &wait);
+    }
+  else
+    {
+      error_code = req_error;
+    }
+
+  return error_code;
+#else /* CS_MODE */
+  int error_code = NO_ERROR;
+
+  THREAD_ENTRY *thread_p = enter_server ();
+
+  error_code = xlogtb_reset_isolation (thread_p, isolation);
+  if (error_code == NO_ERROR)
+    {
+      (void) xlogtb_reset_wait_msecs (thread_p, wait_msecs);
+    }
+
+  exit_server (*thread_p);
+
+  return error_code;
+#endif /* !CS_MODE */
+}
+
 /*
  * log_set_interrupt -
  *
@@ -6485,20 +6562,63 @@ qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *b
   char *request;
   OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
   char *reply;
+  char *recv_buffer = buffer;
+  char *scratch = NULL;
+  int recv_size;
+  int page_size;
 
   request = OR_ALIGNED_BUF_START (a_request);
   reply = OR_ALIGNED_BUF_START (a_reply);
 
+  if (net_client_result_compression_enabled ())
+    {
+      /* the server may send the page LZ4-compressed; receive into a scratch
+       * buffer so the caller's buffer can hold the decompressed page */
+      scratch = (char *) malloc (*buffer_size);
+      if (scratch == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (*buffer_size));
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      recv_buffer = scratch;
+    }
+
   ptr = or_pack_ptr (request, query_id);
   ptr = or_pack_int (ptr, (int) volid);
   ptr = or_pack_int (ptr, (int) pageid);
 
+  recv_size = *buffer_size;
   req_error =
     net_client_request2_no_malloc (NET_SERVER_LS_GET_LIST_FILE_PAGE, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
-				   OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, buffer, buffer_size);
+				   OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, recv_buffer, &recv_size);
   if (!req_error)
     {
-      ptr = or_unpack_int (&reply[OR_INT_SIZE], &error);
+      ptr = or_unpack_int (reply, &page_size);
+      ptr = or_unpack_int (ptr, &error);
+      if (scratch != NULL && error == NO_ERROR)
+	{
+	  if (recv_size < page_size)
+	    {
+	      /* a payload smaller than the page itself is the compressed form */
+	      if (LZ4_decompress_safe (scratch, buffer, recv_size, page_size) != page_size)
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_DECOMPRESS_FAIL, 0);
+		  error = ER_IO_LZ4_DECOMPRESS_FAIL;
+		}
+	      recv_size = page_size;
+	    }
+	  else if (recv_size > 0)
+	    {
+	      /* the page did not compress; the server sent it raw */
+	      memcpy (buffer, scratch, recv_size);
+	    }
+	}
+      *buffer_size = recv_size;
+    }
+
+  if (scratch != NULL)
+    {
+      free_and_init (scratch);
     }
 
   return error;
@@ -6948,6 +7068,230 @@ cleanup:
 #endif /* !CS_MODE */
 }
 
+/*
+ * qmgr_execute_query_array - Execute a prepared query once per host variable tuple
+ *
+ * return: the number of executed rows, or a negative error code
+ *
+ *   xasl_id(in): XASL file id that was a result of prepare_query()
+ *   dbval_cnt(in): number of host variables per row
+ *   n_rows(in): number of host variable tuples
+ *   dbvals(in): host variable tuples, row major (n_rows * dbval_cnt values)
+ *   flag(in): query flag; committing per execution is not supported
+ *   query_timeout(in): query timeout in millisec, applied per row
+ *   row_statuses(out): per-row result; the number of affected rows, or a negative error code
+ *
+ * NOTE: One request carries every tuple of the batch; the server runs the cached XASL once per tuple, ends each
+ * query and returns only the statuses. Meant for DML batches where no result list file is fetched.
+ */
+int
+qmgr_execute_query_array (const XASL_ID * xasl_id, int dbval_cnt, int n_rows, const DB_VALUE * dbvals,
+			  QUERY_FLAG flag, int query_timeout, int *row_statuses)
+{
+#if defined(CS_MODE)
+  int req_error, request_size, senddata_size, size_table_size, row_size;
+  int replydata_size = 0, n_executed = 0;
+  char *senddata = NULL, *replydata = NULL;
+  char *ptr, *size_ptr, *row_start;
+  OR_ALIGNED_BUF (OR_XASL_ID_SIZE + OR_INT_SIZE * 5) a_request;
+  char *request;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  char *reply;
+  const DB_VALUE *dbval;
+  int i, j;
+
+  if (n_rows <= 0 || dbval_cnt < 0 || (dbval_cnt > 0 && dbvals == NULL) || row_statuses == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OBJ_INVALID_ARGUMENTS, 0);
+      return ER_OBJ_INVALID_ARGUMENTS;
+    }
+
+  request = OR_ALIGNED_BUF_START (a_request);
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  /* the send data carries a row size table followed by the packed parameter values of each row; every row is padded
+   * to an aligned size so that the server can hand each segment to the unpacking routine directly */
+  size_table_size = DB_ALIGN (n_rows * OR_INT_SIZE, MAX_ALIGNMENT);
+  senddata_size = size_table_size;
+  for (i = 0, dbval = dbvals; i < n_rows * dbval_cnt; i++, dbval++)
+    {
+      senddata_size += OR_VALUE_ALIGNED_SIZE ((DB_VALUE *) dbval);
+    }
+  senddata_size += n_rows * MAX_ALIGNMENT;	/* worst case row padding */
+
+  senddata = (char *) malloc (senddata_size);
+  if (senddata == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) senddata_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (senddata, 0, senddata_size);
+
+  size_ptr = senddata;
+  ptr = senddata + size_table_size;
+  for (i = 0; i < n_rows; i++)
+    {
+      row_start = ptr;
+      for (j = 0, dbval = dbvals + i * dbval_cnt; j < dbval_cnt; j++, dbval++)
+	{
+	  ptr = or_pack_db_value (ptr, (DB_VALUE *) dbval);
+	}
+      row_size = DB_ALIGN (CAST_BUFLEN (ptr - row_start), MAX_ALIGNMENT);
+      ptr = row_start + row_size;
+      size_ptr = or_pack_int (size_ptr, row_size);
+    }
+
+  /* change senddata_size as real packing size */
+  senddata_size = CAST_BUFLEN (ptr - senddata);
+
+  /* pack XASL file id (XASL_ID), row shape, size of the send data, and query execution mode flag as a request data */
+  ptr = request;
+  OR_PACK_XASL_ID (ptr, xasl_id);
+  ptr = or_pack_int (ptr, dbval_cnt);
+  ptr = or_pack_int (ptr, n_rows);
+  ptr = or_pack_int (ptr, senddata_size);
+  ptr = or_pack_int (ptr, flag);
+  ptr = or_pack_int (ptr, query_timeout);
+  request_size = OR_XASL_ID_SIZE + OR_INT_SIZE * 5;
+
+  req_error = net_client_request2 (NET_SERVER_QM_QUERY_EXECUTE_ARRAY, request, request_size, reply,
+				   OR_ALIGNED_BUF_SIZE (a_reply), senddata, senddata_size, &replydata,
+				   &replydata_size);
+  free_and_init (senddata);
+
+  if (req_error)
+    {
+      return ER_FAILED;
+    }
+
+  /* the first reply argument is the length of the status data, the second is the number of executed rows */
+  ptr = or_unpack_int (reply, &replydata_size);
+  ptr = or_unpack_int (ptr, &n_executed);
+
+  if (replydata != NULL)
+    {
+      ptr = replydata;
+      for (i = 0; i < n_rows && (i + 1) * (int) OR_INT_SIZE <= replydata_size; i++)
+	{
+	  ptr = or_unpack_int (ptr, &row_statuses[i]);
+	}
+      free_and_init (replydata);
+    }
+
+  return n_executed;
+#else /* CS_MODE */
+  QFILE_LIST_ID *list_id;
+  QUERY_ID query_id;
+  QUERY_FLAG row_flag;
+  CACHE_TIME clt_cache_time;
+  CACHE_TIME srv_cache_time;
+  DB_VALUE *server_db_values = NULL;
+  OID *oid;
+  int i, j, status;
+  int n_executed = ER_FAILED;
+
+  THREAD_ENTRY *thread_p = enter_server ();
+
+  if (n_rows <= 0 || dbval_cnt < 0 || (dbval_cnt > 0 && dbvals == NULL) || row_statuses == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OBJ_INVALID_ARGUMENTS, 0);
+      n_executed = ER_OBJ_INVALID_ARGUMENTS;
+      goto cleanup;
+    }
+
+  if (dbval_cnt > 0)
+    {
+      server_db_values = (DB_VALUE *) db_private_alloc (thread_p, dbval_cnt * sizeof (DB_VALUE));
+      if (server_db_values == NULL)
+	{
+	  goto cleanup;
+	}
+      for (j = 0; j < dbval_cnt; j++)
+	{
+	  db_make_null (&server_db_values[j]);
+	}
+    }
+
+  for (i = 0; i < n_rows; i++)
+    {
+      const DB_VALUE *row_values = dbvals + i * dbval_cnt;
+
+      /* reallocate dbvals to use server allocation */
+      for (j = 0; j < dbval_cnt; j++)
+	{
+	  switch (DB_VALUE_TYPE (&row_values[j]))
+	    {
+	    case DB_TYPE_OBJECT:
+	      /* server cannot handle objects, convert to OID instead */
+	      oid = ws_identifier (db_get_object (&row_values[j]));
+	      if (oid != NULL)
+		{
+		  db_make_oid (&server_db_values[j], oid);
+		}
+	      break;
+
+	    default:
+	      /* Clone value */
+	      if (db_value_clone ((DB_VALUE *) (&row_values[j]), &server_db_values[j]) != NO_ERROR)
+		{
+		  goto cleanup;
+		}
+	      break;
+	    }
+	}
+
+      query_id = NULL_QUERY_ID;
+      row_flag = flag;
+      CACHE_TIME_RESET (&clt_cache_time);
+      CACHE_TIME_RESET (&srv_cache_time);
+
+      /* call the server routine of query execute */
+      list_id = xqmgr_execute_query (thread_p, xasl_id, &query_id, dbval_cnt, server_db_values, &row_flag,
+				     &clt_cache_time, &srv_cache_time, query_timeout, NULL);
+      if (list_id != NULL)
+	{
+	  status = list_id->tuple_cnt;
+	  if (query_id != NULL_QUERY_ID)
+	    {
+	      (void) xqmgr_end_query (thread_p, query_id);
+	    }
+	  QFILE_FREE_AND_INIT_LIST_ID (list_id);
+	}
+      else
+	{
+	  assert (er_errid () != NO_ERROR);
+	  status = er_errid ();
+	  if (status == NO_ERROR)
+	    {
+	      status = ER_FAILED;
+	    }
+	}
+      row_statuses[i] = status;
+
+      for (j = 0; j < dbval_cnt; j++)
+	{
+	  db_value_clear (&server_db_values[j]);
+	}
+    }
+
+  n_executed = n_rows;
+
+cleanup:
+  if (server_db_values != NULL)
+    {
+      for (j = 0; j < dbval_cnt; j++)
+	{
+	  db_value_clear (&server_db_values[j]);
+	}
+      db_private_free (thread_p, server_db_values);
+    }
+
+  exit_server (*thread_p);
+
+  return n_executed;
+#endif /* !CS_MODE */
+}
+
 /*
  * qmgr_prepare_and_execute_query -
  *
@@ -10359,6 +10703,48 @@ locator_demote_class_lock (const OID * class_oid, LOCK lock, LOCK * ex_lock)
 #endif /* !CS_MODE */
 }
 
+/*
+ * locator_get_cache_generations -
+ *
+ * return: error code
+ *
+ *   schema_generation(out): current schema generation counter of the server
+ *   authorization_generation(out): current authorization generation counter of the server
+ */
+int
+locator_get_cache_generations (INT64 * schema_generation, INT64 * authorization_generation)
+{
+#if defined(CS_MODE)
+  int req_error;
+  char *ptr;
+  OR_ALIGNED_BUF (OR_INT64_SIZE * 2) a_reply;
+  char *reply;
+
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  req_error = net_client_request (NET_SERVER_LC_CACHE_GENERATIONS, NULL, 0, reply, OR_ALIGNED_BUF_SIZE (a_reply),
+				  NULL, 0, NULL, 0);
+  if (req_error)
+    {
+      return ER_FAILED;
+    }
+
+  ptr = or_unpack_int64 (reply, schema_generation);
+  ptr = or_unpack_int64 (ptr, authorization_generation);
+
+  return NO_ERROR;
+#else /* CS_MODE */
+  THREAD_ENTRY *thread_p = enter_server ();
+
+  *schema_generation = xlocator_get_schema_generation (thread_p);
+  *authorization_generation = xlocator_get_authorization_generation (thread_p);
+
+  exit_server (*thread_p);
+
+  return NO_ERROR;
+#endif /* !CS_MODE */
+}
+
 int
 loaddb_init (cubload::load_args & args)
 {
@@ -136,6 +136,7 @@ extern char *disk_get_remarks (VOLID volid);
 extern char *disk_get_fullname (VOLID volid, char *vol_fullname);
 extern int log_reset_wait_msecs (int wait_msecs);
 extern int log_reset_isolation (TRAN_ISOLATION isolation);
+extern int log_reset_isolation_and_wait_msecs (TRAN_ISOLATION isolation, int wait_msecs);
 extern void log_set_interrupt (int set);
 extern int log_checkpoint (void);
 extern void log_dump_stat (FILE * outfp);
@@ -248,6 +249,8 @@ extern int qmgr_prepare_query (struct compile_context *context, xasl_stream * st
 extern QFILE_LIST_ID *qmgr_execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int dbval_cnt,
 					  const DB_VALUE * dbvals, QUERY_FLAG flag, CACHE_TIME * clt_cache_time,
 					  CACHE_TIME * srv_cache_time, int query_timeout);
+extern int qmgr_execute_query_array (const XASL_ID * xasl_id, int dbval_cnt, int n_rows, const DB_VALUE * dbvals,
+				     QUERY_FLAG flag, int query_timeout, int *row_statuses);
 extern QFILE_LIST_ID *qmgr_prepare_and_execute_query (char *xasl_stream, int xasl_stream_size, QUERY_ID * query_id,
 						      int dbval_cnt, DB_VALUE * dbval_ptr, QUERY_FLAG flag,
 						      int query_timeout);
@@ -310,6 +313,9 @@ extern void net_histo_clear (void);
 extern int net_client_request_no_reply (int request, char *argbuf, int argsize);
 extern int net_client_request (int request, char *argbuf, int argsize, char *replybuf, int replysize, char *databuf,
 			       int datasize, char *replydata, int replydatasize);
+extern int net_client_request_batch_begin (void);
+extern int net_client_request_batch_add (int request, char *argbuf, int argsize, char *replybuf, int replysize);
+extern int net_client_request_batch_flush (void);
 #if defined(ENABLE_UNUSED_FUNCTION)
 extern int net_client_request_send_large_data (int request, char *argbuf, int argsize, char *replybuf, int replysize,
 					       char *databuf, INT64 datasize, char *replydata, int replydatasize);
@@ -361,6 +367,7 @@ extern int net_client_request_recv_stream (int request, char *argbuf, int argsiz
 					   char *databuf, int datasize, FILE * outfp);
 extern int net_client_ping_server (int client_val, int *server_val, int timeout);
 extern int net_client_ping_server_with_handshake (int client_type, bool check_capabilities, int opt_cap);
+extern bool net_client_result_compression_enabled (void);
 
 /* Startup/Shutdown */
 #if defined(ENABLE_UNUSED_FUNCTION)
@@ -431,6 +438,7 @@ extern int log_does_active_user_exist (const char *user_name, bool * existed);
 extern int netcl_spacedb (SPACEDB_ALL * spaceall, SPACEDB_ONEVOL ** spacevols, SPACEDB_FILES * spacefiles);
 
 extern int locator_demote_class_lock (const OID * class_oid, LOCK lock, LOCK * ex_lock);
+extern int locator_get_cache_generations (INT64 * schema_generation, INT64 * authorization_generation);
 
 extern int loaddb_init (cubload::load_args & args);
 extern int loaddb_install_class (const cubload::batch & batch, bool & class_is_ignored, std::string & class_name);
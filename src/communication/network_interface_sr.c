@@ -85,6 +85,8 @@
 #include "transaction_transient.hpp"
 #include "crypt_opfunc.h"
 
+#include "lz4.h"
+
 #if defined (SUPPRESS_STRLEN_WARNING)
 #define strlen(s1)  ((int) strlen(s1))
 #endif /* defined (SUPPRESS_STRLEN_WARNING) */
@@ -122,6 +124,8 @@ static int server_capabilities (void);
 static int check_client_capabilities (THREAD_ENTRY * thread_p, int client_cap, int rel_compare,
 				      REL_COMPATIBILITY * compatibility, const char *client_host);
 static void sbtree_find_unique_internal (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
+static void sqfile_get_list_file_page_compressed (THREAD_ENTRY * thread_p, unsigned int rid, QUERY_ID query_id,
+						  int volid, int pageid);
 static int er_log_slow_query (THREAD_ENTRY * thread_p, EXECUTION_INFO * info, int time,
 			      UINT64 * diff_stats, char *queryinfo_string);
 static void event_log_slow_query (THREAD_ENTRY * thread_p, EXECUTION_INFO * info, int time, UINT64 * diff_stats);
@@ -436,6 +440,10 @@ server_capabilities (void)
       assert_release (css_ha_server_state () == HA_SERVER_STATE_STANDBY);
       capabilities |= NET_CAP_HA_REPLICA;
     }
+  if (prm_get_bool_value (PRM_ID_NET_RESULT_COMPRESSION))
+    {
+      capabilities |= NET_CAP_RESULT_COMPRESSION;
+    }
 
   return capabilities;
 }
@@ -497,6 +505,14 @@ check_client_capabilities (THREAD_ENTRY * thread_p, int client_cap, int rel_comp
 		    client_cap & NET_CAP_HA_IGNORE_REPL_DELAY);
     }
 
+  if ((client_cap & NET_CAP_RESULT_COMPRESSION) && (server_cap & NET_CAP_RESULT_COMPRESSION))
+    {
+      thread_p->conn_entry->compress_results = true;
+
+      er_log_debug (ARG_FILE_LINE, "NET_CAP_RESULT_COMPRESSION client %s %d\n", client_host,
+		    client_cap & NET_CAP_RESULT_COMPRESSION);
+    }
+
   return client_cap;
 }
 
@@ -4721,6 +4737,93 @@ sdk_vlabel (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen
     }
 }
 
+/*
+ * sqfile_get_list_file_page_compressed - fetch list file pages and send them
+ *                                        LZ4-compressed when that is smaller
+ *
+ * return:
+ *
+ *   rid(in):
+ *   query_id(in):
+ *   volid(in):
+ *   pageid(in):
+ *
+ * NOTE: Used when the connection negotiated NET_CAP_RESULT_COMPRESSION.  The
+ *       reply always carries the uncompressed page size; the client detects a
+ *       compressed payload because it is smaller than that size, so pages that
+ *       do not shrink are simply sent raw.
+ */
+static void
+sqfile_get_list_file_page_compressed (THREAD_ENTRY * thread_p, unsigned int rid, QUERY_ID query_id, int volid,
+				      int pageid)
+{
+  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+  char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_page_buf;
+  char *area = NULL, *aligned_area;
+  char *zip_area = NULL;
+  char *ptr;
+  int zip_bound, zip_size;
+  int page_size;
+  int error = NO_ERROR;
+
+  aligned_page_buf = PTR_ALIGN (page_buf, MAX_ALIGNMENT);
+
+  /* the transfer area holds several sequential pages; too large for the stack */
+  zip_bound = LZ4_compressBound (QFILE_PAGE_TRANSFER_SIZE);
+  area = (char *) db_private_alloc (thread_p, QFILE_PAGE_TRANSFER_SIZE + MAX_ALIGNMENT + zip_bound);
+  if (area == NULL)
+    {
+      (void) return_error_to_client (thread_p, rid);
+      error = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto empty_page;
+    }
+  aligned_area = PTR_ALIGN (area, MAX_ALIGNMENT);
+  zip_area = aligned_area + QFILE_PAGE_TRANSFER_SIZE;
+
+  error = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, aligned_area, &page_size);
+  if (error != NO_ERROR)
+    {
+      (void) return_error_to_client (thread_p, rid);
+      goto empty_page;
+    }
+
+  if (page_size == 0)
+    {
+      goto empty_page;
+    }
+
+  ptr = or_pack_int (reply, page_size);
+  ptr = or_pack_int (ptr, error);
+
+  zip_size = LZ4_compress_default (aligned_area, zip_area, page_size, zip_bound);
+  if (zip_size > 0 && zip_size < page_size)
+    {
+      css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), zip_area,
+					 zip_size);
+    }
+  else
+    {
+      /* incompressible page; the raw form is what the client expects then */
+      css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_area,
+					 page_size);
+    }
+  db_private_free_and_init (thread_p, area);
+  return;
+
+empty_page:
+  if (area != NULL)
+    {
+      db_private_free_and_init (thread_p, area);
+    }
+  qmgr_setup_empty_list_file (aligned_page_buf);
+  page_size = QFILE_PAGE_HEADER_SIZE;
+  ptr = or_pack_int (reply, page_size);
+  ptr = or_pack_int (ptr, error);
+  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
+				     page_size);
+}
+
 /*
  * sqfile_get_list_file_page -
  *
@@ -4741,8 +4844,13 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
   OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
   char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_page_buf;
+  QFILE_PAGE_FRAGMENT page_fragments[QFILE_PAGE_TRANSFER_NPAGES];
+  const char *fragments[QFILE_PAGE_TRANSFER_NPAGES];
+  int fragment_sizes[QFILE_PAGE_TRANSFER_NPAGES];
+  int num_fragments = 0;
   int page_size;
   int error = NO_ERROR;
+  int i;
 
   aligned_page_buf = PTR_ALIGN (page_buf, MAX_ALIGNMENT);
 
@@ -4755,22 +4863,38 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
       goto empty_page;
     }
 
-  error = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, aligned_page_buf, &page_size);
+  if (thread_p->conn_entry != NULL && thread_p->conn_entry->compress_results)
+    {
+      sqfile_get_list_file_page_compressed (thread_p, rid, query_id, volid, pageid);
+      return;
+    }
+
+  /* keep the pages fixed in the page buffer and gather them onto the wire without an assembly copy */
+  error = xqfile_get_list_file_page_fragments (thread_p, query_id, volid, pageid, page_fragments, &num_fragments,
+					       &page_size);
   if (error != NO_ERROR)
     {
       (void) return_error_to_client (thread_p, rid);
       goto empty_page;
     }
 
-  if (page_size == 0)
+  if (page_size == 0 || num_fragments == 0)
     {
+      xqfile_free_list_file_page_fragments (thread_p, page_fragments, num_fragments);
       goto empty_page;
     }
 
+  for (i = 0; i < num_fragments; i++)
+    {
+      fragments[i] = (const char *) page_fragments[i].page_p;
+      fragment_sizes[i] = page_fragments[i].size;
+    }
+
   ptr = or_pack_int (reply, page_size);
   ptr = or_pack_int (ptr, error);
-  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
-				     page_size);
+  css_send_reply_and_gathered_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply),
+					      fragments, fragment_sizes, num_fragments);
+  xqfile_free_list_file_page_fragments (thread_p, page_fragments, num_fragments);
   return;
 
 empty_page:
@@ -5502,6 +5626,153 @@ exit:
     }
 }
 
+/*
+ * sqmgr_execute_query_array - Process a NET_SERVER_QM_QUERY_EXECUTE_ARRAY request
+ *
+ * return:
+ *
+ *   thrd(in):
+ *   rid(in):
+ *   request(in):
+ *   reqlen(in):
+ *
+ * NOTE:
+ * Receive XASL file id and an array of host variable tuples, execute the cached XASL once per tuple and return the
+ * per-row statuses (number of affected rows, or a negative error code) in one reply. The result list files are ended
+ * and freed here; this entry is meant for DML batches where the client only needs the statuses.
+ * This function is a counter part to qmgr_execute_query_array().
+ */
+void
+sqmgr_execute_query_array (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  XASL_ID xasl_id;
+  QUERY_ID query_id;
+  QFILE_LIST_ID *list_id;
+  QUERY_FLAG query_flag, row_flag;
+  CACHE_TIME clt_cache_time;
+  CACHE_TIME srv_cache_time;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  char *reply, *ptr, *size_ptr, *row_ptr;
+  char *data = NULL, *replydata = NULL;
+  int dbval_cnt, n_rows, data_size, query_timeout;
+  int csserror, row_size, status, batch_error = NO_ERROR;
+  bool has_error = false;
+  int i;
+
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  /* unpack XASL file id (XASL_ID), number of parameter values per row, number of rows, size of the received data,
+   * and query execution mode flag from the request data */
+  ptr = request;
+  OR_UNPACK_XASL_ID (ptr, &xasl_id);
+  ptr = or_unpack_int (ptr, &dbval_cnt);
+  ptr = or_unpack_int (ptr, &n_rows);
+  ptr = or_unpack_int (ptr, &data_size);
+  ptr = or_unpack_int (ptr, &query_flag);
+  ptr = or_unpack_int (ptr, &query_timeout);
+
+  if (n_rows <= 0 || dbval_cnt < 0)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OBJ_INVALID_ARGUMENTS, 0);
+      css_send_abort_to_client (thread_p->conn_entry, rid);
+      return;
+    }
+
+  /* the batched reply carries no transaction state, so committing per execution is not supported here */
+  query_flag &= ~EXECUTE_QUERY_WITH_COMMIT;
+  query_flag &= ~EXECUTE_QUERY_WITHOUT_DATA_BUFFERS;
+
+  xsession_set_tran_auto_commit (thread_p, IS_TRAN_AUTO_COMMIT (query_flag));
+
+  /* receive the row size table and the packed parameter values of all rows from the client */
+  csserror = css_receive_data_from_client (thread_p->conn_entry, rid, &data, &data_size);
+  if (csserror || data == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+      css_send_abort_to_client (thread_p->conn_entry, rid);
+      if (data)
+	{
+	  free_and_init (data);
+	}
+      return;
+    }
+
+  replydata = (char *) malloc (n_rows * OR_INT_SIZE);
+  if (replydata == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (n_rows * OR_INT_SIZE));
+      css_send_abort_to_client (thread_p->conn_entry, rid);
+      free_and_init (data);
+      return;
+    }
+
+  /* the rows start after the size table; every row was packed at an aligned offset so each segment can be handed to
+   * the unpacking routine directly */
+  size_ptr = data;
+  row_ptr = data + DB_ALIGN (n_rows * OR_INT_SIZE, MAX_ALIGNMENT);
+
+  ptr = replydata;
+  for (i = 0; i < n_rows; i++)
+    {
+      size_ptr = or_unpack_int (size_ptr, &row_size);
+
+      if (batch_error != NO_ERROR)
+	{
+	  /* the transaction is no longer usable; mark the remaining rows with the same error */
+	  status = batch_error;
+	}
+      else
+	{
+	  query_id = NULL_QUERY_ID;
+	  row_flag = query_flag;
+	  CACHE_TIME_RESET (&clt_cache_time);
+	  CACHE_TIME_RESET (&srv_cache_time);
+
+	  list_id = xqmgr_execute_query (thread_p, &xasl_id, &query_id, dbval_cnt, dbval_cnt > 0 ? row_ptr : NULL,
+					 &row_flag, &clt_cache_time, &srv_cache_time, query_timeout, NULL);
+	  if (list_id != NULL)
+	    {
+	      status = list_id->tuple_cnt;
+	      if (query_id != NULL_QUERY_ID)
+		{
+		  (void) xqmgr_end_query (thread_p, query_id);
+		}
+	      QFILE_FREE_AND_INIT_LIST_ID (list_id);
+	    }
+	  else
+	    {
+	      ASSERT_ERROR_AND_SET (status);
+	      if (status == NO_ERROR)
+		{
+		  status = ER_FAILED;
+		}
+	      has_error = true;
+	      if (need_to_abort_tran (thread_p, &status))
+		{
+		  batch_error = status;
+		}
+	    }
+	}
+
+      ptr = or_pack_int (ptr, status);
+      row_ptr += row_size;
+    }
+
+  if (has_error)
+    {
+      (void) return_error_to_client (thread_p, rid);
+    }
+
+  ptr = or_pack_int (reply, n_rows * OR_INT_SIZE);
+  ptr = or_pack_int (ptr, n_rows);
+
+  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), replydata,
+				     n_rows * OR_INT_SIZE);
+
+  free_and_init (replydata);
+  free_and_init (data);
+}
+
 /*
  * er_log_slow_query - log slow query to error log file
  * return:
@@ -10121,6 +10392,18 @@ slocator_demote_class_lock (THREAD_ENTRY * thread_p, unsigned int rid, char *req
   css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
 }
 
+void
+slocator_get_cache_generations (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  char *ptr;
+  OR_ALIGNED_BUF (OR_INT64_SIZE * 2) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+
+  ptr = or_pack_int64 (reply, xlocator_get_schema_generation (thread_p));
+  ptr = or_pack_int64 (ptr, xlocator_get_authorization_generation (thread_p));
+  css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
+}
+
 void
 sloaddb_init (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
 {
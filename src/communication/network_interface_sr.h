@@ -60,6 +60,7 @@ extern void slocator_delete_class_name (THREAD_ENTRY * thread_p, unsigned int ri
 extern void slocator_rename_class_name (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void slocator_assign_oid (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void slocator_demote_class_lock (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
+extern void slocator_get_cache_generations (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void sqst_server_get_statistics (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void slog_checkpoint (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 #if defined(ENABLE_UNUSED_FUNCTION)
@@ -135,6 +136,7 @@ extern void sdk_vlabel (THREAD_ENTRY * thread_p, unsigned int rid, char *request
 extern void sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_prepare_query (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_execute_query (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
+extern void sqmgr_execute_query_array (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_prepare_and_execute_query (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_end_query (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_drop_all_query_plans (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
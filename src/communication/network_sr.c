@@ -44,6 +44,7 @@
 #include "message_catalog.h"
 #include "network.h"
 #include "network_interface_sr.h"
+#include "object_representation.h"
 #include "perf_monitor.h"
 #include "query_list.h"
 #include "release_string.h"
@@ -89,6 +90,9 @@ static void net_server_histo_add_entry (int request, int data_sent);
 #endif /* CUBRID_DEBUG */
 
 static void net_server_init (void);
+static bool net_server_check_action_attribute (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn, unsigned int rid,
+					       int request);
+static void net_server_request_batch (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 static int net_server_request (THREAD_ENTRY * thread_p, unsigned int rid, int request, int size, char *buffer);
 static int net_server_conn_down (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
 
@@ -602,6 +606,11 @@ net_server_init (void)
   req_p->processing_function = sqmgr_execute_query;
   req_p->name = "NET_SERVER_QM_QUERY_EXECUTE";
 
+  req_p = &net_Requests[NET_SERVER_QM_QUERY_EXECUTE_ARRAY];
+  req_p->action_attribute = (SET_DIAGNOSTICS_INFO | IN_TRANSACTION);
+  req_p->processing_function = sqmgr_execute_query_array;
+  req_p->name = "NET_SERVER_QM_QUERY_EXECUTE_ARRAY";
+
   req_p = &net_Requests[NET_SERVER_QM_QUERY_PREPARE_AND_EXECUTE];
   req_p->action_attribute = (SET_DIAGNOSTICS_INFO | IN_TRANSACTION);
   req_p->processing_function = sqmgr_prepare_and_execute_query;
@@ -935,6 +944,15 @@ net_server_init (void)
   req_p = &net_Requests[NET_SERVER_CDC_END_SESSION];
   req_p->processing_function = scdc_end_session;
   req_p->name = "NET_SERVER_CDC_END_SESSION";
+
+  /* pipelined batch of simple requests */
+  req_p = &net_Requests[NET_SERVER_REQUEST_BATCH];
+  req_p->processing_function = net_server_request_batch;
+  req_p->name = "NET_SERVER_REQUEST_BATCH";
+
+  req_p = &net_Requests[NET_SERVER_LC_CACHE_GENERATIONS];
+  req_p->processing_function = slocator_get_cache_generations;
+  req_p->name = "NET_SERVER_LC_CACHE_GENERATIONS";
 }
 
 #if defined(CUBRID_DEBUG)
@@ -1001,6 +1019,198 @@ net_server_histo_add_entry (int request, int data_sent)
 }
 #endif /* CUBRID_DEBUG */
 
+/*
+ * net_server_check_action_attribute () - Checks the action attribute defined
+ *                                        for a request before it is processed
+ *   return: true if the request may be processed, false if the caller must
+ *           stop (the error reply has already been sent)
+ *   thread_p(in): this thread handle
+ *   conn(in): client connection
+ *   rid(in): CSS request id
+ *   request(in): request constant
+ */
+static bool
+net_server_check_action_attribute (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn, unsigned int rid, int request)
+{
+  int error_code;
+
+  if (net_Requests[request].action_attribute & CHECK_DB_MODIFICATION)
+    {
+      int client_type;
+      bool check = true;
+
+      if (request == NET_SERVER_TM_SERVER_COMMIT)
+	{
+	  if (!logtb_has_updated (thread_p))
+	    {
+	      check = false;
+	    }
+	}
+      /* check if DB modification is allowed */
+      client_type = logtb_find_client_type (thread_p->tran_index);
+      if (check)
+	{
+	  CHECK_MODIFICATION_NO_RETURN (thread_p, error_code);
+	  if (error_code != NO_ERROR)
+	    {
+	      er_log_debug (ARG_FILE_LINE, "net_server_request(): CHECK_DB_MODIFICATION error" " request %s\n",
+			    net_Requests[request].name);
+	      return_error_to_client (thread_p, rid);
+	      css_send_abort_to_client (conn, rid);
+	      return false;
+	    }
+	}
+    }
+  if (net_Requests[request].action_attribute & CHECK_AUTHORIZATION)
+    {
+      if (!logtb_am_i_dba_client (thread_p))
+	{
+	  er_log_debug (ARG_FILE_LINE, "net_server_request(): CHECK_AUTHORIZATION error" " request %s\n",
+			net_Requests[request].name);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_AU_DBA_ONLY, 1, "");
+	  return_error_to_client (thread_p, rid);
+	  css_send_abort_to_client (conn, rid);
+	  return false;
+	}
+    }
+  if (net_Requests[request].action_attribute & IN_TRANSACTION)
+    {
+      conn->in_transaction = true;
+    }
+
+  return true;
+}
+
+/*
+ * net_server_request_batch () - Processing function for
+ *                               NET_SERVER_REQUEST_BATCH
+ *   return: nothing
+ *   thread_p(in): this thread handle
+ *   rid(in): CSS request id
+ *   request(in): envelope argument buffer
+ *   reqlen(in): size of envelope argument buffer
+ *
+ * Note: The envelope holds a count followed by, for each entry, the request
+ *       constant, the original argument size and the argument stream.  The
+ *       entries are executed in order with the same checks the dispatcher
+ *       applies, and each processing function sends its usual reply on the
+ *       envelope's request id, so the client receives the replies in queue
+ *       order within a single round trip.
+ */
+static void
+net_server_request_batch (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  net_server_func func;
+  CSS_CONN_ENTRY *conn;
+  char *ptr, *end_ptr, *sub_buffer;
+  int count, i, sub_request, sub_size, packed_size;
+
+  conn = thread_p->conn_entry;
+  assert (conn != NULL);
+
+  if (request == NULL || reqlen < OR_INT_SIZE)
+    {
+      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+      return_error_to_client (thread_p, rid);
+      return;
+    }
+
+  end_ptr = request + reqlen;
+  ptr = or_unpack_int (request, &count);
+  if (count <= 0 || count > NET_REQUEST_BATCH_MAX)
+    {
+      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+      return_error_to_client (thread_p, rid);
+      return;
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      if (ptr + 3 * OR_INT_SIZE > end_ptr)
+	{
+	  er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+	  return_error_to_client (thread_p, rid);
+	  return;
+	}
+      ptr = or_unpack_int (ptr, &sub_request);
+      ptr = or_unpack_int (ptr, &sub_size);
+      /* the stream was packed with or_pack_stream; point at it in place */
+      packed_size = OR_GET_INT (ptr);
+      ptr += OR_INT_SIZE;
+      if (packed_size < 0)
+	{
+	  packed_size = 0;
+	  sub_buffer = NULL;
+	}
+      else
+	{
+	  sub_buffer = ptr;
+	}
+      if (sub_size < 0 || sub_size > packed_size || ptr + packed_size > end_ptr || (sub_buffer == NULL && sub_size > 0))
+	{
+	  er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+	  return_error_to_client (thread_p, rid);
+	  return;
+	}
+      ptr += packed_size;
+
+      if (sub_request <= NET_SERVER_REQUEST_START || sub_request >= NET_SERVER_REQUEST_END
+	  || sub_request == NET_SERVER_REQUEST_BATCH || net_Requests[sub_request].processing_function == NULL)
+	{
+	  er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_NET_UNKNOWN_SERVER_REQ, 0);
+	  return_error_to_client (thread_p, rid);
+	  return;
+	}
+
+      /* check if the conn is still valid */
+      if (IS_INVALID_SOCKET (conn->fd) || conn->status != CONN_OPEN)
+	{
+	  /* have nothing to do because the client has gone */
+	  return;
+	}
+
+#if defined(CUBRID_DEBUG)
+      net_server_histo_add_entry (sub_request, sub_size);
+#endif /* CUBRID_DEBUG */
+
+      /* check the defined action attribute */
+      if (!net_server_check_action_attribute (thread_p, conn, rid, sub_request))
+	{
+	  return;
+	}
+
+      /* call the request processing function */
+      if (thread_p->tran_index > 0)
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_NET_NUM_REQUESTS);
+	}
+      func = net_Requests[sub_request].processing_function;
+      if (prm_get_bool_value (PRM_ID_TRACK_REQUESTS))
+	{
+	  _er_log_debug (ARG_FILE_LINE, "net_server_request_batch(): request %s\n", net_Requests[sub_request].name);
+	}
+
+      thread_p->push_resource_tracks ();
+
+      if (conn->invalidate_snapshot != 0)
+	{
+	  logtb_invalidate_snapshot_data (thread_p);
+	}
+      (*func) (thread_p, rid, sub_buffer, sub_size);
+
+      thread_p->pop_resource_tracks ();
+
+      /* defence code: let other threads continue. */
+      pgbuf_unfix_all (thread_p);
+
+      /* check the defined action attribute */
+      if (net_Requests[sub_request].action_attribute & OUT_TRANSACTION)
+	{
+	  conn->in_transaction = false;
+	}
+    }
+}
+
 /*
  * net_server_request () - The main server request dispatch handler
  *   return: error status
@@ -1015,7 +1225,6 @@ net_server_request (THREAD_ENTRY * thread_p, unsigned int rid, int request, int
 {
   net_server_func func;
   int status = CSS_NO_ERRORS;
-  int error_code;
   CSS_CONN_ENTRY *conn;
 
   if (buffer == NULL && size > 0)
@@ -1059,48 +1268,9 @@ net_server_request (THREAD_ENTRY * thread_p, unsigned int rid, int request, int
     }
 
   /* check the defined action attribute */
-  if (net_Requests[request].action_attribute & CHECK_DB_MODIFICATION)
+  if (!net_server_check_action_attribute (thread_p, conn, rid, request))
     {
-      int client_type;
-      bool check = true;
-
-      if (request == NET_SERVER_TM_SERVER_COMMIT)
-	{
-	  if (!logtb_has_updated (thread_p))
-	    {
-	      check = false;
-	    }
-	}
-      /* check if DB modification is allowed */
-      client_type = logtb_find_client_type (thread_p->tran_index);
-      if (check)
-	{
-	  CHECK_MODIFICATION_NO_RETURN (thread_p, error_code);
-	  if (error_code != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE, "net_server_request(): CHECK_DB_MODIFICATION error" " request %s\n",
-			    net_Requests[request].name);
-	      return_error_to_client (thread_p, rid);
-	      css_send_abort_to_client (conn, rid);
-	      goto end;
-	    }
-	}
-    }
-  if (net_Requests[request].action_attribute & CHECK_AUTHORIZATION)
-    {
-      if (!logtb_am_i_dba_client (thread_p))
-	{
-	  er_log_debug (ARG_FILE_LINE, "net_server_request(): CHECK_AUTHORIZATION error" " request %s\n",
-			net_Requests[request].name);
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_AU_DBA_ONLY, 1, "");
-	  return_error_to_client (thread_p, rid);
-	  css_send_abort_to_client (conn, rid);
-	  goto end;
-	}
-    }
-  if (net_Requests[request].action_attribute & IN_TRANSACTION)
-    {
-      conn->in_transaction = true;
+      goto end;
     }
 
   /* call a request processing function */
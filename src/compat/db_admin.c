@@ -979,6 +979,7 @@ db_shutdown (void)
   db_Disable_modifications = 0;
 
   db_free_execution_plan ();
+  db_free_prepare_cache ();
 
   return (error);
 }
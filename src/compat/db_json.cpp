@@ -71,6 +71,8 @@
 #include <algorithm>
 #include <sstream>
 #include <stack>
+#include <string_view>
+#include <unordered_set>
 
 #define TODO_OPTIMIZE_JSON_BODY_STRING true
 
@@ -687,10 +689,16 @@ static void db_json_add_element_to_array (JSON_DOC *doc, const JSON_VALUE *value
 int
 JSON_DUPLICATE_KEYS_CHECKER::CallBefore (const JSON_VALUE &value)
 {
-  std::vector<const char *> inserted_keys;
+  if (!value.IsObject ())
+    {
+      return NO_ERROR;
+    }
 
-  if (value.IsObject ())
+  if (value.MemberCount () <= 8)
     {
+      // small objects: scanning a handful of keys beats hashing them
+      std::vector<const char *> inserted_keys;
+
       for (auto it = value.MemberBegin (); it != value.MemberEnd (); ++it)
 	{
 	  const char *current_key = it->name.GetString ();
@@ -707,6 +715,20 @@ JSON_DUPLICATE_KEYS_CHECKER::CallBefore (const JSON_VALUE &value)
 	  inserted_keys.push_back (current_key);
 	}
     }
+  else
+    {
+      // wide objects: the pairwise scan is quadratic in member count, hash the keys instead
+      std::unordered_set<std::string_view> inserted_keys;
+
+      for (auto it = value.MemberBegin (); it != value.MemberEnd (); ++it)
+	{
+	  if (!inserted_keys.emplace (it->name.GetString (), it->name.GetStringLength ()).second)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_JSON_DUPLICATE_KEY, 1, it->name.GetString ());
+	      return ER_JSON_DUPLICATE_KEY;
+	    }
+	}
+    }
 
   return NO_ERROR;
 }
@@ -3549,6 +3549,27 @@ db_query_prefetch_columns (DB_QUERY_RESULT * result, int *columns, int col_count
   return error;
 }
 
+/*
+ * db_query_prefetch_next_pages() - Fetch the next window of list file pages
+ *    from the server before the cursor needs them, so that the following
+ *    db_query_next_tuple() calls are served from the local cursor buffer.
+ * return : error code
+ * result(in/out): Pointer to the query result structure
+ */
+int
+db_query_prefetch_next_pages (DB_QUERY_RESULT * result)
+{
+  CHECK_CONNECT_ERROR ();
+  CHECK_1ARG_ERROR (result);
+
+  if (result->status == T_CLOSED || result->type != T_SELECT)
+    {
+      return NO_ERROR;
+    }
+
+  return cursor_prefetch_next_page_area (&result->res.s.cursor_id);
+}
+
 /*
  * db_query_plan_dump_file() -
  * return :
@@ -24,6 +24,14 @@
 #ifndef _DB_RAPIDJSON_HPP_
 #define _DB_RAPIDJSON_HPP_
 
+// let rapidjson scan for structural characters and skip whitespace with SIMD; that scan is the hot part of parsing
+// pretty-printed documents. SSE2 is part of the x86_64 base ISA, SSE4.2 is used when the build targets it explicitly.
+#if defined (__SSE4_2__) && !defined (RAPIDJSON_SSE42)
+#define RAPIDJSON_SSE42
+#elif (defined (x86_64) || defined (__x86_64__)) && !defined (RAPIDJSON_SSE2)
+#define RAPIDJSON_SSE2
+#endif
+
 // disable rapidjson compile warnings
 #if defined (__GNUC__)
 #pragma GCC system_header
@@ -71,6 +71,27 @@ enum
 static struct timeb base_server_timeb = { 0, 0, 0, 0 };
 static struct timeb base_client_timeb = { 0, 0, 0, 0 };
 
+/* Client-side cache of compiled sessions.  A session holding a single prepared SELECT is stashed here by
+ * db_close_session_local() instead of being freed, together with the schema version stamps it was compiled under.
+ * db_compile_statement_local() re-uses a stashed session for an identical statement as long as the stamps still
+ * match, skipping semantic analysis, view translation and XASL preparation entirely.  Validation follows the
+ * virtual query cache (see sm_virtual_queries): any local or global schema version bump invalidates the entry. */
+typedef struct db_prepare_cache_entry DB_PREPARE_CACHE_ENTRY;
+struct db_prepare_cache_entry
+{
+  const char *stmt_text;	/* fingerprint; points into the stashed session's parser */
+  unsigned int local_schema_id;	/* schema version stamps the statement was compiled under */
+  unsigned int global_schema_id;
+  MOP user;			/* user the statement was compiled as */
+  char include_oid;		/* oid setting the statement was compiled with */
+  DB_SESSION *session;		/* the stashed, fully prepared session */
+};
+
+#define DB_PREPARE_CACHE_SIZE	32
+
+static DB_PREPARE_CACHE_ENTRY db_Prepare_cache[DB_PREPARE_CACHE_SIZE];
+static int db_Prepare_cache_victim = 0;
+
 static int get_dimension_of (PT_NODE ** array);
 static DB_SESSION *db_open_local (void);
 static DB_SESSION *initialize_session (DB_SESSION * session);
@@ -93,6 +114,10 @@ static int do_process_deallocate_prepare (DB_SESSION * session, PT_NODE * statem
 static bool is_allowed_as_prepared_statement (PT_NODE * node);
 static bool is_allowed_as_prepared_statement_with_hv (PT_NODE * node);
 static bool db_check_limit_need_recompile (PARSER_CONTEXT * parser, PT_NODE * statement, int xasl_flag);
+static void db_prepare_cache_drop (DB_PREPARE_CACHE_ENTRY * entry);
+static DB_SESSION *db_prepare_cache_lookup (const char *fingerprint, char include_oid);
+static bool db_prepare_cache_reuse (DB_SESSION * session, PT_NODE * statement, int stmt_ndx);
+static bool db_prepare_cache_stash (DB_SESSION * session);
 
 static DB_CLASS_MODIFICATION_STATUS pt_has_modified_class (PARSER_CONTEXT * parser, PT_NODE * statement);
 static PT_NODE *pt_has_modified_class_helper (PARSER_CONTEXT * parser, PT_NODE * tree, void *arg, int *continue_walk);
@@ -177,6 +202,10 @@ db_open_local (void)
   session->statements = NULL;
   session->is_subsession_for_prepared = false;
   session->next = NULL;
+  session->stmt_fingerprint = NULL;
+  session->compile_local_schema_id = 0;
+  session->compile_global_schema_id = 0;
+  session->compile_user = NULL;
 
   return session;
 }
@@ -501,6 +530,234 @@ db_set_base_server_time (DB_VALUE * db_val)
   db_calculate_current_time (&base_client_timeb);
 }
 
+/*
+ * db_prepare_cache_drop() - release a prepare cache entry and the session it holds
+ * return : void
+ * entry(in): cache entry; may be empty
+ */
+static void
+db_prepare_cache_drop (DB_PREPARE_CACHE_ENTRY * entry)
+{
+  DB_SESSION *session = entry->session;
+
+  entry->session = NULL;
+  entry->stmt_text = NULL;
+
+  if (session != NULL)
+    {
+      /* clear the key so that db_close_session_local() does not stash the session again */
+      session->stmt_fingerprint = NULL;
+      db_close_session_local (session);
+    }
+}
+
+/*
+ * db_prepare_cache_lookup() - find a stashed session compiled from the same statement text under the current
+ *   schema and user.  Entries whose schema version stamps no longer match are dropped on the way.
+ * return : detached session if found, NULL otherwise
+ * fingerprint(in): canonical statement text
+ * include_oid(in): oid setting the statement is being compiled with
+ */
+static DB_SESSION *
+db_prepare_cache_lookup (const char *fingerprint, char include_oid)
+{
+  DB_PREPARE_CACHE_ENTRY *entry;
+  DB_SESSION *session;
+  int i;
+
+  for (i = 0; i < DB_PREPARE_CACHE_SIZE; i++)
+    {
+      entry = &db_Prepare_cache[i];
+      if (entry->session == NULL)
+	{
+	  continue;
+	}
+      if (entry->local_schema_id != sm_local_schema_version () || entry->global_schema_id != sm_global_schema_version ()
+	  || entry->user != Au_user)
+	{
+	  /* schema or user changed since the entry was compiled; the tree may be stale */
+	  db_prepare_cache_drop (entry);
+	  continue;
+	}
+      if (entry->include_oid == include_oid && strcmp (entry->stmt_text, fingerprint) == 0)
+	{
+	  session = entry->session;
+	  entry->session = NULL;
+	  entry->stmt_text = NULL;
+	  return session;
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * db_prepare_cache_reuse() - try to serve a compile request from the prepare cache.  The statement fingerprint and
+ *   the schema version stamps it is being compiled under are recorded in the session either way, so that
+ *   db_close_session_local() can stash the compiled session later.  On a hit the caller's session adopts the
+ *   stashed session's compiled contents and the freshly parsed duplicate is released in its place.
+ * return : true if the session was served from the cache and is ready for execution
+ * session(in/out): session being compiled
+ * statement(in): the (parsed, not yet compiled) statement
+ * stmt_ndx(in): index of the statement within the session
+ */
+static bool
+db_prepare_cache_reuse (DB_SESSION * session, PT_NODE * statement, int stmt_ndx)
+{
+  PARSER_CONTEXT *parser = session->parser;
+  DB_SESSION *cached;
+  DB_SESSION tmp;
+  const char *fingerprint;
+  unsigned int save_custom;
+  int line_offset, column_offset;
+  unsigned int is_holdable, is_xasl_pinned_reference, recompile_xasl_pinned, return_generated_keys;
+
+  /* print the statement before name resolution; host variables keep their :n markers, so statements differing only
+   * in parameter values share one fingerprint */
+  save_custom = parser->custom_print;
+  parser->custom_print |= (PT_CONVERT_RANGE | PT_PRINT_QUOTES | PT_PRINT_USER);
+  fingerprint = parser_print_tree (parser, statement);
+  parser->custom_print = save_custom;
+  if (fingerprint == NULL)
+    {
+      return false;
+    }
+
+  session->stmt_fingerprint = fingerprint;
+  session->compile_local_schema_id = sm_local_schema_version ();
+  session->compile_global_schema_id = sm_global_schema_version ();
+  session->compile_user = Au_user;
+
+  cached = db_prepare_cache_lookup (fingerprint, session->include_oid);
+  if (cached == NULL)
+    {
+      return false;
+    }
+
+  /* carry over settings made between db_open and db_compile; everything else comes from the stashed session */
+  line_offset = session->line_offset;
+  column_offset = session->column_offset;
+  is_holdable = parser->flag.is_holdable;
+  is_xasl_pinned_reference = parser->flag.is_xasl_pinned_reference;
+  recompile_xasl_pinned = parser->flag.recompile_xasl_pinned;
+  return_generated_keys = parser->flag.return_generated_keys;
+
+  /* swap the session contents so that the caller's handle stays valid, then free the fresh parse in its place */
+  tmp = *session;
+  *session = *cached;
+  *cached = tmp;
+  db_close_session_local (cached);
+
+  session->stmt_ndx = stmt_ndx + 1;
+  session->line_offset = line_offset;
+  session->column_offset = column_offset;
+  session->parser->flag.is_holdable = is_holdable;
+  session->parser->flag.is_xasl_pinned_reference = is_xasl_pinned_reference;
+  session->parser->flag.recompile_xasl_pinned = recompile_xasl_pinned;
+  session->parser->flag.return_generated_keys = return_generated_keys;
+
+  return true;
+}
+
+/*
+ * db_prepare_cache_stash() - stash a fully prepared single-SELECT session for later re-use instead of freeing it.
+ *   The session is rejected if the schema or the user changed after it was compiled.
+ * return : true if the session was stashed and must not be freed by the caller
+ * session(in): session being closed
+ */
+static bool
+db_prepare_cache_stash (DB_SESSION * session)
+{
+  DB_PREPARE_CACHE_ENTRY *entry = NULL;
+  PT_NODE *statement;
+  int i;
+
+  if (session->stmt_fingerprint == NULL || session->next != NULL || session->is_subsession_for_prepared
+      || session->dimension != 1 || session->stage == NULL || session->stage[0] < StatementPreparedStage
+      || session->statements == NULL)
+    {
+      return false;
+    }
+
+  statement = session->statements[0];
+  if (statement == NULL || statement->xasl_id == NULL || statement->flag.recompile || pt_has_error (session->parser))
+    {
+      return false;
+    }
+
+  if (session->compile_local_schema_id != sm_local_schema_version ()
+      || session->compile_global_schema_id != sm_global_schema_version () || session->compile_user != Au_user)
+    {
+      return false;
+    }
+
+  if (prm_get_integer_value (PRM_ID_XASL_CACHE_MAX_ENTRIES) <= 0)
+    {
+      return false;
+    }
+
+  /* prefer an empty slot; otherwise evict round-robin */
+  for (i = 0; i < DB_PREPARE_CACHE_SIZE; i++)
+    {
+      if (db_Prepare_cache[i].session == NULL)
+	{
+	  entry = &db_Prepare_cache[i];
+	  break;
+	}
+    }
+  if (entry == NULL)
+    {
+      entry = &db_Prepare_cache[db_Prepare_cache_victim];
+      db_Prepare_cache_victim = (db_Prepare_cache_victim + 1) % DB_PREPARE_CACHE_SIZE;
+      db_prepare_cache_drop (entry);
+    }
+
+  session->stmt_ndx = 0;
+  session->stage[0] = StatementPreparedStage;
+
+  entry->stmt_text = session->stmt_fingerprint;
+  entry->local_schema_id = session->compile_local_schema_id;
+  entry->global_schema_id = session->compile_global_schema_id;
+  entry->user = session->compile_user;
+  entry->include_oid = session->include_oid;
+  entry->session = session;
+
+  return true;
+}
+
+/*
+ * db_free_prepare_cache() - drop all stashed sessions; called at database shutdown since the stashed parse trees
+ *   reference workspace objects
+ * return : void
+ */
+void
+db_free_prepare_cache (void)
+{
+  int i;
+
+  for (i = 0; i < DB_PREPARE_CACHE_SIZE; i++)
+    {
+      db_prepare_cache_drop (&db_Prepare_cache[i]);
+    }
+}
+
+/*
+ * db_get_statement_fingerprint() - return the canonical statement text used as the prepare cache key, or NULL when
+ *   the session is not a cache candidate
+ * return : fingerprint text; owned by the session's parser
+ * session(in): compiled session
+ */
+const char *
+db_get_statement_fingerprint (DB_SESSION * session)
+{
+  if (session == NULL)
+    {
+      return NULL;
+    }
+
+  return session->stmt_fingerprint;
+}
+
 /*
  * db_compile_statement_local() -
  * return:
@@ -583,6 +840,16 @@ db_compile_statement_local (DB_SESSION * session)
 
   /* get type list describing the output columns titles of the given query */
   cmd_type = pt_node_to_cmd_type (statement);
+
+  /* an identical SELECT compiled by a previous session can skip semantic analysis, view translation and
+   * preparation entirely when the schema has not changed in the meantime; see db_prepare_cache_reuse() */
+  if (cmd_type == CUBRID_STMT_SELECT && session->dimension == 1 && !session->is_subsession_for_prepared
+      && statement->flag.recompile == 0 && prm_get_integer_value (PRM_ID_XASL_CACHE_MAX_ENTRIES) > 0
+      && db_prepare_cache_reuse (session, statement, stmt_ndx))
+    {
+      return stmt_ndx + 1;
+    }
+
   qtype = NULL;
   if (cmd_type == CUBRID_STMT_SELECT)
     {
@@ -3251,6 +3518,13 @@ db_close_session_local (DB_SESSION * session)
     {
       return;
     }
+
+  /* a fully prepared single-SELECT session is kept for re-use by a later compile of the same statement */
+  if (db_prepare_cache_stash (session))
+    {
+      return;
+    }
+
   prepared = session->next;
   while (prepared)
     {
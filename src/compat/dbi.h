@@ -556,6 +556,8 @@ extern "C"
 
   extern int db_query_prefetch_columns (DB_QUERY_RESULT * result, int *columns, int col_count);
 
+  extern int db_query_prefetch_next_pages (DB_QUERY_RESULT * result);
+
   extern int db_query_format_size (DB_QUERY_TYPE * query_type);
 
 /* query post-processing functions */
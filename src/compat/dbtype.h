@@ -87,7 +87,8 @@
 		 && (v)->data.ch.info.compressed_need_clear != 0))))
 
 #define DB_GET_COMPRESSED_STRING(v) \
-      ((DB_VALUE_DOMAIN_TYPE(v) != DB_TYPE_VARCHAR) && (DB_VALUE_DOMAIN_TYPE(v) != DB_TYPE_VARNCHAR) \
+      (((DB_VALUE_DOMAIN_TYPE(v) != DB_TYPE_VARCHAR) && (DB_VALUE_DOMAIN_TYPE(v) != DB_TYPE_VARNCHAR)) \
+	|| (v)->data.ch.info.style == SMALL_STRING \
 	? NULL : (v)->data.ch.medium.compressed_buf)
 
 
@@ -128,7 +129,8 @@
 		   || DB_VALUE_DOMAIN_TYPE(v) == DB_TYPE_NCHAR \
 		   || DB_VALUE_DOMAIN_TYPE(v) == DB_TYPE_VARBIT \
 		   || DB_VALUE_DOMAIN_TYPE(v) == DB_TYPE_BIT)), \
-	  (v)->data.ch.medium.buf))
+	  ((v)->data.ch.info.style == SMALL_STRING \
+	   ? (v)->data.ch.sm.buf : (v)->data.ch.medium.buf)))
 
 #define DB_GET_NUMERIC_PRECISION(val) \
     ((val)->domain.numeric_info.precision)
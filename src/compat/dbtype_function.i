@@ -990,6 +990,12 @@ db_get_json_document (const DB_VALUE * value)
  * collation_id(in):
  * str(in):
  * size(in):
+ *
+ * Note: Always produces the medium (pointer) representation, even for
+ *	 strings that would fit inline: callers may hand buffer ownership
+ *	 over afterwards by setting need_clear, which inline storage cannot
+ *	 honor.  The small-string optimization is applied by producers that
+ *	 own their copy of the bytes (see mr_make_small_varchar).
  */
 int
 db_make_db_char (DB_VALUE * value, const INTL_CODESET codeset, const int collation_id, DB_CONST_C_CHAR str,
@@ -2135,6 +2141,12 @@ db_get_compressed_size (DB_VALUE * value)
   /* Preliminary check */
   assert (type == DB_TYPE_VARCHAR || type == DB_TYPE_VARNCHAR);
 
+  if (value->data.ch.info.style == SMALL_STRING)
+    {
+      /* the inline representation has no room for compression info; strings this short never compress anyway */
+      return DB_UNCOMPRESSABLE;
+    }
+
   return value->data.ch.medium.compressed_size;
 }
 
@@ -2160,6 +2172,13 @@ db_set_compressed_string (DB_VALUE * value, char *compressed_string, int compres
   /* Preliminary check */
   assert (type == DB_TYPE_VARCHAR || type == DB_TYPE_VARNCHAR);
 
+  if (value->data.ch.info.style == SMALL_STRING)
+    {
+      /* the inline representation carries no compression info */
+      assert (compressed_string == NULL);
+      return;
+    }
+
   value->data.ch.medium.compressed_buf = compressed_string;
   value->data.ch.medium.compressed_size = compressed_size;
   value->data.ch.info.compressed_need_clear = compressed_need_clear;
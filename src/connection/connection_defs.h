@@ -438,6 +438,7 @@ struct css_conn_entry
 
   bool stop_talk;		/* block and stop this connection */
   bool ignore_repl_delay;	/* don't do reset_on_commit by the delay of replication */
+  bool compress_results;	/* LZ4-compress query result pages for this client */
   unsigned short stop_phase;
 
   char *version_string;		/* client version string */
@@ -1909,6 +1909,77 @@ css_send_two_data (CSS_CONN_ENTRY * conn, unsigned short rid, const char *buffer
 			 sizeof (NET_HEADER), buffer2, buffer2_size));
 }
 
+/*
+* css_send_gathered_data() - transfer a data packet to the client whose
+*                            payload is gathered from several fragments
+*   return: enum css_error_code (See connection_defs.h)
+*   conn(in): connection entry
+*   rid(in): request id
+*   buffer1(in): buffer for data will be sent
+*   buffer1_size(in): buffer size
+*   fragments(in): array of payload fragment pointers
+*   fragment_sizes(in): size of each payload fragment
+*   num_fragments(in): number of payload fragments
+*
+* Note: The fragments travel as one DATA_TYPE packet; writev() gathers them
+*       from their source buffers, so the caller does not have to assemble
+*       them into a contiguous buffer first. On the wire the result is
+*       identical to css_send_two_data() with a pre-assembled second buffer.
+*/
+int
+css_send_gathered_data (CSS_CONN_ENTRY * conn, unsigned short rid, const char *buffer1, int buffer1_size,
+			const char **fragments, const int *fragment_sizes, int num_fragments)
+{
+  NET_HEADER header1 = DEFAULT_HEADER_DATA;
+  NET_HEADER header2 = DEFAULT_HEADER_DATA;
+  struct iovec iov[7 + CSS_NET_GATHER_MAX_FRAGMENTS];
+  int templen1, templen2, templen3, templen4;
+  int data_size, i;
+  ssize_t total_len;
+
+  if (!conn || conn->status != CONN_OPEN)
+    {
+      return (CONNECTION_CLOSED);
+    }
+
+  assert (num_fragments > 0 && num_fragments <= CSS_NET_GATHER_MAX_FRAGMENTS);
+  if (num_fragments <= 0 || num_fragments > CSS_NET_GATHER_MAX_FRAGMENTS)
+    {
+      return INTERNAL_CSS_ERROR;
+    }
+
+  data_size = 0;
+  for (i = 0; i < num_fragments; i++)
+    {
+      data_size += fragment_sizes[i];
+    }
+
+  css_set_net_header (&header1, DATA_TYPE, 0, rid, buffer1_size, conn->get_tran_index (), conn->invalidate_snapshot,
+		      conn->db_error);
+
+  css_set_net_header (&header2, DATA_TYPE, 0, rid, data_size, conn->get_tran_index (), conn->invalidate_snapshot,
+		      conn->db_error);
+
+  css_set_io_vector (&(iov[0]), &(iov[1]), (char *) &header1, sizeof (NET_HEADER), &templen1);
+  css_set_io_vector (&(iov[2]), &(iov[3]), buffer1, buffer1_size, &templen2);
+  css_set_io_vector (&(iov[4]), &(iov[5]), (char *) &header2, sizeof (NET_HEADER), &templen3);
+
+  /* the payload record has a single length prefix; the fragments follow it without further framing */
+  templen4 = htonl (data_size);
+  iov[6].iov_base = (caddr_t) (&templen4);
+  iov[6].iov_len = sizeof (int);
+  for (i = 0; i < num_fragments; i++)
+    {
+      iov[7 + i].iov_base = (caddr_t) fragments[i];
+      iov[7 + i].iov_len = fragment_sizes[i];
+    }
+
+  total_len = sizeof (NET_HEADER) * 2 + buffer1_size + data_size + sizeof (int) * 4;
+
+  /* timeout in milli-second in css_send_io_vector() */
+  return css_send_io_vector (conn, iov, total_len, 7 + num_fragments, -1);
+}
+
 /*
 * css_send_three_data() - transfer a data packet to the client.
 *   return: enum css_error_code (See connection_defs.h)
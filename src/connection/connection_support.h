@@ -84,9 +84,14 @@ extern int css_send_request (CSS_CONN_ENTRY * conn, int request, unsigned short
 			     int arg_buffer_size);
 
 extern int css_send_data (CSS_CONN_ENTRY * conn, unsigned short rid, const char *buffer, int buffer_size);
+/* Maximum number of source fragments css_send_gathered_data() accepts. */
+#define CSS_NET_GATHER_MAX_FRAGMENTS 16
+
 #if defined (SERVER_MODE)
 extern int css_send_two_data (CSS_CONN_ENTRY * conn, unsigned short rid, const char *buffer1, int buffer1_size,
 			      const char *buffer2, int buffer2_size);
+extern int css_send_gathered_data (CSS_CONN_ENTRY * conn, unsigned short rid, const char *buffer1, int buffer1_size,
+				   const char **fragments, const int *fragment_sizes, int num_fragments);
 extern int css_send_three_data (CSS_CONN_ENTRY * conn, unsigned short rid, const char *buffer1, int buffer1_size,
 				const char *buffer2, int buffer2_size, const char *buffer3, int buffer3_size);
 extern int css_send_four_data (CSS_CONN_ENTRY * conn, unsigned short rid, const char *buffer1, int buffer1_size,
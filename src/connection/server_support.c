@@ -30,9 +30,15 @@
 #include "session.h"
 #include "thread_entry_task.hpp"
 #include "thread_entry.hpp"
+#include "thread_looper.hpp"
 #include "thread_manager.hpp"
 #include "thread_worker_pool.hpp"
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -40,6 +46,10 @@
 #if !defined(WINDOWS)
 #include <signal.h>
 #include <unistd.h>
+#if defined(LINUX)
+#include <sched.h>
+#include <sys/epoll.h>
+#endif /* LINUX */
 #if defined(SOLARIS)
 #include <sys/filio.h>
 #endif /* SOLARIS */
@@ -133,6 +143,17 @@ static int ha_Log_applier_state_num = 0;
 // *INDENT-OFF*
 static cubthread::entry_workpool *css_Server_request_worker_pool = NULL;
 static cubthread::entry_workpool *css_Connection_worker_pool = NULL;
+static cubthread::daemon *css_Workerpool_tuner_daemon = NULL;
+
+#if defined (LINUX)
+/* NUMA topology of the host; read once in css_init when thread_worker_numa_affinity is enabled. the node count stays
+ * 1 when the parameter is off or the box is single-socket, which keeps every NUMA branch below inert. */
+#define CSS_NUMA_MAX_NODES 64
+static int css_Numa_node_count = 1;
+static cpu_set_t css_Numa_node_cpuset[CSS_NUMA_MAX_NODES];
+/* node the executing worker thread is bound to; -1 while unbound. thread-local so no synchronization is needed */
+static thread_local int css_Worker_numa_node = -1;
+#endif /* LINUX */
 
 class css_server_task : public cubthread::entry_task
 {
@@ -202,6 +223,50 @@ private:
   CSS_CONN_ENTRY &m_conn;
 };
 
+#if defined (LINUX)
+// epoll-based connection servicing (connection_event_loop parameter):
+//
+// by default every client connection owns a dedicated thread in css_Connection_worker_pool that polls its single
+// socket in css_connection_handler_thread. that is simple but does not scale: with many thousands of mostly idle
+// connections the server burns a thread (stack, scheduler load, timer wheel entries) per client. when the parameter
+// is enabled, client sockets are instead multiplexed by a small set of event loop daemons, each owning a private
+// epoll instance with edge-triggered, one-shot events. a connection is assigned to one daemon (by connection index),
+// so a socket is only ever serviced by a single thread and no synchronization is needed between daemons. on
+// readiness, the daemon performs exactly what the dedicated thread did: css_read_and_queue and, for command
+// requests, css_push_server_task to the transaction worker pool. the liveness duties of the dedicated thread
+// (stop_talk/status checks, periodic peer-alive and HA-standby checks) are taken over by a periodic sweep of each
+// daemon's connection registry.
+struct css_conn_event_loop
+{
+  int epoll_fd = -1;
+  cubthread::daemon *daemon = NULL;
+  std::mutex conns_mutex;
+  std::vector<CSS_CONN_ENTRY *> conns;  // connections assigned to this loop; swept periodically
+  int sweep_countdown = 0;              // iterations until the next expensive (peer-alive/HA) sweep
+};
+static const int CSS_CONN_EVENT_MAX_LOOPS = 4;
+static const int CSS_CONN_EVENT_WAIT_MSEC = 100;      // epoll_wait timeout; bounds reaction time to stop requests
+static const int CSS_CONN_EVENT_SWEEP_PERIOD = 50;    // expensive sweep every 50 iterations ~ 5 seconds
+static css_conn_event_loop css_Conn_event_loops[CSS_CONN_EVENT_MAX_LOOPS];
+static int css_Conn_event_loop_count = 0;             // stays 0 while the event loop is disabled
+
+class css_connection_event_task : public cubthread::entry_task
+{
+public:
+  css_connection_event_task (void) = delete;
+
+  css_connection_event_task (css_conn_event_loop &loop)
+  : m_loop (loop)
+  {
+  }
+
+  void execute (context_type &thread_ref) override final;
+
+private:
+  css_conn_event_loop &m_loop;
+};
+#endif /* LINUX */
+
 static const size_t CSS_JOB_QUEUE_SCAN_COLUMN_COUNT = 4;
 
 static void css_setup_server_loop (void);
@@ -232,6 +297,20 @@ static bool css_check_ha_log_applier_done (void);
 static bool css_check_ha_log_applier_working (void);
 
 static void css_push_server_task (CSS_CONN_ENTRY & conn_ref);
+#if defined (LINUX)
+static int css_conn_event_start (void);
+static void css_conn_event_stop (void);
+static bool css_conn_event_register (CSS_CONN_ENTRY *conn);
+static void css_conn_event_service (THREAD_ENTRY &thread_ref, css_conn_event_loop &loop, CSS_CONN_ENTRY *conn,
+                                    uint32_t revents);
+static void css_conn_event_finish (THREAD_ENTRY &thread_ref, css_conn_event_loop &loop, CSS_CONN_ENTRY *conn,
+                                   int status);
+static void css_conn_event_sweep (THREAD_ENTRY &thread_ref, css_conn_event_loop &loop, bool expensive_checks);
+static void css_numa_topology_init (void);
+static int css_numa_home_node (int conn_idx);
+static void css_numa_bind_worker_to_node (int node);
+#endif /* LINUX */
+static std::size_t css_get_server_request_core_hash (const CSS_CONN_ENTRY & conn_ref);
 static void css_stop_non_log_writer (THREAD_ENTRY & thread_ref, bool &, THREAD_ENTRY & stopper_thread_ref);
 static void css_stop_log_writer (THREAD_ENTRY & thread_ref, bool &);
 static void css_find_not_stopped (THREAD_ENTRY & thread_ref, bool & stop, bool is_log_writer, bool & found);
@@ -256,6 +335,7 @@ static cubthread::wait_seconds css_get_connection_thread_timeout_configuration (
 static bool css_get_server_request_thread_pooling_configuration (void);
 static int css_get_server_request_thread_core_count_configruation (void);
 static cubthread::wait_seconds css_get_server_request_thread_timeout_configuration (void);
+static void css_workerpool_tuner_execute (void);
 static void css_start_all_threads (void);
 // *INDENT-ON*
 
@@ -1169,6 +1249,326 @@ css_block_all_active_conn (unsigned short stop_phase)
   END_EXCLUSIVE_ACCESS_ACTIVE_CONN_ANCHOR (r);
 }
 
+#if defined (LINUX)
+// *INDENT-OFF*
+void
+css_connection_event_task::execute (context_type &thread_ref)
+{
+  struct epoll_event events[64];
+  int event_count;
+  int index;
+
+  thread_ref.type = TT_SERVER;	/* same identity as the dedicated connection handler threads */
+
+  event_count = epoll_wait (m_loop.epoll_fd, events, (int) (sizeof (events) / sizeof (events[0])),
+			    CSS_CONN_EVENT_WAIT_MSEC);
+  if (event_count < 0)
+    {
+      if (errno != EINTR)
+	{
+	  er_log_debug (ARG_FILE_LINE, "css_connection_event_task: epoll_wait() error (errno = %d)\n", errno);
+	}
+      return;
+    }
+
+  for (index = 0; index < event_count; index++)
+    {
+      css_conn_event_service (thread_ref, m_loop, (CSS_CONN_ENTRY *) events[index].data.ptr, events[index].events);
+    }
+
+  // liveness duties of the per-connection threads: cheap stop/status checks every iteration, peer-alive and
+  // HA-standby checks every CSS_CONN_EVENT_SWEEP_PERIOD iterations (~5 seconds), matching their old cadence
+  if (m_loop.sweep_countdown-- <= 0)
+    {
+      m_loop.sweep_countdown = CSS_CONN_EVENT_SWEEP_PERIOD;
+      css_conn_event_sweep (thread_ref, m_loop, true);
+    }
+  else
+    {
+      css_conn_event_sweep (thread_ref, m_loop, false);
+    }
+}
+
+/*
+ * css_conn_event_start () - create the connection event loop daemons; one epoll instance per daemon
+ *   return: NO_ERROR or ER_FAILED (caller falls back to per-connection threads)
+ */
+static int
+css_conn_event_start (void)
+{
+  int loop_count = (int) std::thread::hardware_concurrency () / 8;
+  int index;
+
+  loop_count = MAX (1, MIN (loop_count, CSS_CONN_EVENT_MAX_LOOPS));
+
+  for (index = 0; index < loop_count; index++)
+    {
+      css_Conn_event_loops[index].epoll_fd = epoll_create1 (0);
+      if (css_Conn_event_loops[index].epoll_fd < 0)
+	{
+	  er_log_debug (ARG_FILE_LINE, "css_conn_event_start: epoll_create1() error (errno = %d)\n", errno);
+	  css_conn_event_stop ();
+	  return ER_FAILED;
+	}
+    }
+
+  // count must be visible before the first connection is registered; daemons only read their own loop
+  css_Conn_event_loop_count = loop_count;
+
+  for (index = 0; index < loop_count; index++)
+    {
+      css_Conn_event_loops[index].daemon =
+	      cubthread::get_manager ()->create_daemon (cubthread::looper (std::chrono::milliseconds (0)),
+							new css_connection_event_task (css_Conn_event_loops[index]),
+							"css_connection_event");
+      if (css_Conn_event_loops[index].daemon == NULL)
+	{
+	  css_Conn_event_loop_count = 0;
+	  css_conn_event_stop ();
+	  return ER_FAILED;
+	}
+    }
+
+  er_log_debug (ARG_FILE_LINE, "css_conn_event_start: servicing connections with %d epoll event loops\n", loop_count);
+  return NO_ERROR;
+}
+
+/*
+ * css_conn_event_stop () - destroy the event loop daemons and their epoll instances
+ *
+ * registered connections are not touched; like the per-connection threads on shutdown, servicing simply ends and
+ * connection entries are cleaned up by the regular shutdown path.
+ */
+static void
+css_conn_event_stop (void)
+{
+  int index;
+
+  css_Conn_event_loop_count = 0;
+
+  for (index = 0; index < CSS_CONN_EVENT_MAX_LOOPS; index++)
+    {
+      if (css_Conn_event_loops[index].daemon != NULL)
+	{
+	  cubthread::get_manager ()->destroy_daemon (css_Conn_event_loops[index].daemon);
+	}
+      if (css_Conn_event_loops[index].epoll_fd >= 0)
+	{
+	  close (css_Conn_event_loops[index].epoll_fd);
+	  css_Conn_event_loops[index].epoll_fd = -1;
+	}
+      css_Conn_event_loops[index].conns.clear ();
+    }
+}
+
+/*
+ * css_conn_event_register () - assign a new client connection to an event loop
+ *   return: true on success; false when the event loop is disabled or registration failed
+ *   conn (in): connection entry
+ */
+static bool
+css_conn_event_register (CSS_CONN_ENTRY *conn)
+{
+  struct epoll_event ev;
+
+  if (css_Conn_event_loop_count == 0)
+    {
+      return false;
+    }
+
+  css_conn_event_loop &loop = css_Conn_event_loops[conn->idx % css_Conn_event_loop_count];
+
+  {
+    std::unique_lock<std::mutex> lock (loop.conns_mutex);
+    loop.conns.push_back (conn);
+  }
+
+  ev.events = EPOLLIN | EPOLLET | EPOLLONESHOT | EPOLLRDHUP;
+  ev.data.ptr = conn;
+  if (epoll_ctl (loop.epoll_fd, EPOLL_CTL_ADD, conn->fd, &ev) != 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_conn_event_register: epoll_ctl() error (errno = %d)\n", errno);
+      std::unique_lock<std::mutex> lock (loop.conns_mutex);
+      loop.conns.erase (std::remove (loop.conns.begin (), loop.conns.end (), conn), loop.conns.end ());
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * css_conn_event_finish () - end event-loop servicing of a connection; mirrors the tail of
+ *                            css_connection_handler_thread
+ *   thread_ref (in) : event daemon thread entry
+ *   loop (in)       : event loop owning the connection
+ *   conn (in)       : connection entry
+ *   status (in)     : css error status servicing ended with
+ */
+static void
+css_conn_event_finish (THREAD_ENTRY &thread_ref, css_conn_event_loop &loop, CSS_CONN_ENTRY *conn, int status)
+{
+  // unregister first; with the fd removed (one-shot events at that) no other event can reference the connection
+  (void) epoll_ctl (loop.epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL);
+  {
+    std::unique_lock<std::mutex> lock (loop.conns_mutex);
+    loop.conns.erase (std::remove (loop.conns.begin (), loop.conns.end (), conn), loop.conns.end ());
+  }
+
+  /* check the connection and call connection error handler */
+  if (status != NO_ERRORS || css_check_conn (conn) != NO_ERROR)
+    {
+      er_log_debug (ARG_FILE_LINE,
+		    "css_conn_event_finish: status %d conn { status %d transaction_id %d "
+		    "db_error %d stop_talk %d stop_phase %d }\n", status, conn->status, conn->get_tran_index (),
+		    conn->db_error, conn->stop_talk, conn->stop_phase);
+      pthread_mutex_lock (&thread_ref.tran_index_lock);
+      (*css_Connection_error_handler) (&thread_ref, conn);
+    }
+}
+
+/*
+ * css_conn_event_service () - handle one readiness event; the event-loop counterpart of one iteration of
+ *                             css_connection_handler_thread
+ *   thread_ref (in) : event daemon thread entry
+ *   loop (in)       : event loop owning the connection
+ *   conn (in)       : connection entry the event fired for
+ *   revents (in)    : epoll event mask
+ */
+static void
+css_conn_event_service (THREAD_ENTRY &thread_ref, css_conn_event_loop &loop, CSS_CONN_ENTRY *conn, uint32_t revents)
+{
+  struct epoll_event ev;
+  int conn_status;
+  int status;
+  int type;
+
+  thread_ref.conn_entry = conn;
+
+  if ((revents & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) != 0)
+    {
+      css_conn_event_finish (thread_ref, loop, conn, ERROR_ON_READ);
+      thread_ref.conn_entry = NULL;
+      return;
+    }
+
+  /* check the connection; same CONN_CLOSING synchronization as css_connection_handler_thread (see CBRD-21375) */
+  conn_status = conn->status;
+  if (conn_status == CONN_CLOSING)
+    {
+      rmutex_lock (&thread_ref, &conn->rmutex);
+      conn_status = conn->status;
+      rmutex_unlock (&thread_ref, &conn->rmutex);
+    }
+  if (conn_status != CONN_OPEN)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_conn_event_service: conn->status (%d) is not CONN_OPEN.", conn_status);
+      css_conn_event_finish (thread_ref, loop, conn, CONNECTION_CLOSED);
+      thread_ref.conn_entry = NULL;
+      return;
+    }
+  if (thread_ref.shutdown || conn->stop_talk)
+    {
+      css_conn_event_finish (thread_ref, loop, conn, NO_ERRORS);
+      thread_ref.conn_entry = NULL;
+      return;
+    }
+
+  /* read command/data/etc request from socket, and enqueue it to appr. queue */
+  status = css_read_and_queue (conn, &type);
+  if (status != NO_ERRORS)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_conn_event_service: css_read_and_queue() error\n");
+      css_conn_event_finish (thread_ref, loop, conn, status);
+      thread_ref.conn_entry = NULL;
+      return;
+    }
+  if (type == COMMAND_TYPE)
+    {
+      // push new task
+      css_push_server_task (*conn);
+    }
+
+  // re-arm the one-shot event. EPOLL_CTL_MOD re-checks readiness, so a second request already buffered on the socket
+  // triggers a new event immediately; nothing is lost by reading a single request per wakeup.
+  ev.events = EPOLLIN | EPOLLET | EPOLLONESHOT | EPOLLRDHUP;
+  ev.data.ptr = conn;
+  if (epoll_ctl (loop.epoll_fd, EPOLL_CTL_MOD, conn->fd, &ev) != 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_conn_event_service: epoll_ctl() error (errno = %d)\n", errno);
+      css_conn_event_finish (thread_ref, loop, conn, ERROR_ON_READ);
+    }
+
+  thread_ref.conn_entry = NULL;
+}
+
+/*
+ * css_conn_event_sweep () - periodic liveness checks over the connections of one event loop
+ *   thread_ref (in)       : event daemon thread entry
+ *   loop (in)             : event loop to sweep
+ *   expensive_checks (in) : also run the ~5 second checks (peer alive, HA standby refusal)
+ */
+static void
+css_conn_event_sweep (THREAD_ENTRY &thread_ref, css_conn_event_loop &loop, bool expensive_checks)
+{
+  std::vector<CSS_CONN_ENTRY *> conns_copy;
+
+  {
+    std::unique_lock<std::mutex> lock (loop.conns_mutex);
+    conns_copy = loop.conns;
+  }
+
+  for (CSS_CONN_ENTRY *conn : conns_copy)
+    {
+      int conn_status = conn->status;
+
+      thread_ref.conn_entry = conn;
+
+      if (conn_status == CONN_CLOSING)
+	{
+	  rmutex_lock (&thread_ref, &conn->rmutex);
+	  conn_status = conn->status;
+	  rmutex_unlock (&thread_ref, &conn->rmutex);
+	}
+      if (conn_status != CONN_OPEN)
+	{
+	  css_conn_event_finish (thread_ref, loop, conn, CONNECTION_CLOSED);
+	  continue;
+	}
+      if (thread_ref.shutdown || conn->stop_talk)
+	{
+	  css_conn_event_finish (thread_ref, loop, conn, NO_ERRORS);
+	  continue;
+	}
+
+      if (!expensive_checks)
+	{
+	  continue;
+	}
+
+      if (CHECK_CLIENT_IS_ALIVE ())
+	{
+	  if (css_peer_alive (conn->fd, 5000) == false)
+	    {
+	      er_log_debug (ARG_FILE_LINE, "css_conn_event_sweep: css_peer_alive() error\n");
+	      css_conn_event_finish (thread_ref, loop, conn, CONNECTION_CLOSED);
+	      continue;
+	    }
+	}
+
+      /* check server's HA state */
+      if (ha_Server_state == HA_SERVER_STATE_TO_BE_STANDBY && conn->in_transaction == false
+	  && css_count_transaction_worker_threads (&thread_ref, conn->get_tran_index (), conn->client_id) == 0)
+	{
+	  css_conn_event_finish (thread_ref, loop, conn, REQUEST_REFUSED);
+	  continue;
+	}
+    }
+
+  thread_ref.conn_entry = NULL;
+}
+// *INDENT-ON*
+#endif /* LINUX */
+
 /*
  * css_internal_connection_handler() -
  *   return:
@@ -1181,6 +1581,14 @@ css_internal_connection_handler (CSS_CONN_ENTRY * conn)
 {
   css_insert_into_active_conn_list (conn);
 
+#if defined (LINUX)
+  if (css_conn_event_register (conn))
+    {
+      // connection is serviced by an epoll event loop; no dedicated thread needed
+      return NO_ERRORS;
+    }
+#endif /* LINUX */
+
   // push connection handler task
   cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_task (*conn));
 
@@ -1323,11 +1731,21 @@ css_init (THREAD_ENTRY * thread_p, char *server_name, int name_length, int port_
   const std::size_t MAX_WORKERS = css_get_max_workers ();
   const std::size_t MAX_TASK_COUNT = css_get_max_task_count ();
   const std::size_t MAX_CONNECTIONS = css_get_max_connections ();
+  std::size_t tran_core_count = (std::size_t) css_get_server_request_thread_core_count_configruation ();
+
+#if defined (LINUX)
+  css_numa_topology_init ();
+  if (css_Numa_node_count > 1)
+    {
+      // each node owns a contiguous block of cores; round up so the blocks are equal
+      tran_core_count = ((tran_core_count + css_Numa_node_count - 1) / css_Numa_node_count) * css_Numa_node_count;
+    }
+#endif /* LINUX */
 
   // create request worker pool
   css_Server_request_worker_pool =
     cubthread::get_manager ()->create_worker_pool (MAX_WORKERS, MAX_TASK_COUNT, "transaction workers", NULL,
-						   css_get_server_request_thread_core_count_configruation (),
+						   tran_core_count,
 						   cubthread::is_logging_configured
 						   (cubthread::LOG_WORKER_POOL_TRAN_WORKERS),
 						   css_get_server_request_thread_pooling_configuration (),
@@ -1355,6 +1773,23 @@ css_init (THREAD_ENTRY * thread_p, char *server_name, int name_length, int port_
       goto shutdown;
     }
 
+#if defined (LINUX)
+  if (prm_get_bool_value (PRM_ID_CONNECTION_EVENT_LOOP))
+    {
+      // service client sockets with epoll event loops; on failure fall back to per-connection threads
+      (void) css_conn_event_start ();
+    }
+#endif /* LINUX */
+
+  // create worker pool tuning daemon; it only acts while thread_worker_adaptive_sizing is enabled
+  // *INDENT-OFF*
+  css_Workerpool_tuner_daemon =
+    cubthread::get_manager ()->create_daemon_without_entry (cubthread::looper (std::chrono::seconds (1)),
+							    new cubthread::callable_task<void>
+							    (css_workerpool_tuner_execute),
+							    "css_workerpool_tuner");
+  // *INDENT-ON*
+
   css_Server_connection_socket = INVALID_SOCKET;
 
   conn = css_connect_to_master_server (port_id, server_name, name_length);
@@ -1417,6 +1852,17 @@ shutdown:
     {
       perfmon_er_log_current_stats (thread_p);
     }
+#if defined (LINUX)
+  // stop the connection event loops; remaining connection entries are cleaned up by the regular shutdown path
+  css_conn_event_stop ();
+#endif /* LINUX */
+
+  // stop the worker pool tuner before its pool goes away
+  if (css_Workerpool_tuner_daemon != NULL)
+    {
+      thread_get_manager ()->destroy_daemon_without_entry (css_Workerpool_tuner_daemon);
+    }
+
   css_Server_request_worker_pool->er_log_stats ();
   css_Connection_worker_pool->er_log_stats ();
 
@@ -1497,6 +1943,44 @@ css_send_reply_and_data_to_client (CSS_CONN_ENTRY * conn, unsigned int eid, char
   return (rc == NO_ERRORS) ? NO_ERROR : rc;
 }
 
+/*
+ * css_send_reply_and_gathered_data_to_client() - send a reply to the client
+ *                                                together with a data buffer
+ *  gathered from several source fragments
+ *   return:
+ *   eid(in): enquiry id
+ *   reply(in): the reply data (error or no error)
+ *   reply_size(in): the size of the reply data.
+ *   fragments(in): array of payload fragment pointers
+ *   fragment_sizes(in): size of each payload fragment
+ *   num_fragments(in): number of payload fragments
+ *
+ * Note: This is to be used only by the server.  Equivalent to assembling the
+ *       fragments into one contiguous buffer and calling
+ *       css_send_reply_and_data_to_client(), but without the assembly copy:
+ *       writev() gathers the fragments directly from their source buffers.
+ */
+unsigned int
+css_send_reply_and_gathered_data_to_client (CSS_CONN_ENTRY * conn, unsigned int eid, char *reply, int reply_size,
+					    const char **fragments, const int *fragment_sizes, int num_fragments)
+{
+  int rc = 0;
+
+  assert (conn != NULL);
+
+  if (num_fragments > 0)
+    {
+      rc = css_send_gathered_data (conn, CSS_RID_FROM_EID (eid), reply, reply_size, fragments, fragment_sizes,
+				   num_fragments);
+    }
+  else
+    {
+      rc = css_send_data (conn, CSS_RID_FROM_EID (eid), reply, reply_size);
+    }
+
+  return (rc == NO_ERRORS) ? NO_ERROR : rc;
+}
+
 #if 0
 /*
  * css_send_reply_and_large_data_to_client() - send a reply to the server,
@@ -2723,18 +3207,155 @@ css_get_current_conn_entry (void)
  *
  * TODO: this is also used externally due to legacy design; should be internalized completely
  */
+#if defined (LINUX)
+/*
+ * css_numa_topology_init () - read the NUMA topology when thread_worker_numa_affinity is enabled
+ *
+ * when the host exposes more than one node, the transaction worker pool cores are split into one contiguous block per
+ * node (css_get_server_request_core_hash), so each node effectively owns a private sub-pool, and worker threads are
+ * bound to their node's cpu set on first use (css_numa_bind_worker_to_node). a connection's requests always hash to
+ * cores of its home node, so a session stops migrating between sockets.
+ *
+ * this pairs with data_buffer_numa_aware: the page buffer binds BCB table partitions and shared LRU lists to the node
+ * given by getcpu (), so with workers pinned, a session's hot pages and its private LRU activity stay on the socket
+ * that executes its requests instead of being scattered by the scheduler.
+ */
+static void
+css_numa_topology_init (void)
+{
+  char path[64];
+  char line[1024];
+  int node;
+
+  if (!prm_get_bool_value (PRM_ID_THREAD_WORKER_NUMA_AFFINITY))
+    {
+      return;
+    }
+
+  for (node = 0; node < CSS_NUMA_MAX_NODES; node++)
+    {
+      FILE *fp;
+      char *token;
+      bool has_cpu = false;
+
+      snprintf (path, sizeof (path), "/sys/devices/system/node/node%d/cpulist", node);
+      fp = fopen (path, "r");
+      if (fp == NULL)
+	{
+	  break;
+	}
+      if (fgets (line, sizeof (line), fp) == NULL)
+	{
+	  line[0] = '\0';
+	}
+      fclose (fp);
+
+      CPU_ZERO (&css_Numa_node_cpuset[node]);
+      /* the cpulist is a comma separated list of cpu ranges, e.g. "0-15,32-47" */
+      for (token = strtok (line, ","); token != NULL; token = strtok (NULL, ","))
+	{
+	  int cpu_first, cpu_last, cpu;
+
+	  if (sscanf (token, "%d-%d", &cpu_first, &cpu_last) < 2)
+	    {
+	      if (sscanf (token, "%d", &cpu_first) < 1)
+		{
+		  continue;
+		}
+	      cpu_last = cpu_first;
+	    }
+	  for (cpu = cpu_first; cpu <= cpu_last && cpu < CPU_SETSIZE; cpu++)
+	    {
+	      CPU_SET (cpu, &css_Numa_node_cpuset[node]);
+	      has_cpu = true;
+	    }
+	}
+
+      if (!has_cpu)
+	{
+	  /* a cpu-less (memory only) node breaks the node-to-core-block mapping; fall back to no affinity */
+	  er_log_debug (ARG_FILE_LINE, "css_numa_topology_init: node %d has no cpus; numa affinity disabled", node);
+	  return;
+	}
+    }
+
+  if (node > 1)
+    {
+      css_Numa_node_count = node;
+      er_log_debug (ARG_FILE_LINE, "css_numa_topology_init: binding transaction workers across %d numa nodes", node);
+    }
+}
+
+/*
+ * css_numa_home_node () - home NUMA node of a connection; all its requests are served from this node
+ *   return: node index
+ *   conn_idx (in): connection index
+ */
+static int
+css_numa_home_node (int conn_idx)
+{
+  return conn_idx % css_Numa_node_count;
+}
+
+/*
+ * css_numa_bind_worker_to_node () - bind the calling worker thread to the cpu set of a NUMA node
+ *   node (in): node index
+ *
+ * since a core only receives connections of a single home node, a worker rebinds at most once per thread lifetime;
+ * afterwards this is a thread-local compare.
+ */
+static void
+css_numa_bind_worker_to_node (int node)
+{
+  if (css_Numa_node_count <= 1 || css_Worker_numa_node == node)
+    {
+      return;
+    }
+
+  if (sched_setaffinity (0, sizeof (cpu_set_t), &css_Numa_node_cpuset[node]) != 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_numa_bind_worker_to_node: bind to node %d failed (errno = %d)", node, errno);
+    }
+  /* remember the node even on failure; retrying on every request would only repeat the syscall and the log */
+  css_Worker_numa_node = node;
+}
+#endif /* LINUX */
+
+/*
+ * css_get_server_request_core_hash () - core hash routing a connection's requests in the transaction worker pool
+ *   return: core hash for push_task_on_core
+ *   conn_ref (in): connection entry
+ *
+ * cores are partitioned by connection index. this is particularly important in order to avoid having tasks randomly
+ * pushed to cores that are full. some of those tasks may belong to threads holding locks. as a consequence, lock
+ * waiters may wait longer or even indefinitely if we are really unlucky.
+ *
+ * with NUMA affinity active, cores are additionally split into one contiguous block per node and a connection hashes
+ * only inside the block of its home node, so its requests are always served by workers bound to that node.
+ */
+static std::size_t
+css_get_server_request_core_hash (const CSS_CONN_ENTRY &conn_ref)
+{
+#if defined (LINUX)
+  if (css_Numa_node_count > 1)
+    {
+      std::size_t cores_per_node = css_Server_request_worker_pool->get_core_count () / css_Numa_node_count;
+      std::size_t node = (std::size_t) css_numa_home_node (conn_ref.idx);
+
+      assert (cores_per_node > 0);      // css_init rounds the core count up to a node count multiple
+      return node * cores_per_node + ((std::size_t) conn_ref.idx / css_Numa_node_count) % cores_per_node;
+    }
+#endif /* LINUX */
+  return static_cast<std::size_t> (conn_ref.idx);
+}
+
 static void
 css_push_server_task (CSS_CONN_ENTRY &conn_ref)
 {
-  // push the task
-  //
-  // note: cores are partitioned by connection index. this is particularly important in order to avoid having tasks
-  //       randomly pushed to cores that are full. some of those tasks may belong to threads holding locks. as a
-  //       consequence, lock waiters may wait longer or even indefinitely if we are really unlucky.
-  //
+  // push the task; see css_get_server_request_core_hash for how the target core is chosen
   conn_ref.add_pending_request ();
   thread_get_manager ()->push_task_on_core (css_Server_request_worker_pool, new css_server_task (conn_ref),
-                                            static_cast<size_t> (conn_ref.idx));
+                                            css_get_server_request_core_hash (conn_ref));
 }
 
 void
@@ -2748,6 +3369,11 @@ css_server_task::execute (context_type &thread_ref)
 {
   m_conn.start_request ();
 
+#if defined (LINUX)
+  // keep the worker on the connection's home node; no-op unless thread_worker_numa_affinity found multiple nodes
+  css_numa_bind_worker_to_node (css_numa_home_node (m_conn.idx));
+#endif /* LINUX */
+
   thread_ref.conn_entry = &m_conn;
   session_state *session_p = thread_ref.conn_entry->session_p;
 
@@ -3283,6 +3909,110 @@ css_get_server_request_thread_timeout_configuration (void)
   return cubthread::wait_seconds (std::chrono::seconds (prm_get_integer_value (PRM_ID_THREAD_WORKER_TIMEOUT_SECONDS)));
 }
 
+//
+// css_workerpool_tuner_execute () - adjust the transaction worker pool active worker limit from queueing feedback
+//
+// the pool already spawns and retires worker threads on demand; what is fixed at boot is how many may be busy at
+// once. while direct dispatch succeeds the tuner keeps that cap low, so a lightly loaded server is not oversubscribed
+// with runnable threads; while tasks have to queue behind busy workers it opens the cap back up toward the boot
+// maximum. every decision is written to the error log so the sizing history can be audited.
+//
+static void
+css_workerpool_tuner_execute (void)
+{
+  // fraction of dispatched tasks that had to queue; above/below these bounds the limit is raised/lowered
+  static const double GROW_QUEUED_RATIO = 0.25;
+  static const double SHRINK_QUEUED_RATIO = 0.0625;
+
+  static std::vector<UINT64> prev_stats;
+  static std::vector<UINT64> curr_stats;
+  static std::size_t queued_count_index = 0;
+  static std::size_t direct_count_index = 0;
+  static std::size_t direct_timer_index = 0;
+  static bool stat_indices_found = false;
+
+  if (!prm_get_bool_value (PRM_ID_THREAD_WORKER_ADAPTIVE_SIZING))
+    {
+      // restore boot behavior and forget the last sample
+      css_Server_request_worker_pool->set_active_limit (css_Server_request_worker_pool->get_max_count ());
+      prev_stats.clear ();
+      return;
+    }
+
+  const std::size_t stat_count = cubthread::wp_worker_statset_get_count ();
+
+  if (!stat_indices_found)
+    {
+      for (std::size_t it = 0; it < stat_count; it++)
+	{
+	  const char *stat_name = cubthread::wp_worker_statset_get_name (it);
+
+	  if (strcmp (stat_name, "Counter_found_task_in_queue") == 0)
+	    {
+	      queued_count_index = it;
+	    }
+	  else if (strcmp (stat_name, "Counter_wakeup_with_task") == 0)
+	    {
+	      direct_count_index = it;
+	    }
+	  else if (strcmp (stat_name, "Timer_wakeup_with_task") == 0)
+	    {
+	      direct_timer_index = it;
+	    }
+	}
+      stat_indices_found = true;
+    }
+
+  curr_stats.assign (stat_count, 0);
+  css_Server_request_worker_pool->get_stats (curr_stats.data ());
+
+  if (prev_stats.empty ())
+    {
+      // first sample after enabling; decide on the next one
+      prev_stats = curr_stats;
+      return;
+    }
+
+  UINT64 queued_delta = curr_stats[queued_count_index] - prev_stats[queued_count_index];
+  UINT64 direct_delta = curr_stats[direct_count_index] - prev_stats[direct_count_index];
+  UINT64 dispatch_usec_delta = curr_stats[direct_timer_index] - prev_stats[direct_timer_index];
+  UINT64 total_delta = queued_delta + direct_delta;
+
+  prev_stats = curr_stats;
+
+  std::size_t limit = css_Server_request_worker_pool->get_active_limit ();
+  std::size_t max_limit = css_Server_request_worker_pool->get_max_count ();
+  std::size_t min_limit = css_Server_request_worker_pool->get_core_count ();
+  std::size_t step = std::max<std::size_t> (1, max_limit / 8);
+  std::size_t new_limit = limit;
+  const char *reason = NULL;
+
+  if (total_delta == 0 || (double) queued_delta < SHRINK_QUEUED_RATIO * (double) total_delta)
+    {
+      // little to no queueing; the busy workers cover the load, so tighten the cap
+      new_limit = (limit > min_limit + step) ? (limit - step) : min_limit;
+      reason = "queueing is low";
+    }
+  else if ((double) queued_delta > GROW_QUEUED_RATIO * (double) total_delta)
+    {
+      // a significant part of the load queued behind busy workers; open the cap
+      new_limit = std::min (limit + step, max_limit);
+      reason = "queueing is high";
+    }
+
+  if (new_limit != limit)
+    {
+      css_Server_request_worker_pool->set_active_limit (new_limit);
+
+      UINT64 avg_dispatch_usec = (direct_delta > 0) ? (dispatch_usec_delta / direct_delta) : 0;
+      er_log_debug (ARG_FILE_LINE,
+		    "css_workerpool_tuner: %s; active worker limit %zu -> %zu"
+		    " (%llu of %llu tasks queued, average dispatch delay %llu usec)\n",
+		    reason, limit, new_limit, (unsigned long long) queued_delta, (unsigned long long) total_delta,
+		    (unsigned long long) avg_dispatch_usec);
+    }
+}
+
 static void
 css_start_all_threads (void)
 {
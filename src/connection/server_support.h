@@ -47,6 +47,9 @@ extern unsigned int css_send_error_to_client (CSS_CONN_ENTRY * conn, unsigned in
 extern unsigned int css_send_data_to_client (CSS_CONN_ENTRY * conn, unsigned int eid, char *buffer, int buffer_size);
 extern unsigned int css_send_reply_and_data_to_client (CSS_CONN_ENTRY * conn, unsigned int eid, char *reply,
 						       int reply_size, char *buffer, int buffer_size);
+extern unsigned int css_send_reply_and_gathered_data_to_client (CSS_CONN_ENTRY * conn, unsigned int eid, char *reply,
+								int reply_size, const char **fragments,
+								const int *fragment_sizes, int num_fragments);
 #if 0
 extern unsigned int css_send_reply_and_large_data_to_client (unsigned int eid, char *reply, int reply_size,
 							     char *buffer, INT64 buffer_size);
@@ -84,6 +84,7 @@ static pthread_mutex_t gethostbyname_lock = PTHREAD_MUTEX_INITIALIZER;
 
 #define HOST_ID_ARRAY_SIZE 8	/* size of the host_id string */
 #define TCP_MIN_NUM_RETRIES 3
+#define LOCAL_ADDR_MAX 16	/* addresses remembered for the local host */
 #define CONTROLLEN (sizeof(struct cmsghdr) + sizeof(int))
 #if !defined(INADDR_NONE)
 #define INADDR_NONE 0xffffffff
@@ -100,6 +101,7 @@ static const int css_Maximum_server_count = 1000;
 #endif /* !WINDOWS */
 
 static void css_sockopt (SOCKET sd);
+static bool css_is_local_address (in_addr_t addr);
 static int css_sockaddr (const char *host, int port, struct sockaddr *saddr, socklen_t * slen);
 static int css_fd_error (SOCKET fd);
 
@@ -295,6 +297,64 @@ css_hostname_to_ip (const char *host, unsigned char *ip_addr)
   return NO_ERROR;
 }
 
+/*
+ * css_is_local_address() - is the address one of this host's own addresses?
+ *   return: true if the address belongs to the local host
+ *   addr(in): IPv4 address in network byte order
+ *
+ * Note: The addresses of the local host name are resolved once and cached,
+ *       so that co-located connections can be recognized even when they are
+ *       made through the host name instead of 127.0.0.1.
+ */
+static bool
+css_is_local_address (in_addr_t addr)
+{
+  static in_addr_t local_addrs[LOCAL_ADDR_MAX];
+  static int num_local_addrs = -1;
+  int i;
+
+  /* the whole 127/8 net is loopback */
+  if ((ntohl (addr) >> 24) == 127)
+    {
+      return true;
+    }
+
+  if (num_local_addrs < 0)
+    {
+      char hostname[CUB_MAXHOSTNAMELEN];
+      struct addrinfo hints, *result = NULL, *res;
+      int count = 0;
+
+      if (GETHOSTNAME (hostname, sizeof (hostname)) == 0)
+	{
+	  memset (&hints, 0, sizeof (hints));
+	  hints.ai_family = AF_INET;
+	  hints.ai_socktype = SOCK_STREAM;
+
+	  if (getaddrinfo (hostname, NULL, &hints, &result) == 0)
+	    {
+	      for (res = result; res != NULL && count < LOCAL_ADDR_MAX; res = res->ai_next)
+		{
+		  local_addrs[count++] = ((struct sockaddr_in *) res->ai_addr)->sin_addr.s_addr;
+		}
+	      freeaddrinfo (result);
+	    }
+	}
+
+      num_local_addrs = count;
+    }
+
+  for (i = 0; i < num_local_addrs; i++)
+    {
+      if (local_addrs[i] == addr)
+	{
+	  return true;
+	}
+    }
+
+  return false;
+}
+
 /*
  * css_sockaddr()
  *   return:
@@ -382,11 +442,13 @@ css_sockaddr (const char *host, int port, struct sockaddr *saddr, socklen_t * sl
     }
 
   /*
-   * Compare with the TCP address with localhost.
-   * If it is, use Unix domain socket rather than TCP for the performance
+   * Check whether the TCP address belongs to this host (loopback or one of
+   * its own addresses).  If it does, use a Unix domain socket rather than
+   * TCP for the performance: co-located broker and server traffic then skips
+   * the loopback network stack entirely.
    */
   memcpy ((void *) &in_addr, (void *) &tcp_saddr.sin_addr, sizeof (in_addr));
-  if (in_addr == inet_addr ("127.0.0.1"))
+  if (css_is_local_address (in_addr))
     {
       memset ((void *) &unix_saddr, 0, sizeof (unix_saddr));
       unix_saddr.sun_family = AF_UNIX;
@@ -21,6 +21,7 @@
 
 #include <stdio.h>
 #include <errno.h>
+#include <signal.h>
 #include <string.h>
 #include <assert.h>
 
@@ -51,6 +52,14 @@
 #define COMPACT_CLASS_MIN_LOCK_TIMEOUT 1
 #define COMPACT_CLASS_MAX_LOCK_TIMEOUT 10
 
+#define COMPACT_PROGRESS_FILE_SUFFIX "_compactdb.progress"
+
+static volatile sig_atomic_t compact_Stop_requested = 0;
+
+static void compactdb_intr_handler (int sig);
+static int compactdb_save_progress (const char *database_name, const OID * last_class_oid, const OID * last_oid);
+static int compactdb_load_progress (const char *database_name, OID * last_class_oid, OID * last_oid);
+static void compactdb_remove_progress (const char *database_name);
 static int is_not_system_class (MOBJ class_);
 static int do_reclaim_addresses (OID * const *class_oids, const int num_class_oids,
 				 int *const num_classes_fully_processed, const bool verbose,
@@ -87,6 +96,104 @@ compactdb_usage (const char *argv0)
   printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_COMPACTDB, 60), exec_name);
 }
 
+/*
+ * compactdb_intr_handler - request a graceful stop at the end of the current
+ * iteration
+ *    return: void
+ *    sig(in): the received signal
+ */
+static void
+compactdb_intr_handler (int sig)
+{
+  compact_Stop_requested = 1;
+}
+
+/*
+ * compactdb_save_progress - persist the processing markers so an interrupted
+ * execution can be resumed with --resume
+ *    return: error status
+ *    database_name(in): the database name
+ *    last_class_oid(in): last processed class oid
+ *    last_oid(in): last processed oid
+ */
+static int
+compactdb_save_progress (const char *database_name, const OID * last_class_oid, const OID * last_oid)
+{
+  char file_name[PATH_MAX];
+  FILE *fp;
+
+  snprintf (file_name, sizeof (file_name), "%s%s", database_name, COMPACT_PROGRESS_FILE_SUFFIX);
+
+  fp = fopen (file_name, "w");
+  if (fp == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  fprintf (fp, "%d %d %d %d %d %d\n", (int) last_class_oid->volid, (int) last_class_oid->pageid,
+	   (int) last_class_oid->slotid, (int) last_oid->volid, (int) last_oid->pageid, (int) last_oid->slotid);
+  fclose (fp);
+
+  return NO_ERROR;
+}
+
+/*
+ * compactdb_load_progress - read the processing markers saved by a previous
+ * stopped execution
+ *    return: error status
+ *    database_name(in): the database name
+ *    last_class_oid(out): last processed class oid
+ *    last_oid(out): last processed oid
+ */
+static int
+compactdb_load_progress (const char *database_name, OID * last_class_oid, OID * last_oid)
+{
+  char file_name[PATH_MAX];
+  FILE *fp;
+  int class_volid, class_pageid, class_slotid;
+  int oid_volid, oid_pageid, oid_slotid;
+
+  snprintf (file_name, sizeof (file_name), "%s%s", database_name, COMPACT_PROGRESS_FILE_SUFFIX);
+
+  fp = fopen (file_name, "r");
+  if (fp == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  if (fscanf (fp, "%d %d %d %d %d %d", &class_volid, &class_pageid, &class_slotid, &oid_volid, &oid_pageid,
+	      &oid_slotid) != 6)
+    {
+      fclose (fp);
+      return ER_FAILED;
+    }
+  fclose (fp);
+
+  last_class_oid->volid = (short) class_volid;
+  last_class_oid->pageid = class_pageid;
+  last_class_oid->slotid = (short) class_slotid;
+  last_oid->volid = (short) oid_volid;
+  last_oid->pageid = oid_pageid;
+  last_oid->slotid = (short) oid_slotid;
+
+  return NO_ERROR;
+}
+
+/*
+ * compactdb_remove_progress - remove the progress file once the first pass
+ * completed
+ *    return: void
+ *    database_name(in): the database name
+ */
+static void
+compactdb_remove_progress (const char *database_name)
+{
+  char file_name[PATH_MAX];
+
+  snprintf (file_name, sizeof (file_name), "%s%s", database_name, COMPACT_PROGRESS_FILE_SUFFIX);
+  unlink (file_name);
+}
+
 /*
  * find_oid - search an oid in a list of oids
  *    return: the index of the oid on success, -1 otherwise
@@ -248,11 +355,14 @@ get_name_from_class_oid (OID * class_oid)
  *    input_class_names(in): classes list
  *    input_class_length(in): classes list length
  *    max_processed_space(in): maximum space to process for one iteration
+ *    database_name(in): the database name, used to name the progress file
+ *    sleep_msecs(in): milliseconds to sleep between iterations
+ *    resume_flag(in): resume from the saved progress markers
  */
 static int
 compactdb_start (bool verbose_flag, bool delete_old_repr_flag, char *input_filename, char **input_class_names,
 		 int input_class_length, int max_processed_space, int instance_lock_timeout, int class_lock_timeout,
-		 DB_TRAN_ISOLATION tran_isolation)
+		 DB_TRAN_ISOLATION tran_isolation, const char *database_name, int sleep_msecs, bool resume_flag)
 {
   int status = NO_ERROR;
   OID **class_oids = NULL;
@@ -289,6 +399,10 @@ compactdb_start (bool verbose_flag, bool delete_old_repr_flag, char *input_filen
       return ER_FAILED;
     }
 
+  /* stop gracefully at the end of the current iteration, keeping the saved progress */
+  (void) os_set_signal_handler (SIGINT, compactdb_intr_handler);
+  (void) os_set_signal_handler (SIGTERM, compactdb_intr_handler);
+
   tran_reset_wait_times (class_lock_timeout);
 
   if (input_class_names && input_class_length > 0)
@@ -469,6 +583,24 @@ compactdb_start (bool verbose_flag, bool delete_old_repr_flag, char *input_filen
 
   COPY_OID (&last_processed_class_oid, class_oids[0]);
   OID_SET_NULL (&last_processed_oid);
+
+  if (resume_flag)
+    {
+      OID resume_class_oid, resume_oid;
+
+      if (compactdb_load_progress (database_name, &resume_class_oid, &resume_oid) == NO_ERROR
+	  && find_oid (&resume_class_oid, class_oids, num_classes) != -1)
+	{
+	  printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_COMPACTDB, COMPACTDB_MSG_RESUMING));
+	  COPY_OID (&last_processed_class_oid, &resume_class_oid);
+	  COPY_OID (&last_processed_oid, &resume_oid);
+	}
+      else
+	{
+	  printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_COMPACTDB, COMPACTDB_MSG_RESUME_DISCARDED));
+	}
+    }
+
   temp_index = -1;
   last_completed_class_index = -1;
 
@@ -526,6 +658,11 @@ compactdb_start (bool verbose_flag, bool delete_old_repr_flag, char *input_filen
 	    {
 	      goto error;
 	    }
+
+	  if (!OID_ISNULL (&last_processed_class_oid))
+	    {
+	      (void) compactdb_save_progress (database_name, &last_processed_class_oid, &last_processed_oid);
+	    }
 	  break;
 
 	case ER_LK_UNILATERALLY_ABORTED:
@@ -600,8 +737,22 @@ compactdb_start (bool verbose_flag, bool delete_old_repr_flag, char *input_filen
 	{
 	  break;
 	}
+
+      if (compact_Stop_requested)
+	{
+	  printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_COMPACTDB, COMPACTDB_MSG_STOP_REQUESTED));
+	  goto error;
+	}
+
+      if (sleep_msecs > 0)
+	{
+	  /* throttle: leave the disks to the regular transactions between iterations */
+	  SLEEP_MILISEC (sleep_msecs / 1000, sleep_msecs % 1000);
+	}
     }
 
+  compactdb_remove_progress (database_name);
+
   if (verbose_flag)
     {
       printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_COMPACTDB, COMPACTDB_MSG_PASS2));
@@ -792,6 +943,8 @@ compactdb (UTIL_FUNCTION_ARG * arg)
   char *input_filename = NULL;
   int maximum_processed_space = 10 * DB_PAGESIZE, pages;
   int instance_lock_timeout, class_lock_timeout;
+  int sleep_msecs;
+  bool resume_flag = 0;
   char **tables = NULL;
   int table_size = 0;
 
@@ -853,6 +1006,15 @@ compactdb (UTIL_FUNCTION_ARG * arg)
 
   delete_old_repr_flag = utility_get_option_bool_value (arg_map, COMPACT_DELETE_OLD_REPR_S);
 
+  sleep_msecs = utility_get_option_int_value (arg_map, COMPACT_SLEEP_MSECS_S);
+  if (sleep_msecs < 0)
+    {
+      compactdb_usage (arg->argv0);
+      return ER_GENERIC_ERROR;
+    }
+
+  resume_flag = utility_get_option_bool_value (arg_map, COMPACT_RESUME_S);
+
   maximum_processed_space = pages * DB_PAGESIZE;
 
   if (table_size > 1)
@@ -906,7 +1068,7 @@ compactdb (UTIL_FUNCTION_ARG * arg)
 	  status =
 	    compactdb_start (verbose_flag, delete_old_repr_flag, input_filename, tables, table_size - 1,
 			     maximum_processed_space, instance_lock_timeout, class_lock_timeout,
-			     TRAN_DEFAULT_ISOLATION_LEVEL ());
+			     TRAN_DEFAULT_ISOLATION_LEVEL (), database_name, sleep_msecs, resume_flag);
 
 	  if (status == ER_FAILED)
 	    {
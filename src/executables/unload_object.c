@@ -69,6 +69,15 @@
 #include "transaction_cl.h"
 #include "dbtype.h"
 
+#if defined(CS_MODE)
+// *INDENT-OFF*
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+// *INDENT-ON*
+#endif /* CS_MODE */
+
 #define MARK_CLASS_REQUESTED(cl_no) \
   (class_requested[cl_no / 8] |= 1 << cl_no % 8)
 #define MARK_CLASS_REFERENCED(cl_no) \
@@ -174,6 +183,8 @@ static void extractobjects_term_handler (int sig);
 static bool mark_referenced_domain (SM_CLASS * class_ptr, int *num_set);
 static void gauge_alarm_handler (int sig);
 static int process_class (int cl_no);
+static int process_fetch_area (DB_OBJECT * class_, SM_CLASS * class_ptr, DESC_OBJ * desc_obj,
+			       LC_COPYAREA * fetch_area, int referenced_class);
 static int process_object (DESC_OBJ * desc_obj, OID * obj_oid, int referenced_class);
 static int process_set (DB_SET * set);
 static int process_value (DB_VALUE * value);
@@ -1026,6 +1037,163 @@ gauge_alarm_handler (int sig)
   return;
 }
 
+#if defined(CS_MODE)
+// *INDENT-OFF*
+/*
+ * unload_fetch_pipeline - bounded hand-off of copy areas between the thread
+ * that keeps locator_fetch_all round trips going and the formatter thread.
+ * The formatter stays on the main thread: record unpacking toggles
+ * pr_Inhibit_oid_promotion and feeds the reference hash, and neither
+ * tolerates concurrency.
+ */
+static const size_t UNLOAD_FETCH_QUEUE_DEPTH = 4;
+
+struct unload_fetch_pipeline
+{
+  std::queue<LC_COPYAREA *> m_areas;
+  std::mutex m_mutex;
+  std::condition_variable m_space_avail;
+  std::condition_variable m_area_avail;
+  bool m_fetch_done = false;		// fetcher finished or failed
+  bool m_consumer_gone = false;		// formatter gave up
+  int m_fetch_error = NO_ERROR;
+
+  // fetcher side; false means the formatter stopped and the area was not taken over
+  bool push (LC_COPYAREA * area)
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    m_space_avail.wait (lock, [this] { return m_areas.size () < UNLOAD_FETCH_QUEUE_DEPTH || m_consumer_gone; });
+    if (m_consumer_gone)
+      {
+	return false;
+      }
+    m_areas.push (area);
+    m_area_avail.notify_one ();
+    return true;
+  }
+
+  // formatter side; NULL means the fetcher is done and error holds its verdict
+  LC_COPYAREA *pop (int &error)
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    m_area_avail.wait (lock, [this] { return !m_areas.empty () || m_fetch_done; });
+    if (m_areas.empty ())
+      {
+	error = m_fetch_error;
+	return NULL;
+      }
+    LC_COPYAREA *area = m_areas.front ();
+    m_areas.pop ();
+    m_space_avail.notify_one ();
+    return area;
+  }
+
+  void finish (int error)
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    m_fetch_done = true;
+    m_fetch_error = error;
+    m_area_avail.notify_one ();
+  }
+
+  void abort_consume ()
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    m_consumer_gone = true;
+    m_space_avail.notify_one ();
+  }
+
+  // after the fetcher joined: release whatever the formatter never consumed
+  void drain ()
+  {
+    while (!m_areas.empty ())
+      {
+	locator_free_copy_area (m_areas.front ());
+	m_areas.pop ();
+      }
+  }
+};
+// *INDENT-ON*
+#endif /* CS_MODE */
+
+/*
+ * process_fetch_area - dump every object of one fetched copy area
+ *    return: NO_ERROR, if successful or the error is ignorable, error number
+ *            otherwise.
+ *    class_(in): class object
+ *    class_ptr(in): class structure
+ *    desc_obj(in): reusable object descriptor
+ *    fetch_area(in): copy area returned by locator_fetch_all
+ *    referenced_class(in): non-zero if the class is dumped as a referenced one
+ */
+static int
+process_fetch_area (DB_OBJECT * class_, SM_CLASS * class_ptr, DESC_OBJ * desc_obj, LC_COPYAREA * fetch_area,
+		    int referenced_class)
+{
+  LC_COPYAREA_MANYOBJS *mobjs;	/* Describe multiple objects in area */
+  LC_COPYAREA_ONEOBJ *obj;	/* Describe on object in area */
+  RECDES recdes;		/* Record descriptor */
+  int error = NO_ERROR;
+  int i;
+#if defined(WINDOWS)
+  struct _timeb timebuffer;
+  time_t start = 0;
+#endif
+
+  mobjs = LC_MANYOBJS_PTR_IN_COPYAREA (fetch_area);
+  obj = LC_START_ONEOBJ_PTR_IN_COPYAREA (mobjs);
+
+  for (i = 0; i < mobjs->num_objs; ++i)
+    {
+      /*
+       * Process all objects for a requested class, but
+       * only referenced objects for a referenced class.
+       */
+      ++class_objects;
+      ++total_objects;
+      LC_RECDES_TO_GET_ONEOBJ (fetch_area, obj, &recdes);
+      if ((error = desc_disk_to_obj (class_, class_ptr, &recdes, desc_obj)) == NO_ERROR)
+	{
+	  if ((error = process_object (desc_obj, &obj->oid, referenced_class)) != NO_ERROR)
+	    {
+	      if (!ignore_err_flag)
+		{
+		  return error;
+		}
+	    }
+	}
+      else
+	{
+	  if (error == ER_TF_BUFFER_UNDERFLOW)
+	    {
+	      return error;
+	    }
+	  ++failed_objects;
+	}
+      obj = LC_NEXT_ONEOBJ_PTR_IN_COPYAREA (obj);
+#if defined(WINDOWS)
+      if (verbose_flag && (i % 10 == 0))
+	{
+	  _ftime (&timebuffer);
+	  if (start == 0)
+	    {
+	      start = timebuffer.time;
+	    }
+	  else
+	    {
+	      if ((timebuffer.time - start) > GAUGE_INTERVAL)
+		{
+		  gauge_alarm_handler (SIGALRM);
+		  start = timebuffer.time;
+		}
+	    }
+	}
+#endif
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * process_class - dump one class in loader format
  *    return: NO_ERROR, if successful, error number, if not successful.
@@ -1036,7 +1204,6 @@ process_class (int cl_no)
 {
   int error = NO_ERROR;
   DB_OBJECT *class_ = class_table->mops[cl_no];
-  int i = 0;
   int v = 0;
   SM_CLASS *class_ptr;
   SM_ATTRIBUTE *attribute;
@@ -1046,18 +1213,11 @@ process_class (int cl_no)
   OID last_oid;
   LOCK lock = IS_LOCK;		/* Lock to acquire for the above purpose */
   int nobjects, nfetched;
-  LC_COPYAREA_MANYOBJS *mobjs;	/* Describe multiple objects in area */
-  LC_COPYAREA_ONEOBJ *obj;	/* Describe on object in area */
-  RECDES recdes;		/* Record descriptor */
   DESC_OBJ *desc_obj = NULL;	/* The object described by obj */
   int requested_class = 0;
   int referenced_class = 0;
   void (*prev_handler) (int sig) = NULL;
   unsigned int prev_alarm = 0;
-#if defined(WINDOWS)
-  struct _timeb timebuffer;
-  time_t start = 0;
-#endif
   int total;
   LC_FETCH_VERSION_TYPE fetch_type = latest_image_flag ? LC_FETCH_CURRENT_VERSION : LC_FETCH_MVCC_VERSION;
 
@@ -1277,6 +1437,90 @@ process_class (int cl_no)
 
   desc_obj = make_desc_obj (class_ptr);
 
+#if defined(CS_MODE)
+  {
+    /* Keep the synchronous fetch round trips going on a second thread while this
+     * thread unpacks and prints the previous batch; the two halves of the old
+     * serial loop now overlap. */
+    unload_fetch_pipeline pipeline;
+    int64_t fetch_failures = 0;
+    int fetch_error = NO_ERROR;
+
+    // *INDENT-OFF*
+    std::thread fetcher ([&] ()
+      {
+	int thread_error = NO_ERROR;
+
+	while (nobjects != nfetched)
+	  {
+	    LC_COPYAREA *area = NULL;
+
+	    if (locator_fetch_all (hfid, &lock, fetch_type, class_oid, &nobjects, &nfetched, &last_oid, &area)
+		== NO_ERROR)
+	      {
+		if (area == NULL)
+		  {
+		    /* No more objects */
+		    break;
+		  }
+		if (!pipeline.push (area))
+		  {
+		    /* the formatter stopped; nobody takes over this area */
+		    locator_free_copy_area (area);
+		    break;
+		  }
+	      }
+	    else
+	      {
+		/* some error was occurred */
+		if (!ignore_err_flag)
+		  {
+		    thread_error = er_errid ();
+		    if (thread_error == NO_ERROR)
+		      {
+			thread_error = ER_FAILED;
+		      }
+		    break;
+		  }
+		++fetch_failures;
+	      }
+	  }
+
+	pipeline.finish (thread_error);
+      });
+    // *INDENT-ON*
+
+    while (error == NO_ERROR)
+      {
+	fetch_area = pipeline.pop (fetch_error);
+	if (fetch_area == NULL)
+	  {
+	    break;
+	  }
+
+	error = process_fetch_area (class_, class_ptr, desc_obj, fetch_area, referenced_class);
+	locator_free_copy_area (fetch_area);
+	if (error != NO_ERROR)
+	  {
+	    pipeline.abort_consume ();
+	  }
+      }
+
+    fetcher.join ();
+    pipeline.drain ();
+    failed_objects += (int) fetch_failures;
+
+    if (error == NO_ERROR && fetch_error != NO_ERROR)
+      {
+	error = fetch_error;
+      }
+    if (error != NO_ERROR)
+      {
+	desc_free (desc_obj);
+	goto exit_on_error;
+      }
+  }
+#else /* !CS_MODE */
   while (nobjects != nfetched)
     {
       if (locator_fetch_all
@@ -1284,60 +1528,13 @@ process_class (int cl_no)
 	{
 	  if (fetch_area != NULL)
 	    {
-	      mobjs = LC_MANYOBJS_PTR_IN_COPYAREA (fetch_area);
-	      obj = LC_START_ONEOBJ_PTR_IN_COPYAREA (mobjs);
-
-	      for (i = 0; i < mobjs->num_objs; ++i)
+	      error = process_fetch_area (class_, class_ptr, desc_obj, fetch_area, referenced_class);
+	      locator_free_copy_area (fetch_area);
+	      if (error != NO_ERROR)
 		{
-		  /*
-		   * Process all objects for a requested class, but
-		   * only referenced objects for a referenced class.
-		   */
-		  ++class_objects;
-		  ++total_objects;
-		  LC_RECDES_TO_GET_ONEOBJ (fetch_area, obj, &recdes);
-		  if ((error = desc_disk_to_obj (class_, class_ptr, &recdes, desc_obj)) == NO_ERROR)
-		    {
-		      if ((error = process_object (desc_obj, &obj->oid, referenced_class)) != NO_ERROR)
-			{
-			  if (!ignore_err_flag)
-			    {
-			      desc_free (desc_obj);
-			      locator_free_copy_area (fetch_area);
-			      goto exit_on_error;
-			    }
-			}
-		    }
-		  else
-		    {
-		      if (error == ER_TF_BUFFER_UNDERFLOW)
-			{
-			  desc_free (desc_obj);
-			  goto exit_on_error;
-			}
-		      ++failed_objects;
-		    }
-		  obj = LC_NEXT_ONEOBJ_PTR_IN_COPYAREA (obj);
-#if defined(WINDOWS)
-		  if (verbose_flag && (i % 10 == 0))
-		    {
-		      _ftime (&timebuffer);
-		      if (start == 0)
-			{
-			  start = timebuffer.time;
-			}
-		      else
-			{
-			  if ((timebuffer.time - start) > GAUGE_INTERVAL)
-			    {
-			      gauge_alarm_handler (SIGALRM);
-			      start = timebuffer.time;
-			    }
-			}
-		    }
-#endif
+		  desc_free (desc_obj);
+		  goto exit_on_error;
 		}
-	      locator_free_copy_area (fetch_area);
 	    }
 	  else
 	    {
@@ -1357,6 +1554,7 @@ process_class (int cl_no)
 	    ++failed_objects;
 	}
     }
+#endif /* !CS_MODE */
 
   desc_free (desc_obj);
 
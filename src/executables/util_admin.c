@@ -565,6 +565,8 @@ static UTIL_ARG_MAP ua_Compact_Option_Map[] = {
   {COMPACT_INSTANCE_LOCK_TIMEOUT_S, {ARG_INTEGER}, {(void *) 2}},
   {COMPACT_CLASS_LOCK_TIMEOUT_S, {ARG_INTEGER}, {(void *) 10}},
   {COMPACT_STANDBY_CS_MODE_S, {ARG_BOOLEAN}, {0}},
+  {COMPACT_SLEEP_MSECS_S, {ARG_INTEGER}, {0}},
+  {COMPACT_RESUME_S, {ARG_BOOLEAN}, {0}},
   {0, {0}, {0}}
 };
 
@@ -578,6 +580,8 @@ static GETOPT_LONG ua_Compact_Option[] = {
   {COMPACT_INSTANCE_LOCK_TIMEOUT_L, 1, 0, COMPACT_INSTANCE_LOCK_TIMEOUT_S},
   {COMPACT_CLASS_LOCK_TIMEOUT_L, 1, 0, COMPACT_CLASS_LOCK_TIMEOUT_S},
   {COMPACT_STANDBY_CS_MODE_L, 0, 0, COMPACT_STANDBY_CS_MODE_S},
+  {COMPACT_SLEEP_MSECS_L, 1, 0, COMPACT_SLEEP_MSECS_S},
+  {COMPACT_RESUME_L, 0, 0, COMPACT_RESUME_S},
   {0, 0, 0, 0}
 };
 
@@ -863,6 +867,19 @@ static GETOPT_LONG ua_Tde_Option[] = {
   {0, 0, 0, 0}
 };
 
+static UTIL_ARG_MAP ua_Calibrate_Option_Map[] = {
+  {OPTION_STRING_TABLE, {0}, {0}},
+  {CALIBRATE_PAGES_S, {ARG_INTEGER}, {(void *) 4096}},
+  {CALIBRATE_OUTPUT_FILE_S, {ARG_STRING}, {0}},
+  {0, {0}, {0}}
+};
+
+static GETOPT_LONG ua_Calibrate_Option[] = {
+  {CALIBRATE_PAGES_L, 1, 0, CALIBRATE_PAGES_S},
+  {CALIBRATE_OUTPUT_FILE_L, 1, 0, CALIBRATE_OUTPUT_FILE_S},
+  {0, 0, 0, 0}
+};
+
 static UTIL_MAP ua_Utility_Map[] = {
   {CREATEDB, SA_ONLY, 2, UTIL_OPTION_CREATEDB, "createdb", ua_Create_Option, ua_Create_Option_Map},
   {RENAMEDB, SA_ONLY, 2, UTIL_OPTION_RENAMEDB, "renamedb", ua_Rename_Option, ua_Rename_Option_Map},
@@ -904,6 +921,7 @@ static UTIL_MAP ua_Utility_Map[] = {
   {VACUUMDB, SA_CS, 1, UTIL_OPTION_VACUUMDB, "vacuumdb", ua_Vacuum_Option, ua_Vacuum_Option_Map},
   {CHECKSUMDB, CS_ONLY, 1, UTIL_OPTION_CHECKSUMDB, "checksumdb", ua_Checksum_Option, ua_Checksum_Option_Map},
   {TDE, SA_CS, 1, UTIL_OPTION_TDE, "tde", ua_Tde_Option, ua_Tde_Option_Map},
+  {CALIBRATEDB, SA_ONLY, 1, UTIL_OPTION_CALIBRATEDB, "calibratedb", ua_Calibrate_Option, ua_Calibrate_Option_Map},
   {-1, -1, 0, 0, 0, 0, 0}
 };
 
@@ -29,6 +29,8 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <time.h>
 #include <assert.h>
 #if defined(WINDOWS)
 #include <io.h>
@@ -47,6 +49,7 @@
 #include "schema_manager.h"
 #include "heap_file.h"
 #include "btree.h"
+#include "file_io.h"
 #include "extendible_hash.h"
 #include "locator_sr.h"
 #include "xserver_interface.h"
@@ -4238,3 +4241,205 @@ print_dump_tz_usage:
 	   basename (arg->argv0));
   return err_status;
 }
+
+/* number of comparisons timed by calibratedb when estimating the CPU cost of one qualification predicate */
+#define CALIBRATE_NUM_COMPARES	(1024 * 1024)
+
+/*
+ * calibratedb() - calibratedb main routine
+ *   return: EXIT_SUCCESS/EXIT_FAILURE
+ *
+ * Note: measures the per-page read cost and the per-comparison CPU cost on the
+ *       device holding the first data volume, and prints the measured ratio as
+ *       a cubrid.conf setting for optimizer_cpu_weight.  Reads go through the
+ *       regular file system, so pages cached by the operating system read much
+ *       faster than cold pages; sampling more pages than fit in the file cache
+ *       (-p) gives a figure closer to the cold-cache cost the optimizer models.
+ */
+int
+calibratedb (UTIL_FUNCTION_ARG * arg)
+{
+  UTIL_ARG_MAP *arg_map = arg->arg_map;
+  char er_msg_file[PATH_MAX];
+  char vol_path[PATH_MAX];
+  const char *db_name;
+  const char *output_file = NULL;
+  FILE *outfp = NULL;
+  DB_INFO *db = NULL;
+  char *io_page = NULL;
+  int npages, vdes = NULL_VOLDES, i;
+  volatile int cmp_result = 0;
+  DKNPAGES vol_npages;
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv;
+  double seq_usec, rand_usec, cmp_usec, cpu_weight;
+
+  db_name = utility_get_option_string_value (arg_map, OPTION_STRING_TABLE, 0);
+  if (db_name == NULL)
+    {
+      goto print_calibrate_usage;
+    }
+
+  npages = utility_get_option_int_value (arg_map, CALIBRATE_PAGES_S);
+  if (npages <= 0)
+    {
+      goto print_calibrate_usage;
+    }
+
+  output_file = utility_get_option_string_value (arg_map, CALIBRATE_OUTPUT_FILE_S, 0);
+
+  if (utility_get_option_string_table_size (arg_map) != 1)
+    {
+      goto print_calibrate_usage;
+    }
+
+  if (check_database_name (db_name))
+    {
+      goto error_exit;
+    }
+
+  /* error message log file */
+  snprintf (er_msg_file, sizeof (er_msg_file) - 1, "%s_%s.err", db_name, arg->command_name);
+  er_init (er_msg_file, ER_NEVER_EXIT);
+
+  db = cfg_find_db (db_name);
+  if (db == NULL)
+    {
+      PRINT_AND_LOG_ERR_MSG ("%s\n", db_error_string (3));
+      goto error_exit;
+    }
+
+  if (output_file == NULL)
+    {
+      outfp = stdout;
+    }
+  else
+    {
+      outfp = fopen (output_file, "w");
+      if (outfp == NULL)
+	{
+	  PRINT_AND_LOG_ERR_MSG (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_CALIBRATEDB,
+						 CALIBRATEDB_MSG_BAD_OUTPUT), output_file);
+	  goto error_exit;
+	}
+    }
+
+  /* measure on the first data volume; it lives on the same device as the rest of the database */
+  COMPOSE_FULL_NAME (vol_path, sizeof (vol_path), db->pathname, db_name);
+
+  vdes = fileio_open (vol_path, O_RDONLY, 0);
+  if (vdes == NULL_VOLDES)
+    {
+      PRINT_AND_LOG_ERR_MSG ("%s: %s\n", vol_path, strerror (errno));
+      goto error_exit;
+    }
+
+  vol_npages = fileio_get_number_of_volume_pages (vdes, IO_DEFAULT_PAGE_SIZE);
+  if (vol_npages <= 0)
+    {
+      PRINT_AND_LOG_ERR_MSG ("%s\n", db_error_string (3));
+      goto error_exit;
+    }
+
+  io_page = (char *) malloc (IO_DEFAULT_PAGE_SIZE);
+  if (io_page == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_DEFAULT_PAGE_SIZE);
+      PRINT_AND_LOG_ERR_MSG ("%s\n", db_error_string (3));
+      goto error_exit;
+    }
+
+  tsc_init ();
+
+  /* sequential page reads */
+  tsc_getticks (&start_tick);
+  for (i = 0; i < npages; i++)
+    {
+      if (fileio_read (NULL, vdes, io_page, i % vol_npages, IO_DEFAULT_PAGE_SIZE) == NULL)
+	{
+	  PRINT_AND_LOG_ERR_MSG ("%s\n", db_error_string (3));
+	  goto error_exit;
+	}
+    }
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv, end_tick, start_tick);
+  seq_usec = (tv.tv_sec * 1000000.0 + tv.tv_usec) / npages;
+
+  /* random page reads, spread over the whole volume */
+  srand ((unsigned int) time (NULL));
+  tsc_getticks (&start_tick);
+  for (i = 0; i < npages; i++)
+    {
+      if (fileio_read (NULL, vdes, io_page, rand () % vol_npages, IO_DEFAULT_PAGE_SIZE) == NULL)
+	{
+	  PRINT_AND_LOG_ERR_MSG ("%s\n", db_error_string (3));
+	  goto error_exit;
+	}
+    }
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv, end_tick, start_tick);
+  rand_usec = (tv.tv_sec * 1000000.0 + tv.tv_usec) / npages;
+
+  /* per-comparison CPU cost: short key comparisons against the page just read, the way a qualification predicate
+   * compares an attribute against a constant; cmp_result is volatile so the loop is not optimized away */
+  tsc_getticks (&start_tick);
+  for (i = 0; i < CALIBRATE_NUM_COMPARES; i++)
+    {
+      cmp_result += memcmp (io_page + (i % (IO_DEFAULT_PAGE_SIZE / 2)),
+			    io_page + (IO_DEFAULT_PAGE_SIZE / 2)
+			    + (i % (IO_DEFAULT_PAGE_SIZE / 2 - (int) sizeof (DB_BIGINT))), sizeof (DB_BIGINT));
+    }
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv, end_tick, start_tick);
+  cmp_usec = (tv.tv_sec * 1000000.0 + tv.tv_usec) / CALIBRATE_NUM_COMPARES;
+
+  /* the optimizer weights one comparison against one page read */
+  cpu_weight = cmp_usec / MAX (rand_usec, 0.001);
+  cpu_weight = MIN (MAX (cpu_weight, 0.0), 1.0);
+
+  fprintf (outfp, "\n*** COST MODEL CALIBRATION OF DATABASE %s ***\n\n", db_name);
+  fprintf (outfp, "volume                   : %s\n", vol_path);
+  fprintf (outfp, "pages sampled            : %d of %d\n", npages, vol_npages);
+  fprintf (outfp, "sequential read          : %10.3f usec/page\n", seq_usec);
+  fprintf (outfp, "random read              : %10.3f usec/page\n", rand_usec);
+  fprintf (outfp, "qualification comparison : %10.6f usec/compare\n", cmp_usec);
+  fprintf (outfp, "\n# add to cubrid.conf to apply the measured ratio\n");
+  fprintf (outfp, "optimizer_cpu_weight=%f\n", cpu_weight);
+
+  fileio_close (vdes);
+  free_and_init (io_page);
+  cfg_free_directory (db);
+
+  fflush (outfp);
+  if (output_file != NULL && outfp != NULL && outfp != stdout)
+    {
+      fclose (outfp);
+    }
+
+  return EXIT_SUCCESS;
+
+print_calibrate_usage:
+  fprintf (stderr, msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_CALIBRATEDB, CALIBRATEDB_MSG_USAGE),
+	   basename (arg->argv0));
+  util_log_write_errid (MSGCAT_UTIL_GENERIC_INVALID_ARGUMENT);
+
+error_exit:
+  if (vdes != NULL_VOLDES)
+    {
+      fileio_close (vdes);
+    }
+  if (io_page != NULL)
+    {
+      free_and_init (io_page);
+    }
+  if (db != NULL)
+    {
+      cfg_free_directory (db);
+    }
+  if (output_file != NULL && outfp != NULL && outfp != stdout)
+    {
+      fclose (outfp);
+    }
+
+  return EXIT_FAILURE;
+}
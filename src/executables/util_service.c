@@ -192,6 +192,7 @@ static UTIL_SERVICE_OPTION_MAP_T us_Service_map[] = {
   {ADMIN, UTIL_OPTION_VACUUMDB, MASK_ADMIN},
   {ADMIN, UTIL_OPTION_CHECKSUMDB, MASK_ADMIN},
   {ADMIN, UTIL_OPTION_TDE, MASK_ADMIN},
+  {ADMIN, UTIL_OPTION_CALIBRATEDB, MASK_ADMIN},
   {-1, "", MASK_ADMIN}
 };
 
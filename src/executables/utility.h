@@ -89,6 +89,7 @@ typedef enum
   MSGCAT_UTIL_SET_VACUUMDB = 55,
   MSGCAT_UTIL_SET_CHECKSUMDB = 56,
   MSGCAT_UTIL_SET_TDE = 57,
+  MSGCAT_UTIL_SET_CALIBRATEDB = 58,
 } MSGCAT_UTIL_SET;
 
 /* Message id in the set MSGCAT_UTIL_SET_GENERIC */
@@ -420,7 +421,10 @@ typedef enum
   COMPACTDB_MSG_RECLAIM_ERROR = 43,
   COMPACTDB_MSG_PASS3 = 44,
   COMPACTDB_MSG_HEAP_COMPACT_FAILED = 45,
-  COMPACTDB_MSG_HEAP_COMPACT_SUCCEEDED = 46
+  COMPACTDB_MSG_HEAP_COMPACT_SUCCEEDED = 46,
+  COMPACTDB_MSG_STOP_REQUESTED = 47,
+  COMPACTDB_MSG_RESUMING = 48,
+  COMPACTDB_MSG_RESUME_DISCARDED = 49
 } MSGCAT_COMPACTDB_MSG;
 
 /* Message id in the set MSGCAT_UTIL_SET_UNLOADDB */
@@ -704,6 +708,13 @@ typedef enum
   TDE_MSG_USAGE = 60
 } MSGCAT_TDE_MSG;
 
+/* Message id in the set MSGCAT_UTIL_SET_CALIBRATEDB */
+typedef enum
+{
+  CALIBRATEDB_MSG_BAD_OUTPUT = 15,
+  CALIBRATEDB_MSG_USAGE = 60
+} MSGCAT_CALIBRATEDB_MSG;
+
 typedef void *DSO_HANDLE;
 
 typedef enum
@@ -751,6 +762,7 @@ typedef enum
   CHECKSUMDB,
   TDE,
   LOGFILEDUMP,
+  CALIBRATEDB,
 } UTIL_INDEX;
 
 typedef enum
@@ -956,6 +968,7 @@ typedef struct _ha_config
 #define UTIL_OPTION_VACUUMDB			"vacuumdb"
 #define UTIL_OPTION_CHECKSUMDB			"checksumdb"
 #define UTIL_OPTION_TDE			        "tde"
+#define UTIL_OPTION_CALIBRATEDB			"calibratedb"
 
 #define HIDDEN_CS_MODE_S                        15000
 
@@ -1338,6 +1351,10 @@ typedef struct _ha_config
 #define COMPACT_CLASS_LOCK_TIMEOUT_L		"class-lock-timeout"
 #define COMPACT_STANDBY_CS_MODE_S               12000
 #define COMPACT_STANDBY_CS_MODE_L               "standby"
+#define COMPACT_SLEEP_MSECS_S			's'
+#define COMPACT_SLEEP_MSECS_L			"sleep-msecs"
+#define COMPACT_RESUME_S			'r'
+#define COMPACT_RESUME_L			"resume"
 
 /* sqlx option list */
 #define CSQL_SA_MODE_S                          'S'
@@ -1626,6 +1643,12 @@ typedef struct _ha_config
 #define TDE_DBA_PASSWORD_S    'p'
 #define TDE_DBA_PASSWORD_L    "dba-password"
 
+/* calibratedb option list */
+#define CALIBRATE_PAGES_S			'p'
+#define CALIBRATE_PAGES_L			"pages"
+#define CALIBRATE_OUTPUT_FILE_S			'o'
+#define CALIBRATE_OUTPUT_FILE_L			"output-file"
+
 #if defined(WINDOWS)
 #define LIB_UTIL_CS_NAME                "cubridcs.dll"
 #define LIB_UTIL_SA_NAME                "cubridsa.dll"
@@ -1759,6 +1782,7 @@ extern "C"
   extern int vacuumdb (UTIL_FUNCTION_ARG * arg_map);
   extern int checksumdb (UTIL_FUNCTION_ARG * arg_map);
   extern int tde (UTIL_FUNCTION_ARG * arg_map);
+  extern int calibratedb (UTIL_FUNCTION_ARG * arg_map);
 
   extern void util_admin_usage (const char *argv0);
   extern void util_admin_version (const char *argv0);
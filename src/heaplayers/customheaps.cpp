@@ -136,3 +136,69 @@ hl_ostk_free (UINTPTR heap_id, void *ptr)
     }
 }
 
+//
+// Region Heap
+//
+
+// class definition: a pure bump-pointer arena. free () is a no-op, there is
+// no per-allocation header, and every chunk goes back to the OS at once when
+// the heap is cleared or unregistered.
+class TheRegionHeapType :
+  public ZoneHeap<MallocHeap,32768>
+{
+public:
+  int m_chunk_size;
+};
+
+// initialize & finalize
+UINTPTR
+hl_register_region_heap (int chunk_size)
+{
+  TheRegionHeapType *th = new TheRegionHeapType;
+  if (th)
+    {
+      th->m_chunk_size = chunk_size;
+      th->reset (chunk_size);
+      return (UINTPTR) th;
+    }
+  return 0;
+}
+
+void
+hl_unregister_region_heap (UINTPTR heap_id)
+{
+  TheRegionHeapType *th = (TheRegionHeapType *) heap_id;
+  if (th)
+    {
+      delete th;
+    }
+}
+
+// alloc; individual free is a no-op by design
+void *
+hl_region_alloc (UINTPTR heap_id, size_t sz)
+{
+  TheRegionHeapType *th = (TheRegionHeapType *) heap_id;
+  if (th)
+    {
+      return th->malloc (sz);
+    }
+  return NULL;
+}
+
+// bulk release: drop every chunk and leave the heap empty for reuse
+void
+hl_clear_region_heap (UINTPTR heap_id)
+{
+  TheRegionHeapType *th = (TheRegionHeapType *) heap_id;
+  if (th)
+    {
+      int chunk_size = th->m_chunk_size;
+
+      th->~TheRegionHeapType ();
+      new (th) TheRegionHeapType;
+      th->m_chunk_size = chunk_size;
+      th->reset (chunk_size);
+    }
+}
+
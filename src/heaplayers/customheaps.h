@@ -32,6 +32,11 @@ extern void hl_unregister_ostk_heap (UINTPTR heap_id);
 extern void *hl_ostk_alloc (UINTPTR heap_id, size_t sz);
 extern void hl_ostk_free (UINTPTR heap_id, void *ptr);
 
+extern UINTPTR hl_register_region_heap (int chunk_size);
+extern void hl_unregister_region_heap (UINTPTR heap_id);
+extern void *hl_region_alloc (UINTPTR heap_id, size_t sz);
+extern void hl_clear_region_heap (UINTPTR heap_id);
+
 extern UINTPTR hl_register_lea_heap (void);
 extern void hl_unregister_lea_heap (UINTPTR heap_id);
 extern void *hl_lea_alloc (UINTPTR heap_id, size_t sz);
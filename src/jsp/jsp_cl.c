@@ -31,6 +31,9 @@
 #include <winsock2.h>
 #endif /* not WINDOWS */
 
+#include <string>
+#include <unordered_map>
+
 #include "authenticate.h"
 #include "error_manager.h"
 #include "memory_alloc.h"
@@ -110,6 +113,25 @@ static int server_port = -1;
 static int call_cnt = 0;
 static bool is_prepare_call[MAX_CALL_COUNT];
 
+/* *INDENT-OFF* */
+/* Resolving a stored procedure costs several object fetches against _db_stored_procedure (target, argument
+ * count, mode and type per argument, return type).  A method scan that drives a Java SP pays that catalog
+ * walk for every row, and it dominates the per-row cost.  Cache the resolved signature by procedure name;
+ * the cache is flushed whenever the transaction changes (so stored procedure DDL committed by other clients
+ * becomes visible) and whenever this client runs stored procedure DDL itself. */
+typedef struct sp_signature
+{
+  std::string target;
+  int arg_count;
+  int arg_mode[MAX_ARG_COUNT];
+  int arg_type[MAX_ARG_COUNT];
+  int return_type;
+} SP_SIGNATURE;
+
+static std::unordered_map<std::string, SP_SIGNATURE> jsp_Signature_cache;
+static int jsp_Signature_cache_tran_id = -1;
+/* *INDENT-ON* */
+
 #if defined(WINDOWS)
 static FARPROC jsp_old_hook = NULL;
 #endif /* WINDOWS */
@@ -172,6 +194,10 @@ static int jsp_receive_error (char *&buffer, char *&ptr, const SP_ARGS * sp_args
 static int jsp_execute_stored_procedure (const SP_ARGS * args);
 static int jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const char *name);
 
+static void jsp_invalidate_signature_cache (void);
+static SP_SIGNATURE *jsp_find_cached_signature (const char *name);
+static void jsp_cache_signature (const char *name, const SP_ARGS * sp_args);
+
 extern bool ssl_client;
 
 /*
@@ -708,6 +734,8 @@ jsp_alter_stored_procedure (PARSER_CONTEXT * parser, PT_NODE * statement)
       pr_clear_value (&user_val);
     }
 
+  jsp_invalidate_signature_cache ();
+
 error:
 
   pr_clear_value (&user_val);
@@ -1231,6 +1259,8 @@ drop_stored_procedure (const char *name, PT_MISC_TYPE expected_type)
 
   err = obj_delete (sp_mop);
 
+  jsp_invalidate_signature_cache ();
+
 error:
   AU_ENABLE (save);
 
@@ -2847,6 +2877,74 @@ end:
   return error;
 }
 
+/*
+ * jsp_invalidate_signature_cache - drop all cached stored procedure signatures
+ *   return: none
+ *
+ * Note:
+ */
+
+static void
+jsp_invalidate_signature_cache (void)
+{
+  jsp_Signature_cache.clear ();
+  jsp_Signature_cache_tran_id = -1;
+}
+
+/*
+ * jsp_find_cached_signature - look up a signature resolved earlier in the current transaction
+ *   return: cached signature or NULL
+ *   name(in): stored procedure name
+ *
+ * Note:
+ */
+
+static SP_SIGNATURE *
+jsp_find_cached_signature (const char *name)
+{
+  if (jsp_Signature_cache_tran_id != TM_TRAN_ID ())
+    {
+      /* signatures resolved in an earlier transaction may be stale */
+      jsp_invalidate_signature_cache ();
+      return NULL;
+    }
+
+  // *INDENT-OFF*
+  auto found = jsp_Signature_cache.find (name);
+  // *INDENT-ON*
+  if (found == jsp_Signature_cache.end ())
+    {
+      return NULL;
+    }
+
+  return &found->second;
+}
+
+/*
+ * jsp_cache_signature - remember a resolved signature for reuse within the current transaction
+ *   return: none
+ *   name(in): stored procedure name
+ *   sp_args(in): fully resolved call information
+ *
+ * Note:
+ */
+
+static void
+jsp_cache_signature (const char *name, const SP_ARGS * sp_args)
+{
+  // *INDENT-OFF*
+  SP_SIGNATURE &sig = jsp_Signature_cache[name];
+  // *INDENT-ON*
+
+  sig.target = sp_args->name;
+  sig.arg_count = sp_args->arg_count;
+  memcpy (sig.arg_mode, sp_args->arg_mode, sizeof (int) * sp_args->arg_count);
+  memcpy (sig.arg_type, sp_args->arg_type, sizeof (int) * sp_args->arg_count);
+  sig.return_type = sp_args->return_type;
+
+  jsp_Signature_cache_tran_id = TM_TRAN_ID ();
+}
+
 /*
  * jsp_do_call_stored_procedure -
  *   return: Error Code
@@ -2862,6 +2960,7 @@ jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const ch
 {
   DB_OBJECT *mop_p, *arg_mop_p;
   SP_ARGS sp_args;
+  SP_SIGNATURE *sig;
   DB_VALUE method, param, param_cnt_val, return_type, temp, mode, arg_type;
   int arg_cnt, param_cnt, i;
   DB_SET *param_set;
@@ -2874,6 +2973,47 @@ jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const ch
   db_make_null (&param);
   memset (&sp_args, 0, sizeof (SP_ARGS));
 
+  sp_args.returnval = returnval;
+  sp_args.args = args;
+
+  sig = jsp_find_cached_signature (name);
+  if (sig != NULL)
+    {
+      /* the catalog walk below was already done for this procedure in the current transaction */
+      sp_args.name = sig->target.c_str ();
+
+      arg_cnt = jsp_get_argument_count (&sp_args);
+      if (sig->arg_count != arg_cnt)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_SP_INVALID_PARAM_COUNT, 2, sig->arg_count, arg_cnt);
+	  err = er_errid ();
+	  goto error;
+	}
+      sp_args.arg_count = arg_cnt;
+
+      memcpy (sp_args.arg_mode, sig->arg_mode, sizeof (int) * arg_cnt);
+      memcpy (sp_args.arg_type, sig->arg_type, sizeof (int) * arg_cnt);
+      sp_args.return_type = sig->return_type;
+
+      for (i = 0; i < arg_cnt; i++)
+	{
+	  if (sp_args.arg_type[i] == DB_TYPE_RESULTSET && !is_prepare_call[call_cnt])
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_SP_CANNOT_RETURN_RESULTSET, 0);
+	      err = er_errid ();
+	      goto error;
+	    }
+	}
+
+      if (sp_args.return_type == DB_TYPE_RESULTSET && !is_prepare_call[call_cnt])
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_SP_CANNOT_RETURN_RESULTSET, 0);
+	  err = er_errid ();
+	}
+
+      goto error;
+    }
+
   mop_p = jsp_find_stored_procedure (name);
   if (!mop_p)
     {
@@ -2895,8 +3035,6 @@ jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const ch
       err = er_errid ();
       goto error;
     }
-  sp_args.returnval = returnval;
-  sp_args.args = args;
 
   err = db_get (mop_p, SP_ATTR_ARG_COUNT, &param_cnt_val);
   if (err != NO_ERROR)
@@ -2962,6 +3100,9 @@ jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const ch
 
   sp_args.return_type = db_get_int (&return_type);
 
+  /* fully resolved; the next call of this procedure in the current transaction skips the catalog walk */
+  jsp_cache_signature (name, &sp_args);
+
   if (sp_args.return_type == DB_TYPE_RESULTSET && !is_prepare_call[call_cnt])
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_SP_CANNOT_RETURN_RESULTSET, 0);
@@ -82,6 +82,33 @@ namespace cubload
     m_qstr_buf_ptr[m_qstr_buf_idx++] = c;
   }
 
+  void
+  semantic_helper::append_bytes (const char *str, std::size_t len)
+  {
+    if (m_use_qstr_buf)
+      {
+	extend_quoted_string_buffer (m_qstr_buf_idx + len);
+      }
+    else
+      {
+	if (m_qstr_buf_idx + len > MAX_QUOTED_STR_BUF_SIZE)
+	  {
+	    char *qstr_buf_tmp = m_qstr_buf_ptr;
+	    extend_quoted_string_buffer (std::max (m_qstr_buf_idx + len, MAX_QUOTED_STR_BUF_SIZE * 2));
+
+	    // in case we switch from m_qstr_buf_pool to m_qstr_buf
+	    // we need to copy accumulated data to the new memory location
+	    std::memcpy (m_qstr_buf_ptr, qstr_buf_tmp, m_qstr_buf_idx);
+
+	    m_qstr_buf_pool_idx--;
+	    m_use_qstr_buf = true;
+	  }
+      }
+
+    std::memcpy (m_qstr_buf_ptr + m_qstr_buf_idx, str, len);
+    m_qstr_buf_idx += len;
+  }
+
   string_type *
   semantic_helper::append_string_list (string_type *head, string_type *tail)
   {
@@ -74,6 +74,7 @@ namespace cubload
       ~semantic_helper ();
 
       void append_char (char c);
+      void append_bytes (const char *str, std::size_t len);
       string_type *append_string_list (string_type *head, string_type *tail);
       constant_type *append_constant_list (constant_type *head, constant_type *tail);
 
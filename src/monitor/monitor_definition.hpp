@@ -23,6 +23,8 @@
 #if !defined _MONITOR_DEFINITION_HPP_
 #define _MONITOR_DEFINITION_HPP_
 
+#include "tsc_clock.hpp"
+
 #include <chrono>
 
 #include <cstdint>
@@ -32,8 +34,8 @@ namespace cubmonitor
   // statistic common representation used on monitor fetching its values
   using statistic_value = std::uint64_t;
 
-  // clocking
-  using clock_type = std::chrono::high_resolution_clock;
+  // clocking; time-stamp counter based, cheap enough to sample on hot paths
+  using clock_type = cubperf::tsc_clock;
   using time_point = clock_type::time_point;
   using duration = clock_type::duration;
 
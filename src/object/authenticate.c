@@ -420,6 +420,16 @@ static int Au_cache_increment = 4;
  */
 static int Au_cache_index = -1;
 
+/*
+ * Au_cache_needs_revalidation
+ *
+ * Set at transaction boundaries instead of wiping the caches immediately.
+ * The first authorization check of the next transaction asks the server
+ * whether the authorization catalogs actually changed and keeps the caches
+ * when they did not.
+ */
+static bool Au_cache_needs_revalidation = false;
+
 static const char *auth_type_name[] = {
   "select", "insert", "update", "delete", "alter", "index", "execute"
 };
@@ -495,6 +505,7 @@ static int au_extend_class_caches (int *index);
 static int au_find_user_cache_index (DB_OBJECT * user, int *index, int check_it);
 static void free_user_cache (AU_USER_CACHE * u);
 static void reset_cache_for_user_and_class (SM_CLASS * sm_class);
+static void au_revalidate_cache (void);
 
 static void remove_user_cache_references (MOP user);
 static void init_caches (void);
@@ -1013,16 +1024,45 @@ reset_cache_for_user_and_class (SM_CLASS * sm_class)
  *       Normally this is done when the authorization for this
  *       class changes in some way.  The next time the cache is used, it
  *       will force the recomputation of the authorization bits.
- *       We should try to be smarter and flush the caches only when we know
- *       that the authorization catalogs have changed in some way.
+ *       Wiping is deferred to au_revalidate_cache() so that the caches can
+ *       be kept when the server reports that the authorization catalogs
+ *       did not change since the last validation.
  */
 
 void
 au_reset_authorization_caches (void)
+{
+  Au_cache_needs_revalidation = true;
+}
+
+/*
+ * au_revalidate_cache - Validate the authorization caches after a
+ *                       transaction boundary.
+ *   return: none
+ *
+ * Note: Called before the cached bits are consulted.  When the server
+ *       authorization generation is unchanged since the last validation,
+ *       no grant, revoke or user change was committed by anybody and the
+ *       caches are still correct; otherwise they are all invalidated as
+ *       au_reset_authorization_caches() traditionally did.
+ */
+static void
+au_revalidate_cache (void)
 {
   AU_CLASS_CACHE *c;
   int i;
 
+  if (!Au_cache_needs_revalidation)
+    {
+      return;
+    }
+  Au_cache_needs_revalidation = false;
+
+  if (locator_is_authorization_cache_usable ())
+    {
+      return;
+    }
+
   for (c = Au_class_caches; c != NULL; c = c->next)
     {
       for (i = 0; i < Au_cache_depth; i++)
@@ -4331,6 +4371,8 @@ check_grant_option (MOP classop, SM_CLASS * sm_class, DB_AUTH type)
   if (Au_cache_index < 0)
     return NO_ERROR;
 
+  au_revalidate_cache ();
+
   cache = (AU_CLASS_CACHE *) sm_class->auth_cache;
   if (sm_class->auth_cache == NULL)
     {
@@ -5867,6 +5909,8 @@ check_authorization (MOP classobj, SM_CLASS * sm_class, DB_AUTH type)
       return NO_ERROR;
     }
 
+  au_revalidate_cache ();
+
   /* try to catch attempts by even the DBA to update a protected class */
   if ((sm_class->flags & SM_CLASSFLAG_SYSTEM) && is_protected_class (classobj, sm_class, type))
     {
@@ -8565,6 +8609,8 @@ au_get_class_privilege (DB_OBJECT * mop, unsigned int *auth)
 
       class_ = (SM_CLASS *) mop->object;
 
+      au_revalidate_cache ();
+
       cache = (AU_CLASS_CACHE *) class_->auth_cache;
       if (cache == NULL)
 	{
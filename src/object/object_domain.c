@@ -98,6 +98,9 @@ typedef enum tp_coersion_mode
   TP_FORCE_COERCION
 } TP_COERCION_MODE;
 
+/* direct conversion kernel of a memoized coercion plan (see TP_CAST_CACHE) */
+typedef TP_DOMAIN_STATUS (*TP_CAST_KERNEL_FUNC) (const DB_VALUE * src, DB_VALUE * dest);
+
 /*
  * These are arranged to get relative types for symmetrical
  * coercion selection. The absolute position is not critical.
@@ -583,6 +586,7 @@ static int bfmt_print (int bfmt, const DB_VALUE * the_db_bit, char *string, int
 static TP_DOMAIN_STATUS tp_value_cast_internal (const DB_VALUE * src, DB_VALUE * dest, const TP_DOMAIN * desired_domain,
 						TP_COERCION_MODE coercion_mode, bool do_domain_select,
 						bool preserve_domain);
+static TP_CAST_KERNEL_FUNC tp_cast_cache_resolve (DB_TYPE src_type, const TP_DOMAIN * desired_domain);
 static DB_VALUE_COMPARE_RESULT oidcmp (OID * oid1, OID * oid2);
 static int tp_domain_match_internal (const TP_DOMAIN * dom1, const TP_DOMAIN * dom2, TP_MATCH exact, bool match_order);
 #if defined(CUBRID_DEBUG)
@@ -967,6 +971,12 @@ tp_domain_free (TP_DOMAIN * dom)
 	  tp_domain_clear_enumeration (&DOM_GET_ENUMERATION (dom));
 	}
 
+      if (dom->midxkey_cmp_desc != NULL)
+	{
+	  pr_midxkey_cmp_desc_free (dom->midxkey_cmp_desc);
+	  dom->midxkey_cmp_desc = NULL;
+	}
+
       (void) area_free (tp_Domain_area, dom);
     }
 }
@@ -995,6 +1005,7 @@ tp_domain_init (TP_DOMAIN * domain, DB_TYPE type_id)
   domain->self_ref = 0;
   domain->setdomain = NULL;
   domain->json_validator = NULL;
+  domain->midxkey_cmp_desc = NULL;
   DOM_SET_ENUM (domain, NULL, 0);
   OID_SET_NULL (&domain->class_oid);
 
@@ -10213,6 +10224,277 @@ tp_value_cast_force (const DB_VALUE * src, DB_VALUE * dest, const TP_DOMAIN * de
   return tp_value_cast_internal (src, dest, desired_domain, mode, true, false);
 }
 
+/*
+ * tp_cast_kernel_clone - Conversion kernel for an exact type match on a
+ *    non-parameterized domain; mirrors the clone shortcut at the top of
+ *    tp_value_cast_internal.
+ *    return: DOMAIN_COMPATIBLE
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ */
+static TP_DOMAIN_STATUS
+tp_cast_kernel_clone (const DB_VALUE * src, DB_VALUE * dest)
+{
+  if (src != dest)
+    {
+      pr_clone_value ((DB_VALUE *) src, dest);
+    }
+  return DOMAIN_COMPATIBLE;
+}
+
+/*
+ * tp_cast_kernel_short_to_int - Conversion kernel, DB_TYPE_SHORT source.
+ *    return: DOMAIN_COMPATIBLE
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ */
+static TP_DOMAIN_STATUS
+tp_cast_kernel_short_to_int (const DB_VALUE * src, DB_VALUE * dest)
+{
+  db_make_int (dest, db_get_short (src));
+  return DOMAIN_COMPATIBLE;
+}
+
+/*
+ * tp_cast_kernel_short_to_bigint - Conversion kernel, DB_TYPE_SHORT source.
+ *    return: DOMAIN_COMPATIBLE
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ */
+static TP_DOMAIN_STATUS
+tp_cast_kernel_short_to_bigint (const DB_VALUE * src, DB_VALUE * dest)
+{
+  db_make_bigint (dest, db_get_short (src));
+  return DOMAIN_COMPATIBLE;
+}
+
+/*
+ * tp_cast_kernel_int_to_bigint - Conversion kernel, DB_TYPE_INTEGER source.
+ *    return: DOMAIN_COMPATIBLE
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ */
+static TP_DOMAIN_STATUS
+tp_cast_kernel_int_to_bigint (const DB_VALUE * src, DB_VALUE * dest)
+{
+  db_make_bigint (dest, db_get_int (src));
+  return DOMAIN_COMPATIBLE;
+}
+
+/*
+ * tp_cast_kernel_short_to_double - Conversion kernel, DB_TYPE_SHORT source.
+ *    return: DOMAIN_COMPATIBLE
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ */
+static TP_DOMAIN_STATUS
+tp_cast_kernel_short_to_double (const DB_VALUE * src, DB_VALUE * dest)
+{
+  db_make_double (dest, (double) db_get_short (src));
+  return DOMAIN_COMPATIBLE;
+}
+
+/*
+ * tp_cast_kernel_int_to_double - Conversion kernel, DB_TYPE_INTEGER source.
+ *    return: DOMAIN_COMPATIBLE
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ */
+static TP_DOMAIN_STATUS
+tp_cast_kernel_int_to_double (const DB_VALUE * src, DB_VALUE * dest)
+{
+  db_make_double (dest, (double) db_get_int (src));
+  return DOMAIN_COMPATIBLE;
+}
+
+/*
+ * tp_cast_kernel_bigint_to_double - Conversion kernel, DB_TYPE_BIGINT source.
+ *    return: DOMAIN_COMPATIBLE
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ */
+static TP_DOMAIN_STATUS
+tp_cast_kernel_bigint_to_double (const DB_VALUE * src, DB_VALUE * dest)
+{
+  db_make_double (dest, (double) db_get_bigint (src));
+  return DOMAIN_COMPATIBLE;
+}
+
+/*
+ * tp_cast_kernel_float_to_double - Conversion kernel, DB_TYPE_FLOAT source.
+ *    return: DOMAIN_COMPATIBLE
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ */
+static TP_DOMAIN_STATUS
+tp_cast_kernel_float_to_double (const DB_VALUE * src, DB_VALUE * dest)
+{
+  db_make_double (dest, (double) db_get_float (src));
+  return DOMAIN_COMPATIBLE;
+}
+
+/*
+ * tp_cast_cache_resolve - Resolve the conversion kernel of a memoized
+ *    coercion plan for a (source type, desired domain) pair.
+ *    return: conversion kernel, or NULL when the generic path must run
+ *    src_type(in): type of the source value, never DB_TYPE_NULL
+ *    desired_domain(in): destination domain
+ * Note:
+ *    Only conversions whose outcome depends on nothing but the source type
+ *    and the destination domain are compiled: the exact-match clone and the
+ *    widening numeric conversions that cannot overflow and carry no
+ *    precision, scale or collation parameters.  Their kernels reproduce the
+ *    corresponding arms of tp_value_cast_internal exactly and are valid
+ *    under every coercion mode, so the cache does not key on the mode.
+ */
+static TP_CAST_KERNEL_FUNC
+tp_cast_cache_resolve (DB_TYPE src_type, const TP_DOMAIN * desired_domain)
+{
+  DB_TYPE desired_type;
+
+  if (desired_domain->next != NULL)
+    {
+      /* multi-domain target; tp_domain_select must run for each value */
+      return NULL;
+    }
+
+  desired_type = TP_DOMAIN_TYPE (desired_domain);
+
+  if (src_type == desired_type)
+    {
+      if (!desired_domain->is_parameterized && src_type != DB_TYPE_JSON)
+	{
+	  return tp_cast_kernel_clone;
+	}
+      return NULL;
+    }
+
+  if (src_type == DB_TYPE_JSON)
+    {
+      /* scalar values wrapped in a JSON document are unwrapped by the generic path */
+      return NULL;
+    }
+
+  switch (desired_type)
+    {
+    case DB_TYPE_INTEGER:
+      if (src_type == DB_TYPE_SHORT)
+	{
+	  return tp_cast_kernel_short_to_int;
+	}
+      break;
+
+    case DB_TYPE_BIGINT:
+      switch (src_type)
+	{
+	case DB_TYPE_SHORT:
+	  return tp_cast_kernel_short_to_bigint;
+	case DB_TYPE_INTEGER:
+	  return tp_cast_kernel_int_to_bigint;
+	default:
+	  break;
+	}
+      break;
+
+    case DB_TYPE_DOUBLE:
+      switch (src_type)
+	{
+	case DB_TYPE_SHORT:
+	  return tp_cast_kernel_short_to_double;
+	case DB_TYPE_INTEGER:
+	  return tp_cast_kernel_int_to_double;
+	case DB_TYPE_BIGINT:
+	  return tp_cast_kernel_bigint_to_double;
+	case DB_TYPE_FLOAT:
+	  return tp_cast_kernel_float_to_double;
+	default:
+	  break;
+	}
+      break;
+
+    default:
+      break;
+    }
+
+  return NULL;
+}
+
+/*
+ * tp_value_cast_cached - Coerce a value into one of another domain,
+ *    memoizing the coercion plan at the call site.
+ *    return: TP_DOMAIN_STATUS
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ *    desired_domain(in):
+ *    implicit_coercion(in): flag for the coercion is implicit
+ *    cache(in/out): coercion plan owned by the call site
+ * Note:
+ *    Semantics are identical to tp_value_cast.  The conversion strategy is
+ *    resolved on the first execution and reused while the (source type,
+ *    desired domain) pair stays the same, so a per-tuple cast at a fixed
+ *    XASL site becomes a direct function call instead of the full domain
+ *    walk of tp_value_cast_internal.
+ */
+TP_DOMAIN_STATUS
+tp_value_cast_cached (const DB_VALUE * src, DB_VALUE * dest, const TP_DOMAIN * desired_domain, bool implicit_coercion,
+		      TP_CAST_CACHE * cache)
+{
+  DB_TYPE src_type;
+
+  if (src != NULL && desired_domain != NULL && (src_type = DB_VALUE_TYPE (src)) != DB_TYPE_NULL)
+    {
+      if (cache->dest_domain != desired_domain || cache->src_type != src_type)
+	{
+	  cache->dest_domain = desired_domain;
+	  cache->src_type = src_type;
+	  cache->cast_func = tp_cast_cache_resolve (src_type, desired_domain);
+	}
+      if (cache->cast_func != NULL)
+	{
+	  return cache->cast_func (src, dest);
+	}
+    }
+
+  return tp_value_cast (src, dest, desired_domain, implicit_coercion);
+}
+
+/*
+ * tp_value_cast_force_cached - Coerce a value into one of another domain in
+ *    TP_FORCE_COERCION mode, memoizing the coercion plan at the call site.
+ *    return: TP_DOMAIN_STATUS
+ *    src(in): src DB_VALUE
+ *    dest(out): dest DB_VALUE
+ *    desired_domain(in):
+ *    implicit_coercion(in): flag for the coercion is implicit
+ *    cache(in/out): coercion plan owned by the call site
+ * Note:
+ *    Semantics are identical to tp_value_cast_force; the compiled kernels
+ *    are mode-independent, so the same cache may be shared with
+ *    tp_value_cast_cached.
+ */
+TP_DOMAIN_STATUS
+tp_value_cast_force_cached (const DB_VALUE * src, DB_VALUE * dest, const TP_DOMAIN * desired_domain,
+			    bool implicit_coercion, TP_CAST_CACHE * cache)
+{
+  DB_TYPE src_type;
+
+  if (src != NULL && desired_domain != NULL && (src_type = DB_VALUE_TYPE (src)) != DB_TYPE_NULL)
+    {
+      if (cache->dest_domain != desired_domain || cache->src_type != src_type)
+	{
+	  cache->dest_domain = desired_domain;
+	  cache->src_type = src_type;
+	  cache->cast_func = tp_cast_cache_resolve (src_type, desired_domain);
+	}
+      if (cache->cast_func != NULL)
+	{
+	  return cache->cast_func (src, dest);
+	}
+    }
+
+  return tp_value_cast_force (src, dest, desired_domain, implicit_coercion);
+}
+
 /*
  * tp_value_cast_preserve_domain - Coerce a value into one of another domain.
  *    return: TP_DOMAIN_STATUS
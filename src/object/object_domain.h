@@ -69,6 +69,9 @@ typedef enum
   TP_DOMAIN_COLL_LEAVE = 2
 } TP_DOMAIN_COLL_ACTION;
 
+/* lazily built packed comparison descriptor; see object_primitive.c */
+struct pr_midxkey_cmp_desc;
+
 typedef struct tp_domain
 {
   struct tp_domain *next;	/* next in the same domain list */
@@ -109,6 +112,11 @@ typedef struct tp_domain
   unsigned is_visited:1;
 
   JSON_VALIDATOR *json_validator;	/* schema validator if type is json */
+
+  /* Lazily built per-column comparison descriptor for cached MIDXKEY domains; NULL until the first packed key
+   * comparison resolves it.  Must stay the last member: the built-in domain initializers rely on it being
+   * zero-initialized. */
+  struct pr_midxkey_cmp_desc *midxkey_cmp_desc;
 } TP_DOMAIN;
 
   /*
@@ -210,6 +218,25 @@ typedef enum tp_match
   TP_SET_MATCH
 } TP_MATCH;
 
+/*
+ * TP_CAST_CACHE
+ *    Memoized coercion plan owned by a cast call site that repeatedly
+ *    coerces values of the same source type into the same domain (e.g. an
+ *    implicit cast applied to every tuple by a fixed XASL node).
+ *    tp_value_cast_cached resolves the conversion strategy on the first
+ *    execution; while the (source type, desired domain) pair stays the
+ *    same, later casts skip the generic domain walk and go straight to a
+ *    compiled conversion kernel.  Zero-initialize before first use.
+ */
+typedef struct tp_cast_cache TP_CAST_CACHE;
+struct tp_cast_cache
+{
+  const struct tp_domain *dest_domain;	/* domain the plan was resolved against; NULL while unresolved */
+  DB_TYPE src_type;		/* source value type the plan was resolved against */
+  TP_DOMAIN_STATUS (*cast_func) (const DB_VALUE * src, DB_VALUE * dest);	/* direct conversion kernel; NULL when
+									 * the generic path must run */
+};
+
 /*
  * TP_IS_SET_TYPE
  *    Macros for detecting the set types, saves a function call.
@@ -465,6 +492,14 @@ extern "C"
   extern TP_DOMAIN_STATUS tp_value_cast_force (const DB_VALUE * src, DB_VALUE * dest,
 					       const TP_DOMAIN * desired_domain, bool implicit_coercion);
 
+  extern TP_DOMAIN_STATUS tp_value_cast_cached (const DB_VALUE * src, DB_VALUE * dest,
+						const TP_DOMAIN * desired_domain, bool implicit_coercion,
+						TP_CAST_CACHE * cache);
+
+  extern TP_DOMAIN_STATUS tp_value_cast_force_cached (const DB_VALUE * src, DB_VALUE * dest,
+						      const TP_DOMAIN * desired_domain, bool implicit_coercion,
+						      TP_CAST_CACHE * cache);
+
   extern TP_DOMAIN_STATUS tp_value_cast_preserve_domain (const DB_VALUE * src, DB_VALUE * dest,
 							 const TP_DOMAIN * desired_domain, bool implicit_coercion,
 							 bool preserve_domain);
@@ -213,6 +213,8 @@ pr_type::get_cmpval_function () const
 
 static void mr_initmem_string (void *mem, TP_DOMAIN * domain);
 static int mr_setmem_string (void *memptr, TP_DOMAIN * domain, DB_VALUE * value);
+static int mr_make_small_varchar (DB_VALUE * value, int precision, const char *str, int str_length, int codeset,
+				  int collation_id);
 static int mr_getmem_string (void *memptr, TP_DOMAIN * domain, DB_VALUE * value, bool copy);
 static int mr_data_lengthmem_string (void *memptr, TP_DOMAIN * domain, int disk);
 static int mr_index_lengthmem_string (void *memptr, TP_DOMAIN * domain);
@@ -837,6 +839,8 @@ static int mr_data_readval_midxkey (OR_BUF * buf, DB_VALUE * value, TP_DOMAIN *
 				    char *copy_buf, int copy_buf_len);
 static int mr_index_readval_midxkey (OR_BUF * buf, DB_VALUE * value, TP_DOMAIN * domain, int size, bool copy,
 				     char *copy_buf, int copy_buf_len);
+static struct pr_midxkey_cmp_desc *pr_midxkey_cmp_desc_build (const TP_DOMAIN * midxkey_domain);
+static struct pr_midxkey_cmp_desc *pr_midxkey_cmp_desc_get (TP_DOMAIN * midxkey_domain);
 static DB_VALUE_COMPARE_RESULT pr_midxkey_compare_element (char *mem1, char *mem2, TP_DOMAIN * dom1, TP_DOMAIN * dom2,
 							   int do_coercion, int total_order);
 static DB_VALUE_COMPARE_RESULT mr_index_cmpdisk_midxkey (void *mem1, void *mem2, TP_DOMAIN * domain, int do_coercion,
@@ -1836,6 +1840,8 @@ pr_area_init (void)
       assert (er_errid () != NO_ERROR);
       return er_errid ();
     }
+  /* value containers are allocated and freed at very high rates */
+  area_enable_thread_cache (Value_area);
 
   return NO_ERROR;
 }
@@ -2005,6 +2011,13 @@ pr_clear_value (DB_VALUE * value)
     case DB_TYPE_VARNCHAR:
     case DB_TYPE_BIT:
     case DB_TYPE_VARBIT:
+      if (value->data.ch.info.style == SMALL_STRING)
+	{
+	  /* the string is stored inline; there is no external buffer and no compression info to free */
+	  assert (value->need_clear == false && value->data.ch.info.compressed_need_clear == 0);
+	  break;
+	}
+
       char_medium_buf = value->data.ch.medium.buf;
       if (char_medium_buf != NULL)
 	{
@@ -7703,6 +7716,178 @@ mr_index_readval_midxkey (OR_BUF * buf, DB_VALUE * value, TP_DOMAIN * domain, in
   return rc;
 }
 
+/*
+ * MIDXKEY packed comparison descriptor.
+ *
+ * pr_midxkey_compare () walks the packed key buffers column by column and
+ * re-derives the width and the comparison routine of every column from the
+ * domain list on each call.  The column layout is fully determined by the
+ * midxkey domain, which is immutable once cached, so we resolve it once
+ * into a flat per-column descriptor and reuse it for every later
+ * comparison against the same domain.  This is the single hottest
+ * comparator path for composite-key B-tree operations.
+ */
+
+typedef enum
+{
+  PR_MIDXKEY_CMP_GENERIC,	/* dispatch through dom->type->index_cmpdisk () */
+  PR_MIDXKEY_CMP_MEMCMP,	/* fixed width and byte order equals key order */
+  PR_MIDXKEY_CMP_SHORT,
+  PR_MIDXKEY_CMP_INTEGER,
+  PR_MIDXKEY_CMP_BIGINT
+} PR_MIDXKEY_CMP_KIND;
+
+typedef struct pr_midxkey_cmp_col PR_MIDXKEY_CMP_COL;
+struct pr_midxkey_cmp_col
+{
+  PR_MIDXKEY_CMP_KIND kind;
+  int fixed_size;		/* element disk size, or -1 when variable width */
+};
+
+typedef struct pr_midxkey_cmp_desc PR_MIDXKEY_CMP_DESC;
+struct pr_midxkey_cmp_desc
+{
+  int ncolumns;
+  PR_MIDXKEY_CMP_COL cols[1];	/* actually ncolumns entries */
+};
+
+/*
+ * pr_midxkey_cmp_desc_build - build the per-column comparison descriptor of
+ * a midxkey domain.
+ *    return: new descriptor or NULL on error
+ *    midxkey_domain(in): cached MIDXKEY domain
+ */
+static PR_MIDXKEY_CMP_DESC *
+pr_midxkey_cmp_desc_build (const TP_DOMAIN * midxkey_domain)
+{
+  PR_MIDXKEY_CMP_DESC *desc;
+  PR_MIDXKEY_CMP_COL *col;
+  TP_DOMAIN *dom;
+  size_t size;
+  int ncols, i;
+
+  ncols = midxkey_domain->precision;
+  if (ncols <= 0)
+    {
+      assert (false);
+      return NULL;
+    }
+
+  size = offsetof (struct pr_midxkey_cmp_desc, cols) + ncols * sizeof (PR_MIDXKEY_CMP_COL);
+  desc = (PR_MIDXKEY_CMP_DESC *) malloc (size);
+  if (desc == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return NULL;
+    }
+
+  desc->ncolumns = ncols;
+
+  for (i = 0, dom = midxkey_domain->setdomain; i < ncols && dom != NULL; i++, dom = dom->next)
+    {
+      col = &desc->cols[i];
+
+      col->fixed_size = dom->type->is_index_size_fixed ()? dom->type->disksize : -1;
+      col->kind = PR_MIDXKEY_CMP_GENERIC;
+
+      switch (TP_DOMAIN_TYPE (dom))
+	{
+	case DB_TYPE_SHORT:
+	  col->kind = PR_MIDXKEY_CMP_SHORT;
+	  break;
+	case DB_TYPE_INTEGER:
+	  col->kind = PR_MIDXKEY_CMP_INTEGER;
+	  break;
+	case DB_TYPE_BIGINT:
+	  col->kind = PR_MIDXKEY_CMP_BIGINT;
+	  break;
+	case DB_TYPE_DATE:
+	case DB_TYPE_TIME:
+	case DB_TYPE_TIMESTAMP:
+	case DB_TYPE_TIMESTAMPLTZ:
+	case DB_TYPE_DATETIME:
+	case DB_TYPE_DATETIMELTZ:
+	  /* stored as unsigned big-endian words; unsigned byte comparison yields the key order */
+	  if (col->fixed_size > 0)
+	    {
+	      col->kind = PR_MIDXKEY_CMP_MEMCMP;
+	    }
+	  break;
+	default:
+	  break;
+	}
+    }
+
+  if (i < ncols)
+    {
+      /* broken domain list; leave the descriptor unresolved */
+      assert (false);
+      free (desc);
+      return NULL;
+    }
+
+  return desc;
+}
+
+/*
+ * pr_midxkey_cmp_desc_get - return the comparison descriptor of a midxkey
+ * domain, resolving it on first use.
+ *    return: descriptor or NULL when the domain does not keep one
+ *    midxkey_domain(in): MIDXKEY domain of both compared keys
+ * Note:
+ *    Only cached domains get a descriptor; they are shared and effectively
+ *    immortal, so the descriptor is installed once with an atomic swap and
+ *    read lock-free afterwards.  Transient domains come and go too quickly
+ *    to be worth the allocation.
+ */
+static PR_MIDXKEY_CMP_DESC *
+pr_midxkey_cmp_desc_get (TP_DOMAIN * midxkey_domain)
+{
+  PR_MIDXKEY_CMP_DESC *desc;
+
+  desc = *((PR_MIDXKEY_CMP_DESC * volatile *) &midxkey_domain->midxkey_cmp_desc);
+  if (desc != NULL)
+    {
+      return desc;
+    }
+
+  if (!midxkey_domain->is_cached)
+    {
+      return NULL;
+    }
+
+  desc = pr_midxkey_cmp_desc_build (midxkey_domain);
+  if (desc == NULL)
+    {
+      return NULL;
+    }
+
+  if (!ATOMIC_CAS_ADDR (&midxkey_domain->midxkey_cmp_desc, (struct pr_midxkey_cmp_desc *) NULL,
+			(struct pr_midxkey_cmp_desc *) desc))
+    {
+      /* another thread resolved the same domain first; use its descriptor */
+      free (desc);
+      desc = *((PR_MIDXKEY_CMP_DESC * volatile *) &midxkey_domain->midxkey_cmp_desc);
+    }
+
+  return desc;
+}
+
+/*
+ * pr_midxkey_cmp_desc_free - release the comparison descriptor of a domain
+ * that is being freed.
+ *    return: none
+ *    desc(in/out): descriptor detached from the domain
+ */
+void
+pr_midxkey_cmp_desc_free (struct pr_midxkey_cmp_desc *desc)
+{
+  if (desc != NULL)
+    {
+      free (desc);
+    }
+}
+
 static DB_VALUE_COMPARE_RESULT
 pr_midxkey_compare_element (char *mem1, char *mem2, TP_DOMAIN * dom1, TP_DOMAIN * dom2, int do_coercion,
 			    int total_order)
@@ -7772,6 +7957,7 @@ pr_midxkey_compare (DB_MIDXKEY * mul1, DB_MIDXKEY * mul2, int do_coercion, int t
   char *bitptr1, *bitptr2;
   char *mem1, *mem2;
   int last;
+  PR_MIDXKEY_CMP_DESC *desc = NULL;
 
   assert (total_order == 1);
   if (total_order == 0)
@@ -7854,6 +8040,18 @@ pr_midxkey_compare (DB_MIDXKEY * mul1, DB_MIDXKEY * mul2, int do_coercion, int t
       last = mul1->ncolumns;
     }
 
+  /* Both keys of a B-tree comparison carry the same cached index domain; its packed layout descriptor lets us skip
+   * the per-column domain match and size derivation below. */
+  if (mul1->domain == mul2->domain)
+    {
+      desc = pr_midxkey_cmp_desc_get (mul1->domain);
+      if (desc != NULL && desc->ncolumns < last)
+	{
+	  assert (false);	/* more columns than the domain describes */
+	  desc = NULL;
+	}
+    }
+
   for (i = 0; start_colp && i < *start_colp; i++, dom1 = dom1->next, dom2 = dom2->next)
     {
       if (dom1 == NULL || dom2 == NULL || dom1->is_desc != dom2->is_desc)
@@ -7864,14 +8062,16 @@ pr_midxkey_compare (DB_MIDXKEY * mul1, DB_MIDXKEY * mul2, int do_coercion, int t
 
       if (OR_MULTI_ATT_IS_BOUND (bitptr1, i))
 	{
-	  adv_size1 = pr_midxkey_element_disk_size (mem1, dom1);
+	  adv_size1 = ((desc != NULL && desc->cols[i].fixed_size >= 0)
+		       ? desc->cols[i].fixed_size : pr_midxkey_element_disk_size (mem1, dom1));
 	  mem1 += adv_size1;
 	  size1 += adv_size1;
 	}
 
       if (OR_MULTI_ATT_IS_BOUND (bitptr2, i))
 	{
-	  adv_size2 = pr_midxkey_element_disk_size (mem2, dom2);
+	  adv_size2 = ((desc != NULL && desc->cols[i].fixed_size >= 0)
+		       ? desc->cols[i].fixed_size : pr_midxkey_element_disk_size (mem2, dom2));
 	  mem2 += adv_size2;
 	  size2 += adv_size2;
 	}
@@ -7887,8 +8087,50 @@ pr_midxkey_compare (DB_MIDXKEY * mul1, DB_MIDXKEY * mul2, int do_coercion, int t
 
       if (OR_MULTI_ATT_IS_BOUND (bitptr1, i) && OR_MULTI_ATT_IS_BOUND (bitptr2, i))
 	{
+	  if (desc != NULL)
+	    {
+	      /* same domain on both sides; compare the packed bytes in place */
+	      switch (desc->cols[i].kind)
+		{
+		case PR_MIDXKEY_CMP_INTEGER:
+		  {
+		    int i1 = OR_GET_INT (mem1);
+		    int i2 = OR_GET_INT (mem2);
+
+		    c = (i1 < i2) ? DB_LT : (i1 > i2) ? DB_GT : DB_EQ;
+		  }
+		  break;
+		case PR_MIDXKEY_CMP_SHORT:
+		  {
+		    short s1 = OR_GET_SHORT (mem1);
+		    short s2 = OR_GET_SHORT (mem2);
+
+		    c = (s1 < s2) ? DB_LT : (s1 > s2) ? DB_GT : DB_EQ;
+		  }
+		  break;
+		case PR_MIDXKEY_CMP_BIGINT:
+		  {
+		    DB_BIGINT bi1, bi2;
+
+		    OR_GET_BIGINT (mem1, &bi1);
+		    OR_GET_BIGINT (mem2, &bi2);
+		    c = (bi1 < bi2) ? DB_LT : (bi1 > bi2) ? DB_GT : DB_EQ;
+		  }
+		  break;
+		case PR_MIDXKEY_CMP_MEMCMP:
+		  {
+		    int r = memcmp (mem1, mem2, desc->cols[i].fixed_size);
+
+		    c = (r < 0) ? DB_LT : (r > 0) ? DB_GT : DB_EQ;
+		  }
+		  break;
+		default:
+		  c = dom1->type->index_cmpdisk (mem1, mem2, dom1, do_coercion, total_order, NULL);
+		  break;
+		}
+	    }
 	  /* check for val1 and val2 same domain */
-	  if (dom1 == dom2 || tp_domain_match (dom1, dom2, TP_EXACT_MATCH))
+	  else if (dom1 == dom2 || tp_domain_match (dom1, dom2, TP_EXACT_MATCH))
 	    {
 	      c = dom1->type->index_cmpdisk (mem1, mem2, dom1, do_coercion, total_order, NULL);
 	    }
@@ -8006,14 +8248,16 @@ pr_midxkey_compare (DB_MIDXKEY * mul1, DB_MIDXKEY * mul2, int do_coercion, int t
 
       if (OR_MULTI_ATT_IS_BOUND (bitptr1, i))
 	{
-	  adv_size1 = pr_midxkey_element_disk_size (mem1, dom1);
+	  adv_size1 = ((desc != NULL && desc->cols[i].fixed_size >= 0)
+		       ? desc->cols[i].fixed_size : pr_midxkey_element_disk_size (mem1, dom1));
 	  mem1 += adv_size1;
 	  size1 += adv_size1;
 	}
 
       if (OR_MULTI_ATT_IS_BOUND (bitptr2, i))
 	{
-	  adv_size2 = pr_midxkey_element_disk_size (mem2, dom2);
+	  adv_size2 = ((desc != NULL && desc->cols[i].fixed_size >= 0)
+		       ? desc->cols[i].fixed_size : pr_midxkey_element_disk_size (mem2, dom2));
 	  mem2 += adv_size2;
 	  size2 += adv_size2;
 	}
@@ -8705,6 +8949,147 @@ mr_cmpval_numeric (DB_VALUE * value1, DB_VALUE * value2, int do_coercion, int to
   return c;
 }
 
+/*
+ * COMPILED COMPARATOR DISPATCH
+ *
+ * Sort and index code compares values of one known domain millions of times
+ * per operation, and PR_TYPE::cmpval charges each comparison an indirect
+ * call into a routine that re-examines the values.  The kernels below are
+ * specialized per domain: callers resolve one with pr_get_fast_comparator ()
+ * before the operation starts and call it directly for every pair.
+ */
+
+/* *INDENT-OFF* */
+template <typename T>
+static inline DB_VALUE_COMPARE_RESULT
+pr_fast_cmp_ordered (T v1, T v2)
+{
+  return (v1 < v2) ? DB_LT : ((v1 > v2) ? DB_GT : DB_EQ);
+}
+/* *INDENT-ON* */
+
+/*
+ * pr_fast_cmp_int () - compare kernel for DB_TYPE_INTEGER values
+ *   return: DB_LT, DB_EQ or DB_GT
+ */
+static DB_VALUE_COMPARE_RESULT
+pr_fast_cmp_int (const DB_VALUE * value1, const DB_VALUE * value2)
+{
+  return pr_fast_cmp_ordered<int> (db_get_int (value1), db_get_int (value2));
+}
+
+/*
+ * pr_fast_cmp_bigint () - compare kernel for DB_TYPE_BIGINT values
+ *   return: DB_LT, DB_EQ or DB_GT
+ */
+static DB_VALUE_COMPARE_RESULT
+pr_fast_cmp_bigint (const DB_VALUE * value1, const DB_VALUE * value2)
+{
+  return pr_fast_cmp_ordered<DB_BIGINT> (db_get_bigint (value1), db_get_bigint (value2));
+}
+
+/*
+ * pr_fast_cmp_date () - compare kernel for DB_TYPE_DATE values
+ *   return: DB_LT, DB_EQ or DB_GT
+ */
+static DB_VALUE_COMPARE_RESULT
+pr_fast_cmp_date (const DB_VALUE * value1, const DB_VALUE * value2)
+{
+  return pr_fast_cmp_ordered<DB_DATE> (*db_get_date (value1), *db_get_date (value2));
+}
+
+/*
+ * pr_fast_cmp_varchar_binary () - compare kernel for VARCHAR values collated
+ *				   with the "binary" collation
+ *   return: DB_LT, DB_EQ or DB_GT (or DB_UNK through the generic path)
+ *
+ * Note: Mirrors lang_fastcmp_binary: byte weights are the bytes themselves
+ *       and trailing zero bytes carry no weight.  Values that need the
+ *       boundary handling of the generic comparator (max-string range bounds,
+ *       unmaterialized strings) are handed back to mr_cmpval_string.
+ */
+static DB_VALUE_COMPARE_RESULT
+pr_fast_cmp_varchar_binary (const DB_VALUE * value1, const DB_VALUE * value2)
+{
+  const unsigned char *string1, *string2;
+  int size1, size2, size, cmp;
+
+  string1 = REINTERPRET_CAST (const unsigned char *, db_get_string (value1));
+  string2 = REINTERPRET_CAST (const unsigned char *, db_get_string (value2));
+  size1 = db_get_string_size (value1);
+  size2 = db_get_string_size (value2);
+
+  if (string1 == NULL || string2 == NULL || size1 < 0 || size2 < 0 || value1->data.ch.info.is_max_string != 0
+      || value2->data.ch.info.is_max_string != 0)
+    {
+      return mr_cmpval_string ((DB_VALUE *) value1, (DB_VALUE *) value2, 0, 1, NULL, LANG_COLL_BINARY);
+    }
+
+  size = (size1 < size2) ? size1 : size2;
+  cmp = memcmp (string1, string2, size);
+  if (cmp != 0)
+    {
+      return (cmp > 0) ? DB_GT : DB_LT;
+    }
+
+  for (; size < size1; size++)
+    {
+      if (string1[size] != 0)
+	{
+	  return DB_GT;
+	}
+    }
+  for (; size < size2; size++)
+    {
+      if (string2[size] != 0)
+	{
+	  return DB_LT;
+	}
+    }
+
+  return DB_EQ;
+}
+
+/*
+ * pr_get_fast_comparator () - resolve the compare kernel specialized for a
+ *			       domain
+ *   return: kernel function, or NULL when the domain has no specialization
+ *   domain(in): complete domain of both compared values
+ *
+ * Note: The kernel orders two bound values of exactly this domain the same
+ *       way PR_TYPE::cmpval with total order does; NULLs are ordered by the
+ *       caller, as with cmpval.  Callers must keep the generic comparator
+ *       path for domains that come back NULL.
+ */
+PR_FAST_CMP_FUNC
+pr_get_fast_comparator (const TP_DOMAIN * domain)
+{
+  if (domain == NULL)
+    {
+      return NULL;
+    }
+
+  switch (TP_DOMAIN_TYPE (domain))
+    {
+    case DB_TYPE_INTEGER:
+      return pr_fast_cmp_int;
+    case DB_TYPE_BIGINT:
+      return pr_fast_cmp_bigint;
+    case DB_TYPE_DATE:
+      return pr_fast_cmp_date;
+    case DB_TYPE_VARCHAR:
+      /* only the raw-byte collation compares with plain byte weights; every other collation keeps the generic,
+       * collation-aware path */
+      if (domain->collation_id == LANG_COLL_BINARY)
+	{
+	  return pr_fast_cmp_varchar_binary;
+	}
+      return NULL;
+    default:
+      return NULL;
+    }
+}
+
 /*
  * PRIMITIVE TYPE SUPPORT ROUTINES
  */
@@ -10031,6 +10416,55 @@ mr_setmem_string (void *memptr, TP_DOMAIN * domain, DB_VALUE * value)
   return error;
 }
 
+/*
+ * mr_make_small_varchar () - initialize a VARCHAR value that stores its
+ *			      string inline (small-string optimization)
+ *    return: NO_ERROR or error code
+ *    value(out): value to initialize
+ *    precision(in): precision
+ *    str(in): string to copy inline, or NULL when the caller fills the
+ *	       inline buffer itself
+ *    str_length(in): size of the string in bytes
+ *    codeset(in): codeset
+ *    collation_id(in): collation
+ * Note:
+ *    The inline representation owns no external buffer: need_clear stays
+ *    false and pr_clear_value has nothing to free.  Producers use it only
+ *    where the value owns its copy of the bytes; db_make_db_char keeps the
+ *    medium representation because its callers may hand buffer ownership
+ *    over afterwards by setting need_clear, which inline storage cannot
+ *    honor.
+ */
+static int
+mr_make_small_varchar (DB_VALUE * value, int precision, const char *str, int str_length, int codeset, int collation_id)
+{
+  int error;
+
+  assert (str_length > 0 && str_length < (int) sizeof (value->data.ch.sm.buf));
+
+  error = db_value_domain_init (value, DB_TYPE_VARCHAR, precision, 0);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  value->domain.general_info.is_null = 0;
+  value->domain.char_info.collation_id = collation_id;
+  value->data.ch.info.style = SMALL_STRING;
+  value->data.ch.info.codeset = codeset;
+  value->data.ch.info.is_max_string = false;
+  value->data.ch.info.compressed_need_clear = false;
+  value->data.ch.sm.size = (unsigned char) str_length;
+  if (str != NULL)
+    {
+      memcpy (value->data.ch.sm.buf, str, str_length);
+    }
+  value->data.ch.sm.buf[str_length] = '\0';
+  value->need_clear = false;
+
+  return NO_ERROR;
+}
+
 static int
 mr_getmem_string (void *memptr, TP_DOMAIN * domain, DB_VALUE * value, bool copy)
 {
@@ -10065,6 +10499,12 @@ mr_getmem_string (void *memptr, TP_DOMAIN * domain, DB_VALUE * value, bool copy)
 			   TP_DOMAIN_COLLATION (domain));
 	  value->need_clear = false;
 	}
+      else if (mem_length > 0 && mem_length < (int) sizeof (value->data.ch.sm.buf))
+	{
+	  /* small-string optimization: copy the string inline instead of allocating a buffer */
+	  error = mr_make_small_varchar (value, domain->precision, cur, mem_length, TP_DOMAIN_CODESET (domain),
+					 TP_DOMAIN_COLLATION (domain));
+	}
       else
 	{
 	  /* return it with a NULL terminator */
@@ -10357,8 +10797,16 @@ mr_setval_string (DB_VALUE * dest, const DB_VALUE * src, bool copy)
 	{
 	  error = db_make_varchar (dest, src_precision, src_str, src_length, db_get_string_codeset (src),
 				   db_get_string_collation (src));
-	  dest->data.ch.medium.compressed_buf = src->data.ch.medium.compressed_buf;
+	  dest->data.ch.medium.compressed_buf = (char *) DB_GET_COMPRESSED_STRING (src);
 	  dest->data.ch.info.compressed_need_clear = false;
+	  dest->data.ch.medium.compressed_size = db_get_compressed_size ((DB_VALUE *) src);
+	}
+      else if (src_length > 0 && src_length < (int) sizeof (dest->data.ch.sm.buf))
+	{
+	  /* small-string optimization: copy the string inline instead of allocating a buffer; strings this short
+	   * carry no compression info */
+	  error = mr_make_small_varchar (dest, src_precision, src_str, src_length, db_get_string_codeset (src),
+					 db_get_string_collation (src));
 	}
       else
 	{
@@ -10378,6 +10826,9 @@ mr_setval_string (DB_VALUE * dest, const DB_VALUE * src, bool copy)
 	      dest->need_clear = true;
 	    }
 
+	  /* src is longer than the inline buffer, so it always carries the medium representation */
+	  assert (src->data.ch.info.style == MEDIUM_STRING);
+
 	  if (src->data.ch.medium.compressed_buf == NULL)
 	    {
 	      dest->data.ch.medium.compressed_buf = NULL;
@@ -10400,9 +10851,9 @@ mr_setval_string (DB_VALUE * dest, const DB_VALUE * src, bool copy)
 		  dest->data.ch.info.compressed_need_clear = true;
 		}
 	    }
-	}
 
-      dest->data.ch.medium.compressed_size = src->data.ch.medium.compressed_size;
+	  dest->data.ch.medium.compressed_size = src->data.ch.medium.compressed_size;
+	}
     }
 
   return error;
@@ -10463,8 +10914,8 @@ mr_lengthval_string_internal (DB_VALUE * value, int disk, int align)
     {
       return 0;
     }
-  str = value->data.ch.medium.buf;
-  len = value->data.ch.medium.size;
+  str = db_get_string (value);
+  len = db_get_string_size (value);
   if (!str)
     {
       return 0;
@@ -10498,7 +10949,7 @@ mr_lengthval_string_internal (DB_VALUE * value, int disk, int align)
       else
 	{
 	  /* Compression failed so we are using the uncompressed size */
-	  len = value->data.ch.medium.size;
+	  len = db_get_string_size (value);
 	}
 
       if (len >= OR_MINIMUM_STRING_LENGTH_FOR_COMPRESSION && is_temporary_data == false)
@@ -10739,6 +11190,53 @@ mr_readval_string_internal (OR_BUF * buf, DB_VALUE * value, TP_DOMAIN * domain,
 	      str_length = compressed_size;
 	    }
 
+	  if (compressed_size == 0 && str_length > 0 && str_length < (int) sizeof (value->data.ch.sm.buf)
+	      && TP_DOMAIN_COLLATION_FLAG (domain) == TP_DOMAIN_COLL_NORMAL)
+	    {
+	      /* Small-string optimization: read the string straight into the inline buffer of the value and skip the
+	       * db_private_alloc of the hot fetch path altogether. */
+	      rc = mr_make_small_varchar (value, precision, NULL, str_length, TP_DOMAIN_CODESET (domain),
+					  TP_DOMAIN_COLLATION (domain));
+	      if (rc != NO_ERROR)
+		{
+		  return rc;
+		}
+
+	      if (align == INT_ALIGNMENT)
+		{
+		  /* read the kludge NULL terminator */
+		  rc = or_get_data (buf, value->data.ch.sm.buf, str_length + 1);
+		  if (rc == NO_ERROR)
+		    {
+		      rc = or_get_align32 (buf);
+		    }
+		}
+	      else
+		{
+		  rc = or_get_data (buf, value->data.ch.sm.buf, str_length);
+		}
+
+	      if (rc != NO_ERROR)
+		{
+		  db_value_domain_init (value, DB_TYPE_VARCHAR, precision, 0);
+		  return ER_FAILED;
+		}
+
+	      value->data.ch.sm.buf[str_length] = '\0';
+
+	      if (size != -1)
+		{
+		  /* advance past the padding of the fixed-size area */
+		  pad = size - (int) (buf->ptr - start);
+		  if (pad > 0)
+		    {
+		      rc = or_advance (buf, pad);
+		    }
+		}
+
+	      return rc;
+	    }
+
 	  if (copy_buf && copy_buf_len >= str_length + 1)
 	    {
 	      /* read buf image into the copy_buf */
@@ -16450,8 +16948,9 @@ pr_do_db_value_string_compression (DB_VALUE * value)
       return rc;		/* do nothing */
     }
 
-  /* Make sure the value has not been through a compression before */
-  if (value->data.ch.medium.compressed_size != 0)
+  /* Make sure the value has not been through a compression before; inline-stored strings never have compression
+   * info and report DB_UNCOMPRESSABLE */
+  if (DB_TRIED_COMPRESSION (value))
     {
       return rc;
     }
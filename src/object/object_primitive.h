@@ -41,6 +41,7 @@
 class string_buffer;
 struct tp_domain;
 struct or_buf;
+struct pr_midxkey_cmp_desc;
 
 /*
  * PR_TYPE
@@ -139,6 +140,7 @@ typedef struct pr_type
     // is fixed/variable
     inline bool is_always_variable () const;
     inline bool is_size_computed () const;
+    inline bool is_index_size_fixed () const;
 
     // size functions
     inline int get_mem_size_of_mem (const void *mem, const tp_domain * domain = NULL) const;
@@ -282,6 +284,14 @@ extern int pr_is_string_type (DB_TYPE type);
 extern int pr_is_prefix_key_type (DB_TYPE type);
 extern int pr_is_variable_type (DB_TYPE type);
 
+/* Domain-specialized compare kernels.  A kernel orders two bound values of
+ * one exact domain the same way PR_TYPE::cmpval with total order does;
+ * callers order NULLs themselves, as with cmpval, and resolve the kernel
+ * once per sort or scan operation. */
+typedef DB_VALUE_COMPARE_RESULT (*PR_FAST_CMP_FUNC) (const DB_VALUE * value1, const DB_VALUE * value2);
+
+extern PR_FAST_CMP_FUNC pr_get_fast_comparator (const struct tp_domain *domain);
+
 /* Size calculators */
 
 extern int pr_mem_size (const PR_TYPE * type);
@@ -308,6 +318,7 @@ extern DB_VALUE_COMPARE_RESULT pr_midxkey_compare (DB_MIDXKEY * mul1, DB_MIDXKEY
 						   int *result_size1, int *result_size2, int *diff_column,
 						   bool * dom_is_desc, bool * next_dom_is_desc);
 extern int pr_midxkey_element_disk_size (char *mem, DB_DOMAIN * domain);
+extern void pr_midxkey_cmp_desc_free (struct pr_midxkey_cmp_desc *desc);
 extern int pr_midxkey_get_element_nocopy (const DB_MIDXKEY * midxkey, int index, DB_VALUE * value, int *prev_indexp,
 					  char **prev_ptrp);
 extern int pr_midxkey_add_elements (DB_VALUE * keyval, DB_VALUE * dbvals, int num_dbvals,
@@ -389,6 +400,13 @@ pr_type::is_size_computed () const
   return f_data_lengthmem != NULL && f_data_lengthval != NULL;
 }
 
+bool
+pr_type::is_index_size_fixed () const
+{
+  // every index element of this type occupies exactly disksize bytes
+  return f_index_lengthmem == NULL;
+}
+
 int
 pr_type::get_disk_size_of_mem (const void *mem, const tp_domain * domain) const
 {
@@ -1622,6 +1622,92 @@ or_get_bigint (OR_BUF * buf, int *error)
   return value;
 }
 
+/*
+ * or_varint_length - returns the encoded size of a value with the variable-length integer encoding
+ *    return: encoded size in bytes (1 - OR_MAX_VARINT_SIZE)
+ *    value(in): value to encode
+ *
+ * Note: The encoding stores seven value bits per byte, least significant group first; the high bit of each byte marks
+ *       a continuation. The value is zig-zag mapped first so that integers of small magnitude, negative included,
+ *       take few bytes. The encoding is byte oriented and carries no alignment requirement, which makes it a compact
+ *       alternative to the fixed 4/8 byte representations where both ends agree on its use.
+ */
+int
+or_varint_length (DB_BIGINT value)
+{
+  UINT64 uval;
+  int len = 1;
+
+  /* zig-zag mapping: the sign bit moves to the least significant position */
+  uval = ((UINT64) value << 1) ^ (UINT64) (value >> 63);
+  while (uval >= 0x80)
+    {
+      uval >>= 7;
+      len++;
+    }
+  return len;
+}
+
+/*
+ * or_put_varint - put a value to or buffer with the variable-length integer encoding
+ *    return: NO_ERROR or error code
+ *    buf(in/out): or buffer
+ *    value(in): value to put
+ */
+int
+or_put_varint (OR_BUF * buf, DB_BIGINT value)
+{
+  UINT64 uval;
+  int rc = NO_ERROR;
+
+  uval = ((UINT64) value << 1) ^ (UINT64) (value >> 63);
+  while (uval >= 0x80)
+    {
+      rc = or_put_byte (buf, (int) ((uval & 0x7F) | 0x80));
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+      uval >>= 7;
+    }
+  return or_put_byte (buf, (int) uval);
+}
+
+/*
+ * or_get_varint - get a value packed by or_put_varint from or buffer
+ *    return: value read
+ *    buf(in/out): or buffer
+ *    error(out): NO_ERROR or error code
+ */
+DB_BIGINT
+or_get_varint (OR_BUF * buf, int *error)
+{
+  UINT64 uval = 0;
+  unsigned int byte_val;
+  int shift;
+
+  *error = NO_ERROR;
+  for (shift = 0; shift < OR_MAX_VARINT_SIZE * 7; shift += 7)
+    {
+      byte_val = (unsigned int) or_get_byte (buf, error);
+      if (*error != NO_ERROR)
+	{
+	  return 0;
+	}
+      uval |= ((UINT64) (byte_val & 0x7F)) << shift;
+      if ((byte_val & 0x80) == 0)
+	{
+	  /* undo the zig-zag mapping */
+	  return (DB_BIGINT) ((uval >> 1) ^ (UINT64) (- (DB_BIGINT) (uval & 1)));
+	}
+    }
+
+  /* a valid encoding ends within OR_MAX_VARINT_SIZE bytes; treat anything longer as a corrupted buffer */
+  assert (false);
+  *error = or_underflow (buf);
+  return 0;
+}
+
 /*
  * or_put_float - put a float value to or buffer
  *    return: NO_ERROR or error code
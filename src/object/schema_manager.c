@@ -5443,6 +5443,60 @@ sm_find_index (MOP classop, char **att_names, int num_atts, bool unique_index_on
   return (index);
 }
 
+/*
+ * sm_find_index_on_non_null ()
+ *   return: Pointer to B-tree ID variable.
+ *   classop(in): class object
+ *   btid(out):
+ *
+ * Note: Finds a regular index whose first attribute is NOT NULL. Such an index holds an entry for every row of the
+ *	 class, so COUNT(*) can be answered from the b-tree alone even though the index keeps no unique statistics.
+ *	 Filter, function and prefix indexes are skipped because they do not necessarily cover all rows.
+ */
+
+BTID *
+sm_find_index_on_non_null (MOP classop, BTID * btid)
+{
+  int error = NO_ERROR;
+  SM_CLASS *class_;
+  SM_CLASS_CONSTRAINT *con;
+
+  error = au_fetch_class (classop, &class_, AU_FETCH_READ, AU_SELECT);
+  if (error != NO_ERROR)
+    {
+      return NULL;
+    }
+
+  for (con = class_->constraints; con != NULL; con = con->next)
+    {
+      if (!SM_IS_CONSTRAINT_INDEX_FAMILY (con->type) || SM_IS_CONSTRAINT_UNIQUE_FAMILY (con->type))
+	{
+	  /* unique indexes are global on class hierarchies and may hold rows of other classes */
+	  continue;
+	}
+
+      if (con->filter_predicate != NULL || con->func_index_info != NULL)
+	{
+	  continue;
+	}
+
+      if (con->attrs_prefix_length != NULL && con->attrs_prefix_length[0] > 0)
+	{
+	  continue;
+	}
+
+      if (con->attributes[0] == NULL || !(con->attributes[0]->flags & SM_ATTFLAG_NON_NULL))
+	{
+	  continue;
+	}
+
+      BTID_COPY (btid, &con->index_btid);
+      return btid;
+    }
+
+  return NULL;
+}
+
 /*
  * sm_att_constrained() - Returns whether the attribute is auto_increment.
  *   classop(in): class object
@@ -14689,10 +14743,13 @@ sm_add_constraint (MOP classop, DB_CONSTRAINT_TYPE constraint_type, const char *
 	}
 #endif /* SA_MODE */
 
-      if (index_status == SM_ONLINE_INDEX_BUILDING_IN_PROGRESS && classop->lock > IX_LOCK)
+      if (index_status == SM_ONLINE_INDEX_BUILDING_IN_PROGRESS && classop->lock > IX_LOCK
+	  && !ib_is_rebuild_in_progress ())
 	{
 	  // if the transaction already hold a lock which is greater than IX,
 	  // we don't allow online index creation for transaction consistency.
+	  // ALTER INDEX ... REBUILD WITH ONLINE is the exception: there the stronger lock comes from dropping the
+	  // index being rebuilt within the same statement, and the online loader demotes it again during the build.
 	  index_status = SM_NORMAL_INDEX;
 	}
 
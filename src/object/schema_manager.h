@@ -96,6 +96,7 @@ extern int sm_update_class_with_auth (SM_TEMPLATE * template_, MOP * classmop, D
 extern int sm_update_class_auto (SM_TEMPLATE * template_, MOP * classmop);
 extern int sm_delete_class_mop (MOP op, bool is_cascade_constraints);
 extern int ib_get_thread_count ();
+extern bool ib_is_rebuild_in_progress ();
 #if defined(ENABLE_UNUSED_FUNCTION)
 extern int sm_delete_class (const char *name);
 #endif
@@ -238,6 +239,7 @@ extern int sm_att_default_value (MOP classop, const char *name, DB_VALUE * value
 extern int sm_class_check_uniques (MOP classop);
 extern BTID *sm_find_index (MOP classop, char **att_names, int num_atts, bool unique_index_only,
 			    bool skip_prefix_length_index, BTID * btid);
+extern BTID *sm_find_index_on_non_null (MOP classop, BTID * btid);
 
 
 /* Query processor support functions */
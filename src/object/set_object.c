@@ -158,6 +158,7 @@ set_area_init (void)
 	{
 	  goto error;
 	}
+      area_enable_thread_cache (Set_Ref_Area);
     }
 
   if (Set_Obj_Area == NULL)
@@ -167,6 +168,7 @@ set_area_init (void)
 	{
 	  goto error;
 	}
+      area_enable_thread_cache (Set_Obj_Area);
     }
 
   col_initialize ();
@@ -1324,6 +1326,13 @@ col_put (COL * col, long colindex, DB_VALUE * val)
       /* If this should be cloned, the caller should do it. This primitive just allows the assignment to the right
        * location in the collection */
       col->array[blockindex][offset] = *val;
+
+      if (col->coltype != DB_TYPE_SET && col->coltype != DB_TYPE_MULTISET)
+	{
+	  /* sequences have no sort invariant to maintain; any store invalidates a previous on-demand sort (see
+	   * col_sort), so the flag must not keep claiming physical order */
+	  col->sorted = 0;
+	}
     }
 
   return error;
@@ -1466,6 +1475,12 @@ col_insert (COL * col, long colindex, DB_VALUE * val)
       col->array[blockindex][offset] = *val;
       PRIM_SET_NULL (val);
       col->lastinsert = colindex;
+
+      if (col->coltype != DB_TYPE_SET && col->coltype != DB_TYPE_MULTISET)
+	{
+	  /* as in col_put: a sequence store invalidates a previous on-demand sort */
+	  col->sorted = 0;
+	}
     }
 
   return error;
@@ -4446,7 +4461,8 @@ setobj_sort (COL * col)
 
   if (col->coltype != DB_TYPE_SET && col->coltype != DB_TYPE_MULTISET)
     {
-      col->sorted = 1;
+      /* sequences have no sort invariant to restore; do not claim physical order here - the sorted flag on a
+       * sequence means "physically in ascending order" and is only set by an explicit col_sort */
       return NO_ERROR;
     }
 
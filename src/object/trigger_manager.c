@@ -195,6 +195,7 @@ static void free_trigger (TR_TRIGGER * trigger);
 static int insert_trigger_list (TR_TRIGLIST ** list, TR_TRIGGER * trigger);
 static int merge_trigger_list (TR_TRIGLIST ** list, TR_TRIGLIST * more, int destructive);
 static void remove_trigger_list_element (TR_TRIGLIST ** list, TR_TRIGLIST * element);
+static void filter_inactive_triggers (TR_STATE * state);
 static void remove_trigger_list (TR_TRIGLIST ** list, TR_TRIGGER * trigger);
 static void reinsert_trigger_list (TR_TRIGLIST ** list, TR_TRIGGER * trigger);
 static TR_DEFERRED_CONTEXT *add_deferred_activity_context (void);
@@ -4997,8 +4998,8 @@ execute_activity (TR_TRIGGER * trigger, DB_TRIGGER_TIME tr_time, DB_OBJECT * cur
   execute_action = true;
 
   /*
-   * If the trigger isn't active, ignore it.  It would be more effecient if the inactive triggers could be filtered from
-   * the lists as the combined list is built
+   * If the trigger isn't active, ignore it.  The prepare functions filter inactive triggers from the state lists
+   * up front; this check remains for run_user_triggers() and for triggers whose status changes mid statement.
    */
   if (trigger->status == TR_STATUS_ACTIVE)
     {
@@ -5254,6 +5255,36 @@ start_state (TR_STATE ** current, const char *name)
   return state;
 }
 
+/*
+ * filter_inactive_triggers() - Resolve the firing decision for a prepared trigger state once per statement.
+ *    return: none
+ *    state(in/out): trigger execution state
+ *
+ * Note:
+ *    execute_activity() ignores triggers that are not active, but it makes that decision again for every object
+ *    touched by the statement.  The mapped triggers were just validated by tr_validate_schema_cache() so their
+ *    status is current; drop the ones that will never fire while the list is being built.
+ */
+static void
+filter_inactive_triggers (TR_STATE * state)
+{
+  TR_TRIGLIST *t, *next;
+
+  if (state == NULL)
+    {
+      return;
+    }
+
+  for (t = state->triggers, next = NULL; t != NULL; t = next)
+    {
+      next = t->next;
+      if (t->trigger->status != TR_STATUS_ACTIVE)
+	{
+	  remove_trigger_list_element (&state->triggers, t);
+	}
+    }
+}
+
 /*
  * tr_prepare_statement() - This is called by do_statement() to prepare a trigger state structure for triggers that
  *                          will be raised by a statement.
@@ -5386,6 +5417,8 @@ tr_prepare_statement (TR_STATE ** state_p, DB_TRIGGER_EVENT event, DB_OBJECT * c
 		}
 	    }
 	}
+
+      filter_inactive_triggers (*state_p);
     }
 
   AU_ENABLE (save);
@@ -5500,6 +5533,7 @@ tr_prepare_class (TR_STATE ** state_p, TR_SCHEMA_CACHE * cache, MOP class_mop, D
       else
 	{
 	  merge_trigger_list (&state->triggers, triggers, 0);
+	  filter_inactive_triggers (state);
 	}
     }
   else
@@ -37,6 +37,7 @@
 #include "parser.h"
 #include "release_string.h"
 #include "parser.h"
+#include "statistics.h"
 
 // forward definitions
 struct xasl_node;
@@ -125,6 +126,8 @@ typedef struct
   int pkeys_size;		/* pkeys array size */
   int *pkeys;			/* partial keys info for example: index (a, b, ..., x) pkeys[0] -> # of {a} pkeys[1] ->
 				 * # of {a, b} ... pkeys[key_size-1] -> # of {a, b, ..., x} */
+  int hist_size;		/* number of valid entries in hist[]; 0 when the adopted index has no histogram */
+  DB_DATA hist[STATS_HISTOGRAM_SIZE];	/* equi-depth histogram boundaries of the index whose key count was adopted */
   bool valid_limits;
   bool is_indexed;
 } QO_ATTR_CUM_STATS;
@@ -189,6 +192,8 @@ extern xasl_node *qo_add_hq_iterations_access_spec (QO_PLAN * plan, xasl_node *
 
 extern QO_LIMIT_INFO *qo_get_key_limit_from_instnum (PARSER_CONTEXT * parser, QO_PLAN * plan, xasl_node * xasl);
 
+extern bool qo_plan_preserves_outer_rows (QO_PLAN * plan);
+
 extern QO_LIMIT_INFO *qo_get_key_limit_from_ordbynum (PARSER_CONTEXT * parser, QO_PLAN * plan, xasl_node * xasl,
 						      bool ignore_lower);
 
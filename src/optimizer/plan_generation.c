@@ -3266,6 +3266,38 @@ qo_get_limit_from_instnum_pred (PARSER_CONTEXT * parser, PRED_EXPR * pred, REGU_
   return false;
 }
 
+/*
+ * qo_plan_preserves_outer_rows () - checks whether every row fetched by the
+ *                                   driving scan of a nested loop pipeline is
+ *                                   guaranteed to produce at least one result
+ *                                   row
+ *   return:   true if the plan is a chain of left outer nested loop (or index)
+ *             joins driven by an interesting order index scan
+ *   plan(in): the (sub) plan to check
+ *
+ * Note: When this property holds, an upper row limit on the query is also an
+ *       upper bound on the number of outer rows worth fetching, so a key limit
+ *       may be pushed into the driving index scan. Inner joins do not qualify:
+ *       an outer row without a join partner produces nothing, and cutting the
+ *       outer scan short could lose later rows that do have partners.
+ */
+bool
+qo_plan_preserves_outer_rows (QO_PLAN * plan)
+{
+  while (plan != NULL && plan->plan_type == QO_PLANTYPE_JOIN)
+    {
+      if (plan->plan_un.join.join_type != JOIN_LEFT
+	  || (plan->plan_un.join.join_method != QO_JOINMETHOD_NL_JOIN
+	      && plan->plan_un.join.join_method != QO_JOINMETHOD_IDX_JOIN))
+	{
+	  return false;
+	}
+      plan = plan->plan_un.join.outer;
+    }
+
+  return plan != NULL && qo_is_interesting_order_scan (plan);
+}
+
 /*
  * qo_get_key_limit_from_instnum () - creates a keylimit node from an
  *                                    instnum predicate, if possible.
@@ -3297,8 +3329,9 @@ qo_get_key_limit_from_instnum (PARSER_CONTEXT * parser, QO_PLAN * plan, xasl_nod
       break;
 
     case QO_PLANTYPE_JOIN:
-      /* only allow inner joins */
-      if (plan->plan_un.join.join_type != JOIN_INNER)
+      /* only allow inner joins, and outer-row-preserving pipelines, for which the upper limit can be pushed into the
+       * driving index scan (see pt_instnum_to_key_limit) */
+      if (plan->plan_un.join.join_type != JOIN_INNER && !qo_plan_preserves_outer_rows (plan))
 	{
 	  return NULL;
 	}
@@ -4958,6 +4958,7 @@ qo_get_attr_info_func_index (QO_ENV * env, QO_SEGMENT * seg, const char *expr_st
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->hist_size = 0;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -5053,6 +5054,19 @@ qo_get_attr_info_func_index (QO_ENV * env, QO_SEGMENT * seg, const char *expr_st
 		    {
 		      cum_statsp->pkeys[i] = bstatsp->pkeys[i];
 		    }
+
+		  /* take over the histogram of the adopted index; it is keyed on the function expression, which is
+		   * exactly what this segment denotes */
+		  if (bstatsp->hist_size > 0)
+		    {
+		      assert (bstatsp->hist_size <= STATS_HISTOGRAM_SIZE);
+		      cum_statsp->hist_size = bstatsp->hist_size;
+		      memcpy (cum_statsp->hist, bstatsp->hist, bstatsp->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+		    }
+		  else
+		    {
+		      cum_statsp->hist_size = 0;
+		    }
 		}
 	    }
 	}
@@ -5130,6 +5144,7 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
       cum_statsp->key_type = NULL;
       cum_statsp->pkeys_size = 0;
       cum_statsp->pkeys = NULL;
+      cum_statsp->hist_size = 0;
 
       return attr_infop;
     }
@@ -5143,6 +5158,7 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->hist_size = 0;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -5274,6 +5290,14 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
 		  cum_statsp->pkeys[j] = bt_statsp->pkeys[j];
 		}
 
+	      /* take over the histogram of the adopted index, unless it is keyed on a function expression */
+	      if (bt_statsp->hist_size > 0 && bt_statsp->has_function == 0)
+		{
+		  assert (bt_statsp->hist_size <= STATS_HISTOGRAM_SIZE);
+		  cum_statsp->hist_size = bt_statsp->hist_size;
+		  memcpy (cum_statsp->hist, bt_statsp->hist, bt_statsp->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+		}
+
 	      /* immediately return the allocated QO_ATTR_INFO */
 	      return attr_infop;
 	    }
@@ -5312,6 +5336,18 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
 	    {
 	      cum_statsp->pkeys[j] = bt_statsp->pkeys[j];
 	    }
+
+	  /* take over the histogram of the adopted index, unless it is keyed on a function expression */
+	  if (bt_statsp->hist_size > 0 && bt_statsp->has_function == 0)
+	    {
+	      assert (bt_statsp->hist_size <= STATS_HISTOGRAM_SIZE);
+	      cum_statsp->hist_size = bt_statsp->hist_size;
+	      memcpy (cum_statsp->hist, bt_statsp->hist, bt_statsp->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+	    }
+	  else
+	    {
+	      cum_statsp->hist_size = 0;
+	    }
 	}
 
     }				/* for (i = 0; i < n; ...) */
@@ -5375,6 +5411,7 @@ qo_get_index_info (QO_ENV * env, QO_NODE * node)
     {
       cum_statsp = &(ni_entryp)->cum_stats;
       cum_statsp->is_indexed = true;
+      cum_statsp->hist_size = 0;
 
       /* The linked list of QO_INDEX_ENTRY was built by 'qo_find_node_index()' function. It is the list of compatible
        * indexes under class hierarchy.
@@ -7037,8 +7074,16 @@ qo_is_iss_index (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_entry)
     }
 
   /* check hint */
-  if (tree->info.query.q.select.hint & PT_HINT_NO_INDEX_SS || !(tree->info.query.q.select.hint & PT_HINT_INDEX_SS)
-      || !(QO_NODE_HINT (nodep) & PT_HINT_INDEX_SS))
+  if (tree->info.query.q.select.hint & PT_HINT_NO_INDEX_SS)
+    {
+      return false;
+    }
+
+  /* If the user gave an explicit INDEX_SS hint, it must apply to this node. Without any hint we still accept the
+   * index as a candidate; the plan cost (which charges one sub-scan per distinct value of the first column, see
+   * qo_index_scan_cost) decides whether skipping actually beats a regular index or sequential scan.
+   */
+  if ((tree->info.query.q.select.hint & PT_HINT_INDEX_SS) && !(QO_NODE_HINT (nodep) & PT_HINT_INDEX_SS))
     {
       return false;
     }
@@ -30,9 +30,12 @@
 #include <assert.h>
 #if !defined(WINDOWS)
 #include <values.h>
+#include <sys/time.h>
 #endif /* !WINDOWS */
 #include "jansson.h"
 
+#include "porting.h"
+
 #include "parser.h"
 #include "object_primitive.h"
 #include "optimizer.h"
@@ -168,6 +171,7 @@ static void planner_visit_node (QO_PLANNER *, QO_PARTITION *, PT_HINT_ENUM, QO_N
 static double planner_nodeset_join_cost (QO_PLANNER *, BITSET *);
 static void planner_permutate (QO_PLANNER *, QO_PARTITION *, PT_HINT_ENUM, QO_NODE *, BITSET *, BITSET *, BITSET *,
 			       BITSET *, BITSET *, BITSET *, BITSET *, BITSET *, int, int *);
+static bool planner_time_budget_exceeded (QO_PLANNER *);
 
 static QO_PLAN *qo_find_best_nljoin_inner_plan_on_info (QO_PLAN *, QO_INFO *, JOIN_TYPE, int);
 static QO_PLAN *qo_find_best_plan_on_info (QO_INFO *, QO_EQCLASS *, double);
@@ -402,6 +406,13 @@ static double qo_comp_selectivity (QO_ENV * env, PT_NODE * pt_expr);
 
 static double qo_between_selectivity (QO_ENV * env, PT_NODE * pt_expr);
 
+static bool qo_hist_data_to_double (DB_TYPE type, const DB_DATA * data, double *position);
+
+static double qo_hist_fraction (DB_TYPE type, const DB_DATA * hist, int hist_size, double position);
+
+static double qo_hist_selectivity (QO_ENV * env, PT_NODE * attr, PT_OP_TYPE op, PT_NODE * value);
+static void qo_track_plan_variant (QO_ENV * env, double selectivity);
+
 static double qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr);
 
 static double qo_all_some_in_selectivity (QO_ENV * env, PT_NODE * pt_expr);
@@ -3029,6 +3040,15 @@ qo_nljoin_cost (QO_PLAN * planp)
 	  return;
 	}
     }
+  else if (qo_is_seq_scan (inner) && !bitset_is_empty (&(planp->plan_un.join.hash_terms))
+	   && prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE) > 0)
+    {
+      /* hash list scan equi-join: the inner list is scanned once to build the hash table and every outer row probes
+       * it in constant time (the per-row probe cost is the QO_CPU_WEIGHT term added above). Without this the inner
+       * was still priced as a full rescan per outer row and the optimizer never picked the hash plan for exactly the
+       * large unindexed joins it was made for. */
+      inner_cpu_cost += inner->variable_cpu_cost;
+    }
   else
     {
       /* neither correlated index join nor equi-join */
@@ -6348,6 +6368,15 @@ qo_alloc_planner (QO_ENV * env)
 
   planner->cleanup_needed = true;
 
+  {
+    struct timeval now;
+
+    gettimeofday (&now, NULL);
+    planner->search_start_msec = (INT64) now.tv_sec * 1000 + now.tv_usec / 1000;
+  }
+  planner->budget_tick = 0;
+  planner->over_budget = 0;
+
   return planner;
 }
 
@@ -6448,6 +6477,44 @@ qo_dump_planner_info (QO_PLANNER * planner, QO_PARTITION * partition, FILE * f)
     }
 }
 
+/*
+ * planner_time_budget_exceeded () -
+ *   return: true iff an optimizer time budget is set and the join search has consumed it
+ *   planner(in):
+ */
+static bool
+planner_time_budget_exceeded (QO_PLANNER * planner)
+{
+  struct timeval now;
+  int budget_msec;
+
+  if (planner->over_budget)
+    {
+      return true;
+    }
+
+  budget_msec = prm_get_integer_value (PRM_ID_OPTIMIZER_TIME_BUDGET);
+  if (budget_msec <= 0)
+    {
+      return false;
+    }
+
+  /* the clock is not worth reading on every visited permutation */
+  if (++planner->budget_tick % 128 != 0)
+    {
+      return false;
+    }
+
+  gettimeofday (&now, NULL);
+  if (((INT64) now.tv_sec * 1000 + now.tv_usec / 1000) - planner->search_start_msec >= budget_msec)
+    {
+      planner->over_budget = 1;
+      return true;
+    }
+
+  return false;
+}
+
 /*
  * planner_visit_node () -
  *   return:
@@ -6491,6 +6558,13 @@ planner_visit_node (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
   BITSET info_terms;
   BITSET pinned_subqueries;
 
+  if (planner->best_info != NULL && planner_time_budget_exceeded (planner))
+    {
+      /* the time budget is consumed and a complete candidate already exists at this join level; stop exploring
+       * alternative permutations and settle for what has been found so far */
+      return;
+    }
+
   bitset_init (&nl_join_terms, planner->env);
   bitset_init (&sm_join_terms, planner->env);
   bitset_init (&duj_terms, planner->env);
@@ -7300,6 +7374,13 @@ planner_permutate (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
   for (i = bitset_iterate (remaining_nodes, &bi); i != -1; i = bitset_next_member (&bi))
     {
 
+      if (planner_time_budget_exceeded (planner) && (node_idxp != NULL ? prev_best_cost != -1.0	/* found a head */
+						     : planner->best_info != NULL))
+	{
+	  /* the time budget is consumed and this join level already has a candidate; skip the remaining head nodes */
+	  break;
+	}
+
       head_node = QO_ENV_NODE (planner->env, i);
 
       /* head node dependency check; */
@@ -9491,6 +9572,258 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
   return selectivity;
 }
 
+/*
+ * qo_hist_data_to_double () - Map a histogram boundary or a constant onto the real line
+ *   return: true if the type has a meaningful linear ordering
+ *   type(in): type of the data
+ *   data(in): raw data portion of the value
+ *   position(out): position on the real line
+ */
+static bool
+qo_hist_data_to_double (DB_TYPE type, const DB_DATA * data, double *position)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+      *position = (double) data->i;
+      break;
+    case DB_TYPE_SHORT:
+      *position = (double) data->sh;
+      break;
+    case DB_TYPE_BIGINT:
+      *position = (double) data->bigint;
+      break;
+    case DB_TYPE_FLOAT:
+      *position = (double) data->f;
+      break;
+    case DB_TYPE_DOUBLE:
+      *position = data->d;
+      break;
+    case DB_TYPE_DATE:
+      *position = (double) data->date;
+      break;
+    case DB_TYPE_TIME:
+      *position = (double) data->time;
+      break;
+    case DB_TYPE_TIMESTAMP:
+      *position = (double) data->utime;
+      break;
+    case DB_TYPE_DATETIME:
+      *position = ((double) data->datetime.date) * 86400000.0 + (double) data->datetime.time;
+      break;
+    case DB_TYPE_MONETARY:
+      *position = data->money.amount;
+      break;
+    default:
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * qo_hist_fraction () - Estimate the fraction of keys that compare less than the given position
+ *   return: fraction in (0, 1)
+ *   type(in): type of the histogram boundaries
+ *   hist(in): equi-depth histogram boundaries, in ascending order
+ *   hist_size(in): number of boundaries
+ *   position(in): position of the constant on the real line
+ *
+ * Note: the boundaries split the key population into hist_size + 1 buckets of (approximately) equal cardinality,
+ * so locating the bucket that holds the position and interpolating linearly inside it yields the key-rank
+ * fraction. The extent of the two edge buckets is unknown, so the middle of the bucket is assumed there.
+ */
+static double
+qo_hist_fraction (DB_TYPE type, const DB_DATA * hist, int hist_size, double position)
+{
+  double lo, hi, bucket;
+  int i;
+
+  bucket = 1.0 / ((double) hist_size + 1.0);
+
+  hi = 0.0;			/* init */
+  for (i = 0; i < hist_size; i++)
+    {
+      (void) qo_hist_data_to_double (type, &hist[i], &hi);
+      if (position < hi)
+	{
+	  break;
+	}
+    }
+
+  if (i == 0)
+    {
+      /* below the first boundary */
+      return bucket * 0.5;
+    }
+  if (i == hist_size)
+    {
+      /* at or above the last boundary */
+      return 1.0 - (bucket * 0.5);
+    }
+
+  (void) qo_hist_data_to_double (type, &hist[i - 1], &lo);
+  if (hi > lo)
+    {
+      return (((double) i) + ((position - lo) / (hi - lo))) * bucket;
+    }
+
+  return ((double) i) * bucket;
+}
+
+/*
+ * qo_track_plan_variant () - Remember that a histogram lookup on a bound parameter value influenced the plan
+ *   return: nothing
+ *   env(in): Pointer to an environment structure
+ *   selectivity(in): histogram selectivity obtained for the bound value
+ *
+ * Note: The selectivity is folded into one of a few logarithmic buckets and the most selective bucket seen during
+ *       the compilation is kept on the parser.  The prepare step keys the resulting plan by that bucket, so that
+ *       plans compiled under differently skewed parameter values can coexist in the XASL cache as variants instead
+ *       of replacing one another.
+ */
+static void
+qo_track_plan_variant (QO_ENV * env, double selectivity)
+{
+  PARSER_CONTEXT *parser = QO_ENV_PARSER (env);
+  int bucket;
+
+  if (selectivity >= 0.1)
+    {
+      bucket = 1;
+    }
+  else if (selectivity >= 0.01)
+    {
+      bucket = 2;
+    }
+  else if (selectivity >= 0.001)
+    {
+      bucket = 3;
+    }
+  else
+    {
+      bucket = 4;
+    }
+
+  parser->plan_variant_bucket = MAX (parser->plan_variant_bucket, bucket);
+}
+
+/*
+ * qo_hist_selectivity () - Selectivity of 'attr <op> const' from the attribute's equi-depth histogram
+ *   return: selectivity, or -1.0 when no histogram applies
+ *   env(in): Pointer to an environment structure
+ *   attr(in): attribute side of the comparison
+ *   op(in): comparison operator, with the attribute taken as the left-hand side
+ *   value(in): constant side of the comparison
+ */
+static double
+qo_hist_selectivity (QO_ENV * env, PT_NODE * attr, PT_OP_TYPE op, PT_NODE * value)
+{
+  PT_NODE *dummy;
+  QO_NODE *nodep;
+  QO_SEGMENT *segp;
+  QO_ATTR_INFO *info;
+  QO_ATTR_CUM_STATS *cum_statsp;
+  DB_VALUE *value_p;
+  DB_TYPE hist_type, value_type;
+  double position, fraction, selectivity;
+
+  if (attr->node_type == PT_DOT_)
+    {
+      attr = attr->info.dot.arg2;
+    }
+
+  if (attr->node_type != PT_NAME || (value->node_type != PT_VALUE && value->node_type != PT_HOST_VAR))
+    {
+      return -1.0;
+    }
+
+  nodep = lookup_node (attr, env, &dummy);
+  if (nodep == NULL)
+    {
+      return -1.0;
+    }
+
+  segp = lookup_seg (nodep, attr, env);
+  if (segp == NULL)
+    {
+      return -1.0;
+    }
+
+  if (attr->info.name.meta_class == PT_RESERVED)
+    {
+      return -1.0;
+    }
+
+  info = QO_SEG_INFO (segp);
+  if (info == NULL)
+    {
+      return -1.0;
+    }
+
+  cum_statsp = &info->cum_stats;
+  if (cum_statsp->hist_size <= 0 || cum_statsp->key_type == NULL)
+    {
+      return -1.0;
+    }
+  assert (cum_statsp->hist_size <= STATS_HISTOGRAM_SIZE);
+
+  hist_type = TP_DOMAIN_TYPE (cum_statsp->key_type);
+
+  if (value->node_type == PT_HOST_VAR)
+    {
+      /* peek the bound value of the parameter, when one is available */
+      value_p = pt_host_var_db_value (QO_ENV_PARSER (env), value);
+    }
+  else
+    {
+      value_p = pt_value_to_db (QO_ENV_PARSER (env), value);
+    }
+  if (value_p == NULL || DB_IS_NULL (value_p))
+    {
+      return -1.0;
+    }
+
+  /* the positions of the constant and of the boundaries are comparable only when the types agree or both are
+   * plain numbers */
+  value_type = DB_VALUE_DOMAIN_TYPE (value_p);
+  if (value_type != hist_type
+      && !(TP_IS_NUMERIC_TYPE (value_type) && value_type != DB_TYPE_NUMERIC && TP_IS_NUMERIC_TYPE (hist_type)))
+    {
+      return -1.0;
+    }
+
+  if (!qo_hist_data_to_double (value_type, &value_p->data, &position))
+    {
+      return -1.0;
+    }
+
+  fraction = qo_hist_fraction (hist_type, cum_statsp->hist, cum_statsp->hist_size, position);
+
+  switch (op)
+    {
+    case PT_LT:
+    case PT_LE:
+      selectivity = fraction;
+      break;
+    case PT_GT:
+    case PT_GE:
+      selectivity = 1.0 - fraction;
+      break;
+    default:
+      return -1.0;
+    }
+
+  if (value->node_type == PT_HOST_VAR)
+    {
+      /* the plan about to be costed depends on the bound value of a parameter; remember its selectivity bucket so
+       * that the plan can be cached as a parameter-sensitive variant */
+      qo_track_plan_variant (env, selectivity);
+    }
+
+  return selectivity;
+}
+
 /*
  * qo_comp_selectivity () - Compute the selectivity of a comparison predicate.
  *   return: double
@@ -9502,6 +9835,52 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 static double
 qo_comp_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
+  PT_NODE *lhs, *rhs;
+  PT_OP_TYPE op;
+  PRED_CLASS pc_lhs, pc_rhs;
+  double selectivity;
+
+  lhs = pt_expr->info.expr.arg1;
+  rhs = pt_expr->info.expr.arg2;
+  op = pt_expr->info.expr.op;
+
+  pc_lhs = qo_classify (lhs);
+  pc_rhs = qo_classify (rhs);
+
+  selectivity = -1.0;
+  if (pc_lhs == PC_ATTR && (pc_rhs == PC_CONST || pc_rhs == PC_HOST_VAR))
+    {
+      selectivity = qo_hist_selectivity (env, lhs, op, rhs);
+    }
+  else if ((pc_lhs == PC_CONST || pc_lhs == PC_HOST_VAR) && pc_rhs == PC_ATTR)
+    {
+      /* turn the comparison around so that the attribute becomes the left-hand side */
+      switch (op)
+	{
+	case PT_LT:
+	  op = PT_GT;
+	  break;
+	case PT_LE:
+	  op = PT_GE;
+	  break;
+	case PT_GT:
+	  op = PT_LT;
+	  break;
+	case PT_GE:
+	  op = PT_LE;
+	  break;
+	default:
+	  break;
+	}
+
+      selectivity = qo_hist_selectivity (env, rhs, op, lhs);
+    }
+
+  if (selectivity >= 0.0)
+    {
+      return selectivity;
+    }
+
   return DEFAULT_COMP_SELECTIVITY;
 }
 
@@ -9516,13 +9895,47 @@ qo_comp_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 static double
 qo_between_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
-  PT_NODE *and_node;
+  PT_NODE *and_node, *lhs, *lower, *upper;
+  PRED_CLASS pc_lower, pc_upper;
+  double lower_fraction, upper_fraction, selectivity;
 
   and_node = pt_expr->info.expr.arg2;
 
   QO_ASSERT (env, and_node->node_type == PT_EXPR);
   QO_ASSERT (env, pt_is_between_range_op (and_node->info.expr.op));
 
+  switch (and_node->info.expr.op)
+    {
+    case PT_BETWEEN_AND:
+    case PT_BETWEEN_GE_LE:
+    case PT_BETWEEN_GE_LT:
+    case PT_BETWEEN_GT_LE:
+    case PT_BETWEEN_GT_LT:
+      lhs = pt_expr->info.expr.arg1;
+      lower = and_node->info.expr.arg1;
+      upper = and_node->info.expr.arg2;
+
+      pc_lower = qo_classify (lower);
+      pc_upper = qo_classify (upper);
+
+      if (qo_classify (lhs) == PC_ATTR && (pc_lower == PC_CONST || pc_lower == PC_HOST_VAR)
+	  && (pc_upper == PC_CONST || pc_upper == PC_HOST_VAR))
+	{
+	  upper_fraction = qo_hist_selectivity (env, lhs, PT_LE, upper);
+	  lower_fraction = qo_hist_selectivity (env, lhs, PT_LT, lower);
+	  if (upper_fraction >= 0.0 && lower_fraction >= 0.0)
+	    {
+	      /* never go below the selectivity of a single key; the histogram resolution cannot support it */
+	      selectivity = upper_fraction - lower_fraction;
+	      return MAX (selectivity, DEFAULT_EQUAL_SELECTIVITY);
+	    }
+	}
+      break;
+
+    default:
+      break;
+    }
+
   return DEFAULT_BETWEEN_SELECTIVITY;
 }
 
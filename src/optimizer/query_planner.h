@@ -40,7 +40,9 @@ namespace cubxasl
   struct analytic_eval_type;
 }
 
-#define QO_CPU_WEIGHT   0.0025
+/* cost of one qualification comparison relative to one data page read; the default suits common disks and can be
+ * re-derived for a particular machine with the calibratedb utility */
+#define QO_CPU_WEIGHT   ((double) prm_get_float_value (PRM_ID_OPTIMIZER_CPU_WEIGHT))
 
 typedef enum
 {
@@ -387,6 +389,18 @@ struct qo_planner
    * control flow takes an unexpected longjmp.
    */
   int cleanup_needed;
+
+  /*
+   * Bookkeeping for the optimizer time budget (see the
+   * optimizer_time_budget_in_msecs parameter): when the join search
+   * started, a counter that rations the clock reads, and a flag raised
+   * once the budget has been consumed.  With the flag up the search
+   * keeps the first complete candidate found at each join level
+   * instead of exhausting the remaining permutations.
+   */
+  INT64 search_start_msec;
+  int budget_tick;
+  int over_budget;
 };
 
 extern QO_PLAN *qo_planner_search (QO_ENV *);
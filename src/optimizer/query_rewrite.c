@@ -93,6 +93,14 @@ struct qo_reset_location_info
   bool found_outerjoin;
 };
 
+typedef struct qo_exists_refs_info QO_EXISTS_REFS_INFO;
+struct qo_exists_refs_info
+{
+  PT_NODE *local_specs;		/* FROM list of the EXISTS subquery */
+  bool refers_local;		/* references a spec of the subquery */
+  bool refers_other;		/* references an outer spec or something we cannot analyze */
+};
+
 static PT_NODE *qo_reset_location (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk);
 
 static void qo_move_on_clause_of_explicit_join_to_where_clause (PARSER_CONTEXT * parser, PT_NODE ** fromp,
@@ -6214,6 +6222,233 @@ exit:
     }
 }
 
+/*
+ * qo_check_exists_refs () - classify name references of an expression against
+ *                           the FROM list of an EXISTS subquery
+ *   return: PT_NODE *
+ *   parser(in):
+ *   node(in):
+ *   arg(in): QO_EXISTS_REFS_INFO *
+ *   continue_walk(in):
+ *
+ * Note: do parser_walk_tree() pre function. Any nested query makes the
+ *   analysis unreliable (its names reference specs we do not know about),
+ *   so it is conservatively treated as an unknown reference.
+ */
+static PT_NODE *
+qo_check_exists_refs (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk)
+{
+  QO_EXISTS_REFS_INFO *info = (QO_EXISTS_REFS_INFO *) arg;
+  PT_NODE *spec;
+
+  if (PT_IS_QUERY_NODE_TYPE (node->node_type))
+    {
+      info->refers_other = true;
+      *continue_walk = PT_STOP_WALK;
+      return node;
+    }
+
+  if (node->node_type == PT_NAME && node->info.name.spec_id != 0)
+    {
+      for (spec = info->local_specs; spec; spec = spec->next)
+	{
+	  if (spec->info.spec.id == node->info.name.spec_id)
+	    {
+	      break;
+	    }
+	}
+
+      if (spec != NULL)
+	{
+	  info->refers_local = true;
+	}
+      else
+	{
+	  info->refers_other = true;
+	}
+    }
+
+  return node;
+}
+
+/*
+ * qo_is_attr_of_spec_list () - is this a simple attribute of one of the specs?
+ *   return: true/false
+ *   attr(in):
+ *   spec_list(in): list of PT_SPEC nodes
+ */
+static bool
+qo_is_attr_of_spec_list (PT_NODE * attr, PT_NODE * spec_list)
+{
+  PT_NODE *spec;
+
+  if (attr == NULL || attr->node_type != PT_NAME || !pt_is_attr (attr))
+    {
+      return false;
+    }
+
+  for (spec = spec_list; spec; spec = spec->next)
+    {
+      if (spec->info.spec.id == attr->info.name.spec_id)
+	{
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * qo_decorrelate_exists_subquery () - rewrite a correlated EXISTS term to an
+ *                                     IN term with an uncorrelated subquery
+ *   return: true if the term was rewritten
+ *   parser(in):
+ *   node(in): SELECT node owning the WHERE clause of the term
+ *   cnf_node(in/out): 'EXISTS (subquery)' term
+ *
+ * Note: handles the canonical correlated EXISTS shape
+ *
+ *     ... WHERE EXISTS (SELECT ... FROM t WHERE t.a = outer.b AND <local>)
+ *
+ *   by pulling the single correlating equality out of the subquery:
+ *
+ *     ... WHERE outer.b IN (SELECT t.a FROM t WHERE <local>)
+ *
+ *   The subquery becomes uncorrelated (executed once instead of per outer
+ *   row) and the IN term is then picked up by the derived-table join
+ *   rewrite below, which yields a semi-join shaped plan: the subquery is
+ *   marked DISTINCT - duplicates are not relevant to IN, see the range
+ *   expression handling in type checking - so each outer row joins at most
+ *   one derived row. The rewrite is refused whenever the subquery has any
+ *   other correlated reference or a shape we cannot analyze; in WHERE
+ *   context the EXISTS-to-IN exchange of FALSE for UNKNOWN is immaterial.
+ */
+static bool
+qo_decorrelate_exists_subquery (PARSER_CONTEXT * parser, PT_NODE * node, PT_NODE * cnf_node)
+{
+  PT_NODE *subquery = cnf_node->info.expr.arg1;
+  PT_NODE *spec, *conj, *prev, *corr_conj, *corr_prev;
+  PT_NODE *local_attr = NULL, *outer_attr = NULL, *save_next;
+  QO_EXISTS_REFS_INFO info;
+
+  if (subquery == NULL || subquery->node_type != PT_SELECT || subquery->info.query.correlation_level != 1)
+    {
+      return false;
+    }
+
+  if (subquery->info.query.q.select.group_by != NULL || subquery->info.query.q.select.having != NULL
+      || subquery->info.query.q.select.connect_by != NULL || subquery->info.query.q.select.start_with != NULL
+      || subquery->info.query.order_by != NULL || subquery->info.query.orderby_for != NULL)
+    {
+      return false;
+    }
+
+  if (pt_has_aggregate (parser, subquery) || pt_has_analytic (parser, subquery))
+    {
+      return false;
+    }
+
+  for (spec = subquery->info.query.q.select.from; spec; spec = spec->next)
+    {
+      if (spec->info.spec.derived_table != NULL || spec->info.spec.path_entities != NULL
+	  || spec->info.spec.cte_pointer != NULL)
+	{
+	  return false;
+	}
+    }
+
+  info.local_specs = subquery->info.query.q.select.from;
+
+  /* the select list must not reference the outer query */
+  info.refers_local = info.refers_other = false;
+  (void) parser_walk_tree (parser, subquery->info.query.q.select.list, qo_check_exists_refs, &info, NULL, NULL);
+  if (info.refers_other)
+    {
+      return false;
+    }
+
+  /* normalize the subquery WHERE so conjuncts are chained by 'next'; CNF conversion is semantics preserving and
+   * would be done eventually anyway */
+  subquery->info.query.q.select.where = pt_cnf (parser, subquery->info.query.q.select.where);
+
+  /* every conjunct must be local, except for exactly one correlating equality 'local-attr = outer-attr' */
+  corr_conj = corr_prev = NULL;
+  for (prev = NULL, conj = subquery->info.query.q.select.where; conj; prev = conj, conj = conj->next)
+    {
+      save_next = conj->next;
+      conj->next = NULL;
+      info.refers_local = info.refers_other = false;
+      (void) parser_walk_tree (parser, conj, qo_check_exists_refs, &info, NULL, NULL);
+      conj->next = save_next;
+
+      if (!info.refers_other)
+	{
+	  continue;
+	}
+
+      if (conj->or_next != NULL || conj->node_type != PT_EXPR || conj->info.expr.op != PT_EQ || corr_conj != NULL)
+	{
+	  return false;
+	}
+
+      if (qo_is_attr_of_spec_list (conj->info.expr.arg1, info.local_specs)
+	  && qo_is_attr_of_spec_list (conj->info.expr.arg2, node->info.query.q.select.from))
+	{
+	  local_attr = conj->info.expr.arg1;
+	  outer_attr = conj->info.expr.arg2;
+	}
+      else if (qo_is_attr_of_spec_list (conj->info.expr.arg2, info.local_specs)
+	       && qo_is_attr_of_spec_list (conj->info.expr.arg1, node->info.query.q.select.from))
+	{
+	  local_attr = conj->info.expr.arg2;
+	  outer_attr = conj->info.expr.arg1;
+	}
+      else
+	{
+	  return false;
+	}
+
+      corr_conj = conj;
+      corr_prev = prev;
+    }
+
+  if (corr_conj == NULL)
+    {
+      return false;
+    }
+
+  /* unlink the correlating equality from the subquery WHERE */
+  if (corr_prev == NULL)
+    {
+      subquery->info.query.q.select.where = corr_conj->next;
+    }
+  else
+    {
+      corr_prev->next = corr_conj->next;
+    }
+  corr_conj->next = NULL;
+  corr_conj->info.expr.arg1 = NULL;
+  corr_conj->info.expr.arg2 = NULL;
+  parser_free_tree (parser, corr_conj);
+
+  /* the subquery now projects the local side of the removed equality */
+  parser_free_tree (parser, subquery->info.query.q.select.list);
+  local_attr->next = NULL;
+  subquery->info.query.q.select.list = local_attr;
+
+  /* uncorrelated from now on; duplicates are not relevant to IN */
+  subquery->info.query.correlation_level = 0;
+  subquery->info.query.all_distinct = PT_DISTINCT;
+
+  /* convert 'EXISTS (subquery)' to 'outer-attr IN (subquery)' */
+  outer_attr->next = NULL;
+  cnf_node->info.expr.op = PT_IS_IN;
+  cnf_node->info.expr.arg1 = outer_attr;
+  cnf_node->info.expr.arg2 = subquery;
+
+  return true;
+}
+
 /*
  * qo_rewrite_subqueries () - Rewrite uncorrelated subquery to join query
  *   return: PT_NODE *
@@ -6258,6 +6493,14 @@ qo_rewrite_subqueries (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *
       arg1 = cnf_node->info.expr.arg1;
       arg2 = cnf_node->info.expr.arg2;
 
+      if (op_type == PT_EXISTS && qo_decorrelate_exists_subquery (parser, node, cnf_node))
+	{
+	  /* the term is now 'attr IN (uncorrelated subquery)'; reload it and let the join rewrite below take it */
+	  op_type = cnf_node->info.expr.op;
+	  arg1 = cnf_node->info.expr.arg1;
+	  arg2 = cnf_node->info.expr.arg2;
+	}
+
       if (arg1 && arg2
 	  && (op_type == PT_EQ || op_type == PT_IS_IN || op_type == PT_EQ_SOME || op_type == PT_GT_SOME
 	      || op_type == PT_GE_SOME || op_type == PT_LT_SOME || op_type == PT_LE_SOME))
@@ -3511,6 +3511,7 @@ alter_stmt
 	  opt_where_clause				/* 11 */
 	  opt_comment_spec			/* 12 */
 	  REBUILD					/* 13 */
+	  opt_with_online				/* 14 */
 		{{
 
 			PT_NODE *node = parser_pop_hint_node ();
@@ -3573,6 +3574,16 @@ alter_stmt
 			    node->info.index.where = $11;
 			    node->info.index.comment = $12;
 
+                            int with_online_ret = $14;  // 0 for normal, 1 for online no parallel,
+                                                        // thread_count + 1 for parallel
+                            node->info.index.index_status = SM_NORMAL_INDEX;
+                            if (with_online_ret > 0)
+                              {
+                                /* Online rebuild: recreate through the online loader. */
+                                node->info.index.index_status = SM_ONLINE_INDEX_BUILDING_IN_PROGRESS;
+                                node->info.index.ib_threads = with_online_ret - 1;
+                              }
+
 			    $$ = node;
 			    PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 			  }
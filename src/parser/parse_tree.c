@@ -54,30 +54,24 @@
  * overhead for malloc headers plus string block header.
  */
 #define STRINGS_PER_BLOCK (8192-(4*sizeof(long)+sizeof(char *)+40))
-#define HASH_NUMBER 128
 #define NODES_PER_BLOCK 256
 
+/* Node and string blocks form a per-parser arena: each block is carved out by
+ * bumping last_string_end (strings) or handing out nodes from the free list
+ * (nodes), and the whole arena is released at once by parser_free_parser.
+ * The blocks hang off the owning PARSER_CONTEXT, so no locking is needed. */
+
 typedef struct parser_node_block PARSER_NODE_BLOCK;
 struct parser_node_block
 {
   PARSER_NODE_BLOCK *next;
-  int parser_id;
   PT_NODE nodes[NODES_PER_BLOCK];
 };
 
-typedef struct parser_node_free_list PARSER_NODE_FREE_LIST;
-struct parser_node_free_list
-{
-  PARSER_NODE_FREE_LIST *next;
-  PT_NODE *node;
-  int parser_id;
-};
-
 typedef struct parser_string_block PARSER_STRING_BLOCK;
 struct parser_string_block
 {
   PARSER_STRING_BLOCK *next;
-  int parser_id;
   int last_string_start;
   int last_string_end;
   int block_end;
@@ -179,16 +173,9 @@ PT_RESERVED_NAME pt_Reserved_name_table[] = {
 /* this is a kludge because many platforms do not handle extern
  * linking per ANSI. This should be deleted when nodes get used in server.
  */
-static pthread_mutex_t blocks_lock = PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t free_lists_lock = PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t parser_memory_lock = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t parser_id_lock = PTHREAD_MUTEX_INITIALIZER;
 #endif /* SERVER_MODE */
 
-static PARSER_NODE_BLOCK *parser_Node_blocks[HASH_NUMBER];
-static PARSER_NODE_FREE_LIST *parser_Node_free_lists[HASH_NUMBER];
-static PARSER_STRING_BLOCK *parser_String_blocks[HASH_NUMBER];
-
 static int parser_id = 1;
 
 static PT_NODE *parser_create_node_block (const PARSER_CONTEXT * parser);
@@ -200,24 +187,19 @@ static char *pt_append_string_for (const PARSER_CONTEXT * parser, const char *ol
 				   const int wrap_with_single_quote);
 static PARSER_VARCHAR *pt_append_bytes_for (const PARSER_CONTEXT * parser, PARSER_VARCHAR * old_string,
 					    const char *new_tail, const int new_tail_length);
-static int pt_register_parser (const PARSER_CONTEXT * parser);
-static void pt_unregister_parser (const PARSER_CONTEXT * parser);
 static void pt_free_string_blocks (const PARSER_CONTEXT * parser);
 
 /*
  * pt_create_node_block () - creates a new block of nodes, links the block
- * on the hash list for the parser, and returns the free list of new nodes
+ * on the parser's arena, and returns the free list of new nodes
  *   return:
  *   parser(in):
  */
 static PT_NODE *
 parser_create_node_block (const PARSER_CONTEXT * parser)
 {
-  int idhash, inode;
+  int inode;
   PARSER_NODE_BLOCK *block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
   block = (PARSER_NODE_BLOCK *) malloc (sizeof (PARSER_NODE_BLOCK));
 
@@ -235,16 +217,9 @@ parser_create_node_block (const PARSER_CONTEXT * parser)
 	}
     }
 
-  /* remember which parser allocated this block */
-  block->parser_id = parser->id;
-
-  /* link blocks on the hash list for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&blocks_lock);
-#endif /* SERVER_MODE */
-  block->next = parser_Node_blocks[idhash];
-  parser_Node_blocks[idhash] = block;
+  /* link the block on the owning parser's arena; only used by one parser (and one thread) */
+  block->next = parser->node_blocks;
+  ((PARSER_CONTEXT *) parser)->node_blocks = block;
 
   /* link nodes for free list */
   for (inode = 1; inode < NODES_PER_BLOCK; inode++)
@@ -253,9 +228,6 @@ parser_create_node_block (const PARSER_CONTEXT * parser)
     }
   block->nodes[NODES_PER_BLOCK - 1].next = NULL;
 
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&blocks_lock);
-#endif /* SERVER_MODE */
   /* return head of free list */
   return &block->nodes[0];
 }
@@ -270,48 +242,19 @@ parser_create_node_block (const PARSER_CONTEXT * parser)
 PT_NODE *
 parser_create_node (const PARSER_CONTEXT * parser)
 {
-  int idhash;
-  PARSER_NODE_FREE_LIST *free_list;
   PT_NODE *node;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
-  /* find free list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&free_lists_lock);
-#endif /* SERVER_MODE */
-
-  free_list = parser_Node_free_lists[idhash];
-  while (free_list != NULL && free_list->parser_id != parser->id)
-    {
-      free_list = free_list->next;
-    }
-
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-
-  if (free_list == NULL)
-    {
-      /* this is an programming error ! The parser does not exist! */
-      return NULL;
-    }
 
-  if (free_list->node == NULL)
+  if (parser->free_nodes == NULL)
     {
-      /* do not need to use mutex : only used by one parser(and one thread) */
-      free_list->node = parser_create_node_block (parser);
-      if (free_list->node == NULL)
+      ((PARSER_CONTEXT *) parser)->free_nodes = parser_create_node_block (parser);
+      if (parser->free_nodes == NULL)
 	{
 	  return NULL;
 	}
     }
 
-  node = free_list->node;
-  free_list->node = free_list->node->next;
+  node = parser->free_nodes;
+  ((PARSER_CONTEXT *) parser)->free_nodes = node->next;
 
   node->parser_id = parser->id;	/* consistency check */
 
@@ -327,40 +270,17 @@ parser_create_node (const PARSER_CONTEXT * parser)
 static void
 pt_free_node_blocks (const PARSER_CONTEXT * parser)
 {
-  int idhash;
   PARSER_NODE_BLOCK *block;
-  PARSER_NODE_BLOCK **previous_block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
-  /* unlink blocks on the hash list for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&blocks_lock);
-#endif /* SERVER_MODE */
-  previous_block = &parser_Node_blocks[idhash];
-  block = *previous_block;
+  PARSER_NODE_BLOCK *next;
 
-  while (block != NULL)
+  for (block = parser->node_blocks; block != NULL; block = next)
     {
-      if (block->parser_id == parser->id)
-	{
-	  /* remove it from list, and free it */
-	  *previous_block = block->next;
-	  free_and_init (block);
-	}
-      else
-	{
-	  /* keep it, and move to next block pointer */
-	  previous_block = &block->next;
-	}
-      /* re-establish invariant */
-      block = *previous_block;
+      next = block->next;
+      free_and_init (block);
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&blocks_lock);
-#endif /* SERVER_MODE */
+
+  ((PARSER_CONTEXT *) parser)->node_blocks = NULL;
+  ((PARSER_CONTEXT *) parser)->free_nodes = NULL;
 }
 
 /*
@@ -373,11 +293,7 @@ pt_free_node_blocks (const PARSER_CONTEXT * parser)
 static PARSER_STRING_BLOCK *
 parser_create_string_block (const PARSER_CONTEXT * parser, const int length)
 {
-  int idhash;
   PARSER_STRING_BLOCK *block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
   if (length < (int) STRINGS_PER_BLOCK)
     {
@@ -419,22 +335,13 @@ parser_create_string_block (const PARSER_CONTEXT * parser, const int length)
       block->block_end = CAST_BUFLEN (length + 1001 - 1);
     }
 
-  /* remember which parser allocated this block */
-  block->parser_id = parser->id;
   block->last_string_start = -1;
   block->last_string_end = -1;
   block->u.chars[0] = 0;
 
-  /* link blocks on the hash list for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  block->next = parser_String_blocks[idhash];
-  parser_String_blocks[idhash] = block;
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
+  /* link the block on the owning parser's arena; only used by one parser (and one thread) */
+  block->next = parser->string_blocks;
+  ((PARSER_CONTEXT *) parser)->string_blocks = block;
 
   return block;
 }
@@ -457,28 +364,14 @@ parser_create_string_block (const PARSER_CONTEXT * parser, const int length)
 void *
 parser_allocate_string_buffer (const PARSER_CONTEXT * parser, const int length, const int align)
 {
-  int idhash;
   PARSER_STRING_BLOCK *block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
 
-  /* find free string list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  block = parser_String_blocks[idhash];
-  while (block != NULL
-	 && (block->parser_id != parser->id
-	     || ((block->block_end - block->last_string_end) < (length + (align - 1) + 1))))
+  /* find a block of this parser with enough room left */
+  block = parser->string_blocks;
+  while (block != NULL && ((block->block_end - block->last_string_end) < (length + (align - 1) + 1)))
     {
       block = block->next;
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
 
   if (block == NULL)
     {
@@ -510,19 +403,11 @@ pt_free_a_string_block (const PARSER_CONTEXT * parser, PARSER_STRING_BLOCK * str
 {
   PARSER_STRING_BLOCK **previous_string;
   PARSER_STRING_BLOCK *string;
-  int idhash;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
-  /* find string holding old_string for for this parse_id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  previous_string = &parser_String_blocks[idhash];
+  /* find the block on the parser's arena */
+  previous_string = &((PARSER_CONTEXT *) parser)->string_blocks;
   string = *previous_string;
-  while (string != string_to_free)
+  while (string != NULL && string != string_to_free)
     {
       previous_string = &string->next;
       string = *previous_string;
@@ -533,9 +418,6 @@ pt_free_a_string_block (const PARSER_CONTEXT * parser, PARSER_STRING_BLOCK * str
       *previous_string = string->next;
       free_and_init (string);
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
 }
 
 /*
@@ -549,25 +431,13 @@ static PARSER_STRING_BLOCK *
 pt_find_string_block (const PARSER_CONTEXT * parser, const char *old_string)
 {
   PARSER_STRING_BLOCK *string;
-  int idhash;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
-  /* find string holding old_string for for this parse_id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  string = parser_String_blocks[idhash];
-  while (string != NULL
-	 && (string->parser_id != parser->id || &(string->u.chars[string->last_string_start]) != old_string))
+  /* find the block of this parser whose last string is old_string */
+  string = parser->string_blocks;
+  while (string != NULL && &(string->u.chars[string->last_string_start]) != old_string)
     {
       string = string->next;
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
 
   return string;
 }
@@ -734,103 +604,6 @@ pt_append_bytes_for (const PARSER_CONTEXT * parser, PARSER_VARCHAR * old_string,
 }
 
 
-/*
- * pt_register_parser () - registers parser as existing by creating free list
- *   return: NO_ERROR on success, non-zero for ERROR
- *   parser(in):
- */
-static int
-pt_register_parser (const PARSER_CONTEXT * parser)
-{
-  int idhash;
-  PARSER_NODE_FREE_LIST *free_list;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
-  /* find free list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&free_lists_lock);
-#endif /* SERVER_MODE */
-  free_list = parser_Node_free_lists[idhash];
-  while (free_list != NULL && free_list->parser_id != parser->id)
-    {
-      free_list = free_list->next;
-    }
-
-  if (free_list == NULL)
-    {
-      /* this is the first time this parser allocated a node. */
-      /* set up a free list. This will only be done once per parser. */
-
-      free_list = (PARSER_NODE_FREE_LIST *) calloc (sizeof (PARSER_NODE_FREE_LIST), 1);
-      if (free_list == NULL)
-	{
-#if defined(SERVER_MODE)
-	  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (PARSER_NODE_FREE_LIST));
-	  return ER_FAILED;
-	}
-      free_list->parser_id = parser->id;
-      free_list->next = parser_Node_free_lists[idhash];
-      parser_Node_free_lists[idhash] = free_list;
-    }
-  else
-    {
-#if defined(SERVER_MODE)
-      pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
-      return ER_FAILED;
-    }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-  return NO_ERROR;
-}
-
-/*
- * pt_unregister_parser () - unregisters parser as existing,
- *                          or registers it as not existing
- *   return: none
- *   parser(in):
- */
-static void
-pt_unregister_parser (const PARSER_CONTEXT * parser)
-{
-  int idhash;
-  PARSER_NODE_FREE_LIST *free_list;
-  PARSER_NODE_FREE_LIST **previous_free_list;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
-  /* find free list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&free_lists_lock);
-#endif /* SERVER_MODE */
-  previous_free_list = &parser_Node_free_lists[idhash];
-  free_list = *previous_free_list;
-  while (free_list != NULL && free_list->parser_id != parser->id)
-    {
-      previous_free_list = &free_list->next;
-      free_list = *previous_free_list;
-    }
-
-  if (free_list)
-    {
-      /* all is ok, remove the free list from the hash list of free lists. */
-      *previous_free_list = free_list->next;
-      free_and_init (free_list);
-    }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-}
-
 void
 parser_free_node_resources (PT_NODE * node)
 {
@@ -868,12 +641,6 @@ parser_free_node_resources (PT_NODE * node)
 void
 parser_free_node (const PARSER_CONTEXT * parser, PT_NODE * node)
 {
-  int idhash;
-  PARSER_NODE_FREE_LIST *free_list;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
   if (node == NULL)
     {
       assert_release (false);
@@ -888,28 +655,6 @@ parser_free_node (const PARSER_CONTEXT * parser, PT_NODE * node)
       return;
     }
 
-  /* find free list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&free_lists_lock);
-#endif /* SERVER_MODE */
-  free_list = parser_Node_free_lists[idhash];
-  while (free_list != NULL && free_list->parser_id != parser->id)
-    {
-      free_list = free_list->next;
-    }
-
-#if defined(SERVER_MODE)
-  /* we can unlock mutex, since this free_list is only used by one parser */
-  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-
-  if (free_list == NULL)
-    {
-      /* this is an programming error ! The parser does not exist! */
-      return;
-    }
-
   if (node->parser_id != parser->id)
     {
       /* this is an programming error ! The node is not from this parser. */
@@ -928,8 +673,8 @@ parser_free_node (const PARSER_CONTEXT * parser, PT_NODE * node)
    */
   node->node_type = PT_LAST_NODE_NUMBER;
 
-  node->next = free_list->node;
-  free_list->node = node;
+  node->next = parser->free_nodes;
+  ((PARSER_CONTEXT *) parser)->free_nodes = node;
 }
 
 
@@ -1122,40 +867,16 @@ pt_get_varchar_length (const PARSER_VARCHAR * string)
 static void
 pt_free_string_blocks (const PARSER_CONTEXT * parser)
 {
-  int idhash;
   PARSER_STRING_BLOCK *block;
-  PARSER_STRING_BLOCK **previous_block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
-  /* unlink blocks on the hash list for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  previous_block = &parser_String_blocks[idhash];
-  block = *previous_block;
+  PARSER_STRING_BLOCK *next;
 
-  while (block != NULL)
+  for (block = parser->string_blocks; block != NULL; block = next)
     {
-      if (block->parser_id == parser->id)
-	{
-	  /* remove it from list, and free it */
-	  *previous_block = block->next;
-	  free_and_init (block);
-	}
-      else
-	{
-	  /* keep it, and move to next block pointer */
-	  previous_block = &block->next;
-	}
-      /* re-establish invariant */
-      block = *previous_block;
+      next = block->next;
+      free_and_init (block);
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
+
+  ((PARSER_CONTEXT *) parser)->string_blocks = NULL;
 }
 
 
@@ -1196,12 +917,6 @@ parser_create_parser (void)
   pthread_mutex_unlock (&parser_id_lock);
 #endif /* SERVER_MODE */
 
-  if (pt_register_parser (parser) == ER_FAILED)
-    {
-      free_and_init (parser);
-      return NULL;
-    }
-
   parser->execution_values.row_count = -1;
 
   /* Generate random values for rand() and drand() */
@@ -1244,11 +959,9 @@ parser_free_parser (PARSER_CONTEXT * parser)
 
   assert (parser != NULL);
 
-  /* free string blocks */
+  /* release the parser's arena wholesale: all strings, then all nodes */
   pt_free_string_blocks (parser);
-  /* free node blocks */
   pt_free_node_blocks (parser);
-  pt_unregister_parser (parser);
 
   if (parser->error_buffer)
     {
@@ -3627,6 +3627,11 @@ struct parser_context
   int id;			/* internal parser id */
   int statement_number;		/* user-initialized, incremented by parser */
 
+  struct parser_node_block *node_blocks;	/* arena of node blocks owned by this parser; released wholesale by
+						 * parser_free_parser */
+  struct parser_string_block *string_blocks;	/* arena of string blocks owned by this parser */
+  PT_NODE *free_nodes;		/* list of freed nodes eligible for re-use by this parser */
+
   const char *original_buffer;	/* pointer to the original parse buffer */
   const char *buffer;		/* for parse buffer */
   FILE *file;			/* for parse file */
@@ -3654,6 +3659,8 @@ struct parser_context
 						 * session. */
   int host_var_count;		/* number of input host variables */
   int auto_param_count;		/* number of auto parameterized variables */
+  int plan_variant_bucket;	/* selectivity bucket of the most selective bound parameter whose histogram lookup
+				 * influenced the last optimized plan; 0 when the plan is parameter insensitive */
   int dbval_cnt;		/* to be assigned to XASL */
   int line, column;		/* current input line and column */
 
@@ -569,6 +569,10 @@ static METHOD_SIG_LIST *pt_to_method_sig_list (PARSER_CONTEXT * parser, PT_NODE
 					       PT_NODE * subquery_as_attr_list);
 
 static int pt_is_subquery (PT_NODE * node);
+static bool pt_is_compile_time_const_expr (const PT_NODE * node);
+
+static PT_NODE *pt_check_shareable_subplan (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk);
+static const char *pt_subplan_sharing_key (PARSER_CONTEXT * parser, PT_NODE * node);
 
 static int *pt_make_identity_offsets (PT_NODE * attr_list);
 
@@ -4122,6 +4126,12 @@ pt_to_aggregate_node (PARSER_CONTEXT * parser, PT_NODE * tree, void *arg, int *c
 	    {
 	      BTID *btid = NULL;
 	      btid = sm_find_index (classop, NULL, 0, need_unique_index, false, &aggregate_list->btid);
+	      if (btid == NULL)
+		{
+		  /* no unique index: a regular index over a NOT NULL attribute also sees every row, so COUNT(*) can
+		   * still be answered from the b-tree alone (by a leaf-level walk on the server side) */
+		  btid = sm_find_index_on_non_null (classop, &aggregate_list->btid);
+		}
 	      if (btid != NULL)
 		{
 		  /* If btree does not exist, optimize with heap in non-MVCC */
@@ -6365,6 +6375,135 @@ pt_make_regu_reguvalues_list (PARSER_CONTEXT * parser, const PT_NODE * node, UNB
   return regu;
 }
 
+/*
+ * pt_is_compile_time_const_expr () - checks whether an expression subtree consists only of literal values combined
+ *                                    by deterministic operators, so that it can be evaluated once at XASL
+ *                                    generation time
+ *   return: true if the subtree can be folded to a single value
+ *   node(in): expression subtree; NULL stands for an absent operand
+ *
+ * Note: constant expressions are normally folded during semantic analysis; this check catches the residues left
+ * behind by view translation and the query rewrites, which are not type checked again.  Operators whose result
+ * depends on the execution context (system date/time, users, session variables, serials, random) must stay in
+ * the tree and are kept out of the operator list below.
+ */
+static bool
+pt_is_compile_time_const_expr (const PT_NODE * node)
+{
+  if (node == NULL)
+    {
+      return true;		/* an absent operand */
+    }
+
+  switch (node->node_type)
+    {
+    case PT_VALUE:
+      return node->type_enum != PT_TYPE_NONE;
+
+    case PT_EXPR:
+      if (node->flag.do_not_fold || node->type_enum == PT_TYPE_NONE || node->type_enum == PT_TYPE_MAYBE)
+	{
+	  return false;
+	}
+
+      switch (node->info.expr.op)
+	{
+	case PT_PLUS:
+	case PT_MINUS:
+	case PT_TIMES:
+	case PT_DIVIDE:
+	case PT_UNARY_MINUS:
+	case PT_MOD:
+	case PT_MODULUS:
+	case PT_DIV:
+	case PT_BIT_AND:
+	case PT_BIT_OR:
+	case PT_BIT_XOR:
+	case PT_BIT_NOT:
+	case PT_BIT_COUNT:
+	case PT_BITSHIFT_LEFT:
+	case PT_BITSHIFT_RIGHT:
+	case PT_ABS:
+	case PT_CEIL:
+	case PT_FLOOR:
+	case PT_ROUND:
+	case PT_TRUNC:
+	case PT_SIGN:
+	case PT_SQRT:
+	case PT_POWER:
+	case PT_EXP:
+	case PT_LN:
+	case PT_LOG2:
+	case PT_LOG10:
+	case PT_LOG:
+	case PT_SIN:
+	case PT_COS:
+	case PT_TAN:
+	case PT_COT:
+	case PT_ASIN:
+	case PT_ACOS:
+	case PT_ATAN:
+	case PT_ATAN2:
+	case PT_DEGREES:
+	case PT_RADIANS:
+	case PT_PI:
+	case PT_CONCAT:
+	case PT_CONCAT_WS:
+	case PT_LOWER:
+	case PT_UPPER:
+	case PT_TRIM:
+	case PT_LTRIM:
+	case PT_RTRIM:
+	case PT_LPAD:
+	case PT_RPAD:
+	case PT_LEFT:
+	case PT_RIGHT:
+	case PT_MID:
+	case PT_SUBSTRING:
+	case PT_SUBSTRING_INDEX:
+	case PT_REPLACE:
+	case PT_TRANSLATE:
+	case PT_POSITION:
+	case PT_INSTR:
+	case PT_STRCMP:
+	case PT_REVERSE:
+	case PT_REPEAT:
+	case PT_SPACE:
+	case PT_CHR:
+	case PT_ASCII:
+	case PT_CHAR_LENGTH:
+	case PT_BIT_LENGTH:
+	case PT_OCTET_LENGTH:
+	case PT_TO_NUMBER:
+	case PT_TO_CHAR:
+	case PT_TO_DATE:
+	case PT_TO_TIME:
+	case PT_TO_TIMESTAMP:
+	case PT_TO_DATETIME:
+	case PT_MONTHS_BETWEEN:
+	case PT_ADD_MONTHS:
+	case PT_LAST_DAY:
+	case PT_DATEDIFF:
+	case PT_TIMEDIFF:
+	case PT_EXTRACT:
+	  break;
+
+	case PT_CAST:
+	  return pt_is_compile_time_const_expr (node->info.expr.arg1);
+
+	default:
+	  return false;
+	}
+
+      return (pt_is_compile_time_const_expr (node->info.expr.arg1)
+	      && pt_is_compile_time_const_expr (node->info.expr.arg2)
+	      && pt_is_compile_time_const_expr (node->info.expr.arg3));
+
+    default:
+      return false;
+    }
+}
+
 /*
  * pt_make_regu_constant () - takes a db_value and db_type and makes
  *                            a regu_variable constant
@@ -7614,6 +7753,22 @@ pt_to_regu_variable (PARSER_CONTEXT * parser, PT_NODE * node, UNBOX unbox)
 	      break;
 
 	    case PT_EXPR:
+	      if (node->info.expr.op != PT_FUNCTION_HOLDER && !pt_has_error (parser)
+		  && pt_is_compile_time_const_expr (node))
+		{
+		  /* a constant residue left behind by the post-semantic rewrites; evaluate it once now rather than
+		   * once per tuple through fetch_peek_arith */
+		  regu_alloc (val);
+		  pt_evaluate_tree (parser, node, val, 1);
+		  if (!pt_has_error (parser))
+		    {
+		      regu = pt_make_regu_constant (parser, val, pt_node_to_db_type (node), node);
+		      break;
+		    }
+		  /* evaluation failed; leave the expression to the executor */
+		  pt_reset_error (parser);
+		}
+
 	      if (node->info.expr.op == PT_FUNCTION_HOLDER)
 		{
 		  //TODO FIND WHY NEXT WASN'T RESTORED
@@ -11421,6 +11576,11 @@ pt_instnum_to_key_limit (PARSER_CONTEXT * parser, QO_PLAN * plan, XASL_NODE * xa
 	      return NO_ERROR;
 	    }
 	}
+      /* a filter at any level of the scan chain can reject rows; a key limit pushed below it would be wrong */
+      if (xptr->if_pred || xptr->after_join_pred)
+	{
+	  return NO_ERROR;
+	}
     }
 
   /* if there is an orderby_num pred, meaning order by was not skipped */
@@ -11492,7 +11652,6 @@ pt_instnum_to_key_limit (PARSER_CONTEXT * parser, QO_PLAN * plan, XASL_NODE * xa
       xasl->instnum_pred = NULL;
     }
 
-  /* cannot handle for join; skip and go ahead */
   if (xasl->scan_ptr == NULL)
     {
       /* set the key limit to all the eligible spec lists (the ones that have index scans.) */
@@ -11513,6 +11672,22 @@ pt_instnum_to_key_limit (PARSER_CONTEXT * parser, QO_PLAN * plan, XASL_NODE * xa
 	    }
 	}
     }
+  else if (qo_plan_preserves_outer_rows (plan))
+    {
+      /* Every outer row of this join pipeline produces at least one result row, so the upper limit also bounds the
+       * number of outer rows worth fetching: push it into the driving index scan. The instnum predicate stays in
+       * place and still trims the result exactly; the key limit only stops the outer scan from feeding the join rows
+       * that could never make it past the limit. */
+      spec_list = xasl->spec_list;
+      if (spec_list != NULL && spec_list->next == NULL && spec_list->indexptr != NULL)
+	{
+	  ret = pt_to_key_limit (parser, NULL, limit_infop, &(spec_list->indexptr->key_info), false);
+	  if (ret != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	}
+    }
 
   /* we're done with the generated key limit tree */
   db_private_free (NULL, limit_infop);
@@ -17506,6 +17681,74 @@ exit:
 }
 
 
+/*
+ * pt_check_shareable_subplan () - looks for constructs that make a subquery
+ *	unsafe to share among several consumers (non-deterministic expressions,
+ *	serials and method calls must be evaluated once per occurrence)
+ *   return:
+ *   parser(in):
+ *   node(in):
+ *   arg(in/out): bool *; set to false when an unsafe construct is found
+ *   continue_walk(in/out):
+ */
+static PT_NODE *
+pt_check_shareable_subplan (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk)
+{
+  bool *is_shareable = (bool *) arg;
+
+  if (node->node_type == PT_METHOD_CALL
+      || (node->node_type == PT_EXPR
+	  && (node->info.expr.op == PT_RAND || node->info.expr.op == PT_DRAND || node->info.expr.op == PT_RANDOM
+	      || node->info.expr.op == PT_DRANDOM || node->info.expr.op == PT_SYS_GUID
+	      || PT_IS_SERIAL (node->info.expr.op))))
+    {
+      *is_shareable = false;
+      *continue_walk = PT_STOP_WALK;
+    }
+
+  return node;
+}
+
+/*
+ * pt_subplan_sharing_key () - text key under which the materialized list file
+ *	of a subquery can be shared by every identical consumer in a statement
+ *   return: printed query tree, or NULL if the subquery must not be shared
+ *   parser(in):
+ *   node(in): query node, before XASL generation
+ *
+ * Note: view/derived table expansion copies the same subquery text into an
+ *	 independent parse tree per consumer, so the copies can only be matched
+ *	 by their printed form.  Only uncorrelated subqueries qualify; a
+ *	 correlated subquery depends on the outer row and its printed text does
+ *	 not identify the outer spec it is bound to.
+ */
+static const char *
+pt_subplan_sharing_key (PARSER_CONTEXT * parser, PT_NODE * node)
+{
+  bool is_shareable = true;
+  unsigned int save_custom;
+  const char *key;
+
+  if (!PT_IS_QUERY (node) || !pt_is_subquery (node) || node->info.query.correlation_level != 0
+      || node->info.query.flag.do_not_cache || node->info.query.flag.reexecute)
+    {
+      return NULL;
+    }
+
+  (void) parser_walk_tree (parser, node, pt_check_shareable_subplan, &is_shareable, NULL, NULL);
+  if (!is_shareable)
+    {
+      return NULL;
+    }
+
+  save_custom = parser->custom_print;
+  parser->custom_print |= PT_CONVERT_RANGE;
+  key = parser_print_tree (parser, node);
+  parser->custom_print = save_custom;
+
+  return key;
+}
+
 /*
  * parser_generate_xasl_proc () - Creates xasl proc for parse tree.
  * 	Also used for direct recursion, not for subquery recursion
@@ -17519,11 +17762,24 @@ parser_generate_xasl_proc (PARSER_CONTEXT * parser, PT_NODE * node, PT_NODE * qu
 {
   XASL_NODE *xasl = NULL;
   PT_NODE *query;
+  const char *sharing_key = NULL;
+  PT_NODE *scope_node = NULL;
   bool query_Plan_dump_fp_open = false;
 
   /* we should propagate abort error from the server */
   if (!parser->flag.abort && (PT_IS_QUERY (node) || node->node_type == PT_CTE))
     {
+      /* subplans can only be shared among consumers of the same enclosing query; the shared proc must be gathered
+       * into a single aptr_list */
+      if (parser->symbols != NULL && parser->symbols->stack != NULL)
+	{
+	  scope_node = parser->symbols->stack->query_node;
+	}
+      if (scope_node != NULL)
+	{
+	  sharing_key = pt_subplan_sharing_key (parser, node);
+	}
+
       /* check for cached query xasl */
       for (query = query_list; query; query = query->next)
 	{
@@ -17533,6 +17789,16 @@ parser_generate_xasl_proc (PARSER_CONTEXT * parser, PT_NODE * node, PT_NODE * qu
 	      node->info.query.xasl = query->info.query.xasl;
 	      node->info.query.correlation_level = query->info.query.correlation_level;
 
+	      return (XASL_NODE *) node->info.query.xasl;
+	    }
+
+	  /* share one materialized list file among identical uncorrelated subqueries of the same scope */
+	  if (sharing_key != NULL && query->info.query.xasl && query->node_type == node->node_type
+	      && query->etc == (void *) scope_node && query->alias_print != NULL
+	      && strcmp (query->alias_print, sharing_key) == 0)
+	    {
+	      node->info.query.xasl = query->info.query.xasl;
+
 	      return (XASL_NODE *) node->info.query.xasl;
 	    }
 	}			/* for (query = ... ) */
@@ -17697,6 +17963,23 @@ parser_generate_xasl_proc (PARSER_CONTEXT * parser, PT_NODE * node, PT_NODE * qu
 	  XASL_SET_FLAG (xasl, XASL_ZERO_CORR_LEVEL);
 	}
 
+      /* remember shareable subplans; an identical derived table in the same scope reuses this proc and scans its
+       * list file instead of materializing its own */
+      if (sharing_key != NULL && node->info.query.xasl != NULL)
+	{
+	  query = parser_new_node (parser, node->node_type);
+	  if (query != NULL)
+	    {
+	      query->info.query.id = node->info.query.id;
+	      query->info.query.xasl = node->info.query.xasl;
+	      query->info.query.correlation_level = node->info.query.correlation_level;
+	      query->alias_print = sharing_key;
+	      query->etc = (void *) scope_node;
+
+	      query_list = parser_append_node (query, query_list);
+	    }
+	}
+
 /* BUG FIX - COMMENT OUT: DO NOT REMOVE ME FOR USE IN THE FUTURE */
 #if 0
       /* cache query xasl */
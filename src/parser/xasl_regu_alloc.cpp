@@ -272,6 +272,10 @@ regu_init (arith_list_node &arith)
   arith.thirdptr = NULL;
   arith.misc_operand = LEADING;
   arith.rand_seed = NULL;
+  arith.cast_cache.dest_domain = NULL;
+  arith.cast_cache.src_type = DB_TYPE_NULL;
+  arith.cast_cache.cast_func = NULL;
+  arith.date_fmt_cache = NULL;
 
   regu_alloc (arith.value);
 }
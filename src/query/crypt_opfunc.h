@@ -53,6 +53,7 @@ extern void str_to_hex_prealloced (const char *src, int src_len, char *dest, int
 
 extern int crypt_generate_random_bytes (char *dest, int length);
 extern void crypt_crc32 (const char *src, int src_len, int *dest);
+extern void crypt_crc32c (const char *src, int src_len, int *dest);
 
 extern int crypt_dblink_encrypt (const unsigned char *str, int str_len, unsigned char *cipher_buffer,
 				 unsigned char *mk);
@@ -45,7 +45,7 @@
 #include "dbtype.h"
 
 #define CURSOR_BUFFER_SIZE              DB_PAGESIZE
-#define CURSOR_BUFFER_AREA_SIZE         IO_MAX_PAGE_SIZE
+#define CURSOR_BUFFER_AREA_SIZE         QFILE_PAGE_TRANSFER_SIZE
 
 enum
 {
@@ -569,6 +569,22 @@ cursor_get_list_file_page (CURSOR_ID * cursor_id_p, VPID * vpid_p)
 	}
     }
 
+  /* if not found, check the window fetched ahead of time */
+  if (cursor_id_p->buffer == NULL && cursor_id_p->prefetch_filled_size > 0
+      && VPID_EQ (vpid_p, &cursor_id_p->prefetch_vpid))
+    {
+      page_p = cursor_id_p->buffer_area;
+
+      cursor_id_p->buffer_area = cursor_id_p->prefetch_area;
+      cursor_id_p->buffer_filled_size = cursor_id_p->prefetch_filled_size;
+      cursor_id_p->prefetch_area = page_p;
+      cursor_id_p->prefetch_filled_size = 0;
+      VPID_SET_NULL (&cursor_id_p->prefetch_vpid);
+
+      cursor_id_p->buffer = cursor_id_p->buffer_area;
+      QFILE_COPY_VPID (&cursor_id_p->header_vpid, vpid_p);
+    }
+
   /* if not found, get the page from server */
   if (cursor_id_p->buffer == NULL)
     {
@@ -588,6 +604,89 @@ cursor_get_list_file_page (CURSOR_ID * cursor_id_p, VPID * vpid_p)
   return NO_ERROR;
 }
 
+/*
+ * cursor_prefetch_next_page_area () - Fetch the page window following the
+ *                                     buffered one from the server
+ *   return: NO_ERROR on all ok, ER status otherwise
+ *   cursor_id(in/out): Cursor identifier
+ *
+ * Note: Meant to be called while the application is still consuming tuples
+ *       from the current buffer area, so that the subsequent
+ *       cursor_next_tuple() calls find their pages locally instead of paying
+ *       a server round trip. Does nothing when the buffered window already
+ *       reaches the end of the list file or was prefetched before.
+ */
+int
+cursor_prefetch_next_page_area (CURSOR_ID * cursor_id_p)
+{
+  VPID next_vpid;
+  char *page_p;
+  int page_size;
+  int ret_val;
+
+  if (cursor_id_p == NULL)
+    {
+      assert (0);
+      return ER_FAILED;
+    }
+
+  if (cursor_id_p->buffer_area == NULL || cursor_id_p->buffer_filled_size <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  /* locate the last page received from the server */
+  page_p = cursor_id_p->buffer_area;
+  page_size = CURSOR_BUFFER_SIZE;
+  while (page_size < cursor_id_p->buffer_filled_size)
+    {
+      page_p += CURSOR_BUFFER_SIZE;
+      page_size += CURSOR_BUFFER_SIZE;
+    }
+
+  if (QFILE_GET_OVERFLOW_PAGE_ID (page_p) == NULL_PAGEID)
+    {
+      QFILE_GET_NEXT_VPID (&next_vpid, page_p);
+    }
+  else
+    {
+      QFILE_GET_OVERFLOW_VPID (&next_vpid, page_p);
+    }
+
+  if (VPID_ISNULL (&next_vpid))
+    {
+      return NO_ERROR;
+    }
+
+  if (cursor_id_p->prefetch_filled_size > 0 && VPID_EQ (&next_vpid, &cursor_id_p->prefetch_vpid))
+    {
+      return NO_ERROR;
+    }
+
+  if (cursor_id_p->prefetch_area == NULL)
+    {
+      cursor_id_p->prefetch_area = (char *) malloc (CURSOR_BUFFER_AREA_SIZE);
+      if (cursor_id_p->prefetch_area == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) CURSOR_BUFFER_AREA_SIZE);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+    }
+
+  ret_val = qfile_get_list_file_page (cursor_id_p->query_id, next_vpid.volid, next_vpid.pageid,
+				      cursor_id_p->prefetch_area, &cursor_id_p->prefetch_filled_size);
+  if (ret_val != NO_ERROR)
+    {
+      cursor_id_p->prefetch_filled_size = 0;
+      VPID_SET_NULL (&cursor_id_p->prefetch_vpid);
+      return ret_val;
+    }
+
+  QFILE_COPY_VPID (&cursor_id_p->prefetch_vpid, &next_vpid);
+
+  return NO_ERROR;
+}
+
 static OID *
 cursor_get_oid_from_vobj (OID * current_oid_p, int length)
 {
@@ -1227,6 +1326,9 @@ cursor_open (CURSOR_ID * cursor_id_p, QFILE_LIST_ID * list_id_p, bool updatable,
   cursor_id_p->buffer = NULL;
   cursor_id_p->buffer_area = NULL;
   cursor_id_p->buffer_filled_size = 0;
+  cursor_id_p->prefetch_area = NULL;
+  cursor_id_p->prefetch_filled_size = 0;
+  VPID_SET_NULL (&cursor_id_p->prefetch_vpid);
   cursor_id_p->list_id = empty_list_id;
   cursor_id_p->prefetch_lock_mode = DB_FETCH_READ;
   cursor_id_p->is_copy_tuple_value = true;	/* copy */
@@ -1359,6 +1461,13 @@ cursor_free (CURSOR_ID * cursor_id_p)
       cursor_id_p->buffer = NULL;
     }
 
+  if (cursor_id_p->prefetch_area != NULL)
+    {
+      free_and_init (cursor_id_p->prefetch_area);
+      cursor_id_p->prefetch_filled_size = 0;
+      VPID_SET_NULL (&cursor_id_p->prefetch_vpid);
+    }
+
   free_and_init (cursor_id_p->tuple_record.tpl);
   free_and_init (cursor_id_p->oid_set);
 
@@ -66,6 +66,9 @@ struct cursor_id
   char *buffer;			/* Current page */
   char *buffer_area;
   int buffer_filled_size;
+  char *prefetch_area;		/* Page window fetched ahead of the buffer area */
+  int prefetch_filled_size;
+  VPID prefetch_vpid;		/* Header page identifier in prefetch area */
   int buffer_tuple_count;	/* Tuple count in current page */
   int current_tuple_no;		/* Tuple position in current page */
   int current_tuple_offset;	/* Tuple offset in current page */
@@ -118,6 +121,7 @@ extern void cursor_print_list (QUERY_ID query_id, QFILE_LIST_ID * list_id);
 #endif
 extern bool cursor_open (CURSOR_ID * cursor_id, QFILE_LIST_ID * list_id, bool updatable, bool oid_included);
 extern int cursor_next_tuple (CURSOR_ID * cursor_id);
+extern int cursor_prefetch_next_page_area (CURSOR_ID * cursor_id);
 extern int cursor_get_tuple_value_list (CURSOR_ID * cursor_id, int size, DB_VALUE * value_list);
 extern void cursor_close (CURSOR_ID * cursor_id);
 extern DB_FETCH_MODE cursor_set_prefetch_lock_mode (CURSOR_ID * cursor_id, DB_FETCH_MODE mode);
@@ -29,6 +29,7 @@
 #include "object_representation.h"
 #include "query_list.h"
 #include "regu_var.hpp"
+#include "system_parameter.h"
 
 #ifndef DBDEF_HEADER_
 #define DBDEF_HEADER_
@@ -395,7 +396,7 @@ dblink_bind_param (DBLINK_SCAN_INFO * scan_info, VAL_DESCR * vd, DBLINK_HOST_VAR
 	case DB_TYPE_NCHAR:
 	  a_type = CCI_A_TYPE_STR;
 	  u_type = CCI_U_TYPE_STRING;
-	  value = (void *) vd->dbval_ptr[i].data.ch.medium.buf;
+	  value = (void *) db_get_string (&vd->dbval_ptr[i]);
 	  break;
 	case DB_TYPE_DATE:
 	  a_type = CCI_A_TYPE_DATE;
@@ -519,6 +520,10 @@ dblink_open_scan (DBLINK_SCAN_INFO * scan_info, struct access_spec_node *spec,
 	  return ER_DBLINK;
 	}
 
+      /* remote rows arrive in blocks of fetch_size per network round trip and dblink_scan_next () is then served
+       * from the block buffer; the cci default (100 rows) makes a large remote scan round-trip bound */
+      (void) cci_fetch_size (scan_info->stmt_handle, prm_get_integer_value (PRM_ID_DBLINK_FETCH_SIZE));
+
       if (host_vars->count > 0)
 	{
 	  if ((ret = dblink_bind_param (scan_info, vd, host_vars)) < 0)
@@ -380,6 +380,9 @@ static int do_recreate_saved_indexes (MOP classmop, SM_CONSTRAINT_INFO * index_s
 static int do_alter_index_status (PARSER_CONTEXT * parser, const PT_NODE * statement);
 
 int ib_thread_count = 0;
+/* true while ALTER INDEX ... REBUILD WITH ONLINE recreates the index it has just dropped; the drop raises the class
+ * lock above IX within the same statement, which must not disqualify the online build */
+bool ib_rebuild_in_progress = false;
 
 /*
  * Function Group :
@@ -3089,6 +3092,7 @@ do_alter_index_rebuild (PARSER_CONTEXT * parser, const PT_NODE * statement)
   const char *comment_str = NULL;
   bool do_rollback = false;
   SM_INDEX_STATUS saved_index_status = SM_NORMAL_INDEX;
+  SM_INDEX_STATUS new_index_status = SM_NORMAL_INDEX;
 
   /* TODO refactor this code, the code in create_or_drop_index_helper and the code in do_drop_index in order to remove
    * duplicate code */
@@ -3132,6 +3136,17 @@ do_alter_index_rebuild (PARSER_CONTEXT * parser, const PT_NODE * statement)
     }
 
   saved_index_status = idx->index_status;
+  new_index_status = saved_index_status;
+
+  if (statement->info.index.index_status == SM_ONLINE_INDEX_BUILDING_IN_PROGRESS
+      && saved_index_status == SM_NORMAL_INDEX)
+    {
+      /* REBUILD WITH ONLINE: recreate through the online loader, so writers are only blocked while the old index is
+       * dropped, not for the duration of the build. An invisible index keeps the offline path because the online
+       * load would flip its status to normal when it finishes. */
+      new_index_status = SM_ONLINE_INDEX_BUILDING_IN_PROGRESS;
+      ib_thread_count = statement->info.index.ib_threads;
+    }
 
   if (statement->info.index.comment != NULL)
     {
@@ -3319,9 +3334,11 @@ do_alter_index_rebuild (PARSER_CONTEXT * parser, const PT_NODE * statement)
       goto error_exit;
     }
 
+  ib_rebuild_in_progress = (new_index_status == SM_ONLINE_INDEX_BUILDING_IN_PROGRESS);
   error =
     sm_add_constraint (obj, original_ctype, index_name, (const char **) attnames, asc_desc, attrs_prefix_length, false,
-		       p_pred_index_info, func_index_info, comment_str, saved_index_status);
+		       p_pred_index_info, func_index_info, comment_str, new_index_status);
+  ib_rebuild_in_progress = false;
   if (error != NO_ERROR)
     {
       goto error_exit;
@@ -15420,3 +15437,9 @@ ib_get_thread_count ()
 {
   return ib_thread_count;
 }
+
+bool
+ib_is_rebuild_in_progress ()
+{
+  return ib_rebuild_in_progress;
+}
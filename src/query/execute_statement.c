@@ -4763,6 +4763,9 @@ do_set_xaction (PARSER_CONTEXT * parser, PT_NODE * statement)
   int error = NO_ERROR;
   bool async_ws;
   float wait_secs;
+  bool set_isolation = false;
+  bool set_timeout = false;
+  int wait_msecs = 0;
 
   db_make_null (&val);
 
@@ -4797,7 +4800,7 @@ do_set_xaction (PARSER_CONTEXT * parser, PT_NODE * statement)
 
 	  if (error == NO_ERROR)
 	    {
-	      error = tran_reset_isolation (tran_isolation, async_ws);
+	      set_isolation = true;
 	    }
 	  break;
 	case PT_TIMEOUT:
@@ -4818,7 +4821,8 @@ do_set_xaction (PARSER_CONTEXT * parser, PT_NODE * statement)
 		{
 		  wait_secs *= 1000;
 		}
-	      (void) tran_reset_wait_times ((int) wait_secs);
+	      wait_msecs = (int) wait_secs;
+	      set_timeout = true;
 	    }
 	  break;
 	default:
@@ -4828,6 +4832,23 @@ do_set_xaction (PARSER_CONTEXT * parser, PT_NODE * statement)
       mode = mode->next;
     }
 
+  /* apply the collected settings; when the statement changes both, fold them into one server round trip */
+  if (error == NO_ERROR)
+    {
+      if (set_isolation && set_timeout)
+	{
+	  error = tran_reset_isolation_and_wait_times (tran_isolation, async_ws, wait_msecs);
+	}
+      else if (set_isolation)
+	{
+	  error = tran_reset_isolation (tran_isolation, async_ws);
+	}
+      else if (set_timeout)
+	{
+	  (void) tran_reset_wait_times (wait_msecs);
+	}
+    }
+
   return error;
 }
 
@@ -14286,6 +14307,8 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
       /* mark the beginning of another level of xasl packing */
       pt_enter_packing_buf ();
 
+      parser->plan_variant_bucket = 0;	/* set during optimization */
+
       AU_SAVE_AND_DISABLE (au_save);	/* this prevents authorization checking during generating XASL */
       /* parser_generate_xasl() will build XASL tree from parse tree */
       contextp->xasl = parser_generate_xasl (parser, statement);
@@ -14295,6 +14318,24 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
 	}
       AU_RESTORE (au_save);
 
+      if (contextp->xasl != NULL && parser->plan_variant_bucket > 0)
+	{
+	  /* the plan was costed with histogram lookups on bound parameter values; key it by the selectivity bucket
+	   * of those values so that it coexists in the XASL cache with the variants compiled under differently
+	   * skewed bindings instead of replacing them */
+	  char variant_tag[16];
+
+	  snprintf (variant_tag, sizeof (variant_tag), " ?v%d", parser->plan_variant_bucket);
+	  contextp->sql_hash_text = pt_append_string (parser, (char *) statement->alias_print, variant_tag);
+	  err =
+	    SHA1Compute ((unsigned char *) contextp->sql_hash_text, (unsigned) strlen (contextp->sql_hash_text),
+			 &contextp->sha1);
+	  if (err != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	    }
+	}
+
       if (contextp->xasl && (err == NO_ERROR) && !pt_has_error (parser))
 	{
 	  /* convert the created XASL tree to the byte stream for transmission to the server */
@@ -15846,11 +15887,11 @@ do_scope (PARSER_CONTEXT * parser, PT_NODE * statement)
 
 	case PT_EXPRESSION:
 	  do_Trigger_involved = true;
-#if 0
-	  if (prm_get_integer_value (PRM_ID_XASL_MAX_PLAN_CACHE_ENTRIES) > 0)
+	  if (prm_get_integer_value (PRM_ID_XASL_CACHE_MAX_ENTRIES) > 0)
 	    {
-
-	      /* prepare a statement to execute */
+	      /* Prepare the statement so that the plan is looked up in the XASL cache like a normal statement instead
+	       * of being regenerated for every raised event.  A stale cache entry surfaces as
+	       * ER_QPROC_INVALID_XASLNODE, which makes eval_action() recompile the activity from source. */
 	      error = do_prepare_statement (parser, stmt->info.trigger_action.expression);
 	      if (error >= NO_ERROR)
 		{
@@ -15862,9 +15903,6 @@ do_scope (PARSER_CONTEXT * parser, PT_NODE * statement)
 	    {
 	      error = do_statement (parser, stmt->info.trigger_action.expression);
 	    }
-#else
-	  error = do_statement (parser, stmt->info.trigger_action.expression);
-#endif
 	  /* Do not reset do_Trigger_involved here. This is intention. */
 	  break;
 
@@ -2121,7 +2121,8 @@ fetch_peek_arith (THREAD_ENTRY * thread_p, REGU_VARIABLE * regu_var, val_descr *
 	{
 	  PRIM_SET_NULL (arithptr->value);
 	}
-      else if (db_to_char (peek_left, peek_right, peek_third, arithptr->value, arithptr->domain) != NO_ERROR)
+      else if (db_to_char_cached (peek_left, peek_right, peek_third, arithptr->value, arithptr->domain,
+				  &arithptr->date_fmt_cache) != NO_ERROR)
 	{
 	  goto error;
 	}
@@ -2351,11 +2352,13 @@ fetch_peek_arith (THREAD_ENTRY * thread_p, REGU_VARIABLE * regu_var, val_descr *
 	{
 	  if (REGU_VARIABLE_IS_FLAGED (regu_var, REGU_VARIABLE_STRICT_TYPE_CAST) && arithptr->opcode == T_CAST_WRAP)
 	    {
-	      dom_status = tp_value_cast (peek_right, arithptr->value, arithptr->domain, false);
+	      dom_status = tp_value_cast_cached (peek_right, arithptr->value, arithptr->domain, false,
+						 &arithptr->cast_cache);
 	    }
 	  else
 	    {
-	      dom_status = tp_value_cast_force (peek_right, arithptr->value, arithptr->domain, false);
+	      dom_status = tp_value_cast_force_cached (peek_right, arithptr->value, arithptr->domain, false,
+						       &arithptr->cast_cache);
 	    }
 
 	  if (dom_status != DOMAIN_COMPATIBLE)
@@ -2398,7 +2401,7 @@ fetch_peek_arith (THREAD_ENTRY * thread_p, REGU_VARIABLE * regu_var, val_descr *
 	{
 	  TP_DOMAIN_STATUS status;
 
-	  status = tp_value_cast (peek_right, arithptr->value, arithptr->domain, false);
+	  status = tp_value_cast_cached (peek_right, arithptr->value, arithptr->domain, false, &arithptr->cast_cache);
 	  if (status != NO_ERROR)
 	    {
 	      PRIM_SET_NULL (arithptr->value);
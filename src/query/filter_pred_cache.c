@@ -378,12 +378,19 @@ fpcache_claim (THREAD_ENTRY * thread_p, BTID * btid, or_predicate * or_pred, pre
       else
 	{
 	  /* Hash-table entry found. Try to claim a filter predicate expression, if there is any available. */
-	  ATOMIC_INC_64 (&fpcache_Stat_hit, 1);
 	  if (fpcache_entry->clone_stack_head >= 0)
 	    {
 	      /* Available filter predicate expression. */
 	      assert (fpcache_entry->clone_stack_head < fpcache_Clone_stack_size);
 	      *filter_pred = fpcache_entry->clone_stack[fpcache_entry->clone_stack_head--];
+	    }
+	  /* Unlock hash-table entry before updating statistics; concurrent DML on the same filtered index queues on
+	   * this mutex and the counters are atomic anyway. */
+	  pthread_mutex_unlock (&fpcache_entry->mutex);
+
+	  ATOMIC_INC_64 (&fpcache_Stat_hit, 1);
+	  if (*filter_pred != NULL)
+	    {
 	      ATOMIC_INC_64 (&fpcache_Stat_clone_hit, 1);
 	      ATOMIC_INC_32 (&fpcache_Clone_counter, -1);
 	    }
@@ -392,8 +399,6 @@ fpcache_claim (THREAD_ENTRY * thread_p, BTID * btid, or_predicate * or_pred, pre
 	      /* No filter predicate expression is available. */
 	      ATOMIC_INC_64 (&fpcache_Stat_clone_miss, 1);
 	    }
-	  /* Unlock hash-table entry. */
-	  pthread_mutex_unlock (&fpcache_entry->mutex);
 	}
     }
 
@@ -429,9 +434,15 @@ fpcache_retire (THREAD_ENTRY * thread_p, OID * class_oid, BTID * btid, pred_expr
   FPCACHE_ENTRY *fpcache_entry = NULL;
   int error_code = NO_ERROR;
   bool inserted = false;
+  bool saved = false;
+  struct timeval time_now;
 
   if (fpcache_Enabled)
     {
+      /* Take the timestamp before entering the hash; gettimeofday is a system call and does not belong inside the
+       * entry critical section. */
+      gettimeofday (&time_now, NULL);
+
       /* Try to retire in cache entry. */
       ATOMIC_INC_64 (&fpcache_Stat_add, 1);
       inserted = fpcache_Hashmap.find_or_insert (thread_p, *btid, fpcache_entry);
@@ -441,15 +452,6 @@ fpcache_retire (THREAD_ENTRY * thread_p, OID * class_oid, BTID * btid, pred_expr
 	    {
 	      /* Newly inserted. We must set class_oid. */
 	      COPY_OID (&fpcache_entry->class_oid, class_oid);
-
-	      ATOMIC_INC_32 (&fpcache_Entry_counter, 1);
-	      ATOMIC_INC_64 (&fpcache_Stat_add, 1);
-
-	      if (fpcache_Entry_counter >= fpcache_Soft_capacity)
-		{
-		  /* Try cleanup. */
-		  fpcache_cleanup (thread_p);
-		}
 	    }
 	  else
 	    {
@@ -462,6 +464,16 @@ fpcache_retire (THREAD_ENTRY * thread_p, OID * class_oid, BTID * btid, pred_expr
 	      /* Can save filter predicate expression. */
 	      fpcache_entry->clone_stack[++fpcache_entry->clone_stack_head] = filter_pred;
 	      filter_pred = NULL;
+	      saved = true;
+	    }
+	  fpcache_entry->time_last_used = time_now;
+	  pthread_mutex_unlock (&fpcache_entry->mutex);
+
+	  /* Statistics are atomic and the capacity cleanup walks the entire hash; neither may run while the entry
+	   * mutex is held. Before, cleanup could even pick the entry we had just inserted - its last used time was
+	   * still unset - and block on its own mutex trying to erase it. */
+	  if (saved)
+	    {
 	      ATOMIC_INC_64 (&fpcache_Stat_clone_add, 1);
 	      ATOMIC_INC_32 (&fpcache_Clone_counter, 1);
 	    }
@@ -470,8 +482,17 @@ fpcache_retire (THREAD_ENTRY * thread_p, OID * class_oid, BTID * btid, pred_expr
 	      /* No room for another filter predicate expression. */
 	      ATOMIC_INC_64 (&fpcache_Stat_clone_discard, 1);
 	    }
-	  gettimeofday (&fpcache_entry->time_last_used, NULL);
-	  pthread_mutex_unlock (&fpcache_entry->mutex);
+	  if (inserted)
+	    {
+	      ATOMIC_INC_32 (&fpcache_Entry_counter, 1);
+	      ATOMIC_INC_64 (&fpcache_Stat_add, 1);
+
+	      if (fpcache_Entry_counter >= fpcache_Soft_capacity)
+		{
+		  /* Try cleanup. */
+		  fpcache_cleanup (thread_p);
+		}
+	    }
 	}
       else
 	{
@@ -68,6 +68,8 @@ struct heap_cache_attrinfo
   int inst_chn;			/* Current chn of instance object */
   int num_values;		/* Number of desired attribute values */
   HEAP_ATTRVALUE *values;	/* Value for the attributes */
+  void *values_arena;		/* HEAP_ATTRINFO_ARENA the values array was carved from, or NULL when it was
+				 * allocated from the private heap */
 };
 
 #else /* !defined (SERVER_MODE) && !defined (SA_MODE) */
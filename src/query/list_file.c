@@ -37,9 +37,12 @@
 #include "db_value_printer.hpp"
 #include "dbtype.h"
 #include "error_manager.h"
+#include "intl_support.h"
+#include "language_support.h"
 #include "log_append.hpp"
 #include "object_primitive.h"
 #include "object_representation.h"
+#include "porting.h"
 #include "query_manager.h"
 #include "query_opfunc.h"
 #include "stream_to_xasl.h"
@@ -168,6 +171,22 @@ static QFILE_LIST_CACHE_CANDIDATE qfile_List_cache_candidate = { 0, 0, 0, 0, NUL
 /* list cache entry pool */
 static QFILE_LIST_CACHE_ENTRY_POOL qfile_List_cache_entry_pool = { NULL, 0, 0 };
 
+#if defined(SERVER_MODE)
+/*
+ * List cache synchronization.
+ *
+ * Entry-level operations (lookup, update, end-of-use) enter CSECT_QPROC_LIST_CACHE as readers and then serialize on
+ * the mutex of the single hash table they touch, so executions of different plans no longer contend with each other.
+ * Structural operations (initialize, finalize, clear, cleanup, dump) keep entering the critical section exclusively,
+ * which shuts out every entry-level operation without taking any per-table mutex.
+ * The entry pool free list and the hash table free list are shared by all tables and have their own mutexes.
+ * Lock order: critical section -> per-table mutex -> pool/free list mutex.
+ */
+static pthread_mutex_t *qfile_List_cache_ht_mutexes = NULL;
+static pthread_mutex_t qfile_List_cache_entry_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t qfile_List_cache_free_ht_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif /* SERVER_MODE */
+
 /* sort list freelist */
 static LF_FREELIST qfile_sort_list_Freelist;
 
@@ -275,6 +294,8 @@ static void qfile_add_uncommitted_list_cache_entry (int tran_index, QFILE_LIST_C
 static void qfile_delete_uncommitted_list_cache_entry (int tran_index, QFILE_LIST_CACHE_ENTRY * lent);
 static int qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data);
 static int qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, void *data, void *args);
+static int qfile_end_use_of_list_cache_entry_internal (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent,
+						       bool marker);
 static bool qfile_is_early_time (struct timeval *a, struct timeval *b);
 
 static int qfile_get_list_cache_entry_size_for_allocate (int nparam);
@@ -283,6 +304,7 @@ static int *qfile_get_list_cache_entry_tran_index_array (QFILE_LIST_CACHE_ENTRY
 #endif /* SERVER_MODE */
 static DB_VALUE *qfile_get_list_cache_entry_param_values (QFILE_LIST_CACHE_ENTRY * ent);
 static int qfile_compare_with_null_value (int o0, int o1, SUBKEY_INFO key_info);
+static UINT64 qfile_make_sort_key_prefix (SUBKEY_INFO * subkey, const char *dptr);
 static int qfile_compare_with_interpolation_domain (char *fp0, char *fp1, SUBKEY_INFO * subkey,
 						    SORTKEY_INFO * key_info);
 
@@ -400,6 +422,11 @@ int
 qcache_get_new_ht_no (THREAD_ENTRY * thread_p)
 {
   int ht_no = -1;
+#if defined(SERVER_MODE)
+  int rv;
+
+  rv = pthread_mutex_lock (&qfile_List_cache_free_ht_mutex);
+#endif
 
   if (qfile_List_cache.next_ht_no >= 0)
     {
@@ -407,15 +434,32 @@ qcache_get_new_ht_no (THREAD_ENTRY * thread_p)
       qfile_List_cache.next_ht_no = qfile_List_cache.free_ht_list[qfile_List_cache.next_ht_no];
     }
 
+#if defined(SERVER_MODE)
+  pthread_mutex_unlock (&qfile_List_cache_free_ht_mutex);
+#endif
+
   return ht_no;
 }
 
 void
 qcache_free_ht_no (THREAD_ENTRY * thread_p, int ht_no)
 {
+#if defined(SERVER_MODE)
+  int rv;
+#endif
+
+  /* the caller owns the hash table; either it holds the table's mutex or it entered the critical section
+   * exclusively */
   (void) mht_clear (qfile_List_cache.list_hts[ht_no], NULL, NULL);
+
+#if defined(SERVER_MODE)
+  rv = pthread_mutex_lock (&qfile_List_cache_free_ht_mutex);
+#endif
   qfile_List_cache.free_ht_list[ht_no] = qfile_List_cache.next_ht_no;
   qfile_List_cache.next_ht_no = ht_no;
+#if defined(SERVER_MODE)
+  pthread_mutex_unlock (&qfile_List_cache_free_ht_mutex);
+#endif
 }
 
 /* qfile_modify_type_list () -
@@ -1340,7 +1384,16 @@ qfile_reopen_list_as_append_mode (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_
       /* The last page is in the membuf */
       assert_release (temp_file_p->membuf_last >= list_id_p->last_vpid.pageid);
       /* The page of last record in the membuf */
-      last_page_ptr = temp_file_p->membuf[list_id_p->last_vpid.pageid];
+      if (list_id_p->last_vpid.pageid < temp_file_p->membuf_npages)
+	{
+	  last_page_ptr = temp_file_p->membuf[list_id_p->last_vpid.pageid];
+	}
+      else
+	{
+	  /* the page lives in the in-memory extension of the membuf */
+	  last_page_ptr = (temp_file_p->membuf_ext
+			   + (size_t) (list_id_p->last_vpid.pageid - temp_file_p->membuf_npages) * DB_PAGESIZE);
+	}
     }
   else
     {
@@ -2225,10 +2278,10 @@ qfile_destroy_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id_p)
  *   page_sizep(out):
  *
  * Note: This routine is basically called by the C/S communication
- *              routines to fetch and copy the indicated list file page to
- *              the buffer area. The area pointed by the buffer must have
- *              been allocated by the caller and should be big enough to
- *              store a list file page.
+ *              routines to fetch and copy the indicated list file page and
+ *              the pages that follow it to the buffer area. The area pointed
+ *              by the buffer must have been allocated by the caller and
+ *              should be big enough to store QFILE_PAGE_TRANSFER_SIZE bytes.
  */
 int
 xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol_id, PAGEID page_id, char *page_buf_p,
@@ -2292,8 +2345,8 @@ xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol
     }
 
 get_page:
-  /* append pages until a network page is full */
-  while ((*page_size_p + DB_PAGESIZE) <= IO_MAX_PAGE_SIZE)
+  /* append sequential pages until the transfer buffer is full */
+  while ((*page_size_p + DB_PAGESIZE) <= QFILE_PAGE_TRANSFER_SIZE)
     {
       page_p = qmgr_get_old_page (thread_p, &vpid, tfile_vfid_p);
       if (page_p == NULL)
@@ -2350,6 +2403,174 @@ get_page:
   return NO_ERROR;
 }
 
+/*
+ * xqfile_free_list_file_page_fragments () -
+ *   return: nothing
+ *   fragments(in): Array filled by xqfile_get_list_file_page_fragments()
+ *   num_fragments(in): Number of pages held in the array
+ *
+ * Note: Releases the list file pages held for a zero-copy transfer.
+ */
+void
+xqfile_free_list_file_page_fragments (THREAD_ENTRY * thread_p, QFILE_PAGE_FRAGMENT * fragments, int num_fragments)
+{
+  int i;
+
+  for (i = 0; i < num_fragments; i++)
+    {
+      if (fragments[i].page_p != NULL)
+	{
+	  qmgr_free_old_page_and_init (thread_p, fragments[i].page_p, fragments[i].tfile_vfid);
+	}
+    }
+}
+
+/*
+ * xqfile_get_list_file_page_fragments () -
+ *   return: NO_ERROR or ER_ code
+ *   query_id(in):
+ *   volid(in): List file page volume identifier
+ *   pageid(in): List file page identifier
+ *   fragments(out): Array of at least QFILE_PAGE_TRANSFER_NPAGES entries
+ *   num_fragments(out): Number of pages held in the array
+ *   page_sizep(out): Transfer size; same meaning as for
+ *                    xqfile_get_list_file_page()
+ *
+ * Note: Zero-copy variant of xqfile_get_list_file_page(). Instead of
+ *              copying the sequential list file pages into a transfer
+ *              buffer, the pages are kept fixed in the page buffer and
+ *              returned to the caller, which sends their content directly
+ *              (e.g. with a gathered writev()) and then releases them with
+ *              xqfile_free_list_file_page_fragments(). Every fragment but
+ *              the last ships the full page so the client side sees the
+ *              same DB_PAGESIZE-strided layout the copying variant builds.
+ */
+int
+xqfile_get_list_file_page_fragments (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol_id, PAGEID page_id,
+				     QFILE_PAGE_FRAGMENT * fragments, int *num_fragments, int *page_size_p)
+{
+  QMGR_QUERY_ENTRY *query_entry_p = NULL;
+  QFILE_LIST_ID *list_id_p;
+  QMGR_TEMP_FILE *tfile_vfid_p;
+  VPID vpid, next_vpid;
+  PAGE_PTR page_p;
+  int one_page_size = DB_PAGESIZE;
+  int tran_index;
+
+  assert (NULL_PAGEID < page_id);
+  VPID_SET (&vpid, vol_id, page_id);
+
+  *num_fragments = 0;
+  *page_size_p = 0;
+
+  if (query_id == NULL_QUERY_ID)
+    {
+      assert (false);
+      return ER_QPROC_UNKNOWN_QUERYID;
+    }
+  else if (query_id >= SHRT_MAX)
+    {
+      tfile_vfid_p = (QMGR_TEMP_FILE *) query_id;
+      goto get_page;
+    }
+  else
+    {
+      tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+
+      query_entry_p = qmgr_get_query_entry (thread_p, query_id, tran_index);
+      if (query_entry_p == NULL)
+	{
+	  return ER_QPROC_UNKNOWN_QUERYID;
+	}
+
+      assert (query_entry_p->errid == NO_ERROR);
+      assert (query_entry_p->query_status == QUERY_COMPLETED);
+
+      if (query_entry_p->list_id == NULL)
+	{
+	  assert (query_entry_p->list_id != NULL);
+	  return NO_ERROR;
+	}
+
+      assert (NULL_PAGEID < query_entry_p->list_id->first_vpid.pageid);
+
+      /* unexpected no result */
+      if (vol_id == NULL_VOLID && page_id == NULL_PAGEID)
+	{
+	  assert (vol_id != NULL_VOLID || page_id != NULL_PAGEID);
+	  return NO_ERROR;
+	}
+
+      list_id_p = query_entry_p->list_id;
+      tfile_vfid_p = list_id_p->tfile_vfid;
+    }
+
+get_page:
+  /* hold sequential pages until the transfer capacity is reached */
+  while (*num_fragments < QFILE_PAGE_TRANSFER_NPAGES)
+    {
+      page_p = qmgr_get_old_page (thread_p, &vpid, tfile_vfid_p);
+      if (page_p == NULL)
+	{
+	  assert (er_errid () != NO_ERROR);
+	  xqfile_free_list_file_page_fragments (thread_p, fragments, *num_fragments);
+	  *num_fragments = 0;
+	  *page_size_p = 0;
+	  return er_errid ();
+	}
+
+      /* find next page to append */
+      QFILE_GET_OVERFLOW_VPID (&next_vpid, page_p);
+      if (next_vpid.pageid == NULL_PAGEID)
+	{
+	  QFILE_GET_NEXT_VPID (&next_vpid, page_p);
+	}
+
+      assert (next_vpid.pageid != NULL_PAGEID_IN_PROGRESS);
+
+      if (QFILE_GET_TUPLE_COUNT (page_p) == QFILE_OVERFLOW_TUPLE_COUNT_FLAG
+	  || QFILE_GET_OVERFLOW_PAGE_ID (page_p) != NULL_PAGEID)
+	{
+	  one_page_size = DB_PAGESIZE;
+	}
+      else
+	{
+	  one_page_size = (QFILE_GET_LAST_TUPLE_OFFSET (page_p)
+			   + QFILE_GET_TUPLE_LENGTH (page_p + QFILE_GET_LAST_TUPLE_OFFSET (page_p)));
+	  if (one_page_size < QFILE_PAGE_HEADER_SIZE)
+	    {
+	      one_page_size = QFILE_PAGE_HEADER_SIZE;
+	    }
+
+	  if (one_page_size > DB_PAGESIZE)
+	    {
+	      one_page_size = DB_PAGESIZE;
+	    }
+	}
+
+      fragments[*num_fragments].page_p = page_p;
+      fragments[*num_fragments].tfile_vfid = tfile_vfid_p;
+      fragments[*num_fragments].size = DB_PAGESIZE;
+      (*num_fragments)++;
+
+      *page_size_p += DB_PAGESIZE;
+
+      /* next page to append does not exists, stop appending */
+      if (next_vpid.pageid == NULL_PAGEID)
+	{
+	  break;
+	}
+
+      vpid = next_vpid;
+    }
+
+  /* the last page only ships up to its last tuple */
+  fragments[*num_fragments - 1].size = one_page_size;
+  *page_size_p += one_page_size - DB_PAGESIZE;
+
+  return NO_ERROR;
+}
+
 /*
  * qfile_add_item_to_list () -
  *   return: int (NO_ERROR or ER_FAILED)
@@ -3660,6 +3881,350 @@ qfile_compare_all_sort_record (const void *pk0, const void *pk1, void *arg)
   return order;
 }
 
+/*
+ * qfile_make_sort_key_prefix () - Normalized binary prefix of one sort key value
+ *   return: order-preserving 64 bit image of the value
+ *   subkey(in): Sub-key info of the leading sort column
+ *   dptr(in): disk representation of the value, or NULL when it is unbound
+ *
+ * Note: Produces the prefix stored in front of every in-memory sort record
+ *       (see SORT_RECORD_PREFIX). The encoding must satisfy the prefix
+ *       contract: an unsigned compare of two prefixes may never contradict
+ *       the comparator. The top byte separates NULLs from bound values
+ *       according to is_nulls_first; the remaining 56 bits hold the value in
+ *       a big-endian offset form, bit-inverted for descending order. Values
+ *       wider than 56 bits lose their least significant byte, which only
+ *       makes ties (and thus comparator fall-backs) more frequent. String
+ *       prefixes hold the first seven weight bytes of the value, so the bulk
+ *       of a collation ordered sort is decided by integer compares.
+ */
+static UINT64
+qfile_make_sort_key_prefix (SUBKEY_INFO * subkey, const char *dptr)
+{
+  UINT64 value56;
+
+  if (dptr == NULL)
+    {
+      /* NULLs group at one end; their relative order never reaches the comparator's value path */
+      return subkey->is_nulls_first ? 0 : ~((UINT64) 0);
+    }
+
+  switch (TP_DOMAIN_TYPE (subkey->col_dom))
+    {
+    case DB_TYPE_SHORT:
+      value56 = ((UINT64) (UINT16) (OR_GET_SHORT (dptr) ^ 0x8000)) << 40;
+      break;
+
+    case DB_TYPE_INTEGER:
+      value56 = ((UINT64) (UINT32) (OR_GET_INT (dptr) ^ 0x80000000)) << 24;
+      break;
+
+    case DB_TYPE_BIGINT:
+      {
+	DB_BIGINT bigint;
+
+	OR_GET_BIGINT (dptr, &bigint);
+	value56 = (((UINT64) bigint) ^ 0x8000000000000000ULL) >> 8;
+      }
+      break;
+
+    case DB_TYPE_FLOAT:
+      {
+	float f;
+	UINT32 bits;
+
+	OR_GET_FLOAT (dptr, &f);
+	if (f == 0.0f)
+	  {
+	    /* collapse -0.0, which the comparator treats as equal to +0.0 */
+	    f = 0.0f;
+	  }
+	memcpy (&bits, &f, sizeof (bits));
+	bits = (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+	value56 = ((UINT64) bits) << 24;
+      }
+      break;
+
+    case DB_TYPE_DOUBLE:
+      {
+	double d;
+	UINT64 bits;
+
+	OR_GET_DOUBLE (dptr, &d);
+	if (d == 0.0)
+	  {
+	    d = 0.0;
+	  }
+	memcpy (&bits, &d, sizeof (bits));
+	bits = (bits & 0x8000000000000000ULL) ? ~bits : (bits | 0x8000000000000000ULL);
+	value56 = bits >> 8;
+      }
+      break;
+
+    case DB_TYPE_DATE:
+      {
+	DB_DATE date;
+
+	OR_GET_DATE (dptr, &date);
+	value56 = ((UINT64) date) << 24;
+      }
+      break;
+
+    case DB_TYPE_TIME:
+      {
+	DB_TIME time;
+
+	OR_GET_TIME (dptr, &time);
+	value56 = ((UINT64) time) << 24;
+      }
+      break;
+
+    case DB_TYPE_TIMESTAMP:
+      {
+	DB_UTIME utime;
+
+	OR_GET_UTIME (dptr, &utime);
+	value56 = ((UINT64) utime) << 24;
+      }
+      break;
+
+    case DB_TYPE_DATETIME:
+      {
+	DB_DATETIME datetime;
+
+	OR_GET_DATETIME (dptr, &datetime);
+	value56 = ((((UINT64) datetime.date) << 32) | (UINT64) datetime.time) >> 8;
+      }
+      break;
+
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+      {
+	const unsigned char *str;
+	int length, i;
+	unsigned char byte;
+
+	if (TP_DOMAIN_TYPE (subkey->col_dom) == DB_TYPE_VARCHAR)
+	  {
+	    /* short disk form: one length byte followed by the characters; the precision bound checked by
+	     * qfile_get_sort_prefix_function keeps values out of the long, possibly compressed form */
+	    length = OR_GET_BYTE (dptr);
+	    assert (length < OR_MINIMUM_STRING_LENGTH_FOR_COMPRESSION);
+	    str = (const unsigned char *) dptr + OR_BYTE_SIZE;
+	  }
+	else
+	  {
+	    /* fixed width form: the characters, padded with spaces up to the domain precision */
+	    length = subkey->col_dom->precision * INTL_CODESET_MULT (TP_DOMAIN_CODESET (subkey->col_dom));
+	    str = (const unsigned char *) dptr;
+	  }
+
+	value56 = 0;
+	for (i = 0; i < 7 && i < length; i++)
+	  {
+	    byte = str[i];
+	    if (byte == 0x20 && subkey->col_dom->collation_id != LANG_COLL_BINARY)
+	      {
+		/* the byte order collations weigh the space like NUL, so that trailing padding and the missing
+		 * bytes of a shorter string compare equal */
+		byte = 0x00;
+	      }
+	    value56 |= ((UINT64) byte) << (8 * (6 - i));
+	  }
+      }
+      break;
+
+    default:
+      /* qfile_get_sort_prefix_function only admits the types above */
+      assert (false);
+      value56 = 0;
+      break;
+    }
+
+  if (subkey->is_desc)
+    {
+      value56 ^= 0x00FFFFFFFFFFFFFFULL;
+    }
+
+  /* bound values carry 0x01 in the top byte: above NULLs-first (0x00), below NULLs-last (0xFF) */
+  return (((UINT64) 1) << 56) | value56;
+}
+
+/*
+ * qfile_prefix_partial_sort_record () - Normalized prefix of a partial sort record
+ *   return: prefix of the leading sort column
+ *   pk(in): Pointer to pointer to sort record
+ *   arg(in): Pointer to sort info
+ *
+ * Note: Companion of qfile_compare_partial_sort_record; reads the first
+ *       sort_key field the same way the comparator does.
+ */
+UINT64
+qfile_prefix_partial_sort_record (const void *pk, void *arg)
+{
+  SORTKEY_INFO *key_info_p;
+  SORT_REC *k;
+  char *fp;
+
+  key_info_p = (SORTKEY_INFO *) arg;
+  k = *(SORT_REC **) pk;
+
+  fp = &(k->s.original.body[0]);
+  fp = PTR_ALIGN (fp, MAX_ALIGNMENT);
+
+  if (QFILE_GET_TUPLE_VALUE_FLAG (fp) == V_BOUND)
+    {
+      return qfile_make_sort_key_prefix (&key_info_p->key[0], fp + QFILE_TUPLE_VALUE_HEADER_LENGTH);
+    }
+  else
+    {
+      return qfile_make_sort_key_prefix (&key_info_p->key[0], NULL);
+    }
+}
+
+/*
+ * qfile_prefix_all_sort_record () - Normalized prefix of a full sort record
+ *   return: prefix of the leading sort column
+ *   pk(in): Pointer to pointer to sort record
+ *   arg(in): Pointer to sort info
+ *
+ * Note: Companion of qfile_compare_all_sort_record.
+ */
+UINT64
+qfile_prefix_all_sort_record (const void *pk, void *arg)
+{
+  SORTKEY_INFO *key_info_p;
+  SORT_REC *k;
+  int o0;
+
+  key_info_p = (SORTKEY_INFO *) arg;
+  k = *(SORT_REC **) pk;
+
+  o0 = k->s.offset[0];
+  if (o0)
+    {
+      return qfile_make_sort_key_prefix (&key_info_p->key[0], (char *) k + o0);
+    }
+  else
+    {
+      return qfile_make_sort_key_prefix (&key_info_p->key[0], NULL);
+    }
+}
+
+/*
+ * qfile_get_sort_prefix_function () - Prefix producer matching a sort comparator
+ *   return: prefix function to pass to sort_listfile, or NULL
+ *   key_info(in): sort key description (the cmp_arg of the sort)
+ *   cmp_fn(in): the comparator selected for the sort
+ *
+ * Note: Normalized prefixes are only available for leading key types with an
+ *       order-preserving binary image: the fixed width numeric and date types
+ *       and, when the collation sorts by the byte image, bounded precision
+ *       strings. A NULL result makes the sort fall back to plain comparator
+ *       calls.
+ */
+SORT_PREFIX_FUNC *
+qfile_get_sort_prefix_function (SORTKEY_INFO * key_info, SORT_CMP_FUNC * cmp_fn)
+{
+  SUBKEY_INFO *subkey;
+
+  if (cmp_fn != qfile_compare_partial_sort_record && cmp_fn != qfile_compare_all_sort_record)
+    {
+      return NULL;
+    }
+
+  if (key_info->nkeys <= 0)
+    {
+      return NULL;
+    }
+
+  subkey = &key_info->key[0];
+  if (subkey->use_cmp_dom)
+    {
+      /* interpolation sorts compare through cmp_dom; no binary image matches that order */
+      return NULL;
+    }
+
+  switch (TP_DOMAIN_TYPE (subkey->col_dom))
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+      break;
+
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+      /* a binary prefix preserves the order only when the collation weights follow the byte image */
+      if (subkey->col_dom->collation_id != LANG_COLL_ISO_BINARY
+	  && subkey->col_dom->collation_id != LANG_COLL_UTF8_BINARY
+	  && subkey->col_dom->collation_id != LANG_COLL_BINARY)
+	{
+	  return NULL;
+	}
+      /* the precision bound keeps every varchar value in the short disk form; longer values may be stored
+       * compressed, and their leading bytes cannot be read without undoing the compression */
+      if (subkey->col_dom->precision <= 0
+	  || (TP_DOMAIN_TYPE (subkey->col_dom) == DB_TYPE_VARCHAR
+	      && (subkey->col_dom->precision * INTL_CODESET_MULT (TP_DOMAIN_CODESET (subkey->col_dom))
+		  >= OR_MINIMUM_STRING_LENGTH_FOR_COMPRESSION)))
+	{
+	  return NULL;
+	}
+      break;
+
+    default:
+      return NULL;
+    }
+
+  if (cmp_fn == qfile_compare_partial_sort_record)
+    {
+      return qfile_prefix_partial_sort_record;
+    }
+  else
+    {
+      return qfile_prefix_all_sort_record;
+    }
+}
+
+/*
+ * qfile_sort_prefix_is_total_order () - Does the prefix decide every comparison?
+ *   return: true iff equal prefixes imply equal sort keys
+ *   key_info(in): sort key description (the cmp_arg of the sort)
+ *
+ * Note: True only for a single sort key whose whole value fits in the 56
+ *       payload bits of the prefix. BIGINT, DOUBLE and DATETIME prefixes
+ *       drop the low byte of the value, so distinct keys can share a
+ *       prefix and the comparator must break the tie.
+ */
+bool
+qfile_sort_prefix_is_total_order (SORTKEY_INFO * key_info)
+{
+  if (key_info->nkeys != 1 || key_info->key[0].use_cmp_dom)
+    {
+      return false;
+    }
+
+  switch (TP_DOMAIN_TYPE (key_info->key[0].col_dom))
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
 /*
  * qfile_compare_with_null_value () -
  *   return: -1, 0, or 1, strcmp-style
@@ -4010,7 +4575,9 @@ qfile_sort_list_with_func (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id_p, S
 
   sort_result =
     sort_listfile (thread_p, NULL_VOLID, estimated_pages, get_func, &info, put_func, &info, cmp_func, &info.key_info,
-		   dup_option, limit, srlist_id->tfile_vfid->tde_encrypted);
+		   qfile_get_sort_prefix_function (&info.key_info, cmp_func),
+		   qfile_sort_prefix_is_total_order (&info.key_info), dup_option, limit,
+		   srlist_id->tfile_vfid->tde_encrypted);
 
   if (sort_result < 0)
     {
@@ -4861,10 +5428,12 @@ qfile_hash_db_value_array (const void *key, unsigned int htsize)
     {
       for (i = 0, val = array->vals; i < array->size; i++, val++)
 	{
-	  hash |= mht_valhash (val, htsize);
-	  hash <<= 8;
+	  /* multiplicative mixing keeps every value's contribution alive; OR-ing value hashes and shifting, as was
+	   * done before, saturated the hash towards all-ones and dropped all but the last few values, which piled
+	   * the parameter sets of a cached plan into a handful of chains */
+	  hash = (hash << 5) - hash + mht_valhash (val, htsize);
 	}
-      hash |= array->size;
+      hash += (unsigned int) array->size;
     }
 
   return (hash % htsize);
@@ -4966,6 +5535,18 @@ qfile_initialize_list_cache (THREAD_ENTRY * thread_p)
 	  goto error;
 	}
 
+#if defined(SERVER_MODE)
+      qfile_List_cache_ht_mutexes = (pthread_mutex_t *) calloc (qfile_List_cache.n_hts, sizeof (pthread_mutex_t));
+      if (qfile_List_cache_ht_mutexes == NULL)
+	{
+	  goto error;
+	}
+      for (i = 0; i < qfile_List_cache.n_hts; i++)
+	{
+	  pthread_mutex_init (&qfile_List_cache_ht_mutexes[i], NULL);
+	}
+#endif /* SERVER_MODE */
+
       for (i = 0; i < qfile_List_cache.n_hts; i++)
 	{
 	  qfile_List_cache.list_hts[i] =
@@ -5035,6 +5616,12 @@ error:
       free_and_init (qfile_List_cache.list_hts);
       free_and_init (qfile_List_cache.free_ht_list);
     }
+#if defined(SERVER_MODE)
+  if (qfile_List_cache_ht_mutexes)
+    {
+      free_and_init (qfile_List_cache_ht_mutexes);
+    }
+#endif /* SERVER_MODE */
   qfile_List_cache.n_hts = 0;
 
   csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
@@ -5079,6 +5666,17 @@ qfile_finalize_list_cache (THREAD_ENTRY * thread_p)
       free_and_init (qfile_List_cache.free_ht_list);
     }
 
+#if defined(SERVER_MODE)
+  if (qfile_List_cache_ht_mutexes)
+    {
+      for (i = 0; i < qfile_List_cache.n_hts; i++)
+	{
+	  pthread_mutex_destroy (&qfile_List_cache_ht_mutexes[i]);
+	}
+      free_and_init (qfile_List_cache_ht_mutexes);
+    }
+#endif /* SERVER_MODE */
+
   /* list cache entry pool */
   if (qfile_List_cache_entry_pool.pool)
     {
@@ -5168,8 +5766,12 @@ end:
 static QFILE_LIST_CACHE_ENTRY *
 qfile_allocate_list_cache_entry (int req_size)
 {
-  /* this function should be called within CSECT_QPROC_LIST_CACHE */
   QFILE_POOLED_LIST_CACHE_ENTRY *pent = NULL;
+#if defined(SERVER_MODE)
+  int rv;
+
+  rv = pthread_mutex_lock (&qfile_List_cache_entry_pool_mutex);
+#endif
 
   if (req_size > RESERVED_SIZE_FOR_LIST_CACHE_ENTRY || qfile_List_cache_entry_pool.free_list == -1)
     {
@@ -5197,6 +5799,10 @@ qfile_allocate_list_cache_entry (int req_size)
       pent->s.next = -1;
     }
 
+#if defined(SERVER_MODE)
+  pthread_mutex_unlock (&qfile_List_cache_entry_pool_mutex);
+#endif
+
   /* initialize */
   if (pent)
     {
@@ -5222,11 +5828,13 @@ qfile_allocate_list_cache_entry (int req_size)
 static int
 qfile_free_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
 {
-  /* this function should be called within CSECT_QPROC_LIST_CACHE */
   QFILE_POOLED_LIST_CACHE_ENTRY *pent;
   QFILE_LIST_CACHE_ENTRY *lent = (QFILE_LIST_CACHE_ENTRY *) data;
   HL_HEAPID old_pri_heap_id;
   int i;
+#if defined(SERVER_MODE)
+  int rv;
+#endif
 #if !defined (NDEBUG)
   int idx;
 #endif
@@ -5257,6 +5865,10 @@ qfile_free_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
     {
       /* return it back to the pool */
       (void) memset (&pent->s.entry, 0, sizeof (QFILE_LIST_CACHE_ENTRY));
+
+#if defined(SERVER_MODE)
+      rv = pthread_mutex_lock (&qfile_List_cache_entry_pool_mutex);
+#endif
       pent->s.next = qfile_List_cache_entry_pool.free_list;
 
 #if !defined (NDEBUG)
@@ -5265,6 +5877,9 @@ qfile_free_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
 #endif
 
       qfile_List_cache_entry_pool.free_list = CAST_BUFLEN (pent - qfile_List_cache_entry_pool.pool);
+#if defined(SERVER_MODE)
+      pthread_mutex_unlock (&qfile_List_cache_entry_pool_mutex);
+#endif
     }
 
   return NO_ERROR;
@@ -5459,7 +6074,8 @@ qfile_dump_list_cache (THREAD_ENTRY * thread_p, const char *fname)
 static int
 qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data)
 {
-  /* this function should be called within CSECT_QPROC_LIST_CACHE */
+  /* the caller owns the entry's hash table; either it holds the table's mutex under the reader critical section or
+   * it entered CSECT_QPROC_LIST_CACHE exclusively */
   QFILE_LIST_CACHE_ENTRY *lent = (QFILE_LIST_CACHE_ENTRY *) data;
   int error_code = ER_FAILED;
   bool invalidate;
@@ -5474,8 +6090,8 @@ qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data)
   ht_no = lent->list_ht_no;
 
   /* update counter */
-  qfile_List_cache.n_entries--;
-  qfile_List_cache.n_pages -= lent->list_id.page_cnt;
+  ATOMIC_INC_32 (&qfile_List_cache.n_entries, -1);
+  ATOMIC_INC_32 (&qfile_List_cache.n_pages, -lent->list_id.page_cnt);
 
   /* remove the entry from the hash table */
   if (mht_rem2 (qfile_List_cache.list_hts[lent->list_ht_no], &lent->param_values, lent, NULL, NULL) != NO_ERROR)
@@ -5547,7 +6163,9 @@ qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, void *data, vo
       lent->invalidate = *((bool *) args);
     }
 
-  return qfile_end_use_of_list_cache_entry (thread_p, lent, true);
+  /* the callers (clear, finalize) iterate the hash tables with CSECT_QPROC_LIST_CACHE entered exclusively, so go
+   * straight to the guts without re-entering */
+  return qfile_end_use_of_list_cache_entry_internal (thread_p, lent, true);
 }
 
 /*
@@ -5566,8 +6184,10 @@ qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xasl,
 {
   QFILE_LIST_CACHE_ENTRY *lent;
   int tran_index;
+  int ht_no;
 #if defined(SERVER_MODE)
   TRAN_ISOLATION tran_isolation;
+  int rv;
 #if defined(WINDOWS)
   unsigned int num_elements;
 #else
@@ -5592,24 +6212,48 @@ qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xasl,
       return NULL;
     }
 
-  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+  if (csect_enter_as_reader (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
     {
       return NULL;
     }
 
   if (xasl->list_ht_no < 0)
     {
-      if ((xasl->list_ht_no = qcache_get_new_ht_no (thread_p)) < 0)
+      ht_no = qcache_get_new_ht_no (thread_p);
+      if (ht_no < 0)
 	{
-	  goto end;
+	  ATOMIC_INC_32 (&qfile_List_cache.miss_counter, 1);	/* counter */
+	  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+	  return NULL;
 	}
+
+      /* another thread executing the same plan for the first time may race on the assignment; the loser returns its
+       * hash table to the free list */
+      if (!ATOMIC_CAS_32 (&xasl->list_ht_no, -1, ht_no))
+	{
+	  qcache_free_ht_no (thread_p, ht_no);
+	}
+    }
+
+  /* a concurrent end-of-use may delete the last invalidated entry and give the hash table back; keep using the table
+   * we read here even if the entry resets xasl->list_ht_no while we work on it */
+  ht_no = xasl->list_ht_no;
+  if (ht_no < 0)
+    {
+      ATOMIC_INC_32 (&qfile_List_cache.miss_counter, 1);	/* counter */
+      csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+      return NULL;
     }
 
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
+#if defined(SERVER_MODE)
+  rv = pthread_mutex_lock (&qfile_List_cache_ht_mutexes[ht_no]);
+#endif
+
   /* look up the hash table with the key */
-  lent = (QFILE_LIST_CACHE_ENTRY *) mht_get (qfile_List_cache.list_hts[xasl->list_ht_no], params);
-  qfile_List_cache.lookup_counter++;	/* counter */
+  lent = (QFILE_LIST_CACHE_ENTRY *) mht_get (qfile_List_cache.list_hts[ht_no], params);
+  ATOMIC_INC_32 (&qfile_List_cache.lookup_counter, 1);	/* counter */
 
   if (lent)
     {
@@ -5672,13 +6316,16 @@ end:
 
   if (*result_cached)
     {
-      qfile_List_cache.hit_counter++;	/* counter */
+      ATOMIC_INC_32 (&qfile_List_cache.hit_counter, 1);	/* counter */
     }
   else
     {
-      qfile_List_cache.miss_counter++;	/* counter */
+      ATOMIC_INC_32 (&qfile_List_cache.miss_counter, 1);	/* counter */
     }
 
+#if defined(SERVER_MODE)
+  pthread_mutex_unlock (&qfile_List_cache_ht_mutexes[ht_no]);
+#endif
   csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
 
   if (*result_cached)
@@ -5725,6 +6372,8 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
   int tran_index;
 #if defined(SERVER_MODE)
   TRAN_ISOLATION tran_isolation;
+  bool tried_cleanup = false;
+  int rv;
 #if defined(WINDOWS)
   unsigned int num_elements;
 #else
@@ -5748,7 +6397,7 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
       return NULL;
     }
 
-  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+  if (csect_enter_as_reader (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
     {
       return NULL;
     }
@@ -5758,6 +6407,14 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
   tran_isolation = logtb_find_isolation (tran_index);
 #endif /* SERVER_MODE */
 
+  ht = qfile_List_cache.list_hts[list_ht_no];
+
+#if defined(SERVER_MODE)
+  rv = pthread_mutex_lock (&qfile_List_cache_ht_mutexes[list_ht_no]);
+
+re_check:
+#endif
+
   /*
    * The other competing thread which is running the same query
    * already updated this entry after that this and the thread had failed
@@ -5768,7 +6425,6 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
    * If fail to delete, leave the cache without touch.
    */
 
-  ht = qfile_List_cache.list_hts[list_ht_no];
   do
     {
       /* check again whether the entry is in the cache */
@@ -5782,6 +6438,7 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
       /* check in-use by other transaction */
       if (lent->last_ta_idx > 0)
 	{
+	  pthread_mutex_unlock (&qfile_List_cache_ht_mutexes[list_ht_no]);
 	  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
 	  return lent;
 	}
@@ -5822,13 +6479,44 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
 
 #if defined(SERVER_MODE)
   /* check the number of list cache entries */
-  if (qfile_List_cache.n_entries >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
-      || qfile_List_cache.n_pages >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES))
+  if (!tried_cleanup
+      && (qfile_List_cache.n_entries >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
+	  || qfile_List_cache.n_pages >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES)))
     {
-      if (qfile_list_cache_cleanup (thread_p) != NO_ERROR)
+      /* the cleanup scans every hash table, so it needs the critical section exclusively; trade the reader latch for
+       * the exclusive one and re-check the entry afterwards, since a competing thread may have cached the result in
+       * the meantime */
+      tried_cleanup = true;
+      pthread_mutex_unlock (&qfile_List_cache_ht_mutexes[list_ht_no]);
+      csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+
+      if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
 	{
-	  goto end;
+	  return NULL;
+	}
+      if (qfile_List_cache.n_entries >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
+	  || qfile_List_cache.n_pages >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES))
+	{
+	  if (qfile_list_cache_cleanup (thread_p) != NO_ERROR)
+	    {
+	      csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+	      return NULL;
+	    }
+	}
+      csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+
+      if (csect_enter_as_reader (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+	{
+	  return NULL;
+	}
+      if (xasl->list_ht_no != list_ht_no)
+	{
+	  /* the cleanup emptied the hash table and gave it back to the free list */
+	  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+	  return NULL;
 	}
+      rv = pthread_mutex_lock (&qfile_List_cache_ht_mutexes[list_ht_no]);
+      goto re_check;
     }
 #endif
 
@@ -5924,10 +6612,13 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
     }
 
   /* update counter */
-  qfile_List_cache.n_entries++;
-  qfile_List_cache.n_pages += lent->list_id.page_cnt;
+  ATOMIC_INC_32 (&qfile_List_cache.n_entries, 1);
+  ATOMIC_INC_32 (&qfile_List_cache.n_pages, lent->list_id.page_cnt);
 
 end:
+#if defined(SERVER_MODE)
+  pthread_mutex_unlock (&qfile_List_cache_ht_mutexes[list_ht_no]);
+#endif
   csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
 
   return lent;
@@ -5942,18 +6633,10 @@ end:
 int
 qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent, bool marker)
 {
-  int tran_index;
-  bool invalidate = false;
+  int error_code;
 #if defined(SERVER_MODE)
-  int *p, *r;
-#if defined(WINDOWS)
-  unsigned int num_elements;
-#else
-  size_t num_elements;
-#endif
-#endif /* SERVER_MODE */
-#if defined (SERVER_MODE) && !defined (NDEBUG)
-  size_t i_idx, num_active_users;
+  int ht_no;
+  int rv;
 #endif
 
   if (QFILE_IS_LIST_CACHE_DISABLED)
@@ -5965,11 +6648,52 @@ qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENT
       return ER_FAILED;
     }
 
-  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+  if (csect_enter_as_reader (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
     {
       return ER_FAILED;
     }
 
+#if defined(SERVER_MODE)
+  /* the entry may be deleted while we work on it; keep using the table we latched */
+  ht_no = lent->list_ht_no;
+  rv = pthread_mutex_lock (&qfile_List_cache_ht_mutexes[ht_no]);
+#endif
+
+  error_code = qfile_end_use_of_list_cache_entry_internal (thread_p, lent, marker);
+
+#if defined(SERVER_MODE)
+  pthread_mutex_unlock (&qfile_List_cache_ht_mutexes[ht_no]);
+#endif
+  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+
+  return error_code;
+}
+
+/*
+ * qfile_end_use_of_list_cache_entry_internal () - The guts of ending the use of a list cache entry; the caller owns
+ *   the entry's hash table, either by holding the table's mutex under the reader critical section or by entering
+ *   CSECT_QPROC_LIST_CACHE exclusively
+ *   return:
+ *   lent(in/out)   :
+ *   marker(in) :
+ */
+static int
+qfile_end_use_of_list_cache_entry_internal (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent, bool marker)
+{
+  int tran_index;
+  bool invalidate = false;
+#if defined(SERVER_MODE)
+  int *p, *r;
+#if defined(WINDOWS)
+  unsigned int num_elements;
+#else
+  size_t num_elements;
+#endif
+#endif /* SERVER_MODE */
+#if defined (SERVER_MODE) && !defined (NDEBUG)
+  size_t i_idx, num_active_users;
+#endif
+
 #if defined(SERVER_MODE)
   /* remove my transaction id from the entry and do compaction */
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
@@ -6036,8 +6760,6 @@ qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENT
     }
 #endif
 
-  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
-
   return NO_ERROR;
 }
 
@@ -572,19 +572,10 @@ numeric_double_shift_bit (DB_C_NUMERIC arg1, DB_C_NUMERIC arg2, int numbits, DB_
 static int
 numeric_compare_pos (DB_C_NUMERIC arg1, DB_C_NUMERIC arg2)
 {
-  unsigned int digit;
-
-  /* Loop through bytes looking for the largest */
-  for (digit = 0; digit < DB_NUMERIC_BUF_SIZE; digit++)
-    {
-      if (arg1[digit] != arg2[digit])
-	{
-	  return (arg1[digit] > arg2[digit]) ? 1 : (-1);
-	}
-    }
+  /* big-endian unsigned byte strings compare in numeric order */
+  int cmp = memcmp (arg1, arg2, DB_NUMERIC_BUF_SIZE);
 
-  /* If all bytes have been compared, then args are equal */
-  return (0);
+  return (cmp > 0) ? 1 : ((cmp < 0) ? (-1) : 0);
 }
 
 /*
@@ -820,10 +811,29 @@ static void
 numeric_add (DB_C_NUMERIC arg1, DB_C_NUMERIC arg2, DB_C_NUMERIC answer, int size)
 {
   unsigned int answer_bit = 0;
+  UINT64 limb1, limb2, limb_sum, limb_ans, carry = 0;
   int digit;
 
-  /* Loop through the characters setting answer */
-  for (digit = size - 1; digit >= 0; digit--)
+  /* the buffers are big-endian byte strings, so they add as 64 bit limbs from the least significant end;
+   * one limb addition replaces eight byte carry propagations */
+  for (digit = size - (int) sizeof (UINT64); digit >= 0; digit -= (int) sizeof (UINT64))
+    {
+      memcpy (&limb1, arg1 + digit, sizeof (limb1));
+      memcpy (&limb2, arg2 + digit, sizeof (limb2));
+      limb1 = ntohi64 (limb1);
+      limb2 = ntohi64 (limb2);
+
+      limb_sum = limb1 + limb2;
+      limb_ans = limb_sum + carry;
+      carry = (limb_sum < limb1 || limb_ans < limb_sum) ? 1 : 0;
+
+      limb_ans = htoni64 (limb_ans);
+      memcpy (answer + digit, &limb_ans, sizeof (limb_ans));
+    }
+
+  /* a size that is not a limb multiple finishes with the byte loop */
+  answer_bit = (unsigned int) carry << 8;
+  for (digit += (int) sizeof (UINT64) - 1; digit >= 0; digit--)
     {
       answer_bit = (arg1[digit] + arg2[digit]) + CARRYOVER (answer_bit);
       answer[digit] = GET_LOWER_BYTE (answer_bit);
@@ -868,7 +878,8 @@ numeric_sub (DB_C_NUMERIC arg1, DB_C_NUMERIC arg2, DB_C_NUMERIC answer, int size
 static void
 numeric_mul (DB_C_NUMERIC a1, DB_C_NUMERIC a2, bool * positive_ans, DB_C_NUMERIC answer)
 {
-  unsigned int answer_bit;
+  UINT64 product, carry;
+  UINT32 limb;
   int digit1;
   int digit2;
   int shift;
@@ -914,18 +925,19 @@ numeric_mul (DB_C_NUMERIC a1, DB_C_NUMERIC a2, bool * positive_ans, DB_C_NUMERIC
     {
       if (temp_arg2[digit2] != 0)
 	{
-	  answer_bit = 0;
 	  numeric_shift_byte (arg1, shift, temp_arg1, 2 * DB_NUMERIC_BUF_SIZE);
 
-	  /* Loop through the 8-bit digits of temp_arg1 */
-	  for (digit1 = (2 * DB_NUMERIC_BUF_SIZE - 1); digit1 >= 0; digit1--)
+	  /* multiply temp_arg1 by the single byte temp_arg2[digit2] in 32 bit limbs; the 40 bit partial
+	   * product plus the carry always fits the 64 bit accumulator */
+	  carry = 0;
+	  for (digit1 = 2 * DB_NUMERIC_BUF_SIZE - (int) sizeof (UINT32); digit1 >= 0;
+	       digit1 -= (int) sizeof (UINT32))
 	    {
-	      /* the unsigned int casts are necessary here to avoid 16 bit integer overflow during the multiplication
-	       * on PC's */
-	      answer_bit =
-		((unsigned int) temp_arg1[digit1] * (unsigned int) temp_arg2[digit2]) +
-		(unsigned int) CARRYOVER (answer_bit);
-	      temp_term[digit1] = GET_LOWER_BYTE (answer_bit);
+	      memcpy (&limb, temp_arg1 + digit1, sizeof (limb));
+	      product = (UINT64) ntohl (limb) * (UINT64) temp_arg2[digit2] + carry;
+	      carry = product >> 32;
+	      limb = htonl ((UINT32) product);
+	      memcpy (temp_term + digit1, &limb, sizeof (limb));
 	    }
 	  numeric_add (temp_term, answer, answer, 2 * DB_NUMERIC_BUF_SIZE);
 	}
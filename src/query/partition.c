@@ -1234,6 +1234,7 @@ partition_prune_hash (PRUNING_CONTEXT * pinfo, const DB_VALUE * val_p, const PRU
 	       * when no appropriate partition was found. */
 	      er_clear ();
 	      status = MATCH_OK;
+	      break;
 	    }
 	}
       else
@@ -1283,8 +1284,9 @@ partition_prune_hash (PRUNING_CONTEXT * pinfo, const DB_VALUE * val_p, const PRU
 
 	    if (TP_DOMAIN_TYPE (col_domain) != DB_VALUE_TYPE (&col))
 	      {
-		/* A failed coercion is not an error in this case, we should just skip over it */
-		if (tp_value_cast (val_p, &val, col_domain, false) == DOMAIN_INCOMPATIBLE)
+		/* A failed coercion is not an error in this case, we should just skip over it. A successful one must
+		 * be hashed instead of the original element or we end up in the wrong partition. */
+		if (tp_value_cast (&col, &col, col_domain, false) == DOMAIN_INCOMPATIBLE)
 		  {
 		    pr_clear_value (&col);
 		    er_clear ();
@@ -54,6 +54,7 @@ static int qdata_aggregate_multiple_values_to_accumulator (cubthread::entry *thr
     cubxasl::aggregate_accumulator_domain *domain,
     FUNC_TYPE func_type, tp_domain *func_domain,
     std::vector<DB_VALUE> &db_values);
+static bool qdata_agg_accumulate_preserves_operand (FUNC_TYPE func_type);
 static int qdata_process_distinct_or_sort (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_p,
     QUERY_ID query_id);
 static int qdata_calculate_aggregate_cume_dist_percent_rank (cubthread::entry *thread_p,
@@ -578,6 +579,38 @@ qdata_aggregate_multiple_values_to_accumulator (cubthread::entry *thread_p, cubx
   return NO_ERROR;
 }
 
+/*
+ * qdata_agg_accumulate_preserves_operand () - true when accumulating a value
+ *					       never modifies the value itself
+ *   return: bool
+ *   func_type(in): function type
+ *
+ * Note: For these functions the per-tuple operand can be streamed into the
+ *	 accumulator by peeking instead of copying it. The standard
+ *	 deviation and variance functions coerce the operand in place, and
+ *	 group concat, the JSON aggregates and the interpolation functions
+ *	 have special handling, so they all keep the copying path.
+ */
+static bool
+qdata_agg_accumulate_preserves_operand (FUNC_TYPE func_type)
+{
+  switch (func_type)
+    {
+    case PT_MIN:
+    case PT_MAX:
+    case PT_COUNT:
+    case PT_SUM:
+    case PT_AVG:
+    case PT_AGG_BIT_AND:
+    case PT_AGG_BIT_OR:
+    case PT_AGG_BIT_XOR:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
 /*
  * qdata_evaluate_aggregate_list () -
  *   return: NO_ERROR, or ER_code
@@ -647,6 +680,35 @@ qdata_evaluate_aggregate_list (cubthread::entry *thread_p, cubxasl::aggregate_li
 	  continue;
 	}
 
+      /* single-operand functions whose accumulation only reads the operand stream the value by peeking it; the
+       * per-tuple copy (and its allocations for strings and sets) otherwise dominates the aggregate loop */
+      if (agg_p->option != Q_DISTINCT && agg_p->sort_list == NULL && agg_p->operands != NULL
+	  && agg_p->operands->next == NULL && qdata_agg_accumulate_preserves_operand (agg_p->function))
+	{
+	  DB_VALUE *peek_value = NULL;
+
+	  if (fetch_peek_dbval (thread_p, &agg_p->operands->value, val_desc_p, NULL, NULL, NULL, &peek_value) !=
+	      NO_ERROR)
+	    {
+	      return ER_FAILED;
+	    }
+
+	  if (DB_IS_NULL (peek_value))
+	    {
+	      continue;
+	    }
+
+	  error = qdata_aggregate_value_to_accumulator (thread_p, accumulator, &agg_p->accumulator_domain,
+							agg_p->function, agg_p->domain, peek_value, false);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+
+	  accumulator->curr_cnt++;
+	  continue;
+	}
+
       /* fetch operands value. aggregate regulator variable should only contain constants */
       REGU_VARIABLE_LIST operand = NULL;
       for (operand = agg_p->operands; operand != NULL; operand = operand->next)
@@ -987,8 +1049,18 @@ qdata_evaluate_aggregate_optimize (cubthread::entry *thread_p, cubxasl::aggregat
 	  return ER_FAILED;
 	}
 
-      if (btree_get_unique_statistics_for_count (thread_p, &agg_p->btid, &oid_count, &null_count, &key_count) !=
-	  NO_ERROR)
+      if (agg_p->function == PT_COUNT_STAR && xbtree_get_unique_pk (thread_p, &agg_p->btid) == 0)
+	{
+	  /* non-unique index: there are no transaction unique statistics to read, so count the objects visible to
+	   * the snapshot by walking the b-tree leaf level. The index was chosen at compile time over a NOT NULL
+	   * attribute, so every row is represented in the tree. */
+	  if (btree_count_all_visible_oids (thread_p, &agg_p->btid, &oid_count) != NO_ERROR)
+	    {
+	      return ER_FAILED;
+	    }
+	}
+      else if (btree_get_unique_statistics_for_count (thread_p, &agg_p->btid, &oid_count, &null_count, &key_count) !=
+	       NO_ERROR)
 	{
 	  return ER_FAILED;
 	}
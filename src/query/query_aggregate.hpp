@@ -80,6 +80,7 @@ namespace cubquery
     int hash_size;		/* hash table size */
     int group_count;		/* groups processed in hash table */
     int tuple_count;		/* tuples processed in hash table */
+    int spilled_count;		/* entries evicted to partial list */
 
     /* partial list file stuff */
     SCAN_CODE part_scan_code;	/* scan status of partial list file */
@@ -35,6 +35,7 @@
 #include "object_primitive.h"
 #include "object_representation.h"
 #include "regu_var.hpp"
+#include "db_set.h"
 #include "set_object.h"
 #include "xasl.h"
 #include "dbtype.h"
@@ -45,10 +46,14 @@
 
 #define UNKNOWN_CARD   -2	/* Unknown cardinality of a set member */
 
+/* constant IN-lists at least this long are sorted once and binary-searched instead of scanned linearly */
+#define EVAL_SORTED_IN_LIST_MIN_SIZE 16
+
 static DB_LOGICAL eval_negative (DB_LOGICAL res);
 static DB_LOGICAL eval_logical_result (DB_LOGICAL res1, DB_LOGICAL res2);
 static DB_LOGICAL eval_value_rel_cmp (DB_VALUE * dbval1, DB_VALUE * dbval2, REL_OP rel_operator,
 				      const COMP_EVAL_TERM * et_comp);
+static bool eval_some_eval_sorted (DB_VALUE * item, DB_SET * set, DB_LOGICAL * result);
 static DB_LOGICAL eval_some_eval (DB_VALUE * item, DB_SET * set, REL_OP rel_operator);
 static DB_LOGICAL eval_all_eval (DB_VALUE * item, DB_SET * set, REL_OP rel_operator);
 static int eval_item_card_set (DB_VALUE * item, DB_SET * set, REL_OP rel_operator);
@@ -83,6 +88,8 @@ static DB_LOGICAL eval_sort_list_to_sort_list (THREAD_ENTRY * thread_p, QFILE_LI
 					       QFILE_LIST_ID * list_id2, REL_OP rel_operator);
 static DB_LOGICAL eval_set_list_cmp (THREAD_ENTRY * thread_p, const COMP_EVAL_TERM * et_comp, val_descr * vd,
 				     DB_VALUE * dbval1, DB_VALUE * dbval2);
+static bool eval_pred_is_simple_comp (const PRED_EXPR * pr);
+static bool eval_pred_is_and_comp_chain (const PRED_EXPR * pr);
 
 /*
  * eval_negative () - negate the result
@@ -325,6 +332,98 @@ eval_value_rel_cmp (DB_VALUE * dbval1, DB_VALUE * dbval2, REL_OP rel_operator, c
     }
 }
 
+/*
+ * eval_some_eval_sorted () - evaluate an equality some-comparison against a large homogeneous collection by sorting
+ *                            it once and binary-searching it
+ *   return: true if the predicate was evaluated and result is set, false to fall back to the linear scan
+ *   item(in): db_value item; must not be NULL-valued (the caller screens that case)
+ *   set(in): collection of elements; must be private to the caller since it may be sorted in place
+ *   result(out): V_TRUE, V_FALSE or V_UNKNOWN when the return value is true
+ *
+ * Note: The fast path only applies when the collection domain is homogeneous and matches the item type exactly, so
+ *       no element needs coercion and the total order used by col_sort () agrees with the equality used by
+ *       eval_value_rel_cmp (). Any condition outside that envelope simply falls back to eval_some_eval ().
+ */
+static bool
+eval_some_eval_sorted (DB_VALUE * item, DB_SET * set, DB_LOGICAL * result)
+{
+  COL *col;
+  TP_DOMAIN *domain;
+  DB_VALUE *elem;
+  DB_VALUE_COMPARE_RESULT cmp;
+  int lo, hi, mid, size;
+  bool has_null = false;
+
+  col = set->set;
+  if (col == NULL || col->size < EVAL_SORTED_IN_LIST_MIN_SIZE)
+    {
+      return false;
+    }
+
+  domain = setobj_get_domain (col);
+  if (domain == NULL || domain->setdomain == NULL || domain->setdomain->next != NULL
+      || TP_DOMAIN_TYPE (domain->setdomain) != DB_VALUE_DOMAIN_TYPE (item))
+    {
+      return false;
+    }
+
+  if (!col->sorted && col_sort (col) != NO_ERROR)
+    {
+      return false;
+    }
+
+  /* col_sort () moves NULL elements to the end; exclude them from the search but remember their presence, since a
+   * NULL element turns a miss into UNKNOWN */
+  size = col->size;
+  while (size > 0)
+    {
+      if (setobj_get_element_ptr (col, size - 1, &elem) != NO_ERROR || elem == NULL)
+	{
+	  return false;
+	}
+      if (!DB_IS_NULL (elem))
+	{
+	  break;
+	}
+      has_null = true;
+      size--;
+    }
+
+  lo = 0;
+  hi = size - 1;
+  while (lo <= hi)
+    {
+      mid = (lo + hi) / 2;
+      if (setobj_get_element_ptr (col, mid, &elem) != NO_ERROR || elem == NULL)
+	{
+	  return false;
+	}
+      /* the same comparator col_sort () ordered the elements with: total order, coercion off */
+      cmp = (DB_VALUE_COMPARE_RESULT) tp_value_compare (item, elem, 0, 1);
+      if (cmp == DB_EQ)
+	{
+	  *result = V_TRUE;
+	  return true;
+	}
+      else if (cmp == DB_LT)
+	{
+	  hi = mid - 1;
+	}
+      else if (cmp == DB_GT)
+	{
+	  lo = mid + 1;
+	}
+      else
+	{
+	  /* incomparable despite the matching domain; let the linear path sort out the answer */
+	  return false;
+	}
+    }
+
+  *result = has_null ? V_UNKNOWN : V_FALSE;
+  return true;
+}
+
 /*
  * eval_some_eval () -
  *   return: DB_LOGICAL (V_TRUE, V_FALSE, V_UNKNOWN, V_ERROR)
@@ -2005,7 +2104,18 @@ eval_pred (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID *
 		  }
 		else
 		  {
-		    result = eval_some_eval (peek_val1, db_get_set (peek_val2), et_alsm->rel_op);
+		    bool evaluated = false;
+
+		    if (et_alsm->rel_op == R_EQ && et_alsm->elemset->type == TYPE_DBVAL)
+		      {
+			/* the collection is an XASL-private constant, so it may be sorted in place; host variables
+			 * and fetched values keep the linear scan below to preserve their element order */
+			evaluated = eval_some_eval_sorted (peek_val1, db_get_set (peek_val2), &result);
+		      }
+		    if (!evaluated)
+		      {
+			result = eval_some_eval (peek_val1, db_get_set (peek_val2), et_alsm->rel_op);
+		      }
 		  }
 	      }
 	    else
@@ -2530,6 +2640,99 @@ eval_pred_rlike7 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd,
   return (DB_LOGICAL) regexp_res;
 }
 
+/*
+ * eval_pred_and_chain8 () -
+ *   return: DB_LOGICAL (V_TRUE, V_FALSE, V_UNKNOWN or V_ERROR)
+ *   pr(in): Predicate Expression Tree
+ *   vd(in): Value descriptor for positional values (optional)
+ *   obj_oid(in): Object Identifier
+ *
+ * Note: AND chain of regular comparison predicates. 'pt_to_pred_expr()'
+ *       generates a right-linear tree for conjunctions, so the chain is
+ *       walked iteratively and each term evaluated with a direct call,
+ *       without the recursion depth bookkeeping of the general walker.
+ */
+DB_LOGICAL
+eval_pred_and_chain8 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID * obj_oid)
+{
+  const PRED_EXPR *t_pr;
+  DB_LOGICAL result = V_TRUE;
+  DB_LOGICAL term_result;
+
+  for (t_pr = pr; t_pr->type == T_PRED; t_pr = t_pr->pe.m_pred.rhs)
+    {
+      term_result = eval_pred_comp0 (thread_p, t_pr->pe.m_pred.lhs, vd, obj_oid);
+      if (term_result == V_FALSE || term_result == V_ERROR)
+	{
+	  return term_result;
+	}
+      else if (term_result == V_UNKNOWN)
+	{
+	  result = V_UNKNOWN;
+	}
+    }
+
+  term_result = eval_pred_comp0 (thread_p, t_pr, vd, obj_oid);
+  if (term_result == V_FALSE || term_result == V_ERROR)
+    {
+      return term_result;
+    }
+  else if (term_result == V_UNKNOWN)
+    {
+      result = V_UNKNOWN;
+    }
+
+  return result;
+}
+
+/*
+ * eval_pred_is_simple_comp () -
+ *   return: true if the node is a comparison term eval_pred_comp0 can handle
+ *   pr(in): Predicate Expression Tree
+ */
+static bool
+eval_pred_is_simple_comp (const PRED_EXPR * pr)
+{
+  const COMP_EVAL_TERM *et_comp;
+
+  if (pr == NULL || pr->type != T_EVAL_TERM || pr->pe.m_eval_term.et_type != T_COMP_EVAL_TERM)
+    {
+      return false;
+    }
+
+  et_comp = &pr->pe.m_eval_term.et.et_comp;
+
+  return (et_comp->rel_op != R_NULL && et_comp->rel_op != R_EXISTS && et_comp->lhs->type != TYPE_LIST_ID
+	  && et_comp->rhs->type != TYPE_LIST_ID);
+}
+
+/*
+ * eval_pred_is_and_comp_chain () -
+ *   return: true if the tree is a right-linear AND chain of simple
+ *           comparison terms
+ *   pr(in): Predicate Expression Tree
+ */
+static bool
+eval_pred_is_and_comp_chain (const PRED_EXPR * pr)
+{
+  const PRED_EXPR *t_pr;
+
+  if (pr->type != T_PRED || pr->pe.m_pred.bool_op != B_AND)
+    {
+      return false;
+    }
+
+  for (t_pr = pr; t_pr->type == T_PRED; t_pr = t_pr->pe.m_pred.rhs)
+    {
+      if (t_pr->pe.m_pred.bool_op != B_AND || !eval_pred_is_simple_comp (t_pr->pe.m_pred.lhs))
+	{
+	  return false;
+	}
+    }
+
+  return eval_pred_is_simple_comp (t_pr);
+}
+
 /*
  * eval_fnc () -
  *   return:
@@ -2602,6 +2805,12 @@ eval_fnc (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, DB_TYPE * single_node_t
 	}
     }
 
+  /* conjunctions of simple comparisons are the common filter shape; they are evaluated iteratively */
+  if (eval_pred_is_and_comp_chain (pr))
+    {
+      return (PR_EVAL_FNC) eval_pred_and_chain8;
+    }
+
   /* general case */
   return (PR_EVAL_FNC) eval_pred;
 }
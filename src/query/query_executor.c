@@ -49,12 +49,14 @@
 #include "xasl_cache.h"
 #include "stream_to_xasl.h"
 #include "query_manager.h"
+#include "query_monitoring.hpp"
 #include "query_reevaluation.hpp"
 #include "extendible_hash.h"
 #include "replication.h"
 #include "elo.h"
 #include "db_elo.h"
 #include "locator_sr.h"
+#include "page_buffer.h"
 #include "log_lsa.hpp"
 #include "log_volids.hpp"
 #include "xserver_interface.h"
@@ -89,6 +91,8 @@ struct xasl_state
   VAL_DESCR vd;			/* Value Descriptor */
   QUERY_ID query_id;		/* Query associated with XASL */
   int qp_xasl_line;		/* Error line */
+  LOG_TDES *tdes;		/* Transaction descriptor, watched per tuple for out-of-band cancels */
+  INT64 query_deadline;		/* Absolute statement deadline in msec; 0 when the query has no timeout */
 };
 
 #define GOTO_EXIT_ON_ERROR \
@@ -113,6 +117,9 @@ struct xasl_state
 /* if 1, single class query scans are done in a grouped manner. */
 #define QPROC_SINGLE_CLASS_GROUPED_SCAN  (0)
 
+/* number of heap pages of the following partition to read ahead when a partitioned scan switches partitions */
+#define QEXEC_PARTITION_PREFETCH_PAGES   (16)
+
 /* used for tuple string id */
 #define CONNECTBY_TUPLE_INDEX_STRING_MEM  64
 
@@ -126,6 +133,10 @@ struct xasl_state
 /* maximum selectivity allowed for hash aggregate evaluation */
 #define HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD         0.5f
 
+/* number of partitions used when re-aggregating the partial list of an
+   overflowed hash aggregation */
+#define HASH_AGGREGATE_SPILL_PARTITIONS                 8
+
 
 #define QEXEC_CLEAR_AGG_LIST_VALUE(agg_list) \
   do \
@@ -260,6 +271,9 @@ struct analytic_function_state
   int sort_key_tuple_position;	/* position of value_scan_id in current sort key */
 
   int group_consumed_tuples;	/* number of consumed tuples from current group */
+
+  REGU_VARIABLE_LIST offset_regu;	/* resolved offset argument of an offset function */
+  REGU_VARIABLE_LIST default_regu;	/* resolved default argument of an offset function */
 };
 
 typedef struct analytic_state ANALYTIC_STATE;
@@ -418,6 +432,9 @@ static int qexec_orderby_distinct (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QU
 				   XASL_STATE * xasl_state);
 static int qexec_orderby_distinct_by_sorting (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QUERY_OPTIONS option,
 					      XASL_STATE * xasl_state);
+static int qexec_distinct_by_hashing (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				      bool * duplicates_removed);
+static int qexec_free_distinct_hentry (const void *key, void *data, void *args);
 static DB_LOGICAL qexec_eval_grbynum_pred (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate);
 static GROUPBY_STATE *qexec_initialize_groupby_state (GROUPBY_STATE * gbstate, SORT_LIST * groupby_list,
 						      PRED_EXPR * having_pred, PRED_EXPR * grbynum_pred,
@@ -445,6 +462,9 @@ static int qexec_gby_finalize_group_dim (THREAD_ENTRY * thread_p, GROUPBY_STATE
 static void qexec_gby_finalize_group (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, int N, bool keep_list_file);
 static SORT_STATUS qexec_hash_gby_get_next (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
 static int qexec_hash_gby_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
+static int qexec_hash_gby_dump_hash_table (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context,
+					   QFILE_LIST_ID * list_id);
+static int qexec_hash_gby_compact_part_list (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate);
 static SORT_STATUS qexec_gby_get_next (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
 static int qexec_gby_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
 static int qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
@@ -665,7 +685,8 @@ static int qexec_evaluate_partition_aggregates (THREAD_ENTRY * thread_p, ACCESS_
 
 static int qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd);
 static BH_CMP_RESULT qexec_topn_compare (const void *left, const void *right, BH_CMP_ARG arg);
-static BH_CMP_RESULT qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec);
+static BH_CMP_RESULT qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec,
+					PR_FAST_CMP_FUNC fast_cmp);
 static TOPN_STATUS qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * sort_stop,
 					    QFILE_TUPLE_DESCRIPTOR * tpldescr);
 static int qexec_topn_tuples_to_list_id (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
@@ -1106,6 +1127,26 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
   int ret = NO_ERROR;
   bool output_tuple = true;
 
+#if defined (SERVER_MODE)
+  /* An out-of-band cancel flips tdes->interrupt and the statement deadline is
+   * compared against the clock maintained by the log clock daemon, so a tuple
+   * pays only a few loads here; the full interrupt protocol runs only when
+   * one of the two actually fires. */
+  if (xasl_state->tdes != NULL
+      && (xasl_state->tdes->interrupt
+	  || (xasl_state->query_deadline != 0 && xasl_state->query_deadline < log_get_clock_msec ()))
+      && logtb_get_check_interrupt (thread_p) == true)
+    {
+      bool continue_checking = true;
+
+      if (logtb_is_interrupted (thread_p, true, &continue_checking) == true)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+#endif /* SERVER_MODE */
+
   if ((COMPOSITE_LOCK (xasl->scan_op_type) || QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl))
       && !XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG))
     {
@@ -1433,6 +1474,10 @@ qexec_clear_arith_list (THREAD_ENTRY * thread_p, XASL_NODE * xasl_p, ARITH_TYPE
     {
       free_and_init (list->rand_seed);
     }
+  if (list->date_fmt_cache != NULL)
+    {
+      qstr_free_date_fmt_cache (&list->date_fmt_cache);
+    }
 
   return pg_cnt;
 }
@@ -1794,6 +1839,14 @@ qexec_clear_access_spec_list (THREAD_ENTRY * thread_p, XASL_NODE * xasl_p, ACCES
   pg_cnt = 0;
   for (p = list; p; p = p->next)
     {
+      if (p->s_id.scan_stats.num_fetches > 0 || p->s_id.scan_stats.read_rows > 0 || p->s_id.scan_stats.read_keys > 0)
+	{
+	  /* the scan was traced; fold its counters into the global operator monitor before they are cleared */
+	  cubquery::operator_monitor_add (cubquery::MONITORED_OP_SCAN, p->s_id.scan_stats.elapsed_scan,
+					  p->s_id.scan_stats.read_rows + p->s_id.scan_stats.read_keys,
+					  p->s_id.scan_stats.num_fetches);
+	}
+
       memset (&p->s_id.scan_stats, 0, sizeof (SCAN_STATS));
 
       if (p->parts != NULL)
@@ -2301,6 +2354,11 @@ qexec_clear_xasl (THREAD_ENTRY * thread_p, xasl_node * xasl, bool is_final)
 	      db_private_free_and_init (thread_p, xasl->topn_items->tuples);
 	    }
 
+	  if (xasl->topn_items->fast_cmp_funcs != NULL)
+	    {
+	      db_private_free_and_init (thread_p, xasl->topn_items->fast_cmp_funcs);
+	    }
+
 	  db_private_free_and_init (thread_p, xasl->topn_items);
 	}
 
@@ -3151,7 +3209,18 @@ qexec_orderby_distinct (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QUERY_OPTIONS
     }
   else
     {
-      error = qexec_orderby_distinct_by_sorting (thread_p, xasl, option, xasl_state);
+      bool duplicates_removed = false;
+
+      if (option == Q_DISTINCT && xasl->orderby_list == NULL && xasl->ordbynum_val == NULL)
+	{
+	  /* no output order was requested; try to eliminate the duplicates by hashing first */
+	  error = qexec_distinct_by_hashing (thread_p, xasl, xasl_state, &duplicates_removed);
+	}
+
+      if (error == NO_ERROR && !duplicates_removed)
+	{
+	  error = qexec_orderby_distinct_by_sorting (thread_p, xasl, option, xasl_state);
+	}
     }
 
   if (thread_is_on_trace (thread_p))
@@ -3167,6 +3236,11 @@ qexec_orderby_distinct (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QUERY_OPTIONS
 	  xasl->orderby_stats.orderby_ioreads = (perfmon_get_from_statistic (thread_p, PSTAT_SORT_NUM_IO_PAGES)
 						 - old_sort_ioreads);
 	}
+
+      /* fold this execution into the global operator monitor */
+      cubquery::operator_monitor_add (cubquery::MONITORED_OP_SORT, tv_diff,
+				      xasl->list_id != NULL ? (UINT64) xasl->list_id->tuple_cnt : 0,
+				      xasl->orderby_stats.orderby_pages);
     }
 
   return error;
@@ -3397,6 +3471,198 @@ exit_on_error:
   return error;
 }
 
+/*
+ * qexec_free_distinct_hentry () - free a hash entry of the distinct hash table
+ *   return: NO_ERROR
+ *   key(in): key pointer
+ *   data(in): value pointer (the key itself; not freed again)
+ *   args(in): thread entry
+ */
+static int
+qexec_free_distinct_hentry (const void *key, void *data, void *args)
+{
+  qdata_free_agg_hkey ((THREAD_ENTRY *) args, (AGGREGATE_HASH_KEY *) key);
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_distinct_by_hashing () - eliminate duplicate tuples using a hash table
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): XASL whose result list file is to be made distinct
+ *   xasl_state(in): Ptr to the XASL_STATE for this tree
+ *   duplicates_removed(out): true when the list file was replaced by its distinct version
+ *
+ * Note: The result list file is scanned once; the first tuple of each distinct key is appended to a new list file
+ *	 and its key values are kept in a memory hash table, so a result with few distinct values out of many rows
+ *	 avoids the external sort the sort-based elimination pays. When the hash table outgrows the
+ *	 max_hash_distinct_size parameter, the pass gives up without touching the original list file and the caller
+ *	 falls back to the sort-based elimination. Only usable when no output order was requested.
+ */
+static int
+qexec_distinct_by_hashing (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+			   bool * duplicates_removed)
+{
+  QFILE_LIST_ID *list_id = xasl->list_id;
+  QFILE_LIST_ID *dist_list_id = NULL;
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tuple_rec = { NULL, 0 };
+  SCAN_CODE qp_scan;
+  MHT_TABLE *hash_table = NULL;
+  AGGREGATE_HASH_KEY *temp_key = NULL, *new_key = NULL;
+  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_DISTINCT_SIZE);
+  UINT64 hash_size = 0;
+  int type_cnt = list_id->type_list.type_cnt;
+  int ls_flag = QFILE_FLAG_DISTINCT;
+  DB_TYPE type;
+  bool scan_opened = false;
+  int i, error = NO_ERROR;
+
+  *duplicates_removed = false;
+
+  if (mem_limit == 0 || type_cnt <= 0)
+    {
+      /* hash-based elimination is disabled */
+      return NO_ERROR;
+    }
+
+  for (i = 0; i < type_cnt; i++)
+    {
+      type = TP_DOMAIN_TYPE (list_id->type_list.domp[i]);
+      if (pr_is_set_type (type) || type == DB_TYPE_VOBJ || type == DB_TYPE_MIDXKEY)
+	{
+	  /* collection values may be incomparable pairwise; leave them to the sort, which orders them totally */
+	  return NO_ERROR;
+	}
+    }
+
+  /* the new list file replaces the result list file, so it gets the result file flag under the same conditions as
+   * the sort-based path */
+  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED))
+    {
+      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+    }
+
+  dist_list_id = qfile_open_list (thread_p, &list_id->type_list, NULL, list_id->query_id, ls_flag);
+  if (dist_list_id == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  hash_table =
+    mht_create ("Hash distinct elimination", HASH_AGGREGATE_DEFAULT_TABLE_SIZE, qdata_hash_agg_hkey,
+		qdata_agg_hkey_eq);
+  if (hash_table == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  temp_key = qdata_alloc_agg_hkey (thread_p, type_cnt, true);
+  if (temp_key == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  if (qfile_open_list_scan (list_id, &scan_id) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+  scan_opened = true;
+
+  while ((qp_scan = qfile_scan_list_next (thread_p, &scan_id, &tuple_rec, PEEK)) == S_SUCCESS)
+    {
+      /* build the probe key from the tuple values */
+      for (i = 0; i < type_cnt; i++)
+	{
+	  pr_clear_value (temp_key->values[i]);
+	  if (qexec_get_tuple_column_value (tuple_rec.tpl, i, temp_key->values[i], list_id->type_list.domp[i]) !=
+	      NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	}
+
+      if (mht_get (hash_table, (void *) temp_key) != NULL)
+	{
+	  /* a duplicate of an already appended tuple */
+	  continue;
+	}
+
+      new_key = qdata_copy_agg_hkey (thread_p, temp_key);
+      if (new_key == NULL)
+	{
+	  goto exit_on_error;
+	}
+
+      if (mht_put (hash_table, (void *) new_key, (void *) new_key) == NULL)
+	{
+	  qdata_free_agg_hkey (thread_p, new_key);
+	  goto exit_on_error;
+	}
+
+      hash_size += qdata_get_agg_hkey_size (new_key) + sizeof (HENTRY);
+      if (hash_size > mem_limit)
+	{
+	  /* too many distinct values for the memory budget; let the caller fall back to sorting */
+	  goto exit;
+	}
+
+      if (qfile_add_tuple_to_list (thread_p, dist_list_id, tuple_rec.tpl) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+    }
+
+  if (qp_scan != S_END)
+    {
+      goto exit_on_error;
+    }
+
+  qfile_close_scan (thread_p, &scan_id);
+  scan_opened = false;
+
+  /* replace the result list file with the distinct one (see qfile_sort_list_with_func) */
+  qfile_close_list (thread_p, dist_list_id);
+  qfile_close_list (thread_p, list_id);
+  qfile_destroy_list (thread_p, list_id);
+  qfile_copy_list_id (list_id, dist_list_id, true);
+  QFILE_FREE_AND_INIT_LIST_ID (dist_list_id);
+
+  *duplicates_removed = true;
+  goto exit;
+
+exit_on_error:
+
+  error = ER_FAILED;
+
+exit:
+
+  if (scan_opened)
+    {
+      qfile_close_scan (thread_p, &scan_id);
+    }
+
+  if (temp_key != NULL)
+    {
+      qdata_free_agg_hkey (thread_p, temp_key);
+    }
+
+  if (hash_table != NULL)
+    {
+      mht_clear (hash_table, qexec_free_distinct_hentry, (void *) thread_p);
+      mht_destroy (hash_table);
+    }
+
+  if (dist_list_id != NULL)
+    {
+      qfile_close_list (thread_p, dist_list_id);
+      qfile_destroy_list (thread_p, dist_list_id);
+      QFILE_FREE_AND_INIT_LIST_ID (dist_list_id);
+    }
+
+  return error;
+}
+
 /*
  * qexec_eval_grbynum_pred () -
  *   return:
@@ -3876,6 +4142,10 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
       context->hash_size -= qdata_get_agg_hkey_size (key);
       context->hash_size -= qdata_get_agg_hvalue_size (value, false);
       mht_rem (context->hash_table, key, qdata_free_agg_hentry, NULL);
+
+      /* count eviction; a group evicted here can reappear and be spilled again, so the partial list may end up with
+       * duplicate keys that are worth compacting before the sort */
+      context->spilled_count++;
     }
 
   /* check very high selectivity case */
@@ -4073,6 +4343,312 @@ qexec_hash_gby_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *a
   return NO_ERROR;
 }
 
+/*
+ * qexec_hash_gby_dump_hash_table () - dump aggregate hash table entries to a
+ *                                     partial list file
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   context(in): hash context
+ *   list_id(in): target list file
+ *
+ * NOTE: the hash table is cleared afterwards. Unlike
+ * qdata_save_agg_htable_to_list, first tuples are not dumped; entries loaded
+ * back from a partial list never carry one.
+ */
+static int
+qexec_hash_gby_dump_hash_table (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context, QFILE_LIST_ID * list_id)
+{
+  HENTRY_PTR head = context->hash_table->act_head;
+  int rc;
+
+  while (head != NULL)
+    {
+      assert (((AGGREGATE_HASH_VALUE *) head->data)->first_tuple.tpl == NULL);
+
+      rc =
+	qdata_save_agg_hentry_to_list (thread_p, (AGGREGATE_HASH_KEY *) head->key,
+				       (AGGREGATE_HASH_VALUE *) head->data, context->temp_dbval_array, list_id);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      /* next */
+      head = head->act_next;
+    }
+
+  /* clear hash table; entries will no longer be used */
+  return mht_clear (context->hash_table, qdata_free_agg_hentry, (void *) thread_p);
+}
+
+/*
+ * qexec_hash_gby_compact_part_list () - re-aggregate the partial list so it
+ *                                       holds one entry per spilled group
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   gbstate(in): GROUP BY state
+ *
+ * NOTE: when the memory limit forces entries out of the aggregate hash table,
+ * a group can be evicted and rebuilt many times, leaving one partial
+ * accumulator tuple in the partial list for each eviction. Instead of handing
+ * all of them to the sort, the partial list is first split into partitions by
+ * hash key and each partition is re-aggregated in the (now empty) hash table,
+ * so duplicates of a group collapse into a single entry. A partition whose
+ * groups exceed the memory limit is flushed in chunks; the duplicates this
+ * leaves behind are still merged by the sorted merge downstream, so the
+ * compaction is best-effort and never affects correctness.
+ */
+static int
+qexec_hash_gby_compact_part_list (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate)
+{
+  AGGREGATE_HASH_CONTEXT *context = gbstate->agg_hash_context;
+  QFILE_LIST_ID *partition_list_id[HASH_AGGREGATE_SPILL_PARTITIONS] = { NULL };
+  QFILE_LIST_ID *compact_list_id = NULL;
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tuple_rec = { NULL, 0 };
+  AGGREGATE_HASH_KEY *key = context->temp_part_key;
+  AGGREGATE_HASH_VALUE *value = context->temp_part_value;
+  AGGREGATE_HASH_VALUE *hvalue;
+  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE);
+  unsigned int part_no;
+  int table_size = 0;
+  int i, rc = NO_ERROR;
+  SCAN_CODE sc = S_END;
+
+  /* the hash table was dumped before getting here */
+  assert (mht_count (context->hash_table) == 0);
+
+  scan_id.status = S_CLOSED;
+
+  /* create partition list files; they share the layout of the partial list */
+  for (i = 0; i < HASH_AGGREGATE_SPILL_PARTITIONS; i++)
+    {
+      partition_list_id[i] =
+	qfile_open_list (thread_p, &context->part_list_id->type_list, NULL, gbstate->xasl_state->query_id, 0);
+      if (partition_list_id[i] == NULL)
+	{
+	  rc = ER_FAILED;
+	  goto cleanup;
+	}
+    }
+
+  /* distribute partial entries to partitions by hash key */
+  if (qfile_open_list_scan (context->part_list_id, &scan_id) != NO_ERROR)
+    {
+      rc = ER_FAILED;
+      goto cleanup;
+    }
+
+  while ((sc = qfile_scan_list_next (thread_p, &scan_id, &tuple_rec, PEEK)) == S_SUCCESS)
+    {
+      /* decode the key to pick a partition; the raw tuple is moved as-is */
+      rc =
+	qdata_load_agg_hentry_from_tuple (thread_p, tuple_rec.tpl, key, value, context->key_domains,
+					  context->accumulator_domains);
+      if (rc != NO_ERROR)
+	{
+	  goto cleanup;
+	}
+
+      part_no = qdata_hash_agg_hkey (key, HASH_AGGREGATE_SPILL_PARTITIONS) % HASH_AGGREGATE_SPILL_PARTITIONS;
+
+      rc = qfile_add_tuple_to_list (thread_p, partition_list_id[part_no], tuple_rec.tpl);
+      if (rc != NO_ERROR)
+	{
+	  goto cleanup;
+	}
+    }
+
+  qfile_close_scan (thread_p, &scan_id);
+  if (sc == S_ERROR)
+    {
+      rc = ER_FAILED;
+      goto cleanup;
+    }
+
+  /* create compacted list file; it replaces the partial list, so it needs the same tuple descriptor for
+   * qdata_save_agg_hentry_to_list */
+  compact_list_id =
+    qfile_open_list (thread_p, &context->part_list_id->type_list, NULL, gbstate->xasl_state->query_id, 0);
+  if (compact_list_id == NULL)
+    {
+      rc = ER_FAILED;
+      goto cleanup;
+    }
+
+  compact_list_id->tpl_descr.f_cnt = compact_list_id->type_list.type_cnt;
+  compact_list_id->tpl_descr.f_valp = (DB_VALUE **) malloc (sizeof (DB_VALUE *) * compact_list_id->type_list.type_cnt);
+  if (compact_list_id->tpl_descr.f_valp == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      sizeof (DB_VALUE *) * compact_list_id->type_list.type_cnt);
+      rc = ER_FAILED;
+      goto cleanup;
+    }
+  compact_list_id->tpl_descr.clear_f_val_at_clone_decache =
+    (bool *) malloc (sizeof (bool) * compact_list_id->type_list.type_cnt);
+  if (compact_list_id->tpl_descr.clear_f_val_at_clone_decache == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      sizeof (bool) * compact_list_id->type_list.type_cnt);
+      rc = ER_FAILED;
+      goto cleanup;
+    }
+  for (i = 0; i < compact_list_id->type_list.type_cnt; i++)
+    {
+      compact_list_id->tpl_descr.clear_f_val_at_clone_decache[i] = false;
+    }
+
+  /* re-aggregate each partition in the hash table and dump the merged groups */
+  for (i = 0; i < HASH_AGGREGATE_SPILL_PARTITIONS; i++)
+    {
+      qfile_close_list (thread_p, partition_list_id[i]);
+      if (partition_list_id[i]->tuple_cnt == 0)
+	{
+	  continue;
+	}
+
+      if (qfile_open_list_scan (partition_list_id[i], &scan_id) != NO_ERROR)
+	{
+	  rc = ER_FAILED;
+	  goto cleanup;
+	}
+
+      while ((sc =
+	      qdata_load_agg_hentry_from_list (thread_p, &scan_id, key, value, context->key_domains,
+					       context->accumulator_domains)) == S_SUCCESS)
+	{
+	  hvalue = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
+	  if (hvalue != NULL)
+	    {
+	      AGGREGATE_TYPE *agg_list = gbstate->g_output_agg_list;
+	      int func_no = 0;
+
+	      /* group was spilled more than once; compose accumulators */
+	      while (agg_list != NULL)
+		{
+		  rc =
+		    qdata_aggregate_accumulator_to_accumulator (thread_p, &hvalue->accumulators[func_no],
+								&agg_list->accumulator_domain, agg_list->function,
+								agg_list->domain, &value->accumulators[func_no]);
+		  if (rc != NO_ERROR)
+		    {
+		      goto cleanup;
+		    }
+
+		  agg_list = agg_list->next;
+		  func_no++;
+		}
+
+	      hvalue->tuple_count += value->tuple_count;
+	    }
+	  else
+	    {
+	      AGGREGATE_HASH_KEY *new_key;
+	      AGGREGATE_HASH_VALUE *new_value;
+	      int func_no;
+
+	      /* create new key */
+	      new_key = qdata_copy_agg_hkey (thread_p, key);
+	      if (new_key == NULL)
+		{
+		  assert (er_errid () != NO_ERROR);
+		  rc = er_errid ();
+		  goto cleanup;
+		}
+
+	      /* create new value from the loaded accumulators */
+	      new_value = qdata_alloc_agg_hvalue (thread_p, value->func_count, gbstate->g_output_agg_list);
+	      if (new_value == NULL)
+		{
+		  qdata_free_agg_hkey (thread_p, new_key);
+
+		  assert (er_errid () != NO_ERROR);
+		  rc = er_errid ();
+		  goto cleanup;
+		}
+
+	      new_value->tuple_count = value->tuple_count;
+	      for (func_no = 0; func_no < value->func_count; func_no++)
+		{
+		  pr_clone_value (value->accumulators[func_no].value, new_value->accumulators[func_no].value);
+		  pr_clone_value (value->accumulators[func_no].value2, new_value->accumulators[func_no].value2);
+		  new_value->accumulators[func_no].curr_cnt = value->accumulators[func_no].curr_cnt;
+		}
+
+	      /* add to hash table */
+	      mht_put (context->hash_table, (void *) new_key, (void *) new_value);
+
+	      /* compute hash table size */
+	      table_size += qdata_get_agg_hkey_size (new_key);
+	      table_size += qdata_get_agg_hvalue_size (new_value, false);
+
+	      /* a partition whose groups do not fit in memory is flushed in chunks; the sorted merge downstream
+	       * handles the remaining duplicates */
+	      if (table_size > (int) mem_limit)
+		{
+		  rc = qexec_hash_gby_dump_hash_table (thread_p, context, compact_list_id);
+		  if (rc != NO_ERROR)
+		    {
+		      goto cleanup;
+		    }
+		  table_size = 0;
+		}
+	    }
+	}
+
+      qfile_close_scan (thread_p, &scan_id);
+      if (sc == S_ERROR)
+	{
+	  rc = ER_FAILED;
+	  goto cleanup;
+	}
+
+      /* dump the re-aggregated partition */
+      rc = qexec_hash_gby_dump_hash_table (thread_p, context, compact_list_id);
+      if (rc != NO_ERROR)
+	{
+	  goto cleanup;
+	}
+      table_size = 0;
+    }
+
+  /* the compacted list replaces the partial list */
+  qfile_close_list (thread_p, compact_list_id);
+  qfile_close_list (thread_p, context->part_list_id);
+  qfile_destroy_list (thread_p, context->part_list_id);
+  qfile_free_list_id (context->part_list_id);
+  context->part_list_id = compact_list_id;
+  compact_list_id = NULL;
+
+cleanup:
+  qfile_close_scan (thread_p, &scan_id);
+
+  if (compact_list_id != NULL)
+    {
+      qfile_close_list (thread_p, compact_list_id);
+      qfile_destroy_list (thread_p, compact_list_id);
+      qfile_free_list_id (compact_list_id);
+    }
+
+  for (i = 0; i < HASH_AGGREGATE_SPILL_PARTITIONS; i++)
+    {
+      if (partition_list_id[i] != NULL)
+	{
+	  qfile_close_list (thread_p, partition_list_id[i]);
+	  qfile_destroy_list (thread_p, partition_list_id[i]);
+	  qfile_free_list_id (partition_list_id[i]);
+	}
+    }
+
+  if (rc != NO_ERROR)
+    {
+      (void) mht_clear (context->hash_table, qdata_free_agg_hentry, (void *) thread_p);
+    }
+
+  return rc;
+}
+
 /*
  * qexec_gby_get_next () -
  *   return:
@@ -4578,6 +5154,17 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
       qfile_close_list (thread_p, list_id);
     }
 
+  /* when the memory limit forced evictions, the same group may appear many times in the partial list; re-aggregate it
+   * so the sort below sees one entry per group instead of one per eviction */
+  if (gbstate.hash_eligible && gbstate.agg_hash_context->spilled_count > 0
+      && gbstate.agg_hash_context->part_list_id->tuple_cnt > 1)
+    {
+      if (qexec_hash_gby_compact_part_list (thread_p, &gbstate) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
   /* sort partial list and open a scan on it */
   if (gbstate.hash_eligible && gbstate.agg_hash_context->part_list_id->tuple_cnt > 0)
     {
@@ -4606,7 +5193,9 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
 
       /* sort and aggregate partial results */
       if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_hash_gby_get_next, &gbstate,
-			 &qexec_hash_gby_put_next, &gbstate, cmp_fn, &gbstate.agg_hash_context->sort_key, SORT_DUP,
+			 &qexec_hash_gby_put_next, &gbstate, cmp_fn, &gbstate.agg_hash_context->sort_key,
+			 qfile_get_sort_prefix_function (&gbstate.agg_hash_context->sort_key, cmp_fn),
+			 qfile_sort_prefix_is_total_order (&gbstate.agg_hash_context->sort_key), SORT_DUP,
 			 NO_SORT_LIMIT, gbstate.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
 	{
 	  GOTO_EXIT_ON_ERROR;
@@ -4687,7 +5276,9 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
   estimated_pages = qfile_get_estimated_pages_for_sorting (list_id, &gbstate.key_info);
 
   if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_gby_get_next, &gbstate, &qexec_gby_put_next,
-		     &gbstate, gbstate.cmp_fn, &gbstate.key_info, SORT_DUP, NO_SORT_LIMIT,
+		     &gbstate, gbstate.cmp_fn, &gbstate.key_info,
+		     qfile_get_sort_prefix_function (&gbstate.key_info, gbstate.cmp_fn),
+		     qfile_sort_prefix_is_total_order (&gbstate.key_info), SORT_DUP, NO_SORT_LIMIT,
 		     gbstate.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
@@ -4749,6 +5340,10 @@ wrapup:
 	    xasl->groupby_stats.groupby_ioreads = (perfmon_get_from_statistic (thread_p, PSTAT_SORT_NUM_IO_PAGES)
 						   - old_sort_ioreads);
 	  }
+
+	/* fold this group by into the global operator monitor */
+	cubquery::operator_monitor_add (cubquery::MONITORED_OP_AGGREGATE, tv_diff,
+					(UINT64) xasl->groupby_stats.rows, xasl->groupby_stats.groupby_pages);
       }
 
     return result;
@@ -7668,6 +8263,25 @@ qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
 	  btid = spec->curent->btid;
 	}
     }
+
+  if (spec->curent != NULL && spec->curent->next != NULL
+      && (spec->access == ACCESS_METHOD_SEQUENTIAL || spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO
+	  || spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN))
+    {
+      /* partitions are scanned one after another on this thread; hand the head of the partition after the one we are
+       * switching to over to the read-ahead daemon, so its reads run while this partition is being consumed */
+      VPID prefetch_vpids[QEXEC_PARTITION_PREFETCH_PAGES];
+      HFID *next_hfid = &spec->curent->next->hfid;
+      int i;
+
+      for (i = 0; i < QEXEC_PARTITION_PREFETCH_PAGES; i++)
+	{
+	  prefetch_vpids[i].volid = next_hfid->vfid.volid;
+	  prefetch_vpids[i].pageid = next_hfid->hpgid + i;
+	}
+      (void) pgbuf_prefetch_range (thread_p, prefetch_vpids, QEXEC_PARTITION_PREFETCH_PAGES);
+    }
+
   if (spec->type == TARGET_CLASS
       && (spec->access == ACCESS_METHOD_SEQUENTIAL || spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO))
     {
@@ -13583,6 +14197,15 @@ qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state *
 
       xasl->xasl_stats.fetches += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES) - old_fetches;
       xasl->xasl_stats.ioreads += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS) - old_ioreads;
+
+      if (xasl->type == MERGELIST_PROC)
+	{
+	  /* nested loop joins are visible through their scans; merge joins only show up at the node level, so fold
+	   * them into the global operator monitor here */
+	  cubquery::operator_monitor_add (cubquery::MONITORED_OP_JOIN, tv_diff,
+					  xasl->list_id != NULL ? (UINT64) xasl->list_id->tuple_cnt : 0,
+					  perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES) - old_fetches);
+	}
     }
 
   thread_dec_recursion_depth (thread_p);
@@ -14839,6 +15462,13 @@ qexec_execute_query (THREAD_ENTRY * thread_p, xasl_node * xasl, int dbval_cnt, c
   xasl_state.qp_xasl_line = 0;
 
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+
+  /* cache the transaction descriptor and the absolute deadline set by
+   * qmgr_set_query_exec_info_to_tdes so that scan loops can watch for cancels
+   * and timeouts with plain comparisons; see qexec_end_one_iteration */
+  xasl_state.tdes = LOG_FIND_TDES (tran_index);
+  xasl_state.query_deadline = (xasl_state.tdes != NULL) ? xasl_state.tdes->query_timeout : 0;
+
   if (logtb_find_current_isolation (thread_p) >= TRAN_REP_READ)
     {
       /* We need to be sure we have a snapshot. Insert ... values execution might not get any snapshot. Then next
@@ -16671,6 +17301,11 @@ qexec_listfile_orderby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QFILE_LIST_ID
 						    - old_sort_pages);
 	      xasl->orderby_stats.orderby_ioreads += (perfmon_get_from_statistic (thread_p, PSTAT_SORT_NUM_IO_PAGES)
 						      - old_sort_ioreads);
+
+	      /* fold this sort into the global operator monitor */
+	      cubquery::operator_monitor_add (cubquery::MONITORED_OP_SORT, tv_diff, (UINT64) list_id->tuple_cnt,
+					      perfmon_get_from_statistic (thread_p, PSTAT_SORT_NUM_DATA_PAGES)
+					      - old_sort_pages);
 	    }
 	}
     }
@@ -16817,7 +17452,7 @@ qexec_get_index_pseudocolumn_value_from_tuple (THREAD_ENTRY * thread_p, XASL_NOD
   if (!db_value_is_null (*index_valp))
     {
       /* increase the size if more space needed */
-      while ((int) strlen ((*index_valp)->data.ch.medium.buf) + 1 > *index_len)
+      while ((int) strlen (db_get_string (*index_valp)) + 1 > *index_len)
 	{
 	  (*index_len) += CONNECTBY_TUPLE_INDEX_STRING_MEM;
 	  db_private_free_and_init (thread_p, *index_value);
@@ -16829,7 +17464,7 @@ qexec_get_index_pseudocolumn_value_from_tuple (THREAD_ENTRY * thread_p, XASL_NOD
 	    }
 	}
 
-      strcpy (*index_value, (*index_valp)->data.ch.medium.buf);
+      strcpy (*index_value, db_get_string (*index_valp));
     }
 
   return NO_ERROR;
@@ -19012,12 +19647,17 @@ qexec_groupby_index (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xas
 
 		  /* new group should begin, check code below */
 		  all_cols_equal = false;
-		}
 
-	      pr_clear_value (&list_dbvals[i]);
+		  /* the changed value becomes the comparison key of the new group; while the value compares equal
+		   * there is no point re-cloning it for every row of the group */
+		  pr_clear_value (&list_dbvals[i]);
+		  pr_clone_value (&val, &list_dbvals[i]);
+		}
+	    }
+	  else
+	    {
+	      pr_clone_value (&val, &list_dbvals[i]);
 	    }
-
-	  pr_clone_value (&val, &list_dbvals[i]);
 
 	  if (DB_NEED_CLEAR (&val))
 	    {
@@ -19080,6 +19720,10 @@ qexec_groupby_index (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xas
       tsc_getticks (&end_tick);
       tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
       TSC_ADD_TIMEVAL (xasl->groupby_stats.groupby_time, tv_diff);
+
+      /* fold this group by into the global operator monitor */
+      cubquery::operator_monitor_add (cubquery::MONITORED_OP_AGGREGATE, tv_diff,
+				      (UINT64) xasl->groupby_stats.rows, 0);
     }
 
 exit_on_error:
@@ -19438,7 +20082,9 @@ qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 
   if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_analytic_get_next, &analytic_state,
 		     &qexec_analytic_put_next, &analytic_state, analytic_state.cmp_fn, &analytic_state.key_info,
-		     SORT_DUP, NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
+		     qfile_get_sort_prefix_function (&analytic_state.key_info, analytic_state.cmp_fn),
+		     qfile_sort_prefix_is_total_order (&analytic_state.key_info), SORT_DUP,
+		     NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
@@ -19565,6 +20211,10 @@ qexec_initialize_analytic_function_state (THREAD_ENTRY * thread_p, ANALYTIC_FUNC
   func_state->curr_group_tuple_count_nn = 0;
   func_state->curr_sort_key_tuple_count = 0;
 
+  /* offset function arguments are resolved on first evaluation */
+  func_state->offset_regu = NULL;
+  func_state->default_regu = NULL;
+
   /* initialize tuple record */
   func_state->group_tplrec.size = 0;
   func_state->group_tplrec.tpl = NULL;
@@ -20511,20 +21161,37 @@ qexec_analytic_evaluate_offset_function (THREAD_ENTRY * thread_p, ANALYTIC_FUNCT
       group_tuple_count = func_state->curr_group_tuple_count;
     }
 
-  /* find offset reguvar and get int value */
-  regulist = analytic_state->a_regu_list;
-  regu_idx = func_p->offset_idx;
-  while (regu_idx > 0 && regulist != NULL)
+  /* the offset and default arguments sit at fixed positions in the regu list; resolve them once per execution
+   * instead of walking the list again for every output row */
+  if (func_state->offset_regu == NULL)
     {
-      regulist = regulist->next;
-      regu_idx--;
-    }
-  if (regulist == NULL)
-    {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      return ER_FAILED;
+      regulist = analytic_state->a_regu_list;
+      regu_idx = func_p->offset_idx;
+      while (regu_idx > 0 && regulist != NULL)
+	{
+	  regulist = regulist->next;
+	  regu_idx--;
+	}
+      func_state->offset_regu = regulist;
+
+      regulist = analytic_state->a_regu_list;
+      regu_idx = func_p->default_idx;
+      while (regu_idx > 0 && regulist != NULL)
+	{
+	  regulist = regulist->next;
+	  regu_idx--;
+	}
+      func_state->default_regu = regulist;
+
+      if (func_state->offset_regu == NULL || func_state->default_regu == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+	  return ER_FAILED;
+	}
     }
 
+  regulist = func_state->offset_regu;
+
   /* get target tuple index */
   switch (func_p->function)
     {
@@ -20614,20 +21281,8 @@ qexec_analytic_evaluate_offset_function (THREAD_ENTRY * thread_p, ANALYTIC_FUNCT
   /* clean up */
   pr_clear_value (&offset_val);
 
-  /* find defaultvalue reguvar and get dbvalue pointer */
-  regulist = analytic_state->a_regu_list;
-  regu_idx = func_p->default_idx;
-  while (regu_idx > 0 && regulist != NULL)
-    {
-      regulist = regulist->next;
-      regu_idx--;
-    }
-  if (regulist == NULL)
-    {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      return ER_FAILED;
-    }
-  default_val_p = regulist->value.vfetch_to;
+  /* get default value dbvalue pointer */
+  default_val_p = func_state->default_regu->value.vfetch_to;
 
   /* put value */
   if (target_idx >= 0 && target_idx < group_tuple_count)
@@ -23784,38 +24439,58 @@ qexec_evaluate_aggregates_optimize (THREAD_ENTRY * thread_p, AGGREGATE_TYPE * ag
        * optimization and force a snapshot */
       if (!*is_scan_needed && agg_ptr->function == PT_COUNT_STAR)
 	{
-	  LOG_TDES *tdes = LOG_FIND_TDES (LOG_FIND_THREAD_TRAN_INDEX (thread_p));
-	  LOG_TRAN_CLASS_COS *class_cos = logtb_tran_find_class_cos (thread_p, &ACCESS_SPEC_CLS_OID (spec),
-								     true);
-	  if (class_cos == NULL)
+	  if (BTID_IS_NULL (&agg_ptr->btid))
 	    {
 	      agg_ptr->flag_agg_optimize = false;
 	      *is_scan_needed = true;
 	      break;
 	    }
-	  if (tdes->mvccinfo.snapshot.valid)
+	  if (xbtree_get_unique_pk (thread_p, &agg_ptr->btid) == 0)
 	    {
-	      if (class_cos->count_state != COS_LOADED)
+	      /* non-unique index: the count comes from a leaf-level walk against the snapshot in
+	       * qdata_evaluate_aggregate_optimize, not from the class count optimization state; only make sure a
+	       * snapshot exists */
+	      if (logtb_get_mvcc_snapshot (thread_p) == NULL)
 		{
-		  agg_ptr->flag_agg_optimize = false;
-		  *is_scan_needed = true;
-		  break;
+		  error = er_errid ();
+		  return (error == NO_ERROR ? ER_FAILED : error);
 		}
 	    }
 	  else
 	    {
-	      if (logtb_tran_find_btid_stats (thread_p, &agg_ptr->btid, true) == NULL)
+	      LOG_TDES *tdes = LOG_FIND_TDES (LOG_FIND_THREAD_TRAN_INDEX (thread_p));
+	      LOG_TRAN_CLASS_COS *class_cos = logtb_tran_find_class_cos (thread_p, &ACCESS_SPEC_CLS_OID (spec),
+									 true);
+	      if (class_cos == NULL)
 		{
 		  agg_ptr->flag_agg_optimize = false;
 		  *is_scan_needed = true;
 		  break;
 		}
-	      class_cos->count_state = COS_TO_LOAD;
-
-	      if (logtb_get_mvcc_snapshot (thread_p) == NULL)
+	      if (tdes->mvccinfo.snapshot.valid)
 		{
-		  error = er_errid ();
-		  return (error == NO_ERROR ? ER_FAILED : error);
+		  if (class_cos->count_state != COS_LOADED)
+		    {
+		      agg_ptr->flag_agg_optimize = false;
+		      *is_scan_needed = true;
+		      break;
+		    }
+		}
+	      else
+		{
+		  if (logtb_tran_find_btid_stats (thread_p, &agg_ptr->btid, true) == NULL)
+		    {
+		      agg_ptr->flag_agg_optimize = false;
+		      *is_scan_needed = true;
+		      break;
+		    }
+		  class_cos->count_state = COS_TO_LOAD;
+
+		  if (logtb_get_mvcc_snapshot (thread_p) == NULL)
+		    {
+		      error = er_errid ();
+		      return (error == NO_ERROR ? ER_FAILED : error);
+		    }
 		}
 	    }
 	}
@@ -23871,7 +24546,10 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
   DB_VALUE ubound_val;
   REGU_VARIABLE_LIST var_list = NULL;
   TOPN_TUPLES *top_n = NULL;
+  SORT_LIST *sort_key = NULL;
+  TP_DOMAIN *key_dom = NULL;
   int error = NO_ERROR, ubound = 0, count = 0;
+  int num_keys = 0, key_idx = 0;
   UINT64 estimated_size = 0, max_size = 0;
 
   if (xasl->type != BUILDLIST_PROC)
@@ -23995,6 +24673,7 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
 
   top_n->max_size = max_size;
   top_n->total_size = 0;
+  top_n->fast_cmp_funcs = NULL;
 
   top_n->tuples = (TOPN_TUPLE *) db_private_alloc (thread_p, ubound * sizeof (TOPN_TUPLE));
   if (top_n->tuples == NULL)
@@ -24015,6 +24694,35 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
   top_n->sort_items = xasl->orderby_list;
   top_n->values_count = count;
 
+  /* Resolve the compare kernels once; the heap consults them for every comparison it makes. */
+  num_keys = 0;
+  for (sort_key = xasl->orderby_list; sort_key != NULL; sort_key = sort_key->next)
+    {
+      num_keys++;
+    }
+
+  top_n->fast_cmp_funcs = (PR_FAST_CMP_FUNC *) db_private_alloc (thread_p, num_keys * sizeof (PR_FAST_CMP_FUNC));
+  if (top_n->fast_cmp_funcs == NULL)
+    {
+      error = ER_FAILED;
+      goto error_return;
+    }
+
+  key_idx = 0;
+  for (sort_key = xasl->orderby_list; sort_key != NULL; sort_key = sort_key->next)
+    {
+      key_dom = sort_key->pos_descr.dom;
+      if (TP_DOMAIN_TYPE (key_dom) == DB_TYPE_VARIABLE || TP_DOMAIN_COLLATION_FLAG (key_dom) != TP_DOMAIN_COLL_NORMAL)
+	{
+	  /* the domain is not known until execution; qexec_topn_cmpval keeps using tp_value_compare */
+	  top_n->fast_cmp_funcs[key_idx++] = NULL;
+	}
+      else
+	{
+	  top_n->fast_cmp_funcs[key_idx++] = pr_get_fast_comparator (key_dom);
+	}
+    }
+
   xasl->topn_items = top_n;
 
   return NO_ERROR;
@@ -24030,6 +24738,10 @@ error_return:
 	{
 	  db_private_free (thread_p, top_n->tuples);
 	}
+      if (top_n->fast_cmp_funcs != NULL)
+	{
+	  db_private_free (thread_p, top_n->fast_cmp_funcs);
+	}
       db_private_free (thread_p, top_n);
     }
 
@@ -24047,16 +24759,18 @@ static BH_CMP_RESULT
 qexec_topn_compare (const void *left, const void *right, BH_CMP_ARG arg)
 {
   int pos;
+  int key_idx = 0;
   SORT_LIST *key = NULL;
   TOPN_TUPLES *proc = (TOPN_TUPLES *) arg;
   TOPN_TUPLE *left_tuple = *((TOPN_TUPLE **) left);
   TOPN_TUPLE *right_tuple = *((TOPN_TUPLE **) right);
   BH_CMP_RESULT cmp;
 
-  for (key = proc->sort_items; key != NULL; key = key->next)
+  for (key = proc->sort_items; key != NULL; key = key->next, key_idx++)
     {
       pos = key->pos_descr.pos_no;
-      cmp = qexec_topn_cmpval (&left_tuple->values[pos], &right_tuple->values[pos], key);
+      cmp =
+	qexec_topn_cmpval (&left_tuple->values[pos], &right_tuple->values[pos], key, proc->fast_cmp_funcs[key_idx]);
       if (cmp == BH_EQ)
 	{
 	  continue;
@@ -24073,11 +24787,13 @@ qexec_topn_compare (const void *left, const void *right, BH_CMP_ARG arg)
  * left (in)  : left value
  * right (in) : right value
  * sort_spec (in): sort spec for left and right
+ * fast_cmp (in): compare kernel resolved at setup for the sort spec domain,
+ *		  or NULL to use the generic domain comparator
  *
  * Note: tp_value_compare is too complex for our case
  */
 static BH_CMP_RESULT
-qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec)
+qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec, PR_FAST_CMP_FUNC fast_cmp)
 {
   int cmp;
   if (DB_IS_NULL (left))
@@ -24104,8 +24820,12 @@ qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec)
     }
   else
     {
-      if (TP_DOMAIN_TYPE (sort_spec->pos_descr.dom) == DB_TYPE_VARIABLE
-	  || TP_DOMAIN_COLLATION_FLAG (sort_spec->pos_descr.dom) != TP_DOMAIN_COLL_NORMAL)
+      if (fast_cmp != NULL)
+	{
+	  cmp = fast_cmp (left, right);
+	}
+      else if (TP_DOMAIN_TYPE (sort_spec->pos_descr.dom) == DB_TYPE_VARIABLE
+	       || TP_DOMAIN_COLLATION_FLAG (sort_spec->pos_descr.dom) != TP_DOMAIN_COLL_NORMAL)
 	{
 	  /* In cases like order by val + ?, the domain of the expression is not known at compile time */
 	  cmp = tp_value_compare (left, right, 1, 1);
@@ -24157,6 +24877,7 @@ qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, QFIL
   BH_CMP_RESULT res = BH_EQ;
   SORT_LIST *key = NULL;
   int pos = 0;
+  int key_idx = 0;
   TOPN_TUPLE *heap_max = NULL;
 
   assert (topn_items != NULL && tpldescr != NULL);
@@ -24200,10 +24921,10 @@ qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, QFIL
     }
   assert (heap_max != NULL);
 
-  for (key = topn_items->sort_items; key != NULL; key = key->next)
+  for (key = topn_items->sort_items; key != NULL; key = key->next, key_idx++)
     {
       pos = key->pos_descr.pos_no;
-      res = qexec_topn_cmpval (&heap_max->values[pos], tpldescr->f_valp[pos], key);
+      res = qexec_topn_cmpval (&heap_max->values[pos], tpldescr->f_valp[pos], key, topn_items->fast_cmp_funcs[key_idx]);
       if (res == BH_EQ)
 	{
 	  continue;
@@ -24399,6 +25120,10 @@ cleanup:
 	{
 	  db_private_free (thread_p, xasl->topn_items->tuples);
 	}
+      if (xasl->topn_items->fast_cmp_funcs != NULL)
+	{
+	  db_private_free (thread_p, xasl->topn_items->fast_cmp_funcs);
+	}
       db_private_free (thread_p, xasl->topn_items);
       xasl->topn_items = NULL;
     }
@@ -24987,6 +25712,7 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context->hash_size = 0;
   proc->agg_hash_context->group_count = 0;
   proc->agg_hash_context->tuple_count = 0;
+  proc->agg_hash_context->spilled_count = 0;
   proc->agg_hash_context->sorted_count = 0;
   proc->agg_hash_context->state = HS_ACCEPT_ALL;
 
@@ -25117,6 +25843,7 @@ qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc
   proc->agg_hash_context->hash_size = 0;
   proc->agg_hash_context->group_count = 0;
   proc->agg_hash_context->tuple_count = 0;
+  proc->agg_hash_context->spilled_count = 0;
 }
 
 /*
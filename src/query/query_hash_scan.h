@@ -125,6 +125,9 @@ struct hash_list_scan
   HASH_METHOD hash_list_scan_type;	/* IN_MEM, HYBRID or HASH_FILE */
   unsigned int curr_hash_key;	/* current hash key */
   bool need_coerce_type;	/* Are the types of probe and build different? */
+  UINT64 *bloom_bits;		/* bloom filter over the build keys; NULL when not used. Probe keys that miss the
+				 * filter are rejected before the hash table (or hash file page) is touched. */
+  unsigned int bloom_bit_mask;	/* number of filter bits - 1; the number of bits is a power of two */
 };
 
 HASH_SCAN_KEY *qdata_alloc_hscan_key (THREAD_ENTRY * thread_p, int val_cnt, bool alloc_vals);
@@ -46,6 +46,26 @@ typedef enum
 /* aligned size of the field */
 #define QFILE_PAGE_HEADER_SIZE          32
 
+/*
+ * Number of sequential list file pages shipped to the client in one fetch
+ * round trip. The client cursor buffer and the server reply buffer are both
+ * sized by this, so the two sides always agree on the transfer capacity.
+ */
+#define QFILE_PAGE_TRANSFER_NPAGES      8
+#define QFILE_PAGE_TRANSFER_SIZE        (QFILE_PAGE_TRANSFER_NPAGES * IO_MAX_PAGE_SIZE)
+
+/* One list file page held in the page buffer for a zero-copy transfer to
+ * the client.  The pages stay fixed until the caller releases them with
+ * xqfile_free_list_file_page_fragments(), after the content has been sent
+ * directly from the page buffer. */
+typedef struct qfile_page_fragment QFILE_PAGE_FRAGMENT;
+struct qfile_page_fragment
+{
+  PAGE_PTR page_p;		/* fixed list file page */
+  struct qmgr_temp_file *tfile_vfid;	/* temp file the page belongs to */
+  int size;			/* number of bytes of the page to ship */
+};
+
 /* offset values to access fields */
 #define QFILE_TUPLE_COUNT_OFFSET        0
 #define QFILE_PREV_PAGE_ID_OFFSET       4
@@ -37,16 +37,25 @@
 #include "object_representation.h"
 #include "xserver_interface.h"
 #include "query_executor.h"
+#include "query_monitoring.hpp"
 #include "stream_to_xasl.h"
 #include "session.h"
 #include "filter_pred_cache.h"
 #include "crypt_opfunc.h"
+#include "perf_monitor.h"
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
 #include "thread_entry.hpp"
 #include "xasl_cache.h"
 #include "xasl_unpack_info.hpp"
+#if defined (SERVER_MODE)
+#include "internal_tasks_worker_pool.hpp"
+#include "thread_manager.hpp"
+
+#include <utility>
+#include <vector>
+#endif /* SERVER_MODE */
 
 #if !defined (SERVER_MODE)
 
@@ -172,6 +181,28 @@ static QFILE_LIST_ID *qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * x
 					  QUERY_FLAG flag, QMGR_QUERY_ENTRY * query_p, QMGR_TRAN_ENTRY * tran_entry_p);
 static void qmgr_reset_query_exec_info (int tran_index);
 static void qmgr_set_query_exec_info_to_tdes (int tran_index, int query_timeout, const XASL_ID * xasl_id);
+
+/* Admission control for heavyweight queries.  Queries whose referenced
+ * classes exceed heavy_query_page_threshold pages compete for
+ * heavy_query_max_concurrency execution slots; the rest run unchecked.
+ * Waiters are admitted in FIFO order through a linked list of stack-allocated
+ * entries. */
+typedef struct qmgr_admission_waiter QMGR_ADMISSION_WAITER;
+struct qmgr_admission_waiter
+{
+  QMGR_ADMISSION_WAITER *next;
+};
+
+static pthread_mutex_t qmgr_Admission_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t qmgr_Admission_cond = PTHREAD_COND_INITIALIZER;
+static QMGR_ADMISSION_WAITER *qmgr_Admission_waiters_head = NULL;
+static QMGR_ADMISSION_WAITER *qmgr_Admission_waiters_tail = NULL;
+static int qmgr_Admission_num_running = 0;
+static int qmgr_Admission_num_waiting = 0;
+
+static bool qmgr_is_heavy_query (const XASL_NODE * xasl_p);
+static int qmgr_admit_heavy_query (THREAD_ENTRY * thread_p);
+static void qmgr_release_heavy_query (void);
 #endif
 
 static void qmgr_initialize_temp_file_list (QMGR_TEMP_FILE_LIST * temp_file_list_p,
@@ -179,6 +210,7 @@ static void qmgr_initialize_temp_file_list (QMGR_TEMP_FILE_LIST * temp_file_list
 static void qmgr_finalize_temp_file_list (QMGR_TEMP_FILE_LIST * temp_file_list_p);
 static QMGR_TEMP_FILE *qmgr_get_temp_file_from_list (QMGR_TEMP_FILE_LIST * temp_file_list_p);
 static void qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p);
+static PAGE_PTR qmgr_get_membuf_extension_page (QMGR_TEMP_FILE * tfile_vfid_p, VPID * vpid_p);
 
 static int copy_bind_value_to_tdes (THREAD_ENTRY * thread_p, int num_bind_vals, DB_VALUE * bind_vals);
 
@@ -194,11 +226,22 @@ static QMGR_PAGE_TYPE
 qmgr_get_page_type (PAGE_PTR page_p, QMGR_TEMP_FILE * temp_file_p)
 {
   PAGE_PTR begin_page = NULL, end_page = NULL;
+  int last_fixed;
 
-  if (temp_file_p != NULL && temp_file_p->membuf_last >= 0 && temp_file_p->membuf && page_p >= temp_file_p->membuf[0]
-      && page_p <= temp_file_p->membuf[temp_file_p->membuf_last])
+  if (temp_file_p != NULL && temp_file_p->membuf_last >= 0 && temp_file_p->membuf)
     {
-      return QMGR_MEMBUF_PAGE;
+      last_fixed = MIN (temp_file_p->membuf_last, temp_file_p->membuf_npages - 1);
+      if (page_p >= temp_file_p->membuf[0] && page_p <= temp_file_p->membuf[last_fixed])
+	{
+	  return QMGR_MEMBUF_PAGE;
+	}
+      if (temp_file_p->membuf_ext != NULL && temp_file_p->membuf_last >= temp_file_p->membuf_npages
+	  && page_p >= temp_file_p->membuf_ext
+	  && page_p <= (temp_file_p->membuf_ext
+			+ ((size_t) (temp_file_p->membuf_last - temp_file_p->membuf_npages) * DB_PAGESIZE)))
+	{
+	  return QMGR_MEMBUF_PAGE;
+	}
     }
 
   begin_page = (PAGE_PTR) ((PAGE_PTR) temp_file_p->membuf
@@ -897,6 +940,8 @@ qmgr_initialize (THREAD_ENTRY * thread_p)
   srand48_r ((long) t.tv_usec, &qmgr_rand_buf);
 #endif
 
+  cubquery::operator_monitor_register ();
+
   return scan_initialize ();
 }
 
@@ -1098,6 +1143,162 @@ exit_on_error:
   goto exit_on_end;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * qmgr_is_heavy_query () - classify a query by the optimizer's estimate of
+ *                          the data it may touch
+ *   return: true when the query must pass admission control
+ *   xasl_p(in): unpacked XASL tree
+ */
+static bool
+qmgr_is_heavy_query (const XASL_NODE * xasl_p)
+{
+  INT64 num_pages = 0;
+  int threshold = prm_get_integer_value (PRM_ID_HEAVY_QUERY_PAGE_THRESHOLD);
+  int i;
+
+  if (xasl_p->tcard_list == NULL)
+    {
+      return false;
+    }
+
+  for (i = 0; i < xasl_p->n_oid_list; i++)
+    {
+      if (xasl_p->tcard_list[i] > 0)
+	{
+	  num_pages += xasl_p->tcard_list[i];
+	}
+    }
+
+  return num_pages >= threshold;
+}
+
+/*
+ * qmgr_admit_heavy_query () - wait in FIFO order for a heavy query execution
+ *                             slot
+ *   return: NO_ERROR or ER_INTERRUPTED when the queued query is cancelled
+ *   thread_p(in):
+ */
+static int
+qmgr_admit_heavy_query (THREAD_ENTRY * thread_p)
+{
+  QMGR_ADMISSION_WAITER waiter;
+  QMGR_ADMISSION_WAITER **link_p;
+  struct timeval now;
+  struct timespec to;
+  int max_running;
+  bool continue_checking = true;
+  int rv;
+
+  waiter.next = NULL;
+
+  rv = pthread_mutex_lock (&qmgr_Admission_lock);
+  if (qmgr_Admission_waiters_tail != NULL)
+    {
+      qmgr_Admission_waiters_tail->next = &waiter;
+    }
+  else
+    {
+      qmgr_Admission_waiters_head = &waiter;
+    }
+  qmgr_Admission_waiters_tail = &waiter;
+  qmgr_Admission_num_waiting++;
+
+  while (true)
+    {
+      /* the limit is re-read every pass so it can be tuned at runtime */
+      max_running = prm_get_integer_value (PRM_ID_HEAVY_QUERY_MAX_CONCURRENCY);
+      if (qmgr_Admission_waiters_head == &waiter && (max_running <= 0 || qmgr_Admission_num_running < max_running))
+	{
+	  qmgr_Admission_waiters_head = waiter.next;
+	  if (qmgr_Admission_waiters_head == NULL)
+	    {
+	      qmgr_Admission_waiters_tail = NULL;
+	    }
+	  qmgr_Admission_num_waiting--;
+	  qmgr_Admission_num_running++;
+	  /* another slot may be free for the next waiter */
+	  pthread_cond_broadcast (&qmgr_Admission_cond);
+	  pthread_mutex_unlock (&qmgr_Admission_lock);
+	  return NO_ERROR;
+	}
+
+      gettimeofday (&now, NULL);
+      to.tv_sec = now.tv_sec;
+      to.tv_nsec = (now.tv_usec + 100000) * 1000;
+      if (to.tv_nsec >= 1000000000)
+	{
+	  to.tv_sec += 1;
+	  to.tv_nsec -= 1000000000;
+	}
+      (void) pthread_cond_timedwait (&qmgr_Admission_cond, &qmgr_Admission_lock, &to);
+
+      /* queued queries must stay cancellable */
+      pthread_mutex_unlock (&qmgr_Admission_lock);
+      if (logtb_is_interrupted (thread_p, true, &continue_checking) == true)
+	{
+	  rv = pthread_mutex_lock (&qmgr_Admission_lock);
+	  for (link_p = &qmgr_Admission_waiters_head; *link_p != NULL; link_p = &(*link_p)->next)
+	    {
+	      if (*link_p == &waiter)
+		{
+		  *link_p = waiter.next;
+		  break;
+		}
+	    }
+	  if (qmgr_Admission_waiters_tail == &waiter)
+	    {
+	      QMGR_ADMISSION_WAITER *last = qmgr_Admission_waiters_head;
+
+	      while (last != NULL && last->next != NULL)
+		{
+		  last = last->next;
+		}
+	      qmgr_Admission_waiters_tail = last;
+	    }
+	  qmgr_Admission_num_waiting--;
+	  pthread_cond_broadcast (&qmgr_Admission_cond);
+	  pthread_mutex_unlock (&qmgr_Admission_lock);
+
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	  return ER_INTERRUPTED;
+	}
+      rv = pthread_mutex_lock (&qmgr_Admission_lock);
+    }
+}
+
+/*
+ * qmgr_release_heavy_query () - return a heavy query execution slot
+ *   return: void
+ */
+static void
+qmgr_release_heavy_query (void)
+{
+  int rv;
+
+  rv = pthread_mutex_lock (&qmgr_Admission_lock);
+  qmgr_Admission_num_running--;
+  assert (qmgr_Admission_num_running >= 0);
+  pthread_cond_broadcast (&qmgr_Admission_cond);
+  pthread_mutex_unlock (&qmgr_Admission_lock);
+}
+#endif /* SERVER_MODE */
+
+/*
+ * qmgr_get_num_heavy_queries_waiting () - depth of the heavy query admission
+ *                                         queue, exposed as a peek statistic
+ *   return: number of queued queries
+ */
+int
+qmgr_get_num_heavy_queries_waiting (void)
+{
+#if defined (SERVER_MODE)
+  return qmgr_Admission_num_waiting;
+#else
+  return 0;
+#endif
+}
+
 /*
  * qmgr_process_query () - Execute a prepared query as sync mode
  *   return		   : query result file id
@@ -1126,6 +1327,12 @@ qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_s
   XASL_NODE *xasl_p;
   XASL_UNPACK_INFO *xasl_buf_info;
   QFILE_LIST_ID *list_id;
+  bool is_perf_tracking;
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
+#if defined (SERVER_MODE)
+  bool admitted = false;
+#endif
 
   assert (query_p != NULL);
   assert (tran_entry_p != NULL);
@@ -1171,11 +1378,43 @@ qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_s
       XASL_SET_FLAG (xasl_p, XASL_RETURN_GENERATED_KEYS);
     }
 
+#if defined (SERVER_MODE)
+  if (prm_get_integer_value (PRM_ID_HEAVY_QUERY_MAX_CONCURRENCY) > 0 && qmgr_is_heavy_query (xasl_p))
+    {
+      if (qmgr_admit_heavy_query (thread_p) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      admitted = true;
+    }
+#endif /* SERVER_MODE */
+
   /* execute the query with the value list, if any */
+  is_perf_tracking = perfmon_is_perf_tracking ();
+  if (is_perf_tracking)
+    {
+      tsc_getticks (&start_tick);
+    }
+
   query_p->list_id = qexec_execute_query (thread_p, xasl_p, dbval_count, dbvals_p, query_p->query_id);
   thread_p->no_logging = false;
   thread_p->no_supplemental_log = false;
 
+  if (is_perf_tracking)
+    {
+      tsc_getticks (&end_tick);
+      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+      perfmon_time_histogram (thread_p, PSTAT_QUERY_EXECUTE_TIME_HISTOGRAM,
+			      (UINT64) (tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec));
+    }
+
+#if defined (SERVER_MODE)
+  if (admitted)
+    {
+      qmgr_release_heavy_query ();
+    }
+#endif /* SERVER_MODE */
+
   /* Note: qexec_execute_query() returns listid (NOT NULL) even if an error was occurred. We should check the error
    * condition and free listid. */
   if (query_p->errid < 0)
@@ -2372,7 +2611,16 @@ qmgr_get_old_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
 
       if (vpid_p->pageid >= 0 && vpid_p->pageid <= tfile_vfid_p->membuf_last)
 	{
-	  page_p = tfile_vfid_p->membuf[vpid_p->pageid];
+	  if (vpid_p->pageid < tfile_vfid_p->membuf_npages)
+	    {
+	      page_p = tfile_vfid_p->membuf[vpid_p->pageid];
+	    }
+	  else
+	    {
+	      /* page lives in the in-memory extension of the buffer */
+	      page_p = (tfile_vfid_p->membuf_ext
+			+ (size_t) (vpid_p->pageid - tfile_vfid_p->membuf_npages) * DB_PAGESIZE);
+	    }
 
 	  /* interrupt check */
 #if defined (SERVER_MODE)
@@ -2480,6 +2728,58 @@ qmgr_set_dirty_page (THREAD_ENTRY * thread_p, PAGE_PTR page_p, int free_page, LO
 #endif
 }
 
+/*
+ * qmgr_get_membuf_extension_page () - Allocate a page from the in-memory
+ *				       extension of the temp file buffer
+ *   return: page pointer or NULL when the extension is disabled or full
+ *   tfile_vfid_p(in): tempfile_vfid struct pointer
+ *   vpid(out): Set to the allocated virtual page identifier
+ *
+ * Note: The extension keeps short-lived intermediate results entirely in
+ *	 memory past the small preallocated buffer, postponing the switch
+ *	 to temp volume pages (and the buffer pool traffic it entails)
+ *	 until temp_file_memory_extension_in_pages pages are in use. The
+ *	 chunk is allocated on first overflow and is freed when the temp
+ *	 file is retired; a failed allocation silently falls back to the
+ *	 regular temp file path.
+ */
+static PAGE_PTR
+qmgr_get_membuf_extension_page (QMGR_TEMP_FILE * tfile_vfid_p, VPID * vpid_p)
+{
+  QFILE_PAGE_HEADER pgheader = QFILE_PAGE_HEADER_INITIALIZER;
+  PAGE_PTR page_p;
+  int ext_npages, used_npages;
+
+  if (tfile_vfid_p->membuf_ext == NULL)
+    {
+      ext_npages = prm_get_integer_value (PRM_ID_TEMP_MEM_BUFFER_EXTENSION_PAGES);
+      if (ext_npages <= 0)
+	{
+	  return NULL;
+	}
+      tfile_vfid_p->membuf_ext = (PAGE_PTR) malloc ((size_t) ext_npages * DB_PAGESIZE);
+      if (tfile_vfid_p->membuf_ext == NULL)
+	{
+	  return NULL;
+	}
+      tfile_vfid_p->membuf_ext_npages = ext_npages;
+    }
+
+  used_npages = tfile_vfid_p->membuf_last + 1 - tfile_vfid_p->membuf_npages;
+  if (used_npages >= tfile_vfid_p->membuf_ext_npages)
+    {
+      return NULL;
+    }
+
+  page_p = tfile_vfid_p->membuf_ext + (size_t) used_npages * DB_PAGESIZE;
+  qmgr_put_page_header (page_p, &pgheader);
+
+  vpid_p->volid = NULL_VOLID;
+  vpid_p->pageid = ++(tfile_vfid_p->membuf_last);
+
+  return page_p;
+}
+
 /*
  * qmgr_get_new_page () -
  *   return: PAGE_PTR
@@ -2510,6 +2810,16 @@ qmgr_get_new_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
       return tfile_vfid_p->membuf[tfile_vfid_p->membuf_last];
     }
 
+  /* the preallocated buffer is full; extend it in memory before spilling to a temp file */
+  if (tfile_vfid_p->membuf != NULL && VFID_ISNULL (&tfile_vfid_p->temp_vfid))
+    {
+      page_p = qmgr_get_membuf_extension_page (tfile_vfid_p, vpid_p);
+      if (page_p != NULL)
+	{
+	  return page_p;
+	}
+    }
+
   /* memory buffer is exhausted; create temp file */
   if (VFID_ISNULL (&tfile_vfid_p->temp_vfid))
     {
@@ -2661,6 +2971,8 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
   tfile_vfid_p->temp_file_type = FILE_TEMP;
   tfile_vfid_p->membuf_npages = num_buffer_pages;
   tfile_vfid_p->membuf_type = membuf_type;
+  tfile_vfid_p->membuf_ext = NULL;
+  tfile_vfid_p->membuf_ext_npages = 0;
   tfile_vfid_p->preserved = false;
   tfile_vfid_p->tde_encrypted = false;
   tfile_vfid_p->membuf_last = -1;
@@ -2763,6 +3075,8 @@ qmgr_create_result_file (THREAD_ENTRY * thread_p, QUERY_ID query_id)
   tfile_vfid_p->membuf = NULL;
   tfile_vfid_p->membuf_npages = 0;
   tfile_vfid_p->membuf_type = TEMP_FILE_MEMBUF_NONE;
+  tfile_vfid_p->membuf_ext = NULL;
+  tfile_vfid_p->membuf_ext_npages = 0;
   tfile_vfid_p->preserved = false;
   tfile_vfid_p->tde_encrypted = false;
 
@@ -2833,6 +3147,44 @@ qmgr_create_result_file (THREAD_ENTRY * thread_p, QUERY_ID query_id)
   return tfile_vfid_p;
 }
 
+#if defined (SERVER_MODE)
+// *INDENT-OFF*
+/* qmgr_temp_file_retire_task - finishes retirement of temporary files already detached from their transaction.
+ *
+ * Retiring a large temporary result means deallocating all its pages, which can take hundreds of milliseconds and
+ * used to stall the session thread between statements. The session thread now only detaches the files from the
+ * transaction bookkeeping (cheap) and pushes this task on the internal tasks worker pool to do the page reclamation.
+ */
+class qmgr_temp_file_retire_task : public cubthread::entry_task
+{
+  public:
+    void
+    add_file (const VFID & vfid, FILE_TEMPCACHE_ENTRY * entry)
+    {
+      m_files.emplace_back (vfid, entry);
+    }
+
+    bool
+    empty () const
+    {
+      return m_files.empty ();
+    }
+
+    void
+    execute (cubthread::entry & thread_ref) final
+    {
+      for (auto & file : m_files)
+	{
+	  (void) file_temp_retire_detached (&thread_ref, &file.first, file.second);
+	}
+    }
+
+  private:
+    std::vector<std::pair<VFID, FILE_TEMPCACHE_ENTRY *>> m_files;
+};
+// *INDENT-ON*
+#endif /* SERVER_MODE */
+
 /*
  * qmgr_free_temp_file_list () - free temporary files in tfile_vfid_p
  * return : error code or NO_ERROR
@@ -2841,12 +3193,19 @@ qmgr_create_result_file (THREAD_ENTRY * thread_p, QUERY_ID query_id)
  * query_id (in)      : query id
  * is_error (in)      : true if query was unsuccessful
  * was_preserved (in) : true if query was preserved
+ *
+ * Note: In SERVER_MODE the expensive part of retirement (page reclamation) is handed to a background worker; only
+ *       the transaction bookkeeping is unlinked here.
  */
 int
 qmgr_free_temp_file_list (THREAD_ENTRY * thread_p, QMGR_TEMP_FILE * tfile_vfid_p, QUERY_ID query_id, bool is_error)
 {
   QMGR_TEMP_FILE *temp = NULL;
   int rc = NO_ERROR, fd_ret = NO_ERROR;
+#if defined (SERVER_MODE)
+  qmgr_temp_file_retire_task *retire_task = new qmgr_temp_file_retire_task ();
+  FILE_TEMPCACHE_ENTRY *tempcache_entry;
+#endif /* SERVER_MODE */
 
   /* make sure temp file list is not cyclic */
   assert (tfile_vfid_p->prev == NULL || tfile_vfid_p->prev->next == NULL);
@@ -2856,6 +3215,19 @@ qmgr_free_temp_file_list (THREAD_ENTRY * thread_p, QMGR_TEMP_FILE * tfile_vfid_p
       fd_ret = NO_ERROR;
       if ((tfile_vfid_p->temp_file_type != FILE_QUERY_AREA || is_error) && !VFID_ISNULL (&tfile_vfid_p->temp_vfid))
 	{
+#if defined (SERVER_MODE)
+	  tempcache_entry = NULL;
+	  fd_ret = file_temp_preretire (thread_p, &tfile_vfid_p->temp_vfid, tfile_vfid_p->preserved,
+					&tempcache_entry);
+	  if (fd_ret != NO_ERROR)
+	    {
+	      /* set error but continue with the destroy process */
+	      ASSERT_ERROR ();
+	      rc = ER_FAILED;
+	    }
+	  /* even without a temporary cache entry the file itself must still be reclaimed */
+	  retire_task->add_file (tfile_vfid_p->temp_vfid, tempcache_entry);
+#else /* !SERVER_MODE */
 	  if (tfile_vfid_p->preserved)
 	    {
 	      fd_ret = file_temp_retire_preserved (thread_p, &tfile_vfid_p->temp_vfid);
@@ -2876,6 +3248,7 @@ qmgr_free_temp_file_list (THREAD_ENTRY * thread_p, QMGR_TEMP_FILE * tfile_vfid_p
 		  rc = ER_FAILED;
 		}
 	    }
+#endif /* !SERVER_MODE */
 	}
 
       temp = tfile_vfid_p;
@@ -2891,6 +3264,17 @@ qmgr_free_temp_file_list (THREAD_ENTRY * thread_p, QMGR_TEMP_FILE * tfile_vfid_p
 	}
     }
 
+#if defined (SERVER_MODE)
+  if (retire_task->empty ())
+    {
+      delete retire_task;
+    }
+  else
+    {
+      cubthread::get_manager ()->push_task (cubthread::internal_tasks_worker_pool::get_instance (), retire_task);
+    }
+#endif /* SERVER_MODE */
+
   return rc;
 }
 
@@ -3320,6 +3704,13 @@ qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p)
 
   temp_file_p->membuf_last = -1;
 
+  if (temp_file_p->membuf_ext != NULL)
+    {
+      /* the extension is transient; recycled entries keep only the preallocated buffer */
+      free_and_init (temp_file_p->membuf_ext);
+      temp_file_p->membuf_ext_npages = 0;
+    }
+
   if (QMGR_IS_VALID_MEMBUF_TYPE (temp_file_p->membuf_type))
     {
       temp_file_list_p = &qmgr_Query_table.temp_file_list[temp_file_p->membuf_type];
@@ -83,6 +83,9 @@ struct qmgr_temp_file
   PAGE_PTR *membuf;
   int membuf_npages;
   QMGR_TEMP_FILE_MEMBUF_TYPE membuf_type;
+  PAGE_PTR membuf_ext;		/* contiguous extension of the memory buffer; allocated on first overflow and holds
+				 * pages membuf_npages .. membuf_npages + membuf_ext_npages - 1 */
+  int membuf_ext_npages;	/* capacity of the extension in pages; 0 when there is none */
   bool preserved;		/* if temp file is preserved */
   bool tde_encrypted;		/* whether the file of temp_vfid has to be encrypted when flushing (TDE) */
 };
@@ -174,5 +177,6 @@ extern int qmgr_get_sql_id (THREAD_ENTRY * thread_p, char **sql_id_buf, char *qu
 extern struct drand48_data *qmgr_get_rand_buf (THREAD_ENTRY * thread_p);
 extern QUERY_ID qmgr_get_current_query_id (THREAD_ENTRY * thread_p);
 extern char *qmgr_get_query_sql_user_text (THREAD_ENTRY * thread_p, QUERY_ID query_id, int tran_index);
+extern int qmgr_get_num_heavy_queries_waiting (void);
 
 #endif /* _QUERY_MANAGER_H_ */
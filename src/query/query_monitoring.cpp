@@ -0,0 +1,108 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// query_monitoring.cpp - global per-operator-class query statistics
+//
+
+#include "query_monitoring.hpp"
+
+#include "monitor_collect.hpp"
+#include "monitor_registration.hpp"
+
+#include <cassert>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <sys/time.h>
+
+namespace cubquery
+{
+  // one entry per monitored_operator_type. executions and elapsed time share a counter/timer statistic so the
+  // monitor also exposes the average; rows and page fixes are plain accumulators.
+  struct operator_monitor_entry
+  {
+    cubmonitor::atomic_counter_timer_stat execs_and_time;
+    cubmonitor::amount_accumulator_atomic_statistic rows;
+    cubmonitor::amount_accumulator_atomic_statistic page_fixes;
+  };
+
+  static operator_monitor_entry Operator_monitor_entries[MONITORED_OP_COUNT];
+
+  static const char *Operator_monitor_basenames[MONITORED_OP_COUNT] =
+  {
+    "query_scan_ops",
+    "query_join_ops",
+    "query_sort_ops",
+    "query_aggregate_ops"
+  };
+
+  static cubmonitor::time_rep
+  operator_monitor_convert_timeval (const struct timeval &tv)
+  {
+    return std::chrono::duration_cast<cubmonitor::time_rep> (std::chrono::seconds (tv.tv_sec)
+	   + std::chrono::microseconds (tv.tv_usec));
+  }
+
+  void
+  operator_monitor_add (monitored_operator_type op_type, const struct timeval &elapsed, UINT64 rows,
+			UINT64 page_fixes)
+  {
+    assert (op_type >= 0 && op_type < MONITORED_OP_COUNT);
+    operator_monitor_entry &entry = Operator_monitor_entries[op_type];
+
+    entry.execs_and_time.time_and_increment (operator_monitor_convert_timeval (elapsed));
+    entry.rows.collect (rows);
+    entry.page_fixes.collect (page_fixes);
+  }
+
+  void
+  operator_monitor_register (void)
+  {
+    static bool registered = false;
+
+    if (registered)
+      {
+	// the monitor does not support unregistering; keep the statistics registered once
+	return;
+      }
+    registered = true;
+
+    cubmonitor::monitor &mon = cubmonitor::get_global_monitor ();
+
+    for (int op = 0; op < MONITORED_OP_COUNT; op++)
+      {
+	operator_monitor_entry &entry = Operator_monitor_entries[op];
+
+	// registers Num_, Total_time_ and Avg_time_ statistics
+	entry.execs_and_time.register_to_monitor (mon, Operator_monitor_basenames[op]);
+
+	std::vector<std::string> names;
+	names.push_back (std::string ("Num_") + Operator_monitor_basenames[op] + "_rows");
+	names.push_back (std::string ("Num_") + Operator_monitor_basenames[op] + "_page_fixes");
+
+	auto fetch_func = [&entry] (cubmonitor::statistic_value *destination, cubmonitor::fetch_mode mode)
+	{
+	  entry.rows.fetch (destination, mode);
+	  entry.page_fixes.fetch (destination + 1, mode);
+	};
+	mon.register_statistics (2, fetch_func, names);
+      }
+  }
+} // namespace cubquery
@@ -36,4 +36,37 @@ struct tran_query_exec_info
   XASL_ID xasl_id;
 };
 
+#if defined (SERVER_MODE) || defined (SA_MODE)
+// *INDENT-OFF*
+namespace cubquery
+{
+  //
+  // operator monitor - global per-operator-class statistics surfaced through the cubmonitor framework.
+  //
+  // each scan/join/sort/aggregate node already accumulates elapsed time, row counts and page fixes into its own
+  // XASL/SCAN structures while the query runs (see xasl_stat, scan_stats). the operator monitor does not add any
+  // per-tuple work; the per-node counters are folded into global atomic statistics only once, when the operator
+  // finishes.
+  //
+
+  enum monitored_operator_type
+  {
+    MONITORED_OP_SCAN = 0,
+    MONITORED_OP_JOIN,
+    MONITORED_OP_SORT,
+    MONITORED_OP_AGGREGATE,
+
+    MONITORED_OP_COUNT
+  };
+
+  // fold one finished operator execution into the global statistics
+  void operator_monitor_add (monitored_operator_type op_type, const struct timeval &elapsed, UINT64 rows,
+			     UINT64 page_fixes);
+
+  // register the operator statistics to cubmonitor::get_global_monitor (); safe to call more than once
+  void operator_monitor_register (void);
+} // namespace cubquery
+// *INDENT-ON*
+#endif // SERVER_MODE || SA_MODE
+
 #endif // !_QUERY_MONITORING_HPP_
@@ -135,6 +135,10 @@ regu_variable_node::clear_xasl_local ()
 	{
 	  free_and_init (value.arithptr->rand_seed);
 	}
+      if (value.arithptr->date_fmt_cache != NULL)
+	{
+	  qstr_free_date_fmt_cache (&value.arithptr->date_fmt_cache);
+	}
       if (value.arithptr->pred != NULL)
 	{
 	  value.arithptr->pred->clear_xasl ();
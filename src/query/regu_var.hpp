@@ -134,6 +134,9 @@ struct arith_list_node
 
   /* NOTE: The following member is only used on server internally. */
   struct drand48_data *rand_seed;	/* seed to be used to generate pseudo-random sequence */
+
+  TP_CAST_CACHE cast_cache;	/* memoized coercion plan for cast opcodes; resolved at first execution */
+  QSTR_DATE_FMT_CACHE *date_fmt_cache;	/* compiled TO_CHAR date/time format; built at first execution */
 };
 
 typedef struct function_node FUNCTION_TYPE;
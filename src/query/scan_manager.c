@@ -50,6 +50,7 @@
 #include "xasl_predicate.hpp"
 #include "xasl.h"
 #include "query_hash_scan.h"
+#include "page_buffer.h"
 
 #if !defined(SERVER_MODE)
 #define pthread_mutex_init(a, b)
@@ -148,6 +149,7 @@ static int scan_init_indx_coverage (THREAD_ENTRY * thread_p, int coverage_enable
 				    int max_key_len, int func_index_col_id, INDX_COV * indx_cov);
 static int scan_alloc_oid_list (BTREE_ISCAN_OID_LIST ** oid_list_p);
 static int scan_alloc_iscan_oid_buf_list (BTREE_ISCAN_OID_LIST ** oid_list);
+static void scan_prefetch_iscan_heap_pages (THREAD_ENTRY * thread_p, const OID * sorted_oids, int oids_count);
 static void scan_free_iscan_oid_buf_list (BTREE_ISCAN_OID_LIST * oid_list);
 static void rop_to_range (RANGE * range, ROP_TYPE left, ROP_TYPE right);
 static void range_to_rop (ROP_TYPE * left, ROP_TYPE * rightk, RANGE range);
@@ -169,7 +171,9 @@ static void scan_init_scan_id (SCAN_ID * scan_id, bool force_select_lock, SCAN_O
 			       val_list_node * val_list, VAL_DESCR * vd);
 static int scan_init_index_key_limit (THREAD_ENTRY * thread_p, INDX_SCAN_ID * isidp, KEY_INFO * key_infop,
 				      VAL_DESCR * vd);
+static QP_SCAN_FUNC scan_resolve_next_scan_fnc (SCAN_ID * scan_id);
 static SCAN_CODE scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static void scan_start_synchronized_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_heap_page_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_class_attr_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
@@ -206,6 +210,9 @@ static SCAN_CODE scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * s
 static SCAN_CODE scan_next_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE * tuple);
 static HASH_METHOD check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_type);
+static void scan_alloc_hash_list_scan_bloom (THREAD_ENTRY * thread_p, HASH_LIST_SCAN * hlsid, int tuple_cnt);
+static void scan_hash_list_scan_bloom_set (HASH_LIST_SCAN * hlsid, unsigned int hash_key);
+static bool scan_hash_list_scan_bloom_test (HASH_LIST_SCAN * hlsid, unsigned int hash_key);
 
 /*
  * scan_init_iss () - initialize index skip scan structure
@@ -995,6 +1002,43 @@ scan_free_oid_list (BTREE_ISCAN_OID_LIST * oid_list_p)
   free_and_init (oid_list_p);
 }
 
+/* largest number of distinct heap pages prefetched after sorting an index scan's OID buffer */
+#define SCAN_ISCAN_PREFETCH_PAGES 64
+
+/*
+ * scan_prefetch_iscan_heap_pages () - Start reading the heap pages an index scan is about to fetch objects from.
+ *
+ * return	    : void
+ * thread_p (in)    : thread entry
+ * sorted_oids (in) : OID buffer sorted by heap position
+ * oids_count (in)  : number of OIDs in buffer
+ *
+ * Note: the distinct heap pages of the sorted buffer are handed to the page buffer read-ahead, so the per-object
+ *	 fetches that follow find them already materialized instead of paying one disk read per page.
+ */
+static void
+scan_prefetch_iscan_heap_pages (THREAD_ENTRY * thread_p, const OID * sorted_oids, int oids_count)
+{
+  VPID vpids[SCAN_ISCAN_PREFETCH_PAGES];
+  int i, n = 0;
+
+  for (i = 0; i < oids_count && n < SCAN_ISCAN_PREFETCH_PAGES; i++)
+    {
+      if (n > 0 && vpids[n - 1].pageid == sorted_oids[i].pageid && vpids[n - 1].volid == sorted_oids[i].volid)
+	{
+	  continue;
+	}
+      vpids[n].volid = sorted_oids[i].volid;
+      vpids[n].pageid = sorted_oids[i].pageid;
+      n++;
+    }
+
+  if (n > 1)
+    {
+      (void) pgbuf_prefetch_range (thread_p, vpids, n);
+    }
+}
+
 /*
  * scan_alloc_iscan_oid_buf_list () - Allocate or use a preallocated buffer for index scan OID list.
  *
@@ -2333,6 +2377,11 @@ scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_
 	}
 
       iscan_id->multi_range_opt.cnt = 0;
+      if (iscan_id->multi_range_opt.heap != NULL)
+	{
+	  /* the next candidate key rebuilds the heap property from scratch */
+	  iscan_id->multi_range_opt.heap->element_count = 0;
+	}
     }
 
   /* if the end of this scan */
@@ -2690,9 +2739,34 @@ scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_
 
   /* When covering index is used, 'index_scan_in_oid_order' parameter is ignored. */
   if (iscan_id->oid_list != NULL && iscan_id->oid_list->oidp != NULL && iscan_id->oids_count > 1
-      && iscan_id->iscan_oid_order == true && iscan_id->need_count_only == false)
+      && iscan_id->need_count_only == false)
     {
-      qsort (iscan_id->oid_list->oidp, iscan_id->oids_count, sizeof (OID), oid_compare);
+      if (iscan_id->iscan_oid_order == true)
+	{
+	  qsort (iscan_id->oid_list->oidp, iscan_id->oids_count, sizeof (OID), oid_compare);
+	  scan_prefetch_iscan_heap_pages (thread_p, iscan_id->oid_list->oidp, iscan_id->oids_count);
+	}
+      else
+	{
+	  /* The plan consumes the OIDs in key order, so the buffer itself must stay as the index produced it. Sort a
+	   * scratch copy by heap position and feed that to the read-ahead: the per-object fetches below still run in
+	   * key order but find their heap pages already in the buffer pool. Best effort only; without the scratch
+	   * buffer the scan simply reads synchronously as before.
+	   */
+	  OID *sorted_oidp = (OID *) db_private_alloc (thread_p, iscan_id->oids_count * sizeof (OID));
+
+	  if (sorted_oidp != NULL)
+	    {
+	      memcpy (sorted_oidp, iscan_id->oid_list->oidp, iscan_id->oids_count * sizeof (OID));
+	      qsort (sorted_oidp, iscan_id->oids_count, sizeof (OID), oid_compare);
+	      scan_prefetch_iscan_heap_pages (thread_p, sorted_oidp, iscan_id->oids_count);
+	      db_private_free_and_init (thread_p, sorted_oidp);
+	    }
+	  else
+	    {
+	      er_clear ();
+	    }
+	}
     }
 
 end:
@@ -2706,6 +2780,13 @@ end:
   /* if the end of this scan */
   if (iscan_id->curr_keyno == key_cnt)
     {
+      if (iscan_id->multi_range_opt.use && iscan_id->multi_range_opt.heap != NULL
+	  && iscan_id->multi_range_opt.heap->state != BH_SORTED_ARRAY)
+	{
+	  /* all ranges are merged; order the retained top N keys once, instead of keeping them sorted while
+	   * collecting */
+	  bh_to_sorted_array (iscan_id->multi_range_opt.heap);
+	}
       for (i = 0; i < key_cnt; i++)
 	{
 	  pr_clear_value (&key_vals[i].key1);
@@ -2778,6 +2859,7 @@ scan_init_scan_id (SCAN_ID * scan_id, bool mvcc_select_lock_needed, SCAN_OPERATI
   /* value list and descriptor */
   scan_id->val_list = val_list;	/* points to the XASL tree */
   scan_id->vd = vd;		/* set value descriptor pointer */
+  scan_id->next_scan_fnc = NULL;	/* resolved on the first fetch */
   scan_id->scan_immediately_stop = false;
 }
 
@@ -2844,6 +2926,12 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* OID within the heap */
   UT_CAST_TO_NULL_HEAP_OID (&hsidp->hfid, &hsidp->curr_oid);
 
+  /* synchronized scan state; a start position is chosen on the first fetch, once the scan cache is ready */
+  VPID_SET_NULL (&hsidp->ssc_start_vpid);
+  VPID_SET_NULL (&hsidp->ssc_last_vpid);
+  hsidp->ssc_wrapped = false;
+  hsidp->ssc_publish = false;
+
   /* scan predicates */
   scan_init_scan_pred (&hsidp->scan_pred, regu_list_pred, pr,
 		       ((pr) ? eval_fnc (thread_p, pr, &single_node_type) : NULL));
@@ -2962,6 +3050,12 @@ scan_open_class_attr_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* OID within the heap */
   UT_CAST_TO_NULL_HEAP_OID (&hsidp->hfid, &hsidp->curr_oid);
 
+  /* synchronized scan state; a start position is chosen on the first fetch, once the scan cache is ready */
+  VPID_SET_NULL (&hsidp->ssc_start_vpid);
+  VPID_SET_NULL (&hsidp->ssc_last_vpid);
+  hsidp->ssc_wrapped = false;
+  hsidp->ssc_publish = false;
+
   /* scan predicates */
   scan_init_scan_pred (&hsidp->scan_pred, regu_list_pred, pr,
 		       ((pr) ? eval_fnc (thread_p, pr, &single_node_type) : NULL));
@@ -3694,11 +3788,16 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* regulator variable list for other than predicates */
   llsidp->rest_regu_list = regu_list_rest;
 
+  /* late-bound domains are resolved on the first fetch */
+  llsidp->domains_resolved = false;
+
   /* init for hash list scan */
   /* regulator variable list for build, probe */
   llsidp->hlsid.build_regu_list = regu_list_build;
   llsidp->hlsid.probe_regu_list = regu_list_probe;
   llsidp->hlsid.need_coerce_type = false;
+  llsidp->hlsid.bloom_bits = NULL;
+  llsidp->hlsid.bloom_bit_mask = 0;
 
   /* check if hash list scan is possible? */
   llsidp->hlsid.hash_list_scan_type = check_hash_list_scan (llsidp, &val_cnt, hash_list_scan_yn);
@@ -3738,6 +3837,8 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
       /* alloc temp key */
       llsidp->hlsid.temp_key = qdata_alloc_hscan_key (thread_p, val_cnt, false);
       llsidp->hlsid.temp_new_key = qdata_alloc_hscan_key (thread_p, val_cnt, true);
+      /* alloc bloom filter; filled during the build scan */
+      scan_alloc_hash_list_scan_bloom (thread_p, &llsidp->hlsid, llsidp->list_id->tuple_cnt);
       if (scan_start_scan (thread_p, scan_id) != NO_ERROR)
 	{
 	  return S_ERROR;
@@ -4135,6 +4236,15 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    }
 	  hsidp->caches_inited = true;
 	}
+      if (hsidp->scancache_inited && scan_id->type == S_HEAP_SCAN && scan_id->scan_op_type == S_SELECT
+	  && !scan_id->mvcc_select_lock_needed)
+	{
+	  /* Read-only scan that touches the record data only through the two attribute caches: let the heap layer copy
+	   * just the record prefix those caches need instead of the whole record. This matters for wide classes when
+	   * the scan is not a fixed scan and every row is copied out of the page. */
+	  heap_scancache_set_partial_fetch (&hsidp->scan_cache, hsidp->pred_attrs.attr_cache,
+					    hsidp->rest_attrs.attr_cache);
+	}
       break;
 
     case S_HEAP_PAGE_SCAN:
@@ -4870,16 +4980,13 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 		  db_private_free_and_init (thread_p, isidp->multi_range_opt.top_n_items[i]);
 		}
 	    }
-	  db_private_free_and_init (thread_p, isidp->multi_range_opt.top_n_items);
+	  /* top_n_items is owned by the heap */
+	  bh_destroy (thread_p, isidp->multi_range_opt.heap);
+	  isidp->multi_range_opt.heap = NULL;
 	  isidp->multi_range_opt.top_n_items = NULL;
 	  db_private_free_and_init (thread_p, isidp->multi_range_opt.tplrec.tpl);
 	  isidp->multi_range_opt.tplrec.tpl = 0;
 	}
-      /* free buffer */
-      if (isidp->multi_range_opt.buffer != NULL)
-	{
-	  db_private_free_and_init (thread_p, isidp->multi_range_opt.buffer);
-	}
       if (isidp->multi_range_opt.sort_att_idx != NULL)
 	{
 	  db_private_free_and_init (thread_p, isidp->multi_range_opt.sort_att_idx);
@@ -4927,6 +5034,11 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  qdata_free_hscan_key (thread_p, llsidp->hlsid.temp_new_key, llsidp->hlsid.temp_new_key->val_count);
 	  llsidp->hlsid.temp_new_key = NULL;
 	}
+      /* free bloom filter */
+      if (llsidp->hlsid.bloom_bits != NULL)
+	{
+	  db_private_free_and_init (thread_p, llsidp->hlsid.bloom_bits);
+	}
       break;
 
     case S_SHOWSTMT_SCAN:
@@ -5059,97 +5171,108 @@ call_get_next_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, INDX_SCA
 }
 
 /*
- * scan_next_scan_local () - The scan is moved to the next scan item.
- *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
- *   scan_id(in/out): Scan identifier
+ * scan_resolve_next_scan_fnc () - resolve the scan advance function from the scan type
+ *   return: scan advance function, or NULL for an invalid scan type
+ *   scan_id(in): Scan identifier
  *
- * Note: If there are no more scan items, S_END is returned. If an error occurs, S_ERROR is returned.
+ * Note: Resolved once per scan and cached in the scan identifier, so the
+ *       per-tuple fetch path dispatches through one indirect call instead of
+ *       re-deciding the scan type for every tuple.
  */
-static SCAN_CODE
-scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+static QP_SCAN_FUNC
+scan_resolve_next_scan_fnc (SCAN_ID * scan_id)
 {
-  SCAN_CODE status;
-  bool on_trace;
-  UINT64 old_fetches = 0, old_ioreads = 0;
-  TSC_TICKS start_tick, end_tick;
-  TSCTIMEVAL tv_diff;
-
-  on_trace = thread_is_on_trace (thread_p);
-  if (on_trace)
-    {
-      tsc_getticks (&start_tick);
-
-      old_fetches = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES);
-      old_ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS);
-    }
-
   switch (scan_id->type)
     {
     case S_HEAP_SCAN:
     case S_HEAP_SCAN_RECORD_INFO:
-      status = scan_next_heap_scan (thread_p, scan_id);
-      break;
+      return scan_next_heap_scan;
 
     case S_HEAP_PAGE_SCAN:
-      status = scan_next_heap_page_scan (thread_p, scan_id);
-      break;
+      return scan_next_heap_page_scan;
 
     case S_CLASS_ATTR_SCAN:
-      status = scan_next_class_attr_scan (thread_p, scan_id);
-      break;
+      return scan_next_class_attr_scan;
 
     case S_INDX_SCAN:
-      status = scan_next_index_scan (thread_p, scan_id);
-      break;
+      return scan_next_index_scan;
 
     case S_INDX_KEY_INFO_SCAN:
-      status = scan_next_index_key_info_scan (thread_p, scan_id);
-      break;
+      return scan_next_index_key_info_scan;
 
     case S_INDX_NODE_INFO_SCAN:
-      status = scan_next_index_node_info_scan (thread_p, scan_id);
-      break;
+      return scan_next_index_node_info_scan;
 
     case S_LIST_SCAN:
       if (scan_id->s.llsid.hlsid.hash_list_scan_type != HASH_METH_NOT_USE)
 	{
-	  status = scan_next_hash_list_scan (thread_p, scan_id);
+	  return scan_next_hash_list_scan;
 	}
       else
 	{
-	  status = scan_next_list_scan (thread_p, scan_id);
+	  return scan_next_list_scan;
 	}
-      break;
 
     case S_SHOWSTMT_SCAN:
-      status = scan_next_showstmt_scan (thread_p, scan_id);
-      break;
+      return scan_next_showstmt_scan;
 
     case S_VALUES_SCAN:
-      status = scan_next_value_scan (thread_p, scan_id);
-      break;
+      return scan_next_value_scan;
 
     case S_SET_SCAN:
-      status = scan_next_set_scan (thread_p, scan_id);
-      break;
+      return scan_next_set_scan;
 
     case S_JSON_TABLE_SCAN:
-      status = scan_next_json_table_scan (thread_p, scan_id);
-      break;
+      return scan_next_json_table_scan;
 
     case S_METHOD_SCAN:
-      status = scan_next_method_scan (thread_p, scan_id);
-      break;
+      return scan_next_method_scan;
 
     case S_DBLINK_SCAN:
-      status = scan_next_dblink_scan (thread_p, scan_id);
-      break;
+      return scan_next_dblink_scan;
 
     default:
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      return S_ERROR;
+      return NULL;
+    }
+}
+
+/*
+ * scan_next_scan_local () - The scan is moved to the next scan item.
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   scan_id(in/out): Scan identifier
+ *
+ * Note: If there are no more scan items, S_END is returned. If an error occurs, S_ERROR is returned.
+ */
+static SCAN_CODE
+scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  SCAN_CODE status;
+  bool on_trace;
+  UINT64 old_fetches = 0, old_ioreads = 0;
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
+
+  if (scan_id->next_scan_fnc == NULL)
+    {
+      scan_id->next_scan_fnc = scan_resolve_next_scan_fnc (scan_id);
+      if (scan_id->next_scan_fnc == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+	  return S_ERROR;
+	}
+    }
+
+  on_trace = thread_is_on_trace (thread_p);
+  if (on_trace)
+    {
+      tsc_getticks (&start_tick);
+
+      old_fetches = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES);
+      old_ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS);
     }
 
+  status = (*scan_id->next_scan_fnc) (thread_p, scan_id);
+
   if (on_trace)
     {
       tsc_getticks (&end_tick);
@@ -5169,6 +5292,57 @@ typedef enum
   OBJ_REPEAT_GET_WITH_LOCK = 1,
   OBJ_GET_WITH_LOCK_COMPLETE = 2
 } OBJECT_GET_STATUS;
+
+/*
+ * scan_start_synchronized_scan () - Attach a (re)starting heap scan to a
+ *				     scan already in progress on the same heap
+ *   scan_id(in/out): Scan identifier; curr_oid must be at the null position
+ *
+ * Note: Only plain forward scans of non-reusable heaps take part: pages of
+ *	 FILE_HEAP files are never deallocated (their slots are permanent
+ *	 OID addresses), so a scan that starts in the middle of the page
+ *	 chain can safely wrap around and stop when it reaches its start
+ *	 page again. The attach position comes from the hint published by
+ *	 the most advanced concurrent scan of the heap; when there is none,
+ *	 the scan runs from the first page and merely publishes its own
+ *	 position.
+ */
+static void
+scan_start_synchronized_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  VPID start_vpid;
+
+  VPID_SET_NULL (&hsidp->ssc_start_vpid);
+  VPID_SET_NULL (&hsidp->ssc_last_vpid);
+  hsidp->ssc_wrapped = false;
+  hsidp->ssc_publish = false;
+
+  if (!prm_get_bool_value (PRM_ID_SYNCHRONIZED_HEAP_SCAN))
+    {
+      return;
+    }
+
+  if (!hsidp->scancache_inited || hsidp->scan_cache.file_type != FILE_HEAP)
+    {
+      /* pages of FILE_HEAP_REUSE_SLOTS heaps can be deallocated while we scan, which would break the wrap-around
+       * stop condition */
+      return;
+    }
+
+  hsidp->ssc_publish = true;
+
+  heap_sync_scan_get_start (thread_p, &hsidp->hfid, &hsidp->cls_oid, &start_vpid);
+  if (!VPID_ISNULL (&start_vpid))
+    {
+      /* start scanning from the published position; the stretch we skip is delivered after the wrap-around */
+      hsidp->ssc_start_vpid = start_vpid;
+      hsidp->curr_oid.volid = start_vpid.volid;
+      hsidp->curr_oid.pageid = start_vpid.pageid;
+      hsidp->curr_oid.slotid = 0;	/* i.e., will get slot 1 */
+    }
+}
+
 /*
  * scan_next_heap_scan () - The scan is moved to the next heap scan item.
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
@@ -5204,6 +5378,13 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       p_current_oid = &hsidp->curr_oid;
     }
 
+  if (hsidp->curr_oid.pageid == NULL_PAGEID && scan_id->type == S_HEAP_SCAN && scan_id->direction == S_FORWARD
+      && !scan_id->grouped && !scan_id->mvcc_select_lock_needed)
+    {
+      /* the scan is (re)starting from the top of the heap; decide whether it takes part in synchronized scanning */
+      scan_start_synchronized_scan (thread_p, scan_id);
+    }
+
   /* set data filter information */
   scan_init_filter_info (&data_filter, &hsidp->scan_pred, &hsidp->pred_attrs, scan_id->val_list, scan_id->vd,
 			 &hsidp->cls_oid, 0, NULL, NULL, NULL);
@@ -5246,9 +5427,19 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	      /* move forward */
 	      if (scan_id->type == S_HEAP_SCAN)
 		{
-		  sp_scan =
-		    heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes, &hsidp->scan_cache,
-			       is_peeking);
+		  if (hsidp->ssc_wrapped)
+		    {
+		      /* wrapped synchronized scan: end where we attached */
+		      sp_scan =
+			heap_next_until_page (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes,
+					      &hsidp->scan_cache, is_peeking, &hsidp->ssc_start_vpid);
+		    }
+		  else
+		    {
+		      sp_scan =
+			heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes,
+				   &hsidp->scan_cache, is_peeking);
+		    }
 		}
 	      else
 		{
@@ -5279,10 +5470,29 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 
       if (sp_scan != S_SUCCESS)
 	{
+	  if (sp_scan == S_END && !VPID_ISNULL (&hsidp->ssc_start_vpid) && !hsidp->ssc_wrapped)
+	    {
+	      /* a synchronized scan attached in the middle of the heap; wrap around to the first page and deliver
+	       * the stretch that precedes the attach position */
+	      hsidp->ssc_wrapped = true;
+	      hsidp->ssc_publish = false;	/* our position is of no use to scans arriving from now on */
+	      UT_CAST_TO_NULL_HEAP_OID (&hsidp->hfid, &hsidp->curr_oid);
+	      continue;
+	    }
 	  /* scan error or end of scan */
 	  return (sp_scan == S_END) ? S_END : S_ERROR;
 	}
 
+      if (hsidp->ssc_publish
+	  && (hsidp->curr_oid.pageid != hsidp->ssc_last_vpid.pageid
+	      || hsidp->curr_oid.volid != hsidp->ssc_last_vpid.volid))
+	{
+	  /* crossed onto a new page; publish it for scans that may arrive while we run */
+	  hsidp->ssc_last_vpid.pageid = hsidp->curr_oid.pageid;
+	  hsidp->ssc_last_vpid.volid = hsidp->curr_oid.volid;
+	  heap_sync_scan_publish (&hsidp->hfid, &hsidp->ssc_last_vpid);
+	}
+
       if (hsidp->scan_cache.page_watcher.pgptr != NULL)
 	{
 	  LSA_COPY (&ref_lsa, pgbuf_get_lsa (hsidp->scan_cache.page_watcher.pgptr));
@@ -6437,13 +6647,18 @@ scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   tplrec.size = 0;
   tplrec.tpl = (QFILE_TUPLE) NULL;
 
-  resolve_domains_on_list_scan (llsidp, scan_id->val_list);
+  if (!llsidp->domains_resolved)
+    {
+      /* the list file domains do not change while the scan is open; resolve them once, not once per tuple */
+      resolve_domains_on_list_scan (llsidp, scan_id->val_list);
+      llsidp->domains_resolved = true;
+    }
 
   while ((qp_scan = qfile_scan_list_next (thread_p, &llsidp->lsid, &tplrec, PEEK)) == S_SUCCESS)
     {
 
       /* fetch the values for the predicate from the tuple */
-      if (scan_id->val_list)
+      if (scan_id->val_list && llsidp->scan_pred.regu_list != NULL)
 	{
 	  if (fetch_val_list (thread_p, llsidp->scan_pred.regu_list, scan_id->vd, NULL, NULL, tplrec.tpl, PEEK) !=
 	      NO_ERROR)
@@ -6506,7 +6721,7 @@ scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       scan_id->scan_stats.qualified_rows++;
 
       /* fetch the rest of the values from the tuple */
-      if (scan_id->val_list)
+      if (scan_id->val_list && llsidp->rest_regu_list != NULL)
 	{
 	  if (fetch_val_list (thread_p, llsidp->rest_regu_list, scan_id->vd, NULL, NULL, tplrec.tpl, PEEK) != NO_ERROR)
 	    {
@@ -7653,20 +7868,10 @@ scan_init_multi_range_optimization (THREAD_ENTRY * thread_p, MULTI_RANGE_OPT * m
       multi_range_opt->is_desc_order = NULL;
       multi_range_opt->num_attrs = 0;
 
-      multi_range_opt->top_n_items =
-	(RANGE_OPT_ITEM **) db_private_alloc (thread_p, max_size * sizeof (RANGE_OPT_ITEM *));
-      if (multi_range_opt->top_n_items == NULL)
-	{
-	  err = ER_OUT_OF_VIRTUAL_MEMORY;
-	  goto exit_on_error;
-	}
-      multi_range_opt->buffer = (RANGE_OPT_ITEM **) db_private_alloc (thread_p, max_size * sizeof (RANGE_OPT_ITEM *));
-      if (multi_range_opt->buffer == NULL)
-	{
-	  err = ER_OUT_OF_VIRTUAL_MEMORY;
-	  goto exit_on_error;
-	}
-      memset (multi_range_opt->top_n_items, 0, max_size * sizeof (RANGE_OPT_ITEM *));
+      /* the heap holding the top N items is created together with the first candidate key, when the sort information
+       * is known */
+      multi_range_opt->heap = NULL;
+      multi_range_opt->top_n_items = NULL;
 
       multi_range_opt->tplrec.size = 0;
       multi_range_opt->tplrec.tpl = NULL;
@@ -7675,19 +7880,6 @@ scan_init_multi_range_optimization (THREAD_ENTRY * thread_p, MULTI_RANGE_OPT * m
     }
 
   return err;
-
-exit_on_error:
-
-  if (multi_range_opt->top_n_items != NULL)
-    {
-      db_private_free_and_init (thread_p, multi_range_opt->top_n_items);
-    }
-  if (multi_range_opt->buffer != NULL)
-    {
-      db_private_free_and_init (thread_p, multi_range_opt->buffer);
-    }
-
-  return err;
 }
 
 /*
@@ -7986,7 +8178,11 @@ scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   tplrec.size = 0;
   tplrec.tpl = (QFILE_TUPLE) NULL;
 
-  resolve_domains_on_list_scan (llsidp, scan_id->val_list);
+  if (!llsidp->domains_resolved)
+    {
+      resolve_domains_on_list_scan (llsidp, scan_id->val_list);
+      llsidp->domains_resolved = true;
+    }
 
   while ((qp_scan = qfile_scan_list_next (thread_p, &llsidp->lsid, &tplrec, PEEK)) == S_SUCCESS)
     {
@@ -8023,6 +8219,11 @@ scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       /* make hash key */
       hash_key = qdata_hash_scan_key (new_key, UINT_MAX, llsidp->hlsid.hash_list_scan_type);
 
+      if (llsidp->hlsid.bloom_bits != NULL)
+	{
+	  scan_hash_list_scan_bloom_set (&llsidp->hlsid, hash_key);
+	}
+
       switch (llsidp->hlsid.hash_list_scan_type)
 	{
 	case HASH_METH_IN_MEM:
@@ -8205,6 +8406,13 @@ scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE *
       hash_key = qdata_hash_scan_key (key, UINT_MAX, llsidp->hlsid.hash_list_scan_type);
       llsidp->hlsid.curr_hash_key = hash_key;
 
+      if (llsidp->hlsid.bloom_bits != NULL && !scan_hash_list_scan_bloom_test (&llsidp->hlsid, hash_key))
+	{
+	  /* the key is certainly not on the build side; skip the hash table lookup (for the file hash method this
+	   * also skips the directory and bucket page reads) */
+	  return S_END;
+	}
+
       switch (llsidp->hlsid.hash_list_scan_type)
 	{
 	case HASH_METH_IN_MEM:
@@ -8361,7 +8569,7 @@ check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_y
   int build_cnt;
   regu_variable_list_node *build, *probe;
   DB_TYPE vtype1, vtype2;
-  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE);
+  UINT64 mem_limit = sysprm_get_hot_params ()->max_hash_list_scan_size;
 
   assert (hash_list_scan_yn == 0 || hash_list_scan_yn == 1);
   /* no_hash_list_scan sql hint check */
@@ -8437,3 +8645,82 @@ check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_y
 
   return HASH_METH_NOT_USE;
 }
+
+/* around 8 filter bits per build key gives a false positive rate of a few percent with two probe bits */
+#define HASH_LIST_SCAN_BLOOM_BITS_PER_KEY 8
+#define HASH_LIST_SCAN_BLOOM_MIN_BITS 1024
+
+/*
+ * scan_alloc_hash_list_scan_bloom () - allocate the bloom filter for a hash list scan build
+ *   return: void
+ *   hlsid (in/out): hash list scan structure
+ *   tuple_cnt (in): number of tuples of the build side list file
+ *
+ * Note: The filter rejects probe keys that cannot be in the hash table before
+ *       the table (or, for the file hash method, its pages) is touched. It is
+ *       an optimization only: when the allocation fails the filter is simply
+ *       not used. The filter size is capped by max_hash_list_scan_size, so a
+ *       huge build side degrades the false positive rate instead of the
+ *       memory budget.
+ */
+static void
+scan_alloc_hash_list_scan_bloom (THREAD_ENTRY * thread_p, HASH_LIST_SCAN * hlsid, int tuple_cnt)
+{
+  UINT64 bit_cnt, max_bits;
+
+  hlsid->bloom_bits = NULL;
+  hlsid->bloom_bit_mask = 0;
+
+  max_bits = sysprm_get_hot_params ()->max_hash_list_scan_size * 8;
+
+  bit_cnt = HASH_LIST_SCAN_BLOOM_MIN_BITS;
+  while (bit_cnt < (UINT64) tuple_cnt * HASH_LIST_SCAN_BLOOM_BITS_PER_KEY && bit_cnt < max_bits)
+    {
+      bit_cnt *= 2;
+    }
+
+  hlsid->bloom_bits = (UINT64 *) db_private_alloc (thread_p, (size_t) (bit_cnt / 8));
+  if (hlsid->bloom_bits == NULL)
+    {
+      /* not an error; probes fall back to plain hash lookups */
+      er_clear ();
+      return;
+    }
+  memset (hlsid->bloom_bits, 0, (size_t) (bit_cnt / 8));
+  hlsid->bloom_bit_mask = (unsigned int) (bit_cnt - 1);
+}
+
+/*
+ * scan_hash_list_scan_bloom_set () - record a build key in the bloom filter
+ *   return: void
+ *   hlsid (in/out): hash list scan structure
+ *   hash_key (in): hash value of the build key
+ */
+static void
+scan_hash_list_scan_bloom_set (HASH_LIST_SCAN * hlsid, unsigned int hash_key)
+{
+  unsigned int b1, b2;
+
+  b1 = hash_key & hlsid->bloom_bit_mask;
+  b2 = (hash_key * 2654435761U) & hlsid->bloom_bit_mask;
+
+  hlsid->bloom_bits[b1 / 64] |= ((UINT64) 1) << (b1 % 64);
+  hlsid->bloom_bits[b2 / 64] |= ((UINT64) 1) << (b2 % 64);
+}
+
+/*
+ * scan_hash_list_scan_bloom_test () - test a probe key against the bloom filter
+ *   return: false when the key is certainly not in the hash table
+ *   hlsid (in): hash list scan structure
+ *   hash_key (in): hash value of the probe key
+ */
+static bool
+scan_hash_list_scan_bloom_test (HASH_LIST_SCAN * hlsid, unsigned int hash_key)
+{
+  unsigned int b1, b2;
+
+  b1 = hash_key & hlsid->bloom_bit_mask;
+  b2 = (hash_key * 2654435761U) & hlsid->bloom_bit_mask;
+
+  return ((hlsid->bloom_bits[b1 / 64] >> (b1 % 64)) & (hlsid->bloom_bits[b2 / 64] >> (b2 % 64)) & 1) != 0;
+}
@@ -35,6 +35,7 @@
 #include "jansson.h"
 #endif
 
+#include "binaryheap.h"		/* for BINARY_HEAP */
 #include "btree.h"		/* TODO: for BTREE_SCAN */
 #include "heap_file.h"		/* for HEAP_SCANCACHE */
 #include "method_scan.h"	/* for METHOD_SCAN_BUFFER */
@@ -114,6 +115,10 @@ struct heap_scan_id
   bool caches_inited;		/* are the caches initialized?? */
   bool scancache_inited;
   bool scanrange_inited;
+  VPID ssc_start_vpid;		/* page where a synchronized scan attached; NULL when not attached */
+  VPID ssc_last_vpid;		/* last page this scan published to the synchronized scan hints */
+  bool ssc_wrapped;		/* synchronized scan has wrapped around to the first page */
+  bool ssc_publish;		/* publish this scan's position for scans arriving later */
   DB_VALUE **cache_recordinfo;	/* cache for record information */
   regu_variable_list_node *recordinfo_regu_list;	/* regulator variable list for record info */
 };				/* Regular Heap File Scan Identifier */
@@ -166,8 +171,9 @@ struct multi_range_opt
   int *sort_att_idx;		/* index of MIDXKEY attribute on which the sort is performed */
   QFILE_TUPLE_RECORD tplrec;	/* tuple record to dump MIDXKEYs into */
   TP_DOMAIN **sort_col_dom;	/* sorting column domain */
-  RANGE_OPT_ITEM **top_n_items;	/* array with top n items */
-  RANGE_OPT_ITEM **buffer;	/* temporary buffer used to copy elements from top_n_items */
+  RANGE_OPT_ITEM **top_n_items;	/* array with top n items; aliases the heap storage */
+  BINARY_HEAP *heap;		/* owns top_n_items; keeps the worst retained key at the root while the ranges are
+				 * merged and is sorted in place once all ranges are exhausted */
 };
 
 /* Index Skip Scan Operation types: Get the first valid key for the first
@@ -261,6 +267,7 @@ struct llist_scan_id
   regu_variable_list_node *rest_regu_list;	/* regulator variable list */
   QFILE_TUPLE_RECORD *tplrecp;	/* tuple record pointer; output param */
   HASH_LIST_SCAN hlsid;		/* for hash scan */
+  bool domains_resolved;	/* late-bound domains already resolved; resolution is per scan, not per tuple */
 };
 
 typedef struct showstmt_scan_id SHOWSTMT_SCAN_ID;
@@ -357,6 +364,9 @@ struct scan_id_struct
 				 * match. row or end of scan will be returned with no actual SCAN. */
   val_list_node *val_list;	/* value list */
   val_descr *vd;		/* value descriptor */
+  SCAN_CODE (*next_scan_fnc) (THREAD_ENTRY * thread_p, SCAN_ID * s_id);	/* scan advance function; resolved from the
+									 * scan type on the first fetch so the per-tuple
+									 * path pays no type dispatch */
   union
   {
     LLIST_SCAN_ID llsid;	/* List File Scan Identifier */
@@ -36,6 +36,7 @@
 #include "object_primitive.h"
 #include "record_descriptor.hpp"
 #include "server_interface.h"
+#include "session.h"
 #include "xserver_interface.h"
 #include "slotted_page.h"
 #include "dbtype.h"
@@ -117,6 +118,10 @@ SERIAL_CACHE_POOL serial_Cache_pool = { NULL, NULL, NULL,
   {NULL_PAGEID, NULL_SLOTID, NULL_VOLID}, PTHREAD_MUTEX_INITIALIZER
 };
 
+/* bumped whenever a serial is decached (altered or dropped); session value caches stamped with an older
+ * generation discard their remaining values instead of handing out numbers from a stale block */
+static INT64 serial_Cache_generation = 0;
+
 #if defined (SERVER_MODE)
 BTID serial_Cached_btid = BTID_INITIALIZER;
 #endif /* SERVER_MODE */
@@ -128,6 +133,9 @@ static int xserial_get_current_value_internal (THREAD_ENTRY * thread_p, DB_VALUE
 static int xserial_get_next_value_internal (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OID * serial_oidp,
 					    int num_alloc);
 static int serial_get_next_cached_value (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry, int num_alloc);
+static int serial_get_session_cached_value (THREAD_ENTRY * thread_p, const OID * oid_p, DB_VALUE * result_num);
+static int serial_session_grab_value_block (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry,
+					    DB_VALUE * result_num);
 static int serial_update_cur_val_of_serial (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry, int num_alloc);
 static int serial_update_serial_object (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, RECDES * recdesc,
 					HEAP_CACHE_ATTRINFO * attr_info, const OID * serial_class_oidp,
@@ -305,7 +313,14 @@ xserial_get_next_value (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OI
       return ER_FAILED;
     }
 
-  if (cached_num <= 1)
+  if (cached_num > 1 && num_alloc == 1
+      && serial_get_session_cached_value (thread_p, oid_p, result_num) == NO_ERROR)
+    {
+      /* served from the value block this session grabbed earlier; neither the cache pool mutex nor a catalog
+       * update is needed until the block drains */
+      ;
+    }
+  else if (cached_num <= 1)
     {
       /* not used serial cache */
       ret = xserial_get_next_value_internal (thread_p, result_num, oid_p, num_alloc);
@@ -322,12 +337,22 @@ xserial_get_next_value (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OI
       entry = (SERIAL_CACHE_ENTRY *) mht_get (serial_Cache_pool.ht, oid_p);
       if (entry != NULL)
 	{
-	  ret = serial_get_next_cached_value (thread_p, entry, num_alloc);
-	  if (ret != NO_ERROR)
+	  if (num_alloc == 1 && db_get_int (&entry->cyclic) == 0
+	      && serial_session_grab_value_block (thread_p, entry, result_num) == NO_ERROR)
 	    {
-	      goto exit;
+	      /* the whole cached block was grabbed at once; the first value goes to the caller and the
+	       * remainder is parked in the session so the next fetches bypass this mutex */
+	      ;
+	    }
+	  else
+	    {
+	      ret = serial_get_next_cached_value (thread_p, entry, num_alloc);
+	      if (ret != NO_ERROR)
+		{
+		  goto exit;
+		}
+	      pr_clone_value (&entry->cur_val, result_num);
 	    }
-	  pr_clone_value (&entry->cur_val, result_num);
 	}
       else
 	{
@@ -495,6 +520,112 @@ serial_get_next_cached_value (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entr
   return NO_ERROR;
 }
 
+/*
+ * serial_get_session_cached_value () - hand out the next value from the block
+ *                                      grabbed earlier by this session
+ *   return: NO_ERROR, or ER_FAILED when no usable value is cached
+ *   oid_p(in)    : serial object identifier
+ *   result_num(out)    :
+ *
+ * Note: the block belongs to the session, so no synchronization is needed.
+ *       ER_FAILED only means the caller must fall back to the serial cache
+ *       pool; no error is set.
+ */
+static int
+serial_get_session_cached_value (THREAD_ENTRY * thread_p, const OID * oid_p, DB_VALUE * result_num)
+{
+  SESSION_SERIAL_CACHE *session_cache;
+  DB_VALUE cmp_result;
+  DB_VALUE next_val;
+  int error;
+
+  session_cache = session_get_serial_cache (thread_p);
+  if (session_cache == NULL || !OID_EQ (&session_cache->oid, oid_p))
+    {
+      return ER_FAILED;
+    }
+
+  if (session_cache->generation != serial_Cache_generation)
+    {
+      /* the serial was altered or dropped since the block was grabbed; discard the remaining values */
+      OID_SET_NULL (&session_cache->oid);
+      return ER_FAILED;
+    }
+
+  error = numeric_db_value_compare (&session_cache->cur_val, &session_cache->last_val, &cmp_result);
+  if (error != NO_ERROR || db_get_int (&cmp_result) == 0)
+    {
+      /* block drained */
+      OID_SET_NULL (&session_cache->oid);
+      return ER_FAILED;
+    }
+
+  error = numeric_db_value_add (&session_cache->cur_val, &session_cache->inc_val, &next_val);
+  if (error != NO_ERROR)
+    {
+      OID_SET_NULL (&session_cache->oid);
+      return ER_FAILED;
+    }
+
+  pr_clear_value (&session_cache->cur_val);
+  pr_clone_value (&next_val, &session_cache->cur_val);
+  pr_clone_value (&next_val, result_num);
+
+  return NO_ERROR;
+}
+
+/*
+ * serial_session_grab_value_block () - allocate the whole cached block of the
+ *                                      serial and park it in the session
+ *   return: NO_ERROR, or ER_status
+ *   entry(in/out)    :
+ *   result_num(out)    : first value of the block
+ *
+ * Note: must be called with the cache pool mutex held and only for
+ *       non-cyclic serials; near max_val the block may not fit, in which
+ *       case the caller falls back to allocating a single value.
+ */
+static int
+serial_session_grab_value_block (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry, DB_VALUE * result_num)
+{
+  SESSION_SERIAL_CACHE *session_cache;
+  DB_VALUE first_val;
+  int error;
+
+  session_cache = session_get_serial_cache (thread_p);
+  if (session_cache == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  error = serial_get_nth_value (&entry->inc_val, &entry->cur_val, &entry->min_val, &entry->max_val, &entry->cyclic,
+				1, &first_val);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  error = serial_get_next_cached_value (thread_p, entry, entry->cached_num);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  /* the caller receives the first value; the session keeps the rest of the block */
+  pr_clone_value (&first_val, result_num);
+
+  COPY_OID (&session_cache->oid, &entry->oid);
+  session_cache->generation = serial_Cache_generation;
+  pr_clear_value (&session_cache->cur_val);
+  pr_clone_value (&first_val, &session_cache->cur_val);
+  pr_clear_value (&session_cache->last_val);
+  pr_clone_value (&entry->cur_val, &session_cache->last_val);
+  pr_clear_value (&session_cache->inc_val);
+  pr_clone_value (&entry->inc_val, &session_cache->inc_val);
+
+  return NO_ERROR;
+}
+
 /*
  * serial_update_cur_val_of_serial () -
  *                cur_val of db_serial is updated to last_cached_val of entry
@@ -1415,6 +1546,10 @@ xserial_decache (THREAD_ENTRY * thread_p, OID * oidp)
   xcache_remove_by_oid (thread_p, oidp);
 
   rc = pthread_mutex_lock (&serial_Cache_pool.cache_pool_mutex);
+
+  /* invalidate the value blocks parked in sessions; they were carved from the entry decached below */
+  serial_Cache_generation++;
+
   entry = (SERIAL_CACHE_ENTRY *) mht_get (serial_Cache_pool.ht, oidp);
   if (entry != NULL)
     {
@@ -5527,6 +5527,14 @@ stx_build_arith_type (THREAD_ENTRY * thread_p, char *ptr, ARITH_TYPE * arith_typ
   /* This member is only used on server internally. */
   arith_type->rand_seed = NULL;
 
+  /* the coercion plan is resolved at first execution */
+  arith_type->cast_cache.dest_domain = NULL;
+  arith_type->cast_cache.src_type = DB_TYPE_NULL;
+  arith_type->cast_cache.cast_func = NULL;
+
+  /* the TO_CHAR format program is compiled at first execution */
+  arith_type->date_fmt_cache = NULL;
+
   return ptr;
 
 error:
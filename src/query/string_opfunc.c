@@ -231,7 +231,10 @@ static int qstr_ffs (int v);
 static int hextoi (char hex_char);
 static int adjust_precision (char *data, int precision, int scale);
 static int date_to_char (const DB_VALUE * src_value, const DB_VALUE * format_str, const DB_VALUE * date_lang,
-			 DB_VALUE * result_str, const TP_DOMAIN * domain);
+			 DB_VALUE * result_str, const TP_DOMAIN * domain, QSTR_DATE_FMT_CACHE ** fmt_cache_p);
+static int qstr_resolve_date_fmt_cache (QSTR_DATE_FMT_CACHE ** fmt_cache_p, const char *format,
+					INTL_CODESET frmt_codeset, DB_TYPE src_type,
+					QSTR_DATE_FMT_CACHE ** fmt_cache_out);
 static int number_to_char (const DB_VALUE * src_value, const DB_VALUE * format_str, const DB_VALUE * number_lang,
 			   DB_VALUE * result_str, const TP_DOMAIN * domain);
 static int lob_to_bit_char (const DB_VALUE * src_value, DB_VALUE * result_value, DB_TYPE lob_type, int max_length);
@@ -6286,6 +6289,13 @@ qstr_eval_like (const char *tar, int tar_length, const char *expr, int expr_leng
 	      assert (end_tar - tar_ptr > 0);
 	      assert (expr_seq_end - next_expr_ptr > 0);
 
+	      /* with a binary collation over a single-byte codeset the sequence matches byte for byte, so every
+	       * candidate position starts with the first byte of the sequence; memchr can skip the positions that
+	       * cannot match instead of probing each one with the matching function. Space and NUL both carry zero
+	       * weight, so a sequence starting with one of them goes through the generic path */
+	      bool skip_to_first_byte = ((coll_id == LANG_COLL_ISO_BINARY || coll_id == LANG_COLL_BINARY)
+					 && match_escape == NULL && *next_expr_ptr != ' ' && *next_expr_ptr != 0);
+
 	      do
 		{
 		  /* match using collation */
@@ -6312,6 +6322,17 @@ qstr_eval_like (const char *tar, int tar_length, const char *expr, int expr_leng
 		      status = IN_CHECK;
 		      break;
 		    }
+		  else if (skip_to_first_byte)
+		    {
+		      /* jump to the next occurrence of the first byte of the sequence */
+		      tar_ptr++;
+		      tar_ptr =
+			(const unsigned char *) memchr (tar_ptr, *next_expr_ptr, CAST_BUFLEN (end_tar - tar_ptr));
+		      if (tar_ptr == NULL)
+			{
+			  tar_ptr = end_tar;
+			}
+		    }
 		  else
 		    {
 		      /* check starting from next char */
@@ -8282,9 +8303,17 @@ db_get_string_length (const DB_VALUE * value)
     }
 #endif
 
-  str = value->data.ch.medium.buf;
-  length = size = value->data.ch.medium.size;
-  codeset = (INTL_CODESET) value->data.ch.medium.codeset;
+  if (value->data.ch.info.style == SMALL_STRING)
+    {
+      str = value->data.ch.sm.buf;
+      length = size = value->data.ch.sm.size;
+    }
+  else
+    {
+      str = value->data.ch.medium.buf;
+      length = size = value->data.ch.medium.size;
+    }
+  codeset = (INTL_CODESET) value->data.ch.info.codeset;
 
   if (value->domain.general_info.type != DB_TYPE_BIT && value->domain.general_info.type != DB_TYPE_VARBIT)
     {
@@ -13402,7 +13431,7 @@ db_to_char (const DB_VALUE * src_value, const DB_VALUE * format_or_length, const
     }
   else if (TP_IS_DATE_OR_TIME_TYPE (type))
     {
-      return date_to_char (src_value, format_or_length, lang_str, result_str, domain);
+      return date_to_char (src_value, format_or_length, lang_str, result_str, domain, NULL);
     }
   else if (TP_IS_CHAR_TYPE (type))
     {
@@ -13431,6 +13460,168 @@ db_to_char (const DB_VALUE * src_value, const DB_VALUE * format_or_length, const
     }
 }
 
+/*
+ * db_to_char_cached () - db_to_char variant that memoizes the compiled
+ *			  date/time format program across calls
+ *   return: NO_ERROR, or ER_xxx
+ *   fmt_cache_p(in/out): call-site owned cache slot; compiled at first use,
+ *			  revalidated on every call and released with
+ *			  qstr_free_date_fmt_cache
+ *
+ * Note: only the date/time path re-tokenizes its format per call; numbers and
+ *	 strings are dispatched to the generic paths unchanged.
+ */
+int
+db_to_char_cached (const DB_VALUE * src_value, const DB_VALUE * format_or_length, const DB_VALUE * lang_str,
+		   DB_VALUE * result_str, const TP_DOMAIN * domain, QSTR_DATE_FMT_CACHE ** fmt_cache_p)
+{
+  DB_TYPE type = DB_VALUE_DOMAIN_TYPE (src_value);
+
+  if (fmt_cache_p != NULL && TP_IS_DATE_OR_TIME_TYPE (type))
+    {
+      return date_to_char (src_value, format_or_length, lang_str, result_str, domain, fmt_cache_p);
+    }
+
+  return db_to_char (src_value, format_or_length, lang_str, result_str, domain);
+}
+
+/*
+ * qstr_free_date_fmt_cache () - release a compiled TO_CHAR format program
+ *   return: void
+ *   fmt_cache_p(in/out): cache slot; reset to NULL
+ */
+void
+qstr_free_date_fmt_cache (QSTR_DATE_FMT_CACHE ** fmt_cache_p)
+{
+  QSTR_DATE_FMT_CACHE *fmt_cache;
+
+  if (fmt_cache_p == NULL || *fmt_cache_p == NULL)
+    {
+      return;
+    }
+
+  fmt_cache = *fmt_cache_p;
+  if (fmt_cache->format_str != NULL)
+    {
+      free_and_init (fmt_cache->format_str);
+    }
+  if (fmt_cache->tokens != NULL)
+    {
+      free_and_init (fmt_cache->tokens);
+    }
+  free_and_init (*fmt_cache_p);
+}
+
+/*
+ * qstr_resolve_date_fmt_cache () - return the compiled token program for a
+ *				    date/time format, reusing the cached one
+ *				    when it still matches
+ *   return: NO_ERROR, or ER_QSTR_INVALID_FORMAT
+ *   fmt_cache_p(in/out): call-site owned cache slot
+ *   format(in): nul-terminated format string
+ *   frmt_codeset(in): codeset of the format string
+ *   src_type(in): type of the value being formatted
+ *   fmt_cache_out(out): resolved cache; NULL when allocation failed, in which
+ *			 case the caller falls back to re-tokenizing per call
+ */
+static int
+qstr_resolve_date_fmt_cache (QSTR_DATE_FMT_CACHE ** fmt_cache_p, const char *format, INTL_CODESET frmt_codeset,
+			     DB_TYPE src_type, QSTR_DATE_FMT_CACHE ** fmt_cache_out)
+{
+  QSTR_DATE_FMT_CACHE *fmt_cache = *fmt_cache_p;
+  const char *cur_format_str_ptr, *next_format_str_ptr, *last_format_str_ptr;
+  TIMESTAMP_FORMAT cur_format;
+  int cur_format_size;
+  int format_size = (int) strlen (format);
+
+  *fmt_cache_out = NULL;
+
+  if (fmt_cache != NULL)
+    {
+      if (fmt_cache->codeset == frmt_codeset && fmt_cache->src_type == src_type
+	  && fmt_cache->format_size == format_size && memcmp (fmt_cache->format_str, format, format_size) == 0)
+	{
+	  *fmt_cache_out = fmt_cache;
+	  return NO_ERROR;
+	}
+
+      /* a different format reached this call site; recompile */
+      qstr_free_date_fmt_cache (fmt_cache_p);
+    }
+
+  fmt_cache = (QSTR_DATE_FMT_CACHE *) malloc (sizeof (QSTR_DATE_FMT_CACHE));
+  if (fmt_cache == NULL)
+    {
+      /* not fatal : the caller still has the generic per-call path */
+      return NO_ERROR;
+    }
+  memset (fmt_cache, 0, sizeof (QSTR_DATE_FMT_CACHE));
+
+  fmt_cache->format_str = (char *) malloc (format_size + 1);
+  /* every token spans at least one byte, so format_size entries suffice */
+  fmt_cache->tokens = (QSTR_DATE_FMT_TOKEN *) malloc (MAX (format_size, 1) * sizeof (QSTR_DATE_FMT_TOKEN));
+  if (fmt_cache->format_str == NULL || fmt_cache->tokens == NULL)
+    {
+      qstr_free_date_fmt_cache (&fmt_cache);
+      return NO_ERROR;
+    }
+
+  memcpy (fmt_cache->format_str, format, format_size + 1);
+  fmt_cache->format_size = format_size;
+  fmt_cache->codeset = frmt_codeset;
+  fmt_cache->src_type = src_type;
+
+  cur_format_str_ptr = fmt_cache->format_str;
+  last_format_str_ptr = cur_format_str_ptr + format_size;
+
+  for (;;)
+    {
+      cur_format = get_next_format (cur_format_str_ptr, frmt_codeset, src_type, &cur_format_size,
+				    &next_format_str_ptr);
+      switch (cur_format)
+	{
+	case DT_TZR:
+	  fmt_cache->ntzr++;
+	  break;
+
+	case DT_TZD:
+	  fmt_cache->ntzd++;
+	  break;
+
+	case DT_TZH:
+	  fmt_cache->has_tzh = true;
+	  break;
+
+	case DT_TZM:
+	  fmt_cache->has_tzm = true;
+	  break;
+
+	case DT_INVALID:
+	  qstr_free_date_fmt_cache (&fmt_cache);
+	  return ER_QSTR_INVALID_FORMAT;
+
+	default:
+	  break;
+	}
+
+      assert (fmt_cache->token_count < MAX (format_size, 1));
+      fmt_cache->tokens[fmt_cache->token_count].format = cur_format;
+      fmt_cache->tokens[fmt_cache->token_count].offset = (int) (cur_format_str_ptr - fmt_cache->format_str);
+      fmt_cache->tokens[fmt_cache->token_count].size = cur_format_size;
+      fmt_cache->token_count++;
+
+      cur_format_str_ptr = next_format_str_ptr;
+      if (next_format_str_ptr == last_format_str_ptr)
+	{
+	  break;
+	}
+    }
+
+  *fmt_cache_p = fmt_cache;
+  *fmt_cache_out = fmt_cache;
+  return NO_ERROR;
+}
+
 #define MAX_STRING_DATE_TOKEN_LEN  LOC_DATA_MONTH_WIDE_SIZE
 const char *Month_name_ISO[][12] = {
   {"January", "February", "March", "April",
@@ -17259,10 +17450,14 @@ exit:
 
 /*
  * date_to_char () -
+ *
+ * Note: fmt_cache_p may be NULL; when given, the compiled token program of the
+ *	 user format is cached there and replayed instead of re-tokenizing the
+ *	 format string on every call.
  */
 static int
 date_to_char (const DB_VALUE * src_value, const DB_VALUE * format_str, const DB_VALUE * date_lang,
-	      DB_VALUE * result_str, const TP_DOMAIN * domain)
+	      DB_VALUE * result_str, const TP_DOMAIN * domain, QSTR_DATE_FMT_CACHE ** fmt_cache_p)
 {
   int error_status = NO_ERROR;
   DB_TYPE src_type;
@@ -17454,6 +17649,8 @@ date_to_char (const DB_VALUE * src_value, const DB_VALUE * format_str, const DB_
       int len_tzr = 0, len_tzd = 0;
       bool has_tzh = false, has_tzm = false;
       TZ_ID tz_id;
+      QSTR_DATE_FMT_CACHE *fmt_cache = NULL;
+      int fmt_token_idx = 0;
 
       tzr[0] = '\0';
       tzd[0] = '\0';
@@ -17488,43 +17685,64 @@ date_to_char (const DB_VALUE * src_value, const DB_VALUE * format_str, const DB_
       cur_format_str_ptr = initial_buf_format;
       last_format_str_ptr = cur_format_str_ptr + strlen (cur_format_str_ptr);
 
+      if (fmt_cache_p != NULL)
+	{
+	  error_status =
+	    qstr_resolve_date_fmt_cache (fmt_cache_p, initial_buf_format, frmt_codeset, src_type, &fmt_cache);
+	  if (error_status != NO_ERROR)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_status, 0);
+	      goto exit;
+	    }
+	}
+
       /* First compute the number of TZR and TZD tokens if any */
-      cur_format = DT_NORMAL;
-      for (;;)
+      if (fmt_cache != NULL)
 	{
-	  cur_format =
-	    get_next_format (cur_format_str_ptr, frmt_codeset, src_type, &cur_format_size, &next_format_str_ptr);
-	  switch (cur_format)
+	  ntzr = fmt_cache->ntzr;
+	  ntzd = fmt_cache->ntzd;
+	  has_tzh = fmt_cache->has_tzh;
+	  has_tzm = fmt_cache->has_tzm;
+	}
+      else
+	{
+	  cur_format = DT_NORMAL;
+	  for (;;)
 	    {
-	    case DT_TZR:
-	      ntzr++;
-	      break;
+	      cur_format =
+		get_next_format (cur_format_str_ptr, frmt_codeset, src_type, &cur_format_size, &next_format_str_ptr);
+	      switch (cur_format)
+		{
+		case DT_TZR:
+		  ntzr++;
+		  break;
 
-	    case DT_TZD:
-	      ntzd++;
-	      break;
+		case DT_TZD:
+		  ntzd++;
+		  break;
 
-	    case DT_TZH:
-	      has_tzh = true;
-	      break;
+		case DT_TZH:
+		  has_tzh = true;
+		  break;
 
-	    case DT_TZM:
-	      has_tzm = true;
-	      break;
+		case DT_TZM:
+		  has_tzm = true;
+		  break;
 
-	    case DT_INVALID:
-	      error_status = ER_QSTR_INVALID_FORMAT;
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_status, 0);
-	      goto exit;
+		case DT_INVALID:
+		  error_status = ER_QSTR_INVALID_FORMAT;
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_status, 0);
+		  goto exit;
 
-	    default:
-	      break;
-	    }
+		default:
+		  break;
+		}
 
-	  cur_format_str_ptr = next_format_str_ptr;
-	  if (next_format_str_ptr == last_format_str_ptr)
-	    {
-	      break;
+	      cur_format_str_ptr = next_format_str_ptr;
+	      if (next_format_str_ptr == last_format_str_ptr)
+		{
+		  break;
+		}
 	    }
 	}
 
@@ -17699,8 +17917,19 @@ date_to_char (const DB_VALUE * src_value, const DB_VALUE * format_str, const DB_
 	  int token_case_mode;
 	  int token_size;
 
-	  cur_format =
-	    get_next_format (cur_format_str_ptr, frmt_codeset, src_type, &cur_format_size, &next_format_str_ptr);
+	  if (fmt_cache != NULL)
+	    {
+	      /* replay the compiled token program instead of re-tokenizing */
+	      cur_format = fmt_cache->tokens[fmt_token_idx].format;
+	      cur_format_size = fmt_cache->tokens[fmt_token_idx].size;
+	      cur_format_str_ptr = initial_buf_format + fmt_cache->tokens[fmt_token_idx].offset;
+	      next_format_str_ptr = cur_format_str_ptr + cur_format_size;
+	    }
+	  else
+	    {
+	      cur_format =
+		get_next_format (cur_format_str_ptr, frmt_codeset, src_type, &cur_format_size, &next_format_str_ptr);
+	    }
 	  switch (cur_format)
 	    {
 	    case DT_CC:
@@ -18058,10 +18287,21 @@ date_to_char (const DB_VALUE * src_value, const DB_VALUE * format_str, const DB_
 	      break;
 	    }
 
-	  cur_format_str_ptr = next_format_str_ptr;
-	  if (next_format_str_ptr == last_format_str_ptr)
+	  if (fmt_cache != NULL)
 	    {
-	      break;
+	      fmt_token_idx++;
+	      if (fmt_token_idx >= fmt_cache->token_count)
+		{
+		  break;
+		}
+	    }
+	  else
+	    {
+	      cur_format_str_ptr = next_format_str_ptr;
+	      if (next_format_str_ptr == last_format_str_ptr)
+		{
+		  break;
+		}
 	    }
 	}
 
@@ -157,6 +157,37 @@ typedef enum
   DT_TZM
 } TIMESTAMP_FORMAT;
 
+/*
+ * Compiled TO_CHAR date/time format program.  One entry per format element,
+ * in emission order; offsets index into the private nul-terminated copy of
+ * the format string so case-sensitive tokens (Month/MONTH/month, Am/AM, ...)
+ * can still inspect the original bytes.  The cache is owned by the call site
+ * (e.g. an ARITH_TYPE node), compiled at first execution, revalidated on
+ * every call and released with qstr_free_date_fmt_cache.
+ */
+typedef struct qstr_date_fmt_token QSTR_DATE_FMT_TOKEN;
+struct qstr_date_fmt_token
+{
+  TIMESTAMP_FORMAT format;	/* token code returned by get_next_format */
+  int offset;			/* byte offset of the token in format_str */
+  int size;			/* byte size of the token */
+};
+
+typedef struct qstr_date_fmt_cache QSTR_DATE_FMT_CACHE;
+struct qstr_date_fmt_cache
+{
+  char *format_str;		/* private nul-terminated copy of the format */
+  int format_size;		/* byte size of format_str */
+  INTL_CODESET codeset;		/* codeset the format was tokenized with */
+  DB_TYPE src_type;		/* source type the format was tokenized for */
+  QSTR_DATE_FMT_TOKEN *tokens;	/* compiled token program */
+  int token_count;		/* number of entries in tokens */
+  int ntzr;			/* number of TZR tokens */
+  int ntzd;			/* number of TZD tokens */
+  bool has_tzh;			/* format contains a TZH token */
+  bool has_tzm;			/* format contains a TZM token */
+};
+
 #define  LIKE_WILDCARD_MATCH_MANY '%'
 #define LIKE_WILDCARD_MATCH_ONE '_'
 
@@ -285,6 +316,9 @@ extern int db_sys_date_and_epoch_time (DB_VALUE * dt_dbval, DB_VALUE * ts_dbval)
 extern int db_sys_timezone (DB_VALUE * result_timezone);
 extern int db_to_char (const DB_VALUE * src_value, const DB_VALUE * format_or_length, const DB_VALUE * lang_str,
 		       DB_VALUE * result_str, const TP_DOMAIN * domain);
+extern int db_to_char_cached (const DB_VALUE * src_value, const DB_VALUE * format_or_length, const DB_VALUE * lang_str,
+			      DB_VALUE * result_str, const TP_DOMAIN * domain, QSTR_DATE_FMT_CACHE ** fmt_cache_p);
+extern void qstr_free_date_fmt_cache (QSTR_DATE_FMT_CACHE ** fmt_cache_p);
 extern int db_to_date (const DB_VALUE * src_str, const DB_VALUE * format_str, const DB_VALUE * date_lang,
 		       DB_VALUE * result_date);
 extern int db_to_time (const DB_VALUE * src_str, const DB_VALUE * format_str, const DB_VALUE * date_lang,
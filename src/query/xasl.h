@@ -924,6 +924,9 @@ struct xasl_stat
 struct topn_tuples
 {
   SORT_LIST *sort_items;	/* sort items position in tuple and sort order */
+  /* compare kernels matching sort_items one to one, resolved once at setup (see pr_get_fast_comparator); a NULL entry
+   * keeps the generic domain comparator for that item */
+    DB_VALUE_COMPARE_RESULT (**fast_cmp_funcs) (const DB_VALUE * value1, const DB_VALUE * value2);
   struct binary_heap *heap;	/* heap used to hold top-n tuples */
   TOPN_TUPLE *tuples;		/* actual tuples stored in memory */
   int values_count;		/* number of values in a tuple */
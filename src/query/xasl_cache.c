@@ -262,6 +262,11 @@ static bool xcache_entry_mark_deleted (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY
 static bool xcache_entry_set_request_recompile_flag (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry,
 						     bool set_flag);
 static void xcache_clone_decache (THREAD_ENTRY * thread_p, XASL_CLONE * xclone);
+static int xcache_clone_pool_start_slot (THREAD_ENTRY * thread_p, int capacity);
+static XASL_CLONE_NODE *xcache_clone_pool_claim (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
+static bool xcache_clone_pool_offer (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry,
+				     const XASL_CLONE * xclone);
+static void xcache_clone_pool_drop_all (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
 static void xcache_cleanup (THREAD_ENTRY * thread_p);
 static BH_CMP_RESULT xcache_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_ARG ignore_arg);
 static bool xcache_check_recompilation_threshold (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
@@ -370,24 +375,22 @@ xcache_finalize (THREAD_ENTRY * thread_p)
 // *INDENT-OFF*
 xasl_cache_ent::xasl_cache_ent ()
 {
-  pthread_mutex_init (&cache_clones_mutex, NULL);
   init_clone_cache ();
 }
 
 xasl_cache_ent::~xasl_cache_ent ()
 {
-  assert (cache_clones == NULL || cache_clones == &one_clone);
-  pthread_mutex_destroy (&cache_clones_mutex);
+  assert (cache_clones == NULL);
 }
 
 void
 xasl_cache_ent::init_clone_cache ()
 {
-  cache_clones = &one_clone;
-  one_clone.xasl = NULL;
-  one_clone.xasl_buf = NULL;
-  cache_clones_capacity = 1;
+  cache_clones = NULL;
+  cache_clones_capacity = 0;
   n_cache_clones = 0;
+  n_clones_in_use = 0;
+  max_clones_in_use = 0;
 }
 // *INDENT-ON*
 
@@ -405,7 +408,6 @@ xcache_entry_alloc (void)
       return NULL;
     }
   xcache_entry->init_clone_cache ();
-  pthread_mutex_init (&xcache_entry->cache_clones_mutex, NULL);
 
   xcache_entry->list_ht_no = -1;
 
@@ -423,13 +425,12 @@ xcache_entry_free (void *entry)
 {
   XASL_CACHE_ENTRY *xcache_entry = (XASL_CACHE_ENTRY *) entry;
 
-  if (xcache_entry->cache_clones != &xcache_entry->one_clone)
+  if (xcache_entry->cache_clones != NULL)
     {
       /* Should be already freed? */
       assert (false);
-      free (xcache_entry->cache_clones);
+      free ((void *) xcache_entry->cache_clones);
     }
-  pthread_mutex_destroy (&xcache_entry->cache_clones_mutex);
   free (entry);
   return NO_ERROR;
 }
@@ -461,6 +462,8 @@ xcache_entry_init (void *entry)
   xcache_entry->initialized = true;
 
   assert (xcache_entry->n_cache_clones == 0);
+  xcache_entry->n_clones_in_use = 0;
+  xcache_entry->max_clones_in_use = 0;
   return NO_ERROR;
 }
 
@@ -513,20 +516,14 @@ xcache_entry_uninit (void *entry)
       assert (xcache_entry->n_cache_clones == 0
 	      || (xcache_Max_clones > 0 && xcache_entry->n_cache_clones <= xcache_Max_clones));
       assert (xcache_entry->n_cache_clones == 0 || xcache_entry->cache_clones != NULL);
-      while (xcache_entry->n_cache_clones > 0)
+      xcache_clone_pool_drop_all (thread_p, xcache_entry);
+      if (xcache_entry->cache_clones != NULL)
 	{
-	  xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-	}
-      if (xcache_entry->cache_clones != &xcache_entry->one_clone)
-	{
-	  /* Free cache clones. */
+	  /* Free the slot pool. */
 	  assert (xcache_entry->cache_clones_capacity > 0);
-	  free (xcache_entry->cache_clones);
-	  xcache_entry->cache_clones = &xcache_entry->one_clone;
-	  xcache_entry->one_clone.xasl = NULL;
-	  xcache_entry->one_clone.xasl_buf = NULL;
-	  xcache_entry->cache_clones_capacity = 1;
+	  free ((void *) xcache_entry->cache_clones);
 	}
+      xcache_entry->init_clone_cache ();
       if (xcache_entry->stream.buffer != NULL)
 	{
 	  free_and_init (xcache_entry->stream.buffer);
@@ -999,36 +996,42 @@ xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, X
 
   if (xcache_uses_clones ())
     {
+      XASL_CLONE_NODE *clone_node;
+      int in_use, max_in_use;
+
       use_xasl_clone = true;
-      /* Try to fetch a cached clone. */
-      if ((*xcache_entry)->cache_clones == NULL)
-	{
-	  assert_release (false);
-	  /* Fall through. */
-	}
-      else
+
+      /* Track the concurrency observed on this entry; it bounds how many clones are worth pooling. */
+      in_use = ATOMIC_INC_32 (&(*xcache_entry)->n_clones_in_use, 1);
+      max_in_use = (*xcache_entry)->max_clones_in_use;
+      while (in_use > max_in_use)
 	{
-	  (void) pthread_mutex_lock (&(*xcache_entry)->cache_clones_mutex);
-	  assert ((*xcache_entry)->n_cache_clones <= xcache_Max_clones);
-	  if ((*xcache_entry)->n_cache_clones > 0)
+	  if (ATOMIC_CAS_32 (&(*xcache_entry)->max_clones_in_use, max_in_use, in_use))
 	    {
-	      /* A clone is available. */
-	      *xclone = (*xcache_entry)->cache_clones[--(*xcache_entry)->n_cache_clones];
-	      (void) pthread_mutex_unlock (&(*xcache_entry)->cache_clones_mutex);
-
-	      assert (xclone->xasl != NULL && xclone->xasl_buf != NULL);
-
-	      xcache_log ("found cached clone: \n"
-			  XCACHE_LOG_ENTRY_TEXT ("entry")
-			  XCACHE_LOG_XASL_ID_TEXT ("lookup xasl_id")
-			  XCACHE_LOG_CLONE
-			  XCACHE_LOG_TRAN_TEXT,
-			  XCACHE_LOG_ENTRY_ARGS (*xcache_entry),
-			  XCACHE_LOG_XASL_ID_ARGS (xid),
-			  XCACHE_LOG_CLONE_ARGS (xclone), XCACHE_LOG_TRAN_ARGS (thread_p));
-	      return NO_ERROR;
+	      break;
 	    }
-	  (void) pthread_mutex_unlock (&(*xcache_entry)->cache_clones_mutex);
+	  max_in_use = (*xcache_entry)->max_clones_in_use;
+	}
+
+      /* Try to fetch a cached clone. */
+      clone_node = xcache_clone_pool_claim (thread_p, *xcache_entry);
+      if (clone_node != NULL)
+	{
+	  /* A clone is available. */
+	  *xclone = clone_node->clone;
+	  free (clone_node);
+
+	  assert (xclone->xasl != NULL && xclone->xasl_buf != NULL);
+
+	  xcache_log ("found cached clone: \n"
+		      XCACHE_LOG_ENTRY_TEXT ("entry")
+		      XCACHE_LOG_XASL_ID_TEXT ("lookup xasl_id")
+		      XCACHE_LOG_CLONE
+		      XCACHE_LOG_TRAN_TEXT,
+		      XCACHE_LOG_ENTRY_ARGS (*xcache_entry),
+		      XCACHE_LOG_XASL_ID_ARGS (xid),
+		      XCACHE_LOG_CLONE_ARGS (xclone), XCACHE_LOG_TRAN_ARGS (thread_p));
+	  return NO_ERROR;
 	}
       /* Clone not found. */
       /* When clones are activated, we use global heap to generate the XASL's; this way, other threads can use the
@@ -1047,6 +1050,11 @@ xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, X
     {
       ASSERT_ERROR ();
       assert (xclone->xasl == NULL && xclone->xasl_buf == NULL);
+      if (use_xasl_clone)
+	{
+	  /* The checkout failed; the matching retire will never come. */
+	  ATOMIC_INC_32 (&(*xcache_entry)->n_clones_in_use, -1);
+	}
       xcache_unfix (thread_p, *xcache_entry);
       *xcache_entry = NULL;
 
@@ -1148,11 +1156,8 @@ xcache_unfix (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
       xcache_log ("delete entry from hash after unfix: \n"
 		  XCACHE_LOG_ENTRY_TEXT ("entry") XCACHE_LOG_TRAN_TEXT,
 		  XCACHE_LOG_ENTRY_ARGS (xcache_entry), XCACHE_LOG_TRAN_ARGS (thread_p));
-      /* No need to acquire the clone mutex, since I'm the unique user. */
-      while (xcache_entry->n_cache_clones > 0)
-	{
-	  xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-	}
+      /* I'm the unique user, but dropping the pool is lock-free anyway. */
+      xcache_clone_pool_drop_all (thread_p, xcache_entry);
 
       /* need to clear list-cache first */
       if (xcache_entry->list_ht_no >= 0)
@@ -1795,12 +1800,9 @@ xcache_invalidate_entries (THREAD_ENTRY * thread_p, bool (*invalidate_check) (XA
 		{
 		  /*
 		   * Successfully marked for delete. Save it to delete after the iteration.
-		   * No need to acquire the clone mutex, since I'm the unique user.
+		   * I'm the unique user, but dropping the pool is lock-free anyway.
 		   */
-		  while (xcache_entry->n_cache_clones > 0)
-		    {
-		      xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-		    }
+		  xcache_clone_pool_drop_all (thread_p, xcache_entry);
 		  delete_xids[n_delete_xids++] = xcache_entry->xasl_id;
 		}
 	    }
@@ -2028,6 +2030,179 @@ xcache_clone_decache (THREAD_ENTRY * thread_p, XASL_CLONE * xclone)
   (void) db_change_private_heap (thread_p, save_heapid);
 }
 
+/*
+ * xcache_clone_pool_start_slot () - Preferred first slot of the current thread in an entry's clone pool.
+ *
+ * return	 : Slot index.
+ * thread_p (in) : Thread entry.
+ * capacity (in) : Slot pool capacity.
+ *
+ * Note: spreading threads over the slot array keeps them claiming and recycling through different slots, so the
+ *	 compare-and-swaps rarely collide and a thread tends to get back a clone whose memory it recently touched.
+ */
+static int
+xcache_clone_pool_start_slot (THREAD_ENTRY * thread_p, int capacity)
+{
+  assert (capacity > 0);
+  if (thread_p == NULL)
+    {
+      return 0;
+    }
+  return (int) ((unsigned int) thread_p->index % (unsigned int) capacity);
+}
+
+/*
+ * xcache_clone_pool_claim () - Claim a recycled clone from the entry's lock-free pool.
+ *
+ * return	     : Claimed clone node, or NULL if the pool is empty; the caller owns the node and must free it.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry.
+ */
+static XASL_CLONE_NODE *
+xcache_clone_pool_claim (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
+{
+  XASL_CLONE_NODE *volatile *slots = xcache_entry->cache_clones;
+  XASL_CLONE_NODE *node;
+  int capacity = xcache_entry->cache_clones_capacity;
+  int start, it, slot;
+
+  if (slots == NULL || xcache_entry->n_cache_clones <= 0)
+    {
+      return NULL;
+    }
+
+  start = xcache_clone_pool_start_slot (thread_p, capacity);
+  for (it = 0; it < capacity; it++)
+    {
+      slot = start + it;
+      if (slot >= capacity)
+	{
+	  slot -= capacity;
+	}
+      node = slots[slot];
+      if (node != NULL && ATOMIC_CAS_ADDR (&slots[slot], node, (XASL_CLONE_NODE *) NULL))
+	{
+	  ATOMIC_INC_32 (&xcache_entry->n_cache_clones, -1);
+	  return node;
+	}
+    }
+  return NULL;
+}
+
+/*
+ * xcache_clone_pool_offer () - Offer a retired clone to the entry's lock-free pool.
+ *
+ * return	     : True if the clone was pooled, false if the caller must decache it.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry.
+ * xclone (in)	     : Retired XASL clone.
+ */
+static bool
+xcache_clone_pool_offer (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, const XASL_CLONE * xclone)
+{
+  XASL_CLONE_NODE *volatile *slots = xcache_entry->cache_clones;
+  XASL_CLONE_NODE *node;
+  int capacity, start, it, slot;
+  int retain_limit;
+
+  /* Keep no more clones than this entry was ever concurrently executed; anything beyond that could never be checked
+   * out at once and would only pin memory. */
+  retain_limit = MIN (MAX (xcache_entry->max_clones_in_use, 1), xcache_Max_clones);
+  if (xcache_entry->n_cache_clones >= retain_limit)
+    {
+      return false;
+    }
+
+  if (slots == NULL)
+    {
+      /* First recycle on this entry; publish the slot pool. */
+      XASL_CLONE_NODE *volatile *new_slots;
+
+      new_slots = (XASL_CLONE_NODE * volatile *) calloc (xcache_Max_clones, sizeof (XASL_CLONE_NODE *));
+      if (new_slots == NULL)
+	{
+	  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  xcache_Max_clones * sizeof (XASL_CLONE_NODE *));
+	  return false;
+	}
+      if (!ATOMIC_CAS_ADDR (&xcache_entry->cache_clones, (XASL_CLONE_NODE * volatile *) NULL, new_slots))
+	{
+	  /* Someone else published a pool; use theirs. */
+	  free ((void *) new_slots);
+	}
+      else
+	{
+	  xcache_entry->cache_clones_capacity = xcache_Max_clones;
+	}
+      slots = xcache_entry->cache_clones;
+    }
+  capacity = xcache_entry->cache_clones_capacity;
+  if (capacity <= 0)
+    {
+      /* The publisher has not set the capacity yet; retry next time. */
+      return false;
+    }
+
+  node = (XASL_CLONE_NODE *) malloc (sizeof (XASL_CLONE_NODE));
+  if (node == NULL)
+    {
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (XASL_CLONE_NODE));
+      return false;
+    }
+  node->clone = *xclone;
+
+  start = xcache_clone_pool_start_slot (thread_p, capacity);
+  for (it = 0; it < capacity; it++)
+    {
+      slot = start + it;
+      if (slot >= capacity)
+	{
+	  slot -= capacity;
+	}
+      if (slots[slot] == NULL && ATOMIC_CAS_ADDR (&slots[slot], (XASL_CLONE_NODE *) NULL, node))
+	{
+	  ATOMIC_INC_32 (&xcache_entry->n_cache_clones, 1);
+	  return true;
+	}
+    }
+
+  /* All slots taken. */
+  free (node);
+  return false;
+}
+
+/*
+ * xcache_clone_pool_drop_all () - Decache every clone pooled on the entry.
+ *
+ * return	     : Void.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry.
+ */
+static void
+xcache_clone_pool_drop_all (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
+{
+  XASL_CLONE_NODE *volatile *slots = xcache_entry->cache_clones;
+  XASL_CLONE_NODE *node;
+  int capacity = xcache_entry->cache_clones_capacity;
+  int slot;
+
+  if (slots == NULL)
+    {
+      return;
+    }
+
+  for (slot = 0; slot < capacity; slot++)
+    {
+      node = slots[slot];
+      if (node != NULL && ATOMIC_CAS_ADDR (&slots[slot], node, (XASL_CLONE_NODE *) NULL))
+	{
+	  ATOMIC_INC_32 (&xcache_entry->n_cache_clones, -1);
+	  xcache_clone_decache (thread_p, &node->clone);
+	  free (node);
+	}
+    }
+}
+
 /*
  * xcache_retire_clone () - Retire XASL clone. If clones caches are enabled, first try to cache it in xcache_entry.
  *
@@ -2044,55 +2219,21 @@ xcache_retire_clone (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, X
 
   if (xcache_uses_clones ())
     {
-      pthread_mutex_lock (&xcache_entry->cache_clones_mutex);
-      if (xcache_entry->n_cache_clones < xcache_Max_clones)
+      if (ATOMIC_INC_32 (&xcache_entry->n_clones_in_use, -1) < 0)
 	{
-	  if (xcache_entry->n_cache_clones == xcache_entry->cache_clones_capacity
-	      && xcache_entry->cache_clones_capacity < xcache_Max_clones)
-	    {
-	      /* Extend cache clone buffer. */
-	      XASL_CLONE *new_clones = NULL;
-	      int new_capacity = MIN (xcache_Max_clones, xcache_entry->cache_clones_capacity * 2);
-	      if (xcache_entry->cache_clones == &xcache_entry->one_clone)
-		{
-		  assert (xcache_entry->cache_clones_capacity == 1);
-		  new_clones = (XASL_CLONE *) malloc (new_capacity * sizeof (XASL_CLONE));
-		  if (new_clones != NULL)
-		    {
-		      new_clones[0].xasl = xcache_entry->cache_clones[0].xasl;
-		      new_clones[0].xasl_buf = xcache_entry->cache_clones[0].xasl_buf;
-		    }
-		}
-	      else
-		{
-		  new_clones = (XASL_CLONE *) realloc (xcache_entry->cache_clones, new_capacity * sizeof (XASL_CLONE));
-		}
-	      if (new_clones == NULL)
-		{
-		  /* Out of memory? */
-		  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
-			  new_capacity * sizeof (XASL_CLONE));
-		  assert (false);
-		  pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
-
-		  /* Free the clone. */
-		  xcache_clone_decache (thread_p, xclone);
-		  return;
-		}
-	      xcache_entry->cache_clones = new_clones;
-	      xcache_entry->cache_clones_capacity = new_capacity;
-	    }
-	  assert (xcache_entry->cache_clones_capacity > xcache_entry->n_cache_clones);
-	  xcache_entry->cache_clones[xcache_entry->n_cache_clones++] = *xclone;
-	  pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
+	  /* Unpaired retire; should not happen. */
+	  assert (false);
+	  ATOMIC_INC_32 (&xcache_entry->n_clones_in_use, 1);
+	}
 
+      if (xcache_clone_pool_offer (thread_p, xcache_entry, xclone))
+	{
 	  xclone->xasl = NULL;
 	  xclone->xasl_buf = NULL;
 	  return;
 	}
-      pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
 
-      /* No more room. */
+      /* No more room (or no memory for the pool). */
       xcache_clone_decache (thread_p, xclone);
       return;
     }
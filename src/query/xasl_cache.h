@@ -67,6 +67,14 @@ struct xasl_clone
 #define XASL_CLONE_INITIALIZER { NULL, NULL }
 #define XASL_CLONE_AS_ARGS(clone) (clone)->xasl, (clone)->xasl_buf
 
+/* One pooled clone. The pool keeps nodes rather than clone values so that checking a clone in or out of an entry is
+ * a single-pointer compare-and-swap on its slot. */
+typedef struct xasl_clone_node XASL_CLONE_NODE;
+struct xasl_clone_node
+{
+  XASL_CLONE clone;
+};
+
 /*
  * EXECUTION_INFO: query strings: user text, hash string and dumped plan.
  */
@@ -115,12 +123,13 @@ struct xasl_cache_ent
 				 * referencing by DB_VALUE parameters bound to the result */
   bool free_data_on_uninit;	/* set to free entry data on uninit. */
 
-  /* Cache clones */
-  XASL_CLONE *cache_clones;
-  XASL_CLONE one_clone;
-  int n_cache_clones;
-  int cache_clones_capacity;
-  pthread_mutex_t cache_clones_mutex;
+  /* Cache clones. Recycled clones live in a lock-free pool of single-pointer slots (NULL slots are empty); how many
+   * are retained adapts to the observed concurrent use of the entry. */
+  XASL_CLONE_NODE *volatile *cache_clones;	/* slot pool; allocated at first recycle */
+  int cache_clones_capacity;	/* slot count; set once when the pool is allocated */
+  volatile int n_cache_clones;	/* approximate pooled clone count */
+  volatile int n_clones_in_use;	/* clones currently checked out of this entry */
+  volatile int max_clones_in_use;	/* high-water mark of n_clones_in_use; bounds pool retention */
 
   /* RT check */
   INT64 time_last_rt_check;
@@ -46,6 +46,7 @@
 #endif /* defined (SA_MODE) */
 #include "lock_free.h"
 #include "object_primitive.h"
+#include "oid.h"
 #include "dbtype.h"
 #include "string_opfunc.h"
 #include "thread_daemon.hpp"
@@ -63,7 +64,9 @@
 static int rv;
 #endif /* not SERVER_MODE */
 
-#define SESSIONS_HASH_SIZE 1000
+/* bucket count of the lock-free session registry; brokers can keep thousands of sessions alive, so keep chains
+ * short. prime to spread sequentially assigned session ids. */
+#define SESSIONS_HASH_SIZE 8191
 #define MAX_SESSION_VARIABLES_COUNT 20
 #define MAX_PREPARED_STATEMENTS_COUNT 20
 
@@ -119,6 +122,7 @@ struct session_state
   bool auto_commit;
   DB_VALUE cur_insert_id;
   DB_VALUE last_insert_id;
+  SESSION_SERIAL_CACHE serial_cache;
   int row_count;
   SESSION_VARIABLE *session_variables;
   PREPARED_STATEMENT *statements;
@@ -296,6 +300,11 @@ session_state_init (void *st)
   /* initialize fields */
   db_make_null (&session_p->cur_insert_id);
   db_make_null (&session_p->last_insert_id);
+  OID_SET_NULL (&session_p->serial_cache.oid);
+  session_p->serial_cache.generation = 0;
+  db_make_null (&session_p->serial_cache.cur_val);
+  db_make_null (&session_p->serial_cache.last_val);
+  db_make_null (&session_p->serial_cache.inc_val);
   session_p->is_trigger_involved = false;
   session_p->is_last_insert_id_generated = false;
   session_p->row_count = -1;
@@ -387,6 +396,11 @@ session_state_uninit (void *st)
   pr_clear_value (&session->cur_insert_id);
   pr_clear_value (&session->last_insert_id);
 
+  OID_SET_NULL (&session->serial_cache.oid);
+  pr_clear_value (&session->serial_cache.cur_val);
+  pr_clear_value (&session->serial_cache.last_val);
+  pr_clear_value (&session->serial_cache.inc_val);
+
   if (session->trace_stats != NULL)
     {
       free_and_init (session->trace_stats);
@@ -588,7 +602,10 @@ session_states_init (THREAD_ENTRY * thread_p)
   er_log_debug (ARG_FILE_LINE, "creating session states table\n");
 #endif /* SESSION_DEBUG */
 
-  sessions.states_hashmap.init (sessions_Ts, THREAD_TS_SESSIONS, SESSIONS_HASH_SIZE, 2, 50, session_state_Descriptor);
+  /* freelist of 100-entry blocks; the old 2-entry blocks caused an allocation every other new session while ramping
+   * up under connection churn */
+  sessions.states_hashmap.init (sessions_Ts, THREAD_TS_SESSIONS, SESSIONS_HASH_SIZE, 100, 10,
+				session_state_Descriptor);
 
 #if defined (SERVER_MODE)
   session_control_daemon_init ();
@@ -1496,6 +1513,36 @@ session_reset_cur_insert_id (THREAD_ENTRY * thread_p)
   return NO_ERROR;
 }
 
+/*
+ * session_get_serial_cache () - get this session's serial value cache
+ *   return  : pointer to the cache, or NULL when no session is active
+ *   thread_p (in) : thread that identifies the session
+ *
+ * Note: the cache belongs to the session, so the caller may read and update
+ *       it without synchronization.
+ */
+SESSION_SERIAL_CACHE *
+session_get_serial_cache (THREAD_ENTRY * thread_p)
+{
+  SESSION_STATE *state_p = NULL;
+
+#if defined (SERVER_MODE)
+  if (thread_p == NULL || thread_p->conn_entry == NULL || thread_p->conn_entry->session_p == NULL)
+    {
+      /* no session is attached (an internal worker); the caller falls back to the shared serial cache */
+      return NULL;
+    }
+#endif /* SERVER_MODE */
+
+  state_p = session_get_session_state (thread_p);
+  if (state_p == NULL)
+    {
+      return NULL;
+    }
+
+  return &state_p->serial_cache;
+}
+
 /*
  * session_begin_insert_values  () - set is_last_insert_id_generated to false
  *                                  in the session associated with a thread
@@ -37,6 +37,22 @@
 // forward definitions
 struct xasl_cache_ent;
 
+/*
+ * Per-session cache of preallocated serial values. A block of values is
+ * grabbed from the serial in one logged operation and handed out from here
+ * without any server-side synchronization until the block drains.
+ */
+typedef struct session_serial_cache SESSION_SERIAL_CACHE;
+struct session_serial_cache
+{
+  OID oid;			/* serial whose values are cached; NULL oid when empty */
+  INT64 generation;		/* serial cache generation when the block was grabbed; a stale generation means the
+				 * serial was altered or dropped and the remaining values must be discarded */
+  DB_VALUE cur_val;		/* last value handed out */
+  DB_VALUE last_val;		/* last value of the grabbed block */
+  DB_VALUE inc_val;		/* increment between consecutive values */
+};
+
 extern void session_states_init (THREAD_ENTRY * thread_p);
 extern void session_states_finalize (THREAD_ENTRY * thread_p);
 extern int session_state_create (THREAD_ENTRY * thread_p, SESSION_ID * id);
@@ -46,6 +62,7 @@ extern int session_get_session_id (THREAD_ENTRY * thread_p, SESSION_ID * id);
 extern int session_get_last_insert_id (THREAD_ENTRY * thread_p, DB_VALUE * value, bool update_last_insert_id);
 extern int session_set_cur_insert_id (THREAD_ENTRY * thread_p, const DB_VALUE * value, bool force);
 extern int session_reset_cur_insert_id (THREAD_ENTRY * thread_p);
+extern SESSION_SERIAL_CACHE *session_get_serial_cache (THREAD_ENTRY * thread_p);
 extern int session_begin_insert_values (THREAD_ENTRY * thread_p);
 extern int session_set_trigger_state (THREAD_ENTRY * thread_p, bool is_trigger);
 extern int session_get_row_count (THREAD_ENTRY * thread_p, int *row_count);
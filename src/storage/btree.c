@@ -24,6 +24,7 @@
 
 #include "btree.h"
 
+#include "binaryheap.h"
 #include "btree_load.h"
 #include "config.h"
 #include "db_value_printer.hpp"
@@ -49,11 +50,15 @@
 #include "regu_var.hpp"
 #include "fault_injection.h"
 #include "dbtype.h"
+#include "file_io.h"		/* for fileio_os_sysconf */
+#include "server_support.h"
+#include "thread_entry_task.hpp"
 #include "thread_manager.hpp"
 
 #include <assert.h>
 #include <algorithm>
 #include <cinttypes>
+#include <functional>
 #include <stdlib.h>
 #include <string.h>
 
@@ -347,6 +352,10 @@ struct btree_stats_env
   BTREE_STATS *stat_info;
   int pkeys_val_num;
   DB_VALUE pkeys_val[BTREE_STATS_PKEYS_NUM];	/* partial key-value */
+  int hist_stride;		/* sample every hist_stride-th key for the histogram; 0 disables collection */
+  int hist_seen;		/* number of keys passed by since collection started */
+  int hist_count;		/* number of boundary values collected so far */
+  DB_DATA hist_val[STATS_HISTOGRAM_SIZE];	/* collected boundary values, in key order */
 };
 
 /* Structure used by btree_range_search to initialize and handle variables
@@ -1303,6 +1312,9 @@ static int btree_get_subtree_stats (THREAD_ENTRY * thread_p, BTID_INT * btid, PA
 #endif
 static int btree_get_stats_midxkey (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env, DB_MIDXKEY * midxkey);
 static int btree_get_stats_key (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env, MVCC_SNAPSHOT * mvcc_snapshot);
+static bool btree_stats_is_hist_type (DB_TYPE type);
+static bool btree_get_stats_hist_db_data (DB_TYPE type, const DB_VALUE * value, DB_DATA * data);
+static int btree_get_stats_hist_key (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env);
 static int btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env);
 static int btree_get_stats_with_fullscan (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env);
 static DISK_ISVALID btree_check_page_key (THREAD_ENTRY * thread_p, const OID * class_oid_p, BTID_INT * btid,
@@ -1341,6 +1353,7 @@ static int btree_find_next_index_record (THREAD_ENTRY * thread_p, BTREE_SCAN * b
 static int btree_find_next_index_record_holding_current (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, RECDES * peek_rec);
 static int btree_find_next_index_record_holding_current_helper (THREAD_ENTRY * thread_p, BTREE_SCAN * bts,
 								PAGE_PTR first_page);
+static void btree_range_scan_prefetch_link (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, BTREE_NODE_HEADER * header);
 static int btree_apply_key_range_and_filter (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, bool is_iss,
 					     bool * key_range_satisfied, bool * key_filter_satisfied,
 					     bool need_to_check_null);
@@ -1427,9 +1440,7 @@ static int btree_get_next_page_vpid (THREAD_ENTRY * thread_p, PAGE_PTR leaf_page
 static PAGE_PTR btree_get_next_page (THREAD_ENTRY * thread_p, PAGE_PTR page_p);
 static int btree_range_opt_check_add_index_key (THREAD_ENTRY * thread_p, BTREE_SCAN * bts,
 						MULTI_RANGE_OPT * multi_range_opt, OID * p_new_oid, bool * key_added);
-static int btree_top_n_items_binary_search (RANGE_OPT_ITEM ** top_n_items, int *att_idxs, TP_DOMAIN ** domains,
-					    bool * desc_order, DB_VALUE * new_key_values, int num_keys, int first,
-					    int last, int *new_pos);
+static BH_CMP_RESULT btree_range_opt_cmp_items (const void *left, const void *right, BH_CMP_ARG arg);
 static int btree_iss_set_key (BTREE_SCAN * bts, INDEX_SKIP_SCAN * iss);
 static int btree_insert_mvcc_delid_into_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr,
 					      BTREE_NODE_TYPE node_type, DB_VALUE * key,
@@ -1565,6 +1576,26 @@ static int btree_undo_delete_physical (THREAD_ENTRY * thread_p, BTID * btid, DB_
 static int btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
 				      PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
 				      bool * stop, bool * restart, void *other_args);
+
+/* Hints to the rightmost leaf of append-mostly indexes (serial/timestamp keys). A hint is recorded after inserting a
+ * new key into the rightmost leaf and validated by page LSA on use: an unchanged LSA means the page is unchanged, so
+ * it is still the rightmost leaf of its b-tree and inserts of bigger keys can go straight to it, skipping the
+ * descent from root. */
+#define BTREE_RIGHTMOST_HINT_COUNT 64
+typedef struct btree_rightmost_hint BTREE_RIGHTMOST_HINT;
+struct btree_rightmost_hint
+{
+  BTID btid;			/* B-tree identifier. */
+  VPID leaf_vpid;		/* Rightmost leaf page identifier. */
+  LOG_LSA leaf_lsa;		/* Leaf page LSA when the hint was recorded. */
+};
+static BTREE_RIGHTMOST_HINT btree_Rightmost_hints[BTREE_RIGHTMOST_HINT_COUNT];
+static pthread_mutex_t btree_Rightmost_hint_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static bool btree_rightmost_leaf_hint_get (BTID * btid, VPID * leaf_vpid, LOG_LSA * leaf_lsa);
+static void btree_rightmost_leaf_hint_set (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf_page);
+static PAGE_PTR btree_insert_try_rightmost_leaf (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
+						 BTREE_INSERT_HELPER * insert_helper);
 static int btree_split_node_and_advance (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 					 PAGE_PTR * crt_page, PAGE_PTR * advance_to_page, bool * is_leaf,
 					 BTREE_SEARCH_KEY_HELPER * search_key, bool * stop, bool * restart,
@@ -6189,6 +6220,191 @@ btree_get_unique_statistics_for_count (THREAD_ENTRY * thread_p, BTID * btid, lon
   return NO_ERROR;
 }
 
+/*
+ * btree_count_all_visible_oids () - count the objects visible to the current snapshot by walking the leaf level
+ *   return: NO_ERROR, or error code
+ *   btid(in): B+tree index identifier
+ *   count(out): number of visible objects
+ *
+ * Note: answers COUNT(*) for indexes that keep no unique statistics. The leaf chain is walked page by page and each
+ *	 record (including its overflow OID pages) is checked against the snapshot; keys are never unpacked. Rows
+ *	 whose key is NULL have no b-tree entry, so the caller must make sure the index is built on an attribute that
+ *	 cannot be NULL.
+ */
+int
+btree_count_all_visible_oids (THREAD_ENTRY * thread_p, BTID * btid, long long *count)
+{
+  VPID root_vpid;
+  VPID next_vpid;
+  PAGE_PTR root_page_ptr = NULL;
+  PAGE_PTR leaf_page = NULL;
+  BTREE_ROOT_HEADER *root_header = NULL;
+  BTREE_NODE_HEADER *header = NULL;
+  BTREE_SCAN btree_scan, *BTS;
+  MVCC_SNAPSHOT *mvcc_snapshot = NULL;
+  RECDES rec;
+  LEAF_REC leaf_pnt;
+  DB_VALUE key_value;
+  bool clear_key = false;
+  int key_cnt, i, offset, num_visible;
+  int ret = NO_ERROR;
+
+  assert (count != NULL);
+
+  *count = 0;
+
+  mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+  if (mvcc_snapshot == NULL)
+    {
+      ASSERT_ERROR_AND_SET (ret);
+      return ret;
+    }
+
+  btree_init_temp_key_value (&clear_key, &key_value);
+
+  BTS = &btree_scan;
+  BTREE_INIT_SCAN (BTS);
+
+  BTS->btid_int.sys_btid = btid;
+
+  root_vpid.pageid = btid->root_pageid;
+  root_vpid.volid = btid->vfid.volid;
+
+  root_page_ptr = pgbuf_fix (thread_p, &root_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (root_page_ptr == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  (void) pgbuf_check_page_ptype (thread_p, root_page_ptr, PAGE_BTREE);
+
+  root_header = btree_get_root_header (thread_p, root_page_ptr);
+  if (root_header == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  ret = btree_glean_root_header_info (thread_p, root_header, &BTS->btid_int);
+  if (ret != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  pgbuf_unfix_and_init (thread_p, root_page_ptr);
+
+  /* descend to the leftmost leaf and follow the next links */
+  BTS->use_desc_index = 0;
+  ret = btree_find_lower_bound_leaf (thread_p, BTS, NULL);
+  if (ret != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  if (BTREE_END_OF_SCAN (BTS))
+    {
+      /* empty tree */
+      goto end;
+    }
+
+  leaf_page = BTS->C_page;
+  BTS->C_page = NULL;
+
+  while (leaf_page != NULL)
+    {
+      key_cnt = btree_node_number_of_keys (thread_p, leaf_page);
+
+      header = btree_get_node_header (thread_p, leaf_page);
+      if (header == NULL)
+	{
+	  goto exit_on_error;
+	}
+      next_vpid = header->next_vpid;
+
+      for (i = 1; i <= key_cnt; i++)
+	{
+	  if (spage_get_record (thread_p, leaf_page, i, &rec, PEEK) != S_SUCCESS)
+	    {
+	      goto exit_on_error;
+	    }
+
+	  if (btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_FENCE))
+	    {
+	      continue;
+	    }
+
+	  /* only the offset past the packed key is needed; the truncated key of a compressed record is good enough */
+	  ret = btree_read_record_without_decompression (thread_p, &BTS->btid_int, &rec, &key_value, &leaf_pnt,
+							 BTREE_LEAF_NODE, &clear_key, &offset, PEEK_KEY_VALUE);
+	  if (ret != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	  btree_clear_key_value (&clear_key, &key_value);
+
+	  ret = btree_get_num_visible_from_leaf_and_ovf (thread_p, &BTS->btid_int, &rec, offset, &leaf_pnt, NULL,
+							 mvcc_snapshot, &num_visible);
+	  if (ret != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+
+	  (*count) += num_visible;
+	}
+
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+
+      if (VPID_ISNULL (&next_vpid))
+	{
+	  break;
+	}
+
+      leaf_page = pgbuf_fix (thread_p, &next_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+      if (leaf_page == NULL)
+	{
+	  goto exit_on_error;
+	}
+
+      (void) pgbuf_check_page_ptype (thread_p, leaf_page, PAGE_BTREE);
+    }
+
+end:
+
+  if (BTS->P_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, BTS->P_page);
+    }
+
+  if (BTS->C_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, BTS->C_page);
+    }
+
+  if (BTS->O_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, BTS->O_page);
+    }
+
+  if (leaf_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+    }
+
+  if (root_page_ptr != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, root_page_ptr);
+    }
+
+  btree_clear_key_value (&clear_key, &key_value);
+
+  return ret;
+
+exit_on_error:
+
+  ret = (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
+
+  goto end;
+}
+
 /*
  * btree_get_unique_statistics () -
  *   returns: NO_ERROR
@@ -6662,6 +6878,193 @@ count_keys:
 	}
     }
 
+  if (env->hist_stride > 0)
+    {
+      /* sample the key as a histogram bucket boundary */
+      ret = btree_get_stats_hist_key (thread_p, env);
+      if (ret != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+    }
+
+end:
+
+  if (clear_key)
+    {
+      pr_clear_value (&key_value);
+      clear_key = false;
+    }
+
+  return ret;
+
+exit_on_error:
+
+  ret = (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
+
+  goto end;
+}
+
+/*
+ * btree_stats_is_hist_type () -
+ *   return: true if keys of the given type can be kept as histogram boundaries
+ *   type(in): key type of the index
+ */
+static bool
+btree_stats_is_hist_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SHORT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_MONETARY:
+      return true;
+    default:
+      return false;
+    }
+}
+
+/*
+ * btree_get_stats_hist_db_data () - Extract the raw data portion of a key value
+ *   return: true if the value was extracted
+ *   type(in): type of the key value
+ *   value(in): key value
+ *   data(out): raw data portion to be kept as a histogram boundary
+ */
+static bool
+btree_get_stats_hist_db_data (DB_TYPE type, const DB_VALUE * value, DB_DATA * data)
+{
+  memset (data, 0, sizeof (DB_DATA));
+
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+      data->i = db_get_int (value);
+      break;
+    case DB_TYPE_SHORT:
+      data->sh = db_get_short (value);
+      break;
+    case DB_TYPE_BIGINT:
+      data->bigint = db_get_bigint (value);
+      break;
+    case DB_TYPE_FLOAT:
+      data->f = db_get_float (value);
+      break;
+    case DB_TYPE_DOUBLE:
+      data->d = db_get_double (value);
+      break;
+    case DB_TYPE_DATE:
+      data->date = *(db_get_date (value));
+      break;
+    case DB_TYPE_TIME:
+      data->time = *(db_get_time (value));
+      break;
+    case DB_TYPE_TIMESTAMP:
+      data->utime = *(db_get_timestamp (value));
+      break;
+    case DB_TYPE_DATETIME:
+      data->datetime = *(db_get_datetime (value));
+      break;
+    case DB_TYPE_MONETARY:
+      data->money = *(db_get_monetary (value));
+      break;
+    default:
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * btree_get_stats_hist_key () - Sample the current key as an equi-depth histogram boundary
+ *   return: NO_ERROR
+ *   env(in/out): Structure to store and return the statistical information
+ *
+ * Note: every hist_stride-th key is kept as a bucket boundary; when the boundary array fills up, every other
+ * boundary is dropped and the stride is doubled. A single ordered pass thus yields at most STATS_HISTOGRAM_SIZE
+ * boundaries at (approximately) equal key-rank spacing, regardless of the total key count.
+ */
+static int
+btree_get_stats_hist_key (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env)
+{
+  BTREE_SCAN *BTS;
+  RECDES rec;
+  DB_VALUE key_value;
+  LEAF_REC leaf_pnt;
+  bool clear_key = false;
+  int offset;
+  int i, j;
+  int ret = NO_ERROR;
+
+  assert (env != NULL);
+  assert (env->hist_stride > 0);
+  assert (env->hist_count < STATS_HISTOGRAM_SIZE);
+
+  env->hist_seen++;
+  if (env->hist_seen % env->hist_stride != 0)
+    {
+      return NO_ERROR;
+    }
+
+  btree_init_temp_key_value (&clear_key, &key_value);
+
+  BTS = &(env->btree_scan);
+
+  if (BTS->C_page == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  assert (BTS->slot_id > 0);
+  if (spage_get_record (thread_p, BTS->C_page, BTS->slot_id, &rec, PEEK) != S_SUCCESS)
+    {
+      goto exit_on_error;
+    }
+
+  /* filter out fence_key */
+  if (btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_FENCE))
+    {
+      goto end;
+    }
+
+  /* read key-value */
+  assert (clear_key == false);
+
+  if (btree_read_record (thread_p, &BTS->btid_int, BTS->C_page, &rec, &key_value, (void *) &leaf_pnt, BTREE_LEAF_NODE,
+			 &clear_key, &offset, PEEK_KEY_VALUE, NULL) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  if (DB_IS_NULL (&key_value)
+      || !btree_get_stats_hist_db_data (DB_VALUE_DOMAIN_TYPE (&key_value), &key_value,
+					&(env->hist_val[env->hist_count])))
+    {
+      /* no usable boundary value; give up histogram collection for this index */
+      env->hist_stride = 0;
+      env->hist_count = 0;
+      goto end;
+    }
+  env->hist_count++;
+
+  if (env->hist_count == STATS_HISTOGRAM_SIZE)
+    {
+      /* full; keep every other boundary and double the stride */
+      for (i = 1, j = 0; i < env->hist_count; i += 2)
+	{
+	  env->hist_val[j++] = env->hist_val[i];
+	}
+      env->hist_count = j;
+      env->hist_stride *= 2;
+    }
+
 end:
 
   if (clear_key)
@@ -6692,6 +7095,7 @@ btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env
   bool found;
   int key_cnt;
   int exp_ratio;
+  int max_leafs, max_trials;
   int ret = NO_ERROR;
 #if !defined(NDEBUG)
   BTREE_NODE_HEADER *header = NULL;
@@ -6700,12 +7104,16 @@ btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env
   assert (env != NULL);
   assert (env->stat_info != NULL);
 
+  /* sample size is tunable; keep the original trial-to-sample ratio so that larger samples still converge */
+  max_leafs = MAX (prm_get_integer_value (PRM_ID_STATS_SAMPLING_PAGES), 1);
+  max_trials = MAX (STATS_SAMPLING_THRESHOLD, max_leafs * (STATS_SAMPLING_THRESHOLD / STATS_SAMPLING_LEAFS_MAX));
+
   BTS = &(env->btree_scan);
   BTS->use_desc_index = 0;	/* init */
 
-  for (n = 0; n < STATS_SAMPLING_THRESHOLD; n++)
+  for (n = 0; n < max_trials; n++)
     {
-      if (env->stat_info->leafs >= STATS_SAMPLING_LEAFS_MAX)
+      if (env->stat_info->leafs >= max_leafs)
 	{
 	  break;		/* found all samples */
 	}
@@ -7012,6 +7420,9 @@ btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, bool with_f
   env->btree_scan.btid_int.sys_btid = &(stat_info_p->btid);
   env->stat_info = stat_info_p;
   env->pkeys_val_num = stat_info_p->pkeys_size;
+  env->hist_stride = 0;
+  env->hist_seen = 0;
+  env->hist_count = 0;
 
   assert (env->pkeys_val_num <= BTREE_STATS_PKEYS_NUM);
   for (i = 0; i < env->pkeys_val_num; i++)
@@ -7088,10 +7499,18 @@ btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, bool with_f
   if (with_fullscan || npages <= STATS_SAMPLING_THRESHOLD)
     {
       /* do fullscan at small table */
+      if (env->pkeys_val_num == 1 && btree_stats_is_hist_type (dom_type))
+	{
+	  /* the scan below visits every key in order, so equi-depth boundaries can be resampled */
+	  env->stat_info->hist_size = 0;
+	  env->hist_stride = 1;
+	}
+
       ret = btree_get_stats_with_fullscan (thread_p, env);
     }
   else
     {
+      /* keep the previously gathered histogram, if any; the sampling scan does not visit every key */
       ret = btree_get_stats_with_AR_sampling (thread_p, env);
     }
 
@@ -7100,6 +7519,13 @@ btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, bool with_f
       goto exit_on_error;
     }
 
+  if (env->hist_stride > 0 && env->hist_count > 1)
+    {
+      assert (env->hist_count <= STATS_HISTOGRAM_SIZE);
+      memcpy (env->stat_info->hist, env->hist_val, env->hist_count * STATS_HISTOGRAM_VALUE_SIZE);
+      env->stat_info->hist_size = env->hist_count;
+    }
+
   /* check for emptiness */
   for (i = 0; i < env->pkeys_val_num; i++)
     {
@@ -8192,97 +8618,320 @@ btree_repair_prev_link_by_class_oid (THREAD_ENTRY * thread_p, OID * oid, BTID *
       valid = btree_repair_prev_link_by_btid (thread_p, &curr->btid, repair, index_name);
       if (index_name)
 	{
-	  free_and_init (index_name);
+	  free_and_init (index_name);
+	}
+    }
+
+  lock_unlock_object (thread_p, oid, oid_Root_class_oid, IS_LOCK, true);
+  if (cls_repr)
+    {
+      heap_classrepr_free_and_init (cls_repr, &cache_idx);
+    }
+
+  return valid;
+}
+
+/*
+ * btree_repair_prev_link () -
+ *   oid(in) :
+ *   index_btid(in) :
+ *   repair(in) :
+ *   return:
+ */
+DISK_ISVALID
+btree_repair_prev_link (THREAD_ENTRY * thread_p, OID * oid, BTID * index_btid, bool repair)
+{
+  BTID btid;
+  DISK_ISVALID valid;
+  char *index_name = NULL;
+  OID class_oid = OID_INITIALIZER;
+
+  if (oid != NULL && !OID_ISNULL (oid))
+    {
+      return btree_repair_prev_link_by_class_oid (thread_p, oid, index_btid, repair);
+    }
+
+  valid = DISK_VALID;
+
+  /* Go to each file, check only the btree files */
+  VFID_SET_NULL (&btid.vfid);
+  while (true)
+    {
+      if (file_tracker_interruptable_iterate (thread_p, FILE_BTREE, &btid.vfid, &class_oid) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  valid = valid == DISK_VALID ? DISK_ERROR : valid;
+	  break;
+	}
+      if (VFID_ISNULL (&btid.vfid))
+	{
+	  /* no more b-trees */
+	  break;
+	}
+
+      if (btree_get_btid_from_file (thread_p, &btid.vfid, &btid) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  valid = valid == DISK_VALID ? DISK_ERROR : valid;
+	  break;
+	}
+
+      /* get the index name of the index key */
+      if (heap_get_indexinfo_of_btid (thread_p, &class_oid, &btid, NULL, NULL, NULL, NULL, &index_name, NULL)
+	  != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  valid = valid == DISK_VALID ? DISK_ERROR : valid;
+	  break;
+	}
+
+      valid = btree_repair_prev_link_by_btid (thread_p, &btid, repair, index_name);
+      if (valid == DISK_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  break;
+	}
+    }
+  if (!OID_ISNULL (&class_oid))
+    {
+      lock_unlock_object (thread_p, &class_oid, oid_Root_class_oid, SCH_S_LOCK, true);
+    }
+
+  return valid;
+}
+
+#if defined (SERVER_MODE)
+/* BTREE_CHECK_SHARED - progress/error collector shared by the workers that
+ * check the b-tree files collected for btree_check_all () */
+typedef struct btree_check_shared BTREE_CHECK_SHARED;
+struct btree_check_shared
+{
+  pthread_mutex_t mtx;		/* protects all the fields below */
+  BTID *btids;			/* b-trees collected from the file tracker */
+  int nbtids;			/* number of collected b-trees */
+  int next;			/* next b-tree to claim */
+  int ndone_workers;		/* pushed workers that have finished */
+  bool stop;			/* set on DISK_ERROR; stop claiming */
+  DISK_ISVALID allvalid;	/* merged validation result */
+  int tran_index;		/* transaction doing the check */
+};
+
+/*
+ * btree_check_consume () - claim and check collected b-trees until none remain
+ *   return:
+ *   thread_p(in):
+ *   shared_p(in/out): shared progress/error collector
+ */
+static void
+btree_check_consume (THREAD_ENTRY * thread_p, BTREE_CHECK_SHARED * shared_p)
+{
+  DISK_ISVALID valid;
+  BTID btid;
+  int rv;
+
+  while (true)
+    {
+      rv = pthread_mutex_lock (&shared_p->mtx);
+      assert (rv == NO_ERROR);
+
+      if (shared_p->stop || shared_p->next >= shared_p->nbtids)
+	{
+	  pthread_mutex_unlock (&shared_p->mtx);
+	  break;
+	}
+      btid = shared_p->btids[shared_p->next++];
+      pthread_mutex_unlock (&shared_p->mtx);
+
+      valid = btree_check_by_btid (thread_p, &btid);
+
+      rv = pthread_mutex_lock (&shared_p->mtx);
+      assert (rv == NO_ERROR);
+
+      if (valid == DISK_ERROR)
+	{
+	  shared_p->allvalid = (shared_p->allvalid == DISK_VALID) ? DISK_ERROR : shared_p->allvalid;
+	  shared_p->stop = true;
+	  pthread_mutex_unlock (&shared_p->mtx);
+	  break;
+	}
+      if (valid == DISK_INVALID)
+	{
+	  assert_release (false);
+	  shared_p->allvalid = valid;
 	}
+      pthread_mutex_unlock (&shared_p->mtx);
     }
+}
 
-  lock_unlock_object (thread_p, oid, oid_Root_class_oid, IS_LOCK, true);
-  if (cls_repr)
-    {
-      heap_classrepr_free_and_init (cls_repr, &cache_idx);
-    }
+// *INDENT-OFF*
+static void
+btree_check_all_execute (cubthread::entry &thread_ref, BTREE_CHECK_SHARED *shared_p)
+{
+  thread_ref.tran_index = shared_p->tran_index;
+  pthread_mutex_unlock (&thread_ref.tran_index_lock);
 
-  return valid;
+  btree_check_consume (&thread_ref, shared_p);
+
+  pthread_mutex_lock (&shared_p->mtx);
+  shared_p->ndone_workers++;
+  pthread_mutex_unlock (&shared_p->mtx);
 }
+// *INDENT-ON*
+#endif /* SERVER_MODE */
 
 /*
- * btree_repair_prev_link () -
- *   oid(in) :
- *   index_btid(in) :
- *   repair(in) :
- *   return:
+ * btree_check_all () -
+ *   return: either: DISK_INVALID, DISK_VALID, DISK_ERROR
+ *
+ * Note: Verify that all pages of all btree indices are valid.
  */
 DISK_ISVALID
-btree_repair_prev_link (THREAD_ENTRY * thread_p, OID * oid, BTID * index_btid, bool repair)
+btree_check_all (THREAD_ENTRY * thread_p)
 {
+#if defined (SERVER_MODE)
+  /* Collect every b-tree first, then check them as independent jobs spread
+   * over the request worker pool; the per-index traversals dominate the run
+   * time and do not depend on each other. */
+  BTREE_CHECK_SHARED shared;
+  DISK_ISVALID allvalid;	/* Validation return code */
   BTID btid;
-  DISK_ISVALID valid;
-  char *index_name = NULL;
-  OID class_oid = OID_INITIALIZER;
+  BTID *btids = NULL;
+  OID *locked_classes = NULL;
+  int nbtids = 0, max_btids = 0, nlocked = 0;
+  int nworkers, npushed = 0;
+  int i, rv;
 
-  if (oid != NULL && !OID_ISNULL (oid))
-    {
-      return btree_repair_prev_link_by_class_oid (thread_p, oid, index_btid, repair);
-    }
+  OID class_oid = OID_INITIALIZER;
 
-  valid = DISK_VALID;
+  int error_code = NO_ERROR;
 
-  /* Go to each file, check only the btree files */
+  allvalid = DISK_VALID;
+  /* Go to each file, collect only the btree files */
   VFID_SET_NULL (&btid.vfid);
   while (true)
     {
-      if (file_tracker_interruptable_iterate (thread_p, FILE_BTREE, &btid.vfid, &class_oid) != NO_ERROR)
+      error_code = file_tracker_interruptable_iterate (thread_p, FILE_BTREE, &btid.vfid, &class_oid);
+      if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
-	  valid = valid == DISK_VALID ? DISK_ERROR : valid;
+	  allvalid = (allvalid == DISK_VALID) ? DISK_ERROR : allvalid;
 	  break;
 	}
       if (VFID_ISNULL (&btid.vfid))
 	{
-	  /* no more b-trees */
+	  /* no more b-tree files */
 	  break;
 	}
+      assert (!OID_ISNULL (&class_oid));
 
-      if (btree_get_btid_from_file (thread_p, &btid.vfid, &btid) != NO_ERROR)
+      if (nbtids >= max_btids)
 	{
-	  ASSERT_ERROR ();
-	  valid = valid == DISK_VALID ? DISK_ERROR : valid;
-	  break;
+	  BTID *btids_new;
+	  OID *locked_new;
+
+	  max_btids = (max_btids == 0) ? 64 : max_btids * 2;
+	  btids_new = (BTID *) db_private_realloc (thread_p, btids, max_btids * sizeof (BTID));
+	  if (btids_new == NULL)
+	    {
+	      allvalid = (allvalid == DISK_VALID) ? DISK_ERROR : allvalid;
+	      break;
+	    }
+	  btids = btids_new;
+	  /* each b-tree locks at most one class, so the same bound fits */
+	  locked_new = (OID *) db_private_realloc (thread_p, locked_classes, max_btids * sizeof (OID));
+	  if (locked_new == NULL)
+	    {
+	      allvalid = (allvalid == DISK_VALID) ? DISK_ERROR : allvalid;
+	      break;
+	    }
+	  locked_classes = locked_new;
 	}
+      btids[nbtids++] = btid;
 
-      /* get the index name of the index key */
-      if (heap_get_indexinfo_of_btid (thread_p, &class_oid, &btid, NULL, NULL, NULL, NULL, &index_name, NULL)
-	  != NO_ERROR)
+      /* remember the class so its lock can be released once the checks are
+       * done; the iterator would release it on the next call otherwise */
+      for (i = 0; i < nlocked; i++)
 	{
-	  ASSERT_ERROR ();
-	  valid = valid == DISK_VALID ? DISK_ERROR : valid;
-	  break;
+	  if (OID_EQ (&locked_classes[i], &class_oid))
+	    {
+	      break;
+	    }
+	}
+      if (i == nlocked)
+	{
+	  locked_classes[nlocked++] = class_oid;
 	}
+      OID_SET_NULL (&class_oid);
+    }
 
-      valid = btree_repair_prev_link_by_btid (thread_p, &btid, repair, index_name);
-      if (valid == DISK_ERROR)
+  if (allvalid == DISK_VALID && nbtids > 0)
+    {
+      pthread_mutex_init (&shared.mtx, NULL);
+      shared.btids = btids;
+      shared.nbtids = nbtids;
+      shared.next = 0;
+      shared.ndone_workers = 0;
+      shared.stop = false;
+      shared.allvalid = DISK_VALID;
+      shared.tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+
+      nworkers = MIN (nbtids, fileio_os_sysconf ());
+      if (css_get_current_conn_entry () != NULL)
 	{
-	  ASSERT_ERROR ();
-	  break;
+	  /* boot-time consistency checks run without a connection entry and
+	   * cannot push external tasks; they check on this thread only */
+	  // *INDENT-OFF*
+	  for (i = 1; i < nworkers; i++)
+	    {
+	      cubthread::entry_callable_task *task =
+		new cubthread::entry_callable_task (std::bind (btree_check_all_execute, std::placeholders::_1,
+							       &shared));
+	      css_push_external_task (css_get_current_conn_entry (), task);
+	      npushed++;
+	    }
+	  // *INDENT-ON*
 	}
+
+      /* this thread checks b-trees as well */
+      btree_check_consume (thread_p, &shared);
+
+      /* wait for the pushed workers to finish */
+      while (true)
+	{
+	  rv = pthread_mutex_lock (&shared.mtx);
+	  assert (rv == NO_ERROR);
+	  if (shared.ndone_workers >= npushed)
+	    {
+	      pthread_mutex_unlock (&shared.mtx);
+	      break;
+	    }
+	  pthread_mutex_unlock (&shared.mtx);
+
+	  thread_sleep (10);	/* 10 msec */
+	}
+
+      allvalid = shared.allvalid;
+      pthread_mutex_destroy (&shared.mtx);
+    }
+
+  for (i = 0; i < nlocked; i++)
+    {
+      lock_unlock_object (thread_p, &locked_classes[i], oid_Root_class_oid, SCH_S_LOCK, true);
     }
   if (!OID_ISNULL (&class_oid))
     {
       lock_unlock_object (thread_p, &class_oid, oid_Root_class_oid, SCH_S_LOCK, true);
     }
-
-  return valid;
-}
-
-/*
- * btree_check_all () -
- *   return: either: DISK_INVALID, DISK_VALID, DISK_ERROR
- *
- * Note: Verify that all pages of all btree indices are valid.
- */
-DISK_ISVALID
-btree_check_all (THREAD_ENTRY * thread_p)
-{
+  if (btids != NULL)
+    {
+      db_private_free_and_init (thread_p, btids);
+    }
+  if (locked_classes != NULL)
+    {
+      db_private_free_and_init (thread_p, locked_classes);
+    }
+  return allvalid;
+#else /* SERVER_MODE */
   DISK_ISVALID valid, allvalid;	/* Validation return code */
   BTID btid;
 
@@ -8329,6 +8978,7 @@ btree_check_all (THREAD_ENTRY * thread_p)
       lock_unlock_object (thread_p, &class_oid, oid_Root_class_oid, SCH_S_LOCK, true);
     }
   return allvalid;
+#endif /* !SERVER_MODE */
 }
 
 /*
@@ -12632,6 +13282,188 @@ btree_compress_node (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr
   return error;
 }
 
+/*
+ * btree_load_compress_leaf_page () - Add fence records and compress a leaf page produced by the index loader.
+ *
+ * return	 : Error code.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree info.
+ * page_ptr (in) : Completed leaf page built by the loader; not yet logged.
+ * next_key (in) : First key of the next leaf page; the upper fence must be strictly bigger than all keys in page,
+ *		   so it is built as a separator between the last key and next_key, like split does.
+ *
+ * Note: Pages built by btree_construct_leafs have no fence records, so they stay uncompressed until their first
+ *	 split. For multi-column keys that share a common prefix, insert the lower/upper fences here (lower is a
+ *	 copy of the first key, like the right page of a split gets) and compress the records in between. The page
+ *	 is left uncompressed when there is no common prefix, when a border key is an overflow key or when the
+ *	 fence records do not fit. The rightmost leaf has no next key and stays uncompressed, consistent with split
+ *	 pages (the rightmost leaf never carries an upper fence).
+ */
+int
+btree_load_compress_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, DB_VALUE * next_key)
+{
+  RECDES peek_rec;
+  RECDES lower_fence_rec, upper_fence_rec;
+  char lower_fence_buf[IO_MAX_PAGE_SIZE + BTREE_MAX_ALIGN];
+  char upper_fence_buf[IO_MAX_PAGE_SIZE + BTREE_MAX_ALIGN];
+  DB_VALUE first_key, last_key;
+  DB_VALUE sep_key;
+  bool clear_first_key = false, clear_last_key = false;
+  bool clear_sep_key = false;
+  int first_key_offset, last_key_offset;
+  LEAF_REC leaf_pnt;
+  OID dummy_oid = { NULL_PAGEID, 0, 0 };
+  PR_TYPE *pr_type = NULL;
+  int key_cnt;
+  int key_len;
+  INT16 slotid;
+  int ret = NO_ERROR;
+
+  assert (page_ptr != NULL);
+  assert (btid != NULL);
+
+  if (next_key == NULL || DB_IS_NULL (next_key) || TP_DOMAIN_TYPE (btid->key_type) != DB_TYPE_MIDXKEY
+      || prm_get_bool_value (PRM_ID_USE_BTREE_FENCE_KEY) == false)
+    {
+      return NO_ERROR;
+    }
+
+  key_cnt = btree_node_number_of_keys (thread_p, page_ptr);
+  if (key_cnt < 2)
+    {
+      return NO_ERROR;
+    }
+
+  btree_init_temp_key_value (&clear_first_key, &first_key);
+  btree_init_temp_key_value (&clear_last_key, &last_key);
+  db_make_null (&sep_key);
+
+  /* Read the border keys. The page has no fence records yet. */
+  if (spage_get_record (thread_p, page_ptr, 1, &peek_rec, PEEK) != S_SUCCESS)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+  if (btree_leaf_is_flaged (&peek_rec, BTREE_LEAF_RECORD_OVERFLOW_KEY))
+    {
+      return NO_ERROR;
+    }
+  ret =
+    btree_read_record_without_decompression (thread_p, btid, &peek_rec, &first_key, &leaf_pnt, BTREE_LEAF_NODE,
+					     &clear_first_key, &first_key_offset, PEEK_KEY_VALUE);
+  if (ret != NO_ERROR)
+    {
+      goto cleanup;
+    }
+
+  if (spage_get_record (thread_p, page_ptr, key_cnt, &peek_rec, PEEK) != S_SUCCESS)
+    {
+      assert_release (false);
+      ret = ER_FAILED;
+      goto cleanup;
+    }
+  if (btree_leaf_is_flaged (&peek_rec, BTREE_LEAF_RECORD_OVERFLOW_KEY))
+    {
+      goto cleanup;
+    }
+  ret =
+    btree_read_record_without_decompression (thread_p, btid, &peek_rec, &last_key, &leaf_pnt, BTREE_LEAF_NODE,
+					     &clear_last_key, &last_key_offset, PEEK_KEY_VALUE);
+  if (ret != NO_ERROR)
+    {
+      goto cleanup;
+    }
+
+  /* Upper fence: separator strictly bigger than the last key, smaller than or equal to next_key. */
+  if (btree_get_prefix_separator (&last_key, next_key, &sep_key, btid->key_type) != NO_ERROR)
+    {
+      ret = ER_FAILED;
+      goto cleanup;
+    }
+  clear_sep_key = true;
+
+  if (pr_midxkey_common_prefix (&first_key, &sep_key) <= 0)
+    {
+      /* nothing to gain */
+      goto cleanup;
+    }
+
+  /* Build both fence records before touching the page; the peeked keys point into page memory. */
+  pr_type = btid->key_type->type;
+
+  lower_fence_rec.area_size = DB_PAGESIZE;
+  lower_fence_rec.data = PTR_ALIGN (lower_fence_buf, BTREE_MAX_ALIGN);
+  key_len = pr_type->get_index_size_of_value (&first_key);
+  if (key_len >= BTREE_MAX_KEYLEN_INPAGE)
+    {
+      goto cleanup;
+    }
+  ret =
+    btree_write_record (thread_p, btid, NULL, &first_key, BTREE_LEAF_NODE, BTREE_NORMAL_KEY, key_len, false,
+			&btid->topclass_oid, &dummy_oid, NULL, &lower_fence_rec);
+  if (ret != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto cleanup;
+    }
+  btree_leaf_set_flag (&lower_fence_rec, BTREE_LEAF_RECORD_FENCE);
+
+  upper_fence_rec.area_size = DB_PAGESIZE;
+  upper_fence_rec.data = PTR_ALIGN (upper_fence_buf, BTREE_MAX_ALIGN);
+  key_len = pr_type->get_index_size_of_value (&sep_key);
+  if (key_len >= BTREE_MAX_KEYLEN_INPAGE)
+    {
+      goto cleanup;
+    }
+  ret =
+    btree_write_record (thread_p, btid, NULL, &sep_key, BTREE_LEAF_NODE, BTREE_NORMAL_KEY, key_len, false,
+			&btid->topclass_oid, &dummy_oid, NULL, &upper_fence_rec);
+  if (ret != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto cleanup;
+    }
+  btree_leaf_set_flag (&upper_fence_rec, BTREE_LEAF_RECORD_FENCE);
+
+  /* Both fences must fit before compression reclaims any space; 16 bytes covers the slot entries and alignment. */
+  if (spage_max_space_for_new_record (thread_p, page_ptr)
+      < lower_fence_rec.length + upper_fence_rec.length + 16)
+    {
+      goto cleanup;
+    }
+
+  btree_clear_key_value (&clear_first_key, &first_key);
+  btree_clear_key_value (&clear_last_key, &last_key);
+  btree_clear_key_value (&clear_sep_key, &sep_key);
+
+  if (spage_insert_at (thread_p, page_ptr, 1, &lower_fence_rec) != SP_SUCCESS)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+  if (spage_insert (thread_p, page_ptr, &upper_fence_rec, &slotid) != SP_SUCCESS)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+  assert (slotid == key_cnt + 2);
+
+  ret = btree_compress_node (thread_p, btid, page_ptr);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  return NO_ERROR;
+
+cleanup:
+  btree_clear_key_value (&clear_first_key, &first_key);
+  btree_clear_key_value (&clear_last_key, &last_key);
+  btree_clear_key_value (&clear_sep_key, &sep_key);
+
+  return ret;
+}
+
 /*
  * btree_split_node () -
  *   return: NO_ERROR
@@ -14265,6 +15097,9 @@ btree_find_lower_bound_leaf (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, BTREE_ST
       goto exit_on_error;
     }
 
+  /* start reading the following leaf in the scan direction right away */
+  btree_range_scan_prefetch_link (thread_p, bts, header);
+
   /* set slot id and OID position */
   if (bts->use_desc_index)
     {
@@ -15746,6 +16581,12 @@ btree_find_next_index_record_holding_current_helper (THREAD_ENTRY * thread_p, BT
 
 	  key_cnt = btree_node_number_of_keys (thread_p, bts->C_page);
 
+	  header = btree_get_node_header (thread_p, bts->C_page);
+	  if (header != NULL)
+	    {
+	      btree_range_scan_prefetch_link (thread_p, bts, header);
+	    }
+
 	  if (key_cnt > 0)
 	    {
 	      if (bts->use_desc_index)
@@ -15779,6 +16620,29 @@ exit_on_error:
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
 
+/*
+ * btree_range_scan_prefetch_link () - Start reading the leaf that follows the given one in the scan direction
+ *   return: none
+ *   bts(in): B+-tree scan; decides the walk direction
+ *   header(in): node header of the leaf the scan has just moved to
+ *
+ * Note: Overlaps the physical read of the following leaf with the consumption of the current one, so a range scan
+ *	 walking the leaf chain does not stall once per leaf. Descending scans benefit the most: they follow the
+ *	 prev-links of leaves whose layout gives the I/O layer no sequential pattern to notice, and their conditional
+ *	 latching makes every synchronous stall also a window for an aborting latch conflict.
+ */
+static void
+btree_range_scan_prefetch_link (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, BTREE_NODE_HEADER * header)
+{
+  VPID link_vpid;
+
+  link_vpid = bts->use_desc_index ? header->prev_vpid : header->next_vpid;
+  if (!VPID_ISNULL (&link_vpid))
+    {
+      (void) pgbuf_prefetch_range (thread_p, &link_vpid, 1);
+    }
+}
+
 /*
  * btree_apply_key_range_and_filter () - Apply key range and key filter condition
  *   return: NO_ERROR
@@ -18720,6 +19584,33 @@ btree_compare_key (DB_VALUE * key1, DB_VALUE * key2, TP_DOMAIN * key_domain, int
       return DB_GT;
     }
 
+  /* Fast path for fixed-size numeric key domains. The comparability checks and the indirect cmpval dispatch below
+   * dominate the cost of each probe of the intra-page binary searches; same-type integers need neither. */
+  if (dom_type == DB_TYPE_INTEGER && key1_type == DB_TYPE_INTEGER && key2_type == DB_TYPE_INTEGER)
+    {
+      int i1 = db_get_int (key1);
+      int i2 = db_get_int (key2);
+
+      c = (i1 < i2) ? DB_LT : (i1 > i2) ? DB_GT : DB_EQ;
+      if (key_domain->is_desc)
+	{
+	  c = ((c == DB_GT) ? DB_LT : (c == DB_LT) ? DB_GT : c);
+	}
+      return c;
+    }
+  else if (dom_type == DB_TYPE_BIGINT && key1_type == DB_TYPE_BIGINT && key2_type == DB_TYPE_BIGINT)
+    {
+      DB_BIGINT bi1 = db_get_bigint (key1);
+      DB_BIGINT bi2 = db_get_bigint (key2);
+
+      c = (bi1 < bi2) ? DB_LT : (bi1 > bi2) ? DB_GT : DB_EQ;
+      if (key_domain->is_desc)
+	{
+	  c = ((c == DB_GT) ? DB_LT : (c == DB_LT) ? DB_GT : c);
+	}
+      return c;
+    }
+
   if (dom_type == DB_TYPE_MIDXKEY)
     {
       /* safe code */
@@ -18881,7 +19772,63 @@ btree_compare_individual_key_value (DB_VALUE * key1, DB_VALUE * key2, TP_DOMAIN
 }
 
 /*
- * btree_range_opt_check_add_index_key () - Add key in the array of top N keys for multiple range search optimization.
+ * btree_range_opt_cmp_items () - Heap comparator for the top N items of multiple range search optimization.
+ *
+ * return      : BH_CMP_RESULT
+ * left (in)   : Pointer to a RANGE_OPT_ITEM pointer.
+ * right (in)  : Pointer to a RANGE_OPT_ITEM pointer.
+ * arg (in)    : MULTI_RANGE_OPT structure holding the sort information.
+ *
+ * Note: Returns BH_GT when the left item comes after the right item in the output order of the scan, so the worst
+ *	 retained key sits at the root of the max heap and bh_to_sorted_array () leaves the items best first.
+ */
+static BH_CMP_RESULT
+btree_range_opt_cmp_items (const void *left, const void *right, BH_CMP_ARG arg)
+{
+  MULTI_RANGE_OPT *multi_range_opt = (MULTI_RANGE_OPT *) arg;
+  RANGE_OPT_ITEM *left_item = *(RANGE_OPT_ITEM * const *) left;
+  RANGE_OPT_ITEM *right_item = *(RANGE_OPT_ITEM * const *) right;
+  DB_MIDXKEY *left_mkey, *right_mkey;
+  DB_VALUE left_key_value, right_key_value;
+  int i, c;
+
+  left_mkey = db_get_midxkey (&(left_item->index_value));
+  right_mkey = db_get_midxkey (&(right_item->index_value));
+
+  for (i = 0; i < multi_range_opt->num_attrs; i++)
+    {
+      db_make_null (&left_key_value);
+      db_make_null (&right_key_value);
+
+      if (pr_midxkey_get_element_nocopy (left_mkey, multi_range_opt->sort_att_idx[i], &left_key_value, NULL, NULL)
+	  != NO_ERROR
+	  || pr_midxkey_get_element_nocopy (right_mkey, multi_range_opt->sort_att_idx[i], &right_key_value, NULL, NULL)
+	  != NO_ERROR)
+	{
+	  assert (false);
+	  return BH_CMP_ERROR;
+	}
+
+      c = btree_compare_individual_key_value (&left_key_value, &right_key_value, multi_range_opt->sort_col_dom[i]);
+
+      pr_clear_value (&left_key_value);
+      pr_clear_value (&right_key_value);
+
+      if (c != 0)
+	{
+	  if (multi_range_opt->is_desc_order[i])
+	    {
+	      c = -c;
+	    }
+	  return (c > 0) ? BH_GT : BH_LT;
+	}
+    }
+
+  return BH_EQ;
+}
+
+/*
+ * btree_range_opt_check_add_index_key () - Add key in the top N keys heap for multiple range search optimization.
  *
  * return		    : Error code.
  * thread_p (in)	    : Thread entry.
@@ -18978,18 +19925,36 @@ btree_range_opt_check_add_index_key (THREAD_ENTRY * thread_p, BTREE_SCAN * bts,
       multi_range_opt->has_null_domain = has_null_domain;
     }
 
+  if (multi_range_opt->heap == NULL)
+    {
+      /* first candidate key: the sort information was not known at scan init, so the heap is created here */
+      /* *INDENT-OFF* */
+      multi_range_opt->heap =
+	bh_create (thread_p, multi_range_opt->size, sizeof (RANGE_OPT_ITEM *), btree_range_opt_cmp_items,
+		   multi_range_opt);
+      /* *INDENT-ON* */
+      if (multi_range_opt->heap == NULL)
+	{
+	  error = ER_OUT_OF_VIRTUAL_MEMORY;
+	  goto exit;
+	}
+      /* the scan consumes (and frees) the items through top_n_items, which aliases the heap storage */
+      multi_range_opt->top_n_items = (RANGE_OPT_ITEM **) multi_range_opt->heap->members;
+    }
+
   if (multi_range_opt->cnt == multi_range_opt->size)
     {
       int c = 0;
       DB_MIDXKEY *comp_mkey = NULL;
       DB_VALUE comp_key_value;
       bool reject_new_elem = false;
-      RANGE_OPT_ITEM *last_item = NULL;
+      RANGE_OPT_ITEM *worst_item = NULL;
 
-      last_item = multi_range_opt->top_n_items[multi_range_opt->size - 1];
-      assert (last_item != NULL);
+      /* the root of the heap holds the worst key retained so far */
+      worst_item = multi_range_opt->top_n_items[0];
+      assert (worst_item != NULL);
 
-      comp_mkey = db_get_midxkey (&(last_item->index_value));
+      comp_mkey = db_get_midxkey (&(worst_item->index_value));
 
       /* if all keys are equal, the new element is rejected */
       reject_new_elem = true;
@@ -19031,15 +19996,18 @@ btree_range_opt_check_add_index_key (THREAD_ENTRY * thread_p, BTREE_SCAN * bts,
 	  return NO_ERROR;
 	}
 
-      /* overwrite the last item with the new key and OIDs */
-      pr_clear_value (&(last_item->index_value));
-      pr_clone_value (&(bts->cur_key), &(last_item->index_value));
-      COPY_OID (&(last_item->inst_oid), p_new_oid);
+      /* overwrite the worst item in place with the new key and OIDs, then let it sink to its heap position; the
+       * total order is only restored once, after all ranges are merged */
+      pr_clear_value (&(worst_item->index_value));
+      pr_clone_value (&(bts->cur_key), &(worst_item->index_value));
+      COPY_OID (&(worst_item->inst_oid), p_new_oid);
+
+      bh_down_heap (multi_range_opt->heap, 0);
     }
   else
     {
       RANGE_OPT_ITEM *curr_item = NULL;
-      /* just insert on last position available */
+
       assert (multi_range_opt->cnt < multi_range_opt->size);
 
       curr_item = (RANGE_OPT_ITEM *) db_private_alloc (thread_p, sizeof (RANGE_OPT_ITEM));
@@ -19049,46 +20017,18 @@ btree_range_opt_check_add_index_key (THREAD_ENTRY * thread_p, BTREE_SCAN * bts,
 	  goto exit;
 	}
 
-      multi_range_opt->top_n_items[multi_range_opt->cnt] = curr_item;
       pr_clone_value (&(bts->cur_key), &(curr_item->index_value));
-
       COPY_OID (&(curr_item->inst_oid), p_new_oid);
 
-      multi_range_opt->cnt++;
-    }
-
-  /* find the position for this element */
-  /* if there is only one element => nothing to do */
-  if (multi_range_opt->cnt > 1)
-    {
-      int pos = 0;
-      error =
-	btree_top_n_items_binary_search (multi_range_opt->top_n_items, multi_range_opt->sort_att_idx,
-					 multi_range_opt->sort_col_dom, multi_range_opt->is_desc_order, new_key_value,
-					 multi_range_opt->num_attrs, 0, multi_range_opt->cnt - 1, &pos);
+      error = bh_insert (multi_range_opt->heap, &curr_item);
       if (error != NO_ERROR)
 	{
+	  pr_clear_value (&(curr_item->index_value));
+	  db_private_free_and_init (thread_p, curr_item);
 	  goto exit;
 	}
-      if (pos != multi_range_opt->cnt - 1)
-	{
-	  RANGE_OPT_ITEM *temp_item;
-	  int mem_size = (multi_range_opt->cnt - 1 - pos) * sizeof (RANGE_OPT_ITEM *);
-
-	  /* copy last item to temp */
-	  temp_item = multi_range_opt->top_n_items[multi_range_opt->cnt - 1];
 
-	  /* move all items one position to the right in order to free the position for the new item */
-	  memcpy (multi_range_opt->buffer, &multi_range_opt->top_n_items[pos], mem_size);
-	  memcpy (&multi_range_opt->top_n_items[pos + 1], multi_range_opt->buffer, mem_size);
-
-	  /* put new item at its designated position */
-	  multi_range_opt->top_n_items[pos] = temp_item;
-	}
-      else
-	{
-	  /* the new item is already in the correct position */
-	}
+      multi_range_opt->cnt = multi_range_opt->heap->element_count;
     }
 
 exit:
@@ -19104,123 +20044,6 @@ exit:
   return error;
 }
 
-/*
- * btree_top_n_items_binary_search () - searches for the right position for the keys in new_key_values in top N items
- *
- * return	       : error code
- * top_n_items (in)    : current top N item list
- * att_idxs (in)       : indexes for midxkey attributes
- * domains (in)	       : domains for midxkey attributes
- * desc_order (in)     : is descending order for midxkey attributes if NULL, ascending order will be considered
- * new_key_values (in) : key values for the new item
- * num_keys (in)       : number of keys that are compared
- * first (in)	       : position of the first item in current range
- * last (in)	       : position of the last item in current range
- * new_pos (out)       : the position where the new item fits
- *
- * NOTE	: At each step, split current range in half and compare with the
- *	  middle item. If all keys are equal save the position of middle item.
- *	  If middle item is better, look between middle and last, otherwise
- *	  look between first and middle.
- *	  The recursion stops when the range cannot be split anymore
- *	  (first + 1 <= last), when normally first is better and last is worse
- *	  and the new item should replace last. There is a special case when
- *	  the new item is better than all items in top N. In this case,
- *	  first must be 0 and an extra compare is made (to see if new item
- *	  should in fact replace first).
- */
-static int
-btree_top_n_items_binary_search (RANGE_OPT_ITEM ** top_n_items, int *att_idxs, TP_DOMAIN ** domains, bool * desc_order,
-				 DB_VALUE * new_key_values, int num_keys, int first, int last, int *new_pos)
-{
-  DB_MIDXKEY *comp_mkey = NULL;
-  DB_VALUE comp_key_value;
-  RANGE_OPT_ITEM *comp_item;
-  int i, c, error = NO_ERROR;
-
-  int middle;
-
-  assert (last >= first && new_pos != NULL);
-  if (last <= first + 1)
-    {
-      if (first == 0)
-	{
-	  /* need to check if the new key is smaller than the first */
-	  comp_item = top_n_items[0];
-	  comp_mkey = db_get_midxkey (&(comp_item->index_value));
-
-	  for (i = 0; i < num_keys; i++)
-	    {
-	      db_make_null (&comp_key_value);
-	      error = pr_midxkey_get_element_nocopy (comp_mkey, att_idxs[i], &comp_key_value, NULL, NULL);
-	      if (error != NO_ERROR)
-		{
-		  return error;
-		}
-
-	      c = btree_compare_individual_key_value (&comp_key_value, &new_key_values[i], domains[i]);
-
-	      pr_clear_value (&comp_key_value);
-	      if (c != 0)
-		{
-		  if ((desc_order != NULL && desc_order[i] ? c > 0 : c < 0))
-		    {
-		      /* new value is not better than the first */
-		      break;
-		    }
-		  else
-		    {
-		      /* new value is better than the first */
-		      new_pos = 0;
-		      return NO_ERROR;
-		    }
-		}
-	    }
-	  /* new value is equal to first, fall through */
-	}
-      /* here: the new values should be between first and last */
-      *new_pos = last;
-      return NO_ERROR;
-    }
-
-  /* compare new value with the value in the middle of the current range */
-  middle = (last + first) / 2;
-  comp_item = top_n_items[middle];
-  comp_mkey = db_get_midxkey (&(comp_item->index_value));
-
-  for (i = 0; i < num_keys; i++)
-    {
-      db_make_null (&comp_key_value);
-      error = pr_midxkey_get_element_nocopy (comp_mkey, att_idxs[i], &comp_key_value, NULL, NULL);
-      if (error != NO_ERROR)
-	{
-	  return error;
-	}
-
-      c = btree_compare_individual_key_value (&comp_key_value, &new_key_values[i], domains[i]);
-
-      pr_clear_value (&comp_key_value);
-      if (c != 0)
-	{
-	  if ((desc_order != NULL && desc_order[i] ? c > 0 : c < 0))
-	    {
-	      /* the new value is worse than the one in the middle */
-	      first = middle;
-	    }
-	  else
-	    {
-	      /* the new value is better than the one in the middle */
-	      last = middle;
-	    }
-	  return btree_top_n_items_binary_search (top_n_items, att_idxs, domains, desc_order, new_key_values, num_keys,
-						  first, last, new_pos);
-	}
-    }
-  /* all keys were equal, the new item can be put in current position */
-  *new_pos = middle;
-  return NO_ERROR;
-}
-
 /*
  * btree_iss_set_key () - save the current key
  *
@@ -26053,6 +26876,52 @@ btree_insert (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * cls_oi
 				BTREE_OP_INSERT_NEW_OBJECT);
 }
 
+/*
+ * btree_insert_batch () - Insert a batch of objects into b-tree. Keys must be sorted ascending in index order.
+ *
+ * return		  : Error code.
+ * thread_p (in)	  : Thread entry.
+ * btid (in)		  : B-tree identifier.
+ * keys (in)		  : Array of key values, sorted ascending.
+ * cls_oid (in)		  : Class OID (shared by all objects).
+ * oids (in)		  : Array of instance OID's, parallel to keys.
+ * num_keys (in)	  : Number of keys/OID's.
+ * op_type (in)		  : Single-multi row operations.
+ * unique_stat_info (in)  : Statistics collector used multi row operations.
+ * unique (out)		  : Outputs if b-tree is unique when not NULL.
+ * p_mvcc_rec_header (in) : Heap MVCC record header (shared by all objects).
+ *
+ * note: Sorted order means consecutive keys land on the same (or next) leaf, so each descent after the first walks
+ *	 pages already hot in the page buffer. With a multi-row op_type and unique_stat_info, root statistics updates
+ *	 are also deferred until the end of the batch instead of being logged per key.
+ */
+int
+btree_insert_batch (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE ** keys, OID * cls_oid, OID * oids, int num_keys,
+		    int op_type, btree_unique_stats * unique_stat_info, int *unique,
+		    MVCC_REC_HEADER * p_mvcc_rec_header)
+{
+  int error_code = NO_ERROR;
+  int i;
+
+  /* Assert expected arguments. */
+  assert (keys != NULL);
+  assert (oids != NULL);
+  assert (num_keys >= 0);
+
+  for (i = 0; i < num_keys; i++)
+    {
+      error_code =
+	btree_insert (thread_p, btid, keys[i], cls_oid, &oids[i], op_type, unique_stat_info, unique,
+		      p_mvcc_rec_header);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+    }
+  return NO_ERROR;
+}
+
 /*
  * btree_mvcc_delete () - MVCC logical delete. Adds delete MVCCID to an existing object.
  *
@@ -26099,6 +26968,53 @@ btree_mvcc_delete (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * c
 				NULL, BTREE_OP_INSERT_MVCC_DELID);
 }
 
+/*
+ * btree_mvcc_delete_batch () - MVCC logical delete of a batch of objects. Keys must be sorted ascending in index
+ *				order.
+ *
+ * return		  : Error code.
+ * thread_p (in)	  : Thread entry.
+ * btid (in)		  : B-tree identifier.
+ * keys (in)		  : Array of key values, sorted ascending.
+ * class_oid (in)	  : Class OID (shared by all objects).
+ * oids (in)		  : Array of instance OID's, parallel to keys.
+ * num_keys (in)	  : Number of keys/OID's.
+ * op_type (in)		  : Single-multi row operations.
+ * unique_stat_info (in)  : Statistics collector used multi row operations.
+ * unique (out)		  : Outputs if b-tree is unique when not NULL.
+ * p_mvcc_rec_header (in) : Heap MVCC record header (shared by all objects).
+ *
+ * note: Like btree_insert_batch, sorted order keeps each target leaf hot in the page buffer across descents. The
+ *	 objects are not physically removed here; they keep their per-object undo so rollback and older snapshots
+ *	 still see them. Vacuum removes them later and its merges deallocate the emptied leaf pages.
+ */
+int
+btree_mvcc_delete_batch (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE ** keys, OID * class_oid, OID * oids,
+			 int num_keys, int op_type, btree_unique_stats * unique_stat_info, int *unique,
+			 MVCC_REC_HEADER * p_mvcc_rec_header)
+{
+  int error_code = NO_ERROR;
+  int i;
+
+  /* Assert expected arguments. */
+  assert (keys != NULL);
+  assert (oids != NULL);
+  assert (num_keys >= 0);
+
+  for (i = 0; i < num_keys; i++)
+    {
+      error_code =
+	btree_mvcc_delete (thread_p, btid, keys[i], class_oid, &oids[i], op_type, unique_stat_info, unique,
+			   p_mvcc_rec_header);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+    }
+  return NO_ERROR;
+}
+
 /*
  * btree_insert_internal () - Generic index function that inserts new data in a b-tree key.
  *
@@ -26276,6 +27192,180 @@ btree_insert_internal (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID
   return NO_ERROR;
 }
 
+/*
+ * btree_rightmost_leaf_hint_get () - Get cached rightmost leaf hint for b-tree.
+ *
+ * return	   : True if a hint for this b-tree is cached.
+ * btid (in)	   : B-tree identifier.
+ * leaf_vpid (out) : Hinted leaf page identifier.
+ * leaf_lsa (out)  : Leaf page LSA when the hint was recorded.
+ */
+static bool
+btree_rightmost_leaf_hint_get (BTID * btid, VPID * leaf_vpid, LOG_LSA * leaf_lsa)
+{
+  BTREE_RIGHTMOST_HINT *hint;
+  bool found = false;
+  int rv;
+
+  hint = &btree_Rightmost_hints[(btid->vfid.fileid + btid->root_pageid) & (BTREE_RIGHTMOST_HINT_COUNT - 1)];
+
+  rv = pthread_mutex_lock (&btree_Rightmost_hint_mutex);
+  if (BTID_IS_EQUAL (&hint->btid, btid) && !VPID_ISNULL (&hint->leaf_vpid))
+    {
+      *leaf_vpid = hint->leaf_vpid;
+      LSA_COPY (leaf_lsa, &hint->leaf_lsa);
+      found = true;
+    }
+  pthread_mutex_unlock (&btree_Rightmost_hint_mutex);
+
+  return found;
+}
+
+/*
+ * btree_rightmost_leaf_hint_set () - Record rightmost leaf hint after a successful insert, if leaf is rightmost.
+ *
+ * return	  : Void.
+ * thread_p (in)  : Thread entry.
+ * btid_int (in)  : B-tree info.
+ * leaf_page (in) : Leaf page, write latched, after the insert was logged (its LSA reflects the insert).
+ */
+static void
+btree_rightmost_leaf_hint_set (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf_page)
+{
+  BTREE_RIGHTMOST_HINT *hint;
+  BTREE_NODE_HEADER *node_header;
+  BTID *btid = btid_int->sys_btid;
+  int rv;
+
+  node_header = btree_get_node_header (thread_p, leaf_page);
+  if (node_header == NULL || !VPID_ISNULL (&node_header->next_vpid))
+    {
+      /* Not the rightmost leaf. */
+      return;
+    }
+
+  hint = &btree_Rightmost_hints[(btid->vfid.fileid + btid->root_pageid) & (BTREE_RIGHTMOST_HINT_COUNT - 1)];
+
+  rv = pthread_mutex_lock (&btree_Rightmost_hint_mutex);
+  BTID_COPY (&hint->btid, btid);
+  hint->leaf_vpid = *pgbuf_get_vpid_ptr (leaf_page);
+  LSA_COPY (&hint->leaf_lsa, pgbuf_get_lsa (leaf_page));
+  pthread_mutex_unlock (&btree_Rightmost_hint_mutex);
+}
+
+/*
+ * btree_insert_try_rightmost_leaf () - Try to fix the hinted rightmost leaf for an insert, skipping the descent.
+ *
+ * return	      : Write latched rightmost leaf if the hint could be validated, NULL to fall back to the normal
+ *			descent from root.
+ * thread_p (in)      : Thread entry.
+ * btid_int (in)      : B-tree info.
+ * key (in)	      : Key value.
+ * insert_helper (in) : B-tree insert helper.
+ *
+ * Note: The returned leaf is guaranteed not to need a split or a max key length update, so the advance function can
+ *	 treat it like a leaf root. Validation is conditional and speculative; any failure falls back silently.
+ */
+static PAGE_PTR
+btree_insert_try_rightmost_leaf (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
+				 BTREE_INSERT_HELPER * insert_helper)
+{
+  VPID leaf_vpid;
+  LOG_LSA leaf_lsa;
+  PAGE_PTR leaf_page = NULL;
+  BTREE_NODE_HEADER *node_header = NULL;
+  RECDES peek_rec;
+  DB_VALUE last_key;
+  bool clear_last_key = false;
+  LEAF_REC leaf_pnt;
+  int offset;
+  int key_cnt;
+  DB_VALUE_COMPARE_RESULT c;
+
+  if (!btree_rightmost_leaf_hint_get (btid_int->sys_btid, &leaf_vpid, &leaf_lsa))
+    {
+      return NULL;
+    }
+
+  /* Conditional latch; never wait for a speculative fix. The page may have been deallocated meanwhile. */
+  leaf_page =
+    pgbuf_fix (thread_p, &leaf_vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, PGBUF_CONDITIONAL_LATCH);
+  if (leaf_page == NULL)
+    {
+      if (er_errid () != NO_ERROR)
+	{
+	  /* Speculative fix; fall back to the descent from root instead of failing the insert. */
+	  er_clear ();
+	}
+      return NULL;
+    }
+
+  if (!LSA_EQ (pgbuf_get_lsa (leaf_page), &leaf_lsa))
+    {
+      /* Page changed since the hint was recorded; it may have been split or deallocated. */
+      goto fallback;
+    }
+  /* LSA matches. The page is unchanged since the hint was recorded under latch, so it is still the rightmost leaf
+   * of this b-tree. */
+
+  node_header = btree_get_node_header (thread_p, leaf_page);
+  if (node_header == NULL || node_header->node_level != 1 || !VPID_ISNULL (&node_header->next_vpid))
+    {
+      assert (false);
+      goto fallback;
+    }
+
+  /* The advance function must find nothing to do besides searching the leaf: no max key length update and no risk
+   * of split. */
+  if (insert_helper->key_len_in_page > node_header->max_key_len)
+    {
+      goto fallback;
+    }
+  if (btree_get_max_new_data_size (thread_p, btid_int, leaf_page, BTREE_LEAF_NODE, node_header->max_key_len,
+				   insert_helper, false)
+      > spage_get_free_space_without_saving (thread_p, leaf_page, NULL))
+    {
+      goto fallback;
+    }
+
+  /* Key must be bigger than all keys in page. The rightmost leaf has no upper fence and is never compressed. */
+  key_cnt = btree_node_number_of_keys (thread_p, leaf_page);
+  if (key_cnt < 1)
+    {
+      goto fallback;
+    }
+  if (spage_get_record (thread_p, leaf_page, key_cnt, &peek_rec, PEEK) != S_SUCCESS)
+    {
+      assert (false);
+      goto fallback;
+    }
+  if (btree_leaf_is_flaged (&peek_rec, BTREE_LEAF_RECORD_FENCE)
+      || btree_leaf_is_flaged (&peek_rec, BTREE_LEAF_RECORD_OVERFLOW_KEY))
+    {
+      goto fallback;
+    }
+  btree_init_temp_key_value (&clear_last_key, &last_key);
+  if (btree_read_record_without_decompression (thread_p, btid_int, &peek_rec, &last_key, &leaf_pnt, BTREE_LEAF_NODE,
+					       &clear_last_key, &offset, PEEK_KEY_VALUE) != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      er_clear ();
+      goto fallback;
+    }
+  c = btree_compare_key (key, &last_key, btid_int->key_type, 1, 1, NULL);
+  btree_clear_key_value (&clear_last_key, &last_key);
+  if (c != DB_GT)
+    {
+      goto fallback;
+    }
+
+  return leaf_page;
+
+fallback:
+  pgbuf_unfix_and_init (thread_p, leaf_page);
+  return NULL;
+}
+
 /*
  * btree_fix_root_for_insert () - BTREE_ROOT_WITH_KEY_FUNCTION - fix root before inserting data in b-tree.
  *
@@ -26543,6 +27633,19 @@ btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid
 
   insert_helper->key_len_in_page = BTREE_GET_KEY_LEN_IN_PAGE (key_len);
 
+  /* Append-mostly fast path: try the cached rightmost leaf hint. If it validates, continue traversal directly with
+   * the leaf; the advance function finds a leaf with enough space and treats it like a leaf root. */
+  if (insert_helper->purpose == BTREE_OP_INSERT_NEW_OBJECT && root_header->node.node_level > 1)
+    {
+      PAGE_PTR hinted_leaf = btree_insert_try_rightmost_leaf (thread_p, btid_int, key, insert_helper);
+
+      if (hinted_leaf != NULL)
+	{
+	  pgbuf_unfix_and_init (thread_p, *root_page);
+	  *root_page = hinted_leaf;
+	}
+    }
+
   /* Success. */
   return NO_ERROR;
 
@@ -27344,6 +28447,11 @@ btree_key_insert_new_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VA
 	{
 	  db_private_free_and_init (thread_p, insert_helper->rv_keyval_data);
 	}
+      if (insert_helper->purpose == BTREE_OP_INSERT_NEW_OBJECT)
+	{
+	  /* Remember the rightmost leaf for the append-mostly insert fast path. */
+	  btree_rightmost_leaf_hint_set (thread_p, btid_int, *leaf_page);
+	}
       btree_perf_track_time (thread_p, insert_helper);
       return NO_ERROR;
     }
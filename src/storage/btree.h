@@ -653,6 +653,7 @@ extern int btree_get_unique_statistics (THREAD_ENTRY * thread_p, BTID * btid, lo
 					long long *key_cnt);
 extern int btree_get_unique_statistics_for_count (THREAD_ENTRY * thread_p, BTID * btid, long long *oid_cnt,
 						  long long *null_cnt, long long *key_cnt);
+extern int btree_count_all_visible_oids (THREAD_ENTRY * thread_p, BTID * btid, long long *count);
 
 extern int btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, bool with_fullscan);
 extern DISK_ISVALID btree_check_tree (THREAD_ENTRY * thread_p, const OID * class_oid_p, BTID * btid,
@@ -769,9 +770,15 @@ extern void btree_leaf_change_first_object (THREAD_ENTRY * thread_p, RECDES * re
 					    char **rv_undo_data_ptr, char **rv_redo_data_ptr);
 extern int btree_insert (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * cls_oid, OID * oid, int op_type,
 			 btree_unique_stats * unique_stat_info, int *unique, MVCC_REC_HEADER * p_mvcc_rec_header);
+extern int btree_insert_batch (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE ** keys, OID * cls_oid, OID * oids,
+			       int num_keys, int op_type, btree_unique_stats * unique_stat_info, int *unique,
+			       MVCC_REC_HEADER * p_mvcc_rec_header);
 extern int btree_mvcc_delete (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * class_oid, OID * oid,
 			      int op_type, btree_unique_stats * unique_stat_info, int *unique,
 			      MVCC_REC_HEADER * p_mvcc_rec_header);
+extern int btree_mvcc_delete_batch (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE ** keys, OID * class_oid,
+				    OID * oids, int num_keys, int op_type, btree_unique_stats * unique_stat_info,
+				    int *unique, MVCC_REC_HEADER * p_mvcc_rec_header);
 
 extern void btree_set_mvcc_header_ids_for_update (THREAD_ENTRY * thread_p, bool do_delete_only, bool do_insert_only,
 						  MVCCID * mvccid, MVCC_REC_HEADER * mvcc_rec_header);
@@ -835,6 +842,8 @@ extern int btree_write_record (THREAD_ENTRY * thread_p, BTID_INT * btid, void *n
 extern int btree_read_record (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pgptr, RECDES * Rec, DB_VALUE * key,
 			      void *rec_header, BTREE_NODE_TYPE node_type, bool * clear_key, int *offset, int copy,
 			      BTREE_SCAN * bts);
+extern int btree_load_compress_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr,
+					  DB_VALUE * next_key);
 extern DB_VALUE_COMPARE_RESULT btree_compare_key (DB_VALUE * key1, DB_VALUE * key2, TP_DOMAIN * key_domain,
 						  int do_coercion, int total_order, int *start_colp);
 extern PERF_PAGE_TYPE btree_get_perf_btree_page_type (THREAD_ENTRY * thread_p, PAGE_PTR page_ptr);
@@ -2131,6 +2131,17 @@ btree_proceed_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args)
 
   *header = load_args->leaf.hdr;
 
+  /* Add fence records and compress the completed leaf before it is logged. The pending record that did not fit
+   * holds the first key of the new page; its key makes the upper fence separator. The last leaf has no next key
+   * and stays uncompressed, like the rightmost page of a split. */
+  if (btree_load_compress_leaf_page (thread_p, load_args->btid, load_args->leaf.pgptr, &load_args->current_key)
+      != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      pgbuf_unfix_and_init (thread_p, new_leafpgptr);
+      return NULL;
+    }
+
   /* Flush the current leaf page */
   btree_log_page (thread_p, &load_args->btid->sys_btid->vfid, load_args->leaf.pgptr);
   load_args->leaf.pgptr = NULL;
@@ -2952,7 +2963,8 @@ btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC
     }
 
   return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
-			&btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
+			&btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args,
+			NULL /* prefix_fn: packed index keys have no normalized prefix */ , false, SORT_DUP,
 			NO_SORT_LIMIT, includes_tde_class);
 }
 
@@ -153,6 +153,8 @@ struct disk_cache_volinfo
 {
   DB_VOLPURPOSE purpose;
   DKNSECTS nsect_free;		/* Hint of free sectors on volume */
+  volatile SECTID hint_allocsect;	/* Hint of next sector to allocate. supersedes the volume header hint, so
+					 * reservers no longer have to write latch the header page to update it. */
 };
 
 typedef struct disk_extend_info DISK_EXTEND_INFO;
@@ -1282,6 +1284,7 @@ disk_rv_undo_format (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
       assert (disk_Cache->vols[volid].nsect_free == 0);
       disk_Cache->nvols_perm--;
       disk_Cache->vols[volid].purpose = DISK_UNKNOWN_PURPOSE;
+      disk_Cache->vols[volid].hint_allocsect = NULL_SECTID;
 
       disk_Cache->perm_purpose_info.extend_info.nsect_total -= total;
       disk_Cache->perm_purpose_info.extend_info.nsect_max -= max;
@@ -1304,6 +1307,7 @@ disk_rv_undo_format (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 
       /* make sure purpose is reset */
       disk_Cache->vols[volid].purpose = DISK_UNKNOWN_PURPOSE;
+      disk_Cache->vols[volid].hint_allocsect = NULL_SECTID;
 
       disk_log ("disk_rv_undo_format", "remove volume %d", volid);
     }
@@ -2579,6 +2583,7 @@ disk_cache_load_volume (THREAD_ENTRY * thread_p, INT16 volid, void *ignore)
 
   disk_Cache->vols[volid].nsect_free = space_info.n_free_sects;
   disk_Cache->vols[volid].purpose = vol_purpose;
+  disk_Cache->vols[volid].hint_allocsect = NULL_SECTID;
 
   disk_Cache->nvols_perm++;
   return true;
@@ -2644,6 +2649,7 @@ disk_cache_init (void)
     {
       disk_Cache->vols[i].purpose = DISK_UNKNOWN_PURPOSE;
       disk_Cache->vols[i].nsect_free = 0;
+      disk_Cache->vols[i].hint_allocsect = NULL_SECTID;
     }
   return NO_ERROR;
 }
@@ -3999,6 +4005,7 @@ disk_reserve_sectors_in_volume (THREAD_ENTRY * thread_p, int vol_index, DISK_RES
   DISK_VOLUME_HEADER *volheader = NULL;
   DISK_STAB_CURSOR start_cursor = DISK_STAB_CURSOR_INITIALIZER;
   DISK_STAB_CURSOR end_cursor = DISK_STAB_CURSOR_INITIALIZER;
+  SECTID hint_allocsect;
   int error_code = NO_ERROR;
 
   volid = context->cache_vol_reserve[vol_index].volid;
@@ -4010,8 +4017,10 @@ disk_reserve_sectors_in_volume (THREAD_ENTRY * thread_p, int vol_index, DISK_RES
   context->nsects_lastvol_remaining = context->cache_vol_reserve[vol_index].nsect;
   assert (context->nsects_lastvol_remaining > 0);
 
-  /* fix volume header */
-  error_code = disk_get_volheader (thread_p, volid, PGBUF_LATCH_WRITE, &page_volheader, &volheader);
+  /* fix volume header. a read latch is enough: sector table units are claimed under write latches on the sector
+   * table pages (one page at a time) and the allocation hint is kept in the volume cache, so concurrent reservers
+   * on the same volume no longer serialize on the header page. */
+  error_code = disk_get_volheader (thread_p, volid, PGBUF_LATCH_READ, &page_volheader, &volheader);
   if (error_code != NO_ERROR)
     {
       ASSERT_ERROR ();
@@ -4021,12 +4030,19 @@ disk_reserve_sectors_in_volume (THREAD_ENTRY * thread_p, int vol_index, DISK_RES
   disk_log ("disk_reserve_sectors_in_volume", "reserve %d sectors in volume %d.", context->nsects_lastvol_remaining,
 	    volid);
 
+  hint_allocsect = disk_Cache->vols[volid].hint_allocsect;
+  if (hint_allocsect == NULL_SECTID)
+    {
+      /* cache hint not set yet; fall back to the hint saved in the volume header */
+      hint_allocsect = volheader->hint_allocsect;
+    }
+
   /* reserve all possible sectors. */
-  if (volheader->hint_allocsect > 0 && volheader->hint_allocsect < volheader->nsect_total)
+  if (hint_allocsect > 0 && hint_allocsect < volheader->nsect_total)
     {
       /* start with hinted sector */
-      DISK_SECTS_ASSERT_ROUNDED (volheader->hint_allocsect);
-      disk_stab_cursor_set_at_sectid (volheader, volheader->hint_allocsect, &start_cursor);
+      DISK_SECTS_ASSERT_ROUNDED (hint_allocsect);
+      disk_stab_cursor_set_at_sectid (volheader, hint_allocsect, &start_cursor);
       disk_stab_cursor_set_at_end (volheader, &end_cursor);
 
       /* reserve sectors after hint */
@@ -4073,10 +4089,11 @@ disk_reserve_sectors_in_volume (THREAD_ENTRY * thread_p, int vol_index, DISK_RES
       goto exit;
     }
 
-  /* update hint */
-  volheader->hint_allocsect = (context->vsidp - 1)->sectid + 1;
-  volheader->hint_allocsect = DISK_SECTS_ROUND_DOWN (volheader->hint_allocsect);
-  /* we don't really need to set the page dirty or log the hint change. */
+  /* update hint. the header cannot be modified under read latch; keep the hint in the volume cache instead. the
+   * header hint was never logged or marked dirty anyway, so nothing persistent is lost. */
+  hint_allocsect = (context->vsidp - 1)->sectid + 1;
+  hint_allocsect = DISK_SECTS_ROUND_DOWN (hint_allocsect);
+  disk_Cache->vols[volid].hint_allocsect = hint_allocsect;
 
 exit:
   if (page_volheader != NULL)
@@ -27,6 +27,7 @@
 
 #include "double_write_buffer.h"
 
+#include "file_io.h"
 #include "system_parameter.h"
 #include "thread_daemon.hpp"
 #include "thread_entry_task.hpp"
@@ -1167,6 +1168,21 @@ dwb_create_internal (THREAD_ENTRY * thread_p, const char *dwb_volume_name, UINT6
       return NO_ERROR;
     }
 
+  if (prm_get_bool_value (PRM_ID_DWB_ATOMIC_WRITE_BYPASS))
+    {
+      if (prm_get_bool_value (PRM_ID_DATA_PAGE_CHECKSUM))
+	{
+	  /* The administrator attests that the storage stack writes IO_PAGESIZE blocks atomically, so a crash cannot
+	   * tear a page and staging every flush through the DWB volume only doubles the write volume. Page checksums
+	   * must stay on as the safety net: if the attestation is wrong, a torn page is detected on its next read
+	   * instead of being used silently. */
+	  return NO_ERROR;
+	}
+
+      /* without page checksums a torn page would go undetected; ignore the bypass and keep the DWB */
+      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_PRM_BAD_VALUE, 1, prm_get_name (PRM_ID_DWB_ATOMIC_WRITE_BYPASS));
+    }
+
   dwb_adjust_write_buffer_values (&double_write_buffer_size, &num_blocks);
 
   num_pages = double_write_buffer_size / IO_PAGESIZE;
@@ -1974,6 +1990,63 @@ dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
   return flush_new_volume_info;
 }
 
+#if defined (SERVER_MODE)
+/* number of data volume writes grouped into one io_uring submission while flushing a block */
+#define DWB_URING_BATCH_SIZE 32
+
+/*
+ * dwb_flush_uring_batch () - Submit the pending batch of data volume writes through io_uring and wait for completion.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * ops (in): Pending write operations; all belong to the same volume.
+ * num_ops_p (in/out): Number of pending operations; reset to 0 on success.
+ * flush_volume_info (in): Flush bookkeeping of the volume the operations belong to.
+ * count_writes_p (in/out): Running count of writes since the last sync helper wakeup.
+ *
+ *  Note: when the submission fails the batch is redone through the synchronous write path; the writes are idempotent,
+ *	  so redoing the whole batch is safe.
+ */
+STATIC_INLINE int
+dwb_flush_uring_batch (THREAD_ENTRY * thread_p, FILEIO_BATCH_OP * ops, int *num_ops_p,
+		       FLUSH_VOLUME_INFO * flush_volume_info, int *count_writes_p)
+{
+  int i;
+
+  if (*num_ops_p == 0)
+    {
+      return NO_ERROR;
+    }
+
+  assert (flush_volume_info != NULL);
+
+  if (fileio_uring_rw_batch (thread_p, ops, *num_ops_p, IO_PAGESIZE) != NO_ERROR)
+    {
+      for (i = 0; i < *num_ops_p; i++)
+	{
+	  if (fileio_write (thread_p, ops[i].vdes, ops[i].io_page_p, ops[i].page_id, IO_PAGESIZE,
+			    FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+	    {
+	      ASSERT_ERROR ();
+	      dwb_log_error ("DWB write page (%d) with %d error: \n", ops[i].page_id, er_errid ());
+	      return ER_FAILED;
+	    }
+	}
+    }
+
+  for (i = 0; i < *num_ops_p; i++)
+    {
+      dwb_log ("dwb_write_block: written page = (%d)\n", ops[i].page_id);
+    }
+
+  ATOMIC_INC_32 (&flush_volume_info->num_pages, *num_ops_p);
+  *count_writes_p += *num_ops_p;
+  *num_ops_p = 0;
+
+  return NO_ERROR;
+}
+#endif /* SERVER_MODE */
+
 /*
  * dwb_write_block () - Write block pages in specified order.
  *
@@ -1999,6 +2072,11 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   int count_writes = 0, num_pages_to_sync;
   FLUSH_VOLUME_INFO *current_flush_volume_info = NULL;
   bool can_flush_volume = false;
+#if defined (SERVER_MODE)
+  FILEIO_BATCH_OP uring_ops[DWB_URING_BATCH_SIZE];
+  int num_uring_ops = 0;
+  bool use_uring = fileio_uring_is_available ();
+#endif /* SERVER_MODE */
 
   assert (block != NULL && p_dwb_ordered_slots != NULL);
 
@@ -2028,6 +2106,16 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 
       if (last_written_volid != vpid->volid)
 	{
+#if defined (SERVER_MODE)
+	  /* complete the pending writes of the previous volume before closing its flush bookkeeping */
+	  if (use_uring
+	      && dwb_flush_uring_batch (thread_p, uring_ops, &num_uring_ops, current_flush_volume_info,
+					&count_writes) != NO_ERROR)
+	    {
+	      return ER_FAILED;
+	    }
+#endif /* SERVER_MODE */
+
 	  /* Get the volume descriptor. */
 	  if (current_flush_volume_info != NULL)
 	    {
@@ -2058,6 +2146,24 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 	      && p_dwb_ordered_slots[i].vpid.volid == p_dwb_ordered_slots[i].io_page->prv.volid);
 
       /* Write the data. */
+#if defined (SERVER_MODE)
+      if (use_uring)
+	{
+	  uring_ops[num_uring_ops].vdes = last_written_vol_fd;
+	  uring_ops[num_uring_ops].io_page_p = p_dwb_ordered_slots[i].io_page;
+	  uring_ops[num_uring_ops].page_id = vpid->pageid;
+	  uring_ops[num_uring_ops].is_write = true;
+	  num_uring_ops++;
+
+	  if (num_uring_ops == DWB_URING_BATCH_SIZE
+	      && dwb_flush_uring_batch (thread_p, uring_ops, &num_uring_ops, current_flush_volume_info,
+					&count_writes) != NO_ERROR)
+	    {
+	      return ER_FAILED;
+	    }
+	}
+      else
+#endif /* SERVER_MODE */
       if (fileio_write (thread_p, last_written_vol_fd, p_dwb_ordered_slots[i].io_page, vpid->pageid, IO_PAGESIZE,
 			FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
 	{
@@ -2069,16 +2175,21 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 	  /* Something wrong happened. */
 	  return ER_FAILED;
 	}
-
-      dwb_log ("dwb_write_block: written page = (%d,%d) LSA=(%lld,%d)\n",
-	       vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
-	       (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset);
+      else
+	{
+	  dwb_log ("dwb_write_block: written page = (%d,%d) LSA=(%lld,%d)\n",
+		   vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
+		   (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset);
+	}
 
 #if defined (SERVER_MODE)
       assert (current_flush_volume_info != NULL);
 
-      ATOMIC_INC_32 (&current_flush_volume_info->num_pages, 1);
-      count_writes++;
+      if (!use_uring)
+	{
+	  ATOMIC_INC_32 (&current_flush_volume_info->num_pages, 1);
+	  count_writes++;
+	}
 
       if (file_sync_helper_can_flush && (count_writes >= num_pages_to_sync || can_flush_volume == true)
 	  && dwb_is_file_sync_helper_daemon_available ())
@@ -2096,6 +2207,15 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 #endif
     }
 
+#if defined (SERVER_MODE)
+  if (use_uring
+      && dwb_flush_uring_batch (thread_p, uring_ops, &num_uring_ops, current_flush_volume_info,
+				&count_writes) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+#endif /* SERVER_MODE */
+
   /* the last written volume */
   if (current_flush_volume_info != NULL)
     {
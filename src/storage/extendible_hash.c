@@ -18,6 +18,31 @@
 
 /*
  * extendible_hash.c - Extendible hash manager
+ *
+ * A user-visible hash index type ("CREATE INDEX ... USING HASH") keeps being
+ * proposed on top of this module, since a directory lookup plus one bucket
+ * page is cheaper than a B-tree descent for pure equality keys.  Before
+ * attempting that, be aware of what this module does NOT provide today:
+ *
+ * - Entries are (key, OID) pairs with no MVCC information.  The B-tree keeps
+ *   insert/delete MVCCIDs per object and resolves visibility during the scan;
+ *   here every reader would have to fetch the heap record to decide
+ *   visibility, which gives back most of the saved page fixes on hot rows
+ *   with long version chains, and vacuum would need a new pass to collect
+ *   dead entries (vacuum only processes B-tree and heap log records).
+ * - All current users (catalog, loaddb instance mapping) create their
+ *   structures at boot or within a single transaction; concurrent DML against
+ *   bucket splits has never been exercised, and bucket split/merge is logged
+ *   but not latch-crabbed the way B-tree page splits are.
+ * - Everything between the parser and the executor assumes an index is a
+ *   BTID: the class representation (OR_INDEX), the catalog, statistics
+ *   (BTREE_STATS feeds the costing in query_planner.c), unique enforcement
+ *   and replication of key changes.  A second index kind means a parallel
+ *   path through all of those, not a flag.
+ *
+ * Until someone funds that work, the practical answer for equality-heavy
+ * keys remains a B-tree: point lookups already prune with key limits, and
+ * covering index scans avoid the heap fetch entirely.
  */
 
 #ident "$Id$"
@@ -1368,6 +1393,11 @@ ehash_find_bucket_vpid_with_hash (THREAD_ENTRY * thread_p, EHID * ehid_p, void *
  * Note: Returns the value associated with the given key, if it is
  * found in the specified extendible hashing structure. If the
  * key is not found an error condition is returned.
+ *      The directory root page is released as soon as the bucket page
+ * is latched (latch crabbing). Holding the bucket latch is enough to
+ * keep the bucket from being split or merged underneath the search,
+ * so there is no need to block directory writers (bucket splits,
+ * directory expansions) for the duration of the bucket scan.
  */
 EH_SEARCH
 ehash_search (THREAD_ENTRY * thread_p, EHID * ehid_p, void *key_p, OID * value_p)
@@ -1378,6 +1408,7 @@ ehash_search (THREAD_ENTRY * thread_p, EHID * ehid_p, void *key_p, OID * value_p
   VPID bucket_vpid;
   RECDES recdes;
   PGSLOTID slot_id;
+  DB_TYPE key_type;
   EH_SEARCH result = EH_KEY_NOTFOUND;
 
   if (ehid_p == NULL || key_p == NULL)
@@ -1408,7 +1439,11 @@ ehash_search (THREAD_ENTRY * thread_p, EHID * ehid_p, void *key_p, OID * value_p
       goto end;
     }
 
-  if (ehash_locate_slot (thread_p, bucket_page_p, dir_header_p->key_type, key_p, &slot_id) == false)
+  /* The bucket is latched; copy what is still needed from the directory header and let directory writers proceed. */
+  key_type = dir_header_p->key_type;
+  pgbuf_unfix_and_init (thread_p, dir_root_page_p);
+
+  if (ehash_locate_slot (thread_p, bucket_page_p, key_type, key_p, &slot_id) == false)
     {
       result = EH_KEY_NOTFOUND;
       goto end;
@@ -164,6 +164,8 @@ struct sort_param
   /* Comparison function to use in the internal sorting and the merging phases */
   SORT_CMP_FUNC *cmp_fn;
   void *cmp_arg;
+  SORT_PREFIX_FUNC *prefix_fn;	/* optional normalized prefix producer; NULL disables prefixed comparison */
+  bool prefix_total_order;	/* the prefix decides every comparison; enables the radix sort fast path */
   SORT_DUP_OPTION option;
 
   /* output function to apply on temporary records */
@@ -273,6 +275,8 @@ static char **sort_run_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, c
 static int sort_run_add_new (FILE_CONTENTS * file_contents, int num_pages);
 static void sort_run_remove_first (FILE_CONTENTS * file_contents);
 static void sort_run_flip (char **start, char **stop);
+static int sort_prefixed_cmp (const void *pk0, const void *pk1, void *arg);
+static char **sort_radix_sort (char **base, char **otherbase, long limit);
 static void sort_run_find (char **source, long *top, SORT_STACK * st_p, long limit, SORT_CMP_FUNC * compare,
 			   void *comp_arg, SORT_DUP_OPTION option);
 static void sort_run_merge (char **low, char **high, SORT_STACK * st_p, SORT_CMP_FUNC * compare, void *comp_arg,
@@ -869,6 +873,110 @@ sort_append (const void *pk0, const void *pk1)
   return;
 }
 
+/*
+ * sort_prefixed_cmp () - Record comparison through the normalized key prefixes
+ *   return: -1, 0, or 1, strcmp-style
+ *   pk0(in): Pointer to pointer to first sort record
+ *   pk1(in): Pointer to pointer to second sort record
+ *   arg(in): sort parameters
+ *
+ * Note: Decides the order from the normalized prefixes stored in front of the
+ *       records and calls the domain comparator only when they are equal.
+ *       Installed in place of cmp_fn for the in-memory phase whenever the
+ *       caller supplied a prefix_fn; the prefix contract guarantees a prefix
+ *       difference agrees in sign with the comparator, so duplicates are
+ *       still detected through the tie path.
+ */
+static int
+sort_prefixed_cmp (const void *pk0, const void *pk1, void *arg)
+{
+  SORT_PARAM *sort_param = (SORT_PARAM *) arg;
+  UINT64 p0, p1;
+
+  p0 = SORT_RECORD_PREFIX (*(char **) pk0);
+  p1 = SORT_RECORD_PREFIX (*(char **) pk1);
+
+  if (p0 != p1)
+    {
+      return (p0 < p1) ? DB_LT : DB_GT;
+    }
+
+  return (*(sort_param->cmp_fn)) (pk0, pk1, sort_param->cmp_arg);
+}
+
+/*
+ * sort_radix_sort () - LSD radix sort on the normalized key prefixes
+ *   return: pointer array holding the sorted order; either base or otherbase
+ *   base(in): record pointer array to sort
+ *   otherbase(in): scratch pointer array of the same size
+ *   limit(in): number of records
+ *
+ * Note: Selected instead of the comparison sort when the normalized prefix
+ *       is known to decide every comparison (see prefix_total_order), which
+ *       makes the whole run sortable without a single comparator call.
+ *       Eight stable counting passes over the prefix bytes, least
+ *       significant byte first; a pass whose byte is constant across all
+ *       records cannot change the order and is skipped, so narrow domains
+ *       only pay for the passes their value range actually needs.
+ */
+static char **
+sort_radix_sort (char **base, char **otherbase, long limit)
+{
+  long counts[8][256];
+  long offsets[256];
+  char **src, **dst, **swap;
+  UINT64 prefix;
+  long i;
+  int digit, byte;
+
+  if (limit <= 1)
+    {
+      return base;
+    }
+
+  /* one scan builds the histograms of all eight digits */
+  memset (counts, 0, sizeof (counts));
+  for (i = 0; i < limit; i++)
+    {
+      prefix = SORT_RECORD_PREFIX (base[i]);
+      for (digit = 0; digit < 8; digit++)
+	{
+	  counts[digit][(prefix >> (digit * 8)) & 0xFF]++;
+	}
+    }
+
+  src = base;
+  dst = otherbase;
+
+  for (digit = 0; digit < 8; digit++)
+    {
+      byte = (int) ((SORT_RECORD_PREFIX (src[0]) >> (digit * 8)) & 0xFF);
+      if (counts[digit][byte] == limit)
+	{
+	  /* every record agrees on this digit */
+	  continue;
+	}
+
+      offsets[0] = 0;
+      for (byte = 1; byte < 256; byte++)
+	{
+	  offsets[byte] = offsets[byte - 1] + counts[digit][byte - 1];
+	}
+
+      for (i = 0; i < limit; i++)
+	{
+	  byte = (int) ((SORT_RECORD_PREFIX (src[i]) >> (digit * 8)) & 0xFF);
+	  dst[offsets[byte]++] = src[i];
+	}
+
+      swap = src;
+      src = dst;
+      dst = swap;
+    }
+
+  return src;
+}
+
 /*
  * sort_run_find () - Finds the longest ascending or descending run it can
  *   return:
@@ -1188,8 +1296,16 @@ sort_run_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **base, lo
     }
 
   /* init */
-  compare = sort_param->cmp_fn;
-  comp_arg = sort_param->cmp_arg;
+  if (sort_param->prefix_fn != NULL)
+    {
+      compare = sort_prefixed_cmp;
+      comp_arg = (void *) sort_param;
+    }
+  else
+    {
+      compare = sort_param->cmp_fn;
+      comp_arg = sort_param->cmp_arg;
+    }
   option = sort_param->option;
 
   src = base;
@@ -1330,6 +1446,17 @@ sort_run_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **base, lo
  *               second, 1 means the second precedes the first, and 0 means
  *               neither precedes the other.
  *   cmp_arg(in): arguments to the cmp_fn function
+ *   prefix_fn(in): optional user-supplied function producing a normalized
+ *               binary prefix of the leading sort column for each record.
+ *               When given, the in-memory sort loops compare prefixes with a
+ *               single integer compare and call cmp_fn only on ties. NULL
+ *               when the leading column has no order-preserving binary form.
+ *   prefix_total_order(in): true when the prefix decides every comparison,
+ *               i.e. the sort key is a single fixed-width column whose whole
+ *               value fits in the prefix. Runs are then ordered by an LSD
+ *               radix sort on the prefixes with no comparator calls at all.
+ *               Ignored unless prefix_fn is given; duplicate elimination
+ *               still goes through the comparator path.
  *   option(in):
  *   limit(in):  optional arg, can represent the limit clause. If we only want
  *               the top K elements of a processed list, it makes sense to use
@@ -1343,12 +1470,13 @@ sort_run_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **base, lo
  */
 int
 sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GET_FUNC * get_fn, void *get_arg,
-	       SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn, void *cmp_arg, SORT_DUP_OPTION option,
-	       int limit, bool includes_tde_class)
+	       SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn, void *cmp_arg,
+	       SORT_PREFIX_FUNC * prefix_fn, bool prefix_total_order, SORT_DUP_OPTION option, int limit,
+	       bool includes_tde_class)
 {
   int error = NO_ERROR;
   SORT_PARAM *sort_param = NULL;
-  bool prm_enable_sort_parallel = false;	/* TODO - PRM_SORT_PARALLEL_SORT */
+  bool prm_enable_sort_parallel = prm_get_bool_value (PRM_ID_SORT_PARALLEL_ENABLE);
   INT32 input_pages;
   int i;
   int file_pg_cnt_est;
@@ -1387,6 +1515,9 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 
   sort_param->cmp_fn = cmp_fn;
   sort_param->cmp_arg = cmp_arg;
+  sort_param->prefix_fn = prefix_fn;
+  /* eliminating duplicates needs the comparator to see every tie, so the radix path is ascending-duplicates only */
+  sort_param->prefix_total_order = (prefix_fn != NULL && prefix_total_order && option == SORT_DUP);
   sort_param->option = option;
 
   sort_param->put_fn = put_fn;
@@ -1478,10 +1609,6 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
   sort_param->px_height_max = 0;	/* init */
   sort_param->px_array_size = 1;	/* init */
 
-#if 1				/* TODO - currently, disable parallelism */
-  prm_enable_sort_parallel = false;
-#endif
-
   tde_er_log ("sort_listfile(): tde_encrypted = %d\n", sort_param->tde_encrypted);
 
 #if defined(SERVER_MODE)
@@ -1852,6 +1979,19 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
       char **left_vector, **right_vector;
       PX_TREE_NODE *left_px_node, *right_px_node;
       int i, j, k;		/* Used in the merge logic */
+      SORT_CMP_FUNC *compare;
+      void *comp_arg;
+
+      if (sort_param->prefix_fn != NULL)
+	{
+	  compare = sort_prefixed_cmp;
+	  comp_arg = (void *) sort_param;
+	}
+      else
+	{
+	  compare = sort_param->cmp_fn;
+	  comp_arg = sort_param->cmp_arg;
+	}
 
       assert_release (child_right > 0);
 
@@ -1982,7 +2122,7 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 
 #if 1
       /* STEP 2: check CON conditions if (left_max < right_min) do FORWARD-CON. we use '<' instead of '<=' */
-      cmp = (*(sort_param->cmp_fn)) (&(left_vector[left_vector_size - 1]), &(right_vector[0]), sort_param->cmp_arg);
+      cmp = (*compare) (&(left_vector[left_vector_size - 1]), &(right_vector[0]), comp_arg);
 
       if (cmp == DB_LT || cmp == DB_EQ || cmp == DB_GT)
 	{
@@ -2008,8 +2148,7 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
       else
 	{
 	  /* STEP 3: check CON conditions if (right_max < left_min) do BACKWARD-CON. we use '<' instead of '<=' */
-	  cmp =
-	    (*(sort_param->cmp_fn)) (&(right_vector[right_vector_size - 1]), &(left_vector[0]), sort_param->cmp_arg);
+	  cmp = (*compare) (&(right_vector[right_vector_size - 1]), &(left_vector[0]), comp_arg);
 
 	  if (cmp == DB_LT || cmp == DB_EQ || cmp == DB_GT)
 	    {
@@ -2038,7 +2177,7 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 	      /* STEP 4: do the actual merge */
 	      while (i < left_vector_size && j < right_vector_size)
 		{
-		  cmp = (*(sort_param->cmp_fn)) (&(left_vector[i]), &(right_vector[j]), sort_param->cmp_arg);
+		  cmp = (*compare) (&(left_vector[i]), &(right_vector[j]), comp_arg);
 
 		  if (cmp == DB_LT || cmp == DB_EQ || cmp == DB_GT)
 		    {
@@ -2211,7 +2350,7 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
   saved_numrecs = 0;
   *total_numrecs = 0;
   saved_index_area = NULL;
-  item_ptr = sort_param->internal_memory + SORT_RECORD_LENGTH_SIZE;
+  item_ptr = sort_param->internal_memory + SORT_RECORD_PREFIX_SIZE + SORT_RECORD_LENGTH_SIZE;
   index_area = (char **) (output_buffer - sizeof (char *));
   index_buff = index_area - 1;
   temp_recdes.area_size = SORT_MAXREC_LENGTH;
@@ -2233,7 +2372,7 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 	  temp_recdes.data = item_ptr;
 	  if (((int) ((char *) index_buff - item_ptr)) < SORT_MAXREC_LENGTH)
 	    {
-	      temp_recdes.area_size = (int) ((char *) index_buff - item_ptr) - (4 * sizeof (char *));
+	      temp_recdes.area_size = (int) ((char *) index_buff - item_ptr) - (5 * sizeof (char *));
 	    }
 
 	  if (temp_recdes.area_size <= SSIZEOF (SORT_REC))
@@ -2266,7 +2405,14 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 
 	      index_area++;
 
-	      if (sort_numrecs == 0)
+	      if (sort_param->prefix_total_order)
+		{
+		  /* the prefix carries the whole key; no comparator calls needed */
+		  assert (sort_numrecs == 0);
+		  index_area = sort_radix_sort (index_area, index_buff, numrecs);
+		  *total_numrecs += numrecs;
+		}
+	      else if (sort_numrecs == 0)
 		{
 		  assert (sort_param->px_height_max >= 0);
 		  assert (sort_param->px_array_size >= 1);
@@ -2325,7 +2471,9 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 			}
 		    }
 
-		  item_ptr += DB_ALIGN (SORT_RECORD_LENGTH (item_ptr), MAX_ALIGNMENT) + SORT_RECORD_LENGTH_SIZE;
+		  item_ptr +=
+		    DB_ALIGN (SORT_RECORD_LENGTH (item_ptr), MAX_ALIGNMENT) + SORT_RECORD_PREFIX_SIZE
+		    + SORT_RECORD_LENGTH_SIZE;
 		}
 
 	      if (sort_param->option == SORT_ELIM_DUP
@@ -2364,7 +2512,7 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 		    }
 
 		  numrecs = 0;
-		  item_ptr = sort_param->internal_memory + SORT_RECORD_LENGTH_SIZE;
+		  item_ptr = sort_param->internal_memory + SORT_RECORD_PREFIX_SIZE + SORT_RECORD_LENGTH_SIZE;
 		  index_area = (char **) (output_buffer - sizeof (char *));
 		  index_buff = index_area - 1;
 		  temp_recdes.area_size = SORT_MAXREC_LENGTH;
@@ -2466,6 +2614,8 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 	      /* Update the pointers */
 	      SORT_RECORD_LENGTH (item_ptr) = sizeof (VPID);
 	      *index_area = item_ptr;
+	      /* long records form single-record runs, so the prefix is never compared */
+	      SORT_RECORD_PREFIX (item_ptr) = 0;
 	      numrecs++;
 
 	      error =
@@ -2478,7 +2628,7 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 
 	      /* Prepare for the next internal sorting run */
 	      numrecs = 0;
-	      item_ptr = sort_param->internal_memory + SORT_RECORD_LENGTH_SIZE;
+	      item_ptr = sort_param->internal_memory + SORT_RECORD_PREFIX_SIZE + SORT_RECORD_LENGTH_SIZE;
 	      index_area = (char **) (output_buffer - sizeof (char *));
 	      index_buff = index_area - 1;
 	      temp_recdes.area_size = SORT_MAXREC_LENGTH;
@@ -2498,13 +2648,17 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 	  /* Proceed the pointers */
 	  SORT_RECORD_LENGTH (item_ptr) = temp_recdes.length;
 	  *index_area = item_ptr;
+	  if (sort_param->prefix_fn != NULL)
+	    {
+	      SORT_RECORD_PREFIX (item_ptr) = (*(sort_param->prefix_fn)) ((void *) index_area, sort_param->cmp_arg);
+	    }
 	  numrecs++;
 
 	  index_area--;
 	  index_buff--;		/* decrease once for pointer, once for pointer buffer */
 	  index_buff--;		/* must keep track because index_buff is used to detect when sort buffer is full */
 
-	  item_ptr += DB_ALIGN (temp_recdes.length, MAX_ALIGNMENT) + SORT_RECORD_LENGTH_SIZE;
+	  item_ptr += DB_ALIGN (temp_recdes.length, MAX_ALIGNMENT) + SORT_RECORD_PREFIX_SIZE + SORT_RECORD_LENGTH_SIZE;
 	  break;
 
 	default:
@@ -2521,7 +2675,14 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 
       index_area++;
 
-      if (sort_numrecs == 0)
+      if (sort_param->prefix_total_order)
+	{
+	  /* the prefix carries the whole key; no comparator calls needed */
+	  assert (sort_numrecs == 0);
+	  index_area = sort_radix_sort (index_area, index_buff, numrecs);
+	  *total_numrecs += numrecs;
+	}
+      else if (sort_numrecs == 0)
 	{
 	  assert (sort_param->px_height_max >= 0);
 	  assert (sort_param->px_array_size >= 1);
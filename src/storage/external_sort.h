@@ -42,6 +42,15 @@
 #define SORT_RECORD_LENGTH_SIZE (sizeof(INT64))	/* for 8byte align */
 #define SORT_RECORD_LENGTH(item_p) (*((int *) ((item_p) - SORT_RECORD_LENGTH_SIZE)))
 
+/* Normalized key prefix kept in front of the length word of every in-memory
+ * sort record. It is an order-preserving binary image of the leading sort
+ * column, so the run formation and merge loops can decide most comparisons
+ * with a single integer compare and call the domain comparator only on ties.
+ * The prefix never reaches the temporary files. */
+#define SORT_RECORD_PREFIX_SIZE (sizeof(UINT64))
+#define SORT_RECORD_PREFIX(item_p) \
+  (*((UINT64 *) ((item_p) - SORT_RECORD_LENGTH_SIZE - SORT_RECORD_PREFIX_SIZE)))
+
 typedef enum
 {
   SORT_REC_DOESNT_FIT,
@@ -59,6 +68,11 @@ typedef enum
 typedef SORT_STATUS SORT_GET_FUNC (THREAD_ENTRY * thread_p, RECDES *, void *);
 typedef int SORT_PUT_FUNC (THREAD_ENTRY * thread_p, const RECDES *, void *);
 typedef int SORT_CMP_FUNC (const void *, const void *, void *);
+/* Produces the normalized prefix of one sort record; takes the same
+ * (pointer to record pointer, comparator argument) pair as SORT_CMP_FUNC.
+ * The contract is that prefix (a) < prefix (b) implies cmp (a, b) < 0; equal
+ * prefixes imply nothing and fall back to the comparator. */
+typedef UINT64 SORT_PREFIX_FUNC (const void *pk, void *arg);
 
 typedef struct SORT_REC SORT_REC;
 typedef struct SUBKEY_INFO SUBKEY_INFO;
@@ -144,6 +158,7 @@ struct SORT_INFO
 
 extern int sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GET_FUNC * get_fn,
 			  void *get_arg, SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn, void *cmp_arg,
-			  SORT_DUP_OPTION option, int limit, bool includes_tde_class);
+			  SORT_PREFIX_FUNC * prefix_fn, bool prefix_total_order, SORT_DUP_OPTION option, int limit,
+			  bool includes_tde_class);
 
 #endif /* _EXTERNAL_SORT_H_ */
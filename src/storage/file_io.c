@@ -65,6 +65,18 @@
 #include <aio.h>
 #endif /* HPUX */
 
+#if defined (LINUX) && defined (__has_include)
+#if __has_include (<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined (__NR_io_uring_setup) && defined (__NR_io_uring_enter)
+#define FILEIO_HAS_URING 1
+#endif
+#endif
+#endif /* LINUX && __has_include */
+
 #include "porting.h"
 
 #include "chartype.h"
@@ -120,6 +132,12 @@
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info and thread_sleep
 #endif // SERVER_MODE
 
+#if !defined (CS_MODE)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif /* !CS_MODE */
+
 /************************************************************************/
 /* TODO: why is this in client module?                                  */
 /************************************************************************/
@@ -442,6 +460,34 @@ static FILEIO_VOLUME_HEADER fileio_Vol_info_header = {
 static FILEIO_BACKUP_INFO_QUEUE fileio_Backup_vol_info_data[2] =
   { {false, {NULL, NULL, NULL}, NULL}, {false, {NULL, NULL, NULL}, NULL} };
 
+#if !defined(CS_MODE)
+/*
+ * Changed-page tracker for incremental backups.  Every flushed permanent
+ * volume page is marked here, and once a checkpoint logged by this process
+ * has activated the tracker, incremental backups may skip reading pages
+ * whose mark is clear: such a page has not been flushed since before the
+ * activation checkpoint, so its on-disk LSA cannot exceed the LSA of the
+ * previous backup.
+ */
+#define FILEIO_CHANGED_PAGE_SEGMENT_BITS    16
+#define FILEIO_CHANGED_PAGE_SEGMENT_NPAGES  (1 << FILEIO_CHANGED_PAGE_SEGMENT_BITS)
+#define FILEIO_CHANGED_PAGE_MAX_SEGMENTS    8192
+
+typedef struct fileio_changed_page_map FILEIO_CHANGED_PAGE_MAP;
+struct fileio_changed_page_map
+{
+  VOLID volid;			/* permanent volume this map describes */
+  char *volatile segments[FILEIO_CHANGED_PAGE_MAX_SEGMENTS];	/* one byte per page, allocated on demand */
+  FILEIO_CHANGED_PAGE_MAP *next;	/* next volume map; the list only grows at its head */
+};
+
+static FILEIO_CHANGED_PAGE_MAP *volatile fileio_Changed_page_maps = NULL;
+static pthread_mutex_t fileio_Changed_page_mutex = PTHREAD_MUTEX_INITIALIZER;
+static LOG_LSA fileio_Changed_page_activation_lsa = LSA_INITIALIZER;
+static volatile bool fileio_Changed_page_tracker_active = false;
+static volatile bool fileio_Changed_page_tracker_broken = false;
+#endif /* !CS_MODE */
+
 /* Flush Control */
 #if !defined(HAVE_ATOMIC_BUILTINS)
 static pthread_mutex_t fileio_Flushed_page_counter_mutex = PTHREAD_MUTEX_INITIALIZER;
@@ -549,6 +595,16 @@ static FILEIO_BACKUP_SESSION *fileio_continue_restore (THREAD_ENTRY * thread_p,
 static int fileio_fill_hole_during_restore (THREAD_ENTRY * thread_p, int *next_pageid, int stop_pageid,
 					    FILEIO_BACKUP_SESSION * session, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap);
 static int fileio_decompress_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, int nbytes);
+#if !defined(CS_MODE)
+static void fileio_invalidate_changed_page_tracker (void);
+static bool fileio_is_page_unchanged_for_backup (FILEIO_BACKUP_SESSION * session_p, PAGEID page_id);
+#endif /* !CS_MODE */
+#if !defined(CS_MODE)
+static int fileio_restore_volume_overlapped (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p,
+					     FILEIO_RESTORE_PAGE_BITMAP * bitmap, int npages, int from_npages,
+					     int unit, int *next_page_id_p, INT64 * total_nbytes_p, int *check_ratio_p,
+					     int *check_npages_p, bool * incremental_includes_volume_header_p);
+#endif /* !CS_MODE */
 static FILEIO_NODE *fileio_allocate_node (FILEIO_QUEUE * qp, FILEIO_BACKUP_HEADER * backup_hdr);
 static FILEIO_NODE *fileio_free_node (FILEIO_QUEUE * qp, FILEIO_NODE * node);
 static FILEIO_NODE *fileio_delete_queue_head (FILEIO_QUEUE * qp);
@@ -586,6 +642,8 @@ static void fileio_page_bitmap_set (FILEIO_RESTORE_PAGE_BITMAP * page_bitmap, in
 static bool fileio_page_bitmap_is_set (FILEIO_RESTORE_PAGE_BITMAP * page_bitmap, int page_id);
 static void fileio_page_bitmap_dump (FILE * out_fp, const FILEIO_RESTORE_PAGE_BITMAP * page_bitmap);
 
+static int fileio_compute_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, int *checksum_crc32c);
+
 static int
 fileio_increase_flushed_page_count (int npages)
 {
@@ -4050,6 +4108,8 @@ fileio_write_or_add_to_dwb (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * i
 	  io_page_p->prv.volid = vol_info_p->volid;
 	  io_page_p->prv.pageid = page_id;
 
+	  fileio_mark_changed_page (vol_info_p->volid, page_id);
+
 	  error_code = dwb_add_page (thread_p, io_page_p, &vpid, &p_dwb_slot);
 	  if (error_code != NO_ERROR)
 	    {
@@ -4299,6 +4359,264 @@ fileio_read_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEID
   return io_pages_p;
 }
 
+/*
+ * fileio_prefetch_pages () - Hint the OS to start reading a contiguous page range asynchronously
+ *   return: NO_ERROR
+ *   thread_p(in): thread entry
+ *   vol_fd(in): volume descriptor
+ *   page_id(in): first page of the range
+ *   num_pages(in): number of contiguous pages
+ *
+ * Note: only an advise is issued; no data is transferred to the caller. When the advise is not supported or fails,
+ *	 nothing is lost except the read overlap.
+ */
+int
+fileio_prefetch_pages (THREAD_ENTRY * thread_p, int vol_fd, PAGEID page_id, int num_pages)
+{
+#if _POSIX_C_SOURCE >= 200112L
+  off_t offset = FILEIO_GET_FILE_SIZE (IO_PAGESIZE, page_id);
+
+  if (num_pages <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  (void) posix_fadvise (vol_fd, offset, (off_t) num_pages * IO_PAGESIZE, POSIX_FADV_WILLNEED);
+#endif /* _POSIX_C_SOURCE >= 200112L */
+
+  return NO_ERROR;
+}
+
+#if defined (FILEIO_HAS_URING) && defined (SERVER_MODE)
+/*
+ * A single kernel submission/completion ring shared by all batched page I/O. Submission is serialized by a mutex and
+ * every batch reaps its own completions before returning, so the synchronous error contract of fileio_read and
+ * fileio_write is kept for the callers; the gain is that all pages of one batch are in flight at the same time.
+ */
+typedef struct fileio_uring_ring FILEIO_URING_RING;
+struct fileio_uring_ring
+{
+  int ring_fd;
+  unsigned int *sq_head;	/* shared with kernel; consumer side of submission ring */
+  unsigned int *sq_tail;
+  unsigned int *sq_mask;
+  unsigned int *sq_array;
+  unsigned int *cq_head;
+  unsigned int *cq_tail;
+  unsigned int *cq_mask;
+  struct io_uring_sqe *sqes;
+  struct io_uring_cqe *cqes;
+  int state;			/* 0: not tried yet, 1: available, -1: unavailable */
+  pthread_mutex_t mutex;
+};
+
+static FILEIO_URING_RING fileio_Uring = { -1, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0,
+  PTHREAD_MUTEX_INITIALIZER
+};
+
+/*
+ * fileio_uring_open () - Set up the shared io_uring instance and map its rings
+ *   return: NO_ERROR, or ER_FAILED when the kernel does not support io_uring
+ */
+static int
+fileio_uring_open (void)
+{
+  struct io_uring_params params;
+  void *sq_ptr, *cq_ptr, *sqe_ptr;
+  size_t sq_size, cq_size, sqes_size;
+  int fd;
+
+  memset (&params, 0, sizeof (params));
+  fd = (int) syscall (__NR_io_uring_setup, FILEIO_URING_MAX_BATCH, &params);
+  if (fd < 0)
+    {
+      return ER_FAILED;
+    }
+
+  sq_size = params.sq_off.array + params.sq_entries * sizeof (unsigned int);
+  cq_size = params.cq_off.cqes + params.cq_entries * sizeof (struct io_uring_cqe);
+  sqes_size = params.sq_entries * sizeof (struct io_uring_sqe);
+
+  sq_ptr = mmap (NULL, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  cq_ptr = mmap (NULL, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+  sqe_ptr = mmap (NULL, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (sq_ptr == MAP_FAILED || cq_ptr == MAP_FAILED || sqe_ptr == MAP_FAILED)
+    {
+      if (sq_ptr != MAP_FAILED)
+	{
+	  munmap (sq_ptr, sq_size);
+	}
+      if (cq_ptr != MAP_FAILED)
+	{
+	  munmap (cq_ptr, cq_size);
+	}
+      if (sqe_ptr != MAP_FAILED)
+	{
+	  munmap (sqe_ptr, sqes_size);
+	}
+      close (fd);
+      return ER_FAILED;
+    }
+
+  fileio_Uring.ring_fd = fd;
+  fileio_Uring.sq_head = (unsigned int *) ((char *) sq_ptr + params.sq_off.head);
+  fileio_Uring.sq_tail = (unsigned int *) ((char *) sq_ptr + params.sq_off.tail);
+  fileio_Uring.sq_mask = (unsigned int *) ((char *) sq_ptr + params.sq_off.ring_mask);
+  fileio_Uring.sq_array = (unsigned int *) ((char *) sq_ptr + params.sq_off.array);
+  fileio_Uring.cq_head = (unsigned int *) ((char *) cq_ptr + params.cq_off.head);
+  fileio_Uring.cq_tail = (unsigned int *) ((char *) cq_ptr + params.cq_off.tail);
+  fileio_Uring.cq_mask = (unsigned int *) ((char *) cq_ptr + params.cq_off.ring_mask);
+  fileio_Uring.sqes = (struct io_uring_sqe *) sqe_ptr;
+  fileio_Uring.cqes = (struct io_uring_cqe *) ((char *) cq_ptr + params.cq_off.cqes);
+
+  return NO_ERROR;
+}
+#endif /* FILEIO_HAS_URING && SERVER_MODE */
+
+/*
+ * fileio_uring_is_available () - Can batched page I/O go through io_uring?
+ *   return: true when io_uring_enable is set and the kernel supports io_uring
+ *
+ * Note: the ring is set up lazily on the first call; when the setup fails the answer stays false for the life of the
+ *	 process and all I/O keeps using the synchronous path.
+ */
+bool
+fileio_uring_is_available (void)
+{
+#if defined (FILEIO_HAS_URING) && defined (SERVER_MODE)
+  if (!prm_get_bool_value (PRM_ID_IO_URING_ENABLE))
+    {
+      return false;
+    }
+
+  if (fileio_Uring.state == 0)
+    {
+      pthread_mutex_lock (&fileio_Uring.mutex);
+      if (fileio_Uring.state == 0)
+	{
+	  fileio_Uring.state = (fileio_uring_open () == NO_ERROR) ? 1 : -1;
+	  if (fileio_Uring.state < 0)
+	    {
+	      er_log_debug (ARG_FILE_LINE,
+			    "fileio_uring_is_available: io_uring setup failed (errno = %d);"
+			    " falling back to synchronous I/O", errno);
+	    }
+	}
+      pthread_mutex_unlock (&fileio_Uring.mutex);
+    }
+
+  return fileio_Uring.state > 0;
+#else /* !FILEIO_HAS_URING || !SERVER_MODE */
+  return false;
+#endif /* !FILEIO_HAS_URING || !SERVER_MODE */
+}
+
+/*
+ * fileio_uring_rw_batch () - Submit a batch of page reads/writes in one io_uring round trip and wait for all of them
+ *   return: NO_ERROR when every operation transferred a full page; ER_FAILED otherwise, in which case the caller must
+ *	     redo the batch through the synchronous path (page writes are idempotent, so a redo is always safe)
+ *   thread_p (in)  : thread entry
+ *   ops (in)       : operations; at most FILEIO_URING_MAX_BATCH
+ *   num_ops (in)   : number of operations
+ *   page_size (in) : size of each page
+ */
+int
+fileio_uring_rw_batch (THREAD_ENTRY * thread_p, FILEIO_BATCH_OP * ops, int num_ops, size_t page_size)
+{
+#if defined (FILEIO_HAS_URING) && defined (SERVER_MODE)
+  struct iovec iov[FILEIO_URING_MAX_BATCH];
+  struct io_uring_sqe *sqe;
+  struct io_uring_cqe *cqe;
+  unsigned int tail, head, index;
+  int i, ret, num_completed;
+  bool has_failure = false;
+
+  assert (num_ops > 0 && num_ops <= FILEIO_URING_MAX_BATCH);
+
+  if (fileio_Uring.state != 1)
+    {
+      return ER_FAILED;
+    }
+
+  pthread_mutex_lock (&fileio_Uring.mutex);
+
+  /* the ring is fully drained between batches, so num_ops contiguous entries are always free */
+  tail = *fileio_Uring.sq_tail;
+  for (i = 0; i < num_ops; i++)
+    {
+      iov[i].iov_base = ops[i].io_page_p;
+      iov[i].iov_len = page_size;
+
+      index = (tail + i) & *fileio_Uring.sq_mask;
+      sqe = &fileio_Uring.sqes[index];
+      memset (sqe, 0, sizeof (*sqe));
+      sqe->opcode = ops[i].is_write ? IORING_OP_WRITEV : IORING_OP_READV;
+      sqe->fd = ops[i].vdes;
+      sqe->off = (unsigned long long) FILEIO_GET_FILE_SIZE (page_size, ops[i].page_id);
+      sqe->addr = (unsigned long long) (uintptr_t) & iov[i];
+      sqe->len = 1;
+      sqe->user_data = (unsigned long long) i;
+      fileio_Uring.sq_array[index] = index;
+    }
+  __atomic_store_n (fileio_Uring.sq_tail, tail + num_ops, __ATOMIC_RELEASE);
+
+  do
+    {
+      ret = (int) syscall (__NR_io_uring_enter, fileio_Uring.ring_fd, num_ops, 0, 0, NULL, 0);
+    }
+  while (ret < 0 && errno == EINTR);
+  if (ret != num_ops)
+    {
+      pthread_mutex_unlock (&fileio_Uring.mutex);
+      return ER_FAILED;
+    }
+
+  /* reap exactly num_ops completions; nothing else can be in flight while the mutex is held */
+  num_completed = 0;
+  while (num_completed < num_ops)
+    {
+      head = *fileio_Uring.cq_head;
+      if (head == __atomic_load_n (fileio_Uring.cq_tail, __ATOMIC_ACQUIRE))
+	{
+	  do
+	    {
+	      ret = (int) syscall (__NR_io_uring_enter, fileio_Uring.ring_fd, 0, num_ops - num_completed,
+				   IORING_ENTER_GETEVENTS, NULL, 0);
+	    }
+	  while (ret < 0 && errno == EINTR);
+	  if (ret < 0)
+	    {
+	      /* should not happen; disable the ring rather than risk leaving requests in flight again */
+	      fileio_Uring.state = -1;
+	      break;
+	    }
+	  continue;
+	}
+
+      cqe = &fileio_Uring.cqes[head & *fileio_Uring.cq_mask];
+      if (cqe->res != (int) page_size)
+	{
+	  assert (cqe->user_data < (unsigned long long) num_ops);
+	  has_failure = true;
+	}
+      __atomic_store_n (fileio_Uring.cq_head, head + 1, __ATOMIC_RELEASE);
+      num_completed++;
+    }
+
+  pthread_mutex_unlock (&fileio_Uring.mutex);
+
+  if (num_completed < num_ops || has_failure)
+    {
+      return ER_FAILED;
+    }
+
+  perfmon_add_stat (thread_p, ops[0].is_write ? PSTAT_FILE_NUM_IOWRITES : PSTAT_FILE_NUM_IOREADS, num_ops);
+  return NO_ERROR;
+#else /* !FILEIO_HAS_URING || !SERVER_MODE */
+  return ER_FAILED;
+#endif /* !FILEIO_HAS_URING || !SERVER_MODE */
+}
+
 /*
  * fileio_write_pages () - write the content of several contiguous pages to disk
  *   return: io_page_p on success, NULL on failure
@@ -4430,6 +4748,64 @@ fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID
   return io_page_array[0];
 }
 
+/*
+ * fileio_readv () - READ A CONTIGUOUS PAGE RANGE INTO AN ARRAY OF PAGE BUFFERS
+ *   return: io_page_array[0] I/O buffer pointer or NULL
+ *   vol_fd(in): Volume descriptor
+ *   io_page_array(out): Array of I/O page buffers
+ *   start_page_id(in): First page identifier
+ *   npages(in): Number of pages to read
+ *   page_size(in): Page size
+ *
+ * Note: the read counterpart of fileio_writev. On Linux all pages of a chunk are transferred with a single preadv
+ *	 call; on a short or interrupted transfer (and on other platforms) the remaining pages are read one by one.
+ */
+void *
+fileio_readv (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID start_page_id, DKNPAGES npages,
+	      size_t page_size)
+{
+  int i = 0;
+
+#if defined (LINUX)
+#define FILEIO_READV_CHUNK 64
+  while (i < npages)
+    {
+      struct iovec iov[FILEIO_READV_CHUNK];
+      off_t offset = FILEIO_GET_FILE_SIZE (page_size, start_page_id + i);
+      int chunk = MIN (npages - i, FILEIO_READV_CHUNK);
+      ssize_t nbytes;
+      int j;
+
+      for (j = 0; j < chunk; j++)
+	{
+	  iov[j].iov_base = io_page_array[i + j];
+	  iov[j].iov_len = page_size;
+	}
+
+      nbytes = preadv (vol_fd, iov, chunk, offset);
+      if (nbytes != (ssize_t) (chunk * page_size))
+	{
+	  /* short or interrupted transfer; let the per-page path finish (and report errors for) the rest */
+	  break;
+	}
+
+      perfmon_add_stat (thread_p, PSTAT_FILE_NUM_IOREADS, chunk);
+      i += chunk;
+    }
+#undef FILEIO_READV_CHUNK
+#endif /* LINUX */
+
+  for (; i < npages; i++)
+    {
+      if (fileio_read (thread_p, vol_fd, io_page_array[i], start_page_id + i, page_size) == NULL)
+	{
+	  return NULL;
+	}
+    }
+
+  return io_page_array[0];
+}
+
 /*
  * fileio_synchronize () - Synchronize a database volume's state with that on disk
  *   return: vdes or NULL_VOLDES
@@ -7878,6 +8254,16 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
 	  break;
 	}
 
+      /* skip pages that have not been flushed since the tracker's activation checkpoint without reading them */
+      if (thread_info_p->only_updated_pages == true
+	  && fileio_is_page_unchanged_for_backup (session_p, thread_info_p->pageid))
+	{
+	  thread_info_p->pageid++;
+	  pthread_mutex_unlock (&thread_info_p->mtx);
+	  node_p = NULL;
+	  continue;
+	}
+
       /* alloc queue node */
       node_p = fileio_allocate_node (queue_p, backup_header_p);
       if (node_p == NULL)
@@ -8185,82 +8571,267 @@ fileio_start_backup_thread (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * ses
 
 #if !defined(CS_MODE)
 /*
- * fileio_backup_volume () - Include the given database volume/file as part of
- *                       the backup
- *   return:
- *   session(in/out): The session array
- *   from_vlabel(in): Name of the database volume/file to include
- *   from_volid(in): Identifier of the database volume/file to include
- *   last_page(in): stop backing up this volume after this page
- *   only_updated_pages(in): If we are backing up the database with a specific
- *                           backup level. We may opt to backup only the
- *                           updated pages since previous backup.
+ * fileio_invalidate_changed_page_tracker () - Permanently stop trusting the
+ *                                             changed-page maps
+ *   return: void
  *
- * Note: Information about the database volume/file is recorded, so it
- *       can be recreated (e.g., name and space).
- *       If this is an incremental backup, only pages that have been
- *       updated since the previous backup are backed up, unless a
- *       specific request is given to backup all pages.
- *       Last_page can shorten the number of pages saved (i.e. for
- *       temp volumes, we do not need to backup the entire volume).
+ * Note: Called when a page write could not be remembered; from that point on
+ *       the maps are incomplete, so incremental backups fall back to reading
+ *       every page.
+ */
+static void
+fileio_invalidate_changed_page_tracker (void)
+{
+  pthread_mutex_lock (&fileio_Changed_page_mutex);
+  fileio_Changed_page_tracker_broken = true;
+  fileio_Changed_page_tracker_active = false;
+  pthread_mutex_unlock (&fileio_Changed_page_mutex);
+}
+
+/*
+ * fileio_mark_changed_page () - Remember that a permanent volume page is
+ *                               being written to disk
+ *   return: void
+ *   vol_id(in): Volume identifier of the page
+ *   page_id(in): Page identifier of the page
  *
- *       1)   The pages are backed up as they are currently stored on disk,
- *            that is, we do not use the page buffer pool for this operation
- *            since we do not want to disturbe the normal access patern of
- *            clients in the page buffer pool.
- *       2)   We open the file/volume instead of using the actual vdes, so
- *            that we avoid a bunch of lseeks.
+ * Note: Called by the flush paths of data pages.  Marking is cheap and always
+ *       on; whether incremental backups may trust the marks is decided by
+ *       fileio_activate_changed_page_tracker ().
  */
-int
-fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p, const char *from_vol_label_p,
-		      VOLID from_vol_id, PAGEID last_page, bool is_only_updated_pages)
+void
+fileio_mark_changed_page (VOLID vol_id, PAGEID page_id)
 {
-  struct stat from_stbuf;
-  int from_npages, npages;
-  int page_id;
-  int nread;
-  FILEIO_BACKUP_FILE_HEADER *file_header_p;
-  int check_ratio = 0;
-  int check_npages = 0;
-  FILEIO_THREAD_INFO *thread_info_p;
-  FILEIO_QUEUE *queue_p = NULL;
-  FILEIO_BACKUP_PAGE *save_area_p;
-  FILEIO_NODE *node_p = NULL;
-  FILEIO_BACKUP_HEADER *backup_header_p;
-  int rv;
-  bool is_need_vol_closed;
+  FILEIO_CHANGED_PAGE_MAP *map_p;
+  char *segment_p;
+  int segment_idx;
 
-#if (defined(WINDOWS) || !defined(SERVER_MODE))
-  off_t saved_act_log_fp = (off_t) - 1;
-#endif /* WINDOWS || !SERVER_MODE */
+  if (vol_id < LOG_DBFIRST_VOLID || page_id < 0)
+    {
+      return;
+    }
 
-  /*
-   * Backup the pages as they are stored on disk (i.e., don't care if they
-   * are stored on the page buffer pool any longer). We do not use the page
-   * buffer pool since we do not want to remove important pages that are
-   * used by clients.
-   * We also open the file/volume instead of using the one currently
-   * available since we do not want to be doing a lot of seeks.
-   * Remember that we can be preempted.
-   */
-  session_p->dbfile.vlabel = from_vol_label_p;
-  session_p->dbfile.volid = from_vol_id;
-  session_p->dbfile.vdes = NULL_VOLDES;
-  is_need_vol_closed = false;
-  if (from_vol_id == LOG_DBLOG_ACTIVE_VOLID)
+  segment_idx = page_id >> FILEIO_CHANGED_PAGE_SEGMENT_BITS;
+  if (segment_idx >= FILEIO_CHANGED_PAGE_MAX_SEGMENTS)
     {
-      session_p->dbfile.vdes = fileio_get_volume_descriptor (LOG_DBLOG_ACTIVE_VOLID);
-#if (defined(WINDOWS) || !defined(SERVER_MODE))
-      if (session_p->dbfile.vdes != NULL_VOLDES)
+      /* cannot remember this page; the maps are no longer complete */
+      fileio_invalidate_changed_page_tracker ();
+      return;
+    }
+
+  for (map_p = fileio_Changed_page_maps; map_p != NULL; map_p = map_p->next)
+    {
+      if (map_p->volid == vol_id)
 	{
-	  /* save current file pointer */
-	  saved_act_log_fp = lseek (session_p->dbfile.vdes, (off_t) 0, SEEK_CUR);
-	  /* reset file pointer */
-	  if (saved_act_log_fp == (off_t) - 1)
-	    {
-	      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_READ, 1, session_p->dbfile.vlabel);
-	      goto error;
-	    }
+	  break;
+	}
+    }
+
+  if (map_p == NULL)
+    {
+      pthread_mutex_lock (&fileio_Changed_page_mutex);
+      for (map_p = fileio_Changed_page_maps; map_p != NULL; map_p = map_p->next)
+	{
+	  if (map_p->volid == vol_id)
+	    {
+	      break;
+	    }
+	}
+      if (map_p == NULL)
+	{
+	  map_p = (FILEIO_CHANGED_PAGE_MAP *) calloc (1, sizeof (FILEIO_CHANGED_PAGE_MAP));
+	  if (map_p == NULL)
+	    {
+	      pthread_mutex_unlock (&fileio_Changed_page_mutex);
+	      fileio_invalidate_changed_page_tracker ();
+	      return;
+	    }
+	  map_p->volid = vol_id;
+	  map_p->next = fileio_Changed_page_maps;
+	  fileio_Changed_page_maps = map_p;
+	}
+      pthread_mutex_unlock (&fileio_Changed_page_mutex);
+    }
+
+  segment_p = map_p->segments[segment_idx];
+  if (segment_p == NULL)
+    {
+      pthread_mutex_lock (&fileio_Changed_page_mutex);
+      segment_p = map_p->segments[segment_idx];
+      if (segment_p == NULL)
+	{
+	  segment_p = (char *) calloc (FILEIO_CHANGED_PAGE_SEGMENT_NPAGES, sizeof (char));
+	  if (segment_p == NULL)
+	    {
+	      pthread_mutex_unlock (&fileio_Changed_page_mutex);
+	      fileio_invalidate_changed_page_tracker ();
+	      return;
+	    }
+	  map_p->segments[segment_idx] = segment_p;
+	}
+      pthread_mutex_unlock (&fileio_Changed_page_mutex);
+    }
+
+  segment_p[page_id & (FILEIO_CHANGED_PAGE_SEGMENT_NPAGES - 1)] = 1;
+}
+
+/*
+ * fileio_activate_changed_page_tracker () - Allow incremental backups to
+ *                                           trust the changed-page maps
+ *   return: void
+ *   chkpt_lsa(in): Address of a checkpoint logged by this process
+ *
+ * Note: Pages are marked from the moment the process starts, so every page
+ *       whose on-disk LSA ends up beyond a checkpoint logged by this process
+ *       is guaranteed to carry a mark: its content was appended after that
+ *       checkpoint and therefore flushed while marking was on.  An
+ *       incremental backup may hence skip unmarked pages once the LSA of its
+ *       previous backup is at or beyond the activation checkpoint.
+ */
+void
+fileio_activate_changed_page_tracker (const LOG_LSA * chkpt_lsa)
+{
+  pthread_mutex_lock (&fileio_Changed_page_mutex);
+  if (!fileio_Changed_page_tracker_broken && !fileio_Changed_page_tracker_active)
+    {
+      LSA_COPY (&fileio_Changed_page_activation_lsa, chkpt_lsa);
+      fileio_Changed_page_tracker_active = true;
+    }
+  pthread_mutex_unlock (&fileio_Changed_page_mutex);
+}
+
+/*
+ * fileio_is_page_unchanged_for_backup () - Can an incremental backup skip
+ *                                          this page without reading it?
+ *   return: true when the page cannot be newer than the previous backup
+ *   session_p(in): The session array
+ *   page_id(in): Page being considered by the backup scan
+ */
+static bool
+fileio_is_page_unchanged_for_backup (FILEIO_BACKUP_SESSION * session_p, PAGEID page_id)
+{
+  FILEIO_CHANGED_PAGE_MAP *map_p;
+  char *segment_p;
+  int segment_idx;
+
+  if (fileio_Changed_page_tracker_active == false || LSA_ISNULL (&session_p->dbfile.lsa)
+      || LSA_GT (&fileio_Changed_page_activation_lsa, &session_p->dbfile.lsa))
+    {
+      /* the maps do not cover the range between the previous backup and the activation checkpoint */
+      return false;
+    }
+
+  if (session_p->bkup.bkuphdr->bkpagesize != IO_PAGESIZE || session_p->dbfile.volid < LOG_DBFIRST_VOLID)
+    {
+      /* the maps work per database page and only describe permanent data volumes */
+      return false;
+    }
+
+  for (map_p = fileio_Changed_page_maps; map_p != NULL; map_p = map_p->next)
+    {
+      if (map_p->volid == session_p->dbfile.volid)
+	{
+	  break;
+	}
+    }
+  if (map_p == NULL)
+    {
+      /* no page of this volume has been flushed since the process started */
+      return true;
+    }
+
+  segment_idx = page_id >> FILEIO_CHANGED_PAGE_SEGMENT_BITS;
+  if (segment_idx >= FILEIO_CHANGED_PAGE_MAX_SEGMENTS)
+    {
+      return false;
+    }
+
+  segment_p = map_p->segments[segment_idx];
+  if (segment_p == NULL)
+    {
+      return true;
+    }
+
+  return segment_p[page_id & (FILEIO_CHANGED_PAGE_SEGMENT_NPAGES - 1)] == 0;
+}
+
+/*
+ * fileio_backup_volume () - Include the given database volume/file as part of
+ *                       the backup
+ *   return:
+ *   session(in/out): The session array
+ *   from_vlabel(in): Name of the database volume/file to include
+ *   from_volid(in): Identifier of the database volume/file to include
+ *   last_page(in): stop backing up this volume after this page
+ *   only_updated_pages(in): If we are backing up the database with a specific
+ *                           backup level. We may opt to backup only the
+ *                           updated pages since previous backup.
+ *
+ * Note: Information about the database volume/file is recorded, so it
+ *       can be recreated (e.g., name and space).
+ *       If this is an incremental backup, only pages that have been
+ *       updated since the previous backup are backed up, unless a
+ *       specific request is given to backup all pages.
+ *       Last_page can shorten the number of pages saved (i.e. for
+ *       temp volumes, we do not need to backup the entire volume).
+ *
+ *       1)   The pages are backed up as they are currently stored on disk,
+ *            that is, we do not use the page buffer pool for this operation
+ *            since we do not want to disturbe the normal access patern of
+ *            clients in the page buffer pool.
+ *       2)   We open the file/volume instead of using the actual vdes, so
+ *            that we avoid a bunch of lseeks.
+ */
+int
+fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p, const char *from_vol_label_p,
+		      VOLID from_vol_id, PAGEID last_page, bool is_only_updated_pages)
+{
+  struct stat from_stbuf;
+  int from_npages, npages;
+  int page_id;
+  int nread;
+  FILEIO_BACKUP_FILE_HEADER *file_header_p;
+  int check_ratio = 0;
+  int check_npages = 0;
+  FILEIO_THREAD_INFO *thread_info_p;
+  FILEIO_QUEUE *queue_p = NULL;
+  FILEIO_BACKUP_PAGE *save_area_p;
+  FILEIO_NODE *node_p = NULL;
+  FILEIO_BACKUP_HEADER *backup_header_p;
+  int rv;
+  bool is_need_vol_closed;
+
+#if (defined(WINDOWS) || !defined(SERVER_MODE))
+  off_t saved_act_log_fp = (off_t) - 1;
+#endif /* WINDOWS || !SERVER_MODE */
+
+  /*
+   * Backup the pages as they are stored on disk (i.e., don't care if they
+   * are stored on the page buffer pool any longer). We do not use the page
+   * buffer pool since we do not want to remove important pages that are
+   * used by clients.
+   * We also open the file/volume instead of using the one currently
+   * available since we do not want to be doing a lot of seeks.
+   * Remember that we can be preempted.
+   */
+  session_p->dbfile.vlabel = from_vol_label_p;
+  session_p->dbfile.volid = from_vol_id;
+  session_p->dbfile.vdes = NULL_VOLDES;
+  is_need_vol_closed = false;
+  if (from_vol_id == LOG_DBLOG_ACTIVE_VOLID)
+    {
+      session_p->dbfile.vdes = fileio_get_volume_descriptor (LOG_DBLOG_ACTIVE_VOLID);
+#if (defined(WINDOWS) || !defined(SERVER_MODE))
+      if (session_p->dbfile.vdes != NULL_VOLDES)
+	{
+	  /* save current file pointer */
+	  saved_act_log_fp = lseek (session_p->dbfile.vdes, (off_t) 0, SEEK_CUR);
+	  /* reset file pointer */
+	  if (saved_act_log_fp == (off_t) - 1)
+	    {
+	      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_READ, 1, session_p->dbfile.vlabel);
+	      goto error;
+	    }
 
 	  if (lseek (session_p->dbfile.vdes, (off_t) 0, SEEK_SET) == (off_t) - 1)
 	    {
@@ -8382,6 +8953,18 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 	      goto error;
 	    }
 
+	  /* skip pages that have not been flushed since the tracker's activation checkpoint without reading them */
+	  if (is_only_updated_pages == true && fileio_is_page_unchanged_for_backup (session_p, page_id))
+	    {
+	      if (session_p->verbose_fp && from_npages >= 25 && page_id >= check_npages)
+		{
+		  fprintf (session_p->verbose_fp, "#");
+		  check_ratio++;
+		  check_npages = (int) (((float) from_npages / 25.0) * check_ratio);
+		}
+	      continue;
+	    }
+
 	  /* alloc queue node */
 	  node_p = fileio_allocate_node (queue_p, backup_header_p);
 	  if (node_p == NULL)
@@ -10220,6 +10803,343 @@ exit_on_error:
 }
 
 #if !defined(CS_MODE)
+// *INDENT-OFF*
+/*
+ * fileio_restore_decompress_context - shared state between the restore main
+ * thread and its single decompress helper thread.
+ *
+ * The helper runs nothing but LZ4_decompress_safe (), so a plain std::thread
+ * is safe in both server and standalone restore; every archive read, page
+ * write and er_set () stays on the caller's thread (fileio_read_restore ()
+ * may have to switch backup volumes and prompt the user for them, and the
+ * error context is thread local).
+ */
+struct fileio_restore_decompress_context
+{
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  const char *m_zip_buffer = NULL;	/* compressed input block */
+  char *m_area = NULL;			/* decompressed output block */
+  int m_zip_len = 0;
+  int m_area_size = 0;
+  int m_unzip_len = 0;			/* LZ4_decompress_safe () result */
+  bool m_has_job = false;
+  bool m_job_done = false;
+  bool m_shutdown = false;
+
+  void
+  submit (const char *zip_buffer, int zip_len, char *area, int area_size)
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    if (!m_thread.joinable ())
+      {
+	/* started lazily so volumes of an uncompressed backup pay nothing */
+	m_thread = std::thread (&fileio_restore_decompress_context::run, this);
+      }
+    m_zip_buffer = zip_buffer;
+    m_zip_len = zip_len;
+    m_area = area;
+    m_area_size = area_size;
+    m_has_job = true;
+    m_job_done = false;
+    m_cond.notify_all ();
+  }
+
+  int
+  wait_result ()
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    m_cond.wait (lock, [this] { return m_job_done; });
+    return m_unzip_len;
+  }
+
+  void
+  run ()
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    while (true)
+      {
+	m_cond.wait (lock, [this] { return m_has_job || m_shutdown; });
+	if (m_shutdown)
+	  {
+	    return;
+	  }
+	m_has_job = false;
+	lock.unlock ();
+	int unzip_len = LZ4_decompress_safe (m_zip_buffer, m_area, m_zip_len, m_area_size);
+	lock.lock ();
+	m_unzip_len = unzip_len;
+	m_job_done = true;
+	m_cond.notify_all ();
+      }
+  }
+
+  ~fileio_restore_decompress_context ()
+  {
+    {
+      std::unique_lock<std::mutex> lock (m_mutex);
+      m_shutdown = true;
+      m_cond.notify_all ();
+    }
+    if (m_thread.joinable ())
+      {
+	m_thread.join ();
+      }
+  }
+};
+// *INDENT-ON*
+
+/*
+ * fileio_restore_volume_overlapped () - Restore the pages of an LZ4
+ *                                       compressed backup volume, overlapping
+ *                                       the decompression of each block with
+ *                                       the page writes of the previous one
+ *   return: error code
+ *   session_p(in/out): The session array
+ *   bitmap(in): Page bitmap to record which pages have already been restored
+ *   npages(in): Number of pages of the volume being restored
+ *   from_npages(in): Number of backup pages of the volume in the backup
+ *   unit(in): Number of IO_PAGESIZE pages per backup block
+ *   next_page_id_p(in/out): Next page to restore
+ *   total_nbytes_p(in/out): Number of bytes restored so far
+ *   check_ratio_p(in/out): Verbose progress state
+ *   check_npages_p(in/out): Verbose progress state
+ *   incremental_includes_volume_header_p(out): Set when an incremental backup
+ *                                              block carries the volume header
+ *
+ * Note: The serial path reads a block, inflates it and writes its pages
+ *       strictly one after another on the same thread.  Here the page writes
+ *       of block N - 1 are deferred until block N has been read and handed to
+ *       the helper thread, so the volume writes proceed while the helper
+ *       inflates.  Blocks cannot be read ahead instead: only the inflated
+ *       page id tells whether a block is the FILEIO_BACKUP_FILE_END_PAGE_ID
+ *       marker, and reading past it would consume the next file header of the
+ *       backup stream.
+ */
+static int
+fileio_restore_volume_overlapped (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p,
+				  FILEIO_RESTORE_PAGE_BITMAP * bitmap, int npages, int from_npages, int unit,
+				  int *next_page_id_p, INT64 * total_nbytes_p, int *check_ratio_p,
+				  int *check_npages_p, bool * incremental_includes_volume_header_p)
+{
+  FILEIO_BACKUP_HEADER *backup_header_p = session_p->bkup.bkuphdr;
+  FILEIO_QUEUE *queue_p = &session_p->read_thread_info.io_queue;
+  FILEIO_NODE *node = NULL;
+  FILEIO_BACKUP_PAGE *save_area_p, *target_area_p, *pending_area_p;
+  char *spare_area_p = NULL;
+  char *buffer_p;
+  int nbytes = FILEIO_RESTORE_DBVOLS_IO_PAGE_SIZE (session_p);
+  int error = NO_ERROR;
+  int rv, i;
+  bool job_in_flight = false;
+  // *INDENT-OFF*
+  fileio_restore_decompress_context decompress_context;
+  // *INDENT-ON*
+
+  assert (backup_header_p->zip_method == FILEIO_ZIP_LZ4_METHOD);
+
+  /* second output block, so the helper can inflate into one block while the other is written out */
+  spare_area_p = (char *) malloc (nbytes);
+  if (spare_area_p == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) nbytes);
+      return ER_FAILED;
+    }
+
+  /* one zip buffer is enough; it is only refilled after the helper has finished with it */
+  node = fileio_allocate_node (queue_p, backup_header_p);
+  if (node == NULL)
+    {
+      free_and_init (spare_area_p);
+      return ER_FAILED;
+    }
+
+  assert (node->zip_info != NULL);
+
+  target_area_p = session_p->dbfile.area;
+  pending_area_p = NULL;
+
+  while (true)
+    {
+      FILEIO_ZIP_PAGE *zip_page = &node->zip_info->zip_page;
+
+      /* read the length word of the next block */
+      save_area_p = session_p->dbfile.area;	/* save link */
+      session_p->dbfile.area = (FILEIO_BACKUP_PAGE *) zip_page;
+      rv = fileio_read_restore (thread_p, session_p, sizeof (int));
+      session_p->dbfile.area = save_area_p;	/* restore link */
+      if (rv != NO_ERROR)
+	{
+	  error = ER_IO_RESTORE_READ_ERROR;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, backup_header_p->unit_num);
+	  goto exit_on_error;
+	}
+
+      /* sanity check of the size values */
+      if (zip_page->buf_len > nbytes || zip_page->buf_len == 0)
+	{
+	  error = ER_IO_LZ4_COMPRESS_FAIL;	/* may be compress fail */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 4, backup_header_p->zip_method,
+		  fileio_get_zip_method_string (backup_header_p->zip_method), backup_header_p->zip_level,
+		  fileio_get_zip_level_string (backup_header_p->zip_level));
+	  goto exit_on_error;
+	}
+      else if (zip_page->buf_len < nbytes)
+	{
+	  /* read compressed block data and inflate it on the helper thread */
+	  save_area_p = session_p->dbfile.area;	/* save link */
+	  session_p->dbfile.area = (FILEIO_BACKUP_PAGE *) zip_page->buf;
+	  rv = fileio_read_restore (thread_p, session_p, zip_page->buf_len);
+	  session_p->dbfile.area = save_area_p;	/* restore link */
+	  if (rv != NO_ERROR)
+	    {
+	      error = ER_IO_RESTORE_READ_ERROR;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, backup_header_p->unit_num);
+	      goto exit_on_error;
+	    }
+
+	  decompress_context.submit ((const char *) zip_page->buf, zip_page->buf_len, (char *) target_area_p, nbytes);
+	  job_in_flight = true;
+	}
+      else
+	{
+	  /* no compressed block; read it straight into place */
+	  save_area_p = session_p->dbfile.area;	/* save link */
+	  session_p->dbfile.area = target_area_p;
+	  rv = fileio_read_restore (thread_p, session_p, zip_page->buf_len);
+	  session_p->dbfile.area = save_area_p;	/* restore link */
+	  if (rv != NO_ERROR)
+	    {
+	      error = ER_IO_RESTORE_READ_ERROR;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, backup_header_p->unit_num);
+	      goto exit_on_error;
+	    }
+	}
+
+      /* while the helper inflates the new block, write out the previous one */
+      if (pending_area_p != NULL)
+	{
+	  buffer_p = (char *) &pending_area_p->iopage;
+	  for (i = 0; i < unit && *next_page_id_p < npages; i++)
+	    {
+	      if (fileio_write_restore (thread_p, bitmap, session_p->dbfile.vdes, buffer_p + i * IO_PAGESIZE,
+					session_p->dbfile.volid, *next_page_id_p, session_p->dbfile.level) == NULL)
+		{
+		  error = ER_IO_RESTORE_READ_ERROR;
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, backup_header_p->unit_num);
+		  goto exit_on_error;
+		}
+
+	      *next_page_id_p += 1;
+	      *total_nbytes_p += IO_PAGESIZE;
+	      if (session_p->verbose_fp && npages >= 25 && *next_page_id_p >= *check_npages_p)
+		{
+		  fprintf (session_p->verbose_fp, "#");
+		  *check_ratio_p += 1;
+		  *check_npages_p = (int) (((float) npages / 25.0) * (*check_ratio_p));
+		}
+	    }
+	  pending_area_p = NULL;
+	}
+
+      if (job_in_flight)
+	{
+	  int unzip_len = decompress_context.wait_result ();
+
+	  job_in_flight = false;
+	  if (unzip_len < 0 || unzip_len != nbytes)
+	    {
+	      error = ER_IO_LZ4_DECOMPRESS_FAIL;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+	      goto exit_on_error;
+	    }
+	}
+
+      if (FILEIO_GET_BACKUP_PAGE_ID (target_area_p) == FILEIO_BACKUP_FILE_END_PAGE_ID)
+	{
+	  /*
+	   * End of File marker in backup, but may not be true end of file being
+	   * restored so we have to continue filling in pages until the
+	   * restored volume is finished.
+	   */
+	  if (session_p->dbfile.level == FILEIO_BACKUP_FULL_LEVEL && *next_page_id_p < npages)
+	    {
+	      if (fileio_fill_hole_during_restore (thread_p, next_page_id_p, npages, session_p, bitmap) != NO_ERROR)
+		{
+		  goto exit_on_error;
+		}
+	    }
+	  break;
+	}
+
+      if (FILEIO_GET_BACKUP_PAGE_ID (target_area_p) > from_npages)
+	{
+	  /* Too many pages for this volume according to the file header */
+	  error = ER_IO_RESTORE_PAGEID_OUTOF_BOUNDS;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 4, backup_header_p->unit_num,
+		  FILEIO_GET_BACKUP_PAGE_ID (target_area_p), from_npages, session_p->dbfile.volid);
+	  goto exit_on_error;
+	}
+
+      if (!FILEIO_CHECK_RESTORE_PAGE_ID (target_area_p, backup_header_p->bkpagesize))
+	{
+	  error = ER_IO_RESTORE_READ_ERROR;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, backup_header_p->unit_num);
+	  goto exit_on_error;
+	}
+
+      /* Check for holes and fill them (only for full backup level) */
+      if (session_p->dbfile.level == FILEIO_BACKUP_FULL_LEVEL
+	  && (*next_page_id_p < FILEIO_GET_BACKUP_PAGE_ID (target_area_p)))
+	{
+	  if (fileio_fill_hole_during_restore (thread_p, next_page_id_p, target_area_p->iopageid, session_p, bitmap)
+	      != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	}
+
+      if (session_p->dbfile.level != FILEIO_BACKUP_FULL_LEVEL)
+	{
+	  *next_page_id_p = FILEIO_GET_BACKUP_PAGE_ID (target_area_p);
+	  if (*next_page_id_p == DISK_VOLHEADER_PAGE)
+	    {
+	      *incremental_includes_volume_header_p = true;
+	    }
+	}
+
+      /* defer the writes of this block until the next one is decompressing */
+      pending_area_p = target_area_p;
+      target_area_p = ((char *) target_area_p == spare_area_p
+		       ? session_p->dbfile.area : (FILEIO_BACKUP_PAGE *) spare_area_p);
+    }
+
+exit_on_end:
+
+  if (job_in_flight)
+    {
+      /* do not free the buffers under the helper */
+      (void) decompress_context.wait_result ();
+    }
+
+  if (node != NULL)
+    {
+      (void) fileio_free_node (queue_p, node);
+    }
+
+  free_and_init (spare_area_p);
+
+  return error;
+exit_on_error:
+
+  if (error == NO_ERROR)
+    {
+      error = ER_FAILED;
+    }
+  goto exit_on_end;
+}
+
 /*
  * fileio_restore_volume () - Restore a volume/file of given database
  *   return:
@@ -10303,89 +11223,102 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
   from_npages = (int) CEIL_PTVDIV (session_p->dbfile.nbytes, backup_header_p->bkpagesize);
   nbytes = FILEIO_RESTORE_DBVOLS_IO_PAGE_SIZE (session_p);
 
-  while (true)
+  if (backup_header_p->zip_method == FILEIO_ZIP_LZ4_METHOD)
     {
-      if (fileio_decompress_restore_volume (thread_p, session_p, nbytes) != NO_ERROR)
+      /* overlap each block's LZ4 decompression with the previous block's page writes */
+      if (fileio_restore_volume_overlapped (thread_p, session_p, bitmap, npages, from_npages, unit, &next_page_id,
+					    &total_nbytes, &check_ratio, &check_npages,
+					    &incremental_includes_volume_header) != NO_ERROR)
 	{
 	  goto error;
 	}
-
-      if (FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area) == FILEIO_BACKUP_FILE_END_PAGE_ID)
+    }
+  else
+    {
+      while (true)
 	{
-	  /*
-	   * End of File marker in backup, but may not be true end of file being
-	   * restored so we have to continue filling in pages until the
-	   * restored volume is finished.
-	   */
-	  if (session_p->dbfile.level == FILEIO_BACKUP_FULL_LEVEL && next_page_id < npages)
+	  if (fileio_decompress_restore_volume (thread_p, session_p, nbytes) != NO_ERROR)
 	    {
-	      if (fileio_fill_hole_during_restore (thread_p, &next_page_id, npages, session_p, bitmap) != NO_ERROR)
+	      goto error;
+	    }
+
+	  if (FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area) == FILEIO_BACKUP_FILE_END_PAGE_ID)
+	    {
+	      /*
+	       * End of File marker in backup, but may not be true end of file being
+	       * restored so we have to continue filling in pages until the
+	       * restored volume is finished.
+	       */
+	      if (session_p->dbfile.level == FILEIO_BACKUP_FULL_LEVEL && next_page_id < npages)
 		{
-		  goto error;
+		  if (fileio_fill_hole_during_restore (thread_p, &next_page_id, npages, session_p, bitmap) != NO_ERROR)
+		    {
+		      goto error;
+		    }
 		}
+	      break;
 	    }
-	  break;
-	}
 
-      if (FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area) > from_npages)
-	{
-	  /* Too many pages for this volume according to the file header */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_PAGEID_OUTOF_BOUNDS, 4, backup_header_p->unit_num,
-		  FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area), from_npages, session_p->dbfile.volid);
-	  goto error;
-	}
-
-#if defined(CUBRID_DEBUG)
-      fprintf (stdout, "fileio_restore_volume: %d\t%d,\t%d\n",
-	       ((FILEIO_BACKUP_PAGE *) (session_p->dbfile.area))->iopageid,
-	       *(PAGEID *) (((char *) (session_p->dbfile.area)) + offsetof (FILEIO_BACKUP_PAGE, iopage) +
-			    backup_header_p->bkpagesize), backup_header_p->bkpagesize);
-#endif
+	  if (FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area) > from_npages)
+	    {
+	      /* Too many pages for this volume according to the file header */
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_PAGEID_OUTOF_BOUNDS, 4, backup_header_p->unit_num,
+		      FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area), from_npages, session_p->dbfile.volid);
+	      goto error;
+	    }
 
-      if (!FILEIO_CHECK_RESTORE_PAGE_ID (session_p->dbfile.area, backup_header_p->bkpagesize))
-	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, backup_header_p->unit_num);
-	  goto error;
-	}
+    #if defined(CUBRID_DEBUG)
+	  fprintf (stdout, "fileio_restore_volume: %d\t%d,\t%d\n",
+		   ((FILEIO_BACKUP_PAGE *) (session_p->dbfile.area))->iopageid,
+		   *(PAGEID *) (((char *) (session_p->dbfile.area)) + offsetof (FILEIO_BACKUP_PAGE, iopage) +
+				backup_header_p->bkpagesize), backup_header_p->bkpagesize);
+    #endif
 
-      /* Check for holes and fill them (only for full backup level) */
-      if (session_p->dbfile.level == FILEIO_BACKUP_FULL_LEVEL
-	  && (next_page_id < FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area)))
-	{
-	  if (fileio_fill_hole_during_restore (thread_p, &next_page_id, session_p->dbfile.area->iopageid, session_p,
-					       bitmap) != NO_ERROR)
+	  if (!FILEIO_CHECK_RESTORE_PAGE_ID (session_p->dbfile.area, backup_header_p->bkpagesize))
 	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, backup_header_p->unit_num);
 	      goto error;
 	    }
-	}
 
-      /* Restore the page we just read in */
-      if (session_p->dbfile.level != FILEIO_BACKUP_FULL_LEVEL)
-	{
-	  next_page_id = FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area);
-	  if (next_page_id == DISK_VOLHEADER_PAGE)
+	  /* Check for holes and fill them (only for full backup level) */
+	  if (session_p->dbfile.level == FILEIO_BACKUP_FULL_LEVEL
+	      && (next_page_id < FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area)))
 	    {
-	      incremental_includes_volume_header = true;
+	      if (fileio_fill_hole_during_restore (thread_p, &next_page_id, session_p->dbfile.area->iopageid, session_p,
+						   bitmap) != NO_ERROR)
+		{
+		  goto error;
+		}
 	    }
-	}
 
-      buffer_p = (char *) &session_p->dbfile.area->iopage;
-      for (i = 0; i < unit && next_page_id < npages; i++)
-	{
-	  if (fileio_write_restore (thread_p, bitmap, session_p->dbfile.vdes, buffer_p + i * IO_PAGESIZE,
-				    session_p->dbfile.volid, next_page_id, session_p->dbfile.level) == NULL)
+	  /* Restore the page we just read in */
+	  if (session_p->dbfile.level != FILEIO_BACKUP_FULL_LEVEL)
 	    {
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, backup_header_p->unit_num);
-	      goto error;
+	      next_page_id = FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area);
+	      if (next_page_id == DISK_VOLHEADER_PAGE)
+		{
+		  incremental_includes_volume_header = true;
+		}
 	    }
 
-	  next_page_id += 1;
-	  total_nbytes += IO_PAGESIZE;
-	  if (session_p->verbose_fp && npages >= 25 && next_page_id >= check_npages)
+	  buffer_p = (char *) &session_p->dbfile.area->iopage;
+	  for (i = 0; i < unit && next_page_id < npages; i++)
 	    {
-	      fprintf (session_p->verbose_fp, "#");
-	      check_ratio++;
-	      check_npages = (int) (((float) npages / 25.0) * check_ratio);
+	      if (fileio_write_restore (thread_p, bitmap, session_p->dbfile.vdes, buffer_p + i * IO_PAGESIZE,
+					session_p->dbfile.volid, next_page_id, session_p->dbfile.level) == NULL)
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, backup_header_p->unit_num);
+		  goto error;
+		}
+
+	      next_page_id += 1;
+	      total_nbytes += IO_PAGESIZE;
+	      if (session_p->verbose_fp && npages >= 25 && next_page_id >= check_npages)
+		{
+		  fprintf (session_p->verbose_fp, "#");
+		  check_ratio++;
+		  check_npages = (int) (((float) npages / 25.0) * check_ratio);
+		}
 	    }
 	}
     }
@@ -11582,7 +12515,7 @@ fileio_initialize_res (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, PGLENGTH
 
   io_page->prv.ptype = '\0';
   io_page->prv.pflag = '\0';
-  io_page->prv.p_reserve_1 = 0;
+  io_page->prv.checksum = 0;
   io_page->prv.p_reserve_2 = 0;
   io_page->prv.tde_nonce = 0;
 }
@@ -11837,6 +12770,90 @@ fileio_page_check_corruption (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, bo
   return NO_ERROR;
 }
 
+/*
+ * fileio_compute_page_checksum - Computes the checksum of a data page.
+ *   return: error code
+ *   thread_p (in): thread entry
+ *   io_page (in): the page
+ *   checksum_crc32c (out): computed checksum
+ *   Note: CRC32C is used as checksum since it has hardware support on common
+ *         platforms; unlike the sampled log page checksum, the whole page
+ *         image is covered.
+ */
+static int
+fileio_compute_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, int *checksum_crc32c)
+{
+  int saved_checksum;
+
+  assert (io_page != NULL && checksum_crc32c != NULL);
+
+  /* Save the old page checksum. */
+  saved_checksum = io_page->prv.checksum;
+
+  /* Resets checksum to not affect the new computation. */
+  io_page->prv.checksum = 0;
+
+  crypt_crc32c ((char *) io_page, (int) IO_PAGESIZE, checksum_crc32c);
+
+  /* Restores the saved checksum. */
+  io_page->prv.checksum = saved_checksum;
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_set_page_checksum - Set the checksum of a data page before it is written to disk.
+ *   return: void
+ *   thread_p (in): thread entry
+ *   io_page (in/out): the on-disk page image
+ *   Note: a computed checksum of 0 is left as is; such a page is simply not
+ *         verified on read, like pages written before checksums existed.
+ */
+void
+fileio_set_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page)
+{
+  int checksum_crc32c;
+
+  assert (io_page != NULL);
+
+  (void) fileio_compute_page_checksum (thread_p, io_page, &checksum_crc32c);
+
+  io_page->prv.checksum = checksum_crc32c;
+}
+
+/*
+ * fileio_page_check_checksum - Check whether the stored page checksum matches the page content.
+ *   return: error code
+ *   thread_p (in): thread entry
+ *   io_page (in): the page, as read from disk
+ *   is_page_corrupted (out): true, if the stored checksum does not match.
+ *   Note: pages with a stored checksum of 0 are reported as not corrupted;
+ *         they were written without a checksum.
+ */
+int
+fileio_page_check_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, bool * is_page_corrupted)
+{
+  int checksum_crc32c, error_code;
+
+  assert (io_page != NULL && is_page_corrupted != NULL);
+
+  if (io_page->prv.checksum == 0)
+    {
+      *is_page_corrupted = false;
+      return NO_ERROR;
+    }
+
+  error_code = fileio_compute_page_checksum (thread_p, io_page, &checksum_crc32c);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  *is_page_corrupted = (checksum_crc32c != io_page->prv.checksum);
+
+  return NO_ERROR;
+}
+
 bool
 fileio_is_formatted_page (THREAD_ENTRY * thread_p, const char *io_page)
 {
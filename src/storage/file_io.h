@@ -176,7 +176,7 @@ struct fileio_page_reserved
   INT16 volid;			/* Volume identifier where the page reside */
   unsigned char ptype;		/* Page type */
   unsigned char pflag;
-  INT32 p_reserve_1;
+  INT32 checksum;		/* CRC32C of the on-disk page image; 0 when no checksum was stored */
   INT32 p_reserve_2;		/* unused - Reserved field */
   INT64 tde_nonce;		/* tde nonce. atomic counter for temp pages, lsa for perm pages */
 };
@@ -486,10 +486,29 @@ extern void *fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p,
 			   FILEIO_WRITE_MODE write_mode);
 extern void *fileio_read_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEID page_id, int num_pages,
 				size_t page_size);
+extern int fileio_prefetch_pages (THREAD_ENTRY * thread_p, int vol_fd, PAGEID page_id, int num_pages);
+
+/* one operation of a batched io_uring submission; see fileio_uring_rw_batch */
+typedef struct fileio_batch_op FILEIO_BATCH_OP;
+struct fileio_batch_op
+{
+  int vdes;			/* volume descriptor */
+  void *io_page_p;		/* page buffer; must stay valid until the batch returns */
+  PAGEID page_id;		/* page position in the volume */
+  bool is_write;		/* write when true, read otherwise */
+};
+
+/* largest number of operations one fileio_uring_rw_batch call accepts (also the kernel ring depth) */
+#define FILEIO_URING_MAX_BATCH 128
+
+extern bool fileio_uring_is_available (void);
+extern int fileio_uring_rw_batch (THREAD_ENTRY * thread_p, FILEIO_BATCH_OP * ops, int num_ops, size_t page_size);
 extern void *fileio_write_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEID page_id, int num_pages,
 				 size_t page_size, FILEIO_WRITE_MODE write_mode);
 extern void *fileio_writev (THREAD_ENTRY * thread_p, int vdes, void **arrayof_io_pgptr, PAGEID start_pageid,
 			    DKNPAGES npages, size_t page_size);
+extern void *fileio_readv (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID start_page_id,
+			   DKNPAGES npages, size_t page_size);
 extern int fileio_synchronize (THREAD_ENTRY * thread_p, int vdes, const char *vlabel,
 			       FILEIO_SYNC_OPTION check_sync_dwb);
 extern int fileio_synchronize_all (THREAD_ENTRY * thread_p, bool include_log);
@@ -579,6 +598,8 @@ extern int fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION
 				  char *verbose_to_vlabel, char *prev_vlabel, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap,
 				  bool remember_pages);
 extern int fileio_skip_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session);
+extern void fileio_mark_changed_page (VOLID vol_id, PAGEID page_id);
+extern void fileio_activate_changed_page_tracker (const LOG_LSA * chkpt_lsa);
 extern const char *fileio_get_zip_method_string (FILEIO_ZIP_METHOD zip_method);
 extern const char *fileio_get_zip_level_string (FILEIO_ZIP_LEVEL zip_level);
 
@@ -623,8 +644,9 @@ extern FILEIO_RESTORE_PAGE_BITMAP *fileio_page_bitmap_list_find (FILEIO_RESTORE_
 extern void fileio_page_bitmap_list_add (FILEIO_RESTORE_PAGE_BITMAP_LIST * page_bitmap_list,
 					 FILEIO_RESTORE_PAGE_BITMAP * page_bitmap);
 extern void fileio_page_bitmap_list_destroy (FILEIO_RESTORE_PAGE_BITMAP_LIST * page_bitmap_list);
-extern int fileio_set_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page);
 extern int fileio_page_check_corruption (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, bool * is_page_corrupted);
+extern void fileio_set_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page);
+extern int fileio_page_check_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, bool * is_page_corrupted);
 extern void fileio_page_hexa_dump (const char *data, int length);
 extern bool fileio_is_formatted_page (THREAD_ENTRY * thread_p, const char *io_page);
 #endif /* _FILE_IO_H_ */
@@ -289,6 +289,10 @@ struct file_partial_sector
 #define FILE_TABLESPACE_DEFAULT_MIN_EXPAND (DISK_SECTOR_NPAGES * DB_PAGESIZE);	/* one sector */
 #define FILE_TABLESPACE_DEFAULT_MAX_EXPAND (DISK_SECTOR_NPAGES * DB_PAGESIZE * 1024);	/* 1k sectors */
 
+/* expansion cap for temporary files. spilling files double their size per expansion (up to this many sectors per
+ * disk manager call) so concurrent spilling queries don't fight over sector reservation one sector at a time. */
+#define FILE_TEMP_EXPAND_MAX_NSECTS 16
+
 #define FILE_TABLESPACE_FOR_PERM_NPAGES(tabspace, npages) \
   ((FILE_TABLESPACE *) (tabspace))->initial_size = (INT64) MAX (1, npages) * DB_PAGESIZE; \
   ((FILE_TABLESPACE *) (tabspace))->expand_ratio = FILE_TABLESPACE_DEFAULT_RATIO_EXPAND; \
@@ -464,7 +468,7 @@ struct file_find_nth_context
 /************************************************************************/
 /* Temporary cache section                                              */
 /************************************************************************/
-typedef struct file_tempcache_entry FILE_TEMPCACHE_ENTRY;
+/* FILE_TEMPCACHE_ENTRY typedef is exported (opaque) through file_manager.h */
 struct file_tempcache_entry
 {
   VFID vfid;
@@ -4325,6 +4329,28 @@ file_temp_retire_preserved (THREAD_ENTRY * thread_p, const VFID * vfid)
  */
 STATIC_INLINE int
 file_temp_retire_internal (THREAD_ENTRY * thread_p, const VFID * vfid, bool was_preserved)
+{
+  FILE_TEMPCACHE_ENTRY *entry = NULL;
+
+  (void) file_temp_preretire (thread_p, vfid, was_preserved, &entry);
+
+  return file_temp_retire_detached (thread_p, vfid, entry);
+}
+
+/*
+ * file_temp_preretire () - detach temporary file from transaction bookkeeping. this is the only part of retirement
+ *                          bound to the owning transaction; the returned entry can be passed to
+ *                          file_temp_retire_detached from any thread to finish the retirement.
+ *
+ * return             : error code
+ * thread_p (in)      : thread entry (must belong to the transaction owning the file)
+ * vfid (in)          : file identifier
+ * was_preserved (in) : true if entry was preserved in session. it is important to know because we cannot find it in
+ *                      transaction list.
+ * entry_out (out)    : detached temporary cache entry (may be output NULL on error; the file must still be retired)
+ */
+int
+file_temp_preretire (THREAD_ENTRY * thread_p, const VFID * vfid, bool was_preserved, FILE_TEMPCACHE_ENTRY ** entry_out)
 {
   FILE_TEMPCACHE_ENTRY *entry = NULL;
   int error_code = NO_ERROR;
@@ -4354,6 +4380,24 @@ file_temp_retire_internal (THREAD_ENTRY * thread_p, const VFID * vfid, bool was_
       assert (entry != NULL);
     }
 
+  *entry_out = entry;
+  return error_code;
+}
+
+/*
+ * file_temp_retire_detached () - finish retirement of a detached temporary file. put it in cache if possible or
+ *                                destroy the file.
+ *
+ * return        : error code
+ * thread_p (in) : thread entry (any thread; the file is no longer tracked by its transaction)
+ * vfid (in)     : file identifier
+ * entry (in)    : entry obtained from file_temp_preretire (may be NULL; the file is then destroyed)
+ */
+int
+file_temp_retire_detached (THREAD_ENTRY * thread_p, const VFID * vfid, FILE_TEMPCACHE_ENTRY * entry)
+{
+  int error_code = NO_ERROR;
+
   if (entry != NULL && file_tempcache_put (thread_p, entry))
     {
       /* cached */
@@ -8412,6 +8456,9 @@ file_temp_alloc (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, FILE_ALLOC_TYPE a
   FILE_EXTENSIBLE_DATA *extdata_part_ftab = NULL;
   PAGE_PTR page_ftab = NULL;
   FILE_PARTIAL_SECTOR *partsect = NULL;
+  /* tail of partial table during expansion; fixed separately only when the batch outgrows the cursor page */
+  FILE_EXTENSIBLE_DATA *extdata_tail = NULL;
+  PAGE_PTR page_ftab_tail = NULL;
   bool was_empty = false;
   bool is_full = false;
   /* we don't have rollback, so don't interrupt */
@@ -8461,12 +8508,26 @@ file_temp_alloc (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, FILE_ALLOC_TYPE a
 
   if (fhead->n_page_free == 0)
     {
-      /* expand file by one sector */
-      FILE_PARTIAL_SECTOR partsect_new = FILE_PARTIAL_SECTOR_INITIALIZER;
+      /* expand file. double the file size per expansion (capped at FILE_TEMP_EXPAND_MAX_NSECTS sectors) so spilling
+       * files don't go through the disk manager for every single sector. temporary files never deallocate and are
+       * soon destroyed or cached wholesale, so the cap keeps over-reservation modest. */
+      VSID vsids_reserved[FILE_TEMP_EXPAND_MAX_NSECTS];
+      int nsect_reserve = MIN (MAX (fhead->n_sector_total, 1), FILE_TEMP_EXPAND_MAX_NSECTS);
+      int isect;
 
-      /* reserve a sector */
+      /* reserve sectors */
       error_code =
-	disk_reserve_sectors (thread_p, DB_TEMPORARY_DATA_PURPOSE, fhead->volid_last_expand, 1, &partsect_new.vsid);
+	disk_reserve_sectors (thread_p, DB_TEMPORARY_DATA_PURPOSE, fhead->volid_last_expand, nsect_reserve,
+			      vsids_reserved);
+      if (error_code != NO_ERROR && nsect_reserve > 1)
+	{
+	  /* not enough space for a full extent; fall back to a single sector so behavior near temporary space
+	   * exhaustion does not change. */
+	  er_clear ();
+	  nsect_reserve = 1;
+	  error_code =
+	    disk_reserve_sectors (thread_p, DB_TEMPORARY_DATA_PURPOSE, fhead->volid_last_expand, 1, vsids_reserved);
+	}
       if (error_code != NO_ERROR)
 	{
 	  assert_release (false);
@@ -8474,85 +8535,127 @@ file_temp_alloc (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, FILE_ALLOC_TYPE a
 	}
 
       file_log ("file_temp_alloc",
-		"no free pages" FILE_HEAD_ALLOC_MSG "\texpand file with VSID = %d|%d ",
-		FILE_HEAD_ALLOC_AS_ARGS (fhead), VSID_AS_ARGS (&partsect_new.vsid));
+		"no free pages" FILE_HEAD_ALLOC_MSG "\texpand file with %d sectors, first VSID = %d|%d ",
+		FILE_HEAD_ALLOC_AS_ARGS (fhead), nsect_reserve, VSID_AS_ARGS (&vsids_reserved[0]));
 
       assert (extdata_part_ftab != NULL);
-      if (file_extdata_is_full (extdata_part_ftab))
+      assert (extdata_tail == NULL && page_ftab_tail == NULL);
+      /* appends go to the tail of the partial table, which starts out as the allocation cursor page but may move past
+       * it when the batch fills the page. */
+      extdata_tail = extdata_part_ftab;
+
+      for (isect = 0; isect < nsect_reserve; isect++)
 	{
-	  /* we need a new page. */
-	  /* we will use first page of newly reserved sector. */
-	  VPID vpid_ftab_new;
-	  PAGE_PTR page_ftab_new = NULL;
+	  FILE_PARTIAL_SECTOR partsect_new = FILE_PARTIAL_SECTOR_INITIALIZER;
 
-	  vpid_ftab_new.volid = partsect_new.vsid.volid;
-	  vpid_ftab_new.pageid = SECTOR_FIRST_PAGEID (partsect_new.vsid.sectid);
-	  file_partsect_set_bit (&partsect_new, 0);
+	  partsect_new.vsid = vsids_reserved[isect];
 
-	  /* fix new file table page */
-	  page_ftab_new = pgbuf_fix (thread_p, &vpid_ftab_new, NEW_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
-	  if (page_ftab_new == NULL)
+	  if (file_extdata_is_full (extdata_tail))
 	    {
-	      error_code = ER_FAILED;
+	      /* we need a new page. */
+	      /* we will use first page of newly reserved sector. */
+	      VPID vpid_ftab_new;
+	      PAGE_PTR page_ftab_new = NULL;
+
+	      vpid_ftab_new.volid = partsect_new.vsid.volid;
+	      vpid_ftab_new.pageid = SECTOR_FIRST_PAGEID (partsect_new.vsid.sectid);
+	      file_partsect_set_bit (&partsect_new, 0);
+
+	      /* fix new file table page */
+	      page_ftab_new =
+		pgbuf_fix (thread_p, &vpid_ftab_new, NEW_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
+	      if (page_ftab_new == NULL)
+		{
+		  error_code = ER_FAILED;
 
-	      /* todo: unreserve sector */
-	      goto exit;
-	    }
-	  pgbuf_set_page_ptype (thread_p, page_ftab_new, PAGE_FTAB);
+		  /* todo: unreserve sectors */
+		  goto exit;
+		}
+	      pgbuf_set_page_ptype (thread_p, page_ftab_new, PAGE_FTAB);
 
-	  /* set link to previous page. */
-	  VPID_COPY (&extdata_part_ftab->vpid_next, &vpid_ftab_new);
+	      /* set link to previous page. */
+	      VPID_COPY (&extdata_tail->vpid_next, &vpid_ftab_new);
 
-	  /* we don't need old file table page anymore */
-	  assert (page_ftab != page_fhead);
-	  if (page_ftab != NULL)
-	    {
-	      pgbuf_set_dirty_and_free (thread_p, page_ftab);
-	    }
+	      if (page_ftab_tail == NULL && fhead->offset_to_last_temp_alloc == file_extdata_item_count (extdata_tail))
+		{
+		  /* the allocation cursor consumed the entire old tail page; advance it to the new page and drop the
+		   * old one. */
+		  assert (page_ftab != page_fhead);
+		  if (page_ftab != NULL)
+		    {
+		      pgbuf_set_dirty_and_free (thread_p, page_ftab);
+		    }
 
-	  VPID_COPY (&fhead->vpid_last_temp_alloc, &vpid_ftab_new);
-	  fhead->offset_to_last_temp_alloc = 0;
-	  pgbuf_set_dirty (thread_p, page_fhead, DONT_FREE);
+		  VPID_COPY (&fhead->vpid_last_temp_alloc, &vpid_ftab_new);
+		  fhead->offset_to_last_temp_alloc = 0;
+		  pgbuf_set_dirty (thread_p, page_fhead, DONT_FREE);
 
-	  page_ftab = page_ftab_new;
-	  extdata_part_ftab = (FILE_EXTENSIBLE_DATA *) page_ftab;
-	  file_extdata_init (sizeof (FILE_PARTIAL_SECTOR), DB_PAGESIZE, extdata_part_ftab);
+		  page_ftab = page_ftab_new;
+		  extdata_part_ftab = (FILE_EXTENSIBLE_DATA *) page_ftab;
+		}
+	      else
+		{
+		  /* the cursor still has sectors of this batch to consume on its page; it will follow vpid_next
+		   * later. keep the cursor page fixed and track the new tail separately. */
+		  if (page_ftab_tail != NULL)
+		    {
+		      pgbuf_set_dirty_and_free (thread_p, page_ftab_tail);
+		    }
+		  else if (page_ftab != NULL)
+		    {
+		      /* tail was the cursor page; its vpid_next changed */
+		      pgbuf_set_dirty (thread_p, page_ftab, DONT_FREE);
+		    }
+		  page_ftab_tail = page_ftab_new;
+		}
+	      extdata_tail = (FILE_EXTENSIBLE_DATA *) page_ftab_new;
+	      file_extdata_init (sizeof (FILE_PARTIAL_SECTOR), DB_PAGESIZE, extdata_tail);
 
-	  file_log ("file_temp_alloc",
-		    "used newly reserved sector's first page %d|%d for partial table.", VPID_AS_ARGS (&vpid_ftab_new));
+	      file_log ("file_temp_alloc",
+			"used newly reserved sector's first page %d|%d for partial table.",
+			VPID_AS_ARGS (&vpid_ftab_new));
 
-	  /* update temporary file stats - DISK_SECTOR_NPAGES -1 reserved pages and 1 file table page. */
-	  ATOMIC_INC_32 (&file_Tempcache->spacedb_temp.npage_reserved, DISK_SECTOR_NPAGES - 1);
-	  ATOMIC_INC_32 (&file_Tempcache->spacedb_temp.npage_ftab, 1);
-	}
-      else
-	{
-	  /* update temporary file stats - DISK_SECTOR_NPAGES reserved pages */
-	  ATOMIC_INC_32 (&file_Tempcache->spacedb_temp.npage_reserved, DISK_SECTOR_NPAGES);
-	}
-      assert (!file_extdata_is_full (extdata_part_ftab));
-      assert (file_extdata_item_count (extdata_part_ftab) == fhead->offset_to_last_temp_alloc);
-      file_extdata_append (extdata_part_ftab, &partsect_new);
+	      /* update temporary file stats - DISK_SECTOR_NPAGES -1 reserved pages and 1 file table page. */
+	      ATOMIC_INC_32 (&file_Tempcache->spacedb_temp.npage_reserved, DISK_SECTOR_NPAGES - 1);
+	      ATOMIC_INC_32 (&file_Tempcache->spacedb_temp.npage_ftab, 1);
+	    }
+	  else
+	    {
+	      /* update temporary file stats - DISK_SECTOR_NPAGES reserved pages */
+	      ATOMIC_INC_32 (&file_Tempcache->spacedb_temp.npage_reserved, DISK_SECTOR_NPAGES);
+	    }
+	  assert (!file_extdata_is_full (extdata_tail));
+	  assert (isect > 0 || page_ftab_tail != NULL
+		  || file_extdata_item_count (extdata_tail) == fhead->offset_to_last_temp_alloc);
+	  file_extdata_append (extdata_tail, &partsect_new);
+
+	  fhead->n_sector_partial++;
+	  fhead->n_sector_total++;
+	  fhead->n_page_free += DISK_SECTOR_NPAGES;
+	  fhead->n_page_total += DISK_SECTOR_NPAGES;
+	  if (partsect_new.page_bitmap == FILE_EMPTY_PAGE_BITMAP)
+	    {
+	      fhead->n_sector_empty++;
+	    }
+	  else
+	    {
+	      fhead->n_page_free--;
+	      fhead->n_page_ftab++;
+	    }
 
-      fhead->n_sector_partial++;
-      fhead->n_sector_total++;
-      fhead->n_page_free += DISK_SECTOR_NPAGES;
-      fhead->n_page_total += DISK_SECTOR_NPAGES;
-      if (partsect_new.page_bitmap == FILE_EMPTY_PAGE_BITMAP)
-	{
-	  fhead->n_sector_empty++;
+	  file_log ("file_temp_alloc",
+		    "new partial sector added to partial extensible data:\n"
+		    FILE_PARTSECT_MSG ("newly reserved sector")
+		    FILE_EXTDATA_MSG ("last partial table component"),
+		    FILE_PARTSECT_AS_ARGS (&partsect_new), FILE_EXTDATA_AS_ARGS (extdata_tail));
 	}
-      else
+
+      if (page_ftab_tail != NULL)
 	{
-	  fhead->n_page_free--;
-	  fhead->n_page_ftab++;
+	  /* the tail moved past the cursor page; the cursor reaches it through vpid_next links */
+	  pgbuf_set_dirty_and_free (thread_p, page_ftab_tail);
 	}
-
-      file_log ("file_temp_alloc",
-		"new partial sector added to partial extensible data:\n"
-		FILE_PARTSECT_MSG ("newly reserved sector")
-		FILE_EXTDATA_MSG ("last partial table component"),
-		FILE_PARTSECT_AS_ARGS (&partsect_new), FILE_EXTDATA_AS_ARGS (extdata_part_ftab));
+      extdata_tail = NULL;
     }
   assert (fhead->n_page_free > 0);
 
@@ -8633,6 +8736,10 @@ file_temp_alloc (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, FILE_ALLOC_TYPE a
 
 exit:
   file_header_sanity_check (thread_p, fhead);
+  if (page_ftab_tail != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, page_ftab_tail);
+    }
   if (page_ftab != NULL)
     {
       pgbuf_unfix_and_init (thread_p, page_ftab);
@@ -172,6 +172,12 @@ extern int file_destroy (THREAD_ENTRY * thread_p, const VFID * vfid, bool is_tem
 extern int file_temp_retire (THREAD_ENTRY * thread_p, const VFID * vfid);
 extern int file_temp_retire_preserved (THREAD_ENTRY * thread_p, const VFID * vfid);
 
+/* opaque handle for a temporary file detached from transaction bookkeeping; definition is private to file_manager.c */
+typedef struct file_tempcache_entry FILE_TEMPCACHE_ENTRY;
+extern int file_temp_preretire (THREAD_ENTRY * thread_p, const VFID * vfid, bool was_preserved,
+				FILE_TEMPCACHE_ENTRY ** entry_out);
+extern int file_temp_retire_detached (THREAD_ENTRY * thread_p, const VFID * vfid, FILE_TEMPCACHE_ENTRY * entry);
+
 extern int file_init_page_type (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
 extern int file_init_temp_page_type (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
 extern int file_alloc (THREAD_ENTRY * thread_p, const VFID * vfid, FILE_INIT_PAGE_FUNC f_init, void *f_init_args,
@@ -67,11 +67,16 @@
 #endif /* ENABLE_SYSTEMTAP */
 #include "dbtype.h"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info
+#include "thread_daemon.hpp"
 #include "db_value_printer.hpp"
 #include "log_append.hpp"
 #include "string_buffer.hpp"
 #include "tde.h"
+#include "file_io.h"		/* for fileio_os_sysconf */
+#include "server_support.h"
+#include "thread_entry_task.hpp"
 
+#include <functional>
 #include <set>
 
 #if !defined(SERVER_MODE)
@@ -103,6 +108,9 @@ static int rv;
 
 #define HEAP_DEBUG_SCANCACHE_INITPATTERN (12345)
 
+/* number of pages advised ahead of a sequential scan position; one batch is issued every this many page crossings */
+#define HEAP_SCAN_PREFETCH_PAGES 16
+
 #if defined(CUBRID_DEBUG)
 #define HEAP_DEBUG_ISVALID_SCANRANGE(scan_range) \
   heap_scanrange_isvalid(scan_range)
@@ -311,9 +319,12 @@ struct heap_classrepr_entry
   pthread_mutex_t mutex;
   int idx;			/* Cache index. Used to pass the index when a class representation is in the cache */
   int fcnt;			/* How many times this structure has been fixed. It cannot be deallocated until this
-				 * value is zero.  */
+				 * value is zero. Modified only with atomic operations; -1 means the entry is claimed
+				 * (free or being recycled) and cannot be fixed by the lock-free read path. */
   int zone;			/* ZONE_VOID, ZONE_LRU, ZONE_FREE */
   int force_decache;
+  int version;			/* bumped whenever the identity or the cached representations of the entry are about to
+				 * change; optimistic lock-free readers validate it after pinning the entry */
 
   THREAD_ENTRY *next_wait_thrd;
   HEAP_CLASSREPR_ENTRY *hash_next;
@@ -501,6 +512,70 @@ static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area =
 
 static HEAP_STATS_BESTSPACE_CACHE *heap_Bestspace = NULL;
 
+/*
+ * Insert page affinity hints.
+ *
+ * heap_stats_find_best_page funnels every inserter through the heap header
+ * page (fixed in exclusive mode to keep the estimates current) and through
+ * the global best space mutex. To keep concurrent inserters on the same
+ * class from synchronizing on every row, each thread remembers the last
+ * page it inserted into, per heap, and tries that page again before going
+ * through the header. The table is deliberately accessed without a latch
+ * or mutex: a hint is only a guess, and a stale or torn entry can at worst
+ * send us to a page that fails validation (page type, owning class and
+ * free space are all re-checked after the page is fixed), in which case we
+ * simply fall back to the regular best space search.
+ *
+ * Header estimates (num_recs, recs_sumlen) for inserts served from a hint
+ * are accumulated in the hint entry and folded into the header the next
+ * time the owning thread goes through the regular path; a hint is refused
+ * after HEAP_INSERT_AFFINITY_SYNC_RECS inserts to bound the drift.
+ */
+typedef struct heap_insert_affinity_hint HEAP_INSERT_AFFINITY_HINT;
+struct heap_insert_affinity_hint
+{
+  HFID hfid;			/* heap the remembered page belongs to */
+  VPID vpid;			/* last page this thread inserted into */
+  int bypassed_recs;		/* inserts served from the hint since the header page was last seen */
+  float bypassed_sumlen;	/* total length of those records */
+};
+
+/* Slots are picked by mixing the thread index with the heap page id, so a
+ * thread alternating inserts over several classes uses distinct slots. */
+#define HEAP_INSERT_AFFINITY_HINTS 512
+
+/* Visit the header page (refreshing its estimates) at least once every
+ * this many hinted inserts. */
+#define HEAP_INSERT_AFFINITY_SYNC_RECS 64
+
+static HEAP_INSERT_AFFINITY_HINT heap_Insert_affinity_hints[HEAP_INSERT_AFFINITY_HINTS];
+
+/*
+ * Synchronized scan start hints.
+ *
+ * When synchronized_heap_scan is enabled, every plain sequential scan
+ * publishes the page it is currently reading, per heap, and a scan that
+ * starts while another one is in progress on the same heap begins from the
+ * published page instead of from the first page, wrapping around to its
+ * start position after it reaches the end of the heap. Concurrent scans
+ * thus travel together and find each page already in the page buffer
+ * instead of each driving its own pass over the file. As with the insert
+ * affinity hints above, the table is read and written without a latch: a
+ * hint is only a guess, and a stale or torn entry at worst yields a start
+ * page that fails validation after it is fixed, in which case the scan
+ * simply starts from the first page.
+ */
+typedef struct heap_sync_scan_hint HEAP_SYNC_SCAN_HINT;
+struct heap_sync_scan_hint
+{
+  HFID hfid;			/* heap the remembered position belongs to */
+  VPID vpid;			/* page the most advanced scan is reading */
+};
+
+#define HEAP_SYNC_SCAN_HINTS 64
+
+static HEAP_SYNC_SCAN_HINT heap_Sync_scan_hints[HEAP_SYNC_SCAN_HINTS];
+
 static HEAP_HFID_TABLE heap_Hfid_table_area = { LF_HASH_TABLE_INITIALIZER, LF_ENTRY_DESCRIPTOR_INITIALIZER,
   LF_FREELIST_INITIALIZER, false
 };
@@ -594,6 +669,9 @@ static PAGE_PTR heap_scan_pb_lock_and_fetch_debug (THREAD_ENTRY * thread_p, cons
 						   const int caller_line);
 #endif /* !NDEBUG */
 
+static void heap_scan_prefetch_next_range (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache,
+					   const VPID * next_vpid);
+
 static int heap_classrepr_initialize_cache (void);
 static int heap_classrepr_finalize_cache (void);
 static int heap_classrepr_decache_guessed_last (const OID * class_oid);
@@ -609,6 +687,7 @@ static int heap_classrepr_dump_cache (bool simple_dump);
 #endif /* DEBUG_CLASSREPR_CACHE */
 
 static int heap_classrepr_entry_reset (HEAP_CLASSREPR_ENTRY * cache_entry);
+static OR_CLASSREP *heap_classrepr_get_fast (const OID * class_oid, REPR_ID reprid, int *idx_incache);
 static int heap_classrepr_entry_remove_from_LRU (HEAP_CLASSREPR_ENTRY * cache_entry);
 static HEAP_CLASSREPR_ENTRY *heap_classrepr_entry_alloc (void);
 static int heap_classrepr_entry_free (HEAP_CLASSREPR_ENTRY * cache_entry);
@@ -630,6 +709,13 @@ static HEAP_FINDSPACE heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p
 							 HEAP_SCANCACHE * scan_cache, PGBUF_WATCHER * pg_watcher);
 static PAGE_PTR heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space, bool isnew_rec,
 					   int newrec_size, HEAP_SCANCACHE * space_cache, PGBUF_WATCHER * pg_watcher);
+STATIC_INLINE HEAP_INSERT_AFFINITY_HINT *heap_insert_affinity_get_hint (THREAD_ENTRY * thread_p, const HFID * hfid)
+  __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void heap_insert_affinity_flush_estimates (THREAD_ENTRY * thread_p, const HFID * hfid,
+							 HEAP_HDR_STATS * heap_hdr) __attribute__ ((ALWAYS_INLINE));
+static bool heap_insert_try_affinity_page (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context);
+static void heap_insert_affinity_record (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context, bool used_hint);
+STATIC_INLINE HEAP_SYNC_SCAN_HINT *heap_sync_scan_get_hint (const HFID * hfid) __attribute__ ((ALWAYS_INLINE));
 static int heap_stats_sync_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr,
 				      VPID * hdr_vpid, bool scan_all, bool can_cycle);
 
@@ -764,10 +850,11 @@ static SCAN_CODE heap_get_record_info (THREAD_ENTRY * thread_p, const OID oid, R
 				       DB_VALUE ** record_info);
 static SCAN_CODE heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 				     RECDES * recdes, HEAP_SCANCACHE * scan_cache, bool ispeeking,
-				     bool reversed_direction, DB_VALUE ** cache_recordinfo);
+				     bool reversed_direction, DB_VALUE ** cache_recordinfo, const VPID * stop_vpid);
 
 static SCAN_CODE heap_get_page_info (THREAD_ENTRY * thread_p, const OID * cls_oid, const HFID * hfid, const VPID * vpid,
 				     const PAGE_PTR pgptr, DB_VALUE ** page_info);
+static bool heap_page_is_all_visible (THREAD_ENTRY * thread_p, PAGE_PTR heap_page);
 static SCAN_CODE heap_get_bigone_content (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, bool ispeeking,
 					  OID * forward_oid, RECDES * recdes);
 static void heap_mvcc_log_insert (THREAD_ENTRY * thread_p, RECDES * p_recdes, LOG_DATA_ADDR * p_addr);
@@ -867,6 +954,13 @@ static int heap_update_set_prev_version (THREAD_ENTRY * thread_p, const OID * oi
 					 PGBUF_WATCHER * fwd_pg_watcher, LOG_LSA * prev_version_lsa);
 static int heap_scan_cache_allocate_recdes_data (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache_p,
 						 RECDES * recdes_p, int size);
+static SCAN_CODE heap_get_record_data_partial_copy (THREAD_ENTRY * thread_p, PAGE_PTR page_ptr, PGSLOTID slotid,
+						    HEAP_SCANCACHE * scan_cache_p, RECDES * recdes_p,
+						    bool * is_handled);
+static int heap_partial_fetch_prefix_length (HEAP_SCANCACHE * scan_cache_p, const char *data, int avail_length,
+					     int full_length);
+static SCAN_CODE heap_get_bigone_content_partial (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache_p,
+						  OID * forward_oid, RECDES * recdes_p, bool * is_handled);
 
 static int heap_get_header_page (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * header_vpid);
 
@@ -1406,7 +1500,8 @@ heap_classrepr_initialize_cache (void)
       pthread_mutex_init (&cache_entry[i].mutex, NULL);
 
       cache_entry[i].idx = i;
-      cache_entry[i].fcnt = 0;
+      /* free entries are claimed so the lock-free read path cannot fix them */
+      cache_entry[i].fcnt = -1;
       cache_entry[i].zone = ZONE_FREE;
       cache_entry[i].next_wait_thrd = NULL;
       cache_entry[i].hash_next = NULL;
@@ -1414,6 +1509,7 @@ heap_classrepr_initialize_cache (void)
       cache_entry[i].next = (i < heap_Classrepr_cache.num_entries - 1) ? &cache_entry[i + 1] : NULL;
 
       cache_entry[i].force_decache = false;
+      cache_entry[i].version = 0;
 
       OID_SET_NULL (&cache_entry[i].class_oid);
       cache_entry[i].max_reprid = DEFAULT_REPR_INCREMENT;
@@ -1593,6 +1689,9 @@ heap_classrepr_entry_reset (HEAP_CLASSREPR_ENTRY * cache_entry)
       return NO_ERROR;		/* nop */
     }
 
+  /* invalidate optimistic readers before the entry changes identity */
+  ATOMIC_INC_32 (&cache_entry->version, 1);
+
   /* free all classrepr */
   for (i = 0; i <= cache_entry->last_reprid; i++)
     {
@@ -1769,6 +1868,8 @@ heap_classrepr_decache_guessed_last (const OID * class_oid)
 
       pthread_mutex_unlock (&hash_anchor->hash_mutex);
 
+      /* invalidate optimistic readers before the entry is marked for decache */
+      ATOMIC_INC_32 (&cache_entry->version, 1);
       cache_entry->force_decache = true;
 
       /* Remove from LRU list */
@@ -1782,8 +1883,10 @@ heap_classrepr_decache_guessed_last (const OID * class_oid)
       cache_entry->prev = NULL;
       cache_entry->next = NULL;
 
-      int save_fcnt = cache_entry->fcnt;
-      if (cache_entry->fcnt == 0)
+      int save_fcnt = VOLATILE_ACCESS (cache_entry->fcnt, int);
+      /* claim the entry; a lock-free reader that slipped in concurrently keeps fcnt above zero and the last unfixer
+       * will free the entry instead */
+      if (ATOMIC_CAS_32 (&cache_entry->fcnt, 0, -1))
 	{
 	  /* move cache_entry to free_list */
 	  ret = heap_classrepr_entry_reset (cache_entry);
@@ -1906,9 +2009,15 @@ heap_classrepr_free (OR_CLASSREP * classrep, int *idx_incache)
 
   cache_entry = &heap_Classrepr_cache.area[*idx_incache];
 
+  if (ATOMIC_INC_32 (&cache_entry->fcnt, -1) > 0)
+    {
+      /* still fixed by others; no cache maintenance is needed */
+      *idx_incache = -1;
+      return NO_ERROR;
+    }
+
   rv = pthread_mutex_lock (&cache_entry->mutex);
-  cache_entry->fcnt--;
-  if (cache_entry->fcnt == 0)
+  if (VOLATILE_ACCESS (cache_entry->fcnt, int) == 0)
     {
       /*
        * Is this entry declared to be decached
@@ -1922,11 +2031,15 @@ heap_classrepr_free (OR_CLASSREP * classrep, int *idx_incache)
 	{
 	  /* cache_entry is already removed from LRU list. */
 
-	  /* move cache_entry to free_list */
-	  ret = heap_classrepr_entry_free (cache_entry);
-	  if (ret == NO_ERROR)
+	  /* claim the entry and move it to free_list; a lock-free reader that fixed the entry meanwhile will come
+	   * back here on its own unfix */
+	  if (ATOMIC_CAS_32 (&cache_entry->fcnt, 0, -1))
 	    {
-	      ret = heap_classrepr_entry_reset (cache_entry);
+	      ret = heap_classrepr_entry_free (cache_entry);
+	      if (ret == NO_ERROR)
+		{
+		  ret = heap_classrepr_entry_reset (cache_entry);
+		}
 	    }
 	}
       else
@@ -2159,8 +2272,12 @@ check_LRU_list:
     }
 
   rv = pthread_mutex_lock (&cache_entry->mutex);
+
+  /* invalidate optimistic readers before trying to claim the entry */
+  ATOMIC_INC_32 (&cache_entry->version, 1);
+
   /* if some has referenced, retry */
-  if (cache_entry->fcnt != 0)
+  if (!ATOMIC_CAS_32 (&cache_entry->fcnt, 0, -1))
     {
       pthread_mutex_unlock (&cache_entry->mutex);
       goto check_LRU_list;
@@ -2286,6 +2403,99 @@ end:
   return repr;
 }
 
+/*
+ * heap_classrepr_get_fast () - Optimistic lock-free lookup of a cached class
+ *                              representation
+ *   return: fixed classrepr, or NULL when the fast path does not apply
+ *   class_oid(in): The class identifier
+ *   reprid(in): Representation of the class or NULL_REPRID for last one
+ *   idx_incache(out): Index of the cache entry on success
+ *
+ * Note: Readers walk the hash chain and pin the entry without taking any
+ *       mutex.  The traversal is validated with the entry version counter:
+ *       every code path that decaches, recycles or resets an entry bumps
+ *       its version first, so a reader that pinned a stale entry detects
+ *       the change after the pin and retires through the regular unfix
+ *       path.  Any interference simply falls back to the locked lookup of
+ *       heap_classrepr_get; with a stable schema the hot path is wait-free.
+ */
+static OR_CLASSREP *
+heap_classrepr_get_fast (const OID * class_oid, REPR_ID reprid, int *idx_incache)
+{
+  HEAP_CLASSREPR_HASH *hash_anchor;
+  HEAP_CLASSREPR_ENTRY *cache_entry;
+  OR_CLASSREP **repr_array;
+  OR_CLASSREP *repr;
+  int version, fcnt, steps;
+
+  hash_anchor = &heap_Classrepr->hash_table[REPR_HASH (class_oid)];
+
+  steps = 0;
+  for (cache_entry = VOLATILE_ACCESS (hash_anchor->hash_next, HEAP_CLASSREPR_ENTRY *); cache_entry != NULL;
+       cache_entry = VOLATILE_ACCESS (cache_entry->hash_next, HEAP_CLASSREPR_ENTRY *))
+    {
+      if (++steps > heap_Classrepr_cache.num_entries)
+	{
+	  /* the chain mutated under us; give up */
+	  return NULL;
+	}
+
+      version = VOLATILE_ACCESS (cache_entry->version, int);
+
+      if (!OID_EQ (class_oid, &cache_entry->class_oid) || cache_entry->force_decache)
+	{
+	  continue;
+	}
+
+      if (reprid == NULL_REPRID)
+	{
+	  reprid = VOLATILE_ACCESS (cache_entry->last_reprid, REPR_ID);
+	}
+      if (reprid <= NULL_REPRID || reprid > VOLATILE_ACCESS (cache_entry->last_reprid, REPR_ID)
+	  || reprid > VOLATILE_ACCESS (cache_entry->max_reprid, int))
+	{
+	  /* let the locked path diagnose it */
+	  return NULL;
+	}
+
+      /* the array may belong to a concurrently recycled entry; the values read from it are discarded unless the
+       * version check below succeeds, so the worst case is a harmless stale read */
+      repr_array = VOLATILE_ACCESS (cache_entry->repr, OR_CLASSREP **);
+      if (repr_array == NULL)
+	{
+	  return NULL;
+	}
+      repr = VOLATILE_ACCESS (repr_array[reprid], OR_CLASSREP *);
+      if (repr == NULL)
+	{
+	  /* representation is not loaded yet */
+	  return NULL;
+	}
+
+      /* pin the entry; claimed entries (fcnt == -1) can never be fixed here */
+      fcnt = VOLATILE_ACCESS (cache_entry->fcnt, int);
+      if (fcnt < 0 || !ATOMIC_CAS_32 (&cache_entry->fcnt, fcnt, fcnt + 1))
+	{
+	  return NULL;
+	}
+
+      if (VOLATILE_ACCESS (cache_entry->version, int) != version)
+	{
+	  /* the entry was decached or recycled after we examined it; our pin still counted, undo it as a regular
+	   * unfix so a pending decache is completed by the last unfixer */
+	  int idx = cache_entry->idx;
+
+	  (void) heap_classrepr_free (NULL, &idx);
+	  return NULL;
+	}
+
+      *idx_incache = cache_entry->idx;
+      return repr;
+    }
+
+  return NULL;
+}
+
 /*
  * heap_classrepr_get () - Obtain the desired class representation
  *   return: classrepr
@@ -2311,6 +2521,13 @@ heap_classrepr_get (THREAD_ENTRY * thread_p, const OID * class_oid, RECDES * cla
 
   *idx_incache = -1;
 
+  /* try the lock-free lookup first; any interference falls back to the locked search below */
+  repr = heap_classrepr_get_fast (class_oid, reprid, idx_incache);
+  if (repr != NULL)
+    {
+      return repr;
+    }
+
   hash_anchor = &heap_Classrepr->hash_table[REPR_HASH (class_oid)];
 
   /* search entry with class_oid from hash chain */
@@ -2581,7 +2798,7 @@ search_begin:
 	    }
 	}
 
-      cache_entry->fcnt++;
+      ATOMIC_INC_32 (&cache_entry->fcnt, 1);
       *idx_incache = cache_entry->idx;
     }
   pthread_mutex_unlock (&cache_entry->mutex);
@@ -3470,6 +3687,262 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
   return found;
 }
 
+/*
+ * heap_insert_affinity_get_hint () - Get this thread's insert affinity hint
+ *				      slot for the given heap
+ *   return: hint slot (never NULL; may belong to another heap or thread)
+ *   hfid(in): Object heap file identifier
+ */
+STATIC_INLINE HEAP_INSERT_AFFINITY_HINT *
+heap_insert_affinity_get_hint (THREAD_ENTRY * thread_p, const HFID * hfid)
+{
+  unsigned int hash;
+
+  hash = (unsigned int) (thread_p != NULL ? thread_p->index : 0) * 31 + (unsigned int) hfid->hpgid;
+
+  return &heap_Insert_affinity_hints[hash % HEAP_INSERT_AFFINITY_HINTS];
+}
+
+/*
+ * heap_insert_affinity_flush_estimates () - Fold the insert estimates
+ *		deferred while this thread's inserts were served from its
+ *		affinity hint into the heap header
+ *   hfid(in): Object heap file identifier
+ *   heap_hdr(in/out): Heap header (page must be fixed in exclusive mode)
+ */
+STATIC_INLINE void
+heap_insert_affinity_flush_estimates (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr)
+{
+  HEAP_INSERT_AFFINITY_HINT *hint = heap_insert_affinity_get_hint (thread_p, hfid);
+
+  if (HFID_EQ (&hint->hfid, hfid) && hint->bypassed_recs > 0)
+    {
+      heap_hdr->estimates.num_recs += hint->bypassed_recs;
+      heap_hdr->estimates.recs_sumlen += hint->bypassed_sumlen;
+      hint->bypassed_recs = 0;
+      hint->bypassed_sumlen = 0.0f;
+    }
+}
+
+/*
+ * heap_insert_try_affinity_page () - Try to reuse the page this thread last
+ *		inserted into, without touching the heap header page
+ *   return: true if the page was fixed into context->home_page_watcher_p,
+ *	     false to fall back to the regular best space search
+ *   context(in): operation context
+ *
+ * Note: The hint is only a guess; since the hint table is read without any
+ *	 synchronization, the remembered page may meanwhile be full, belong
+ *	 to another heap, or be deallocated altogether. The page is
+ *	 therefore re-validated after it is fixed, and any doubt makes us
+ *	 fall back. No error is ever returned.
+ */
+static bool
+heap_insert_try_affinity_page (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
+{
+  HEAP_INSERT_AFFINITY_HINT *hint;
+  HEAP_CHAIN *chain;
+  VPID vpid;
+  int needed_space, total_space;
+
+  if (OID_ISNULL (&context->class_oid))
+    {
+      /* cannot validate page ownership */
+      return false;
+    }
+
+  hint = heap_insert_affinity_get_hint (thread_p, &context->hfid);
+  if (!HFID_EQ (&hint->hfid, &context->hfid))
+    {
+      return false;
+    }
+  if (hint->bypassed_recs >= HEAP_INSERT_AFFINITY_SYNC_RECS)
+    {
+      /* time to refresh the header estimates through the regular path */
+      return false;
+    }
+
+  vpid = hint->vpid;
+  if (VPID_ISNULL (&vpid) || (vpid.volid == context->hfid.vfid.volid && vpid.pageid == context->hfid.hpgid))
+    {
+      /* the header page is handled by the regular path (and has its own watcher rank) */
+      return false;
+    }
+
+  needed_space = context->recdes_p->length;
+  assert (!heap_is_big_length (needed_space));
+
+  /* Take into consideration the unfill factor for pages with objects */
+  total_space =
+    needed_space + heap_Slotted_overhead + (int) ((float) DB_PAGESIZE * prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
+  if (heap_is_big_length (total_space))
+    {
+      total_space = needed_space + heap_Slotted_overhead;
+    }
+
+  if (pgbuf_ordered_fix (thread_p, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, context->home_page_watcher_p)
+      != NO_ERROR)
+    {
+      /* the page (or its volume) may be gone; not an error for a mere hint */
+      er_clear ();
+      return false;
+    }
+
+  if (!pgbuf_check_page_type_no_error (thread_p, context->home_page_watcher_p->pgptr, PAGE_HEAP))
+    {
+      pgbuf_ordered_unfix (thread_p, context->home_page_watcher_p);
+      return false;
+    }
+
+  chain = heap_get_chain_ptr (thread_p, context->home_page_watcher_p->pgptr);
+  if (chain == NULL || !OID_EQ (&chain->class_oid, &context->class_oid)
+      || spage_max_space_for_new_record (thread_p, context->home_page_watcher_p->pgptr) < total_space)
+    {
+      /* page was reused by another heap or no longer has room */
+      pgbuf_ordered_unfix (thread_p, context->home_page_watcher_p);
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * heap_insert_affinity_record () - Remember the page chosen for an insert in
+ *		this thread's affinity hint slot
+ *   context(in): operation context; home page must be fixed
+ *   used_hint(in): whether the page came from the affinity hint
+ *
+ * Note: When the page came from the hint, the heap header was bypassed and
+ *	 its insert estimates are deferred in the hint entry instead; they
+ *	 are folded in by heap_insert_affinity_flush_estimates the next time
+ *	 this thread fixes the header.
+ */
+static void
+heap_insert_affinity_record (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context, bool used_hint)
+{
+  HEAP_INSERT_AFFINITY_HINT *hint;
+  VPID vpid;
+
+  vpid.volid = pgbuf_get_volume_id (context->home_page_watcher_p->pgptr);
+  vpid.pageid = pgbuf_get_page_id (context->home_page_watcher_p->pgptr);
+  if (vpid.volid == context->hfid.vfid.volid && vpid.pageid == context->hfid.hpgid)
+    {
+      /* never remember the header page */
+      return;
+    }
+
+  hint = heap_insert_affinity_get_hint (thread_p, &context->hfid);
+  if (used_hint && HFID_EQ (&hint->hfid, &context->hfid))
+    {
+      /* header page was bypassed; defer its estimates update */
+      if (context->recdes_p->type != REC_NEWHOME)
+	{
+	  hint->bypassed_recs += 1;
+	}
+      hint->bypassed_sumlen += (float) context->recdes_p->length;
+    }
+  else
+    {
+      /* the regular path already accounted for this record in the header */
+      hint->hfid = context->hfid;
+      hint->bypassed_recs = 0;
+      hint->bypassed_sumlen = 0.0f;
+    }
+  hint->vpid = vpid;
+}
+
+/*
+ * heap_sync_scan_get_hint () - Get the synchronized scan hint slot for the
+ *				given heap
+ *   return: hint slot (never NULL; may belong to another heap)
+ *   hfid(in): Object heap file identifier
+ */
+STATIC_INLINE HEAP_SYNC_SCAN_HINT *
+heap_sync_scan_get_hint (const HFID * hfid)
+{
+  unsigned int hash;
+
+  hash = (unsigned int) hfid->hpgid * 31 + (unsigned int) hfid->vfid.volid;
+
+  return &heap_Sync_scan_hints[hash % HEAP_SYNC_SCAN_HINTS];
+}
+
+/*
+ * heap_sync_scan_publish () - Remember the page a sequential scan is
+ *		currently reading so that scans arriving later on the same
+ *		heap can start there
+ *   hfid(in): Object heap file identifier
+ *   vpid(in): Page the scan is positioned on
+ */
+void
+heap_sync_scan_publish (const HFID * hfid, const VPID * vpid)
+{
+  HEAP_SYNC_SCAN_HINT *hint = heap_sync_scan_get_hint (hfid);
+
+  hint->vpid = *vpid;
+  hint->hfid = *hfid;
+}
+
+/*
+ * heap_sync_scan_get_start () - Get a validated start page for a scan that
+ *		wants to attach to a scan already in progress on this heap
+ *   hfid(in): Object heap file identifier
+ *   class_oid(in): Class of the heap, for page ownership validation
+ *   start_vpid(out): Start page; NULL_VPID when no usable position is known
+ *
+ * Note: Like the insert affinity hints, the hint table is read without any
+ *	 synchronization, so the remembered page is re-validated after it
+ *	 is fixed and any doubt leaves start_vpid NULL. No error is ever
+ *	 returned.
+ */
+void
+heap_sync_scan_get_start (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * class_oid, VPID * start_vpid)
+{
+  HEAP_SYNC_SCAN_HINT *hint;
+  HEAP_CHAIN *chain;
+  PGBUF_WATCHER pg_watcher;
+  VPID vpid;
+
+  VPID_SET_NULL (start_vpid);
+
+  if (class_oid == NULL || OID_ISNULL (class_oid))
+    {
+      /* cannot validate page ownership */
+      return;
+    }
+
+  hint = heap_sync_scan_get_hint (hfid);
+  if (!HFID_EQ (&hint->hfid, hfid))
+    {
+      return;
+    }
+
+  vpid = hint->vpid;
+  if (VPID_ISNULL (&vpid) || (vpid.volid == hfid->vfid.volid && vpid.pageid == hfid->hpgid))
+    {
+      /* starting from the first page is the regular path anyway */
+      return;
+    }
+
+  PGBUF_INIT_WATCHER (&pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
+  if (pgbuf_ordered_fix (thread_p, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ, &pg_watcher) != NO_ERROR)
+    {
+      /* the page (or its volume) may be gone; not an error for a mere hint */
+      er_clear ();
+      return;
+    }
+
+  if (pgbuf_check_page_type_no_error (thread_p, pg_watcher.pgptr, PAGE_HEAP))
+    {
+      chain = heap_get_chain_ptr (thread_p, pg_watcher.pgptr);
+      if (chain != NULL && OID_EQ (&chain->class_oid, class_oid))
+	{
+	  *start_vpid = vpid;
+	}
+    }
+  pgbuf_ordered_unfix (thread_p, &pg_watcher);
+}
+
 /*
  * heap_stats_find_best_page () - Find a page with the needed space.
  *   return: pointer to page with enough space or NULL
@@ -3546,6 +4019,9 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
 
   heap_hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
 
+  /* pick up the estimates deferred while this thread's inserts were served from its affinity hint */
+  heap_insert_affinity_flush_estimates (thread_p, hfid, heap_hdr);
+
   if (isnew_rec == true)
     {
       heap_hdr->estimates.num_recs += 1;
@@ -6803,6 +7279,10 @@ heap_scancache_start_internal (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_ca
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = mvcc_snapshot;
   scan_cache->partition_list = NULL;
+  scan_cache->partial_fetch_attrinfo[0] = NULL;
+  scan_cache->partial_fetch_attrinfo[1] = NULL;
+  scan_cache->index_attrinfo[0] = NULL;
+  scan_cache->index_attrinfo[1] = NULL;
 
   return ret;
 
@@ -6821,6 +7301,10 @@ exit_on_error:
   scan_cache->debug_initpattern = 0;
   scan_cache->mvcc_snapshot = NULL;
   scan_cache->partition_list = NULL;
+  scan_cache->partial_fetch_attrinfo[0] = NULL;
+  scan_cache->partial_fetch_attrinfo[1] = NULL;
+  scan_cache->index_attrinfo[0] = NULL;
+  scan_cache->index_attrinfo[1] = NULL;
 
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
@@ -6847,6 +7331,27 @@ heap_scancache_start (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, cons
 					mvcc_snapshot);
 }
 
+/*
+ * heap_scancache_set_partial_fetch () - Register the attribute caches a scan reads its records through, allowing COPY
+ *					 record fetches to be truncated after the last attribute the caches need
+ *   scan_cache(in/out): Scan cache (must be started)
+ *   pred_attrinfo(in): Attribute cache of the data filter or NULL
+ *   rest_attrinfo(in): Attribute cache of the fetched values or NULL
+ *
+ * Note: Only read-only scans whose every access to the record data goes through the given caches may register them;
+ *	 once set, records copied out of the page may hold just the prefix that covers the registered attributes (see
+ *	 heap_get_record_data_partial_copy) and recdes->length reflects the truncated size.
+ */
+void
+heap_scancache_set_partial_fetch (HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * pred_attrinfo,
+				  HEAP_CACHE_ATTRINFO * rest_attrinfo)
+{
+  assert (scan_cache != NULL && scan_cache->debug_initpattern == HEAP_DEBUG_SCANCACHE_INITPATTERN);
+
+  scan_cache->partial_fetch_attrinfo[0] = pred_attrinfo;
+  scan_cache->partial_fetch_attrinfo[1] = rest_attrinfo;
+}
+
 /*
  * heap_scancache_start_modify () - Start caching information for heap
  *                                modifications
@@ -7103,6 +7608,10 @@ heap_scancache_quick_start_internal (HEAP_SCANCACHE * scan_cache, const HFID * h
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = NULL;
   scan_cache->partition_list = NULL;
+  scan_cache->partial_fetch_attrinfo[0] = NULL;
+  scan_cache->partial_fetch_attrinfo[1] = NULL;
+  scan_cache->index_attrinfo[0] = NULL;
+  scan_cache->index_attrinfo[1] = NULL;
 
   return NO_ERROR;
 }
@@ -7156,6 +7665,15 @@ heap_scancache_quick_end (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache)
 	      curr_node = next_node;
 	    }
 	}
+
+      for (int slot = 0; slot < 2; slot++)
+	{
+	  if (scan_cache->index_attrinfo[slot] != NULL)
+	    {
+	      heap_attrinfo_end (thread_p, scan_cache->index_attrinfo[slot]);
+	      db_private_free_and_init (thread_p, scan_cache->index_attrinfo[slot]);
+	    }
+	}
     }
 
   HFID_SET_NULL (&scan_cache->node.hfid);
@@ -7704,21 +8222,284 @@ heap_get_mvcc_header (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT * context, MVCC_
 }
 
 /*
- * heap_get_record_data_when_all_ready () - Get record data when all required information is known. This can work only
- *                                          for record types that actually have data: REC_HOME, REC_RELOCATION and
- *                                          REC_BIGONE. Required information: home_page, forward_oid and forward page
- *                                          for REC_RELOCATION and REC_BIGONE, and record type.
+ * heap_get_record_data_partial_copy () - Copy only the record prefix that covers the attributes the scan reads
  *
- * return	      : SCAN_CODE: S_SUCCESS, S_ERROR, S_DOESNT_FIT.
+ * return	      : SCAN_CODE; meaningful only when is_handled was set
  * thread_p (in)      : Thread entry.
- * context (in/out)   : Heap get context. Should contain all required information for object retrieving
+ * page_ptr (in)      : Fixed page holding the record data (home or forward page).
+ * slotid (in)	      : Slot of the record data.
+ * scan_cache_p (in)  : Scan cache; the registered partial fetch attribute caches drive the truncation.
+ * recdes_p (out)     : Record descriptor; on success points into the scan cache area and holds the prefix only.
+ * is_handled (out)   : Set when the copy was done here; otherwise the caller must take the full copy path.
+ *
+ * Note: The attributes are located by direct offsets into the disk representation, so a record prefix that spans the
+ *	 header, the variable offset table, the fixed attributes with their bound bits and the data of the needed
+ *	 variable attributes is enough to read them; the (possibly many) variable attributes stored behind that point
+ *	 are never touched and their bytes need not be copied. The truncation is attempted only when the caches already
+ *	 hold the representation the record was written under; older representations take the full copy path and are
+ *	 recached by heap_attrinfo_read_dbvalues as usual.
  */
-SCAN_CODE
-heap_get_record_data_when_all_ready (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT * context)
+static SCAN_CODE
+heap_get_record_data_partial_copy (THREAD_ENTRY * thread_p, PAGE_PTR page_ptr, PGSLOTID slotid,
+				   HEAP_SCANCACHE * scan_cache_p, RECDES * recdes_p, bool * is_handled)
 {
-  HEAP_SCANCACHE *scan_cache_p = context->scan_cache;
+  RECDES peek_recdes;
+  SCAN_CODE scan;
+  int prefix_length;
 
-  /* We have everything set up to get record data. */
+  *is_handled = false;
+
+  if (scan_cache_p->partial_fetch_attrinfo[0] == NULL && scan_cache_p->partial_fetch_attrinfo[1] == NULL)
+    {
+      return S_SUCCESS;
+    }
+
+  scan = spage_get_record (thread_p, page_ptr, slotid, &peek_recdes, PEEK);
+  if (scan != S_SUCCESS)
+    {
+      /* let the regular copy path produce the error */
+      return scan;
+    }
+
+  prefix_length = heap_partial_fetch_prefix_length (scan_cache_p, peek_recdes.data, peek_recdes.length,
+						    peek_recdes.length);
+  if (prefix_length < 0)
+    {
+      return S_SUCCESS;
+    }
+
+  *is_handled = true;
+  if (heap_scan_cache_allocate_recdes_data (thread_p, scan_cache_p, recdes_p, prefix_length) != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return S_ERROR;
+    }
+  memcpy (recdes_p->data, peek_recdes.data, prefix_length);
+  recdes_p->length = prefix_length;
+  recdes_p->type = peek_recdes.type;
+
+  return S_SUCCESS;
+}
+
+/*
+ * heap_partial_fetch_prefix_length () - Size of the record prefix that covers the attributes the scan reads
+ *
+ * return	      : Aligned prefix length, or -1 when the record must be fetched in full
+ * scan_cache_p (in)  : Scan cache carrying the registered partial fetch attribute caches
+ * data (in)	      : Start of the record data; only the first avail_length bytes may be examined
+ * avail_length (in)  : Number of record bytes available at data
+ * full_length (in)   : Length of the whole record
+ *
+ * Note: The header and the variable offset table must fall inside the available bytes, otherwise the prefix cannot
+ *	 be sized and -1 is returned; the prefix itself may well exceed avail_length (a multipage record examined
+ *	 through its first page). -1 is also returned when the caches do not hold the representation the record was
+ *	 written under, or when truncation would not save anything.
+ */
+static int
+heap_partial_fetch_prefix_length (HEAP_SCANCACHE * scan_cache_p, const char *data, int avail_length, int full_length)
+{
+  HEAP_CACHE_ATTRINFO *attr_info;
+  OR_CLASSREP *classrepr = NULL;
+  RECDES hdr_recdes;
+  REPR_ID reprid;
+  int n_fixed, prefix_length, attr_end, var_length;
+  int cache_idx, i;
+
+  if (avail_length < (int) OR_MVCC_MAX_HEADER_SIZE)
+    {
+      return -1;
+    }
+
+  hdr_recdes.data = (char *) data;
+  hdr_recdes.length = avail_length;
+  reprid = or_rep_id (&hdr_recdes);
+
+  for (cache_idx = 0; cache_idx < 2; cache_idx++)
+    {
+      attr_info = scan_cache_p->partial_fetch_attrinfo[cache_idx];
+      if (attr_info == NULL || attr_info->num_values <= 0)
+	{
+	  continue;
+	}
+      if (attr_info->read_classrepr == NULL || attr_info->read_classrepr->id != reprid)
+	{
+	  /* representation not cached yet; full copy */
+	  return -1;
+	}
+      classrepr = attr_info->read_classrepr;
+    }
+
+  if (classrepr == NULL || classrepr->n_variable <= 0)
+    {
+      /* no registered attributes, or an all-fixed record: nothing worth truncating */
+      return -1;
+    }
+
+  if (OR_FIXED_ATTRIBUTES_OFFSET (data, classrepr->n_variable) > avail_length)
+    {
+      /* the variable offset table itself is out of reach */
+      return -1;
+    }
+
+  /* base prefix: header, variable offset table, fixed attributes and their bound bits */
+  n_fixed = classrepr->n_attributes - classrepr->n_variable;
+  prefix_length = OR_FIXED_ATTRIBUTES_OFFSET (data, classrepr->n_variable) + classrepr->fixed_length;
+  if (OR_GET_BOUND_BIT_FLAG (data))
+    {
+      prefix_length += OR_BOUND_BIT_BYTES (n_fixed);
+    }
+
+  /* stretch it over the data of every needed (bound) variable attribute */
+  for (cache_idx = 0; cache_idx < 2; cache_idx++)
+    {
+      attr_info = scan_cache_p->partial_fetch_attrinfo[cache_idx];
+      if (attr_info == NULL || attr_info->num_values <= 0)
+	{
+	  continue;
+	}
+      for (i = 0; i < attr_info->num_values; i++)
+	{
+	  HEAP_ATTRVALUE *value = &attr_info->values[i];
+
+	  if (value->attr_type != HEAP_INSTANCE_ATTR || value->read_attrepr == NULL
+	      || value->read_attrepr->is_fixed != 0)
+	    {
+	      /* shared/class attributes and dropped attributes read defaults; fixed ones sit in the base prefix */
+	      continue;
+	    }
+	  if (OR_VAR_IS_NULL (data, value->read_attrepr->location))
+	    {
+	      continue;
+	    }
+	  attr_end = OR_VAR_OFFSET (data, value->read_attrepr->location);
+	  OR_VAR_LENGTH (var_length, data, value->read_attrepr->location, classrepr->n_variable);
+	  attr_end += var_length;
+	  if (attr_end > prefix_length)
+	    {
+	      prefix_length = attr_end;
+	    }
+	}
+    }
+
+  prefix_length = DB_ALIGN (prefix_length, INT_ALIGNMENT);
+  if (prefix_length >= full_length)
+    {
+      /* no savings */
+      return -1;
+    }
+
+  return prefix_length;
+}
+
+/*
+ * heap_get_bigone_content_partial () - Stream only the needed prefix of a multipage record into the scan cache area
+ *
+ * return	      : SCAN_CODE; meaningful only when is_handled was set
+ * thread_p (in)      : Thread entry.
+ * scan_cache_p (in)  : Scan cache; the registered partial fetch attribute caches drive the truncation.
+ * forward_oid (in)   : Overflow address of the record content.
+ * recdes_p (out)     : Record descriptor; on success points into the scan cache area and holds the prefix only.
+ * is_handled (out)   : Set when the fetch was done here; otherwise the caller must take the full copy path.
+ *
+ * Note: The overflow pages are read through a streaming cursor, so a wide record whose scanned attributes sit in its
+ *	 first pages is fetched without ever materializing the remaining pages; for large records this skips both the
+ *	 page fixes and the copy. The prefix is sized from the first chunk; records whose variable offset table does
+ *	 not fit in it take the full copy path. Visibility was already checked on the home record, as in
+ *	 heap_get_bigone_content.
+ */
+static SCAN_CODE
+heap_get_bigone_content_partial (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache_p, OID * forward_oid,
+				 RECDES * recdes_p, bool * is_handled)
+{
+  OVERFLOW_STREAM stream;
+  VPID ovf_vpid;
+  char *chunk, *copyto;
+  int chunk_length, prefix_length, copy_length, copied;
+  SCAN_CODE scan;
+
+  *is_handled = false;
+
+  if (scan_cache_p->partial_fetch_attrinfo[0] == NULL && scan_cache_p->partial_fetch_attrinfo[1] == NULL)
+    {
+      return S_SUCCESS;
+    }
+
+  ovf_vpid.volid = forward_oid->volid;
+  ovf_vpid.pageid = forward_oid->pageid;
+
+  scan = overflow_stream_start (thread_p, &ovf_vpid, &stream, NULL);
+  if (scan != S_SUCCESS)
+    {
+      /* let the regular copy path produce the error */
+      return scan;
+    }
+
+  scan = overflow_stream_next (thread_p, &stream, &chunk, &chunk_length);
+  if (scan != S_SUCCESS)
+    {
+      overflow_stream_end (thread_p, &stream);
+      return scan == S_END ? S_SUCCESS : scan;
+    }
+
+  prefix_length = heap_partial_fetch_prefix_length (scan_cache_p, chunk, chunk_length, stream.total_length);
+  if (prefix_length < 0)
+    {
+      overflow_stream_end (thread_p, &stream);
+      return S_SUCCESS;
+    }
+
+  *is_handled = true;
+  if (heap_scan_cache_allocate_recdes_data (thread_p, scan_cache_p, recdes_p, prefix_length) != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      overflow_stream_end (thread_p, &stream);
+      return S_ERROR;
+    }
+
+  copyto = recdes_p->data;
+  copied = 0;
+  while (copied < prefix_length)
+    {
+      copy_length = MIN (chunk_length, prefix_length - copied);
+      memcpy (copyto, chunk, copy_length);
+      copyto += copy_length;
+      copied += copy_length;
+
+      if (copied < prefix_length)
+	{
+	  scan = overflow_stream_next (thread_p, &stream, &chunk, &chunk_length);
+	  if (scan != S_SUCCESS)
+	    {
+	      /* the prefix is bounded by the record length, so the chain ended early only if it is broken */
+	      overflow_stream_end (thread_p, &stream);
+	      recdes_p->data = NULL;
+	      return S_ERROR;
+	    }
+	}
+    }
+  overflow_stream_end (thread_p, &stream);
+
+  recdes_p->length = prefix_length;
+
+  return S_SUCCESS;
+}
+
+/*
+ * heap_get_record_data_when_all_ready () - Get record data when all required information is known. This can work only
+ *                                          for record types that actually have data: REC_HOME, REC_RELOCATION and
+ *                                          REC_BIGONE. Required information: home_page, forward_oid and forward page
+ *                                          for REC_RELOCATION and REC_BIGONE, and record type.
+ *
+ * return	      : SCAN_CODE: S_SUCCESS, S_ERROR, S_DOESNT_FIT.
+ * thread_p (in)      : Thread entry.
+ * context (in/out)   : Heap get context. Should contain all required information for object retrieving
+ */
+SCAN_CODE
+heap_get_record_data_when_all_ready (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT * context)
+{
+  HEAP_SCANCACHE *scan_cache_p = context->scan_cache;
+
+  /* We have everything set up to get record data. */
   assert (context != NULL);
 
   /* Assert ispeeking, scan_cache and recdes are compatible. If ispeeking is PEEK, it is the caller responsabilty to
@@ -7732,26 +8513,57 @@ heap_get_record_data_when_all_ready (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT *
     {
     case REC_RELOCATION:
       /* Don't peek REC_RELOCATION. */
-      if (scan_cache_p != NULL && (context->ispeeking != 0 || context->recdes_p->data == NULL)
-	  && heap_scan_cache_allocate_recdes_data (thread_p, scan_cache_p, context->recdes_p,
-						   DB_PAGESIZE * 2) != NO_ERROR)
+      if (scan_cache_p != NULL && (context->ispeeking != 0 || context->recdes_p->data == NULL))
 	{
-	  ASSERT_ERROR ();
-	  return S_ERROR;
+	  bool is_handled;
+	  SCAN_CODE partial_scan =
+	    heap_get_record_data_partial_copy (thread_p, context->fwd_page_watcher.pgptr, context->forward_oid.slotid,
+					       scan_cache_p, context->recdes_p, &is_handled);
+	  if (is_handled)
+	    {
+	      return partial_scan;
+	    }
+	  if (heap_scan_cache_allocate_recdes_data (thread_p, scan_cache_p, context->recdes_p,
+						    DB_PAGESIZE * 2) != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return S_ERROR;
+	    }
 	}
 
       return spage_get_record (thread_p, context->fwd_page_watcher.pgptr, context->forward_oid.slotid,
 			       context->recdes_p, COPY);
     case REC_BIGONE:
+      if (scan_cache_p != NULL && context->ispeeking == COPY && context->recdes_p->data == NULL)
+	{
+	  bool is_handled;
+	  SCAN_CODE partial_scan =
+	    heap_get_bigone_content_partial (thread_p, scan_cache_p, &context->forward_oid, context->recdes_p,
+					     &is_handled);
+	  if (is_handled)
+	    {
+	      return partial_scan;
+	    }
+	}
       return heap_get_bigone_content (thread_p, scan_cache_p, context->ispeeking, &context->forward_oid,
 				      context->recdes_p);
     case REC_HOME:
-      if (scan_cache_p != NULL && context->ispeeking == COPY && context->recdes_p->data == NULL
-	  && heap_scan_cache_allocate_recdes_data (thread_p, scan_cache_p, context->recdes_p,
-						   DB_PAGESIZE * 2) != NO_ERROR)
+      if (scan_cache_p != NULL && context->ispeeking == COPY && context->recdes_p->data == NULL)
 	{
-	  ASSERT_ERROR ();
-	  return S_ERROR;
+	  bool is_handled;
+	  SCAN_CODE partial_scan =
+	    heap_get_record_data_partial_copy (thread_p, context->home_page_watcher.pgptr, context->oid_p->slotid,
+					       scan_cache_p, context->recdes_p, &is_handled);
+	  if (is_handled)
+	    {
+	      return partial_scan;
+	    }
+	  if (heap_scan_cache_allocate_recdes_data (thread_p, scan_cache_p, context->recdes_p,
+						    DB_PAGESIZE * 2) != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return S_ERROR;
+	    }
 	}
       return spage_get_record (thread_p, context->home_page_watcher.pgptr, context->oid_p->slotid, context->recdes_p,
 			       context->ispeeking);
@@ -7762,6 +8574,43 @@ heap_get_record_data_when_all_ready (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT *
   return S_ERROR;
 }
 
+/*
+ * heap_scan_prefetch_next_range () - Issue a read-ahead batch for the pages following the scan position.
+ *
+ * return	   : void
+ * thread_p (in)   : Thread entry.
+ * scan_cache (in) : Scan cache; only scans that keep the last page fixed (sequential scans) prefetch.
+ * next_vpid (in)  : Page the scan is about to move to.
+ *
+ * Note: heap pages are laid out mostly contiguously, so the batch covers the pages right after next_vpid on the same
+ *	 volume. One batch is issued every HEAP_SCAN_PREFETCH_PAGES crossings to amortize the advise calls; pages that
+ *	 turn out not to belong to the heap only cost wasted read-ahead.
+ */
+static void
+heap_scan_prefetch_next_range (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const VPID * next_vpid)
+{
+  VPID prefetch_vpids[HEAP_SCAN_PREFETCH_PAGES];
+  int i;
+
+  if (scan_cache == NULL || scan_cache->cache_last_fix_page == false)
+    {
+      return;
+    }
+
+  if (next_vpid->pageid % HEAP_SCAN_PREFETCH_PAGES != 0)
+    {
+      return;
+    }
+
+  for (i = 0; i < HEAP_SCAN_PREFETCH_PAGES; i++)
+    {
+      prefetch_vpids[i].volid = next_vpid->volid;
+      prefetch_vpids[i].pageid = next_vpid->pageid + 1 + i;
+    }
+
+  (void) pgbuf_prefetch_range (thread_p, prefetch_vpids, HEAP_SCAN_PREFETCH_PAGES);
+}
+
 /*
  * heap_next_internal () - Retrieve of peek next object.
  *
@@ -7780,10 +8629,14 @@ heap_get_record_data_when_all_ready (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT *
  *			       be NULL COPY when the object is copied.
  * cache_recordinfo (in/out) : DB_VALUE pointer array that caches record
  *			       information values.
+ * stop_vpid (in)	     : Page at which to end the scan, or NULL. The
+ *			       scan returns S_END instead of advancing onto
+ *			       this page. Used by wrapped synchronized scans.
  */
 static SCAN_CODE
 heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
-		    HEAP_SCANCACHE * scan_cache, bool ispeeking, bool reversed_direction, DB_VALUE ** cache_recordinfo)
+		    HEAP_SCANCACHE * scan_cache, bool ispeeking, bool reversed_direction, DB_VALUE ** cache_recordinfo,
+		    const VPID * stop_vpid)
 {
   VPID vpid;
   VPID *vpidptr_incache;
@@ -7863,6 +8716,21 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 	  vpid.volid = oid.volid;
 	  vpid.pageid = oid.pageid;
 
+	  if (stop_vpid != NULL && VPID_EQ (&vpid, stop_vpid))
+	    {
+	      /* a wrapped synchronized scan is back on its start page; every page has been delivered exactly once */
+	      OID_SET_NULL (next_oid);
+	      if (old_page_watcher.pgptr != NULL)
+		{
+		  pgbuf_ordered_unfix (thread_p, &old_page_watcher);
+		}
+	      if (curr_page_watcher.pgptr != NULL)
+		{
+		  pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+		}
+	      return S_END;
+	    }
+
 	  /*
 	   * Fetch the page where the object of OID is stored. Use previous
 	   * scan page whenever possible, otherwise, deallocate the page.
@@ -7987,6 +8855,10 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 			}
 		      return scan;
 		    }
+		  else if (!reversed_direction)
+		    {
+		      heap_scan_prefetch_next_range (thread_p, scan_cache, &vpid);
+		    }
 		}
 	      else
 		{
@@ -9409,6 +10281,112 @@ heap_get_class_name_alloc_if_diff (THREAD_ENTRY * thread_p, const OID * class_oi
   return error_code;
 }
 
+/*
+ * Per-thread arena for attribute cache value arrays.
+ *
+ * Every heap_attrinfo_start/heap_attrinfo_end pair used to cycle the value
+ * array through the thread private heap, which shows up in short OLTP
+ * queries where scans are opened and closed per execution. Instead, value
+ * arrays are bump-allocated from a small scratch block hung off the thread
+ * entry; when the last attrinfo using the block is ended, the whole block
+ * is reset in one step. Arrays that do not fit (very wide classes, or many
+ * attrinfos alive at once) silently fall back to the private heap, which
+ * remains the allocator of record for every other attrinfo lifetime.
+ *
+ * A suspended query can resume on a different worker thread, so an
+ * attrinfo may be ended on a thread other than the one whose arena its
+ * values came from. Each attrinfo therefore remembers its owning arena,
+ * the live-array count is maintained atomically, and the wholesale reset
+ * is done lazily by the owning thread on its next allocation: the arena
+ * is only rewound once no value array carved from it is alive.
+ */
+#define HEAP_ATTRINFO_ARENA_SIZE (16 * 1024)
+
+typedef struct heap_attrinfo_arena HEAP_ATTRINFO_ARENA;
+struct heap_attrinfo_arena
+{
+  int offset;			/* bump pointer into data[]; touched only by the owning thread */
+  volatile INT32 nvalue_arrays;	/* value arrays currently carved from data[]; may be decremented by other threads */
+  char data[HEAP_ATTRINFO_ARENA_SIZE];
+};
+
+/*
+ * heap_attrinfo_arena_alloc () - carve a value array from the per-thread arena
+ *   return: pointer into the arena, or NULL when the request does not fit
+ *   thread_p(in): thread entry
+ *   nbytes(in): size of the value array
+ *   arena_out(out): the owning arena; to be remembered by the attrinfo
+ */
+static HEAP_ATTRVALUE *
+heap_attrinfo_arena_alloc (THREAD_ENTRY * thread_p, size_t nbytes, void **arena_out)
+{
+  HEAP_ATTRINFO_ARENA *arena;
+  char *ptr;
+
+  *arena_out = NULL;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+      if (thread_p == NULL)
+	{
+	  return NULL;
+	}
+    }
+
+  arena = (HEAP_ATTRINFO_ARENA *) thread_p->heap_attrinfo_arena;
+  if (arena == NULL)
+    {
+      arena = (HEAP_ATTRINFO_ARENA *) malloc (sizeof (HEAP_ATTRINFO_ARENA));
+      if (arena == NULL)
+	{
+	  /* not an error; the caller falls back to the private heap */
+	  return NULL;
+	}
+      arena->offset = 0;
+      arena->nvalue_arrays = 0;
+      thread_p->heap_attrinfo_arena = arena;
+    }
+
+  if (arena->nvalue_arrays == 0)
+    {
+      /* no carved array is alive anymore; rewind wholesale. Only the owning thread allocates, so the count can only
+       * grow under our feet, never drop back to zero. */
+      arena->offset = 0;
+    }
+
+  nbytes = DB_ALIGN (nbytes, MAX_ALIGNMENT);
+  if (arena->offset + (int) nbytes > HEAP_ATTRINFO_ARENA_SIZE)
+    {
+      return NULL;
+    }
+
+  ptr = arena->data + arena->offset;
+  arena->offset += (int) nbytes;
+  ATOMIC_INC_32 (&arena->nvalue_arrays, 1);
+
+  *arena_out = arena;
+  return (HEAP_ATTRVALUE *) ptr;
+}
+
+/*
+ * heap_attrinfo_arena_release () - return a value array to its arena
+ *   arena_p(in): arena the array was carved from
+ *
+ * Note: individual arrays are not reclaimed; the owning thread rewinds the
+ *	 arena once no attrinfo uses it anymore. May run on a thread other
+ *	 than the owner when a suspended query resumed elsewhere.
+ */
+static void
+heap_attrinfo_arena_release (void *arena_p)
+{
+  HEAP_ATTRINFO_ARENA *arena = (HEAP_ATTRINFO_ARENA *) arena_p;
+
+  assert (arena != NULL && arena->nvalue_arrays > 0);
+
+  (void) ATOMIC_INC_32 (&arena->nvalue_arrays, -1);
+}
+
 /*
  * heap_attrinfo_start () - Initialize an attribute information structure
  *   return: NO_ERROR
@@ -9477,6 +10455,7 @@ heap_attrinfo_start (THREAD_ENTRY * thread_p, const OID * class_oid, int request
   OID_SET_NULL (&attr_info->inst_oid);
   attr_info->inst_chn = NULL_CHN;
   attr_info->values = NULL;
+  attr_info->values_arena = NULL;
   attr_info->num_values = -1;	/* initialize attr_info */
 
   /*
@@ -9516,10 +10495,16 @@ heap_attrinfo_start (THREAD_ENTRY * thread_p, const OID * class_oid, int request
   if (requested_num_attrs > 0)
     {
       attr_info->values =
-	(HEAP_ATTRVALUE *) db_private_alloc (thread_p, requested_num_attrs * sizeof (*(attr_info->values)));
+	heap_attrinfo_arena_alloc (thread_p, requested_num_attrs * sizeof (*(attr_info->values)),
+				   &attr_info->values_arena);
       if (attr_info->values == NULL)
 	{
-	  goto exit_on_error;
+	  attr_info->values =
+	    (HEAP_ATTRVALUE *) db_private_alloc (thread_p, requested_num_attrs * sizeof (*(attr_info->values)));
+	  if (attr_info->values == NULL)
+	    {
+	      goto exit_on_error;
+	    }
 	}
     }
   else
@@ -10009,7 +10994,16 @@ heap_attrinfo_end (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info)
 
   if (attr_info->values)
     {
-      db_private_free_and_init (thread_p, attr_info->values);
+      if (attr_info->values_arena != NULL)
+	{
+	  heap_attrinfo_arena_release (attr_info->values_arena);
+	  attr_info->values = NULL;
+	  attr_info->values_arena = NULL;
+	}
+      else
+	{
+	  db_private_free_and_init (thread_p, attr_info->values);
+	}
     }
   OID_SET_NULL (&attr_info->class_oid);
 
@@ -12183,6 +13177,75 @@ error:
   return ER_FAILED;
 }
 
+/*
+ * heap_scancache_get_index_attrinfo () - Get a scan cache lifetime attribute cache for index maintenance
+ *   return: # of attrs involved in indexes or ER_FAILED
+ *   scan_cache(in/out): Scan cache of a multi-row operation
+ *   class_oid(in): The class identifier of the instances
+ *   slot(in): Which of the two caches to return
+ *   attr_info_p(out): The attribute cache; owned by the scan cache and must not be ended by the caller
+ *   idx_info(out): Index information of the class
+ *
+ * Note: The first call starts the attribute cache with heap_attrinfo_start_with_index and the scan cache keeps it
+ *	 until the scan cache ends, so a multi-row operation maintaining indexes builds the cache once instead of
+ *	 once per row. Values read for the previous row are cleared before the cache is handed out again. When the
+ *	 class changes (e.g., the scan cache moves to another partition), the cache is restarted for the new class.
+ */
+int
+heap_scancache_get_index_attrinfo (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, OID * class_oid, int slot,
+				   HEAP_CACHE_ATTRINFO ** attr_info_p, HEAP_IDX_ELEMENTS_INFO * idx_info)
+{
+  HEAP_CACHE_ATTRINFO *attr_info;
+  int num_found;
+
+  assert (scan_cache != NULL && scan_cache->debug_initpattern == HEAP_DEBUG_SCANCACHE_INITPATTERN);
+  assert (slot == 0 || slot == 1);
+
+  attr_info = scan_cache->index_attrinfo[slot];
+  if (attr_info != NULL && OID_EQ (&attr_info->class_oid, class_oid))
+    {
+      /* reuse the cache; only the values read for the previous row need to be dropped */
+      if (heap_attrinfo_clear_dbvalues (attr_info) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      *attr_info_p = attr_info;
+      *idx_info = scan_cache->index_attrinfo_idx_info[slot];
+
+      return scan_cache->index_attrinfo_num_found[slot];
+    }
+
+  if (attr_info != NULL)
+    {
+      /* the cache was started for another class; restart it for the given one */
+      heap_attrinfo_end (thread_p, attr_info);
+      db_private_free_and_init (thread_p, scan_cache->index_attrinfo[slot]);
+    }
+
+  attr_info = (HEAP_CACHE_ATTRINFO *) db_private_alloc (thread_p, sizeof (HEAP_CACHE_ATTRINFO));
+  if (attr_info == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  num_found = heap_attrinfo_start_with_index (thread_p, class_oid, NULL, attr_info, idx_info);
+  if (num_found <= 0)
+    {
+      /* nothing was started; nothing to keep in the scan cache either */
+      db_private_free_and_init (thread_p, attr_info);
+      return num_found;
+    }
+
+  scan_cache->index_attrinfo[slot] = attr_info;
+  scan_cache->index_attrinfo_idx_info[slot] = *idx_info;
+  scan_cache->index_attrinfo_num_found[slot] = num_found;
+
+  *attr_info_p = attr_info;
+
+  return num_found;
+}
+
 /*
  * heap_classrepr_find_index_id () - Find the indicated index ID from the class repr
  *   return: ID of desired index ot -1 if an error occurred.
@@ -13981,23 +15044,243 @@ heap_check_heap_file (THREAD_ENTRY * thread_p, HFID * hfid)
 	}
       return rv;
     }
-  else
+  else
+    {
+      ASSERT_ERROR ();
+      return DISK_ERROR;
+    }
+}
+
+#if defined (SERVER_MODE)
+/* HEAP_CHECK_SHARED - progress/error collector shared by the workers that
+ * check the heap files collected for heap_check_all_heaps () */
+typedef struct heap_check_shared HEAP_CHECK_SHARED;
+struct heap_check_shared
+{
+  pthread_mutex_t mtx;		/* protects all the fields below */
+  HFID *hfids;			/* heap files collected from the file tracker */
+  int nhfids;			/* number of collected heap files */
+  int next;			/* next heap file to claim */
+  int ndone_workers;		/* pushed workers that have finished */
+  bool stop;			/* set on DISK_ERROR; stop claiming */
+  DISK_ISVALID allvalid;	/* merged validation result */
+  int tran_index;		/* transaction doing the check */
+};
+
+/*
+ * heap_check_consume () - claim and check collected heap files until none
+ *                         remain
+ *   return:
+ *   thread_p(in):
+ *   shared_p(in/out): shared progress/error collector
+ */
+static void
+heap_check_consume (THREAD_ENTRY * thread_p, HEAP_CHECK_SHARED * shared_p)
+{
+  DISK_ISVALID valid;
+  HFID hfid;
+  int rv;
+
+  while (true)
+    {
+      rv = pthread_mutex_lock (&shared_p->mtx);
+      assert (rv == NO_ERROR);
+
+      if (shared_p->stop || shared_p->next >= shared_p->nhfids)
+	{
+	  pthread_mutex_unlock (&shared_p->mtx);
+	  break;
+	}
+      hfid = shared_p->hfids[shared_p->next++];
+      pthread_mutex_unlock (&shared_p->mtx);
+
+      valid = heap_check_heap_file (thread_p, &hfid);
+
+      rv = pthread_mutex_lock (&shared_p->mtx);
+      assert (rv == NO_ERROR);
+
+      if (valid == DISK_ERROR)
+	{
+	  shared_p->allvalid = (shared_p->allvalid == DISK_VALID) ? DISK_ERROR : shared_p->allvalid;
+	  shared_p->stop = true;
+	  pthread_mutex_unlock (&shared_p->mtx);
+	  break;
+	}
+      if (valid != DISK_VALID)
+	{
+	  shared_p->allvalid = valid;
+	}
+      pthread_mutex_unlock (&shared_p->mtx);
+    }
+}
+
+// *INDENT-OFF*
+static void
+heap_check_all_heaps_execute (cubthread::entry &thread_ref, HEAP_CHECK_SHARED *shared_p)
+{
+  thread_ref.tran_index = shared_p->tran_index;
+  pthread_mutex_unlock (&thread_ref.tran_index_lock);
+
+  heap_check_consume (&thread_ref, shared_p);
+
+  pthread_mutex_lock (&shared_p->mtx);
+  shared_p->ndone_workers++;
+  pthread_mutex_unlock (&shared_p->mtx);
+}
+// *INDENT-ON*
+#endif /* SERVER_MODE */
+
+/*
+ * heap_check_all_heaps () - Validate all pages of all known heap files
+ *   return: DISK_INVALID, DISK_VALID, DISK_ERROR
+ *
+ * Note: Verify that all pages of all heap files are valid. That is,
+ * that they are valid from the point of view of the file manager.
+ */
+DISK_ISVALID
+heap_check_all_heaps (THREAD_ENTRY * thread_p)
+{
+#if defined (SERVER_MODE)
+  /* Collect every heap file first, then check them as independent jobs
+   * spread over the request worker pool; the per-heap scans dominate the run
+   * time and do not depend on each other. */
+  HEAP_CHECK_SHARED shared;
+  int error_code = NO_ERROR;
+  DISK_ISVALID allvalid = DISK_VALID;
+  VFID vfid = VFID_INITIALIZER;
+  OID class_oid = OID_INITIALIZER;
+  HFID *hfids = NULL;
+  OID *locked_classes = NULL;
+  int nhfids = 0, max_hfids = 0, nlocked = 0;
+  int nworkers, npushed = 0;
+  int i, rv;
+
+  while (true)
+    {
+      /* Go to each file, collect only the heap files */
+      error_code = file_tracker_interruptable_iterate (thread_p, FILE_HEAP, &vfid, &class_oid);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  allvalid = (allvalid == DISK_VALID) ? DISK_ERROR : allvalid;
+	  break;
+	}
+      if (VFID_ISNULL (&vfid))
+	{
+	  /* no more heap files */
+	  break;
+	}
+
+      if (nhfids >= max_hfids)
+	{
+	  HFID *hfids_new;
+	  OID *locked_new;
+
+	  max_hfids = (max_hfids == 0) ? 64 : max_hfids * 2;
+	  hfids_new = (HFID *) db_private_realloc (thread_p, hfids, max_hfids * sizeof (HFID));
+	  if (hfids_new == NULL)
+	    {
+	      allvalid = (allvalid == DISK_VALID) ? DISK_ERROR : allvalid;
+	      break;
+	    }
+	  hfids = hfids_new;
+	  /* each heap file locks at most one class, so the same bound fits */
+	  locked_new = (OID *) db_private_realloc (thread_p, locked_classes, max_hfids * sizeof (OID));
+	  if (locked_new == NULL)
+	    {
+	      allvalid = (allvalid == DISK_VALID) ? DISK_ERROR : allvalid;
+	      break;
+	    }
+	  locked_classes = locked_new;
+	}
+      hfids[nhfids].vfid = vfid;
+      hfids[nhfids].hpgid = NULL_PAGEID;
+      nhfids++;
+
+      /* remember the class so its lock can be released once the checks are
+       * done; the iterator would release it on the next call otherwise */
+      for (i = 0; i < nlocked; i++)
+	{
+	  if (OID_EQ (&locked_classes[i], &class_oid))
+	    {
+	      break;
+	    }
+	}
+      if (i == nlocked && !OID_ISNULL (&class_oid))
+	{
+	  locked_classes[nlocked++] = class_oid;
+	}
+      OID_SET_NULL (&class_oid);
+    }
+
+  if (allvalid == DISK_VALID && nhfids > 0)
+    {
+      pthread_mutex_init (&shared.mtx, NULL);
+      shared.hfids = hfids;
+      shared.nhfids = nhfids;
+      shared.next = 0;
+      shared.ndone_workers = 0;
+      shared.stop = false;
+      shared.allvalid = DISK_VALID;
+      shared.tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+
+      nworkers = MIN (nhfids, fileio_os_sysconf ());
+      if (css_get_current_conn_entry () != NULL)
+	{
+	  /* boot-time consistency checks run without a connection entry and
+	   * cannot push external tasks; they check on this thread only */
+	  // *INDENT-OFF*
+	  for (i = 1; i < nworkers; i++)
+	    {
+	      cubthread::entry_callable_task *task =
+		new cubthread::entry_callable_task (std::bind (heap_check_all_heaps_execute, std::placeholders::_1,
+							       &shared));
+	      css_push_external_task (css_get_current_conn_entry (), task);
+	      npushed++;
+	    }
+	  // *INDENT-ON*
+	}
+
+      /* this thread checks heap files as well */
+      heap_check_consume (thread_p, &shared);
+
+      /* wait for the pushed workers to finish */
+      while (true)
+	{
+	  rv = pthread_mutex_lock (&shared.mtx);
+	  assert (rv == NO_ERROR);
+	  if (shared.ndone_workers >= npushed)
+	    {
+	      pthread_mutex_unlock (&shared.mtx);
+	      break;
+	    }
+	  pthread_mutex_unlock (&shared.mtx);
+
+	  thread_sleep (10);	/* 10 msec */
+	}
+
+      allvalid = shared.allvalid;
+      pthread_mutex_destroy (&shared.mtx);
+    }
+
+  for (i = 0; i < nlocked; i++)
+    {
+      lock_unlock_object (thread_p, &locked_classes[i], oid_Root_class_oid, SCH_S_LOCK, true);
+    }
+  if (!OID_ISNULL (&class_oid))
     {
-      ASSERT_ERROR ();
-      return DISK_ERROR;
+      lock_unlock_object (thread_p, &class_oid, oid_Root_class_oid, SCH_S_LOCK, true);
     }
-}
-
-/*
- * heap_check_all_heaps () - Validate all pages of all known heap files
- *   return: DISK_INVALID, DISK_VALID, DISK_ERROR
- *
- * Note: Verify that all pages of all heap files are valid. That is,
- * that they are valid from the point of view of the file manager.
- */
-DISK_ISVALID
-heap_check_all_heaps (THREAD_ENTRY * thread_p)
-{
+  if (hfids != NULL)
+    {
+      db_private_free_and_init (thread_p, hfids);
+    }
+  if (locked_classes != NULL)
+    {
+      db_private_free_and_init (thread_p, locked_classes);
+    }
+  return allvalid;
+#else /* SERVER_MODE */
   int error_code = NO_ERROR;
   HFID hfid;
   DISK_ISVALID allvalid = DISK_VALID;
@@ -14042,6 +15325,7 @@ exit_on_error:
     }
 
   return ((allvalid == DISK_VALID) ? DISK_ERROR : allvalid);
+#endif /* !SERVER_MODE */
 }
 
 /*
@@ -18635,7 +19919,36 @@ SCAN_CODE
 heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 	   HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL);
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL, NULL);
+}
+
+/*
+ * heap_next_until_page () - Retrieve or peek next object, ending the scan
+ *			     before the given page is reached
+ *   return: SCAN_CODE (Either of S_SUCCESS, S_DOESNT_FIT, S_END, S_ERROR)
+ *   hfid(in):
+ *   class_oid(in):
+ *   next_oid(in/out): Object identifier of current record.
+ *                     Will be set to next available record or NULL_OID when
+ *                     there is not one.
+ *   recdes(in/out): Pointer to a record descriptor. Will be modified to
+ *                   describe the new record.
+ *   scan_cache(in/out): Scan cache or NULL
+ *   ispeeking(in): PEEK when the object is peeked, scan_cache cannot be NULL
+ *                  COPY when the object is copied
+ *   stop_vpid(in): page at which to end the scan; S_END is returned instead
+ *                  of advancing onto this page
+ *
+ * Note: Used by synchronized scans after they wrap around: the stretch of
+ *	 the heap from stop_vpid onwards was already delivered before the
+ *	 wrap.
+ */
+SCAN_CODE
+heap_next_until_page (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
+		      HEAP_SCANCACHE * scan_cache, int ispeeking, const VPID * stop_vpid)
+{
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL,
+			     stop_vpid);
 }
 
 /*
@@ -18662,7 +19975,7 @@ heap_next_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_o
 		       HEAP_SCANCACHE * scan_cache, int ispeeking, DB_VALUE ** cache_recordinfo)
 {
   return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false,
-			     cache_recordinfo);
+			     cache_recordinfo, NULL);
 }
 
 /*
@@ -18684,7 +19997,7 @@ SCAN_CODE
 heap_prev (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 	   HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true, NULL);
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true, NULL, NULL);
 }
 
 /*
@@ -18711,7 +20024,7 @@ heap_prev_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_o
 		       HEAP_SCANCACHE * scan_cache, int ispeeking, DB_VALUE ** cache_recordinfo)
 {
   return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true,
-			     cache_recordinfo);
+			     cache_recordinfo, NULL);
 }
 
 /*
@@ -20070,6 +21383,7 @@ heap_get_insert_location_with_lock (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONT
   int slot_count, slot_id, lk_result;
   LOCK lock;
   int error_code = NO_ERROR;
+  bool used_affinity_hint = false;
 
   /* check input */
   assert (context != NULL);
@@ -20078,14 +21392,21 @@ heap_get_insert_location_with_lock (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONT
 
   if (home_hint_p == NULL)
     {
-      /* find and fix page for insert */
-      if (heap_stats_find_best_page (thread_p, &context->hfid, context->recdes_p->length,
-				     (context->recdes_p->type != REC_NEWHOME), context->recdes_p->length,
-				     context->scan_cache_p, context->home_page_watcher_p) == NULL)
+      /* First try the page this thread last inserted into; this keeps concurrent inserters to the same class on
+       * distinct pages without fixing the heap header page on every row. */
+      used_affinity_hint = heap_insert_try_affinity_page (thread_p, context);
+      if (!used_affinity_hint)
 	{
-	  ASSERT_ERROR_AND_SET (error_code);
-	  return error_code;
+	  /* find and fix page for insert */
+	  if (heap_stats_find_best_page (thread_p, &context->hfid, context->recdes_p->length,
+					 (context->recdes_p->type != REC_NEWHOME), context->recdes_p->length,
+					 context->scan_cache_p, context->home_page_watcher_p) == NULL)
+	    {
+	      ASSERT_ERROR_AND_SET (error_code);
+	      return error_code;
+	    }
 	}
+      heap_insert_affinity_record (thread_p, context, used_affinity_hint);
     }
   else
     {
@@ -24210,6 +25531,48 @@ heap_page_get_vacuum_status (THREAD_ENTRY * thread_p, PAGE_PTR heap_page)
   return HEAP_PAGE_GET_VACUUM_STATUS (chain);
 }
 
+/*
+ * heap_page_is_all_visible () - Check whether every record in the heap page is visible to any snapshot. This is the
+ *				 case when vacuum has processed all MVCC operations logged for the page: remaining
+ *				 records are committed inserts older than any active transaction and invisible
+ *				 versions have already been removed. The answer is only valid while the caller keeps
+ *				 the page latched; any new MVCC operation invalidates it.
+ *
+ * return	  : True if all records in the page are visible to any snapshot.
+ * thread_p (in)  : Thread entry.
+ * heap_page (in) : Heap page.
+ */
+static bool
+heap_page_is_all_visible (THREAD_ENTRY * thread_p, PAGE_PTR heap_page)
+{
+  HEAP_CHAIN *chain;
+  RECDES chain_recdes;
+
+  assert (heap_page != NULL);
+
+  /* Get heap chain. */
+  if (spage_get_record (thread_p, heap_page, HEAP_HEADER_AND_CHAIN_SLOTID, &chain_recdes, PEEK) != S_SUCCESS)
+    {
+      assert_release (false);
+      return false;
+    }
+  if (chain_recdes.length != sizeof (HEAP_CHAIN))
+    {
+      /* Heap header page. */
+      assert (chain_recdes.length == sizeof (HEAP_HDR_STATS));
+      return false;
+    }
+  chain = (HEAP_CHAIN *) chain_recdes.data;
+
+  if (HEAP_PAGE_GET_VACUUM_STATUS (chain) == HEAP_PAGE_VACUUM_NONE)
+    {
+      return true;
+    }
+  /* the status flag can lag behind vacuum; all operations are also known vacuumed when the page's max MVCCID passed
+   * the vacuum watermark. */
+  return vacuum_is_mvccid_vacuumed (chain->max_mvccid);
+}
+
 /*
  * heap_rv_nop () - Heap recovery no op function.
  *
@@ -24731,6 +26094,15 @@ heap_get_visible_version_internal (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT * c
       mvcc_snapshot = context->scan_cache->mvcc_snapshot;
     }
 
+  if (mvcc_snapshot != NULL && is_heap_scan && context->old_chn == NULL_CHN && context->record_type == REC_HOME
+      && heap_page_is_all_visible (thread_p, context->home_page_watcher.pgptr))
+    {
+      /* scan-heavy fast path: vacuum already processed every MVCC operation on this page, so the record is visible
+       * to any snapshot. Skip MVCC header decoding and the snapshot test altogether. The hint is read under the page
+       * latch, where it is stable. */
+      mvcc_snapshot = NULL;
+    }
+
   if (mvcc_snapshot != NULL || context->old_chn != NULL_CHN)
     {
       /* mvcc header is needed for visibility check or chn check */
@@ -25393,6 +26765,90 @@ heap_nonheader_page_capacity ()
   return spage_max_record_size () - sizeof (HEAP_CHAIN);
 }
 
+/*
+ * heap_insert_full_page () - build a whole heap page out of an array of records
+ *   return: error code or NO_ERROR
+ *   thread_p (in)        : thread entry
+ *   hfid (in)            : heap file identifier
+ *   class_oid (in)       : class identifier
+ *   recdes_array (in/out): records to insert; headers are adjusted in place
+ *   num_recdes (in)      : number of records; the caller guarantees they fit
+ *			    together in one page
+ *   oids_out (out)       : identifier assigned to each inserted record
+ *   new_page_vpid (out)  : the newly allocated page
+ *
+ * Note: Fast path for bulk loads. The caller must own BU_LOCK on the class, so
+ *	 the records carry no MVCC information, no per-record lock is taken and
+ *	 the only log record is the whole-page redo appended here. The page is
+ *	 not yet part of the heap chain; the caller must attach it with
+ *	 heap_log_postpone_heap_append_pages, like any bulk-inserted page.
+ */
+int
+heap_insert_full_page (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, RECDES * recdes_array, int num_recdes,
+		       OID * oids_out, VPID * new_page_vpid)
+{
+  PGBUF_WATCHER page_watcher;
+  HEAP_OPERATION_CONTEXT context;
+  PGSLOTID slot_id;
+  bool is_mvcc_class;
+  int error_code = NO_ERROR;
+
+  assert (hfid != NULL && class_oid != NULL && recdes_array != NULL && num_recdes > 0 && oids_out != NULL);
+  assert (!OID_IS_ROOTOID (class_oid));
+  assert (lock_has_lock_on_object (class_oid, oid_Root_class_oid, BU_LOCK));
+
+  is_mvcc_class = !mvcc_is_mvcc_disabled_class (class_oid);
+
+  /* Adjust every record header up front, before any page is fixed. This is a bulk
+   * operation, so the adjustment strips the MVCC information, exactly as the
+   * per-record insert path does for bulk inserts. */
+  for (int i = 0; i < num_recdes; i++)
+    {
+      recdes_array[i].type = REC_HOME;
+      heap_create_insert_context (&context, hfid, class_oid, &recdes_array[i], NULL);
+      context.is_bulk_op = true;
+      if (heap_insert_adjust_recdes_header (thread_p, &context, is_mvcc_class) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
+  error_code = heap_alloc_new_page (thread_p, hfid, *class_oid, &page_watcher, new_page_vpid);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  for (int i = 0; i < num_recdes; i++)
+    {
+      if (spage_insert (thread_p, page_watcher.pgptr, &recdes_array[i], &slot_id) != SP_SUCCESS)
+	{
+	  /* cannot happen as long as the caller sized the batch against
+	   * heap_nonheader_page_capacity */
+	  assert (false);
+	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	  pgbuf_ordered_unfix_and_init (thread_p, page_watcher.pgptr, &page_watcher);
+	  return ER_FAILED;
+	}
+
+      oids_out[i].volid = new_page_vpid->volid;
+      oids_out[i].pageid = new_page_vpid->pageid;
+      oids_out[i].slotid = slot_id;
+    }
+
+  perfmon_add_stat (thread_p, PSTAT_HEAP_HOME_INSERTS, num_recdes);
+
+  /* one whole-page redo covers every record on the page */
+  pgbuf_log_redo_new_page (thread_p, page_watcher.pgptr, DB_PAGESIZE, PAGE_HEAP);
+
+  pgbuf_ordered_unfix_and_init (thread_p, page_watcher.pgptr, &page_watcher);
+
+  assert (!pgbuf_is_page_fixed_by_thread (thread_p, new_page_vpid));
+
+  return NO_ERROR;
+}
+
 /*
  * heap_rv_postpone_append_pages_to_heap () - Append a list of pages to the given heap
  *    return                  : Error_code
@@ -25847,3 +27303,266 @@ heap_log_postpone_heap_append_pages (THREAD_ENTRY * thread_p, const HFID * hfid,
 }
 
 // *INDENT-ON*
+
+#if defined (SERVER_MODE)
+// *INDENT-OFF*
+static cubthread::daemon *heap_Compaction_daemon = NULL;
+// *INDENT-ON*
+
+/* Round-robin position of the online compaction daemon: the heap currently
+ * being walked and the next page of its chain to examine. Only the daemon
+ * thread touches these. */
+static OID heap_Compaction_class_oid = OID_INITIALIZER;
+static VPID heap_Compaction_vpid = VPID_INITIALIZER;
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * heap_compaction_select_heap () - pick the heap the compaction daemon should work on
+ *   return: true if a heap was selected
+ *   thread_p(in): thread entry
+ *   class_oid_p(in/out): cursor; on input the class worked on last, on output the selected class
+ *   hfid_p(out): heap file of the selected class
+ *   ftype_p(out): FILE_HEAP or FILE_HEAP_REUSE_SLOTS
+ *   pick_next(in): true to advance past the cursor class instead of resuming it
+ *
+ * Note: iterates the class OID->HFID hash and treats it as a circular list:
+ *	 resume the cursor class if it is still cached, otherwise (or when
+ *	 asked to advance) take its successor, wrapping to the first entry.
+ *	 The iteration order is whatever the hash yields; all that matters is
+ *	 that every cached heap is visited eventually.
+ */
+static bool
+heap_compaction_select_heap (THREAD_ENTRY * thread_p, OID * class_oid_p, HFID * hfid_p, FILE_TYPE * ftype_p,
+			     bool pick_next)
+{
+  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (thread_p, THREAD_TS_HFID_TABLE);
+  LF_HASH_TABLE_ITERATOR it;
+  HEAP_HFID_TABLE_ENTRY *entry;
+  OID first_class = OID_INITIALIZER;
+  HFID first_hfid = HFID_INITIALIZER;
+  FILE_TYPE first_ftype = FILE_UNKNOWN_TYPE;
+  OID found_class = OID_INITIALIZER;
+  HFID found_hfid = HFID_INITIALIZER;
+  FILE_TYPE found_ftype = FILE_UNKNOWN_TYPE;
+  bool cursor_seen = false;
+  bool take_successor = false;
+
+  lf_hash_create_iterator (&it, t_entry, &heap_Hfid_table->hfid_hash);
+  for (entry = (HEAP_HFID_TABLE_ENTRY *) lf_hash_iterate (&it); entry != NULL;
+       entry = (HEAP_HFID_TABLE_ENTRY *) lf_hash_iterate (&it))
+    {
+      if (HFID_IS_NULL (&entry->hfid) || (entry->ftype != FILE_HEAP && entry->ftype != FILE_HEAP_REUSE_SLOTS))
+	{
+	  /* not (yet) a usable heap */
+	  continue;
+	}
+      if (HFID_IS_NULL (&first_hfid))
+	{
+	  COPY_OID (&first_class, &entry->class_oid);
+	  HFID_COPY (&first_hfid, &entry->hfid);
+	  first_ftype = entry->ftype;
+	}
+      if (take_successor)
+	{
+	  COPY_OID (&found_class, &entry->class_oid);
+	  HFID_COPY (&found_hfid, &entry->hfid);
+	  found_ftype = entry->ftype;
+	  take_successor = false;
+	}
+      if (!cursor_seen && OID_EQ (&entry->class_oid, class_oid_p))
+	{
+	  cursor_seen = true;
+	  if (pick_next)
+	    {
+	      take_successor = true;
+	    }
+	  else
+	    {
+	      COPY_OID (&found_class, &entry->class_oid);
+	      HFID_COPY (&found_hfid, &entry->hfid);
+	      found_ftype = entry->ftype;
+	    }
+	}
+      /* run the iterator to completion so its transaction is ended */
+    }
+
+  if (HFID_IS_NULL (&found_hfid))
+    {
+      /* cursor class is gone, or it was the last entry; wrap around */
+      COPY_OID (&found_class, &first_class);
+      HFID_COPY (&found_hfid, &first_hfid);
+      found_ftype = first_ftype;
+    }
+
+  if (HFID_IS_NULL (&found_hfid))
+    {
+      return false;
+    }
+
+  COPY_OID (class_oid_p, &found_class);
+  HFID_COPY (hfid_p, &found_hfid);
+  *ftype_p = found_ftype;
+  return true;
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * heap_compaction_execute () - examine a budgeted number of heap pages, defragmenting fragmented ones and
+ *			        returning empty ones to the file system
+ */
+static void
+heap_compaction_execute (cubthread::entry & thread_ref)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  HFID hfid;
+  FILE_TYPE ftype;
+  VPID vpid, next_vpid;
+  PAGE_PTR pgptr = NULL;
+  HEAP_CHAIN *chain;
+  LOG_DATA_ADDR addr;
+  int budget;
+  bool advance_heap = false;
+
+  if (!BO_IS_SERVER_RESTARTED () || !prm_get_bool_value (PRM_ID_HEAP_ONLINE_COMPACTION))
+    {
+      return;
+    }
+
+  budget = prm_get_integer_value (PRM_ID_HEAP_ONLINE_COMPACTION_PAGES);
+
+  if (!heap_compaction_select_heap (thread_p, &heap_Compaction_class_oid, &hfid, &ftype, false))
+    {
+      /* no heap is cached yet */
+      return;
+    }
+
+  vpid = heap_Compaction_vpid;
+  if (VPID_ISNULL (&vpid))
+    {
+      /* start over from the header page; it is never modified, only used to reach the first chain link */
+      vpid.volid = hfid.vfid.volid;
+      vpid.pageid = hfid.hpgid;
+    }
+
+  addr.vfid = &hfid.vfid;
+  addr.offset = 0;
+
+  /* page removal runs a system operation; give this thread its own system worker tdes for the cycle */
+  thread_ref.claim_system_worker ();
+
+  while (budget-- > 0)
+    {
+      pgptr = pgbuf_fix (thread_p, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
+      if (pgptr == NULL)
+	{
+	  /* deallocated since the cursor was saved (vacuum, or a previous cycle); move to another heap */
+	  er_clear ();
+	  advance_heap = true;
+	  break;
+	}
+      /* the cursor may be arbitrarily stale, so revalidate: the page must still be a heap page and still belong
+       * to the heap we think we are walking. The write latch keeps both facts stable while we hold the page. */
+      if (!pgbuf_check_page_type_no_error (thread_p, pgptr, PAGE_HEAP))
+	{
+	  pgbuf_unfix_and_init (thread_p, pgptr);
+	  advance_heap = true;
+	  break;
+	}
+      chain = heap_get_chain_ptr (thread_p, pgptr);
+      if (chain == NULL || !OID_EQ (&chain->class_oid, &heap_Compaction_class_oid))
+	{
+	  pgbuf_unfix_and_init (thread_p, pgptr);
+	  advance_heap = true;
+	  break;
+	}
+      if (heap_vpid_next (thread_p, &hfid, pgptr, &next_vpid) != NO_ERROR)
+	{
+	  er_clear ();
+	  pgbuf_unfix_and_init (thread_p, pgptr);
+	  advance_heap = true;
+	  break;
+	}
+
+      if (vpid.pageid != hfid.hpgid || vpid.volid != hfid.vfid.volid)
+	{
+	  if (spage_number_of_records (pgptr) <= 1 && ftype == FILE_HEAP_REUSE_SLOTS
+	      && pgbuf_has_prevent_dealloc (pgptr) == false)
+	    {
+	      /* empty page of a reusable-OID heap; hand it back to the file manager. The routine gives up
+	       * gracefully whenever a conditional latch fails, in which case the page is revisited on a
+	       * later pass. Non-reusable heaps must keep their pages: slots are permanent OID addresses. */
+	      if (heap_remove_page_on_vacuum (thread_p, &pgptr, &hfid))
+		{
+		  assert (pgptr == NULL);
+		}
+	    }
+	  else if (spage_need_compact (thread_p, pgptr) == true)
+	    {
+	      /* same non-logged defragmentation heap_compact_pages applies offline */
+	      if (spage_compact (thread_p, pgptr) == NO_ERROR)
+		{
+		  addr.pgptr = pgptr;
+		  log_skip_logging (thread_p, &addr);
+		  pgbuf_set_dirty (thread_p, pgptr, DONT_FREE);
+		}
+	    }
+	}
+
+      if (pgptr != NULL)
+	{
+	  pgbuf_unfix_and_init (thread_p, pgptr);
+	}
+
+      if (VPID_ISNULL (&next_vpid))
+	{
+	  /* finished this heap; next cycle starts on the next one */
+	  advance_heap = true;
+	  break;
+	}
+      vpid = next_vpid;
+    }
+
+  thread_ref.retire_system_worker ();
+
+  if (advance_heap)
+    {
+      VPID_SET_NULL (&heap_Compaction_vpid);
+      (void) heap_compaction_select_heap (thread_p, &heap_Compaction_class_oid, &hfid, &ftype, true);
+    }
+  else
+    {
+      heap_Compaction_vpid = vpid;
+    }
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * heap_compaction_daemon_init () - initialize the online heap compaction daemon thread
+ */
+void
+heap_compaction_daemon_init ()
+{
+  assert (heap_Compaction_daemon == NULL);
+
+  // *INDENT-OFF*
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (500));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (heap_compaction_execute);
+
+  heap_Compaction_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "heap_compaction");
+  // *INDENT-ON*
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * heap_compaction_daemon_destroy () - destroy the online heap compaction daemon thread
+ */
+void
+heap_compaction_daemon_destroy ()
+{
+  cubthread::get_manager ()->destroy_daemon (heap_Compaction_daemon);
+}
+#endif /* SERVER_MODE */
@@ -135,6 +135,14 @@ struct heap_scancache_node_list
   HEAP_SCANCACHE_NODE_LIST *next;
 };
 
+typedef struct heap_idx_elements_info HEAP_IDX_ELEMENTS_INFO;
+struct heap_idx_elements_info
+{
+  int num_btids;		/* class has # of btids */
+  int has_single_col;		/* class has single column index */
+  int has_multi_col;		/* class has multi-column index */
+};
+
 // *INDENT-OFF*
 typedef struct heap_scancache HEAP_SCANCACHE;
 struct heap_scancache
@@ -154,6 +162,15 @@ struct heap_scancache
     MVCC_SNAPSHOT *mvcc_snapshot;	/* mvcc snapshot */
     HEAP_SCANCACHE_NODE_LIST *partition_list;	/* list holding the heap file information for partition nodes involved
 						 * in the scan */
+    HEAP_CACHE_ATTRINFO *partial_fetch_attrinfo[2];	/* when set, COPY record fetches may be truncated right after
+							 * the last variable attribute these caches need; only safe for
+							 * read-only scans that access the record exclusively through
+							 * these caches (see heap_scancache_set_partial_fetch) */
+    HEAP_CACHE_ATTRINFO *index_attrinfo[2];	/* attribute caches for index maintenance, started on first use and
+						 * kept for the life of the scan cache so a multi-row operation
+						 * builds them only once (see heap_scancache_get_index_attrinfo) */
+    HEAP_IDX_ELEMENTS_INFO index_attrinfo_idx_info[2];	/* index information found when each cache was started */
+    int index_attrinfo_num_found[2];	/* number of index attributes found when each cache was started */
 
 
     void start_area ();
@@ -242,14 +259,6 @@ struct heap_spacecache
 };
 #endif
 
-typedef struct heap_idx_elements_info HEAP_IDX_ELEMENTS_INFO;
-struct heap_idx_elements_info
-{
-  int num_btids;		/* class has # of btids */
-  int has_single_col;		/* class has single column index */
-  int has_multi_col;		/* class has multi-column index */
-};
-
 /* heap operation types */
 typedef enum
 {
@@ -414,6 +423,8 @@ extern int heap_scancache_start (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_
 				 MVCC_SNAPSHOT * mvcc_snapshot);
 extern int heap_scancache_start_modify (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const HFID * hfid,
 					const OID * class_oid, int op_type, MVCC_SNAPSHOT * mvcc_snapshot);
+extern void heap_scancache_set_partial_fetch (HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * pred_attrinfo,
+					      HEAP_CACHE_ATTRINFO * rest_attrinfo);
 extern int heap_scancache_quick_start (HEAP_SCANCACHE * scan_cache);
 extern int heap_scancache_quick_start_modify (HEAP_SCANCACHE * scan_cache);
 extern int heap_scancache_end (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache);
@@ -422,6 +433,12 @@ extern void heap_scancache_end_modify (THREAD_ENTRY * thread_p, HEAP_SCANCACHE *
 extern SCAN_CODE heap_get_class_oid (THREAD_ENTRY * thread_p, const OID * oid, OID * class_oid);
 extern SCAN_CODE heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 			    RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking);
+extern SCAN_CODE heap_next_until_page (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
+				       RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking,
+				       const VPID * stop_vpid);
+extern void heap_sync_scan_publish (const HFID * hfid, const VPID * vpid);
+extern void heap_sync_scan_get_start (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * class_oid,
+				      VPID * start_vpid);
 extern SCAN_CODE heap_next_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 					RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking,
 					DB_VALUE ** cache_recordinfo);
@@ -496,6 +513,9 @@ extern int heap_attrinfo_start_with_index (THREAD_ENTRY * thread_p, OID * class_
 					   HEAP_CACHE_ATTRINFO * attr_info, HEAP_IDX_ELEMENTS_INFO * idx_info);
 extern int heap_attrinfo_start_with_btid (THREAD_ENTRY * thread_p, OID * class_oid, BTID * btid,
 					  HEAP_CACHE_ATTRINFO * attr_info);
+extern int heap_scancache_get_index_attrinfo (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, OID * class_oid,
+					      int slot, HEAP_CACHE_ATTRINFO ** attr_info_p,
+					      HEAP_IDX_ELEMENTS_INFO * idx_info);
 
 #if defined (ENABLE_UNUSED_FUNCTION)
 extern DB_VALUE *heap_attrvalue_get_index (int value_index, ATTR_ID * attrid, int *n_btids, BTID ** btids,
@@ -653,6 +673,11 @@ extern MVCCID heap_page_get_max_mvccid (THREAD_ENTRY * thread_p, PAGE_PTR heap_p
 extern HEAP_PAGE_VACUUM_STATUS heap_page_get_vacuum_status (THREAD_ENTRY * thread_p, PAGE_PTR heap_page);
 extern bool heap_remove_page_on_vacuum (THREAD_ENTRY * thread_p, PAGE_PTR * page_ptr, HFID * hfid);
 
+#if defined (SERVER_MODE)
+extern void heap_compaction_daemon_init ();
+extern void heap_compaction_daemon_destroy ();
+#endif /* SERVER_MODE */
+
 extern int heap_rv_nop (THREAD_ENTRY * thread_p, LOG_RCV * rcv);
 extern int heap_rv_update_chain_after_mvcc_op (THREAD_ENTRY * thread_p, LOG_RCV * rcv);
 extern INT16 heap_rv_remove_flags_from_offset (INT16 offset);
@@ -692,6 +717,9 @@ extern int heap_alloc_new_page (THREAD_ENTRY * thread_p, HFID * hfid, OID class_
 
 extern int heap_nonheader_page_capacity ();
 
+extern int heap_insert_full_page (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, RECDES * recdes_array,
+				  int num_recdes, OID * oids_out, VPID * new_page_vpid);
+
 extern int heap_rv_postpone_append_pages_to_heap (THREAD_ENTRY * thread_p, LOG_RCV * recv);
 extern void heap_rv_dump_append_pages_to_heap (FILE * fp, int length, void *data);
 // *INDENT-OFF*
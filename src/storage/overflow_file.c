@@ -905,6 +905,123 @@ overflow_get (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * recdes, M
   return overflow_get_nbytes (thread_p, ovf_vpid, recdes, 0, -1, &remaining_length, mvcc_snapshot);
 }
 
+/*
+ * overflow_stream_start () - Open a streaming read cursor over an overflow record
+ *   return: scan status
+ *   ovf_vpid(in): Overflow address
+ *   stream(in/out): Cursor to initialize
+ *   mvcc_snapshot(in): mvcc snapshot
+ *
+ * Note: Unlike overflow_get, the content is not copied anywhere: successive
+ *       overflow_stream_next calls hand out pointers into the fixed buffer
+ *       pages, one page worth of data at a time. The caller must end the
+ *       stream with overflow_stream_end on every path, including errors.
+ */
+SCAN_CODE
+overflow_stream_start (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, OVERFLOW_STREAM * stream,
+		       MVCC_SNAPSHOT * mvcc_snapshot)
+{
+  OVERFLOW_FIRST_PART *first_part;
+
+  stream->pgptr = pgbuf_fix (thread_p, ovf_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (stream->pgptr == NULL)
+    {
+      return S_ERROR;
+    }
+
+  (void) pgbuf_check_page_ptype (thread_p, stream->pgptr, PAGE_OVERFLOW);
+
+  if (mvcc_snapshot != NULL)
+    {
+      MVCC_REC_HEADER mvcc_header;
+      heap_get_mvcc_rec_header_from_overflow (stream->pgptr, &mvcc_header, NULL);
+      if (mvcc_snapshot->snapshot_fnc (thread_p, &mvcc_header, mvcc_snapshot) == TOO_OLD_FOR_SNAPSHOT)
+	{
+	  pgbuf_unfix_and_init (thread_p, stream->pgptr);
+	  return S_SNAPSHOT_NOT_SATISFIED;
+	}
+    }
+
+  first_part = (OVERFLOW_FIRST_PART *) stream->pgptr;
+  stream->chunk = (char *) first_part->data;
+  stream->next_vpid = first_part->next_vpid;
+  stream->total_length = first_part->length;
+  stream->remaining = first_part->length;
+
+  return S_SUCCESS;
+}
+
+/*
+ * overflow_stream_next () - Serve the next chunk of the overflow record
+ *   return: S_SUCCESS with a chunk, S_END when the record is exhausted,
+ *           S_ERROR on a broken page chain
+ *   stream(in/out): Cursor
+ *   chunk(out): Start of the chunk; points into the fixed page and is
+ *               invalidated by the next call on the stream
+ *   chunk_length(out): Number of bytes in the chunk
+ */
+SCAN_CODE
+overflow_stream_next (THREAD_ENTRY * thread_p, OVERFLOW_STREAM * stream, char **chunk, int *chunk_length)
+{
+  OVERFLOW_REST_PART *rest_parts;
+
+  *chunk = NULL;
+  *chunk_length = 0;
+
+  if (stream->remaining <= 0)
+    {
+      return S_END;
+    }
+
+  if (stream->chunk == NULL)
+    {
+      /* the previous chunk was served; move to the next page of the chain */
+      assert (stream->pgptr != NULL);
+      pgbuf_unfix_and_init (thread_p, stream->pgptr);
+
+      if (VPID_ISNULL (&stream->next_vpid))
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HEAP_OVFADDRESS_CORRUPTED, 3, NULL_VOLID, NULL_PAGEID,
+		  NULL_SLOTID);
+	  return S_ERROR;
+	}
+
+      stream->pgptr =
+	pgbuf_fix (thread_p, &stream->next_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+      if (stream->pgptr == NULL)
+	{
+	  return S_ERROR;
+	}
+
+      (void) pgbuf_check_page_ptype (thread_p, stream->pgptr, PAGE_OVERFLOW);
+
+      rest_parts = (OVERFLOW_REST_PART *) stream->pgptr;
+      stream->chunk = (char *) rest_parts->data;
+      stream->next_vpid = rest_parts->next_vpid;
+    }
+
+  *chunk = stream->chunk;
+  *chunk_length = MIN (stream->remaining, DB_PAGESIZE - CAST_BUFLEN (stream->chunk - (char *) stream->pgptr));
+
+  stream->remaining -= *chunk_length;
+  stream->chunk = NULL;
+
+  return S_SUCCESS;
+}
+
+/*
+ * overflow_stream_end () - Close a streaming read cursor
+ *   stream(in/out): Cursor
+ */
+void
+overflow_stream_end (THREAD_ENTRY * thread_p, OVERFLOW_STREAM * stream)
+{
+  if (stream->pgptr != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, stream->pgptr);
+    }
+}
+
 /*
  * overflow_get_capacity () - Find the current storage facts/capacity of given
  *                   overflow rec
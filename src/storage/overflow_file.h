@@ -49,6 +49,21 @@ struct overflow_rest_part
   char data[1];			/* Really more than one */
 };
 
+/* Streaming read cursor over an overflow record. The consumer sees the
+ * content as a sequence of page-sized chunks served directly from the fixed
+ * buffer pages, so the record is never reassembled in a private buffer.
+ * A chunk pointer stays valid until the next overflow_stream_next or
+ * overflow_stream_end call, which unfixes the page it points into. */
+typedef struct overflow_stream OVERFLOW_STREAM;
+struct overflow_stream
+{
+  PAGE_PTR pgptr;		/* currently fixed overflow page */
+  char *chunk;			/* start of the not yet consumed chunk in pgptr, or NULL after it was served */
+  VPID next_vpid;		/* link to the page after pgptr */
+  int total_length;		/* length of the whole overflow record */
+  int remaining;		/* bytes not yet served */
+};
+
 
 extern int overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid, RECDES * recdes,
 			    FILE_TYPE file_type);
@@ -61,6 +76,11 @@ extern SCAN_CODE overflow_get (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, R
 			       MVCC_SNAPSHOT * mvcc_snapshot);
 extern SCAN_CODE overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * recdes, int start_offset,
 				      int max_nbytes, int *remaining_length, MVCC_SNAPSHOT * mvcc_snapshot);
+extern SCAN_CODE overflow_stream_start (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, OVERFLOW_STREAM * stream,
+					MVCC_SNAPSHOT * mvcc_snapshot);
+extern SCAN_CODE overflow_stream_next (THREAD_ENTRY * thread_p, OVERFLOW_STREAM * stream, char **chunk,
+				       int *chunk_length);
+extern void overflow_stream_end (THREAD_ENTRY * thread_p, OVERFLOW_STREAM * stream);
 extern int overflow_get_capacity (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, int *ovf_length, int *ovf_num_pages,
 				  int *ovf_overhead, int *ovf_free_space);
 #if defined (CUBRID_DEBUG)
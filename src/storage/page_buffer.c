@@ -66,6 +66,13 @@
 #if defined(SERVER_MODE)
 #include "connection_error.h"
 #endif /* SERVER_MODE */
+#if defined (LINUX)
+#include <errno.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif /* LINUX */
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
@@ -230,6 +237,14 @@ typedef enum
 /* flag for asynchronous flush request */
 #define PGBUF_BCB_ASYNC_FLUSH_REQ           ((int) 0x02000000)
 
+/* second-chance reference bit used by the clock victim scan (data_buffer_clock_victim); set on fix, cleared when the
+ * clock hand passes over the bcb. it does not affect the lru victim candidacy of the bcb. */
+#define PGBUF_BCB_CLOCK_REF_FLAG            ((int) 0x01000000)
+
+/* flag for buffers taken out of service by an online pool shrink (data_buffer_active_pages); a retired bcb is on no
+ * list and no allocation or victimization path may hand it out until a pool grow clears the flag again. */
+#define PGBUF_BCB_RETIRED_FLAG              ((int) 0x00100000)
+
 /* add all flags here */
 #define PGBUF_BCB_FLAGS_MASK \
   (PGBUF_BCB_DIRTY_FLAG \
@@ -238,7 +253,9 @@ typedef enum
    | PGBUF_BCB_INVALIDATE_DIRECT_VICTIM_FLAG \
    | PGBUF_BCB_MOVE_TO_LRU_BOTTOM_FLAG \
    | PGBUF_BCB_TO_VACUUM_FLAG \
-   | PGBUF_BCB_ASYNC_FLUSH_REQ)
+   | PGBUF_BCB_ASYNC_FLUSH_REQ \
+   | PGBUF_BCB_CLOCK_REF_FLAG \
+   | PGBUF_BCB_RETIRED_FLAG)
 
 /* add flags that invalidate a victim candidate here */
 /* 1. dirty bcb's cannot be victimized.
@@ -249,7 +266,8 @@ typedef enum
   (PGBUF_BCB_DIRTY_FLAG \
    | PGBUF_BCB_FLUSHING_TO_DISK_FLAG \
    | PGBUF_BCB_VICTIM_DIRECT_FLAG \
-   | PGBUF_BCB_INVALIDATE_DIRECT_VICTIM_FLAG)
+   | PGBUF_BCB_INVALIDATE_DIRECT_VICTIM_FLAG \
+   | PGBUF_BCB_RETIRED_FLAG)
 
 /* bcb has no flag initially and is in invalid zone */
 #define PGBUF_BCB_INIT_FLAGS PGBUF_INVALID_ZONE
@@ -290,7 +308,8 @@ typedef enum
 
 #define PGBUF_MAX_NEIGHBOR_PAGES 32
 #define PGBUF_NEIGHBOR_PAGES \
-  (prm_get_integer_value (PRM_ID_PB_NEIGHBOR_FLUSH_PAGES))
+  (pgbuf_Adaptive_flush_enabled ? pgbuf_Adaptive_neighbor_pages \
+   : prm_get_integer_value (PRM_ID_PB_NEIGHBOR_FLUSH_PAGES))
 
 #define PGBUF_NEIGHBOR_POS(idx) (PGBUF_NEIGHBOR_PAGES - 1 + (idx))
 
@@ -802,6 +821,65 @@ struct pgbuf_victim_candidate_list
 static PGBUF_BUFFER_POOL pgbuf_Pool;	/* The buffer Pool */
 static PGBUF_BATCH_FLUSH_HELPER pgbuf_Flush_helper;
 
+/* number of NUMA nodes backing the buffer pool; stays 1 unless data_buffer_numa_aware is enabled and the host exposes
+ * more than one on-line node. When greater than 1, the BCB and io page tables are split into equal per-node partitions
+ * and shared LRU lists are assigned to nodes in equal contiguous groups. */
+static int pgbuf_Numa_node_count = 1;
+
+/* clock victim scan mode (data_buffer_clock_victim): victim selection sweeps the bcb table with an atomic hand and
+ * per-bcb second chance bits instead of queueing on the shared lru list mutexes. the lru lists stay authoritative for
+ * zone membership; the hand only claims victim-zone bcbs. */
+static bool pgbuf_Clock_enabled = false;
+static volatile int pgbuf_Clock_hand = 0;
+
+/* warm start (data_buffer_warm_start): the resident page set is dumped periodically (and at shutdown) to a file next
+ * to the database volumes and reloaded with sequential batched reads at the next restart, before connections are
+ * accepted. The path is set by pgbuf_warm_start_restore during boot; while it stays empty the dump is a no-op. */
+static char pgbuf_Warm_start_path[PATH_MAX] = "";
+
+/* non-zero when the io page table is an explicit huge page mapping (data_buffer_hugepages); holds the mapping length
+ * so pgbuf_finalize releases it with munmap instead of free */
+static size_t pgbuf_Iopage_huge_size = 0;
+
+/* compressed cold page tier (data_buffer_compressed_pages): clean victimized pages are kept lz4-compressed in memory
+ * and a later fix decompresses them instead of reading from disk. An entry exists only while its page is not resident
+ * in the buffer pool: it is inserted when the page is victimized and consumed (removed) when the page is fixed again,
+ * so an entry can never go stale behind a modification of the resident copy. */
+#define PGBUF_CTIER_NUM_PARTITIONS 64
+/* slots probed around the home position of a page; collisions beyond this window evict the oldest probed entry */
+#define PGBUF_CTIER_PROBE_DEPTH 8
+
+typedef struct pgbuf_ctier_slot PGBUF_CTIER_SLOT;
+struct pgbuf_ctier_slot
+{
+  VPID vpid;			/* page id; NULL vpid when the slot is free */
+  int size;			/* compressed size */
+  char *data;			/* compressed page, allocated at exactly size bytes */
+};
+
+typedef struct pgbuf_ctier_partition PGBUF_CTIER_PARTITION;
+struct pgbuf_ctier_partition
+{
+  pthread_mutex_t mutex;
+  PGBUF_CTIER_SLOT *slots;
+  char *scratch;		/* compression scratch buffer of LZ4_compressBound (IO_PAGESIZE) bytes */
+  int num_slots;
+  int clock;			/* round robin position for evictions inside a probe window */
+};
+
+static PGBUF_CTIER_PARTITION pgbuf_Ctier[PGBUF_CTIER_NUM_PARTITIONS];
+static bool pgbuf_Ctier_enabled = false;
+
+/* adaptive flush coalescing (data_buffer_adaptive_flush): victim candidates are always sorted in disk order and the
+ * neighbor flush window grows while the device keeps the average per page write latency low and shrinks when the
+ * latency climbs, so slow or saturated devices see small batches and fast ones get large sequential runs. */
+static bool pgbuf_Adaptive_flush_enabled = false;
+static int pgbuf_Adaptive_neighbor_pages = 1;
+
+/* average per page flush latencies (usec) under/over which the adaptive window is widened/narrowed */
+#define PGBUF_ADAPTIVE_FLUSH_FAST_USEC 200
+#define PGBUF_ADAPTIVE_FLUSH_SLOW_USEC 1000
+
 HFID *pgbuf_ordered_null_hfid = NULL;
 
 #if defined(CUBRID_DEBUG)
@@ -927,6 +1005,12 @@ PGBUF_THREAD_HAS_PRIVATE_LRU (THREAD_ENTRY * thread_p)
 #define PGBUF_THREAD_HAS_PRIVATE_LRU(thread_p) false
 #endif
 
+/* NUMA-aware pool partitioning */
+#define PGBUF_NUMA_MAX_NODES 64
+#define PGBUF_NUMA_IS_ENABLED (pgbuf_Numa_node_count > 1)
+#define PGBUF_NUMA_PARTITION_START(node) (((node) * pgbuf_Pool.num_buffers) / pgbuf_Numa_node_count)
+#define PGBUF_NUMA_SHARED_LRU_PER_NODE (PGBUF_SHARED_LRU_COUNT / pgbuf_Numa_node_count)
+
 #define PGBUF_SHARED_LRU_COUNT (pgbuf_Pool.num_LRU_list)
 #define PGBUF_PRIVATE_LRU_COUNT (pgbuf_Pool.quota.num_private_LRU_list)
 #define PGBUF_TOTAL_LRU_COUNT (PGBUF_SHARED_LRU_COUNT + PGBUF_PRIVATE_LRU_COUNT)
@@ -970,6 +1054,21 @@ static int pgbuf_Abort_release_line = 0;
 static INLINE unsigned int pgbuf_hash_func_mirror (const VPID * vpid) __attribute__ ((ALWAYS_INLINE));
 
 static INLINE bool pgbuf_is_temporary_volume (VOLID volid) __attribute__ ((ALWAYS_INLINE));
+#if defined (LINUX) && defined (SERVER_MODE)
+static int pgbuf_numa_detect_node_count (void);
+static void pgbuf_numa_bind_table_partitions (void *table, size_t entry_size);
+STATIC_INLINE int pgbuf_numa_current_node (void) __attribute__ ((ALWAYS_INLINE));
+#endif /* LINUX && SERVER_MODE */
+#if defined (LINUX)
+static void *pgbuf_hugepage_alloc (size_t size, size_t * mapped_size);
+static void pgbuf_bcb_release_memory (PGBUF_BCB * bufptr);
+#endif /* LINUX */
+static int pgbuf_initialize_ctier (void);
+static void pgbuf_finalize_ctier (void);
+static PGBUF_CTIER_PARTITION *pgbuf_ctier_get_partition (const VPID * vpid, int *start_out);
+static void pgbuf_ctier_store (THREAD_ENTRY * thread_p, const VPID * vpid, const FILEIO_PAGE * io_page);
+static bool pgbuf_ctier_fetch (THREAD_ENTRY * thread_p, const VPID * vpid, FILEIO_PAGE * io_page);
+static void pgbuf_ctier_remove (const VPID * vpid);
 static int pgbuf_initialize_bcb_table (void);
 static int pgbuf_initialize_hash_table (void);
 static int pgbuf_initialize_lock_table (void);
@@ -992,6 +1091,9 @@ STATIC_INLINE int pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_B
 static void pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int thread_private_lru_index);
 STATIC_INLINE bool pgbuf_should_move_private_to_shared (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb,
 							int thread_private_lru_index) __attribute__ ((ALWAYS_INLINE));
+#if defined(SERVER_MODE)
+STATIC_INLINE bool pgbuf_is_utility_thread (const THREAD_ENTRY * thread_p) __attribute__ ((ALWAYS_INLINE));
+#endif /* SERVER_MODE */
 static int pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE request_mode,
 			    int request_fcnt, bool as_promote);
 STATIC_INLINE int pgbuf_latch_bcb_upon_fix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE request_mode,
@@ -1023,6 +1125,7 @@ STATIC_INLINE int pgbuf_get_shared_lru_index_for_add (void) __attribute__ ((ALWA
 static int pgbuf_get_victim_candidates_from_lru (THREAD_ENTRY * thread_p, int check_count,
 						 float lru_sum_flush_priority, bool * assigned_directly);
 static PGBUF_BCB *pgbuf_get_victim (THREAD_ENTRY * thread_p);
+static PGBUF_BCB *pgbuf_get_clock_victim (THREAD_ENTRY * thread_p);
 static PGBUF_BCB *pgbuf_get_victim_from_lru_list (THREAD_ENTRY * thread_p, const int lru_idx);
 #if defined (SERVER_MODE)
 static int pgbuf_panic_assign_direct_victims_from_lru (THREAD_ENTRY * thread_p, PGBUF_LRU_LIST * lru_list,
@@ -1166,6 +1269,7 @@ STATIC_INLINE PGBUF_ZONE pgbuf_bcb_get_zone (const PGBUF_BCB * bcb) __attribute_
 STATIC_INLINE int pgbuf_bcb_get_lru_index (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_bcb_get_pool_index (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_dirty (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE bool pgbuf_bcb_is_retired (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_mark_is_flushing (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_flushing (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
@@ -1220,6 +1324,11 @@ static cubthread::daemon *pgbuf_Page_maintenance_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_post_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Flush_control_daemon = NULL;
+static cubthread::daemon *pgbuf_Page_readahead_daemon = NULL;
+
+/* capacity of the read-ahead request queue; a full queue simply drops further hints */
+#define PGBUF_READAHEAD_QUEUE_CAPACITY 1024
+static lockfree::circular_queue<VPID> *pgbuf_Readahead_queue = NULL;
 // *INDENT-ON*
 #endif /* SERVER_MODE */
 
@@ -1383,6 +1492,19 @@ pgbuf_initialize (void)
       goto error;
     }
 
+  pgbuf_Clock_enabled = prm_get_bool_value (PRM_ID_PB_CLOCK_VICTIM);
+  pgbuf_Clock_hand = 0;
+
+  pgbuf_Adaptive_flush_enabled = prm_get_bool_value (PRM_ID_PB_ADAPTIVE_FLUSH);
+  pgbuf_Adaptive_neighbor_pages = prm_get_integer_value (PRM_ID_PB_NEIGHBOR_FLUSH_PAGES);
+  pgbuf_Adaptive_neighbor_pages = MAX (pgbuf_Adaptive_neighbor_pages, 1);
+  pgbuf_Adaptive_neighbor_pages = MIN (pgbuf_Adaptive_neighbor_pages, PGBUF_MAX_NEIGHBOR_PAGES);
+
+  if (pgbuf_initialize_ctier () != NO_ERROR)
+    {
+      goto error;
+    }
+
   /* keep page quota initializer first */
   if (pgbuf_initialize_page_quota () != NO_ERROR)
     {
@@ -1567,7 +1689,18 @@ pgbuf_finalize (void)
 
   if (pgbuf_Pool.iopage_table != NULL)
     {
-      free_and_init (pgbuf_Pool.iopage_table);
+#if defined (LINUX)
+      if (pgbuf_Iopage_huge_size > 0)
+	{
+	  munmap (pgbuf_Pool.iopage_table, pgbuf_Iopage_huge_size);
+	  pgbuf_Pool.iopage_table = NULL;
+	  pgbuf_Iopage_huge_size = 0;
+	}
+      else
+#endif /* LINUX */
+	{
+	  free_and_init (pgbuf_Pool.iopage_table);
+	}
     }
 
   /* final task for LRU list */
@@ -1608,6 +1741,8 @@ pgbuf_finalize (void)
       free_and_init (pgbuf_Pool.victim_cand_list);
     }
 
+  pgbuf_finalize_ctier ();
+
   if (pgbuf_Pool.buf_AOUT_list.bufarray != NULL)
     {
       free_and_init (pgbuf_Pool.buf_AOUT_list.bufarray);
@@ -1754,6 +1889,388 @@ pgbuf_fix_with_retry (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MOD
   return pgptr;
 }
 
+/*
+ * pgbuf_prefetch_range () - Start reading a set of pages ahead of a scan position.
+ *   return: NO_ERROR
+ *   thread_p (in) : thread entry
+ *   vpids (in)    : array of pages, expected mostly sorted
+ *   count (in)    : number of pages
+ *
+ * Note: no page is returned to the caller; the physical reads are only overlapped with the consumer so that a later
+ *	 pgbuf_fix of the same pages does not stall on disk latency. On a server the range is handed to the page
+ *	 read-ahead daemon, which materializes the pages in the buffer pool on its own thread; otherwise contiguous
+ *	 runs on the same volume are coalesced into an OS advise call. Failures are ignored; the scan then reads
+ *	 synchronously as before.
+ */
+int
+pgbuf_prefetch_range (THREAD_ENTRY * thread_p, const VPID * vpids, int count)
+{
+  int i, run_end;
+  int vol_fd;
+
+#if defined (SERVER_MODE)
+  if (pgbuf_Page_readahead_daemon != NULL && pgbuf_Readahead_queue != NULL)
+    {
+      /* hand the range to the read-ahead daemon, which performs the reads and fills buffer frames on its own thread
+       * while the scan consumes the pages already resident */
+      bool queued = false;
+
+      for (i = 0; i < count; i++)
+	{
+	  if (!pgbuf_Readahead_queue->produce (vpids[i]))
+	    {
+	      /* queue full; the remaining hints are simply dropped */
+	      break;
+	    }
+	  queued = true;
+	}
+
+      if (queued)
+	{
+	  pgbuf_Page_readahead_daemon->wakeup ();
+	}
+
+      return NO_ERROR;
+    }
+#endif /* SERVER_MODE */
+
+  for (i = 0; i < count; i = run_end)
+    {
+      run_end = i + 1;
+      while (run_end < count && vpids[run_end].volid == vpids[i].volid
+	     && vpids[run_end].pageid == vpids[run_end - 1].pageid + 1)
+	{
+	  run_end++;
+	}
+
+      vol_fd = fileio_get_volume_descriptor (vpids[i].volid);
+      if (vol_fd == NULL_VOLDES)
+	{
+	  continue;
+	}
+
+      (void) fileio_prefetch_pages (thread_p, vol_fd, vpids[i].pageid, run_end - i);
+    }
+
+  return NO_ERROR;
+}
+
+/* suffix appended to the database full name to build the warm start file path */
+#define PGBUF_WARM_START_SUFFIX "_bpwarm"
+/* minimum seconds between two periodic warm start dumps */
+#define PGBUF_WARM_START_DUMP_INTERVAL 300
+
+/*
+ * pgbuf_warm_start_compare_vpid () - compare two VPID's in disk order, for qsort
+ *   return: < 0, 0 or > 0
+ */
+static int
+pgbuf_warm_start_compare_vpid (const void *a, const void *b)
+{
+  const VPID *vpid_a = (const VPID *) a;
+  const VPID *vpid_b = (const VPID *) b;
+
+  if (vpid_a->volid != vpid_b->volid)
+    {
+      return vpid_a->volid - vpid_b->volid;
+    }
+  return (vpid_a->pageid < vpid_b->pageid) ? -1 : ((vpid_a->pageid > vpid_b->pageid) ? 1 : 0);
+}
+
+/*
+ * pgbuf_warm_start_restore () - reload the page set saved by the last warm start dump into the buffer pool
+ *   return: NO_ERROR, or ER_OUT_OF_VIRTUAL_MEMORY
+ *   thread_p (in)     : thread entry
+ *   db_full_name (in) : database full name; the warm start file lives next to the first volume
+ *
+ * Note: called once from boot, after recovery and before the server accepts connections. The saved page ids are
+ *	 sorted in disk order and read back in large sequential batches; pages deallocated since the dump are simply
+ *	 skipped. When data_buffer_warm_start is disabled this is a no-op and periodic dumps stay disabled too.
+ */
+int
+pgbuf_warm_start_restore (THREAD_ENTRY * thread_p, const char *db_full_name)
+{
+  FILE *fp;
+  VPID *vpids = NULL;
+  PAGE_PTR pgptr;
+  int count = 0;
+  int n, i;
+
+  if (!prm_get_bool_value (PRM_ID_PB_WARM_START))
+    {
+      return NO_ERROR;
+    }
+
+  snprintf (pgbuf_Warm_start_path, sizeof (pgbuf_Warm_start_path), "%s%s", db_full_name, PGBUF_WARM_START_SUFFIX);
+
+  fp = fopen (pgbuf_Warm_start_path, "rb");
+  if (fp == NULL)
+    {
+      /* first start with the feature enabled, or the file was removed; nothing to reload */
+      return NO_ERROR;
+    }
+
+  if (fread (&count, sizeof (count), 1, fp) != 1 || count <= 0 || count > pgbuf_Pool.num_buffers)
+    {
+      fclose (fp);
+      return NO_ERROR;
+    }
+
+  vpids = (VPID *) malloc (count * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) count * sizeof (VPID));
+      fclose (fp);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  n = (int) fread (vpids, sizeof (VPID), count, fp);
+  fclose (fp);
+
+  /* disk order turns the reload into large sequential reads */
+  qsort (vpids, n, sizeof (VPID), pgbuf_warm_start_compare_vpid);
+  (void) pgbuf_prefetch_range (thread_p, vpids, n);
+
+  for (i = 0; i < n; i++)
+    {
+      pgptr = pgbuf_fix (thread_p, &vpids[i], OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+      if (pgptr == NULL)
+	{
+	  /* the page or its volume may be gone since the dump; skip it */
+	  er_clear ();
+	  continue;
+	}
+      pgbuf_unfix (thread_p, pgptr);
+    }
+
+  free_and_init (vpids);
+
+  return NO_ERROR;
+}
+
+/*
+ * pgbuf_warm_start_dump () - save the set of pages currently resident in the buffer pool to the warm start file
+ *   return: NO_ERROR
+ *   thread_p (in) : thread entry
+ *   force (in)    : true to dump regardless of the periodic interval (shutdown), false for periodic calls
+ *
+ * Note: the bcb table is scanned without latches; the dump is only a hint and a page id that is concurrently replaced
+ *	 costs at most one wasted read at restart. The file is written to a temporary name and renamed, so a crash
+ *	 during the dump leaves the previous dump intact. Best effort: file system errors are silently ignored.
+ */
+int
+pgbuf_warm_start_dump (THREAD_ENTRY * thread_p, bool force)
+{
+  FILE *fp;
+  VPID *vpids = NULL;
+  VPID vpid;
+  char tmp_path[PATH_MAX];
+  int bufid;
+  int count = 0;
+  static time_t last_dump_time = 0;
+  time_t now;
+
+  if (pgbuf_Warm_start_path[0] == '\0')
+    {
+      return NO_ERROR;
+    }
+
+  now = time (NULL);
+  if (!force && now - last_dump_time < PGBUF_WARM_START_DUMP_INTERVAL)
+    {
+      return NO_ERROR;
+    }
+  last_dump_time = now;
+
+  vpids = (VPID *) malloc (pgbuf_Pool.num_buffers * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) pgbuf_Pool.num_buffers * sizeof (VPID));
+      return NO_ERROR;
+    }
+
+  for (bufid = 0; bufid < pgbuf_Pool.num_buffers; bufid++)
+    {
+      vpid = PGBUF_FIND_BCB_PTR (bufid)->vpid;
+      if (!VPID_ISNULL (&vpid))
+	{
+	  vpids[count++] = vpid;
+	}
+    }
+
+  snprintf (tmp_path, sizeof (tmp_path), "%s_tmp", pgbuf_Warm_start_path);
+  fp = fopen (tmp_path, "wb");
+  if (fp != NULL)
+    {
+      if (fwrite (&count, sizeof (count), 1, fp) == 1 && (int) fwrite (vpids, sizeof (VPID), count, fp) == count)
+	{
+	  fclose (fp);
+	  (void) os_rename_file (tmp_path, pgbuf_Warm_start_path);
+	}
+      else
+	{
+	  fclose (fp);
+	}
+    }
+
+  free_and_init (vpids);
+
+  return NO_ERROR;
+}
+
+/*
+ * pgbuf_adjust_active_pages () - apply data_buffer_active_pages: grow or shrink the usable buffer set online
+ *   return: NO_ERROR
+ *   thread_p (in) : thread entry (may be NULL)
+ *
+ * Note: called when data_buffer_active_pages is changed through SET SYSTEM PARAMETERS. A shrink retires the buffers
+ *	 with the highest pool indexes: each one is flushed if dirty, detached from its lru list and the hash table,
+ *	 marked retired so that no allocation or victimization path can reach it, and its io page memory is returned
+ *	 to the operating system. Fixed or unflushable buffers are skipped; the shrink is best effort and can simply
+ *	 be run again. A grow clears the retired mark and hands the buffers back to the free list; their memory is
+ *	 faulted back in on first use. The bcb and io page tables always keep their boot time size, so the configured
+ *	 data_buffer_size stays the upper bound.
+ */
+int
+pgbuf_adjust_active_pages (THREAD_ENTRY * thread_p)
+{
+  PGBUF_BCB *bufptr;
+  PGBUF_BCB *keep_head = NULL;
+  VPID temp_vpid;
+  int target;
+  int bufid;
+  int count_retired = 0;
+  int count_restored = 0;
+
+  if (pgbuf_Pool.num_buffers <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  target = prm_get_integer_value (PRM_ID_PB_ACTIVE_PAGES);
+  if (target <= 0 || target > pgbuf_Pool.num_buffers)
+    {
+      target = pgbuf_Pool.num_buffers;
+    }
+  target = MAX (target, PGBUF_MINIMUM_BUFFERS);
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  /* grow: clear the retired mark below the target and hand those buffers back to the free list */
+  for (bufid = 0; bufid < target; bufid++)
+    {
+      bufptr = PGBUF_FIND_BCB_PTR (bufid);
+      if (!pgbuf_bcb_is_retired (bufptr))
+	{
+	  continue;
+	}
+      PGBUF_BCB_LOCK (bufptr);
+      if (!pgbuf_bcb_is_retired (bufptr))
+	{
+	  PGBUF_BCB_UNLOCK (bufptr);
+	  continue;
+	}
+      pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_RETIRED_FLAG);
+      /* releases the bcb mutex */
+      (void) pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+      count_restored++;
+    }
+
+  if (target < pgbuf_Pool.num_buffers)
+    {
+      /* drain the free list, so never used buffers beyond the target are retired too; the others are put back */
+      while ((bufptr = pgbuf_get_bcb_from_invalid_list (thread_p)) != NULL)
+	{
+	  /* the bcb is returned locked, in void zone and linked on no list */
+	  if (pgbuf_bcb_get_pool_index (bufptr) >= target)
+	    {
+	      pgbuf_bcb_update_flags (thread_p, bufptr, PGBUF_BCB_RETIRED_FLAG, 0);
+	      PGBUF_BCB_UNLOCK (bufptr);
+#if defined (LINUX)
+	      pgbuf_bcb_release_memory (bufptr);
+#endif /* LINUX */
+	      count_retired++;
+	    }
+	  else
+	    {
+	      bufptr->next_BCB = keep_head;
+	      keep_head = bufptr;
+	      PGBUF_BCB_UNLOCK (bufptr);
+	    }
+	}
+      while (keep_head != NULL)
+	{
+	  bufptr = keep_head;
+	  keep_head = bufptr->next_BCB;
+	  PGBUF_BCB_LOCK (bufptr);
+	  bufptr->next_BCB = NULL;
+	  /* releases the bcb mutex */
+	  (void) pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+	}
+
+      /* retire the resident buffers in the tail range */
+      for (bufid = target; bufid < pgbuf_Pool.num_buffers; bufid++)
+	{
+	  bufptr = PGBUF_FIND_BCB_PTR (bufid);
+	  if (pgbuf_bcb_is_retired (bufptr) || pgbuf_bcb_get_zone (bufptr) == PGBUF_INVALID_ZONE)
+	    {
+	      continue;
+	    }
+	  PGBUF_BCB_LOCK (bufptr);
+	  if (pgbuf_bcb_is_retired (bufptr) || pgbuf_bcb_get_zone (bufptr) == PGBUF_INVALID_ZONE || bufptr->fcnt > 0
+	      || bufptr->latch_mode != PGBUF_NO_LATCH || pgbuf_bcb_is_direct_victim (bufptr)
+	      || pgbuf_bcb_avoid_victim (bufptr))
+	    {
+	      PGBUF_BCB_UNLOCK (bufptr);
+	      continue;
+	    }
+	  if (pgbuf_bcb_is_dirty (bufptr))
+	    {
+	      temp_vpid = bufptr->vpid;
+	      if (pgbuf_bcb_safe_flush_force_lock (thread_p, bufptr, true) != NO_ERROR)
+		{
+		  /* the bcb mutex is released on failure */
+		  continue;
+		}
+	      if (!VPID_EQ (&temp_vpid, &bufptr->vpid) || bufptr->fcnt > 0 || bufptr->latch_mode != PGBUF_NO_LATCH)
+		{
+		  PGBUF_BCB_UNLOCK (bufptr);
+		  continue;
+		}
+	    }
+	  if (PGBUF_IS_BCB_IN_LRU (bufptr))
+	    {
+	      pgbuf_lru_remove_bcb (thread_p, bufptr);
+	    }
+	  if (!VPID_ISNULL (&bufptr->vpid))
+	    {
+	      if (pgbuf_delete_from_hash_chain (thread_p, bufptr) != NO_ERROR)
+		{
+		  /* the bcb mutex is not held on failure */
+		  continue;
+		}
+	    }
+	  bufptr->latch_mode = PGBUF_LATCH_INVALID;
+	  LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
+	  pgbuf_bcb_update_flags (thread_p, bufptr, PGBUF_BCB_RETIRED_FLAG, 0);
+	  PGBUF_BCB_UNLOCK (bufptr);
+#if defined (LINUX)
+	  pgbuf_bcb_release_memory (bufptr);
+#endif /* LINUX */
+	  count_retired++;
+	}
+    }
+
+  er_log_debug (ARG_FILE_LINE, "pgbuf_adjust_active_pages: target = %d, retired %d and restored %d buffers", target,
+		count_retired, count_restored);
+
+  return NO_ERROR;
+}
+
 /*
  * below two functions are dummies for Windows build
  * (which defined at cubridsa.def)
@@ -1948,6 +2465,11 @@ try_again:
 
   pgbuf_bcb_register_fix (bufptr);
 
+  if (pgbuf_Clock_enabled && (bufptr->flags & PGBUF_BCB_CLOCK_REF_FLAG) == 0)
+    {
+      pgbuf_bcb_update_flags (thread_p, bufptr, PGBUF_BCB_CLOCK_REF_FLAG, 0);
+    }
+
   /* Set Page identifier if needed */
   // Redo recovery may find an immature page which should be set.
   pgbuf_set_bcb_page_vpid (bufptr);
@@ -2174,6 +2696,7 @@ try_again:
 	{
 	  perfmon_pbx_fix_acquire_time (thread_p, perf.perf_page_type, perf.perf_page_found, perf.perf_latch_mode,
 					perf.perf_cond_type, perf.fix_wait_time);
+	  perfmon_time_histogram (thread_p, PSTAT_PB_FIX_TIME_HISTOGRAM, perf.fix_wait_time);
 	}
     }
 
@@ -3269,6 +3792,9 @@ pgbuf_flush_victim_candidates (THREAD_ENTRY * thread_p, float flush_ratio, PERF_
   UINT64 num_skipped_need_wal = 0;
   UINT64 num_skipped_flush = 0;
 
+  TSC_TICKS flush_start_tick, flush_end_tick;
+  UINT64 flush_usec;
+
   bool logging = prm_get_bool_value (PRM_ID_LOG_PGBUF_VICTIM_FLUSH);
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_FLUSH_VICTIM_STARTED, 0);
@@ -3369,8 +3895,9 @@ pgbuf_flush_victim_candidates (THREAD_ENTRY * thread_p, float flush_ratio, PERF_
       logpb_force_flush_pages (thread_p);
     }
 
-  if (prm_get_bool_value (PRM_ID_PB_SEQUENTIAL_VICTIM_FLUSH) == true)
+  if (sysprm_get_hot_params ()->pb_sequential_victim_flush == true || pgbuf_Adaptive_flush_enabled)
     {
+      /* disk order maximizes the adjacent runs the neighbor flush can merge into sequential writes */
       qsort ((void *) victim_cand_list, victim_count, sizeof (PGBUF_VICTIM_CANDIDATE_LIST), pgbuf_compare_victim_list);
     }
 
@@ -3398,6 +3925,7 @@ pgbuf_flush_victim_candidates (THREAD_ENTRY * thread_p, float flush_ratio, PERF_
 repeat:
 #endif
   count_need_wal = 0;
+  tsc_getticks (&flush_start_tick);
 
   /* temporary disable second iteration */
   /* for each victim candidate, do flush task */
@@ -3471,6 +3999,29 @@ repeat:
       total_flushed_count += flushed_pages;
     }
 
+  if (pgbuf_Adaptive_flush_enabled && total_flushed_count > 0)
+    {
+      /* adapt the neighbor window to the observed device latency: keep widening it while the average per page write
+       * stays cheap, back off quickly once the device is saturated. */
+      tsc_getticks (&flush_end_tick);
+      flush_usec = tsc_elapsed_utime (flush_end_tick, flush_start_tick);
+      flush_usec = flush_usec / (UINT64) total_flushed_count;
+
+      if (flush_usec <= PGBUF_ADAPTIVE_FLUSH_FAST_USEC && pgbuf_Adaptive_neighbor_pages < PGBUF_MAX_NEIGHBOR_PAGES)
+	{
+	  pgbuf_Adaptive_neighbor_pages = MIN (pgbuf_Adaptive_neighbor_pages * 2, PGBUF_MAX_NEIGHBOR_PAGES);
+	}
+      else if (flush_usec >= PGBUF_ADAPTIVE_FLUSH_SLOW_USEC && pgbuf_Adaptive_neighbor_pages > 1)
+	{
+	  pgbuf_Adaptive_neighbor_pages = MAX (pgbuf_Adaptive_neighbor_pages / 2, 1);
+	}
+      if (logging)
+	{
+	  _er_log_debug (ARG_FILE_LINE, "pgbuf_flush_victim_candidates: %llu usec/page, neighbor window = %d\n",
+			 (unsigned long long) flush_usec, pgbuf_Adaptive_neighbor_pages);
+	}
+    }
+
   num_skipped_flush = num_skipped_need_wal + num_skipped_fixed_or_hot + num_skipped_already_flushed;
   if (perf_tracker->is_perf_tracking)
     {
@@ -4824,7 +5375,7 @@ pgbuf_set_bcb_page_vpid (PGBUF_BCB * bufptr)
 	  bufptr->iopage_buffer->iopage.prv.volid = bufptr->vpid.volid;
 
 	  bufptr->iopage_buffer->iopage.prv.ptype = PAGE_UNKNOWN;
-	  bufptr->iopage_buffer->iopage.prv.p_reserve_1 = 0;
+	  bufptr->iopage_buffer->iopage.prv.checksum = 0;
 	  bufptr->iopage_buffer->iopage.prv.p_reserve_2 = 0;
 	  bufptr->iopage_buffer->iopage.prv.tde_nonce = 0;
 	}
@@ -4918,6 +5469,141 @@ pgbuf_is_temporary_volume (VOLID volid)
   return (LOG_DBFIRST_VOLID <= volid && xdisk_get_purpose (NULL, volid) == DB_TEMPORARY_DATA_PURPOSE);
 }
 
+#if defined (LINUX) && defined (SERVER_MODE)
+/* memory policy mode for mbind(); defined locally to avoid a build dependency on libnuma headers */
+#define PGBUF_MPOL_PREFERRED 1
+
+/*
+ * pgbuf_numa_detect_node_count () - Number of on-line NUMA nodes exposed by the kernel
+ *   return: node count; 1 when the topology cannot be read
+ */
+static int
+pgbuf_numa_detect_node_count (void)
+{
+  char path[64];
+  int node;
+
+  for (node = 0; node < PGBUF_NUMA_MAX_NODES; node++)
+    {
+      snprintf (path, sizeof (path), "/sys/devices/system/node/node%d", node);
+      if (access (path, F_OK) != 0)
+	{
+	  break;
+	}
+    }
+
+  return MAX (node, 1);
+}
+
+/*
+ * pgbuf_numa_bind_table_partitions () - Bind equal slices of a per-buffer table to each NUMA node, so that the BCB and
+ *					 the io page of a given buffer index live on the node owning its partition
+ *   table (in)      : start of the table (one entry per buffer)
+ *   entry_size (in) : size of one table entry
+ */
+static void
+pgbuf_numa_bind_table_partitions (void *table, size_t entry_size)
+{
+  size_t page_size = (size_t) sysconf (_SC_PAGESIZE);
+  int node;
+
+  for (node = 0; node < pgbuf_Numa_node_count; node++)
+    {
+      char *start = (char *) table + ((size_t) PGBUF_NUMA_PARTITION_START (node)) * entry_size;
+      char *end = (char *) table + ((size_t) PGBUF_NUMA_PARTITION_START (node + 1)) * entry_size;
+      unsigned long node_mask = 1UL << node;
+
+      /* mbind requires page-aligned addresses; partition borders sharing a page may bind to either side */
+      start = (char *) (((uintptr_t) start + page_size - 1) & ~(page_size - 1));
+      end = (char *) ((uintptr_t) end & ~(page_size - 1));
+      if (start >= end)
+	{
+	  continue;
+	}
+
+      if (syscall (SYS_mbind, start, (unsigned long) (end - start), PGBUF_MPOL_PREFERRED, &node_mask,
+		   (unsigned long) (8 * sizeof (node_mask)), 0UL) != 0)
+	{
+	  er_log_debug (ARG_FILE_LINE, "pgbuf_numa_bind_table_partitions: mbind to node %d failed (errno = %d)",
+			node, errno);
+	}
+    }
+}
+
+/*
+ * pgbuf_numa_current_node () - NUMA node the calling thread is currently running on
+ *   return: node index, clamped to the detected node count
+ */
+STATIC_INLINE int
+pgbuf_numa_current_node (void)
+{
+  unsigned int cpu, node;
+
+  if (syscall (SYS_getcpu, &cpu, &node, NULL) != 0)
+    {
+      return 0;
+    }
+
+  return (int) node % pgbuf_Numa_node_count;
+}
+#endif /* LINUX && SERVER_MODE */
+
+#if defined (LINUX)
+/* explicit huge page size used for the io page table (data_buffer_hugepages) */
+#define PGBUF_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+/*
+ * pgbuf_hugepage_alloc () - Map an anonymous region backed by explicit 2MB huge pages
+ *   return: mapped address or NULL when huge pages are unavailable
+ *   size(in): requested size; rounded up to a huge page multiple
+ *   mapped_size(out): actual mapping length, needed later for munmap
+ */
+static void *
+pgbuf_hugepage_alloc (size_t size, size_t * mapped_size)
+{
+#if defined (MAP_HUGETLB)
+  void *addr;
+  size_t huge_size = ((size + PGBUF_HUGE_PAGE_SIZE - 1) / PGBUF_HUGE_PAGE_SIZE) * PGBUF_HUGE_PAGE_SIZE;
+
+  addr = mmap (NULL, huge_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (addr == MAP_FAILED)
+    {
+      /* not enough huge pages reserved (vm.nr_hugepages); the caller falls back to a normal allocation */
+      er_log_debug (ARG_FILE_LINE, "pgbuf_hugepage_alloc: mmap of %zu bytes with MAP_HUGETLB failed (errno = %d)",
+		    huge_size, errno);
+      return NULL;
+    }
+
+  *mapped_size = huge_size;
+  return addr;
+#else /* !MAP_HUGETLB */
+  return NULL;
+#endif /* !MAP_HUGETLB */
+}
+
+/*
+ * pgbuf_bcb_release_memory () - Return the io page memory of a retired bcb to the operating system
+ *   bufptr(in): retired bcb
+ *
+ * Note: only the os pages fully covered by the io page buffer can be released; for the usual io page sizes that is
+ *	 almost the entire buffer. The memory is faulted back in (zeroed) when the bcb is reactivated and reused.
+ */
+static void
+pgbuf_bcb_release_memory (PGBUF_BCB * bufptr)
+{
+  size_t os_page_size = (size_t) sysconf (_SC_PAGESIZE);
+  uintptr_t start = (uintptr_t) bufptr->iopage_buffer;
+  uintptr_t end = start + PGBUF_IOPAGE_BUFFER_SIZE;
+
+  start = (start + os_page_size - 1) & ~(os_page_size - 1);
+  end = end & ~(os_page_size - 1);
+  if (end > start)
+    {
+      (void) madvise ((void *) start, (size_t) (end - start), MADV_DONTNEED);
+    }
+}
+#endif /* LINUX */
+
 /*
  * pgbuf_init_BCB_table () - Initializes page buffer BCB table
  *   return: NO_ERROR, or ER_code
@@ -4930,6 +5616,19 @@ pgbuf_initialize_bcb_table (void)
   int i;
   long long unsigned alloc_size;
 
+  pgbuf_Numa_node_count = 1;
+#if defined (LINUX) && defined (SERVER_MODE)
+  if (prm_get_bool_value (PRM_ID_PB_NUMA_AWARE))
+    {
+      pgbuf_Numa_node_count = pgbuf_numa_detect_node_count ();
+      if (pgbuf_Numa_node_count > 1)
+	{
+	  er_log_debug (ARG_FILE_LINE, "pgbuf_initialize_bcb_table: partitioning %d buffers across %d NUMA nodes",
+			pgbuf_Pool.num_buffers, pgbuf_Numa_node_count);
+	}
+    }
+#endif /* LINUX && SERVER_MODE */
+
   /* allocate space for page buffer BCB table */
   alloc_size = (long long unsigned) pgbuf_Pool.num_buffers * PGBUF_BCB_SIZEOF;
   if (!MEM_SIZE_IS_VALID (alloc_size))
@@ -4955,7 +5654,19 @@ pgbuf_initialize_bcb_table (void)
 	}
       return ER_PRM_BAD_VALUE;
     }
-  pgbuf_Pool.iopage_table = (PGBUF_IOPAGE_BUFFER *) malloc ((size_t) alloc_size);
+  pgbuf_Pool.iopage_table = NULL;
+  pgbuf_Iopage_huge_size = 0;
+#if defined (LINUX)
+  if (prm_get_bool_value (PRM_ID_PB_HUGEPAGES))
+    {
+      pgbuf_Pool.iopage_table =
+	(PGBUF_IOPAGE_BUFFER *) pgbuf_hugepage_alloc ((size_t) alloc_size, &pgbuf_Iopage_huge_size);
+    }
+#endif /* LINUX */
+  if (pgbuf_Pool.iopage_table == NULL)
+    {
+      pgbuf_Pool.iopage_table = (PGBUF_IOPAGE_BUFFER *) malloc ((size_t) alloc_size);
+    }
   if (pgbuf_Pool.iopage_table == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) alloc_size);
@@ -4966,6 +5677,14 @@ pgbuf_initialize_bcb_table (void)
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
 
+#if defined (LINUX) && defined (SERVER_MODE)
+  if (PGBUF_NUMA_IS_ENABLED)
+    {
+      pgbuf_numa_bind_table_partitions (pgbuf_Pool.BCB_table, (size_t) PGBUF_BCB_SIZEOF);
+      pgbuf_numa_bind_table_partitions (pgbuf_Pool.iopage_table, (size_t) PGBUF_IOPAGE_BUFFER_SIZE);
+    }
+#endif /* LINUX && SERVER_MODE */
+
   /* initialize each entry of the buffer BCB table */
   for (i = 0; i < pgbuf_Pool.num_buffers; i++)
     {
@@ -5013,7 +5732,7 @@ pgbuf_initialize_bcb_table (void)
 
       ioptr->iopage.prv.ptype = (unsigned char) PAGE_UNKNOWN;
       ioptr->iopage.prv.pflag = '\0';
-      ioptr->iopage.prv.p_reserve_1 = 0;
+      ioptr->iopage.prv.checksum = 0;
       ioptr->iopage.prv.p_reserve_2 = 0;
       ioptr->iopage.prv.tde_nonce = 0;
 
@@ -5125,6 +5844,13 @@ pgbuf_initialize_lru_list (void)
       pgbuf_Pool.num_LRU_list = MAX (pgbuf_Pool.num_LRU_list, 4);
     }
 
+  if (PGBUF_NUMA_IS_ENABLED)
+    {
+      /* keep an equal number of shared lists on each node partition */
+      pgbuf_Pool.num_LRU_list =
+	((pgbuf_Pool.num_LRU_list + pgbuf_Numa_node_count - 1) / pgbuf_Numa_node_count) * pgbuf_Numa_node_count;
+    }
+
   /* allocate memory space for the page buffer LRU lists */
   pgbuf_Pool.buf_LRU_list = (PGBUF_LRU_LIST *) malloc (PGBUF_TOTAL_LRU_COUNT * PGBUF_LRU_LIST_SIZEOF);
   if (pgbuf_Pool.buf_LRU_list == NULL)
@@ -6398,6 +7124,22 @@ pgbuf_should_move_private_to_shared (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, i
   return true;
 }
 
+#if defined(SERVER_MODE)
+/*
+ * pgbuf_is_utility_thread () - Does the thread belong to the low priority latch class?
+ *   return: true for utility threads (vacuum, daemons), false for transaction workers
+ *   thread_p(in): thread entry
+ *
+ * Note: Transaction workers serve client requests and their latch waits are latency critical; everything else runs in
+ *	 the background and can afford to queue behind them.
+ */
+STATIC_INLINE bool
+pgbuf_is_utility_thread (const THREAD_ENTRY * thread_p)
+{
+  return thread_p->type != TT_WORKER;
+}
+#endif /* SERVER_MODE */
+
 /*
  * pgbuf_block_bcb () - Adds it on the BCB waiting queue and block thread
  *   return: NO_ERROR, or ER_code
@@ -6406,7 +7148,10 @@ pgbuf_should_move_private_to_shared (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, i
  *   request_fcnt(in):
  *   as_promote(in): if true, will wait as first promoter
  *
- * Note: Promoter will be the first waiter. Others will be appended to waiting queue.
+ * Note: Promoter will be the first waiter. Transaction workers are queued ahead of utility threads (vacuum, daemons),
+ *	 FIFO within each class, so a background job cannot convoy a hot page against latency-critical transactions.
+ *	 Reordering is safe: waiters still use the timed sleep protocol, so none of them can be starved past the
+ *	 deadlock timeout.
  */
 static int
 pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE request_mode, int request_fcnt,
@@ -6414,6 +7159,9 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
 {
 #if defined(SERVER_MODE)
   THREAD_ENTRY *cur_thrd_entry, *thrd_entry;
+  TSC_TICKS start_tick, end_tick;
+  UINT64 latch_wait_time;
+  bool is_perf_tracking;
 
   /* caller is holding bufptr->mutex */
   /* request_mode == PGBUF_LATCH_READ/PGBUF_LATCH_WRITE/PGBUF_LATCH_FLUSH */
@@ -6441,21 +7189,51 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
     }
   else
     {
-      /* append cur_thrd_entry to the BCB waiting queue */
-      cur_thrd_entry->next_wait_thrd = NULL;
+      /* insert cur_thrd_entry into the BCB waiting queue by priority class */
+      THREAD_ENTRY *prev_thrd_entry = NULL;
+
       thrd_entry = bufptr->next_wait_thrd;
-      if (thrd_entry == NULL)
+      if (thrd_entry != NULL && thrd_entry->wait_for_latch_promote)
 	{
-	  bufptr->next_wait_thrd = cur_thrd_entry;
+	  /* the promoter always stays first */
+	  prev_thrd_entry = thrd_entry;
+	  thrd_entry = thrd_entry->next_wait_thrd;
+	}
+
+      if (pgbuf_is_utility_thread (cur_thrd_entry))
+	{
+	  /* low priority: append at the end of the queue */
+	  while (thrd_entry != NULL)
+	    {
+	      prev_thrd_entry = thrd_entry;
+	      thrd_entry = thrd_entry->next_wait_thrd;
+	    }
 	}
       else
 	{
-	  while (thrd_entry->next_wait_thrd != NULL)
+	  /* high priority: overtake the utility waiters, but keep FIFO order towards other transaction workers */
+	  while (thrd_entry != NULL && !pgbuf_is_utility_thread (thrd_entry))
 	    {
+	      prev_thrd_entry = thrd_entry;
 	      thrd_entry = thrd_entry->next_wait_thrd;
 	    }
-	  thrd_entry->next_wait_thrd = cur_thrd_entry;
 	}
+
+      cur_thrd_entry->next_wait_thrd = thrd_entry;
+      if (prev_thrd_entry == NULL)
+	{
+	  bufptr->next_wait_thrd = cur_thrd_entry;
+	}
+      else
+	{
+	  prev_thrd_entry->next_wait_thrd = cur_thrd_entry;
+	}
+    }
+
+  is_perf_tracking = perfmon_is_perf_tracking ();
+  if (is_perf_tracking)
+    {
+      tsc_getticks (&start_tick);
     }
 
   if (request_mode == PGBUF_LATCH_FLUSH)
@@ -6517,6 +7295,15 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
       assert (0 < bufptr->fcnt);
 #endif
     }
+
+  if (is_perf_tracking)
+    {
+      tsc_getticks (&end_tick);
+      latch_wait_time = tsc_elapsed_utime (end_tick, start_tick);
+      perfmon_add_stat (thread_p,
+			pgbuf_is_utility_thread (cur_thrd_entry) ? PSTAT_PB_TIME_LATCH_WAIT_UTILITY
+			: PSTAT_PB_TIME_LATCH_WAIT_TRAN, latch_wait_time);
+    }
 #endif /* SERVER_MODE */
 
   return NO_ERROR;
@@ -7623,6 +8410,7 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
   PAGE_PTR pgptr = NULL;
   TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
   bool success;
+  bool read_from_ctier = false;
   int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   PGBUF_STATUS *show_status = &pgbuf_Pool.show_status[tran_index];
 
@@ -7720,6 +8508,12 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
       else if (success == true)
 	{
 	  /* Nothing to do, copied from DWB */
+	  pgbuf_ctier_remove (vpid);
+	}
+      else if (pgbuf_ctier_fetch (thread_p, vpid, &bufptr->iopage_buffer->iopage))
+	{
+	  /* decompressed from the compressed cold tier; the entry is consumed and the disk read is skipped */
+	  read_from_ctier = true;
 	}
       else if (fileio_read (thread_p, fileio_get_volume_descriptor (vpid->volid), &bufptr->iopage_buffer->iopage,
 			    vpid->pageid, IO_PAGESIZE) == NULL)
@@ -7748,9 +8542,32 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	  return NULL;
 	}
 
+      if (prm_get_bool_value (PRM_ID_DATA_PAGE_CHECKSUM) && bufptr->iopage_buffer->iopage.prv.checksum != 0)
+	{
+	  bool is_page_corrupted;
+
+	  /* verify the image as stored on disk, before any TDE decryption */
+	  if (fileio_page_check_checksum (thread_p, &bufptr->iopage_buffer->iopage, &is_page_corrupted) != NO_ERROR
+	      || is_page_corrupted)
+	    {
+	      if (is_page_corrupted)
+		{
+		  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_PAGE_CHECKSUM_MISMATCH, 2, vpid->pageid,
+			  fileio_get_volume_label (vpid->volid, PEEK));
+		}
+	      pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+	      (void) pgbuf_unlock_page (thread_p, hash_anchor, vpid, true);
+	      PGBUF_BCB_CHECK_MUTEX_LEAKS ();
+	      return NULL;
+	    }
+	}
+      /* the checksum belongs to the on-disk image only; the resident copy keeps the field cleared */
+      bufptr->iopage_buffer->iopage.prv.checksum = 0;
+
       CAST_IOPGPTR_TO_PGPTR (pgptr, &bufptr->iopage_buffer->iopage);
       tde_algo = pgbuf_get_tde_algorithm (pgptr);
-      if (tde_algo != TDE_ALGORITHM_NONE)
+      /* the tier keeps the resident (already decrypted) image, so a tier hit must not be decrypted again */
+      if (tde_algo != TDE_ALGORITHM_NONE && !read_from_ctier)
 	{
 	  if (tde_decrypt_data_page
 	      (&bufptr->iopage_buffer->iopage, tde_algo, pgbuf_is_temporary_volume (vpid->volid),
@@ -7780,62 +8597,316 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	    }
 	}
 
-#if !defined (NDEBUG)
-      /* perm volume */
-      if (bufptr->vpid.volid > NULL_VOLID)
+#if !defined (NDEBUG)
+      /* perm volume */
+      if (bufptr->vpid.volid > NULL_VOLID)
+	{
+	  if (!log_is_in_crash_recovery ())
+	    {
+	      if (!LSA_ISNULL (&bufptr->iopage_buffer->iopage.prv.lsa))
+		{
+		  assert (bufptr->iopage_buffer->iopage.prv.pageid != -1);
+		  assert (bufptr->iopage_buffer->iopage.prv.volid != -1);
+		}
+	    }
+	}
+#endif /* NDEBUG */
+
+      if (thread_get_sort_stats_active (thread_p))
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_SORT_NUM_IO_PAGES);
+	}
+    }
+  else
+    {
+      /* the caller is holding bufptr->mutex */
+
+#if defined(CUBRID_DEBUG)
+      pgbuf_scramble (&bufptr->iopage_buffer->iopage);
+#endif /* CUBRID_DEBUG */
+
+      /* Don't need to read page from disk since it is a new page. A stale compressed tier entry of a formerly
+       * deallocated page with the same id must not survive the reallocation. */
+      pgbuf_ctier_remove (vpid);
+
+      if (pgbuf_is_temporary_volume (vpid->volid) == true)
+	{
+	  pgbuf_init_temp_page_lsa (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+	}
+      else
+	{
+	  fileio_init_lsa_of_page (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+	}
+
+      /* perm volume */
+      if (bufptr->vpid.volid > NULL_VOLID)
+	{
+	  /* Init Page identifier of NEW_PAGE */
+	  bufptr->iopage_buffer->iopage.prv.pageid = -1;
+	  bufptr->iopage_buffer->iopage.prv.volid = -1;
+	}
+
+      if (thread_get_sort_stats_active (thread_p))
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_SORT_NUM_DATA_PAGES);
+	}
+
+      show_status->num_pages_created++;
+      show_status->num_hit++;
+    }
+
+  return bufptr;
+}
+
+/*
+ * pgbuf_initialize_ctier () - allocate the compressed cold page tier according to data_buffer_compressed_pages
+ *   return: NO_ERROR, or ER_code
+ */
+static int
+pgbuf_initialize_ctier (void)
+{
+  int total_slots = prm_get_integer_value (PRM_ID_PB_COMPRESSED_PAGES);
+  int slots_per_part;
+  int i;
+
+  pgbuf_Ctier_enabled = false;
+  memset (pgbuf_Ctier, 0, sizeof (pgbuf_Ctier));
+
+  if (total_slots <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  slots_per_part = MAX (total_slots / PGBUF_CTIER_NUM_PARTITIONS, 1);
+
+  for (i = 0; i < PGBUF_CTIER_NUM_PARTITIONS; i++)
+    {
+      pthread_mutex_init (&pgbuf_Ctier[i].mutex, NULL);
+      pgbuf_Ctier[i].num_slots = slots_per_part;
+      pgbuf_Ctier[i].clock = 0;
+      pgbuf_Ctier[i].slots = (PGBUF_CTIER_SLOT *) calloc (slots_per_part, sizeof (PGBUF_CTIER_SLOT));
+      pgbuf_Ctier[i].scratch = (char *) malloc (LZ4_compressBound ((int) IO_PAGESIZE));
+      if (pgbuf_Ctier[i].slots == NULL || pgbuf_Ctier[i].scratch == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  slots_per_part * sizeof (PGBUF_CTIER_SLOT));
+	  pgbuf_finalize_ctier ();
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+    }
+
+  pgbuf_Ctier_enabled = true;
+  return NO_ERROR;
+}
+
+/*
+ * pgbuf_finalize_ctier () - release the compressed cold page tier
+ */
+static void
+pgbuf_finalize_ctier (void)
+{
+  int i, j;
+
+  for (i = 0; i < PGBUF_CTIER_NUM_PARTITIONS; i++)
+    {
+      if (pgbuf_Ctier[i].slots != NULL)
 	{
-	  if (!log_is_in_crash_recovery ())
+	  for (j = 0; j < pgbuf_Ctier[i].num_slots; j++)
 	    {
-	      if (!LSA_ISNULL (&bufptr->iopage_buffer->iopage.prv.lsa))
+	      if (pgbuf_Ctier[i].slots[j].data != NULL)
 		{
-		  assert (bufptr->iopage_buffer->iopage.prv.pageid != -1);
-		  assert (bufptr->iopage_buffer->iopage.prv.volid != -1);
+		  free (pgbuf_Ctier[i].slots[j].data);
 		}
 	    }
+	  free_and_init (pgbuf_Ctier[i].slots);
 	}
-#endif /* NDEBUG */
-
-      if (thread_get_sort_stats_active (thread_p))
+      if (pgbuf_Ctier[i].scratch != NULL)
 	{
-	  perfmon_inc_stat (thread_p, PSTAT_SORT_NUM_IO_PAGES);
+	  free_and_init (pgbuf_Ctier[i].scratch);
 	}
+      pgbuf_Ctier[i].num_slots = 0;
     }
-  else
+
+  pgbuf_Ctier_enabled = false;
+}
+
+/*
+ * pgbuf_ctier_get_partition () - partition of the compressed tier a page hashes to, and its home slot inside it
+ *   return: partition
+ *   vpid(in): page id
+ *   start_out(out): home slot index of the page inside the partition
+ */
+static PGBUF_CTIER_PARTITION *
+pgbuf_ctier_get_partition (const VPID * vpid, int *start_out)
+{
+  unsigned int hash = ((unsigned int) vpid->pageid * 0x9e3779b9U) ^ (unsigned int) vpid->volid;
+  PGBUF_CTIER_PARTITION *part = &pgbuf_Ctier[hash % PGBUF_CTIER_NUM_PARTITIONS];
+
+  *start_out = (int) ((hash / PGBUF_CTIER_NUM_PARTITIONS) % part->num_slots);
+  return part;
+}
+
+/*
+ * pgbuf_ctier_store () - keep an lz4-compressed copy of a clean victimized page in the compressed tier
+ *   thread_p(in): thread entry
+ *   vpid(in): page id
+ *   io_page(in): page content, as resident in the buffer pool
+ *
+ * Note: incompressible pages are not kept; a page that does not shrink buys no memory back. An existing entry for the
+ *	 same page is replaced. When the probe window is full the round robin position picks the entry to evict.
+ */
+static void
+pgbuf_ctier_store (THREAD_ENTRY * thread_p, const VPID * vpid, const FILEIO_PAGE * io_page)
+{
+  PGBUF_CTIER_PARTITION *part;
+  PGBUF_CTIER_SLOT *slot;
+  PGBUF_CTIER_SLOT *target = NULL;
+  char *data;
+  int start, i, idx, zip_size;
+#if defined(SERVER_MODE)
+  int rv;
+#endif /* SERVER_MODE */
+
+  if (!pgbuf_Ctier_enabled)
     {
-      /* the caller is holding bufptr->mutex */
+      return;
+    }
 
-#if defined(CUBRID_DEBUG)
-      pgbuf_scramble (&bufptr->iopage_buffer->iopage);
-#endif /* CUBRID_DEBUG */
+  part = pgbuf_ctier_get_partition (vpid, &start);
 
-      /* Don't need to read page from disk since it is a new page. */
-      if (pgbuf_is_temporary_volume (vpid->volid) == true)
+  rv = pthread_mutex_lock (&part->mutex);
+
+  zip_size = LZ4_compress_default ((const char *) io_page, part->scratch, (int) IO_PAGESIZE,
+				   LZ4_compressBound ((int) IO_PAGESIZE));
+  if (zip_size <= 0 || zip_size >= (int) IO_PAGESIZE)
+    {
+      pthread_mutex_unlock (&part->mutex);
+      return;
+    }
+
+  for (i = 0; i < PGBUF_CTIER_PROBE_DEPTH && i < part->num_slots; i++)
+    {
+      slot = &part->slots[(start + i) % part->num_slots];
+      if (VPID_EQ (&slot->vpid, vpid))
 	{
-	  pgbuf_init_temp_page_lsa (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+	  target = slot;
+	  break;
 	}
-      else
+      if (target == NULL && VPID_ISNULL (&slot->vpid))
 	{
-	  fileio_init_lsa_of_page (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+	  target = slot;
 	}
+    }
+  if (target == NULL)
+    {
+      target = &part->slots[(start + (part->clock++ % PGBUF_CTIER_PROBE_DEPTH)) % part->num_slots];
+    }
 
-      /* perm volume */
-      if (bufptr->vpid.volid > NULL_VOLID)
+  data = (char *) malloc (zip_size);
+  if (data == NULL)
+    {
+      pthread_mutex_unlock (&part->mutex);
+      return;
+    }
+  memcpy (data, part->scratch, zip_size);
+
+  if (target->data != NULL)
+    {
+      free (target->data);
+    }
+  target->vpid = *vpid;
+  target->size = zip_size;
+  target->data = data;
+
+  pthread_mutex_unlock (&part->mutex);
+}
+
+/*
+ * pgbuf_ctier_fetch () - look a page up in the compressed tier; on a hit, decompress it and consume the entry
+ *   return: true when the page was reconstructed into io_page, false when the caller must read from disk
+ *   thread_p(in): thread entry
+ *   vpid(in): page id
+ *   io_page(out): page buffer to decompress into
+ */
+static bool
+pgbuf_ctier_fetch (THREAD_ENTRY * thread_p, const VPID * vpid, FILEIO_PAGE * io_page)
+{
+  PGBUF_CTIER_PARTITION *part;
+  PGBUF_CTIER_SLOT *slot;
+  int start, i, unzip_size;
+#if defined(SERVER_MODE)
+  int rv;
+#endif /* SERVER_MODE */
+
+  if (!pgbuf_Ctier_enabled)
+    {
+      return false;
+    }
+
+  part = pgbuf_ctier_get_partition (vpid, &start);
+
+  rv = pthread_mutex_lock (&part->mutex);
+
+  for (i = 0; i < PGBUF_CTIER_PROBE_DEPTH && i < part->num_slots; i++)
+    {
+      slot = &part->slots[(start + i) % part->num_slots];
+      if (VPID_EQ (&slot->vpid, vpid))
 	{
-	  /* Init Page identifier of NEW_PAGE */
-	  bufptr->iopage_buffer->iopage.prv.pageid = -1;
-	  bufptr->iopage_buffer->iopage.prv.volid = -1;
+	  unzip_size = LZ4_decompress_safe (slot->data, (char *) io_page, slot->size, (int) IO_PAGESIZE);
+
+	  free (slot->data);
+	  slot->data = NULL;
+	  slot->size = 0;
+	  VPID_SET_NULL (&slot->vpid);
+
+	  pthread_mutex_unlock (&part->mutex);
+
+	  assert (unzip_size == (int) IO_PAGESIZE);
+	  return (unzip_size == (int) IO_PAGESIZE);
 	}
+    }
 
-      if (thread_get_sort_stats_active (thread_p))
+  pthread_mutex_unlock (&part->mutex);
+  return false;
+}
+
+/*
+ * pgbuf_ctier_remove () - drop the compressed tier entry of a page, if one exists
+ *   vpid(in): page id
+ */
+static void
+pgbuf_ctier_remove (const VPID * vpid)
+{
+  PGBUF_CTIER_PARTITION *part;
+  PGBUF_CTIER_SLOT *slot;
+  int start, i;
+#if defined(SERVER_MODE)
+  int rv;
+#endif /* SERVER_MODE */
+
+  if (!pgbuf_Ctier_enabled)
+    {
+      return;
+    }
+
+  part = pgbuf_ctier_get_partition (vpid, &start);
+
+  rv = pthread_mutex_lock (&part->mutex);
+
+  for (i = 0; i < PGBUF_CTIER_PROBE_DEPTH && i < part->num_slots; i++)
+    {
+      slot = &part->slots[(start + i) % part->num_slots];
+      if (VPID_EQ (&slot->vpid, vpid))
 	{
-	  perfmon_inc_stat (thread_p, PSTAT_SORT_NUM_DATA_PAGES);
+	  free (slot->data);
+	  slot->data = NULL;
+	  slot->size = 0;
+	  VPID_SET_NULL (&slot->vpid);
+	  break;
 	}
-
-      show_status->num_pages_created++;
-      show_status->num_hit++;
     }
 
-  return bufptr;
+  pthread_mutex_unlock (&part->mutex);
 }
 
 /*
@@ -7870,6 +8941,12 @@ pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
     }
   assert (bufptr->latch_mode == PGBUF_NO_LATCH);
 
+  if (pgbuf_Ctier_enabled)
+    {
+      /* keep a compressed copy of the clean page; a later fix may then skip the disk read */
+      pgbuf_ctier_store (thread_p, &bufptr->vpid, &bufptr->iopage_buffer->iopage);
+    }
+
   /* a safe victim */
   if (pgbuf_delete_from_hash_chain (thread_p, bufptr) != NO_ERROR)
     {
@@ -8224,6 +9301,22 @@ pgbuf_get_shared_lru_index_for_add (void)
 	}
     }
 
+#if defined (LINUX) && defined (SERVER_MODE)
+  if (PGBUF_NUMA_IS_ENABLED)
+    {
+      /* restrict the round-robin to the lists of the allocating thread's node, so new pages stay on local memory */
+      int node_base = pgbuf_numa_current_node () * PGBUF_NUMA_SHARED_LRU_PER_NODE;
+
+      lru_idx = node_base + (lru_idx % PGBUF_NUMA_SHARED_LRU_PER_NODE);
+      if (pgbuf_Pool.quota.avoid_shared_lru_idx == (int) lru_idx)
+	{
+	  lru_idx = node_base + ((lru_idx + 1) % PGBUF_NUMA_SHARED_LRU_PER_NODE);
+	}
+
+      return lru_idx;
+    }
+#endif /* LINUX && SERVER_MODE */
+
   lru_idx = lru_idx % PGBUF_SHARED_LRU_COUNT;
 
   /* avoid to add in shared LRU idx having too many BCBs */
@@ -8357,6 +9450,17 @@ pgbuf_get_victim (THREAD_ENTRY * thread_p)
 	}
     }
 
+  /* clock scan mode: sweep the bcb table with per-bcb state only, instead of contending on the shared lru lists. a
+   * failed sweep falls through to the regular shared list search. */
+  if (pgbuf_Clock_enabled)
+    {
+      victim = pgbuf_get_clock_victim (thread_p);
+      if (victim != NULL)
+	{
+	  return victim;
+	}
+    }
+
   /* loop:
    *
    * DOESN'T HAVE FLUSH THREAD: one iteration could fail, because the shared list's last victims have been set dirty.
@@ -8483,14 +9587,73 @@ pgbuf_is_bcb_victimizable (PGBUF_BCB * bcb, bool has_mutex_lock)
   return true;
 }
 
+/*
+ * pgbuf_get_clock_victim () - Get a victim BCB by sweeping the BCB table with the clock hand
+ *   return: If success, BCB (locked), otherwise NULL
+ *
+ * Note: only victim-zone bcbs whose second-chance bit is clear are claimed; the bit is set again whenever the page is
+ *       fixed. Unlike the LRU search, no shared list mutex is held while scanning.
+ */
+static PGBUF_BCB *
+pgbuf_get_clock_victim (THREAD_ENTRY * thread_p)
+{
+#define PGBUF_CLOCK_SCAN_PAGES 64
+
+  PGBUF_BCB *bcb;
+  int start, idx, i, lru_idx;
+
+  /* each caller sweeps its own segment of the bcb table, so concurrent victim seekers never touch the same bcbs */
+  start = ATOMIC_INC_32 (&pgbuf_Clock_hand, PGBUF_CLOCK_SCAN_PAGES) - PGBUF_CLOCK_SCAN_PAGES;
+
+  for (i = 0; i < PGBUF_CLOCK_SCAN_PAGES; i++)
+    {
+      idx = (start + i) % pgbuf_Pool.num_buffers;
+      if (idx < 0)
+	{
+	  idx += pgbuf_Pool.num_buffers;
+	}
+      bcb = PGBUF_FIND_BCB_PTR (idx);
+
+      /* cheap unlatched filters first; only victim-zone bcbs are eligible, so lru zone semantics are kept */
+      if (!PGBUF_IS_BCB_IN_LRU_VICTIM_ZONE (bcb) || !pgbuf_is_bcb_victimizable (bcb, false))
+	{
+	  continue;
+	}
+
+      if (bcb->flags & PGBUF_BCB_CLOCK_REF_FLAG)
+	{
+	  /* second chance: clear the reference bit and move on */
+	  pgbuf_bcb_update_flags (thread_p, bcb, 0, PGBUF_BCB_CLOCK_REF_FLAG);
+	  continue;
+	}
+
+      if (PGBUF_BCB_TRYLOCK (bcb) != 0)
+	{
+	  continue;
+	}
+      if (!PGBUF_IS_BCB_IN_LRU_VICTIM_ZONE (bcb) || !pgbuf_is_bcb_victimizable (bcb, true))
+	{
+	  PGBUF_BCB_UNLOCK (bcb);
+	  continue;
+	}
+
+      /* claim it. the list mutex is taken once for the detach only; no list is scanned. */
+      lru_idx = pgbuf_bcb_get_lru_index (bcb);
+      pgbuf_lru_remove_bcb (thread_p, bcb);
+      pgbuf_add_vpid_to_aout_list (thread_p, &bcb->vpid, lru_idx);
+
+      return bcb;
+    }
+
+  return NULL;
+
+#undef PGBUF_CLOCK_SCAN_PAGES
+}
+
 /*
  * pgbuf_get_victim_from_lru_list () - Get victim BCB from the bottom of LRU list
  *   return: If success, BCB, otherwise NULL
  *   lru_idx (in)     : index of LRU list
- *
- * Note: This function disconnects BCB from the bottom of the LRU list and returns it if its fcnt == 0.
- *       If its fcnt != 0, makes bufptr->PrevBCB bottom and retry.
- *       While this processing, the caller must be the holder of the LRU list.
  */
 static PGBUF_BCB *
 pgbuf_get_victim_from_lru_list (THREAD_ENTRY * thread_p, const int lru_idx)
@@ -9899,7 +11062,9 @@ STATIC_INLINE int
 pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_page_flush_thread, bool * is_bcb_locked)
 {
   char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  char page_buf_cipher[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
   FILEIO_PAGE *iopage = NULL;
+  FILEIO_PAGE *iopage_cipher = NULL;
   PAGE_PTR pgptr = NULL;
   LOG_LSA oldest_unflush_lsa;
   int error = NO_ERROR;
@@ -9973,18 +11138,18 @@ start_copy_page:
   iopage = (FILEIO_PAGE *) PTR_ALIGN (page_buf, MAX_ALIGNMENT);
   CAST_BFPTR_TO_PGPTR (pgptr, bufptr);
   tde_algo = pgbuf_get_tde_algorithm (pgptr);
+  memcpy ((void *) iopage, (void *) (&bufptr->iopage_buffer->iopage), IO_PAGESIZE);
   if (tde_algo != TDE_ALGORITHM_NONE)
     {
-      error = tde_encrypt_data_page (&bufptr->iopage_buffer->iopage, tde_algo, is_temp, iopage);
-      if (error != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	  return error;
-	}
+      /* only the plain copy needs the stable image protected by the bcb mutex. encryption (and the checksum over the
+       * cipher image) is deferred until the mutex is released, so concurrent flushers encrypt in parallel and latch
+       * waiters are not stalled behind the cipher. the DWB slot is acquired by dwb_add_page () at that point. */
+      goto copy_unflushed_lsa;
     }
-  else
+  if (prm_get_bool_value (PRM_ID_DATA_PAGE_CHECKSUM))
     {
-      memcpy ((void *) iopage, (void *) (&bufptr->iopage_buffer->iopage), IO_PAGESIZE);
+      /* checksum the image that goes to disk; with TDE this is the encrypted one, so verification needs no keys */
+      fileio_set_page_checksum (thread_p, iopage);
     }
   if (uses_dwb)
     {
@@ -10023,6 +11188,36 @@ copy_unflushed_lsa:
 	}
     }
 
+  if (tde_algo != TDE_ALGORITHM_NONE)
+    {
+      /* deferred from start_copy_page; the bcb mutex is released, so the cipher work does not block anyone */
+      iopage_cipher = (FILEIO_PAGE *) PTR_ALIGN (page_buf_cipher, MAX_ALIGNMENT);
+      error = tde_encrypt_data_page (iopage, tde_algo, is_temp, iopage_cipher);
+      if (error != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  PGBUF_BCB_LOCK (bufptr);
+	  *is_bcb_locked = true;
+	  pgbuf_bcb_mark_was_not_flushed (thread_p, bufptr, was_dirty);
+	  LSA_COPY (&bufptr->oldest_unflush_lsa, &oldest_unflush_lsa);
+
+#if defined (SERVER_MODE)
+	  if (bufptr->next_wait_thrd != NULL)
+	    {
+	      pgbuf_wake_flush_waiters (thread_p, bufptr);
+	    }
+#endif
+
+	  return error;
+	}
+      iopage = iopage_cipher;
+      if (prm_get_bool_value (PRM_ID_DATA_PAGE_CHECKSUM))
+	{
+	  /* checksum the image that goes to disk; with TDE this is the encrypted one, so verification needs no keys */
+	  fileio_set_page_checksum (thread_p, iopage);
+	}
+    }
+
 #if defined(ENABLE_SYSTEMTAP)
   query_id = qmgr_get_current_query_id (thread_p);
   if (query_id != NULL_QUERY_ID)
@@ -10032,6 +11227,12 @@ copy_unflushed_lsa:
     }
 #endif /* ENABLE_SYSTEMTAP */
 
+  if (!pgbuf_is_temporary_volume (bufptr->vpid.volid))
+    {
+      /* let incremental backups know that this page version reaches disk */
+      fileio_mark_changed_page (bufptr->vpid.volid, bufptr->vpid.pageid);
+    }
+
   /* Activating/deactivating DWB while the server is alive, needs additional work. For now, we don't care about
    * this case, we can use it to test performance differences.
    */
@@ -10211,7 +11412,7 @@ STATIC_INLINE bool
 pgbuf_get_check_page_validation_level (int page_validation_level)
 {
 #if !defined(NDEBUG)
-  return prm_get_integer_value (PRM_ID_PB_DEBUG_PAGE_VALIDATION_LEVEL) >= page_validation_level;
+  return sysprm_get_hot_params ()->pb_debug_page_validation_level >= page_validation_level;
 #else /* NDEBUG */
   return false;
 #endif /* NDEBUG */
@@ -10431,7 +11632,8 @@ pgbuf_check_bcb_page_vpid (PGBUF_BCB * bufptr, bool maybe_deallocated)
 	      || (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
 		  && bufptr->vpid.volid == bufptr->iopage_buffer->iopage.prv.volid));
 
-      assert (bufptr->iopage_buffer->iopage.prv.p_reserve_1 == 0);
+      /* the checksum only exists on the on-disk image; it is cleared when a page is read into the buffer pool */
+      assert (bufptr->iopage_buffer->iopage.prv.checksum == 0);
       assert (bufptr->iopage_buffer->iopage.prv.p_reserve_2 == 0);
 
       return (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
@@ -10466,7 +11668,7 @@ pgbuf_scramble (FILEIO_PAGE * iopage)
 
   iopage->prv.ptype = (unsigned char) PAGE_UNKNOWN;
   iopage->prv.pflag = '\0';
-  iopage->prv.p_reserve_1 = 0;
+  iopage->prv.checksum = 0;
   iopage->prv.p_reserve_2 = 0;
   iopage->prv.tde_nonce = 0;
 }
@@ -14813,6 +16015,18 @@ pgbuf_bcb_is_dirty (const PGBUF_BCB * bcb)
   return (bcb->flags & PGBUF_BCB_DIRTY_FLAG) != 0;
 }
 
+/*
+ * pgbuf_bcb_is_retired () - is bcb retired by an online pool shrink?
+ *
+ * return   : true/false
+ * bcb (in) : bcb
+ */
+STATIC_INLINE bool
+pgbuf_bcb_is_retired (const PGBUF_BCB * bcb)
+{
+  return (bcb->flags & PGBUF_BCB_RETIRED_FLAG) != 0;
+}
+
 /*
  * pgbuf_bcb_set_dirty () - set dirty flag to bcb
  *
@@ -15795,6 +17009,40 @@ pgbuf_page_maintenance_execute (cubthread::entry & thread_ref)
 
   /* search lists and assign victims directly */
   pgbuf_direct_victims_maintenance (&thread_ref);
+
+  /* periodically save the resident page set for warm start; self-throttled, no-op unless enabled */
+  (void) pgbuf_warm_start_dump (&thread_ref, false);
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+static void
+pgbuf_page_readahead_execute (cubthread::entry & thread_ref)
+{
+  VPID vpid;
+  PAGE_PTR pgptr;
+
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      // wait for boot to finish
+      return;
+    }
+
+  /* materialize the hinted pages in the buffer pool so the scan that queued them finds them resident. The latch is
+   * conditional: the point is the disk read, never waiting behind another holder. */
+  while (pgbuf_Readahead_queue != NULL && pgbuf_Readahead_queue->consume (vpid))
+    {
+      pgptr = pgbuf_fix (&thread_ref, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+      if (pgptr != NULL)
+	{
+	  pgbuf_unfix (&thread_ref, pgptr);
+	}
+      else if (er_errid () != NO_ERROR)
+	{
+	  /* the page may have been deallocated since the hint was queued; this is only a hint, move on */
+	  er_clear ();
+	}
+    }
 }
 #endif /* SERVER_MODE */
 
@@ -16014,6 +17262,27 @@ pgbuf_flush_control_daemon_init ()
 }
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_page_readahead_daemon_init () - initialize page read-ahead daemon thread
+ */
+void
+pgbuf_page_readahead_daemon_init ()
+{
+  assert (pgbuf_Page_readahead_daemon == NULL);
+
+  // *INDENT-OFF*
+  pgbuf_Readahead_queue = new lockfree::circular_queue<VPID> (PGBUF_READAHEAD_QUEUE_CAPACITY);
+
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (100));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (pgbuf_page_readahead_execute);
+
+  pgbuf_Page_readahead_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task,
+                                                                          "pgbuf_page_readahead");
+  // *INDENT-ON*
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * pgbuf_daemons_init () - initialize page buffer daemon threads
@@ -16025,6 +17294,7 @@ pgbuf_daemons_init ()
   pgbuf_page_flush_daemon_init ();
   pgbuf_page_post_flush_daemon_init ();
   pgbuf_flush_control_daemon_init ();
+  pgbuf_page_readahead_daemon_init ();
 }
 #endif /* SERVER_MODE */
 
@@ -16039,6 +17309,10 @@ pgbuf_daemons_destroy ()
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_post_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Flush_control_daemon);
+  cubthread::get_manager ()->destroy_daemon (pgbuf_Page_readahead_daemon);
+
+  delete pgbuf_Readahead_queue;
+  pgbuf_Readahead_queue = NULL;
 }
 #endif /* SERVER_MODE */
 
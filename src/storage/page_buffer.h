@@ -251,6 +251,10 @@ extern int pgbuf_initialize (void);
 extern void pgbuf_finalize (void);
 extern PAGE_PTR pgbuf_fix_with_retry (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MODE fetch_mode,
 				      PGBUF_LATCH_MODE request_mode, int retry);
+extern int pgbuf_prefetch_range (THREAD_ENTRY * thread_p, const VPID * vpids, int count);
+extern int pgbuf_warm_start_restore (THREAD_ENTRY * thread_p, const char *db_full_name);
+extern int pgbuf_warm_start_dump (THREAD_ENTRY * thread_p, bool force);
+extern int pgbuf_adjust_active_pages (THREAD_ENTRY * thread_p);
 extern void pgbuf_flush (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, bool free_page);
 #if !defined(NDEBUG)
 
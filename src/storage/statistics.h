@@ -35,7 +35,7 @@
 #define STATS_WITH_SAMPLING  false
 
 #define STATS_SAMPLING_THRESHOLD 50	/* sampling trial count */
-#define STATS_SAMPLING_LEAFS_MAX   8	/* sampling leaf pages */
+#define STATS_SAMPLING_LEAFS_MAX   8	/* default sampling leaf pages (see the stats_sampling_pages parameter) */
 
 /* disk-resident elements of pkeys[] field */
 #define BTREE_STATS_PKEYS_NUM      8
@@ -43,6 +43,10 @@
 
 #define STATS_MIN_MAX_SIZE    sizeof(DB_DATA)
 
+/* equi-depth histogram over the key values of an index */
+#define STATS_HISTOGRAM_SIZE       32	/* max number of bucket boundary values kept per index */
+#define STATS_HISTOGRAM_VALUE_SIZE sizeof(DB_DATA)
+
 /* free_and_init routine */
 #define stats_free_statistics_and_init(stats) \
   do \
@@ -66,6 +70,10 @@ struct btree_stats
   int pkeys_size;		/* pkeys array size */
   int *pkeys;			/* partial keys info for example: index (a, b, ..., x) pkeys[0] -> # of {a} pkeys[1] ->
 				 * # of {a, b} ... pkeys[pkeys_size-1] -> # of {a, b, ..., x} */
+  int hist_size;		/* number of valid entries in hist[]; 0 when no histogram has been collected */
+  DB_DATA hist[STATS_HISTOGRAM_SIZE];	/* equi-depth histogram of the key values; entry i approximates the key at
+					 * rank (i + 1) * keys / (hist_size + 1), so the boundaries cut the key
+					 * population into buckets of (almost) equal cardinality */
 #if 0				/* reserved for future use */
   int reserved[BTREE_STATS_RESERVED_NUM];
 #endif
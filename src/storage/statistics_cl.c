@@ -214,6 +214,19 @@ stats_client_unpack_statistics (char *buf_p)
 	      btree_stats_p->pkeys[k] = OR_GET_INT (buf_p);
 	      buf_p += OR_INT_SIZE;
 	    }
+
+	  btree_stats_p->hist_size = OR_GET_INT (buf_p);
+	  buf_p += OR_INT_SIZE;
+	  if (btree_stats_p->hist_size < 0 || btree_stats_p->hist_size > STATS_HISTOGRAM_SIZE)
+	    {
+	      assert (false);
+	      btree_stats_p->hist_size = 0;
+	    }
+	  else if (btree_stats_p->hist_size > 0)
+	    {
+	      memcpy (btree_stats_p->hist, buf_p, btree_stats_p->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+	      buf_p += (btree_stats_p->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+	    }
 	}
     }
 
@@ -499,8 +512,8 @@ stats_dump (const char *class_name_p, FILE * file_p)
 		  prefix_p = ",";
 		}
 	      fprintf (file_p, ") ,");
-	      fprintf (file_p, " Total pages: %d , Leaf pages: %d , Height: %d\n", bt_stats_p->pages,
-		       bt_stats_p->leafs, bt_stats_p->height);
+	      fprintf (file_p, " Total pages: %d , Leaf pages: %d , Height: %d , Histogram boundaries: %d\n",
+		       bt_stats_p->pages, bt_stats_p->leafs, bt_stats_p->height, bt_stats_p->hist_size);
 	    }
 	}
       fprintf (file_p, "\n");
@@ -36,11 +36,20 @@
 #include "partition_sr.h"
 #include "object_primitive.h"
 #include "object_representation.h"
+#include "log_impl.h"
+#include "xserver_interface.h"
 #include "thread_entry.hpp"
+#include "thread_daemon.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
 #include "system_parameter.h"
 
 #define SQUARE(n) ((n)*(n))
 
+/* cardinality growth (or shrink) factor beyond which the recorded statistics of a class are considered stale; the
+ * same ratio the XASL cache uses to force recompilation (XCACHE_RT_FACTOR) */
+#define STATS_AUTO_UPDATE_FACTOR 10
+
 /* Used by the "stats_update_all_statistics" routine to create the list of all
    classes from the extensible hashing directory used by the catalog manager. */
 typedef struct class_id_list CLASS_ID_LIST;
@@ -72,6 +81,12 @@ static int stats_compare_money (DB_MONETARY * mn1, DB_MONETARY * mn2);
 #endif
 static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_oid, OID * partitions, int count,
 						bool with_fullscan);
+#if defined(SERVER_MODE)
+// *INDENT-OFF*
+static void stats_get_auto_update_interval (bool & is_timed_wait, cubthread::delta_time & period);
+static void stats_auto_update_execute (cubthread::entry & thread_ref);
+// *INDENT-ON*
+#endif /* SERVER_MODE */
 
 /*
  * xstats_update_statistics () -  Updates the statistics for the objects
@@ -545,6 +560,9 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	  tot_key_info_size += or_packed_domain_size (btree_stats_p->key_type, 0);
 	  assert (btree_stats_p->pkeys_size <= BTREE_STATS_PKEYS_NUM);
 	  tot_key_info_size += (btree_stats_p->pkeys_size * OR_INT_SIZE);	/* pkeys[] */
+	  assert (btree_stats_p->hist_size <= STATS_HISTOGRAM_SIZE);
+	  tot_key_info_size += OR_INT_SIZE;	/* hist_size */
+	  tot_key_info_size += (int) (btree_stats_p->hist_size * STATS_HISTOGRAM_VALUE_SIZE);	/* hist[] */
 	}
     }
 
@@ -771,6 +789,16 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	      OR_PUT_INT (buf_p, btree_stats_p->pkeys[k]);
 	      buf_p += OR_INT_SIZE;
 	    }
+
+	  assert (btree_stats_p->hist_size >= 0 && btree_stats_p->hist_size <= STATS_HISTOGRAM_SIZE);
+	  OR_PUT_INT (buf_p, btree_stats_p->hist_size);
+	  buf_p += OR_INT_SIZE;
+
+	  if (btree_stats_p->hist_size > 0)
+	    {
+	      memcpy (buf_p, btree_stats_p->hist, btree_stats_p->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+	      buf_p += (btree_stats_p->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+	    }
 	}			/* for (j = 0, ...) */
     }
 
@@ -1837,3 +1865,174 @@ stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_re
   er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
   return NULL;
 }
+
+#if defined(SERVER_MODE)
+// *INDENT-OFF*
+static cubthread::daemon *stats_Auto_update_daemon = NULL;
+// *INDENT-ON*
+
+/*
+ * stats_get_auto_update_interval () - setup the statistics refresh daemon period based on system parameter
+ */
+static void
+stats_get_auto_update_interval (bool & is_timed_wait, cubthread::delta_time & period)
+{
+  int interval_sec = prm_get_integer_value (PRM_ID_STATS_AUTO_UPDATE_INTERVAL);
+
+  if (interval_sec <= 0)
+    {
+      /* disabled; poll once in a while so that turning the parameter on at runtime takes effect */
+      interval_sec = 60;
+    }
+
+  is_timed_wait = true;
+  period = std::chrono::seconds (interval_sec);
+}
+
+/*
+ * stats_auto_update_execute () - walk the classes of the database and refresh, with sampling, the statistics of
+ *				  those whose current cardinality drifted too far from the cardinality recorded
+ *				  in the catalog
+ */
+static void
+stats_auto_update_execute (cubthread::entry & thread_ref)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  RECDES recdes = RECDES_INITIALIZER;
+  HFID root_hfid;
+  OID class_oid;
+  OID dir_oid;
+  CLS_INFO *cls_info_p = NULL;
+  HEAP_SCANCACHE scan_cache;
+  MVCC_SNAPSHOT *mvcc_snapshot = NULL;
+  int tran_index;
+  int estimated_nobjs;
+  bool needs_update;
+
+  if (!BO_IS_SERVER_RESTARTED () || prm_get_integer_value (PRM_ID_STATS_AUTO_UPDATE_INTERVAL) <= 0)
+    {
+      return;
+    }
+
+  /* the refresh locks each class and writes the catalog, which must run under a genuine transaction; daemon
+   * threads start out on the system transaction index, so assign one for the duration of the cycle */
+  tran_index =
+    logtb_assign_tran_index (thread_p, NULL_TRANID, TRAN_ACTIVE, NULL, NULL, TRAN_LOCK_INFINITE_WAIT,
+			     TRAN_DEFAULT_ISOLATION_LEVEL ());
+  if (tran_index == NULL_TRAN_INDEX)
+    {
+      er_clear ();
+      return;
+    }
+
+  mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+  if (mvcc_snapshot == NULL)
+    {
+      goto end;
+    }
+
+  if (boot_find_root_heap (&root_hfid) != NO_ERROR || HFID_IS_NULL (&root_hfid))
+    {
+      goto end;
+    }
+
+  if (heap_scancache_start (thread_p, &scan_cache, &root_hfid, oid_Root_class_oid, false, false, mvcc_snapshot) !=
+      NO_ERROR)
+    {
+      goto end;
+    }
+
+  class_oid.volid = root_hfid.vfid.volid;
+  class_oid.pageid = NULL_PAGEID;
+  class_oid.slotid = NULL_SLOTID;
+
+  recdes.data = NULL;
+  while (heap_next (thread_p, &root_hfid, oid_Root_class_oid, &class_oid, &recdes, &scan_cache, COPY) == S_SUCCESS)
+    {
+      recdes.data = NULL;
+
+      /* peek the cardinality recorded in the catalog; skip quietly whenever the entry is inaccessible and let a
+       * later cycle retry */
+      OID_SET_NULL (&dir_oid);
+      if (catalog_get_dir_oid_from_cache (thread_p, &class_oid, &dir_oid) != NO_ERROR)
+	{
+	  er_clear ();
+	  continue;
+	}
+
+      CATALOG_ACCESS_INFO catalog_access_info = CATALOG_ACCESS_INFO_INITIALIZER;
+      catalog_access_info.class_oid = &class_oid;
+      catalog_access_info.dir_oid = &dir_oid;
+      if (catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, S_LOCK) != NO_ERROR)
+	{
+	  er_clear ();
+	  continue;
+	}
+
+      cls_info_p = catalog_get_class_info (thread_p, &class_oid, &catalog_access_info);
+      (void) catalog_end_access_with_dir_oid (thread_p, &catalog_access_info, NO_ERROR);
+      if (cls_info_p == NULL)
+	{
+	  er_clear ();
+	  continue;
+	}
+
+      needs_update = false;
+      if (!HFID_IS_NULL (&cls_info_p->ci_hfid))
+	{
+	  estimated_nobjs = heap_estimate_num_objects (thread_p, &cls_info_p->ci_hfid);
+	  if (estimated_nobjs >= 0
+	      && (estimated_nobjs > STATS_AUTO_UPDATE_FACTOR * MAX (cls_info_p->ci_tot_objects, 1)
+		  || estimated_nobjs < cls_info_p->ci_tot_objects / STATS_AUTO_UPDATE_FACTOR))
+	    {
+	      needs_update = true;
+	    }
+	  er_clear ();
+	}
+      catalog_free_class_info_and_init (cls_info_p);
+
+      if (needs_update && xstats_update_statistics (thread_p, &class_oid, STATS_WITH_SAMPLING) != NO_ERROR)
+	{
+	  /* the class is busy or disappeared meanwhile; continue with other classes */
+	  er_clear ();
+	}
+    }
+
+  if (heap_scancache_end (thread_p, &scan_cache) != NO_ERROR)
+    {
+      er_clear ();
+    }
+
+end:
+  /* keep whatever was refreshed; a failure on one class does not devalue the statistics of the others */
+  (void) xtran_server_commit (thread_p, false);
+  logtb_free_tran_index (thread_p, tran_index);
+  logtb_set_to_system_tran_index (thread_p);
+  er_clear ();
+}
+
+/*
+ * stats_auto_update_daemon_init () - initialize the automatic statistics refresh daemon thread
+ */
+void
+stats_auto_update_daemon_init ()
+{
+  assert (stats_Auto_update_daemon == NULL);
+
+  // *INDENT-OFF*
+  cubthread::looper looper = cubthread::looper (stats_get_auto_update_interval);
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (stats_auto_update_execute);
+
+  stats_Auto_update_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "stats_auto_update");
+  // *INDENT-ON*
+}
+
+/*
+ * stats_auto_update_daemon_destroy () - destroy the automatic statistics refresh daemon thread
+ */
+void
+stats_auto_update_daemon_destroy ()
+{
+  cubthread::get_manager ()->destroy_daemon (stats_Auto_update_daemon);
+}
+#endif /* SERVER_MODE */
@@ -36,6 +36,10 @@
 #include "object_representation_sr.h"
 
 extern unsigned int stats_get_time_stamp (void);
+#if defined (SERVER_MODE)
+extern void stats_auto_update_daemon_init ();
+extern void stats_auto_update_daemon_destroy ();
+#endif /* SERVER_MODE */
 extern const BTREE_STATS *stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_rep,
 							    DISK_ATTR * subcls_attr, BTID * cls_btid);
 #if defined(CUBRID_DEBUG)
@@ -121,7 +121,10 @@ static int rv;
 #define CATALOG_BT_STATS_FUNC_INDEX_OFF	 28
 #define CATALOG_BT_STATS_PKEYS_OFF       32
 #define CATALOG_BT_STATS_RESERVED_OFF    (CATALOG_BT_STATS_PKEYS_OFF + (OR_INT_SIZE * BTREE_STATS_PKEYS_NUM))	/* 64 */
-#define CATALOG_BT_STATS_SIZE            (CATALOG_BT_STATS_RESERVED_OFF + (OR_INT_SIZE * BTREE_STATS_RESERVED_NUM))	/* 64 + (4 * R_NUM) = 80 */
+#define CATALOG_BT_STATS_HIST_SIZE_OFF   (CATALOG_BT_STATS_RESERVED_OFF + (OR_INT_SIZE * BTREE_STATS_RESERVED_NUM))	/* 64 + (4 * R_NUM) = 80 */
+#define CATALOG_BT_STATS_HIST_OFF        (CATALOG_BT_STATS_HIST_SIZE_OFF + OR_INT_SIZE)	/* 84 */
+#define CATALOG_BT_STATS_SIZE \
+  (CATALOG_BT_STATS_HIST_OFF + (STATS_HISTOGRAM_SIZE * (int) STATS_HISTOGRAM_VALUE_SIZE))
 
 #define CATALOG_GET_BT_STATS_BTID(var, ptr) \
     OR_GET_BTID((ptr) + CATALOG_BT_STATS_BTID_OFF, (var))
@@ -190,6 +193,21 @@ struct catalog_entry
   CATALOG_KEY key;		/* key of catalog entry */
 };
 
+/* catalog class info snapshot entry: a deserialized read-only image of the
+ * class information record, served to hot catalog readers without fixing
+ * catalog pages.  Refreshed whenever DDL touches the class. */
+typedef struct catalog_snapshot_entry CATALOG_SNAPSHOT_ENTRY;
+struct catalog_snapshot_entry
+{
+  CATALOG_SNAPSHOT_ENTRY *stack;	/* used for freelist */
+  CATALOG_SNAPSHOT_ENTRY *next;	/* next in hash chain */
+  UINT64 del_id;		/* delete transaction ID (for lock free) */
+  OID class_oid;		/* key: class identifier */
+  pthread_mutex_t mutex;	/* protects the snapshot fields */
+  bool valid;			/* false until the snapshot fields are filled */
+  CLS_INFO cls_info;		/* deserialized class information record */
+};
+
 /* handling functions for catalog key and entry */
 static void *catalog_entry_alloc (void);
 static int catalog_entry_free (void *ent);
@@ -199,6 +217,20 @@ static int catalog_key_copy (void *src, void *dest);
 static int catalog_key_compare (void *key1, void *key2);
 static unsigned int catalog_key_hash (void *key, int htsize);
 
+/* handling functions for class info snapshot entries */
+static void *catalog_snapshot_entry_alloc (void);
+static int catalog_snapshot_entry_free (void *ent);
+static int catalog_snapshot_entry_init (void *ent);
+static int catalog_snapshot_entry_uninit (void *ent);
+static int catalog_snapshot_key_copy (void *src, void *dest);
+static int catalog_snapshot_key_compare (void *key1, void *key2);
+static unsigned int catalog_snapshot_key_hash (void *key, int htsize);
+
+/* class info snapshot operations */
+static CLS_INFO *catalog_snapshot_get_class_info (THREAD_ENTRY * thread_p, OID * class_id_p);
+static void catalog_snapshot_put_class_info (THREAD_ENTRY * thread_p, OID * class_id_p, const CLS_INFO * class_info_p);
+static void catalog_snapshot_invalidate_class_info (THREAD_ENTRY * thread_p, OID * class_id_p);
+
 /* catalog entry descriptor */
 static LF_ENTRY_DESCRIPTOR catalog_entry_Descriptor = {
   /* offsets */
@@ -221,6 +253,28 @@ static LF_ENTRY_DESCRIPTOR catalog_entry_Descriptor = {
   NULL				/* no inserts */
 };
 
+/* class info snapshot entry descriptor */
+static LF_ENTRY_DESCRIPTOR catalog_snapshot_entry_Descriptor = {
+  /* offsets */
+  offsetof (CATALOG_SNAPSHOT_ENTRY, stack),
+  offsetof (CATALOG_SNAPSHOT_ENTRY, next),
+  offsetof (CATALOG_SNAPSHOT_ENTRY, del_id),
+  offsetof (CATALOG_SNAPSHOT_ENTRY, class_oid),
+  offsetof (CATALOG_SNAPSHOT_ENTRY, mutex),
+
+  /* using mutex */
+  LF_EM_USING_MUTEX,
+
+  catalog_snapshot_entry_alloc,
+  catalog_snapshot_entry_free,
+  catalog_snapshot_entry_init,
+  catalog_snapshot_entry_uninit,
+  catalog_snapshot_key_copy,
+  catalog_snapshot_key_compare,
+  catalog_snapshot_key_hash,
+  NULL				/* no inserts */
+};
+
 typedef struct catalog_class_id_list CATALOG_CLASS_ID_LIST;
 struct catalog_class_id_list
 {
@@ -267,8 +321,10 @@ static PGLENGTH catalog_Max_record_size;	/* Maximum Record Size */
  */
 // *INDENT-OFF*
 using catalog_hashmap_type = cubthread::lockfree_hashmap<catalog_key, catalog_entry>;
+using catalog_snapshot_hashmap_type = cubthread::lockfree_hashmap<OID, catalog_snapshot_entry>;
 // *INDENT-ON*
 static catalog_hashmap_type catalog_Hashmap;
+static catalog_snapshot_hashmap_type catalog_Snapshot_hashmap;
 
 static CATALOG_MAX_SPACE catalog_Max_space;	/* Global space information */
 static pthread_mutex_t catalog_Max_space_lock = PTHREAD_MUTEX_INITIALIZER;
@@ -455,6 +511,17 @@ catalog_get_btree_statistics (BTREE_STATS * stat_p, char *rec_p)
       stat_p->reserved[i] = OR_GET_INT (rec_p + CATALOG_BT_STATS_RESERVED_OFF + (OR_INT_SIZE * i));
     }
 #endif
+
+  stat_p->hist_size = OR_GET_INT (rec_p + CATALOG_BT_STATS_HIST_SIZE_OFF);
+  if (stat_p->hist_size < 0 || stat_p->hist_size > STATS_HISTOGRAM_SIZE)
+    {
+      assert (false);
+      stat_p->hist_size = 0;
+    }
+  if (stat_p->hist_size > 0)
+    {
+      memcpy (stat_p->hist, rec_p + CATALOG_BT_STATS_HIST_OFF, stat_p->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+    }
 }
 
 static void
@@ -494,6 +561,14 @@ catalog_put_btree_statistics (char *rec_p, BTREE_STATS * stat_p)
       OR_PUT_INT (rec_p + CATALOG_BT_STATS_RESERVED_OFF + (OR_INT_SIZE * i), 0);
     }
 #endif
+
+  assert (stat_p->hist_size >= 0 && stat_p->hist_size <= STATS_HISTOGRAM_SIZE);
+  OR_PUT_INT (rec_p + CATALOG_BT_STATS_HIST_SIZE_OFF, stat_p->hist_size);
+  memset (rec_p + CATALOG_BT_STATS_HIST_OFF, 0, STATS_HISTOGRAM_SIZE * STATS_HISTOGRAM_VALUE_SIZE);
+  if (stat_p->hist_size > 0)
+    {
+      memcpy (rec_p + CATALOG_BT_STATS_HIST_OFF, stat_p->hist, stat_p->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+    }
 }
 
 static void
@@ -1065,6 +1140,182 @@ catalog_key_hash (void *key, int hash_table_size)
   return (hash_res % hash_table_size);
 }
 
+/*
+ * catalog_snapshot_entry_alloc () - allocate a class info snapshot entry
+ *   returns: new entry or NULL on error
+ */
+static void *
+catalog_snapshot_entry_alloc (void)
+{
+  CATALOG_SNAPSHOT_ENTRY *entry_p = (CATALOG_SNAPSHOT_ENTRY *) malloc (sizeof (CATALOG_SNAPSHOT_ENTRY));
+
+  if (entry_p == NULL)
+    {
+      return NULL;
+    }
+  pthread_mutex_init (&entry_p->mutex, NULL);
+  return entry_p;
+}
+
+/*
+ * catalog_snapshot_entry_free () - free a class info snapshot entry
+ *   returns: error code or NO_ERROR
+ *   ent(in): entry to free
+ */
+static int
+catalog_snapshot_entry_free (void *ent)
+{
+  pthread_mutex_destroy (&((CATALOG_SNAPSHOT_ENTRY *) ent)->mutex);
+  free (ent);
+  return NO_ERROR;
+}
+
+/*
+ * catalog_snapshot_entry_init () - initialize a class info snapshot entry
+ *   returns: error code or NO_ERROR
+ *   ent(in): entry to initialize
+ */
+static int
+catalog_snapshot_entry_init (void *ent)
+{
+  /* a fresh entry holds no snapshot until its fields are filled */
+  ((CATALOG_SNAPSHOT_ENTRY *) ent)->valid = false;
+  return NO_ERROR;
+}
+
+/*
+ * catalog_snapshot_entry_uninit () - uninitialize a class info snapshot entry
+ *   returns: error code or NO_ERROR
+ *   ent(in): entry to uninitialize
+ */
+static int
+catalog_snapshot_entry_uninit (void *ent)
+{
+  ((CATALOG_SNAPSHOT_ENTRY *) ent)->valid = false;
+  return NO_ERROR;
+}
+
+/*
+ * catalog_snapshot_key_copy () - copy a class OID key
+ *   returns: error code or NO_ERROR
+ *   src(in): source key
+ *   dest(in): destination key
+ */
+static int
+catalog_snapshot_key_copy (void *src, void *dest)
+{
+  if (src == NULL || dest == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  COPY_OID ((OID *) dest, (OID *) src);
+  return NO_ERROR;
+}
+
+/*
+ * catalog_snapshot_key_compare () - compare two class OID keys
+ *   return: int (true or false)
+ *   key1(in): first class OID
+ *   key2(in): second class OID
+ */
+static int
+catalog_snapshot_key_compare (void *key1, void *key2)
+{
+  return OID_EQ ((OID *) key1, (OID *) key2) ? 0 : 1;
+}
+
+/*
+ * catalog_snapshot_key_hash () - hashing function for the class OID key
+ *   return: hash value
+ *   key(in): class OID
+ *   hash_table_size(in): memory hash table size
+ */
+static unsigned int
+catalog_snapshot_key_hash (void *key, int hash_table_size)
+{
+  return ((unsigned int) OID_PSEUDO_KEY ((OID *) key)) % hash_table_size;
+}
+
+/*
+ * catalog_snapshot_get_class_info () - serve a class info read from the
+ *                                      in-memory catalog snapshot
+ *   return: private copy of the cached class information, or NULL on miss
+ *   class_id_p(in): class identifier
+ *
+ * Note: The snapshot holds deserialized class information records and is
+ * consulted before the catalog pages, so hot readers avoid the page fixes
+ * and the directory OID lock of the regular path.  Writers refresh it
+ * whenever DDL touches the class.
+ */
+static CLS_INFO *
+catalog_snapshot_get_class_info (THREAD_ENTRY * thread_p, OID * class_id_p)
+{
+  CATALOG_SNAPSHOT_ENTRY *entry_p;
+  CLS_INFO *class_info_p = NULL;
+
+  entry_p = catalog_Snapshot_hashmap.find (thread_p, *class_id_p);
+  if (entry_p == NULL)
+    {
+      return NULL;
+    }
+
+  if (entry_p->valid)
+    {
+      class_info_p = (CLS_INFO *) db_private_alloc (thread_p, sizeof (CLS_INFO));
+      if (class_info_p != NULL)
+	{
+	  *class_info_p = entry_p->cls_info;
+	}
+    }
+
+  catalog_Snapshot_hashmap.unlock (thread_p, entry_p);
+  return class_info_p;
+}
+
+/*
+ * catalog_snapshot_put_class_info () - publish a freshly read class info
+ *                                      record to the catalog snapshot
+ *   return: nothing
+ *   class_id_p(in): class identifier
+ *   class_info_p(in): class information read from the catalog
+ *
+ * Note: Must be called while the reader still holds its lock on the
+ * directory OID; this serializes the publication against the DDL writers,
+ * which invalidate the snapshot under the exclusive lock.
+ */
+static void
+catalog_snapshot_put_class_info (THREAD_ENTRY * thread_p, OID * class_id_p, const CLS_INFO * class_info_p)
+{
+  CATALOG_SNAPSHOT_ENTRY *entry_p = NULL;
+
+  (void) catalog_Snapshot_hashmap.find_or_insert (thread_p, *class_id_p, entry_p);
+  if (entry_p == NULL)
+    {
+      /* the snapshot is only a cache; a failed insert costs nothing */
+      return;
+    }
+
+  entry_p->cls_info = *class_info_p;
+  entry_p->valid = true;
+  catalog_Snapshot_hashmap.unlock (thread_p, entry_p);
+}
+
+/*
+ * catalog_snapshot_invalidate_class_info () - drop the snapshot of a class
+ *   return: nothing
+ *   class_id_p(in): class identifier
+ *
+ * Note: Called by every forward path that rewrites or drops the class
+ * information record.  Recovery and rollback go through the RVCT handlers,
+ * which clear the whole snapshot via catalog_clear_hash_table ().
+ */
+static void
+catalog_snapshot_invalidate_class_info (THREAD_ENTRY * thread_p, OID * class_id_p)
+{
+  (void) catalog_Snapshot_hashmap.erase (thread_p, *class_id_p);
+}
+
 /*
  * catalog_put_record_into_page () -
  *   return: NO_ERROR or ER_FAILED
@@ -1507,6 +1758,7 @@ catalog_fetch_btree_statistics (THREAD_ENTRY * thread_p, BTREE_STATS * btree_sta
   btree_stats_p->keys = 0;
   btree_stats_p->pkeys_size = 0;
   btree_stats_p->pkeys = NULL;
+  btree_stats_p->hist_size = 0;
 
   CATALOG_GET_BT_STATS_BTID (&btree_stats_p->btid, catalog_record_p->recdes.data + catalog_record_p->offset);
 
@@ -2491,6 +2743,13 @@ catalog_copy_btree_statistic (BTREE_STATS * new_btree_stats_p, int new_btree_sta
 	    }
 #endif
 
+	  assert (pre_stats_p->hist_size <= STATS_HISTOGRAM_SIZE);
+	  new_stats_p->hist_size = pre_stats_p->hist_size;
+	  if (pre_stats_p->hist_size > 0)
+	    {
+	      memcpy (new_stats_p->hist, pre_stats_p->hist, pre_stats_p->hist_size * STATS_HISTOGRAM_VALUE_SIZE);
+	    }
+
 	  break;
 	}
     }
@@ -2538,6 +2797,7 @@ catalog_initialize (CTID * catalog_id_p)
 {
   // protect against repeated hashmap initializations
   catalog_Hashmap.destroy ();
+  catalog_Snapshot_hashmap.destroy ();
 
   VFID_COPY (&catalog_Id.xhid, &catalog_id_p->xhid);
   catalog_Id.xhid.pageid = catalog_id_p->xhid.pageid;
@@ -2547,6 +2807,8 @@ catalog_initialize (CTID * catalog_id_p)
 
   // init
   catalog_Hashmap.init (catalog_Ts, THREAD_TS_CATALOG, CATALOG_HASH_SIZE, 2, 100, catalog_entry_Descriptor);
+  catalog_Snapshot_hashmap.init (catalog_snapshot_Ts, THREAD_TS_CATALOG_SNAPSHOT, CATALOG_HASH_SIZE, 2, 100,
+				 catalog_snapshot_entry_Descriptor);
 
   catalog_Max_record_size =
     spage_max_record_size () - CATALOG_PAGE_HEADER_SIZE - CATALOG_MAX_SLOT_ID_SIZE - CATALOG_MAX_SLOT_ID_SIZE;
@@ -2567,6 +2829,7 @@ void
 catalog_finalize (void)
 {
   catalog_Hashmap.destroy ();
+  catalog_Snapshot_hashmap.destroy ();
 }
 
 /*
@@ -3090,6 +3353,8 @@ catalog_add_class_info (THREAD_ENTRY * thread_p, OID * class_id_p, CLS_INFO * cl
       return error_code;
     }
 
+  catalog_snapshot_invalidate_class_info (thread_p, class_id_p);
+
   if (do_end_access)
     {
       catalog_end_access_with_dir_oid (thread_p, catalog_access_info_p, NO_ERROR);
@@ -3231,6 +3496,9 @@ catalog_update_class_info (THREAD_ENTRY * thread_p, OID * class_id_p, CLS_INFO *
       log_skip_logging (thread_p, &addr);
     }
   pgbuf_set_dirty (thread_p, page_p, FREE);
+
+  catalog_snapshot_invalidate_class_info (thread_p, class_id_p);
+
   if (do_end_access)
     {
       catalog_end_access_with_dir_oid (thread_p, catalog_access_info_p, NO_ERROR);
@@ -3475,6 +3743,7 @@ catalog_drop_all_representation_and_class (THREAD_ENTRY * thread_p, OID * class_
   recdes_free_data_area (&record);
 
   catalog_delete_key (thread_p, class_id_p, CATALOG_DIR_REPR_KEY);
+  catalog_snapshot_invalidate_class_info (thread_p, class_id_p);
   catalog_end_access_with_dir_oid (thread_p, &catalog_access_info, NO_ERROR);
 
   return NO_ERROR;
@@ -4108,6 +4377,14 @@ start:
 
   if (catalog_access_info_p == NULL)
     {
+      /* try the in-memory catalog snapshot first; a hit serves the read without fixing catalog pages or locking the
+       * directory OID */
+      class_info_p = catalog_snapshot_get_class_info (thread_p, class_id_p);
+      if (class_info_p != NULL)
+	{
+	  return class_info_p;
+	}
+
       if (catalog_get_dir_oid_from_cache (thread_p, class_id_p, &dir_oid) != NO_ERROR)
 	{
 	  return NULL;
@@ -4204,6 +4481,10 @@ start:
 
   if (do_end_access)
     {
+      /* publish the snapshot while the directory OID is still locked in share mode, so a concurrent DDL cannot
+       * invalidate it in between */
+      catalog_snapshot_put_class_info (thread_p, class_id_p, class_info_p);
+
       catalog_end_access_with_dir_oid (thread_p, catalog_access_info_p, NO_ERROR);
     }
 
@@ -5137,6 +5418,7 @@ static void
 catalog_clear_hash_table (THREAD_ENTRY * thread_p)
 {
   catalog_Hashmap.clear (thread_p);
+  catalog_Snapshot_hashmap.clear (thread_p);
 }
 
 
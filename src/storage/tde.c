@@ -95,6 +95,26 @@ static int tde_encrypt_internal (const unsigned char *plain_buffer, int length,
 static int tde_decrypt_internal (const unsigned char *cipher_buffer, int length, TDE_ALGORITHM tde_algo,
 				 const unsigned char *key, const unsigned char *nonce, unsigned char *plain_buffer);
 
+/* *INDENT-OFF* */
+/* reusable per-thread cipher context; see tde_get_cipher_context () */
+struct tde_cipher_context_holder
+{
+  EVP_CIPHER_CTX *ctx = NULL;
+
+  ~tde_cipher_context_holder ()
+  {
+    if (ctx != NULL)
+      {
+	EVP_CIPHER_CTX_free (ctx);
+      }
+  }
+};
+static thread_local tde_cipher_context_holder tde_Cipher_context_holder;
+/* *INDENT-ON* */
+
+static EVP_CIPHER_CTX *tde_get_cipher_context (void);
+static void tde_drop_cipher_context (void);
+
 /*
  * tde_initialize () - Initialize the tde module, which is called during initializing server.
  *
@@ -1056,6 +1076,42 @@ tde_decrypt_log_page (const LOG_PAGE * logpage_cipher, TDE_ALGORITHM tde_algo, L
 			       ((unsigned char *) logpage_plain) + TDE_LOG_PAGE_ENC_OFFSET);
 }
 
+/*
+ * tde_get_cipher_context () - Get the reusable cipher context of the current thread.
+ *
+ * return : cipher context, or NULL on allocation failure
+ *
+ * Allocating and freeing an EVP context for every page costs more than the AES-NI work itself on modern CPUs.
+ * EVP_EncryptInit_ex ()/EVP_DecryptInit_ex () fully re-initialize the context for each page, so a single context
+ * per thread can serve both directions and any algorithm.
+ */
+static EVP_CIPHER_CTX *
+tde_get_cipher_context (void)
+{
+  if (tde_Cipher_context_holder.ctx == NULL)
+    {
+      tde_Cipher_context_holder.ctx = EVP_CIPHER_CTX_new ();
+    }
+  return tde_Cipher_context_holder.ctx;
+}
+
+/*
+ * tde_drop_cipher_context () - Free the cipher context of the current thread.
+ *
+ * return : void
+ *
+ * Called when an EVP call fails; the context state is unknown, so it must not be reused.
+ */
+static void
+tde_drop_cipher_context (void)
+{
+  if (tde_Cipher_context_holder.ctx != NULL)
+    {
+      EVP_CIPHER_CTX_free (tde_Cipher_context_holder.ctx);
+      tde_Cipher_context_holder.ctx = NULL;
+    }
+}
+
 /*
  * tde_encrypt_internal () - Gerneral encryption function
  *
@@ -1079,7 +1135,7 @@ tde_encrypt_internal (const unsigned char *plain_buffer, int length, TDE_ALGORIT
   int cipher_len;
   int err = ER_TDE_ENCRYPTION_ERROR;
 
-  if ((ctx = EVP_CIPHER_CTX_new ()) == NULL)
+  if ((ctx = tde_get_cipher_context ()) == NULL)
     {
       goto exit;
     }
@@ -1125,7 +1181,11 @@ tde_encrypt_internal (const unsigned char *plain_buffer, int length, TDE_ALGORIT
   err = NO_ERROR;
 
 cleanup:
-  EVP_CIPHER_CTX_free (ctx);
+  if (err != NO_ERROR)
+    {
+      /* the context state is unknown after a failed EVP call; don't reuse it */
+      tde_drop_cipher_context ();
+    }
 
 exit:
   if (err != NO_ERROR)
@@ -1158,7 +1218,7 @@ tde_decrypt_internal (const unsigned char *cipher_buffer, int length, TDE_ALGORI
   int plain_len;
   int err = ER_TDE_DECRYPTION_ERROR;
 
-  if ((ctx = EVP_CIPHER_CTX_new ()) == NULL)
+  if ((ctx = tde_get_cipher_context ()) == NULL)
     {
       goto exit;
     }
@@ -1202,7 +1262,11 @@ tde_decrypt_internal (const unsigned char *cipher_buffer, int length, TDE_ALGORI
   err = NO_ERROR;
 
 cleanup:
-  EVP_CIPHER_CTX_free (ctx);
+  if (err != NO_ERROR)
+    {
+      /* the context state is unknown after a failed EVP call; don't reuse it */
+      tde_drop_cipher_context ();
+    }
 
 exit:
   if (err != NO_ERROR)
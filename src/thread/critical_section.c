@@ -511,7 +511,16 @@ csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
 	{
 	  if (wait_secs == INF_WAIT)
 	    {
-	      csect->waiting_writers++;
+	      /* the increment is a full barrier: it either turns the reader fast path off before we re-check rwlock
+	       * below, or an exiting fast reader sees it and wakes us through the mutex */
+	      ATOMIC_INC_32 (&csect->waiting_writers, 1);
+	      if (csect->rwlock == 0 && csect->owner == thread_id_t ())
+		{
+		  /* the last fast reader left between the loop check and our announcement and could not see us;
+		   * do not sleep, the csect is free now */
+		  ATOMIC_INC_32 (&csect->waiting_writers, -1);
+		  continue;
+		}
 	      csect->stats->nwait++;
 
 	      if (thread_p->event_stats.trace_slow_query == true)
@@ -527,7 +536,7 @@ csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
 		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
 		}
 
-	      csect->waiting_writers--;
+	      ATOMIC_INC_32 (&csect->waiting_writers, -1);
 	      if (error_code != NO_ERROR)
 		{
 		  r = pthread_mutex_unlock (&csect->lock);
@@ -571,7 +580,13 @@ csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
 	      to.tv_sec = time (NULL) + wait_secs;
 	      to.tv_nsec = 0;
 
-	      csect->waiting_writers++;
+	      ATOMIC_INC_32 (&csect->waiting_writers, 1);
+	      if (csect->rwlock == 0 && csect->owner == thread_id_t ())
+		{
+		  /* the last fast reader left between the loop check and our announcement; see the INF_WAIT case */
+		  ATOMIC_INC_32 (&csect->waiting_writers, -1);
+		  continue;
+		}
 
 	      if (thread_p->event_stats.trace_slow_query == true)
 		{
@@ -586,7 +601,7 @@ csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
 		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
 		}
 
-	      csect->waiting_writers--;
+	      ATOMIC_INC_32 (&csect->waiting_writers, -1);
 	      if (error_code != NO_ERROR)
 		{
 		  r = pthread_mutex_unlock (&csect->lock);
@@ -620,7 +635,23 @@ csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
     }
 
   /* rwlock will be < 0. It denotes that a writer owns the csect. */
-  csect->rwlock--;
+  if (csect->rwlock < 0)
+    {
+      /* reentering; readers cannot race with us while rwlock is negative */
+      ATOMIC_INC_32 (&csect->rwlock, -1);
+    }
+  else
+    {
+      /* claim exclusive ownership against the lock-free reader fast path. advertising one more waiting writer turns
+       * the fast path off; a reader that already won the race to increment rwlock exits without taking the mutex, so
+       * waiting for it to drain while we hold the mutex cannot deadlock. */
+      ATOMIC_INC_32 (&csect->waiting_writers, 1);
+      while (!ATOMIC_CAS_32 (&csect->rwlock, 0, -1))
+	{
+	  /* in-flight fast readers are still inside; csect read sections are short, they are about to leave */
+	}
+      ATOMIC_INC_32 (&csect->waiting_writers, -1);
+    }
 
   /* record that I am the writer of the csect. */
   csect->owner = thread_p->get_id ();
@@ -697,6 +728,7 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
   TSCTIMEVAL tv_diff;
   TSC_TICKS wait_start_tick, wait_end_tick;
   TSCTIMEVAL wait_tv_diff;
+  int rv;
 
   assert (csect != NULL);
 
@@ -705,6 +737,18 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
       thread_p = thread_get_thread_entry_info ();
     }
 
+  /* lock-free fast path for the common uncontended case: enter as one more reader while no writer holds the csect
+   * and none is waiting. the CAS is what makes us visible to writers: a writer claims the csect with a CAS from
+   * zero, so it either sees our increment and waits for it to drain, or beats us to the claim and the CAS below
+   * fails, sending us to the slow path under the mutex. */
+  rv = csect->rwlock;
+  if (rv >= 0 && csect->waiting_writers == 0 && ATOMIC_CAS_32 (&csect->rwlock, rv, rv + 1))
+    {
+      csect->stats->nenter++;
+      thread_p->get_csect_tracker ().on_enter_as_reader (csect->cs_index);
+      return NO_ERROR;
+    }
+
   csect->stats->nenter++;
 
   tsc_getticks (&start_tick);
@@ -720,7 +764,7 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
   if (csect->rwlock < 0 && csect->owner == thread_p->get_id ())
     {
       /* writer reenters the csect as a reader. treat as writer. */
-      csect->rwlock--;
+      ATOMIC_INC_32 (&csect->rwlock, -1);
       csect->stats->nreenter++;
     }
   else
@@ -842,7 +886,7 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
 	}
 
       /* rwlock will be > 0. record that a reader enters the csect. */
-      csect->rwlock++;
+      ATOMIC_INC_32 (&csect->rwlock, 1);
     }
 
   tsc_getticks (&end_tick);
@@ -945,19 +989,18 @@ csect_demote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
        * a writer.
        */
 
-      csect->rwlock++;		/* releasing */
-      if (csect->rwlock < 0)
+      if (ATOMIC_INC_32 (&csect->rwlock, 1) < 0)	/* releasing */
 	{
 	  /*
 	   * In the middle of an outer critical section, it is not possible
 	   * to be a reader. Treat as same as csect_enter_critical_section_as_reader().
 	   */
-	  csect->rwlock--;	/* entering as a writer */
+	  ATOMIC_INC_32 (&csect->rwlock, -1);	/* entering as a writer */
 	}
       else
 	{
-	  /* rwlock == 0 */
-	  csect->rwlock++;	/* entering as a reader */
+	  /* rwlock was 0; a fast reader may already have entered meanwhile, which is fine for a demoted csect */
+	  ATOMIC_INC_32 (&csect->rwlock, 1);	/* entering as a reader */
 #if 0
 	  csect->owner = thread_id_t ();
 	  csect->tran_index = -1;
@@ -1085,7 +1128,7 @@ csect_demote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 	}
 
       /* rwlock will be > 0. record that a reader enters the csect. */
-      csect->rwlock++;
+      ATOMIC_INC_32 (&csect->rwlock, 1);
     }
 
   tsc_getticks (&end_tick);
@@ -1197,11 +1240,11 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
        * I am a reader so that no writer is in this csect but reader(s) could be.
        * All writers are waiting on 'writers_queue' with 'waiting_writers++'.
        */
-      csect->rwlock--;		/* releasing */
+      ATOMIC_INC_32 (&csect->rwlock, -1);	/* releasing */
     }
   else
     {
-      csect->rwlock++;		/* releasing */
+      ATOMIC_INC_32 (&csect->rwlock, 1);	/* releasing */
       /*
        * I don't have read lock. Act like a normal writer request.
        */
@@ -1222,7 +1265,14 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 	{
 	  if (wait_secs == INF_WAIT)
 	    {
-	      csect->waiting_writers++;
+	      /* full barrier announcement against the reader fast path; see csect_enter_critical_section () */
+	      ATOMIC_INC_32 (&csect->waiting_writers, 1);
+	      if (csect->rwlock == 0)
+		{
+		  /* the last fast reader left between the loop check and our announcement and could not see us */
+		  ATOMIC_INC_32 (&csect->waiting_writers, -1);
+		  continue;
+		}
 	      csect->stats->nwait++;
 
 	      if (thread_p->event_stats.trace_slow_query == true)
@@ -1238,7 +1288,7 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
 		}
 
-	      csect->waiting_writers--;
+	      ATOMIC_INC_32 (&csect->waiting_writers, -1);
 	      if (error_code != NO_ERROR)
 		{
 		  r = pthread_mutex_unlock (&csect->lock);
@@ -1259,7 +1309,13 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 	      to.tv_sec = time (NULL) + wait_secs;
 	      to.tv_nsec = 0;
 
-	      csect->waiting_writers++;
+	      ATOMIC_INC_32 (&csect->waiting_writers, 1);
+	      if (csect->rwlock == 0)
+		{
+		  /* the last fast reader left between the loop check and our announcement; see the INF_WAIT case */
+		  ATOMIC_INC_32 (&csect->waiting_writers, -1);
+		  continue;
+		}
 
 	      if (thread_p->event_stats.trace_slow_query == true)
 		{
@@ -1274,7 +1330,7 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
 		}
 
-	      csect->waiting_writers--;
+	      ATOMIC_INC_32 (&csect->waiting_writers, -1);
 	      if (error_code != NO_ERROR)
 		{
 		  r = pthread_mutex_unlock (&csect->lock);
@@ -1308,7 +1364,21 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
     }
 
   /* rwlock will be < 0. It denotes that a writer owns the csect. */
-  csect->rwlock--;
+  if (csect->rwlock < 0)
+    {
+      /* reentering; readers cannot race with us while rwlock is negative */
+      ATOMIC_INC_32 (&csect->rwlock, -1);
+    }
+  else
+    {
+      /* claim exclusive ownership against the lock-free reader fast path; see csect_enter_critical_section () */
+      ATOMIC_INC_32 (&csect->waiting_writers, 1);
+      while (!ATOMIC_CAS_32 (&csect->rwlock, 0, -1))
+	{
+	  /* in-flight fast readers are still inside; they are about to leave */
+	}
+      ATOMIC_INC_32 (&csect->waiting_writers, -1);
+    }
   /* record that I am the writer of the csect. */
   csect->owner = thread_p->get_id ();
   csect->tran_index = thread_p->tran_index;
@@ -1374,6 +1444,7 @@ csect_exit_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * cs
 {
   int error_code = NO_ERROR;
   bool ww, wr, wp;
+  int rv;
 
   assert (csect != NULL);
 
@@ -1382,6 +1453,79 @@ csect_exit_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * cs
       thread_p = thread_get_thread_entry_info ();
     }
 
+  rv = csect->rwlock;
+  if (rv > 0)
+    {
+      /* reader exit. our read lock keeps rwlock positive until the decrement below, so the sign test is stable.
+       * decrement before taking the mutex: a writer claiming the csect spins for readers to drain while holding the
+       * mutex, so decrementing under the mutex could deadlock against it. */
+      ATOMIC_INC_32 (&csect->rwlock, -1);
+
+      if (csect->waiting_writers == 0 && csect->waiting_readers == 0)
+	{
+	  /* the common uncontended case; nobody to wake up */
+	  thread_p->get_csect_tracker ().on_exit (csect->cs_index);
+	  return NO_ERROR;
+	}
+
+      error_code = pthread_mutex_lock (&csect->lock);
+      if (error_code != NO_ERROR)
+	{
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_LOCK, 0);
+	  assert (0);
+	  return ER_CSS_PTHREAD_MUTEX_LOCK;
+	}
+
+      /* recompute the wakeup conditions under the mutex; rwlock is not ours to touch anymore */
+      wp = (csect->waiting_writers > 0 && csect->rwlock == 0 && csect->owner != thread_id_t ());
+      ww = (csect->waiting_writers > 0 && csect->rwlock == 0 && csect->owner == thread_id_t ());
+
+      if (wp == true)
+	{
+	  error_code = csect_wakeup_waiting_promoter (csect);
+	  if (error_code != NO_ERROR)
+	    {
+	      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_COND_SIGNAL, 0);
+	      pthread_mutex_unlock (&csect->lock);
+	      assert (0);
+	      return ER_CSS_PTHREAD_COND_SIGNAL;
+	    }
+	}
+      else if (ww == true)
+	{
+	  error_code = csect_wakeup_waiting_writer (csect);
+	  if (error_code != NO_ERROR)
+	    {
+	      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_COND_SIGNAL, 0);
+	      pthread_mutex_unlock (&csect->lock);
+	      assert (0);
+	      return ER_CSS_PTHREAD_COND_SIGNAL;
+	    }
+	}
+      else if (csect->waiting_writers == 0)
+	{
+	  error_code = pthread_cond_broadcast (&csect->readers_ok);
+	  if (error_code != NO_ERROR)
+	    {
+	      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_COND_BROADCAST, 0);
+	      pthread_mutex_unlock (&csect->lock);
+	      assert (0);
+	      return ER_CSS_PTHREAD_COND_BROADCAST;
+	    }
+	}
+
+      error_code = pthread_mutex_unlock (&csect->lock);
+      if (error_code != NO_ERROR)
+	{
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_UNLOCK, 0);
+	  assert (0);
+	  return ER_CSS_PTHREAD_MUTEX_UNLOCK;
+	}
+
+      thread_p->get_csect_tracker ().on_exit (csect->cs_index);
+      return NO_ERROR;
+    }
+
   error_code = pthread_mutex_lock (&csect->lock);
   if (error_code != NO_ERROR)
     {
@@ -1392,7 +1536,7 @@ csect_exit_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * cs
 
   if (csect->rwlock < 0)
     {				/* rwlock < 0 if locked for writing */
-      csect->rwlock++;
+      ATOMIC_INC_32 (&csect->rwlock, 1);
       if (csect->rwlock < 0)
 	{
 	  /* in the middle of an outer critical section */
@@ -1415,7 +1559,7 @@ csect_exit_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * cs
     }
   else if (csect->rwlock > 0)
     {
-      csect->rwlock--;
+      ATOMIC_INC_32 (&csect->rwlock, -1);
     }
   else
     {
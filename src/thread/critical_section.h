@@ -111,9 +111,11 @@ typedef struct sync_critical_section
   const char *name;
   int cs_index;
   pthread_mutex_t lock;		/* read/write monitor lock */
-  int rwlock;			/* >0 = # readers, <0 = writer, 0 = none */
+  volatile int rwlock;		/* >0 = # readers, <0 = writer, 0 = none. always changed with atomic operations:
+				 * readers may enter and exit through a lock-free fast path without holding lock */
   unsigned int waiting_readers;	/* # of waiting readers */
-  unsigned int waiting_writers;	/* # of waiting writers */
+  unsigned int waiting_writers;	/* # of waiting writers. changed with atomic operations; a non-zero value turns the
+				 * lock-free reader fast path off */
   pthread_cond_t readers_ok;	/* start waiting readers */
   THREAD_ENTRY *waiting_writers_queue;	/* queue of waiting writers */
   THREAD_ENTRY *waiting_promoters_queue;	/* queue of waiting promoters */
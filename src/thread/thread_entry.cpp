@@ -115,6 +115,7 @@ namespace cubthread
     , log_zip_redo (NULL)
     , log_data_ptr (NULL)
     , log_data_length (0)
+    , heap_attrinfo_arena (NULL)
     , no_logging (false)
     , net_request_index (-1)
     , vacuum_worker (NULL)
@@ -206,6 +207,7 @@ namespace cubthread
     tran_entries[THREAD_TS_OBJ_LOCK_RES] = lf_tran_request_entry (&obj_lock_res_Ts);
     tran_entries[THREAD_TS_OBJ_LOCK_ENT] = lf_tran_request_entry (&obj_lock_ent_Ts);
     tran_entries[THREAD_TS_CATALOG] = lf_tran_request_entry (&catalog_Ts);
+    tran_entries[THREAD_TS_CATALOG_SNAPSHOT] = lf_tran_request_entry (&catalog_snapshot_Ts);
     tran_entries[THREAD_TS_SESSIONS] = lf_tran_request_entry (&sessions_Ts);
     tran_entries[THREAD_TS_FREE_SORT_LIST] = lf_tran_request_entry (&free_sort_list_Ts);
     tran_entries[THREAD_TS_GLOBAL_UNIQUE_STATS] = lf_tran_request_entry (&global_unique_stats_Ts);
@@ -254,6 +256,11 @@ namespace cubthread
       {
 	free (log_data_ptr);
       }
+    if (heap_attrinfo_arena != NULL)
+      {
+	free (heap_attrinfo_arena);
+	heap_attrinfo_arena = NULL;
+      }
 
     no_logging = false;
 
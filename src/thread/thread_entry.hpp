@@ -81,6 +81,7 @@ enum
   THREAD_TS_OBJ_LOCK_RES,
   THREAD_TS_OBJ_LOCK_ENT,
   THREAD_TS_CATALOG,
+  THREAD_TS_CATALOG_SNAPSHOT,
   THREAD_TS_SESSIONS,
   THREAD_TS_FREE_SORT_LIST,
   THREAD_TS_GLOBAL_UNIQUE_STATS,
@@ -256,6 +257,9 @@ namespace cubthread
       char *log_data_ptr;
       int log_data_length;
 
+      void *heap_attrinfo_arena;	/* HEAP_ATTRINFO_ARENA *; scratch space for attribute cache value arrays,
+					 * lazily allocated and owned by heap_file.c */
+
       bool no_logging;
 
       int net_request_index;	/* request index of net server functions */
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * thread_profiler - built-in sampling profiler for server threads
+ */
+
+#include "thread_profiler.hpp"
+
+#include "config.h"
+#include "dbtype_def.h"
+#include "environment_variable.h"
+#include "porting.h"
+#include "system_parameter.h"
+#include "thread_daemon.hpp"
+#include "thread_entry.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_looper.hpp"
+#include "thread_manager.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <libgen.h>
+
+namespace cubthread
+{
+  static const char *PROFILER_FILE_DIR = "server";
+  static const char *PROFILER_FILE_SUFFIX = "_profiler.collapsed";
+
+  // milliseconds between dump rewrites while sampling is active
+  static const int PROFILER_DUMP_INTERVAL_MSECS = 10000;
+  // polling period while sampling is disabled; keeps the daemon responsive to parameter changes
+  static const int PROFILER_IDLE_INTERVAL_MSECS = 1000;
+
+  static daemon *Profiler_daemon = NULL;
+  static char Profiler_file_path[PATH_MAX] = { '\0' };
+
+  // samples aggregated since startup, keyed by collapsed stack; only the daemon writes, the mutex protects the final
+  // dump racing daemon destruction
+  static std::map<std::string, UINT64> Profiler_samples;
+  static std::mutex Profiler_samples_mutex;
+
+  //
+  // profiler_get_interval () - setup profiler daemon period based on system parameter
+  //
+  static void
+  profiler_get_interval (bool &is_timed_wait, delta_time &period)
+  {
+    int interval_msecs = prm_get_integer_value (PRM_ID_SAMPLING_PROFILER_INTERVAL_IN_MSECS);
+
+    is_timed_wait = true;
+    if (interval_msecs > 0)
+      {
+	period = std::chrono::milliseconds (interval_msecs);
+      }
+    else
+      {
+	period = std::chrono::milliseconds (PROFILER_IDLE_INTERVAL_MSECS);
+      }
+  }
+
+  //
+  // profiler_sample_mapfunc () - fold one thread entry into the sample aggregate
+  //
+  static void
+  profiler_sample_mapfunc (entry &thread_ref, bool &stop_mapper, std::map<std::string, UINT64> &samples)
+  {
+    entry::status status = thread_ref.m_status;
+
+    (void) stop_mapper;	  // suppress unused parameter warning
+
+    if (status == entry::status::TS_DEAD || status == entry::status::TS_FREE)
+      {
+	// not doing anything; don't pollute the profile
+	return;
+      }
+
+    // we cannot unwind a native stack from another thread without stopping it, so the "stack" is the coarse state the
+    // entry already tracks: what kind of thread it is, whether it runs or waits, and what it waits for.
+    std::string stack = thread_type_to_string (thread_ref.type);
+    stack.append (1, ';');
+    stack.append (thread_status_to_string (status));
+    if (status == entry::status::TS_WAIT)
+      {
+	stack.append (1, ';');
+	stack.append (thread_resume_status_to_string (thread_ref.resume_status));
+      }
+
+    samples[stack]++;
+  }
+
+  //
+  // profiler_dump () - rewrite the collapsed-stack file from the current aggregate
+  //
+  static void
+  profiler_dump (void)
+  {
+    FILE *fp;
+
+    if (Profiler_file_path[0] == '\0' || Profiler_samples.empty ())
+      {
+	return;
+      }
+
+    fp = fopen (Profiler_file_path, "w");
+    if (fp == NULL)
+      {
+	return;
+      }
+
+    for (const auto &it : Profiler_samples)
+      {
+	fprintf (fp, "%s %llu\n", it.first.c_str (), (unsigned long long) it.second);
+      }
+
+    fclose (fp);
+  }
+
+  //
+  // profiler_execute () - one daemon iteration: sample all live threads and periodically rewrite the dump file
+  //
+  static void
+  profiler_execute (entry &thread_ref)
+  {
+    static std::chrono::steady_clock::time_point last_dump_time = std::chrono::steady_clock::now ();
+
+    (void) thread_ref;
+
+    if (prm_get_integer_value (PRM_ID_SAMPLING_PROFILER_INTERVAL_IN_MSECS) <= 0)
+      {
+	// sampling is disabled; just keep polling the parameter
+	return;
+      }
+
+    std::unique_lock<std::mutex> lock (Profiler_samples_mutex);
+    get_manager ()->map_entries (profiler_sample_mapfunc, Profiler_samples);
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now ();
+    if (now - last_dump_time >= std::chrono::milliseconds (PROFILER_DUMP_INTERVAL_MSECS))
+      {
+	profiler_dump ();
+	last_dump_time = now;
+      }
+  }
+
+  //
+  // profiler_daemon_init () - create the sampling profiler daemon
+  //
+  void
+  profiler_daemon_init (const char *db_name)
+  {
+    char *s, *base_db_name;
+    char local_db_name[DB_MAX_IDENTIFIER_LENGTH];
+    char profiler_file_name[PATH_MAX];
+
+    assert (db_name != NULL);
+    assert (Profiler_daemon == NULL);
+
+    strncpy (local_db_name, db_name, DB_MAX_IDENTIFIER_LENGTH);
+    local_db_name[DB_MAX_IDENTIFIER_LENGTH - 1] = '\0';
+    s = strchr (local_db_name, '@');
+    if (s)
+      {
+	*s = '\0';
+      }
+
+    base_db_name = basename ((char *) local_db_name);
+    if (base_db_name == NULL)
+      {
+	return;
+      }
+
+    snprintf (profiler_file_name, PATH_MAX - 1, "%s%c%s%s", PROFILER_FILE_DIR, PATH_SEPARATOR, base_db_name,
+	      PROFILER_FILE_SUFFIX);
+    envvar_logdir_file (Profiler_file_path, PATH_MAX, profiler_file_name);
+
+    looper looper_obj (profiler_get_interval);
+    entry_callable_task *daemon_task = new entry_callable_task (profiler_execute);
+
+    Profiler_daemon = get_manager ()->create_daemon (looper_obj, daemon_task, "thread_profiler");
+  }
+
+  //
+  // profiler_daemon_destroy () - stop the daemon and leave a final dump behind
+  //
+  void
+  profiler_daemon_destroy (void)
+  {
+    if (Profiler_daemon == NULL)
+      {
+	return;
+      }
+
+    get_manager ()->destroy_daemon (Profiler_daemon);
+
+    std::unique_lock<std::mutex> lock (Profiler_samples_mutex);
+    profiler_dump ();
+    Profiler_samples.clear ();
+  }
+} // namespace cubthread
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * thread_profiler - built-in sampling profiler for server threads
+ *
+ * A daemon periodically samples the state of every live thread entry and aggregates the samples in memory. The
+ * aggregate is dumped in collapsed-stack format (one "frame;frame;frame count" line per distinct state) to
+ * <db_name>_profiler.collapsed in the server log directory, so the usual flamegraph tooling can render it.
+ *
+ * Sampling is off by default; it is controlled at runtime through the sampling_profiler_interval_in_msecs system
+ * parameter.
+ */
+
+#ifndef _THREAD_PROFILER_HPP_
+#define _THREAD_PROFILER_HPP_
+
+#if !defined (SERVER_MODE)
+#error Wrong module
+#endif // not SERVER_MODE
+
+namespace cubthread
+{
+  void profiler_daemon_init (const char *db_name);
+  void profiler_daemon_destroy (void);
+} // namespace cubthread
+
+#endif // _THREAD_PROFILER_HPP_
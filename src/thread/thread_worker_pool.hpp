@@ -124,11 +124,24 @@ namespace cubthread
   //          note: 3.2. and 3.3. together is an atomic operation (protected by mutex)
   //          Worker stops if waiting for new task times out (and becomes inactive).
   //
+  //    work stealing (optional):
+  //          when the pool is created with work_stealing enabled and a worker finds its own core's queue empty, it
+  //          tries to steal one queued task from a sibling core before becoming available. this keeps workers busy
+  //          when task costs are skewed and round robin dispatch piles long tasks on some cores while others idle.
+  //          victims are probed starting from a rotating offset so idle workers do not all hit the same core.
+  //
   //    NOTE: core class is private nested to worker pool and cannot be instantiated outside it.
   //          worker class is private nested to core class.
   //
   //  todo:
   //    [Optional] Define a way to stop worker pool, but to finish executing everything it has in queue.
+  //    [Optional] Suspendable tasks: a task blocked on page i/o (pgbuf_fix) keeps its worker thread parked for the
+  //               whole wait, so effective parallelism drops during cold-cache periods. parking the task instead
+  //               requires saving its full execution state: tasks block deep inside the storage layer with page
+  //               latches and critical sections held, and the thread identity (THREAD_ENTRY, tran_index bindings) is
+  //               woven through every layer, so a stackless await point cannot be retrofitted and fileio has no
+  //               asynchronous completion path to resume from. until the i/o stack offers one, the mitigations are
+  //               read-ahead (pgbuf_prefetch_range) and work stealing, which keep the remaining workers fed.
   //
   template <typename Context>
   class worker_pool
@@ -143,7 +156,7 @@ namespace cubthread
 
       worker_pool (std::size_t pool_size, std::size_t task_max_count, context_manager_type &context_mgr,
 		   const char *name, std::size_t core_count = 1, bool debug_logging = false, bool pool_threads = false,
-		   wait_seconds wait_for_task_time = std::chrono::seconds (5));
+		   wait_seconds wait_for_task_time = std::chrono::seconds (5), bool work_stealing = false);
       ~worker_pool ();
 
       // try to execute task; executes only if the maximum number of tasks is not reached.
@@ -177,6 +190,12 @@ namespace cubthread
       // get the number of cores
       std::size_t get_core_count (void) const;
 
+      // limit how many workers may be busy at once; new tasks over the limit are queued even while free workers
+      // exist. clamped to [core count, maximum worker count]; the default is the maximum worker count. queued tasks
+      // are always drained by busy workers finishing, so lowering the limit cannot strand tasks.
+      void set_active_limit (std::size_t limit);
+      std::size_t get_active_limit (void) const;
+
       // get worker pool statistics
       // note: the statistics are collected from all cores and all their workers adding up all local statistics
       void get_stats (cubperf::stat_value *stats_out) const;
@@ -259,6 +278,12 @@ namespace cubthread
       // transition time period between active and inactive
       wait_seconds m_wait_for_task_time;
 
+      // true to let idle workers steal queued tasks from sibling cores
+      bool m_work_stealing;
+
+      // cap on busy workers; see set_active_limit
+      std::atomic<std::size_t> m_active_limit;
+
       std::string m_name;
   };
 
@@ -306,6 +331,9 @@ namespace cubthread
       // worker management
       // get a task or add worker to free active list (still running, but ready to execute another task)
       task_type *get_task_or_become_available (worker &worker_arg);
+      // pop a queued task without blocking; returns NULL if the queue is empty or its mutex is contended.
+      // called by sibling cores when work stealing is enabled
+      task_type *try_pop_queued_task (void);
       void become_available (worker &worker_arg);
       // is worker available?
       void check_worker_not_available (const worker &worker_arg);
@@ -327,6 +355,9 @@ namespace cubthread
       core ();
       ~core (void);
 
+      // try to steal one queued task from sibling cores; returns NULL if nothing could be stolen
+      task_type *steal_task_from_sibling (void);
+
       worker_pool_type *m_parent_pool;                // pointer to parent pool
       std::size_t m_max_workers;                      // maximum number of workers running at once
       worker *m_worker_array;                         // all core workers
@@ -535,7 +566,8 @@ namespace cubthread
   template <typename Context>
   worker_pool<Context>::worker_pool (std::size_t pool_size, std::size_t task_max_count,
 				     context_manager_type &context_mgr, const char *name, std::size_t core_count,
-				     bool debug_log, bool pool_threads, wait_seconds wait_for_task_time)
+				     bool debug_log, bool pool_threads, wait_seconds wait_for_task_time,
+				     bool work_stealing)
     : m_max_workers (pool_size)
     , m_task_max_count (task_max_count)
     , m_task_count (0)
@@ -547,6 +579,8 @@ namespace cubthread
     , m_log (debug_log)
     , m_pool_threads (pool_threads)
     , m_wait_for_task_time (wait_for_task_time)
+    , m_work_stealing (work_stealing)
+    , m_active_limit (pool_size)
     , m_name (name == NULL ? "" : name)
   {
     // initialize cores; we'll try to distribute pool evenly to all cores. if core count is not fully contained in
@@ -726,6 +760,28 @@ namespace cubthread
     return m_core_count;
   }
 
+  template<typename Context>
+  void
+  worker_pool<Context>::set_active_limit (std::size_t limit)
+  {
+    if (limit < m_core_count)
+      {
+	limit = m_core_count;
+      }
+    if (limit > m_max_workers)
+      {
+	limit = m_max_workers;
+      }
+    m_active_limit = limit;
+  }
+
+  template<typename Context>
+  std::size_t
+  worker_pool<Context>::get_active_limit (void) const
+  {
+    return m_active_limit;
+  }
+
   template<typename Context>
   void
   worker_pool<Context>::get_stats (cubperf::stat_value *stats_out) const
@@ -917,7 +973,12 @@ namespace cubthread
 	return;
       }
 
-    if (m_available_count > 0)
+    // this core's share of the pool active worker limit; equal or above this core's worker count unless the limit
+    // was lowered with set_active_limit
+    std::size_t core_active_limit =
+	    (m_parent_pool->m_active_limit.load () + m_parent_pool->m_core_count - 1) / m_parent_pool->m_core_count;
+
+    if (m_available_count > 0 && m_max_workers - m_available_count < core_active_limit)
       {
 	refp = m_available_workers[--m_available_count];
 	ulock.unlock ();
@@ -927,7 +988,8 @@ namespace cubthread
       }
     else
       {
-	// save to queue
+	// save to queue; when over the active limit, at least core_active_limit workers are busy on this core and
+	// will drain the queue as they finish
 	m_task_queue.push (task_p);
       }
   }
@@ -946,11 +1008,88 @@ namespace cubthread
 	return task_p;
       }
 
+    if (m_parent_pool->m_work_stealing)
+      {
+	// own queue is empty; try to take a queued task from a sibling core before going idle. the own mutex must be
+	// released first to keep the lock order single-core.
+	ulock.unlock ();
+
+	task_type *task_p = steal_task_from_sibling ();
+	if (task_p != NULL)
+	  {
+	    return task_p;
+	  }
+
+	ulock.lock ();
+
+	// a task may have been queued here while stealing was attempted
+	if (!m_task_queue.empty ())
+	  {
+	    task_p = m_task_queue.front ();
+	    assert (task_p != NULL);
+	    m_task_queue.pop ();
+	    return task_p;
+	  }
+      }
+
     m_available_workers[m_available_count++] = &worker_arg;
     assert (m_available_count <= m_max_workers);
     return NULL;
   }
 
+  template <typename Context>
+  typename worker_pool<Context>::core::task_type *
+  worker_pool<Context>::core::try_pop_queued_task (void)
+  {
+    std::unique_lock<std::mutex> ulock (m_workers_mutex, std::try_to_lock);
+
+    if (!ulock.owns_lock () || m_task_queue.empty ())
+      {
+	// don't wait on a contended victim; the thief moves on to the next core
+	return NULL;
+      }
+
+    task_type *task_p = m_task_queue.front ();
+    assert (task_p != NULL);
+    m_task_queue.pop ();
+    return task_p;
+  }
+
+  template <typename Context>
+  typename worker_pool<Context>::core::task_type *
+  worker_pool<Context>::core::steal_task_from_sibling (void)
+  {
+    worker_pool_type &pool = *m_parent_pool;
+
+    if (pool.m_core_count <= 1)
+      {
+	return NULL;
+      }
+
+    // rotate the first victim so concurrent thieves spread over different cores
+    static std::atomic<std::size_t> steal_rotation_counter (0);
+
+    std::size_t my_index = static_cast<std::size_t> (this - pool.m_core_array);
+    std::size_t start = steal_rotation_counter++ % pool.m_core_count;
+
+    for (std::size_t it = 0; it < pool.m_core_count; it++)
+      {
+	std::size_t victim_index = (start + it) % pool.m_core_count;
+	if (victim_index == my_index)
+	  {
+	    continue;
+	  }
+
+	task_type *task_p = pool.m_core_array[victim_index].try_pop_queued_task ();
+	if (task_p != NULL)
+	  {
+	    return task_p;
+	  }
+      }
+
+    return NULL;
+  }
+
   template <typename Context>
   void
   worker_pool<Context>::core::become_available (worker &worker_arg)
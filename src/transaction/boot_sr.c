@@ -76,6 +76,9 @@
 #include "scan_manager.h"
 #include "slotted_page.h"
 #include "thread_manager.hpp"
+#if defined (SERVER_MODE)
+#include "thread_profiler.hpp"
+#endif /* SERVER_MODE */
 #include "double_write_buffer.h"
 #include "xasl_cache.h"
 #include "log_volids.hpp"
@@ -83,10 +86,15 @@
 #include "tde.h"
 #include "porting.h"
 #include "log_manager.h"
+#include "file_io.h"
 
 #if defined(SERVER_MODE)
 #include "connection_sr.h"
+#include "internal_tasks_worker_pool.hpp"
 #include "server_support.h"
+#include "thread_entry_task.hpp"
+
+#include <atomic>
 #endif /* SERVER_MODE */
 
 #if defined(WINDOWS)
@@ -191,7 +199,12 @@ static void boot_find_rest_temp_volumes (THREAD_ENTRY * thread_p, VOLID volid,
 					 int (*fun) (THREAD_ENTRY * thread_p, VOLID xvolid, const char *vlabel),
 					 bool forward_dir, bool check_before_access);
 static int boot_check_permanent_volumes (THREAD_ENTRY * thread_p);
+static int boot_check_volume_label (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel);
 static int boot_mount (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *ignore_arg);
+#if defined (SERVER_MODE)
+static int boot_mount_without_label_check (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *args);
+static int boot_mount_rest_volumes (THREAD_ENTRY * thread_p, BO_RESTART_ARG * r_args);
+#endif /* SERVER_MODE */
 static char *boot_find_new_db_path (char *db_pathbuf, const char *fileof_vols_and_wherepaths);
 static int boot_create_all_volumes (THREAD_ENTRY * thread_p, const BOOT_CLIENT_CREDENTIAL * client_credential,
 				    const char *db_comments, DKNPAGES db_npages, const char *file_addmore_vols,
@@ -1330,30 +1343,21 @@ boot_check_permanent_volumes (THREAD_ENTRY * thread_p)
 }
 
 /*
- * boot_mount () - mount given volume
+ * boot_check_volume_label () - compare the label stored in the volume header
+ *                              with the label the volume was mounted under
  *
  * return : NO_ERROR if all OK, ER_ status otherwise
  *
  *   volid(in): Volume identifier
  *   vlabel(in): Volume label
- *   arg_ignore: Unused
  */
 static int
-boot_mount (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *ignore_arg)
+boot_check_volume_label (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel)
 {
   char check_vlabel[PATH_MAX];
-  int vdes;
-
-  vdes = fileio_mount (thread_p, boot_Db_full_name, vlabel, volid, false, false);
-  if (vdes == NULL_VOLDES)
-    {
-      return ER_FAILED;
-    }
 
-  /* Check the label and give a warning if labels are not the same */
   if (xdisk_get_fullname (thread_p, volid, check_vlabel) == NULL)
     {
-      fileio_dismount (thread_p, vdes);
       return ER_FAILED;
     }
 
@@ -1376,6 +1380,236 @@ boot_mount (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *igno
   return NO_ERROR;
 }
 
+/*
+ * boot_mount () - mount given volume
+ *
+ * return : NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   volid(in): Volume identifier
+ *   vlabel(in): Volume label
+ *   arg_ignore: Unused
+ */
+static int
+boot_mount (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *ignore_arg)
+{
+  int vdes;
+  int error_code;
+
+  vdes = fileio_mount (thread_p, boot_Db_full_name, vlabel, volid, false, false);
+  if (vdes == NULL_VOLDES)
+    {
+      return ER_FAILED;
+    }
+
+  /* Check the label and give a warning if labels are not the same */
+  error_code = boot_check_volume_label (thread_p, volid, vlabel);
+  if (error_code == ER_FAILED)
+    {
+      fileio_dismount (thread_p, vdes);
+    }
+
+  return error_code;
+}
+
+#if defined (SERVER_MODE)
+/* BOOT_MOUNT_CHECK_JOB - a volume mounted with its header label check
+ * deferred, so the header reads can run in parallel once every volume is
+ * open */
+typedef struct boot_mount_check_job BOOT_MOUNT_CHECK_JOB;
+struct boot_mount_check_job
+{
+  VOLID volid;			/* volume identifier */
+  char vlabel[PATH_MAX];	/* label the volume was mounted under */
+};
+
+typedef struct boot_mount_check_jobs BOOT_MOUNT_CHECK_JOBS;
+struct boot_mount_check_jobs
+{
+  BOOT_MOUNT_CHECK_JOB *jobs;	/* volumes waiting for their label check */
+  int nvols;			/* number of deferred volumes */
+  int max_vols;			/* allocated length of jobs */
+};
+
+/*
+ * boot_mount_without_label_check () - mount given volume and defer its label
+ *                                     check
+ *
+ * return : NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   volid(in): Volume identifier
+ *   vlabel(in): Volume label
+ *   args(in/out): the BOOT_MOUNT_CHECK_JOBS collector
+ */
+static int
+boot_mount_without_label_check (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *args)
+{
+  BOOT_MOUNT_CHECK_JOBS *jobs_p = (BOOT_MOUNT_CHECK_JOBS *) args;
+  int vdes;
+  int error_code;
+
+  vdes = fileio_mount (thread_p, boot_Db_full_name, vlabel, volid, false, false);
+  if (vdes == NULL_VOLDES)
+    {
+      return ER_FAILED;
+    }
+
+  if (jobs_p->nvols >= jobs_p->max_vols)
+    {
+      BOOT_MOUNT_CHECK_JOB *jobs_new;
+      int max_new = (jobs_p->max_vols == 0) ? 32 : jobs_p->max_vols * 2;
+
+      jobs_new = (BOOT_MOUNT_CHECK_JOB *) realloc (jobs_p->jobs, max_new * sizeof (BOOT_MOUNT_CHECK_JOB));
+      if (jobs_new == NULL)
+	{
+	  /* cannot defer; check the label right away like boot_mount () */
+	  error_code = boot_check_volume_label (thread_p, volid, vlabel);
+	  if (error_code == ER_FAILED)
+	    {
+	      fileio_dismount (thread_p, vdes);
+	    }
+	  return error_code;
+	}
+      jobs_p->jobs = jobs_new;
+      jobs_p->max_vols = max_new;
+    }
+
+  jobs_p->jobs[jobs_p->nvols].volid = volid;
+  strncpy (jobs_p->jobs[jobs_p->nvols].vlabel, vlabel, PATH_MAX - 1);
+  jobs_p->jobs[jobs_p->nvols].vlabel[PATH_MAX - 1] = '\0';
+  jobs_p->nvols++;
+
+  return NO_ERROR;
+}
+
+// *INDENT-OFF*
+class boot_volume_check_context : public cubthread::entry_manager
+{
+  public:
+    std::atomic<int> m_checks_done = {0};
+    std::atomic<int> m_failed_index = {-1};
+
+  protected:
+    void on_create (context_type &context) override
+    {
+      context.claim_system_worker ();
+    }
+};
+
+class boot_volume_check_task : public cubthread::entry_task
+{
+  public:
+    boot_volume_check_task () = delete;
+    boot_volume_check_task (boot_volume_check_context &context, const BOOT_MOUNT_CHECK_JOB &job, int index)
+      : m_context (context)
+      , m_job (job)
+      , m_index (index)
+    {
+    }
+
+    void execute (cubthread::entry &thread_ref) override
+    {
+      if (boot_check_volume_label (&thread_ref, m_job.volid, m_job.vlabel) != NO_ERROR)
+	{
+	  /* remember one failing volume; the boot thread repeats its check to raise the error itself */
+	  int expected = -1;
+	  m_context.m_failed_index.compare_exchange_strong (expected, m_index);
+	  er_clear ();
+	}
+      m_context.m_checks_done++;
+    }
+
+  private:
+    boot_volume_check_context &m_context;
+    const BOOT_MOUNT_CHECK_JOB &m_job;
+    int m_index;
+};
+// *INDENT-ON*
+
+/*
+ * boot_mount_rest_volumes () - mount the rest of the volumes, overlapping
+ *                              their header label checks
+ *
+ * return : NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   r_args(in): restart argument structure contains various options
+ *
+ * Note: The volumes are first only opened, which also resolves the volume
+ *       chain when no volume info file exists; the label checks, which each
+ *       read the volume header page, then run in parallel on a transient
+ *       worker pool.
+ */
+static int
+boot_mount_rest_volumes (THREAD_ENTRY * thread_p, BO_RESTART_ARG * r_args)
+{
+  BOOT_MOUNT_CHECK_JOBS jobs = { NULL, 0, 0 };
+  cubthread::entry_workpool *pool = NULL;
+  int nworkers;
+  int error_code;
+  int i;
+
+  error_code = boot_find_rest_volumes (thread_p, r_args, LOG_DBFIRST_VOLID, boot_mount_without_label_check, &jobs);
+  if (error_code != NO_ERROR || jobs.nvols == 0)
+    {
+      goto end;
+    }
+
+  nworkers = MIN (jobs.nvols, fileio_os_sysconf ());
+  if (nworkers > 1)
+    {
+      // *INDENT-OFF*
+      boot_volume_check_context check_context;
+
+      pool = cubthread::get_manager ()->create_worker_pool (nworkers, jobs.nvols, "Boot volume check pool",
+							    &check_context, 1, false);
+      if (pool != NULL)
+	{
+	  for (i = 0; i < jobs.nvols; i++)
+	    {
+	      cubthread::get_manager ()->push_task (pool, new boot_volume_check_task (check_context, jobs.jobs[i], i));
+	    }
+
+	  while (check_context.m_checks_done < jobs.nvols)
+	    {
+	      thread_sleep (10);
+	    }
+
+	  cubthread::get_manager ()->destroy_worker_pool (pool);
+	  pool = NULL;
+
+	  if (check_context.m_failed_index >= 0)
+	    {
+	      /* repeat the failing check on this thread so the error is set where boot expects it */
+	      i = check_context.m_failed_index;
+	      error_code = boot_check_volume_label (thread_p, jobs.jobs[i].volid, jobs.jobs[i].vlabel);
+	      if (error_code == NO_ERROR)
+		{
+		  error_code = ER_FAILED;
+		}
+	    }
+	  goto end;
+	}
+      // *INDENT-ON*
+    }
+
+  /* few volumes or no pool available; check serially */
+  for (i = 0; i < jobs.nvols; i++)
+    {
+      error_code = boot_check_volume_label (thread_p, jobs.jobs[i].volid, jobs.jobs[i].vlabel);
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+    }
+
+end:
+  if (jobs.jobs != NULL)
+    {
+      free_and_init (jobs.jobs);
+    }
+  return error_code;
+}
+#endif /* SERVER_MODE */
+
 #if !defined(WINDOWS)
 static jmp_buf boot_Init_server_jmpbuf;
 #endif
@@ -2430,7 +2664,12 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
 
   /* Find the rest of the volumes and mount them */
 
+#if defined (SERVER_MODE)
+  /* open every volume first, then run the header label checks in parallel */
+  error_code = boot_mount_rest_volumes (thread_p, from_backup ? r_args : NULL);
+#else /* SERVER_MODE */
   error_code = boot_find_rest_volumes (thread_p, from_backup ? r_args : NULL, LOG_DBFIRST_VOLID, boot_mount, NULL);
+#endif /* !SERVER_MODE */
   if (error_code != NO_ERROR)
     {
       goto error;
@@ -2497,6 +2736,9 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
   pgbuf_daemons_init ();
   dwb_daemons_init ();
   cdc_daemons_init ();
+  heap_compaction_daemon_init ();
+  stats_auto_update_daemon_init ();
+  cubthread::profiler_daemon_init (boot_db_name ());
 #endif /* SERVER_MODE */
 
   // after recovery we can boot vacuum
@@ -2766,6 +3008,9 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       log_set_db_restore_time (thread_p, (INT64) (time (0)));
     }
 
+  /* repopulate the page buffer with the page set resident at the last shutdown, before accepting connections */
+  (void) pgbuf_warm_start_restore (thread_p, boot_Db_full_name);
+
   /* server status could be changed by css_change_ha_server_state */
   if (boot_Server_status == BOOT_SERVER_DOWN)
     {
@@ -2808,7 +3053,10 @@ error:
   vacuum_stop_master (thread_p);
 
 #if defined(SERVER_MODE)
+  cubthread::profiler_daemon_destroy ();
   cdc_daemons_destroy ();
+  stats_auto_update_daemon_destroy ();
+  heap_compaction_daemon_destroy ();
 
   pgbuf_daemons_destroy ();
   dwb_daemons_destroy ();
@@ -3112,6 +3360,12 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   fpcache_finalize (thread_p);
   session_states_finalize (thread_p);
 
+#if defined(SERVER_MODE)
+  /* query teardown hands temporary file reclamation to the internal tasks worker pool; join it so no worker is still
+   * destroying files while the temporary volumes are removed. tasks dropped unexecuted are covered by the removal. */
+  cubthread::internal_tasks_worker_pool::finalize ();
+#endif /* SERVER_MODE */
+
   (void) boot_remove_all_temp_volumes (thread_p, REMOVE_TEMP_VOL_DEFAULT_ACTION);
 
   // ha delays are registered and logged, and must be stopped before vacuum master
@@ -3122,7 +3376,13 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   // hopefully, nothing else follows
   vacuum_stop_master (thread_p);
 
+  /* remember the resident page set for the next restart */
+  (void) pgbuf_warm_start_dump (thread_p, true);
+
 #if defined(SERVER_MODE)
+  cubthread::profiler_daemon_destroy ();
+  stats_auto_update_daemon_destroy ();
+  heap_compaction_daemon_destroy ();
   pgbuf_daemons_destroy ();
   cdc_daemons_destroy ();
 #endif
@@ -102,6 +102,11 @@ struct locator_global
 
 static LOCATOR_GLOBAL locator_Keep;
 
+/* One-slot per-thread front of the copy area pool. A statement that forces many objects (a multi-row INSERT, an
+ * UPDATE of many rows) allocates and frees a copy area per object; this slot lets all of them reuse the same area
+ * without taking the pool mutex on every object. */
+static thread_local LC_COPYAREA *locator_Thread_copy_area = NULL;
+
 static LC_COPYAREA packed_req_area_ptrs[LOCATOR_NKEEP_LIMIT];
 
 static bool locator_Is_initialized = false;
@@ -422,6 +427,20 @@ locator_allocate_copy_area_by_length (int min_length)
 
   min_length = DB_ALIGN (min_length, network_pagesize);
 
+  /* try the per-thread slot first; no latch is needed for it */
+  if (locator_Thread_copy_area != NULL && locator_Thread_copy_area->length >= min_length)
+    {
+      copyarea = locator_Thread_copy_area;
+      locator_Thread_copy_area = NULL;
+      min_length = copyarea->length;
+      MEM_REGION_SCRAMBLE (copyarea->mem, copyarea->length);
+
+      copyarea->mem = (char *) copyarea + sizeof (*copyarea);
+      copyarea->length = min_length;
+
+      return copyarea;
+    }
+
   /*
    * Do we have an area of given or larger length cached ?
    */
@@ -543,6 +562,15 @@ locator_free_copy_area (LC_COPYAREA * copyarea)
       return;
     }
 
+  /* keep the area in the per-thread slot when it is empty, so the next allocation by this thread skips the pool
+   * mutex; the slot holds at most one bounded-size area per thread */
+  if (locator_Thread_copy_area == NULL)
+    {
+      MEM_REGION_SCRAMBLE (copyarea->mem, copyarea->length);
+      locator_Thread_copy_area = copyarea;
+      return;
+    }
+
   rv = pthread_mutex_lock (&locator_Keep.copy_areas.lock);
   if (locator_Keep.copy_areas.number < LOCATOR_NKEEP_LIMIT)
     {
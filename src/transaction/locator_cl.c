@@ -113,6 +113,14 @@ struct locator_list_keep_mops
 
 static volatile sig_atomic_t lc_Is_siginterrupt = false;
 
+/* Schema generation based trust of cached class objects (see locator_can_skip_fetch_from_server). The server counter
+ * is fetched at most once per transaction; while it matches the remembered value, every cached class object is known
+ * to be identical to the stored one. */
+static INT64 lc_Class_cache_generation = -1;
+static int lc_Class_cache_validity = -1;	/* -1: not checked this transaction, 0: stale, 1: valid */
+static INT64 lc_Auth_cache_generation = -1;
+static int lc_Auth_cache_validity = -1;	/* -1: not checked this transaction, 0: stale, 1: valid */
+
 #if defined(CUBRID_DEBUG)
 static void locator_dump_mflush (FILE * out_fp, LOCATOR_MFLUSH_CACHE * mflush);
 #endif /* CUBRID_DEBUG */
@@ -168,6 +176,8 @@ static int locator_internal_flush_instance (MOP inst_mop, bool decache);
 static int locator_add_to_oidset_when_temp_oid (MOP mop, void *data);
 
 static bool locator_can_skip_fetch_from_server (MOP mop, LOCK * lock, LC_FETCH_VERSION_TYPE fetch_version_type);
+static bool locator_is_class_cache_usable (void);
+static bool locator_refresh_cache_generations (void);
 
 /*
  * locator_reserve_class_name () -
@@ -6938,6 +6948,112 @@ locator_can_skip_fetch_from_server (MOP mop, LOCK * lock, LC_FETCH_VERSION_TYPE
       return ws_is_mop_fetched_with_current_snapshot (mop);
     }
 
+  if (class_mop == sm_Root_class_mop && *lock == S_LOCK && locator_is_class_cache_usable ())
+    {
+      /* A read access to a cached class: while the server schema generation is unchanged the cached copy is identical
+       * to the stored one, so the fetch - whose only remaining purpose is the shared lock - can be skipped.
+       * Concurrent DDL is detected by the next generation check instead of being blocked by the lock. */
+      return true;
+    }
+
   /* We are here because we need to upgrade lock on object. */
   return false;
 }
+
+/*
+ * locator_refresh_cache_generations () - fetch the server generation counters once per transaction
+ *
+ * return: true when the counters are known for the current transaction
+ *
+ * Note: Both generation counters are fetched with one lightweight request on the first cache validation of each
+ *       transaction; comparing them with the remembered values tells whether the cached class objects and the
+ *       computed privilege caches are still identical to what the server stores.
+ */
+static bool
+locator_refresh_cache_generations (void)
+{
+  INT64 schema_generation, authorization_generation;
+
+  if (lc_Class_cache_validity >= 0 && lc_Auth_cache_validity >= 0)
+    {
+      return true;
+    }
+
+  if (locator_get_cache_generations (&schema_generation, &authorization_generation) != NO_ERROR)
+    {
+      return false;
+    }
+
+  lc_Class_cache_validity = (schema_generation == lc_Class_cache_generation) ? 1 : 0;
+  lc_Class_cache_generation = schema_generation;
+  lc_Auth_cache_validity = (authorization_generation == lc_Auth_cache_generation) ? 1 : 0;
+  lc_Auth_cache_generation = authorization_generation;
+
+  return true;
+}
+
+/*
+ * locator_is_class_cache_usable () - can cached class objects be trusted without a locator round trip?
+ *
+ * return: true when the server schema generation is known to be unchanged
+ *
+ * Note: Only active when the use_class_cache_generation system parameter is enabled. When the schema generation still
+ *       matches the remembered value, no class object was updated or dropped since, so every cached class copy is
+ *       identical to the stored one and the per-class locator fetches can be skipped.
+ */
+static bool
+locator_is_class_cache_usable (void)
+{
+  if (!prm_get_bool_value (PRM_ID_USE_CLASS_CACHE_GENERATION))
+    {
+      return false;
+    }
+
+  if (!locator_refresh_cache_generations ())
+    {
+      return false;
+    }
+
+  return lc_Class_cache_validity > 0;
+}
+
+/*
+ * locator_is_authorization_cache_usable () - can the computed privilege caches be carried across the transaction
+ *                                            boundary?
+ *
+ * return: true when the server authorization generation is known to be unchanged
+ *
+ * Note: Only active when the use_class_cache_generation system parameter is enabled. When the authorization
+ *       generation still matches the remembered value, no db_user, db_authorization or _db_auth instance was forced
+ *       since, so the privilege bits computed from them are still correct.
+ */
+bool
+locator_is_authorization_cache_usable (void)
+{
+  if (!prm_get_bool_value (PRM_ID_USE_CLASS_CACHE_GENERATION))
+    {
+      return false;
+    }
+
+  if (!locator_refresh_cache_generations ())
+    {
+      return false;
+    }
+
+  return lc_Auth_cache_validity > 0;
+}
+
+/*
+ * locator_reset_class_cache_validation () - forget the class cache validation of the ending transaction
+ *
+ * return: nothing
+ *
+ * Note: Called at transaction boundaries so that the next class access or authorization check revalidates the cached
+ *       objects against the server generation counters.
+ */
+void
+locator_reset_class_cache_validation (void)
+{
+  lc_Class_cache_validity = -1;
+  lc_Auth_cache_validity = -1;
+}
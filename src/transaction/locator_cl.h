@@ -124,6 +124,8 @@ extern LIST_MOPS *locator_get_all_nested_mops (MOP mop, int prune_level, DB_FETC
 extern void locator_free_list_mops (LIST_MOPS * mops);
 extern void locator_synch_isolation_incons (void);
 extern void locator_set_sig_interrupt (int set);
+extern void locator_reset_class_cache_validation (void);
+extern bool locator_is_authorization_cache_usable (void);
 extern MOBJ locator_create_heap_if_needed (MOP class_mop, bool reuse_oid);
 extern MOBJ locator_has_heap (MOP class_mop);
 
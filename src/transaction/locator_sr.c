@@ -51,6 +51,7 @@
 #include "object_primitive.h"
 #include "object_representation.h"
 #include "object_representation_sr.h"
+#include "oid.h"
 #include "query_executor.h"
 #include "query_manager.h"
 #include "query_reevaluation.hpp"
@@ -128,6 +129,17 @@ static const INT32 locator_Pseudo_pageid_first = -2;
 static const INT32 locator_Pseudo_pageid_last = -0x7FFF;
 static INT32 locator_Pseudo_pageid_crt = -2;
 
+/* Bumped whenever a class object is updated or deleted. Clients compare it against the value remembered with their
+ * workspace to decide whether a cached class object can still be trusted without a locator round trip (see
+ * locator_can_skip_fetch_from_server on the client side). */
+static volatile INT64 locator_Schema_generation = 0;
+
+/* Companion counter for the authorization catalog: bumped whenever an instance of db_user, db_authorization or
+ * _db_auth is stored or deleted, so clients can keep their computed privilege caches while it is unchanged (see
+ * au_reset_authorization_caches on the client side). */
+static volatile INT64 locator_Authorization_generation = 0;
+
+static void locator_check_authorization_change (const OID * class_oid);
 static int locator_permoid_class_name (THREAD_ENTRY * thread_p, const char *classname, const OID * class_oid);
 static int locator_defence_drop_class_name_entry (const void *name, void *ent, void *args);
 static int locator_force_drop_class_name_entry (const void *name, void *ent, void *args);
@@ -139,6 +151,7 @@ static SCAN_CODE locator_lock_and_return_object (THREAD_ENTRY * thread_p, LOCATO
 						 OID * class_oid, OID * oid, int chn, LOCK lock_mode,
 						 SCAN_OPERATION_TYPE op_type);
 static int locator_find_lockset_missing_class_oids (THREAD_ENTRY * thread_p, LC_LOCKSET * lockset);
+static int locator_compare_reqobjs_by_page (const void *reqobj1, const void *reqobj2);
 static SCAN_CODE locator_return_object_assign (THREAD_ENTRY * thread_p, LOCATOR_RETURN_NXOBJ * assign, OID * class_oid,
 					       OID * oid, int chn, int guess_chn, SCAN_CODE scan, int tran_index);
 static LC_LOCKSET *locator_all_reference_lockset (THREAD_ENTRY * thread_p, OID * oid, int prune_level, LOCK inst_lock,
@@ -198,6 +211,7 @@ static DISK_ISVALID locator_check_unique_btree_entries (THREAD_ENTRY * thread_p,
 static int locator_eval_filter_predicate (THREAD_ENTRY * thread_p, BTID * btid, OR_PREDICATE * or_pred, OID * class_oid,
 					  OID ** inst_oids, int num_insts, RECDES ** recs, DB_LOGICAL * results);
 static bool locator_was_index_already_applied (HEAP_CACHE_ATTRINFO * index_attrinfo, BTID * btid, int pos);
+static bool locator_can_skip_index_update (THREAD_ENTRY * thread_p, OID * class_oid, ATTR_ID * att_id, int n_att_id);
 static LC_FIND_CLASSNAME xlocator_reserve_class_name (THREAD_ENTRY * thread_p, const char *classname, OID * class_oid);
 
 static int locator_filter_errid (THREAD_ENTRY * thread_p, int num_ignore_error_count, int *ignore_error_list);
@@ -3033,6 +3047,22 @@ error:
   return error_code;
 }
 
+/*
+ * locator_compare_reqobjs_by_page () - Compare two requested objects by heap location
+ *
+ * return: 0 (equal), 1 (reqobj1 > reqobj2), -1 (reqobj1 < reqobj2)
+ *
+ *   reqobj1(in): Pointer to first LC_LOCKSET_REQOBJ
+ *   reqobj2(in): Pointer to second LC_LOCKSET_REQOBJ
+ *
+ * Note: qsort comparator used to group the objects of a lockset by heap page before fetching them.
+ */
+static int
+locator_compare_reqobjs_by_page (const void *reqobj1, const void *reqobj2)
+{
+  return oid_compare (&((const LC_LOCKSET_REQOBJ *) reqobj1)->oid, &((const LC_LOCKSET_REQOBJ *) reqobj2)->oid);
+}
+
 /*
  * xlocator_fetch_lockset () - Lock and fetch many objects
  *
@@ -3083,6 +3113,16 @@ xlocator_fetch_lockset (THREAD_ENTRY * thread_p, LC_LOCKSET * lockset, LC_COPYAR
 	{
 	  goto error;
 	}
+
+      if (lockset->num_reqobjs > 1)
+	{
+	  /* Group the requested objects by heap page: the scan cache below keeps the last accessed page fixed, so
+	   * neighbouring objects are returned without fixing their page again. The requests identify objects by OID
+	   * and class_index travels with each entry, so the fetch order is free. Note that the reply does not carry
+	   * the objects array back to a client, and the one caller that shares the array (standalone mode) searches
+	   * it by OID only. */
+	  qsort (lockset->objects, lockset->num_reqobjs, sizeof (LC_LOCKSET_REQOBJ), locator_compare_reqobjs_by_page);
+	}
     }
 
   /* Start a scan cursor for getting several classes */
@@ -4825,6 +4865,28 @@ error3:
   goto end;
 }
 
+/*
+ * locator_check_authorization_change () - bump the authorization generation when an authorization catalog instance
+ *                                         is stored or deleted
+ *
+ * return: nothing
+ *
+ *   class_oid(in): class of the object being forced
+ *
+ * Note: A spurious bump (e.g. for an operation that later fails) is harmless; clients just recompute their privilege
+ *       caches once.
+ */
+static void
+locator_check_authorization_change (const OID * class_oid)
+{
+  if (oid_check_cached_class_oid (OID_CACHE_USER_CLASS_ID, class_oid)
+      || oid_check_cached_class_oid (OID_CACHE_AUTH_CLASS_ID, class_oid)
+      || oid_check_cached_class_oid (OID_CACHE_CLASSAUTH_CLASS_ID, class_oid))
+    {
+      ATOMIC_INC_64 (&locator_Authorization_generation, 1);
+    }
+}
+
 /*
  * locator_insert_force () - Insert the given object on this heap
  *
@@ -4946,6 +5008,8 @@ locator_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
 
   *force_count = 0;
 
+  locator_check_authorization_change (class_oid);
+
   /*
    * This is a new object. The object must be locked in exclusive mode,
    * once its OID is assigned. We just do it for the classes, the new
@@ -5339,6 +5403,8 @@ locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
 
   *force_count = 0;
 
+  locator_check_authorization_change (class_oid);
+
   repl_info.repl_info_type = repl_info_type;
   repl_info.need_replication = true;
   repl_info.info = NULL;
@@ -5347,6 +5413,10 @@ locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
     {
       HEAP_OPERATION_CONTEXT update_context;
 
+      /* a class object is about to change; invalidate client class caches (a spurious bump on failure only costs a
+       * cache refresh) */
+      ATOMIC_INC_64 (&locator_Schema_generation, 1);
+
       if (!OID_IS_ROOTOID (oid))
 	{
 	  /* Prevent any update on a TDE-encryted class if TDE is not loaded */
@@ -5870,8 +5940,9 @@ locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
 	    }
 	}
 
-      /* AN INSTANCE: Update indices if any */
-      if (has_index)
+      /* AN INSTANCE: Update indices if any. When the statement assigned no indexed attribute, every key is
+       * unchanged and the per-row index pass is skipped altogether. */
+      if (has_index && (scan != S_SUCCESS || !locator_can_skip_index_update (thread_p, class_oid, att_id, n_att_id)))
 	{
 	  if (scan == S_SUCCESS)
 	    {
@@ -6158,8 +6229,16 @@ locator_delete_force_internal (THREAD_ENTRY * thread_p, HFID * hfid, OID * oid,
       OID_SET_NULL (&class_oid);
     }
 
+  if (isold_object == true)
+    {
+      locator_check_authorization_change (&class_oid);
+    }
+
   if (isold_object == true && OID_IS_ROOTOID (&class_oid))
     {
+      /* a class object is being dropped; invalidate client class caches */
+      ATOMIC_INC_64 (&locator_Schema_generation, 1);
+
       /*
        * A CLASS: Remove class from catalog and
        *          remove any indices on that class
@@ -7647,7 +7726,9 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
 {
   int num_found;
   int i, num_btids;
-  HEAP_CACHE_ATTRINFO index_attrinfo;
+  HEAP_CACHE_ATTRINFO space_attrinfo;
+  HEAP_CACHE_ATTRINFO *index_attrinfo = NULL;
+  bool attrinfo_cached = false;
   BTID btid;
   DB_VALUE *key_dbvalue, *key_ins_del = NULL;
   DB_VALUE dbvalue;
@@ -7694,8 +7775,23 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
   /*
    *  Populate the index_attrinfo structure.
    *  Return the number of indexed attributes found.
+   *
+   *  A multi-row operation reuses the attribute cache kept in its scan cache, so the cache is built once per
+   *  statement instead of once per row.
    */
-  num_found = heap_attrinfo_start_with_index (thread_p, class_oid, NULL, &index_attrinfo, &idx_info);
+  if (scan_cache != NULL && (op_type == MULTI_ROW_UPDATE || op_type == MULTI_ROW_INSERT || op_type == MULTI_ROW_DELETE))
+    {
+      num_found = heap_scancache_get_index_attrinfo (thread_p, scan_cache, class_oid, 0, &index_attrinfo, &idx_info);
+      attrinfo_cached = (num_found > 0);
+    }
+  else
+    {
+      num_found = heap_attrinfo_start_with_index (thread_p, class_oid, NULL, &space_attrinfo, &idx_info);
+      if (num_found > 0)
+	{
+	  index_attrinfo = &space_attrinfo;
+	}
+    }
   num_btids = idx_info.num_btids;
 
   if (num_found == 0)
@@ -7715,7 +7811,7 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
    */
   if (idx_info.has_single_col)
     {
-      error_code = heap_attrinfo_read_dbvalues (thread_p, inst_oid, recdes, NULL, &index_attrinfo);
+      error_code = heap_attrinfo_read_dbvalues (thread_p, inst_oid, recdes, NULL, index_attrinfo);
       if (error_code != NO_ERROR)
 	{
 	  goto error;
@@ -7741,7 +7837,7 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
 
   for (i = 0; i < num_btids; i++)
     {
-      index = &(index_attrinfo.last_classrepr->indexes[i]);
+      index = &(index_attrinfo->last_classrepr->indexes[i]);
       or_pred = index->filter_predicate;
       if (or_pred && or_pred->pred_stream)
 	{
@@ -7761,7 +7857,7 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
        *  pointer to it.
        */
       key_dbvalue =
-	heap_attrvalue_get_key (thread_p, i, &index_attrinfo, recdes, &btid, &dbvalue, aligned_buf,
+	heap_attrvalue_get_key (thread_p, i, index_attrinfo, recdes, &btid, &dbvalue, aligned_buf,
 				(func_preds ? &func_preds[i] : NULL), NULL);
       if (key_dbvalue == NULL)
 	{
@@ -7769,7 +7865,7 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
 	  goto error;
 	}
 
-      if (i < 1 || !locator_was_index_already_applied (&index_attrinfo, &index->btid, i))
+      if (i < 1 || !locator_was_index_already_applied (index_attrinfo, &index->btid, i))
 	{
 	  if (scan_cache == NULL)
 	    {
@@ -7976,7 +8072,10 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
 
 error:
 
-  heap_attrinfo_end (thread_p, &index_attrinfo);
+  if (!attrinfo_cached)
+    {
+      heap_attrinfo_end (thread_p, index_attrinfo);
+    }
 
   if (key_dbvalue == &dbvalue)
     {
@@ -8157,6 +8256,81 @@ end:
   return error_code;
 }
 
+/*
+ * locator_can_skip_index_update () - Check if an update that assigned only the
+ *                                    given attributes can leave every index
+ *                                    untouched
+ *
+ * return: true if index maintenance can be skipped for this update
+ *
+ *   class_oid(in): Class object identifier
+ *   att_id(in): Updated attr id array
+ *   n_att_id(in): Length of the att_id array
+ *
+ * Note: When none of the assigned attributes participates in an index, the
+ *       old and new key of every index are identical and the whole per-row
+ *       index pass (building two index attribute caches, materializing and
+ *       comparing the keys of each index) does nothing. Replication takes
+ *       the old value of the primary key from that pass, so the answer is
+ *       false while replication is generating log records. Expression and
+ *       filter indexes and indexes still being built online are never
+ *       skipped.
+ */
+static bool
+locator_can_skip_index_update (THREAD_ENTRY * thread_p, OID * class_oid, ATTR_ID * att_id, int n_att_id)
+{
+  OR_CLASSREP *classrepr;
+  OR_INDEX *index;
+  int idx_incache = -1;
+  bool can_skip = true;
+  int i, j, k;
+
+  if (att_id == NULL || n_att_id <= 0)
+    {
+      /* every attribute may have changed */
+      return false;
+    }
+
+  if (!LOG_CHECK_LOG_APPLIER (thread_p) && log_does_allow_replication () == true)
+    {
+      return false;
+    }
+
+  classrepr = heap_classrepr_get (thread_p, class_oid, NULL, NULL_REPRID, &idx_incache);
+  if (classrepr == NULL)
+    {
+      return false;
+    }
+
+  for (i = 0; i < classrepr->n_indexes && can_skip; i++)
+    {
+      index = &classrepr->indexes[i];
+
+      if (index->func_index_info != NULL || index->filter_predicate != NULL
+	  || index->index_status == OR_ONLINE_INDEX_BUILDING_IN_PROGRESS)
+	{
+	  can_skip = false;
+	  break;
+	}
+
+      for (j = 0; j < index->n_atts && can_skip; j++)
+	{
+	  for (k = 0; k < n_att_id; k++)
+	    {
+	      if (index->atts[j]->id == att_id[k])
+		{
+		  can_skip = false;
+		  break;
+		}
+	    }
+	}
+    }
+
+  heap_classrepr_free_and_init (classrepr, &idx_incache);
+
+  return can_skip;
+}
+
 /*
  * locator_update_index () - Update index entries
  *
@@ -8182,6 +8356,7 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
   HEAP_CACHE_ATTRINFO space_attrinfo[2];
   HEAP_CACHE_ATTRINFO *new_attrinfo = NULL;
   HEAP_CACHE_ATTRINFO *old_attrinfo = NULL;
+  bool attrinfo_cached = false;
   int new_num_found, old_num_found;
   BTID new_btid, old_btid;
   int pk_btid_index = -1;
@@ -8249,32 +8424,66 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
   aligned_newbuf = PTR_ALIGN (newbuf, MAX_ALIGNMENT);
   aligned_oldbuf = PTR_ALIGN (oldbuf, MAX_ALIGNMENT);
 
-  new_num_found = heap_attrinfo_start_with_index (thread_p, class_oid, NULL, &space_attrinfo[0], &new_idx_info);
-  num_btids = new_idx_info.num_btids;
-  if (new_num_found < 0)
+  /* A multi-row update reuses the attribute caches kept in its scan cache, so the caches are built once per
+   * statement instead of twice per row. */
+  if (scan_cache != NULL && (op_type == MULTI_ROW_UPDATE || op_type == MULTI_ROW_INSERT || op_type == MULTI_ROW_DELETE))
     {
-      return ER_FAILED;
-    }
-  new_attrinfo = &space_attrinfo[0];
+      new_num_found =
+	heap_scancache_get_index_attrinfo (thread_p, scan_cache, class_oid, 0, &new_attrinfo, &new_idx_info);
+      num_btids = new_idx_info.num_btids;
+      if (new_num_found < 0)
+	{
+	  return ER_FAILED;
+	}
 
-  old_num_found = heap_attrinfo_start_with_index (thread_p, class_oid, NULL, &space_attrinfo[1], &old_idx_info);
-  old_num_btids = old_idx_info.num_btids;
-  if (old_num_found < 0)
-    {
-      error_code = ER_FAILED;
-      goto error;
-    }
-  old_attrinfo = &space_attrinfo[1];
+      old_num_found =
+	heap_scancache_get_index_attrinfo (thread_p, scan_cache, class_oid, 1, &old_attrinfo, &old_idx_info);
+      old_num_btids = old_idx_info.num_btids;
+      if (old_num_found < 0)
+	{
+	  return ER_FAILED;
+	}
 
-  if (new_num_found != old_num_found)
+      attrinfo_cached = (new_num_found > 0);
+    }
+  else
     {
+      new_num_found = heap_attrinfo_start_with_index (thread_p, class_oid, NULL, &space_attrinfo[0], &new_idx_info);
+      num_btids = new_idx_info.num_btids;
+      if (new_num_found < 0)
+	{
+	  return ER_FAILED;
+	}
       if (new_num_found > 0)
 	{
-	  heap_attrinfo_end (thread_p, &space_attrinfo[0]);
+	  new_attrinfo = &space_attrinfo[0];
+	}
+
+      old_num_found = heap_attrinfo_start_with_index (thread_p, class_oid, NULL, &space_attrinfo[1], &old_idx_info);
+      old_num_btids = old_idx_info.num_btids;
+      if (old_num_found < 0)
+	{
+	  error_code = ER_FAILED;
+	  goto error;
 	}
       if (old_num_found > 0)
 	{
-	  heap_attrinfo_end (thread_p, &space_attrinfo[1]);
+	  old_attrinfo = &space_attrinfo[1];
+	}
+    }
+
+  if (new_num_found != old_num_found)
+    {
+      if (!attrinfo_cached)
+	{
+	  if (new_num_found > 0)
+	    {
+	      heap_attrinfo_end (thread_p, &space_attrinfo[0]);
+	    }
+	  if (old_num_found > 0)
+	    {
+	      heap_attrinfo_end (thread_p, &space_attrinfo[1]);
+	    }
 	}
       return ER_FAILED;
     }
@@ -8297,9 +8506,6 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
    * the keys are different
    */
 
-  new_attrinfo = &space_attrinfo[0];
-  old_attrinfo = &space_attrinfo[1];
-
   error_code = heap_attrinfo_read_dbvalues (thread_p, oid, new_recdes, NULL, new_attrinfo);
   if (error_code != NO_ERROR)
     {
@@ -8339,8 +8545,11 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 	  pk_btid_index = i;
 	}
 
-      /* check for specified update attributes */
-      if ((att_id != NULL) && ((use_mvcc == false) || (index->type == BTREE_PRIMARY_KEY && index->fk != NULL)))
+      /* check for specified update attributes; an update version keeps the object identifier, so an index whose
+       * attributes were not touched by the statement holds the same key and needs no maintenance at all.  Key
+       * extraction and comparison below would reach the same conclusion, but only after paying for both on every
+       * index of every updated row. */
+      if (att_id != NULL)
 	{
 	  found_btid = false;	/* guess as not found */
 
@@ -8355,8 +8564,8 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 		}
 	    }
 
-	  /* in MVCC, in case of BTREE_PRIMARY_KEY having FK need to update PK index but skip foreign key restrictions
-	   * checking */
+	  /* in case of BTREE_PRIMARY_KEY having FK need to check the keys to decide on the foreign key restrictions;
+	   * an index with a filter predicate is decided by the predicate evaluation below */
 	  if (!found_btid && !index->filter_predicate && (index->type != BTREE_PRIMARY_KEY || index->fk == NULL))
 	    {
 	      continue;		/* skip and go ahead */
@@ -8801,8 +9010,11 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 	}
     }
 
-  heap_attrinfo_end (thread_p, new_attrinfo);
-  heap_attrinfo_end (thread_p, old_attrinfo);
+  if (!attrinfo_cached)
+    {
+      heap_attrinfo_end (thread_p, new_attrinfo);
+      heap_attrinfo_end (thread_p, old_attrinfo);
+    }
 
 #if defined(ENABLE_SYSTEMTAP)
   if (classname != NULL)
@@ -8833,14 +9045,17 @@ error:
 
   /* Deallocate any index_list .. if any */
 
-  if (new_attrinfo != NULL)
+  if (!attrinfo_cached)
     {
-      heap_attrinfo_end (thread_p, new_attrinfo);
-    }
+      if (new_attrinfo != NULL)
+	{
+	  heap_attrinfo_end (thread_p, new_attrinfo);
+	}
 
-  if (old_attrinfo != NULL)
-    {
-      heap_attrinfo_end (thread_p, old_attrinfo);
+      if (old_attrinfo != NULL)
+	{
+	  heap_attrinfo_end (thread_p, old_attrinfo);
+	}
     }
 
 #if defined(ENABLE_SYSTEMTAP)
@@ -13746,7 +13961,288 @@ xlocator_demote_class_lock (THREAD_ENTRY * thread_p, const OID * class_oid, LOCK
   return lock_demote_class_lock (thread_p, class_oid, lock, ex_lock);
 }
 
+/*
+ * xlocator_get_schema_generation () - current schema generation counter
+ *
+ * return: generation value
+ *
+ *   thread_p(in): thread entry
+ *
+ * Note: The counter moves forward whenever a class object is updated or deleted, so a client that sees an unchanged
+ *       value knows that every class object it has cached is still identical to the stored one.
+ */
+INT64
+xlocator_get_schema_generation (THREAD_ENTRY * thread_p)
+{
+  return ATOMIC_LOAD_64 (&locator_Schema_generation);
+}
+
+/*
+ * xlocator_get_authorization_generation () - current authorization generation counter
+ *
+ * return: generation value
+ *
+ *   thread_p(in): thread entry
+ *
+ * Note: The counter moves forward whenever an instance of an authorization catalog class is forced, so a client that
+ *       sees an unchanged value knows that its computed privilege caches are still correct.
+ */
+INT64
+xlocator_get_authorization_generation (THREAD_ENTRY * thread_p)
+{
+  return ATOMIC_LOAD_64 (&locator_Authorization_generation);
+}
+
 // *INDENT-OFF*
+/*
+ * locator_multi_add_indexes () - Add index entries for a batch of freshly inserted records
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   class_oid(in): The class object identifier
+ *   inserted(in): Pairs of (record, instance OID) in insertion order
+ *   op_type(in):
+ *   scan_cache(in):
+ *   skip_checking_fk(in):
+ *   has_BU_lock(in): true when the transaction holds the bulk update lock on the class
+ *
+ * Note: Index-major counterpart of locator_add_or_remove_index for bulk inserts: keys are
+ *       extracted per record, then each index is applied as one ascending sorted batch
+ *       through btree_insert_batch, so consecutive descents hit leaf pages still hot in the
+ *       page buffer instead of ping-ponging between indexes for every row.
+ */
+static int
+locator_multi_add_indexes (THREAD_ENTRY * thread_p, OID * class_oid,
+			   const std::vector<std::pair<RECDES, OID>> &inserted, int op_type,
+			   HEAP_SCANCACHE * scan_cache, bool skip_checking_fk, bool has_BU_lock)
+{
+  int num_found, num_btids;
+  HEAP_CACHE_ATTRINFO *index_attrinfo = NULL;
+  HEAP_IDX_ELEMENTS_INFO idx_info;
+  BTID btid;
+  DB_VALUE dbvalue;
+  char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_buf;
+  int error_code = NO_ERROR;
+  bool use_mvcc = false;
+  MVCCID mvccid;
+  MVCC_REC_HEADER mvcc_rec_header[2];
+  MVCC_REC_HEADER *p_mvcc_rec_header = NULL;
+  OR_INDEX *index = NULL;
+  int unique_pk;
+  btree_unique_stats *unique_stat_info = NULL;
+
+  assert_release (class_oid != NULL && !OID_ISNULL (class_oid));
+  assert (op_type == MULTI_ROW_INSERT);
+
+  if (inserted.empty ())
+    {
+      return NO_ERROR;
+    }
+
+  db_make_null (&dbvalue);
+  aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
+
+#if defined(SERVER_MODE)
+  if (!mvcc_is_mvcc_disabled_class (class_oid) && !has_BU_lock)
+    {
+      use_mvcc = true;
+      mvccid = logtb_get_current_mvccid (thread_p);
+    }
+#endif /* SERVER_MODE */
+
+  num_found = heap_scancache_get_index_attrinfo (thread_p, scan_cache, class_oid, 0, &index_attrinfo, &idx_info);
+  if (num_found == 0)
+    {
+      return NO_ERROR;
+    }
+  else if (num_found < 0)
+    {
+      return ER_FAILED;
+    }
+  num_btids = idx_info.num_btids;
+
+  // per-index buffers of cloned keys paired with their instance OID
+  std::vector<std::vector<std::pair<DB_VALUE, OID>>> index_entries (num_btids);
+  std::vector<TP_DOMAIN *> key_domains (num_btids, NULL);
+
+  // record-major key extraction: attribute values are read once per record for all indexes
+  for (size_t rec_idx = 0; rec_idx < inserted.size () && error_code == NO_ERROR; rec_idx++)
+    {
+      RECDES recdes = inserted[rec_idx].first;
+      OID inst_oid = inserted[rec_idx].second;
+      RECDES *recdes_p = &recdes;
+      OID *inst_oid_p = &inst_oid;
+
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &inst_oid, &recdes, NULL, index_attrinfo);
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+
+      for (int i = 0; i < num_btids; i++)
+	{
+	  index = &(index_attrinfo->last_classrepr->indexes[i]);
+
+	  OR_PREDICATE *or_pred = index->filter_predicate;
+	  if (or_pred && or_pred->pred_stream)
+	    {
+	      DB_LOGICAL ev_res = V_UNKNOWN;
+
+	      error_code =
+		locator_eval_filter_predicate (thread_p, &index->btid, or_pred, class_oid, &inst_oid_p, 1, &recdes_p,
+					       &ev_res);
+	      if (error_code == ER_FAILED)
+		{
+		  break;
+		}
+	      error_code = NO_ERROR;
+	      if (ev_res != V_TRUE)
+		{
+		  continue;
+		}
+	    }
+
+	  if (i >= 1 && locator_was_index_already_applied (index_attrinfo, &index->btid, i))
+	    {
+	      continue;
+	    }
+
+	  DB_VALUE *key_dbvalue =
+	    heap_attrvalue_get_key (thread_p, i, index_attrinfo, &recdes, &btid, &dbvalue, aligned_buf, NULL,
+				    &key_domains[i]);
+	  if (key_dbvalue == NULL)
+	    {
+	      error_code = ER_FAILED;
+	      break;
+	    }
+
+	  if (index->type == BTREE_FOREIGN_KEY && !skip_checking_fk)
+	    {
+	      if (lock_object (thread_p, &inst_oid, class_oid, X_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
+		{
+		  error_code = ER_FAILED;
+		  break;
+		}
+	    }
+
+	  // the key may point into the reused dbvalue/attrinfo storage; keep a private copy
+	  DB_VALUE key_copy;
+	  error_code = pr_clone_value (key_dbvalue, &key_copy);
+	  if (key_dbvalue == &dbvalue)
+	    {
+	      pr_clear_value (&dbvalue);
+	    }
+	  if (error_code != NO_ERROR)
+	    {
+	      break;
+	    }
+	  index_entries[i].emplace_back (key_copy, inst_oid);
+	}
+    }
+
+  // index-major application: one ascending sorted batch per index
+  for (int i = 0; i < num_btids && error_code == NO_ERROR; i++)
+    {
+      if (index_entries[i].empty ())
+	{
+	  continue;
+	}
+
+      index = &(index_attrinfo->last_classrepr->indexes[i]);
+      TP_DOMAIN *key_domain = key_domains[i];
+
+      std::sort (index_entries[i].begin (), index_entries[i].end (),
+		 [key_domain] (const std::pair<DB_VALUE, OID> &a, const std::pair<DB_VALUE, OID> &b)
+		 {
+		   return btree_compare_key (const_cast<DB_VALUE *> (&a.first), const_cast<DB_VALUE *> (&b.first),
+					     key_domain, 1, 1, NULL) == DB_LT;
+		 });
+
+      std::vector<DB_VALUE *> keys;
+      std::vector<OID> oids;
+      keys.reserve (index_entries[i].size ());
+      oids.reserve (index_entries[i].size ());
+      for (auto &entry : index_entries[i])
+	{
+	  keys.push_back (&entry.first);
+	  oids.push_back (entry.second);
+	}
+
+      if (scan_cache != NULL)
+	{
+	  assert (scan_cache->m_index_stats != NULL);
+	  unique_stat_info = &scan_cache->m_index_stats->get_stats_of (index->btid);
+	}
+      else
+	{
+	  unique_stat_info = NULL;
+	}
+
+      unique_pk = 0;
+      if (index->type == BTREE_UNIQUE || index->type == BTREE_REVERSE_UNIQUE)
+	{
+	  unique_pk = BTREE_CONSTRAINT_UNIQUE;
+	}
+      else if (index->type == BTREE_PRIMARY_KEY)
+	{
+	  unique_pk = BTREE_CONSTRAINT_UNIQUE | BTREE_CONSTRAINT_PRIMARY_KEY;
+	}
+
+      if (use_mvcc)
+	{
+	  btree_set_mvcc_header_ids_for_update (thread_p, false, true, &mvccid, mvcc_rec_header);
+	  p_mvcc_rec_header = mvcc_rec_header;
+	}
+
+      if (index->index_status == OR_ONLINE_INDEX_BUILDING_IN_PROGRESS)
+	{
+	  // an online loader owns this index; hand the keys over one by one
+	  for (size_t k = 0; k < keys.size () && error_code == NO_ERROR; k++)
+	    {
+	      error_code =
+		btree_online_index_dispatcher (thread_p, &index->btid, keys[k], class_oid, &oids[k], unique_pk,
+					       BTREE_OP_ONLINE_INDEX_TRAN_INSERT, NULL);
+	    }
+	}
+      else
+	{
+	  error_code =
+	    btree_insert_batch (thread_p, &index->btid, keys.data (), class_oid, oids.data (), (int) keys.size (),
+				op_type, unique_stat_info, &unique_pk, p_mvcc_rec_header);
+	}
+
+      if (error_code == NO_ERROR && index->type == BTREE_PRIMARY_KEY && !LOG_CHECK_LOG_APPLIER (thread_p)
+	  && log_does_allow_replication () == true)
+	{
+	  for (auto &entry : index_entries[i])
+	    {
+	      error_code =
+		repl_log_insert (thread_p, class_oid, &entry.second, LOG_REPLICATION_DATA, RVREPL_DATA_INSERT,
+				 &entry.first, REPL_INFO_TYPE_RBR_NORMAL);
+	      if (error_code != NO_ERROR)
+		{
+		  break;
+		}
+	    }
+	}
+    }
+
+  for (int i = 0; i < num_btids; i++)
+    {
+      for (auto &entry : index_entries[i])
+	{
+	  pr_clear_value (&entry.first);
+	}
+    }
+
+  if (error_code != NO_ERROR && er_errid () == NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+    }
+
+  return error_code;
+}
+
 int
 locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid,
 			    const std::vector<record_descriptor> &recdes, int has_index, int op_type,
@@ -13763,6 +14259,24 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
   bool has_BU_lock = lock_has_lock_on_object (class_oid, oid_Root_class_oid, BU_LOCK);
   size_t record_overhead = spage_slot_size ();
 
+  // Defer index maintenance to one sorted batch per index when nothing in this statement
+  // needs per-row index work: no partition pruning (a pruned row may land in another class),
+  // no cached function predicates (they are arrayed per target class) and no foreign key
+  // checks (locator_check_foreign_key must see each row before its key goes in).
+  bool defer_indexes = (has_index && pruning_type == DB_NOT_PARTITIONED_CLASS && pcontext == NULL
+			&& func_preds == NULL && (locator_Dont_check_foreign_key || dont_check_fk)
+			&& !OID_IS_ROOTOID (class_oid) && op_type == MULTI_ROW_INSERT);
+  int insert_has_index = defer_indexes ? 0 : has_index;
+  std::vector<std::pair<RECDES, OID>> inserted;
+
+  // Construct full pages directly in the common bulk-load shape: the transaction owns
+  // BU_LOCK (rows need no per-row lock and carry no MVCC information), rows land in this
+  // class only and any index maintenance is deferred or absent, so nothing requires the
+  // per-record heap insert machinery.
+  bool build_pages_directly = (insert_has_index == 0 && has_BU_lock && pruning_type == DB_NOT_PARTITIONED_CLASS
+			       && pcontext == NULL && func_preds == NULL && force_in_place == UPDATE_INPLACE_NONE
+			       && !OID_IS_ROOTOID (class_oid));
+
   // Early-out
   if (recdes.size () == 0)
     {
@@ -13770,6 +14284,11 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
       return NO_ERROR;
     }
 
+  if (defer_indexes)
+    {
+      inserted.reserve (recdes.size ());
+    }
+
   *force_count = 0;
 
   // Take into account the unfill factor of the heap file.
@@ -13784,7 +14303,7 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	{
 	  scan_cache->cache_last_fix_page = false;
 	  // We insert other records normally.
-	  error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &local_record, has_index,
+	  error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &local_record, insert_has_index,
 					     op_type, scan_cache, force_count, pruning_type, pcontext, func_preds,
 					     force_in_place, NULL, has_BU_lock, dont_check_fk, false);
 	  if (error_code != NO_ERROR)
@@ -13792,6 +14311,11 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	      ASSERT_ERROR ();
 	      return error_code;
 	    }
+
+	  if (defer_indexes)
+	    {
+	      inserted.emplace_back (local_record, dummy_oid);
+	    }
 	}
       else
 	{
@@ -13800,50 +14324,89 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	      >= heap_max_page_size)
 	    {
 	      VPID new_page_vpid;
-	      PGBUF_WATCHER home_hint_p;
 
 	      VPID_SET_NULL (&new_page_vpid);
-	      scan_cache->cache_last_fix_page = true;
 
-	      // First alloc a new empty heap page.
-	      error_code = heap_alloc_new_page (thread_p, hfid, *class_oid, &home_hint_p, &new_page_vpid);
-	      if (error_code != NO_ERROR)
+	      if (build_pages_directly)
 		{
-		  ASSERT_ERROR ();
-		  return error_code;
-		}
+		  // The accumulated records become one page image; heap_insert_full_page
+		  // logs the whole page at once and hands back the new OIDs.
+		  std::vector<OID> new_oids (recdes_array.size ());
 
-	      for (size_t j = 0; j < recdes_array.size (); j++)
-		{
-		  error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[j], has_index,
-						     op_type, scan_cache, force_count, pruning_type, pcontext,
-						     func_preds, force_in_place, &home_hint_p, has_BU_lock,
-						     dont_check_fk, true);
+		  error_code = heap_insert_full_page (thread_p, hfid, class_oid, recdes_array.data (),
+						      (int) recdes_array.size (), new_oids.data (), &new_page_vpid);
 		  if (error_code != NO_ERROR)
 		    {
 		      ASSERT_ERROR ();
+		      return error_code;
+		    }
 
-		      if (home_hint_p.pgptr)
+		  if (defer_indexes)
+		    {
+		      for (size_t j = 0; j < recdes_array.size (); j++)
 			{
-			  pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
+			  inserted.emplace_back (recdes_array[j], new_oids[j]);
 			}
+		    }
+
+		  *force_count = 1;
+		}
+	      else
+		{
+		  PGBUF_WATCHER home_hint_p;
+
+		  scan_cache->cache_last_fix_page = true;
 
-		      if (scan_cache->page_watcher.pgptr)
+		  // First alloc a new empty heap page.
+		  error_code = heap_alloc_new_page (thread_p, hfid, *class_oid, &home_hint_p, &new_page_vpid);
+		  if (error_code != NO_ERROR)
+		    {
+		      ASSERT_ERROR ();
+		      return error_code;
+		    }
+
+		  for (size_t j = 0; j < recdes_array.size (); j++)
+		    {
+		      error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[j],
+							 insert_has_index, op_type, scan_cache, force_count,
+							 pruning_type, pcontext, func_preds, force_in_place,
+							 &home_hint_p, has_BU_lock, dont_check_fk, true);
+		      if (error_code != NO_ERROR)
 			{
-			  pgbuf_ordered_unfix_and_init (thread_p, scan_cache->page_watcher.pgptr,
-							&scan_cache->page_watcher);
+			  ASSERT_ERROR ();
+
+			  if (home_hint_p.pgptr)
+			    {
+			      pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
+			    }
+
+			  if (scan_cache->page_watcher.pgptr)
+			    {
+			      pgbuf_ordered_unfix_and_init (thread_p, scan_cache->page_watcher.pgptr,
+							    &scan_cache->page_watcher);
+			    }
+
+			  assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
+
+			  return error_code;
 			}
 
-		      assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
+		      if (defer_indexes)
+			{
+			  inserted.emplace_back (recdes_array[j], dummy_oid);
+			}
 
-		      return error_code;
+		      pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &home_hint_p);
 		    }
 
-		  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &home_hint_p);
-		}
+		  // Now log the whole page.
+		  pgbuf_log_redo_new_page (thread_p, home_hint_p.pgptr, DB_PAGESIZE, PAGE_HEAP);
+
+		  // Unfix the page.
+		  pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
 
-	      // Now log the whole page.
-	      pgbuf_log_redo_new_page (thread_p, home_hint_p.pgptr, DB_PAGESIZE, PAGE_HEAP);
+		  assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
+		}
 
 	      // Add the new VPID to the VPID array.
 	      assert (!VPID_ISNULL (&new_page_vpid));
@@ -13852,11 +14415,6 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	      // Clear the recdes array.
 	      recdes_array.clear ();
 	      accumulated_records_size = 0;
-
-	      // Unfix the page.
-	      pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
-
-	      assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
 	    }
 
 	  // Add this record to the recdes array and increase the accumulated size.
@@ -13870,9 +14428,25 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
   for (size_t i = 0; i < recdes_array.size (); i++)
     {
       scan_cache->cache_last_fix_page = false;
-      error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[i], has_index, op_type,
-					 scan_cache, force_count, pruning_type, pcontext, func_preds, force_in_place,
-					 NULL, has_BU_lock, dont_check_fk, false);
+      error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[i], insert_has_index,
+					 op_type, scan_cache, force_count, pruning_type, pcontext, func_preds,
+					 force_in_place, NULL, has_BU_lock, dont_check_fk, false);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+
+      if (defer_indexes)
+	{
+	  inserted.emplace_back (recdes_array[i], dummy_oid);
+	}
+    }
+
+  if (defer_indexes)
+    {
+      error_code = locator_multi_add_indexes (thread_p, class_oid, inserted, op_type, scan_cache,
+					      locator_Dont_check_foreign_key || dont_check_fk, has_BU_lock);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
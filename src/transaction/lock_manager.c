@@ -86,6 +86,9 @@ extern LOCK_COMPATIBILITY lock_Comp[12][12];
 /* transaction wait for only some msecs ? */
 #define LK_CAN_TIMEOUT(msecs) ((msecs) != LK_INFINITE_WAIT)
 
+/* minimum time between deadlock detection runs triggered by a newly blocked waiter */
+#define LK_MIN_REQUESTED_DEADLOCK_INTERVAL_SEC 0.1
+
 /* is younger transaction ? */
 #define LK_ISYOUNGER(young_tranid, old_tranid) (young_tranid > old_tranid)
 
@@ -489,7 +492,7 @@ static void lock_insert_into_tran_non2pl_list (LK_ENTRY * non2pl, int owner_tran
 static int lock_delete_from_tran_non2pl_list (LK_ENTRY * non2pl, int owner_tran_index);
 static LK_ENTRY *lock_find_tran_hold_entry (THREAD_ENTRY * thread_p, int tran_index, const OID * oid, bool is_class);
 static bool lock_force_timeout_expired_wait_transactions (void *thrd_entry);
-static bool lock_is_local_deadlock_detection_interval_up (void);
+static bool lock_is_local_deadlock_detection_interval_up (bool requested);
 static void lock_detect_local_deadlock (THREAD_ENTRY * thread_p);
 static bool lock_is_class_lock_escalated (LOCK class_lock, LOCK lock_escalation);
 static LK_ENTRY *lock_add_non2pl_lock (THREAD_ENTRY * thread_p, LK_RES * res_ptr, int tran_index, LOCK lock);
@@ -535,6 +538,7 @@ static void lock_increment_class_granules (LK_ENTRY * class_entry);
 
 static void lock_decrement_class_granules (LK_ENTRY * class_entry);
 static LK_ENTRY *lock_find_class_entry (int tran_index, const OID * class_oid);
+static LK_ENTRY *lock_find_recent_instance_entry (int tran_index, const OID * oid);
 
 static void lock_event_log_tran_locks (THREAD_ENTRY * thread_p, FILE * log_fp, int tran_index);
 static void lock_event_log_blocked_lock (THREAD_ENTRY * thread_p, FILE * log_fp, LK_ENTRY * entry);
@@ -563,6 +567,10 @@ static void lock_get_transaction_lock_waiting_threads (int tran_index, tran_lock
 // *INDENT-OFF*
 static cubthread::daemon *lock_Deadlock_detect_daemon = NULL;
 
+// set when a waiter blocks while others are already waiting; the detection daemon reacts to it within one of its
+// periods instead of waiting out the whole detection interval
+static std::atomic_bool lock_Deadlock_detection_requested = { false };
+
 static void lock_deadlock_detect_daemon_init ();
 static void lock_deadlock_detect_daemon_destroy ();
 // *INDENT-ON*
@@ -1599,6 +1607,62 @@ lock_find_class_entry (int tran_index, const OID * class_oid)
 }
 #endif /* SERVER_MODE */
 
+#if defined(SERVER_MODE)
+/*
+ * lock_find_recent_instance_entry - Find an instance lock entry among the most
+ *                      recently acquired locks of the transaction
+ *
+ * return:
+ *
+ *   tran_index(in):
+ *   oid(in):
+ *
+ * Note:This function searches the head of the transaction instance lock hold
+ *     list, where the most recently acquired entries are inserted, for a lock
+ *     entry on the given instance. Only a bounded number of entries is
+ *     inspected so that transactions holding many instance locks do not pay a
+ *     long scan for every miss; a miss simply falls back to the resource hash
+ *     lookup.
+ */
+static LK_ENTRY *
+lock_find_recent_instance_entry (int tran_index, const OID * oid)
+{
+#define LK_INSTANCE_FAST_LOOKUP_DEPTH 64
+  LK_TRAN_LOCK *tran_lock;
+  LK_ENTRY *entry_ptr;
+  int inspected = 0;
+  int rv;
+
+  /* The caller is not holding any mutex */
+
+  tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+
+  entry_ptr = tran_lock->inst_hold_list;
+  while (entry_ptr != NULL && inspected < LK_INSTANCE_FAST_LOOKUP_DEPTH)
+    {
+      assert (tran_index == entry_ptr->tran_index);
+
+      if (OID_EQ (&entry_ptr->res_head->key.oid, oid))
+	{
+	  break;
+	}
+      entry_ptr = entry_ptr->tran_next;
+      inspected++;
+    }
+
+  if (inspected >= LK_INSTANCE_FAST_LOOKUP_DEPTH)
+    {
+      entry_ptr = NULL;
+    }
+
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+  return entry_ptr;		/* it might be NULL */
+#undef LK_INSTANCE_FAST_LOOKUP_DEPTH
+}
+#endif /* SERVER_MODE */
+
 #if defined(SERVER_MODE)
 /*
  * lock_add_non2pl_lock - Add a release lock which has never been acquired
@@ -2168,6 +2232,17 @@ lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs)
   lk_Gl.TWFG_node[entry_ptr->tran_index].thrd_wait_stime = entry_ptr->thrd_entry->lockwait_stime;
   lk_Gl.deadlock_and_timeout_detector++;
 
+  /* the new wait-for edge may have closed a cycle; nudge the detection daemon rather than letting the cycle sit until
+   * the periodic detection interval elapses */
+  if (lk_Gl.deadlock_and_timeout_detector >= 2)
+    {
+      lock_Deadlock_detection_requested.store (true);
+      if (lock_Deadlock_detect_daemon != NULL)
+	{
+	  lock_Deadlock_detect_daemon->wakeup ();
+	}
+    }
+
   tdes = LOG_FIND_CURRENT_TDES (thread_p);
 
   /* I must not be a deadlock-victim thread */
@@ -3323,6 +3398,16 @@ start:
 	  ret_val = LK_GRANTED;
 	  goto end;
 	}
+
+      /* Try to find the instance lock entry among the recently acquired locks of the transaction, the same way class
+       * lock requests avoid the expensive resource mutex below. Re-requests on hot instances are far more frequent
+       * than conversions; when a conversion turns out to be needed, the resource mutex is locked on the way. */
+      entry_ptr = lock_find_recent_instance_entry (tran_index, oid);
+      if (entry_ptr != NULL)
+	{
+	  res_ptr = entry_ptr->res_head;
+	  goto lock_tran_lk_entry;
+	}
     }
   else
     {
@@ -3840,6 +3925,7 @@ blocked:
       tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
       lock_wait_time = tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec;
       perfmon_lk_waited_time_on_objects (thread_p, lock, lock_wait_time);
+      perfmon_time_histogram (thread_p, PSTAT_OBJ_LOCK_WAIT_TIME_HISTOGRAM, lock_wait_time);
     }
 
   if (ret_val != LOCK_RESUMED)
@@ -5714,7 +5800,8 @@ lock_check_timeout_expired_and_count_suspended_mapfunc (THREAD_ENTRY & thread_re
 //      (1) to resume an interrupted lock waiter
 //      (2) to resume a timedout lock waiter
 //      (3) to detect and resolve a deadlock.
-//    It operates (1) and (2) for every 100ms and does (3) for every PRM_ID_LK_RUN_DEADLOCK_INTERVAL.
+//    It operates (1) and (2) for every 100ms and does (3) for every PRM_ID_LK_RUN_DEADLOCK_INTERVAL, or sooner when
+//    a newly blocked waiter reported a fresh wait-for edge (see lock_suspend).
 //
 void
 deadlock_detect_task_execute (cubthread::entry & thread_ref)
@@ -5735,8 +5822,11 @@ deadlock_detect_task_execute (cubthread::entry & thread_ref)
   size_t lock_wait_count = 0;
   thread_get_manager ()->map_entries (lock_check_timeout_expired_and_count_suspended_mapfunc, lock_wait_count);
 
-  if (lock_is_local_deadlock_detection_interval_up () && lock_wait_count >= 2)
+  bool requested = lock_Deadlock_detection_requested.load ();
+
+  if (lock_is_local_deadlock_detection_interval_up (requested) && lock_wait_count >= 2)
     {
+      lock_Deadlock_detection_requested.store (false);
       lock_detect_local_deadlock (&thread_ref);
     }
 }
@@ -7602,21 +7692,33 @@ end:
  *
  * return:
  *
- * Note:check if the local deadlock detection should be performed.
+ *   requested(in): true when a waiter blocked since the last detection run
+ *
+ * Note:check if the local deadlock detection should be performed. When a new
+ *     wait-for edge was reported, detection is due after one daemon period
+ *     already; the floor still bounds how often block storms can trigger
+ *     whole-graph scans.
  */
 static bool
-lock_is_local_deadlock_detection_interval_up (void)
+lock_is_local_deadlock_detection_interval_up (bool requested)
 {
 #if defined (SERVER_MODE)
   struct timeval now, elapsed;
   double elapsed_sec;
+  double interval_sec;
 
   /* check deadlock detection interval */
   gettimeofday (&now, NULL);
   perfmon_diff_timeval (&elapsed, &lk_Gl.last_deadlock_run, &now);
   elapsed_sec = elapsed.tv_sec + (elapsed.tv_usec / 1000000.0);
 
-  if (elapsed_sec < prm_get_float_value (PRM_ID_LK_RUN_DEADLOCK_INTERVAL))
+  interval_sec = prm_get_float_value (PRM_ID_LK_RUN_DEADLOCK_INTERVAL);
+  if (requested && interval_sec > LK_MIN_REQUESTED_DEADLOCK_INTERVAL_SEC)
+    {
+      interval_sec = LK_MIN_REQUESTED_DEADLOCK_INTERVAL_SEC;
+    }
+
+  if (elapsed_sec < interval_sec)
     {
       return false;
     }
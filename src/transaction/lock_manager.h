@@ -172,7 +172,9 @@ struct lk_res_key
  * Lock Resource Entry Structure
  */
 typedef struct lk_res LK_RES;
-struct lk_res
+/* each resource gets its own cache lines; the resource mutex and the list heads of neighboring hot resources must not
+ * false-share */
+struct alignas (64) lk_res
 {
   LK_RES_KEY key;		/* lock resource's hash key */
   LOCK total_holders_mode;	/* total mode of the holders */
@@ -1354,27 +1354,10 @@ prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LO
   LOG_REC_MVCC_UNDOREDO *mvcc_undoredo = NULL;
   LOG_VACUUM_INFO *vacuum_info = NULL;
   MVCCID mvccid = MVCCID_NULL;
+  INT64 list_size_incr;
 
-  if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
-    {
-      log_Gl.prior_info.prior_lsa_mutex.lock ();
-    }
-
-  prior_lsa_start_append (thread_p, node, tdes);
-
-  LSA_COPY (&start_lsa, &node->start_lsa);
-
-  if (LOG_ISRESTARTED () && log_Gl.hdr.does_block_need_vacuum)
-    {
-      assert (!LSA_ISNULL (&log_Gl.hdr.mvcc_op_log_lsa));
-      if (vacuum_get_log_blockid (log_Gl.hdr.mvcc_op_log_lsa.pageid) != vacuum_get_log_blockid (start_lsa.pageid))
-	{
-	  assert (vacuum_get_log_blockid (log_Gl.hdr.mvcc_op_log_lsa.pageid)
-		  <= (vacuum_get_log_blockid (start_lsa.pageid) - 1));
-
-	  vacuum_produce_log_block_data (thread_p);
-	}
-    }
+  /* Classify the record before entering the critical section; only memory owned by this thread is inspected here.
+   * Everything that reads or writes log_Gl must wait for the mutex below. */
 
   /* Is this a valid MVCC operations: 1. node must be undoredo/undo type and must have undo data. 2. record index must
    * the index of MVCC operations. */
@@ -1383,8 +1366,6 @@ prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LO
       || (node->log_header.type == LOG_SYSOP_END
 	  && ((LOG_REC_SYSOP_END *) node->data_header)->type == LOG_SYSOP_END_LOGICAL_MVCC_UNDO))
     {
-      /* Link the log record to previous MVCC delete/update log record */
-      /* Will be used by vacuum */
       if (node->log_header.type == LOG_MVCC_UNDO_DATA)
 	{
 	  /* Read from mvcc_undo structure */
@@ -1409,14 +1390,40 @@ prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LO
 	  vacuum_info = &mvcc_undoredo->vacuum_info;
 	  mvccid = mvcc_undoredo->mvccid;
 	}
+    }
+
+  /* list_size in bytes */
+  list_size_incr = sizeof (LOG_PRIOR_NODE) + node->data_header_length + node->ulength + node->rlength;
+
+  if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
+    {
+      log_Gl.prior_info.prior_lsa_mutex.lock ();
+    }
+
+  prior_lsa_start_append (thread_p, node, tdes);
+
+  LSA_COPY (&start_lsa, &node->start_lsa);
+
+  if (LOG_ISRESTARTED () && log_Gl.hdr.does_block_need_vacuum)
+    {
+      assert (!LSA_ISNULL (&log_Gl.hdr.mvcc_op_log_lsa));
+      if (vacuum_get_log_blockid (log_Gl.hdr.mvcc_op_log_lsa.pageid) != vacuum_get_log_blockid (start_lsa.pageid))
+	{
+	  assert (vacuum_get_log_blockid (log_Gl.hdr.mvcc_op_log_lsa.pageid)
+		  <= (vacuum_get_log_blockid (start_lsa.pageid) - 1));
+
+	  vacuum_produce_log_block_data (thread_p);
+	}
+    }
+
+  if (vacuum_info != NULL)
+    {
+      /* Link the log record to previous MVCC delete/update log record */
+      /* Will be used by vacuum */
 
       /* Save previous mvcc operation log lsa to vacuum info */
       LSA_COPY (&vacuum_info->prev_mvcc_op_log_lsa, &log_Gl.hdr.mvcc_op_log_lsa);
 
-      vacuum_er_log (VACUUM_ER_LOG_LOGGING,
-		     "log mvcc op at (%lld, %d) and create link with log_lsa(%lld, %d)",
-		     LSA_AS_ARGS (&node->start_lsa), LSA_AS_ARGS (&log_Gl.hdr.mvcc_op_log_lsa));
-
       prior_update_header_mvcc_info (start_lsa, mvccid);
     }
   else if (node->log_header.type == LOG_SYSOP_START_POSTPONE)
@@ -1504,13 +1511,22 @@ prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LO
       log_Gl.prior_info.prior_list_tail = node;
     }
 
-  /* list_size in bytes */
-  log_Gl.prior_info.list_size += (sizeof (LOG_PRIOR_NODE) + node->data_header_length + node->ulength + node->rlength);
+  log_Gl.prior_info.list_size += list_size_incr;
 
   if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
     {
       log_Gl.prior_info.prior_lsa_mutex.unlock ();
+    }
 
+  if (vacuum_info != NULL)
+    {
+      vacuum_er_log (VACUUM_ER_LOG_LOGGING,
+		     "log mvcc op at (%lld, %d) and create link with log_lsa(%lld, %d)",
+		     LSA_AS_ARGS (&start_lsa), LSA_AS_ARGS (&vacuum_info->prev_mvcc_op_log_lsa));
+    }
+
+  if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
+    {
       if (log_Gl.prior_info.list_size >= (INT64) logpb_get_memsize ())
 	{
 	  perfmon_inc_stat (thread_p, PSTAT_PRIOR_LSA_LIST_MAXED);
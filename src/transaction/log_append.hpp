@@ -118,7 +118,8 @@ struct log_prior_lsa_info
   LOG_PRIOR_NODE *prior_list_header;
   LOG_PRIOR_NODE *prior_list_tail;
 
-  INT64 list_size;		/* bytes */
+  std::atomic<INT64> list_size;	/* bytes; atomic so that appenders may check it against the log buffer size after
+				 * releasing prior_lsa_mutex */
 
   /* flush list */
   LOG_PRIOR_NODE *prior_flush_list_header;
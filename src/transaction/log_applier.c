@@ -82,8 +82,10 @@
 #define LA_DEFAULT_CACHE_BUFFER_SIZE            100
 #define LA_MAX_REPL_ITEM_WITHOUT_RELEASE_PB     50
 #define LA_MAX_UNFLUSHED_REPL_ITEMS             200
+#define LA_REPL_CLASS_CACHE_SIZE                32
 #define LA_DEFAULT_LOG_PAGE_SIZE                4096
 #define LA_GET_PAGE_RETRY_COUNT                 10
+#define LA_LOG_READAHEAD_NPAGES                 16
 #define LA_REPL_LIST_COUNT                      50
 
 #define LA_PAGE_DOESNOT_EXIST                   0
@@ -262,6 +264,14 @@ struct la_apply
   LA_ITEM *tail;
 };
 
+typedef struct la_repl_class_info LA_REPL_CLASS_INFO;
+struct la_repl_class_info
+{
+  OID class_oid;
+  int pruning_type;
+  bool has_index;
+};
+
 typedef struct la_commit LA_COMMIT;
 struct la_commit
 {
@@ -424,6 +434,11 @@ static char la_peer_host[CUB_MAXHOSTNAMELEN + 1];
 
 static bool la_enable_sql_logging = false;
 
+/* class metadata looked up while building the current bulk flush group; reset whenever the group is flushed, so a
+ * schema change shipped as a statement log (which forces a flush first) can never be missed */
+static LA_REPL_CLASS_INFO la_Repl_class_cache[LA_REPL_CLASS_CACHE_SIZE];
+static int la_Num_cached_repl_classes = 0;
+
 #if defined (WINDOWS)
 static void la_shutdown_by_signal (void);
 #else /* !WINDOWS */
@@ -443,6 +458,7 @@ static int la_log_fetch (LOG_PAGEID pageid, LA_CACHE_BUFFER * cache_buffer);
 static int la_expand_cache_log_buffer (LA_CACHE_PB * cache_pb, int slb_cnt, int slb_size);
 static LA_CACHE_BUFFER *la_cache_buffer_replace (LA_CACHE_PB * cache_pb, LOG_PAGEID pageid, int io_pagesize,
 						 int buffer_size);
+static void la_log_readahead (LOG_PAGEID start_pageid);
 static LA_CACHE_BUFFER *la_get_page_buffer (LOG_PAGEID pageid);
 static LOG_PAGE *la_get_page (LOG_PAGEID pageid);
 static void la_release_page_buffer (LOG_PAGEID pageid);
@@ -555,6 +571,9 @@ static float la_get_avg (int *array, int size);
 static void la_get_adaptive_time_commit_interval (int *time_commit_interval, int *delay_hist);
 
 static int la_flush_repl_items (bool immediate);
+static LA_REPL_CLASS_INFO *la_find_cached_repl_class_info (const OID * class_oid);
+static void la_cache_repl_class_info (const OID * class_oid, int pruning_type, bool has_index);
+static void la_clear_repl_class_info_cache (void);
 
 static bool la_need_filter_out (LA_ITEM * item);
 static int la_create_repl_filter (void);
@@ -1284,6 +1303,67 @@ la_cache_buffer_replace (LA_CACHE_PB * cache_pb, LOG_PAGEID pageid, int io_pages
   return NULL;
 }
 
+/*
+ * la_log_readahead() - read a batch of upcoming log pages into the cache
+ *   return: none
+ *   start_pageid(in): first page to read ahead
+ *
+ * Note: The applier consumes log pages sequentially. When it has fallen
+ *   behind the master it pays one synchronous read per page; reading a
+ *   window of the pages it is about to decode turns that into a short
+ *   burst of sequential reads against the archive or active log file.
+ *   Read-ahead is best effort: it stops at the append point, at the
+ *   archive/active boundary and on the first page that cannot be read.
+ *   While the applier is caught up the append check stops the loop
+ *   immediately, so nothing is read speculatively past the log head.
+ */
+static void
+la_log_readahead (LOG_PAGEID start_pageid)
+{
+  LA_CACHE_PB *cache_pb = la_Info.cache_pb;
+  LA_CACHE_BUFFER *cache_buffer = NULL;
+  LOG_PAGEID pageid;
+  bool start_in_archive = LA_LOG_IS_IN_ARCHIVE (start_pageid);
+
+  for (pageid = start_pageid; pageid < start_pageid + LA_LOG_READAHEAD_NPAGES; pageid++)
+    {
+      if (la_Info.act_log.log_hdr->append_lsa.pageid <= pageid)
+	{
+	  /* at or past the append point; nothing to read yet */
+	  break;
+	}
+
+      if (LA_LOG_IS_IN_ARCHIVE (pageid) != start_in_archive)
+	{
+	  /* do not cross the archive/active boundary */
+	  break;
+	}
+
+      if (mht_get (cache_pb->hash_table, (void *) &pageid) != NULL)
+	{
+	  /* already cached */
+	  continue;
+	}
+
+      cache_buffer =
+	la_cache_buffer_replace (cache_pb, pageid, la_Info.act_log.db_logpagesize, la_Info.cache_buffer_size);
+      if (cache_buffer == NULL || cache_buffer->logpage.hdr.logical_pageid != pageid)
+	{
+	  break;
+	}
+
+      (void) mht_rem (cache_pb->hash_table, &cache_buffer->pageid, NULL, NULL);
+
+      if (mht_put (cache_pb->hash_table, &cache_buffer->pageid, cache_buffer) == NULL)
+	{
+	  break;
+	}
+
+      /* give the page a replacement grace period until the applier reaches it */
+      cache_buffer->recently_free = true;
+    }
+}
+
 static LA_CACHE_BUFFER *
 la_get_page_buffer (LOG_PAGEID pageid)
 {
@@ -1309,6 +1389,9 @@ la_get_page_buffer (LOG_PAGEID pageid)
 	{
 	  return NULL;
 	}
+
+      /* the applier walks the log forward; warm the cache with the pages it is about to decode */
+      la_log_readahead (pageid + 1);
     }
   else
     {
@@ -4674,6 +4757,63 @@ la_get_ha_server_state (LOG_PAGE * pgptr, LOG_LSA * lsa)
   return state;
 }
 
+/*
+ * la_find_cached_repl_class_info() - find the cached metadata of the given class
+ *   return: the cache entry, or NULL when the class was not seen in the current flush group
+ *   class_oid(in): class OID extracted from the replication record
+ */
+static LA_REPL_CLASS_INFO *
+la_find_cached_repl_class_info (const OID * class_oid)
+{
+  int i;
+
+  for (i = 0; i < la_Num_cached_repl_classes; i++)
+    {
+      if (OID_EQ (&la_Repl_class_cache[i].class_oid, class_oid))
+	{
+	  return &la_Repl_class_cache[i];
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * la_cache_repl_class_info() - remember the metadata of a class for the rest of the current flush group
+ *   return: none
+ *   class_oid(in): class OID extracted from the replication record
+ *   pruning_type(in): DB_CLASS_PARTITION_TYPE of the class
+ *   has_index(in): whether the class has an index
+ *
+ * Note: when the cache is full the class is simply looked up again for each item; the cache only lives until the
+ *       next flush, so a group rarely touches more than a handful of classes.
+ */
+static void
+la_cache_repl_class_info (const OID * class_oid, int pruning_type, bool has_index)
+{
+  LA_REPL_CLASS_INFO *entry;
+
+  if (la_Num_cached_repl_classes >= LA_REPL_CLASS_CACHE_SIZE)
+    {
+      return;
+    }
+
+  entry = &la_Repl_class_cache[la_Num_cached_repl_classes++];
+  COPY_OID (&entry->class_oid, class_oid);
+  entry->pruning_type = pruning_type;
+  entry->has_index = has_index;
+}
+
+/*
+ * la_clear_repl_class_info_cache() - forget all cached class metadata
+ *   return: none
+ */
+static void
+la_clear_repl_class_info_cache (void)
+{
+  la_Num_cached_repl_classes = 0;
+}
+
 /*
  * la_flush_repl_items() - flush stored repl items to server
  *   return: NO_ERROR or error code
@@ -4702,6 +4842,8 @@ la_flush_repl_items (bool immediate)
 
   if (la_Info.num_unflushed >= LA_MAX_UNFLUSHED_REPL_ITEMS || immediate == true)
     {
+      la_clear_repl_class_info_cache ();
+
       error = locator_repl_flush_all ();
       if (error == ER_LC_PARTIALLY_FAILED_TO_FLUSH)
 	{
@@ -4824,30 +4966,42 @@ la_repl_add_object (MOP classop, LA_ITEM * item, RECDES * recdes)
   int operation = 0;
   OID *class_oid;
   bool has_index = false;
+  LA_REPL_CLASS_INFO *cached_info;
 
   assert (classop != NULL && item != NULL);
 
   class_oid = ws_oid (classop);
 
-  error = au_fetch_class (classop, &class_, AU_FETCH_READ, AU_SELECT);
-  if (error != NO_ERROR)
+  cached_info = la_find_cached_repl_class_info (class_oid);
+  if (cached_info != NULL)
     {
-      return error;
+      /* the class was already looked up for an earlier item of the current flush group */
+      pruning_type = cached_info->pruning_type;
+      has_index = cached_info->has_index;
     }
-
-  error = sm_flush_objects (classop);
-  if (error != NO_ERROR)
+  else
     {
-      return error;
-    }
+      error = au_fetch_class (classop, &class_, AU_FETCH_READ, AU_SELECT);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      error = sm_flush_objects (classop);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
 
-  if (item->item_type != RVREPL_DATA_DELETE)
-    {
       error = sm_partitioned_class_type (classop, &pruning_type, NULL, NULL);
       if (error != NO_ERROR)
 	{
 	  return error;
 	}
+
+      has_index = classobj_class_has_indexes (class_);
+
+      la_cache_repl_class_info (class_oid, pruning_type, has_index);
     }
 
   switch (item->item_type)
@@ -4867,8 +5021,6 @@ la_repl_add_object (MOP classop, LA_ITEM * item, RECDES * recdes)
       assert (false);
     }
 
-  has_index = classobj_class_has_indexes (class_);
-
   error = ws_add_to_repl_obj_list (class_oid, item->packed_key_value, item->packed_key_value_length, recdes,
 				   operation, has_index);
   return error;
@@ -6826,6 +6978,7 @@ la_init (const char *log_path, const int max_mem_size)
   la_Info.db_lockf_vdes = NULL_VOLDES;
 
   la_Info.num_unflushed = 0;
+  la_clear_repl_class_info_cache ();
 
   la_recdes_pool.is_initialized = false;
 
@@ -6951,6 +7104,7 @@ la_shutdown (void)
     }
 
   la_Info.num_unflushed = 0;
+  la_clear_repl_class_info_cache ();
 
   la_destroy_repl_filter ();
 
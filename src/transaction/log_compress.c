@@ -19,18 +19,94 @@
 /*
  * log_compress.c - log compression functions
  *
- * Note: Using lz4 library
+ * Note: Using lz4 and zstd libraries
  */
 
 #ident "$Id$"
 
+#include <stdio.h>
 #include <string.h>
 #include <assert.h>
+#include <pthread.h>
 
 #include "log_compress.h"
 #include "error_manager.h"
 #include "memory_alloc.h"
 #include "perf_monitor.h"
+#include "system_parameter.h"
+
+/* dictionary shared by the zstd codec, loaded once from log_zstd_dictionary_file; NULL compresses without one */
+static char *log_Zstd_dict = NULL;
+static size_t log_Zstd_dict_size = 0;
+static bool log_Zstd_dict_loaded = false;
+static pthread_mutex_t log_Zstd_dict_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void log_zstd_load_dictionary (void);
+
+/*
+ * log_zstd_load_dictionary - read the zstd dictionary file once, if one is configured
+ *   return: nothing
+ *
+ * Note: Errors are not fatal; compression silently proceeds without a dictionary. Both ends of log shipping must be
+ *       configured with the same dictionary file, since zstd needs it again to decompress.
+ */
+static void
+log_zstd_load_dictionary (void)
+{
+  const char *dict_path;
+  FILE *fp;
+  long file_size;
+
+  if (log_Zstd_dict_loaded)
+    {
+      return;
+    }
+
+  pthread_mutex_lock (&log_Zstd_dict_mutex);
+  if (log_Zstd_dict_loaded)
+    {
+      pthread_mutex_unlock (&log_Zstd_dict_mutex);
+      return;
+    }
+
+  dict_path = prm_get_string_value (PRM_ID_LOG_ZSTD_DICTIONARY_FILE);
+  if (dict_path != NULL && *dict_path != '\0')
+    {
+      fp = fopen (dict_path, "rb");
+      if (fp != NULL)
+	{
+	  if (fseek (fp, 0, SEEK_END) == 0 && (file_size = ftell (fp)) > 0 && fseek (fp, 0, SEEK_SET) == 0)
+	    {
+	      log_Zstd_dict = (char *) malloc ((size_t) file_size);
+	      if (log_Zstd_dict != NULL)
+		{
+		  if (fread (log_Zstd_dict, 1, (size_t) file_size, fp) == (size_t) file_size)
+		    {
+		      log_Zstd_dict_size = (size_t) file_size;
+		    }
+		  else
+		    {
+		      free_and_init (log_Zstd_dict);
+		    }
+		}
+	      else
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) file_size);
+		}
+	    }
+	  fclose (fp);
+	}
+
+      if (log_Zstd_dict == NULL)
+	{
+	  er_log_debug (ARG_FILE_LINE, "log_zstd_load_dictionary: cannot load dictionary \"%s\"; "
+			"compressing without a dictionary\n", dict_path);
+	}
+    }
+
+  log_Zstd_dict_loaded = true;
+  pthread_mutex_unlock (&log_Zstd_dict_mutex);
+}
 
 /*
  * log_zip - compress(zip) log data into LOG_ZIP
@@ -43,6 +119,7 @@ bool
 log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
 {
   int zip_len = 0;
+  int zstd_level;
   LOG_ZIP_SIZE_T buf_size;
   bool compressed;
 #if defined (SERVER_MODE) || defined (SA_MODE)
@@ -89,19 +166,62 @@ log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
 
   compressed = false;
 
-  /* save original data length */
-  memcpy (log_zip->log_data, &length, sizeof (LOG_ZIP_SIZE_T));
+  zstd_level = prm_get_integer_value (PRM_ID_LOG_ZSTD_COMPRESS_LEVEL);
+  if (zstd_level > 0)
+    {
+      size_t zstd_len;
+      LOG_ZIP_SIZE_T stored_length = MAKE_CODEC_ZSTD_LEN (length);
+
+      /* save original data length, tagged with the codec */
+      memcpy (log_zip->log_data, &stored_length, sizeof (LOG_ZIP_SIZE_T));
 
-  zip_len =
-    LZ4_compress_default ((const char *) data, log_zip->log_data + sizeof (LOG_ZIP_SIZE_T), length,
-			  buf_size - sizeof (LOG_ZIP_SIZE_T));
-  if (zip_len > 0)
+      log_zstd_load_dictionary ();
+      if (log_Zstd_dict != NULL)
+	{
+	  ZSTD_CCtx *cctx = ZSTD_createCCtx ();
+
+	  if (cctx == NULL)
+	    {
+	      return false;
+	    }
+	  zstd_len =
+	    ZSTD_compress_usingDict (cctx, log_zip->log_data + sizeof (LOG_ZIP_SIZE_T),
+				     buf_size - sizeof (LOG_ZIP_SIZE_T), data, length, log_Zstd_dict,
+				     log_Zstd_dict_size, zstd_level);
+	  ZSTD_freeCCtx (cctx);
+	}
+      else
+	{
+	  zstd_len =
+	    ZSTD_compress (log_zip->log_data + sizeof (LOG_ZIP_SIZE_T), buf_size - sizeof (LOG_ZIP_SIZE_T), data,
+			   length, zstd_level);
+	}
+      if (!ZSTD_isError (zstd_len))
+	{
+	  log_zip->data_length = (LOG_ZIP_SIZE_T) zstd_len + sizeof (LOG_ZIP_SIZE_T);
+	  /* if the compressed data length >= orginal length, then it means that compression failed */
+	  if (log_zip->data_length < length)
+	    {
+	      compressed = true;
+	    }
+	}
+    }
+  else
     {
-      log_zip->data_length = (LOG_ZIP_SIZE_T) zip_len + sizeof (LOG_ZIP_SIZE_T);
-      /* if the compressed data length >= orginal length, then it means that compression failed */
-      if (log_zip->data_length < length)
+      /* save original data length */
+      memcpy (log_zip->log_data, &length, sizeof (LOG_ZIP_SIZE_T));
+
+      zip_len =
+	LZ4_compress_default ((const char *) data, log_zip->log_data + sizeof (LOG_ZIP_SIZE_T), length,
+			      buf_size - sizeof (LOG_ZIP_SIZE_T));
+      if (zip_len > 0)
 	{
-	  compressed = true;
+	  log_zip->data_length = (LOG_ZIP_SIZE_T) zip_len + sizeof (LOG_ZIP_SIZE_T);
+	  /* if the compressed data length >= orginal length, then it means that compression failed */
+	  if (log_zip->data_length < length)
+	    {
+	      compressed = true;
+	    }
 	}
     }
 
@@ -125,6 +245,7 @@ log_unzip (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data)
   int unzip_len;
   LOG_ZIP_SIZE_T buf_size;
   bool decompressed;
+  bool is_zstd;
 #if defined (SERVER_MODE) || defined (SA_MODE)
   PERF_UTIME_TRACKER time_track;
 #endif
@@ -132,8 +253,11 @@ log_unzip (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data)
   assert (length > 0 && data != NULL);
   assert (log_unzip != NULL);
 
-  /* get original legnth from the compressed data */
+  /* get original legnth from the compressed data; its second-highest bit carries the codec the record was
+   * compressed with */
   memcpy (&buf_size, data, sizeof (LOG_ZIP_SIZE_T));
+  is_zstd = CODEC_ZSTD_CHECK (buf_size);
+  buf_size = GET_CODEC_LEN (buf_size);
 
   if (buf_size <= 0)
     {
@@ -170,15 +294,53 @@ log_unzip (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data)
 
   decompressed = false;
 
-  unzip_len =
-    LZ4_decompress_safe ((const char *) data + sizeof (LOG_ZIP_SIZE_T), (char *) log_unzip->log_data, length, buf_size);
-  if (unzip_len >= 0)
+  if (is_zstd)
+    {
+      size_t zstd_len;
+
+      log_zstd_load_dictionary ();
+      if (log_Zstd_dict != NULL)
+	{
+	  ZSTD_DCtx *dctx = ZSTD_createDCtx ();
+
+	  if (dctx == NULL)
+	    {
+	      return false;
+	    }
+	  zstd_len =
+	    ZSTD_decompress_usingDict (dctx, log_unzip->log_data, buf_size,
+				       (const char *) data + sizeof (LOG_ZIP_SIZE_T), length, log_Zstd_dict,
+				       log_Zstd_dict_size);
+	  ZSTD_freeDCtx (dctx);
+	}
+      else
+	{
+	  zstd_len =
+	    ZSTD_decompress (log_unzip->log_data, buf_size, (const char *) data + sizeof (LOG_ZIP_SIZE_T), length);
+	}
+      if (!ZSTD_isError (zstd_len))
+	{
+	  log_unzip->data_length = (LOG_ZIP_SIZE_T) zstd_len;
+	  /* if the uncompressed data length != original length, then it means that uncompression failed */
+	  if ((LOG_ZIP_SIZE_T) zstd_len == buf_size)
+	    {
+	      decompressed = true;
+	    }
+	}
+    }
+  else
     {
-      log_unzip->data_length = (LOG_ZIP_SIZE_T) unzip_len;
-      /* if the uncompressed data length != original length, then it means that uncompression failed */
-      if (unzip_len == buf_size)
+      unzip_len =
+	LZ4_decompress_safe ((const char *) data + sizeof (LOG_ZIP_SIZE_T), (char *) log_unzip->log_data, length,
+			     buf_size);
+      if (unzip_len >= 0)
 	{
-	  decompressed = true;
+	  log_unzip->data_length = (LOG_ZIP_SIZE_T) unzip_len;
+	  /* if the uncompressed data length != original length, then it means that uncompression failed */
+	  if (unzip_len == buf_size)
+	    {
+	      decompressed = true;
+	    }
 	}
     }
 
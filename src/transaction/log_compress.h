@@ -20,7 +20,7 @@
 /*
  * log_compress.h - log compression functions
  *
- * Note: Using lz4 library
+ * Note: Using lz4 and zstd libraries
  */
 
 #ifndef _LOG_COMPRESS_H_
@@ -29,6 +29,7 @@
 #ident "$Id$"
 
 #include "lz4.h"
+#include "zstd.h"
 
 #define MAKE_ZIP_LEN(length)                                                  \
          ((length) | 0x80000000)
@@ -39,9 +40,23 @@
 #define ZIP_CHECK(length)                                                     \
          (((length) & 0x80000000) ? true : false)
 
-/* plus lz4 overhead to log_zip data size */
+/* the original-length word stored in front of the compressed payload carries the codec in its second-highest bit, so
+ * that decompression auto-detects the codec a record was written with */
+#define LOG_ZIP_CODEC_ZSTD 0x40000000
+
+#define MAKE_CODEC_ZSTD_LEN(length)                                           \
+         ((length) | LOG_ZIP_CODEC_ZSTD)
+
+#define GET_CODEC_LEN(length)                                                 \
+         ((length) & ~(LOG_ZIP_CODEC_ZSTD))
+
+#define CODEC_ZSTD_CHECK(length)                                              \
+         (((length) & LOG_ZIP_CODEC_ZSTD) ? true : false)
+
+/* plus worst-case codec overhead to log_zip data size */
 #define LOG_ZIP_BUF_SIZE(length) \
-        (LZ4_compressBound(length) + sizeof(LOG_ZIP_SIZE_T))
+        ((LZ4_compressBound(length) > (int) ZSTD_compressBound(length) \
+          ? LZ4_compressBound(length) : (int) ZSTD_compressBound(length)) + sizeof(LOG_ZIP_SIZE_T))
 
 #define LOG_ZIP_SIZE_T int
 
@@ -511,6 +511,9 @@ struct log_tdes
 
   int tran_index;		/* Index onto transaction table */
   TRANID trid;			/* Transaction identifier */
+  volatile int slot_claimed;	/* claimed with a CAS to take ownership of the entry without the TR_TABLE section;
+				 * scanners keep testing trid only, which is stored last when the entry is initialized
+				 * (see logtb_assign_tran_index) */
 
   bool isloose_end;
   TRAN_STATE state;		/* Transaction state (e.g., Active, aborted) */
@@ -1025,6 +1028,7 @@ extern int logpb_fetch_start_append_page (THREAD_ENTRY * thread_p);
 extern LOG_PAGE *logpb_fetch_start_append_page_new (THREAD_ENTRY * thread_p);
 extern void logpb_flush_pages_direct (THREAD_ENTRY * thread_p);
 extern void logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa);
+extern int logpb_get_group_commit_interval_msec (void);
 extern void logpb_force_flush_pages (THREAD_ENTRY * thread_p);
 extern void logpb_force_flush_header_and_pages (THREAD_ENTRY * thread_p);
 extern void logpb_invalid_all_append_pages (THREAD_ENTRY * thread_p);
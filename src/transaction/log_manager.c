@@ -5202,6 +5202,10 @@ log_commit_local (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool retain_lock, bo
 	      log_append_commit_log (thread_p, tdes, &commit_lsa);
 	    }
 
+	  /* The commit record is in the prior list with its LSA reserved, so locks can be released before the flush:
+	   * dependent transactions proceed during the fsync and only the client response waits on the flush
+	   * watermark. Group commit then turns the fsync latency into pipeline depth instead of lock hold time.
+	   * This ordering - append commit record, release locks, wait for flush - must be preserved. */
 	  if (retain_lock != true)
 	    {
 	      lock_unlock_all (thread_p);
@@ -5785,7 +5789,12 @@ log_complete_for_2pc (THREAD_ENTRY * thread_p, LOG_TDES * tdes, LOG_RECTYPE isco
 
 		      start_lsa = prior_lsa_next_record (thread_p, node, tdes);
 
-		      logpb_flush_pages (thread_p, &start_lsa);
+		      /*
+		       * Presumed abort: no need to force the informing record. The commit decision record was already
+		       * forced, so if this record is lost in a crash, recovery falls back to the decision state and
+		       * re-sends the (idempotent) commit decision to the participants.
+		       */
+		      log_wakeup_log_flush_daemon ();
 		    }
 		}
 	      else
@@ -5807,7 +5816,11 @@ log_complete_for_2pc (THREAD_ENTRY * thread_p, LOG_TDES * tdes, LOG_RECTYPE isco
 
 		      start_lsa = prior_lsa_next_record (thread_p, node, tdes);
 
-		      logpb_flush_pages (thread_p, &start_lsa);
+		      /*
+		       * Presumed abort: no flush needed. If the record is lost, abort is assumed anyway and the
+		       * participants are re-informed during recovery.
+		       */
+		      log_wakeup_log_flush_daemon ();
 		    }
 		}
 	      /*
@@ -5957,7 +5970,21 @@ log_complete_for_2pc (THREAD_ENTRY * thread_p, LOG_TDES * tdes, LOG_RECTYPE isco
 	      log_append_commit_log (thread_p, tdes, &commit_lsa);
 	    }
 
-	  log_change_tran_as_completed (thread_p, tdes, LOG_COMMIT, &commit_lsa);
+	  if (tdes->coord != NULL && tdes->coord->ack_received != NULL)
+	    {
+	      /*
+	       * Presumed abort: this is a coordinator whose commit decision record was already forced to disk, so
+	       * the outcome is durable and the final commit record may ride the next group commit. If it is lost in
+	       * a crash, recovery falls back to the decision state and re-sends the (idempotent) commit decision.
+	       */
+	      tdes->state = TRAN_UNACTIVE_COMMITTED;
+	      log_Stat.commit_count++;
+	      log_wakeup_log_flush_daemon ();
+	    }
+	  else
+	    {
+	      log_change_tran_as_completed (thread_p, tdes, LOG_COMMIT, &commit_lsa);
+	    }
 	}
       else
 	{
@@ -9993,7 +10020,7 @@ log_get_log_group_commit_interval (bool & is_timed_wait, cubthread::delta_time &
 #endif /* SERVER_MODE */
 
   const int MAX_WAIT_TIME_MSEC = 1000;
-  int log_group_commit_interval_msec = prm_get_integer_value (PRM_ID_LOG_GROUP_COMMIT_INTERVAL_MSECS);
+  int log_group_commit_interval_msec = logpb_get_group_commit_interval_msec ();
 
   assert (log_group_commit_interval_msec >= 0);
 
@@ -10013,6 +10040,7 @@ log_get_log_group_commit_interval (bool & is_timed_wait, cubthread::delta_time &
 void
 log_get_checkpoint_interval (bool & is_timed_wait, cubthread::delta_time & period)
 {
+  const int TRICKLE_PERIOD_SEC = 10;
   int log_checkpoint_interval_sec = prm_get_integer_value (PRM_ID_LOG_CHECKPOINT_INTERVAL_SECS);
 
   assert (log_checkpoint_interval_sec >= 0);
@@ -10021,7 +10049,16 @@ log_get_checkpoint_interval (bool & is_timed_wait, cubthread::delta_time & perio
     {
       // if log_checkpoint_interval_sec > 0 (zero) then loop for fixed interval
       is_timed_wait = true;
-      period = std::chrono::seconds (log_checkpoint_interval_sec);
+      if (prm_get_bool_value (PRM_ID_LOG_CHECKPOINT_TRICKLE_FLUSH) && log_checkpoint_interval_sec > TRICKLE_PERIOD_SEC)
+	{
+	  // tick more often than the checkpoint interval; ticks that fall between checkpoints trickle-flush the
+	  // oldest dirty pages (see log_checkpoint_execute)
+	  period = std::chrono::seconds (TRICKLE_PERIOD_SEC);
+	}
+      else
+	{
+	  period = std::chrono::seconds (log_checkpoint_interval_sec);
+	}
     }
   else
     {
@@ -10102,6 +10139,67 @@ log_flush_daemon_get_stats (UINT64 * statsp)
 
 // *INDENT-OFF*
 #if defined(SERVER_MODE)
+// time of the last full checkpoint; paces the trickle-flush horizon across the checkpoint interval
+static std::chrono::steady_clock::time_point log_Checkpoint_last_run_time;
+
+static bool
+log_checkpoint_interval_is_elapsed (void)
+{
+  int interval_sec = prm_get_integer_value (PRM_ID_LOG_CHECKPOINT_INTERVAL_SECS);
+
+  return std::chrono::steady_clock::now () - log_Checkpoint_last_run_time >= std::chrono::seconds (interval_sec);
+}
+
+// log_checkpoint_trickle_flush () - flush dirty pages older than an LSA horizon that advances from the last
+//                                   checkpoint LSA toward the current flushed log tail as the checkpoint interval
+//                                   elapses. By checkpoint time the dirty tail has already been written out, so the
+//                                   checkpoint flushes almost nothing and the periodic I/O burst disappears. Runs in
+//                                   the checkpoint daemon thread, which also owns the sequential flusher it borrows.
+static void
+log_checkpoint_trickle_flush (cubthread::entry & thread_ref)
+{
+  int interval_sec = prm_get_integer_value (PRM_ID_LOG_CHECKPOINT_INTERVAL_SECS);
+  LOG_LSA chkpt_lsa;
+  LOG_LSA nxio_lsa = log_Gl.append.get_nxio_lsa ();
+  LOG_LSA target_lsa;
+  LOG_LSA smallest_lsa;
+  int flushed_cnt = 0;
+  double elapsed_frac;
+
+  if (interval_sec <= 0)
+    {
+      return;
+    }
+
+  pthread_mutex_lock (&log_Gl.chkpt_lsa_lock);
+  LSA_COPY (&chkpt_lsa, &log_Gl.hdr.chkpt_lsa);
+  pthread_mutex_unlock (&log_Gl.chkpt_lsa_lock);
+
+  if (LSA_ISNULL (&chkpt_lsa) || nxio_lsa.pageid <= chkpt_lsa.pageid)
+    {
+      return;
+    }
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - log_Checkpoint_last_run_time;
+  elapsed_frac = elapsed.count () / (double) interval_sec;
+  if (elapsed_frac > 1.0)
+    {
+      elapsed_frac = 1.0;
+    }
+
+  target_lsa.pageid = chkpt_lsa.pageid + (LOG_PAGEID) (elapsed_frac * (double) (nxio_lsa.pageid - chkpt_lsa.pageid));
+  target_lsa.offset = 0;
+
+  if (LSA_LE (&target_lsa, &chkpt_lsa))
+    {
+      // everything older than the last checkpoint was already flushed by it
+      return;
+    }
+
+  // paced by checkpoint_sleep_msecs like the checkpoint flush itself; errors are left for the next full checkpoint
+  (void) pgbuf_flush_checkpoint (&thread_ref, &target_lsa, NULL, &smallest_lsa, &flushed_cnt);
+}
+
 static void
 log_checkpoint_execute (cubthread::entry & thread_ref)
 {
@@ -10111,7 +10209,16 @@ log_checkpoint_execute (cubthread::entry & thread_ref)
       return;
     }
 
+  if (prm_get_bool_value (PRM_ID_LOG_CHECKPOINT_TRICKLE_FLUSH) && !log_Checkpoint_daemon->was_woken_up ()
+      && !log_checkpoint_interval_is_elapsed ())
+    {
+      // a trickle tick, not a checkpoint tick; an explicit wakeup still checkpoints immediately
+      log_checkpoint_trickle_flush (thread_ref);
+      return;
+    }
+
   logpb_checkpoint (&thread_ref);
+  log_Checkpoint_last_run_time = std::chrono::steady_clock::now ();
 }
 #endif /* SERVER_MODE */
 
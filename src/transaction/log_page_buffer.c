@@ -276,6 +276,14 @@ static ARV_LOG_PAGE_INFO_TABLE logpb_Arv_page_info_table;
 static bool logpb_Initialized = false;
 static bool logpb_Logging = false;
 
+#if defined(SERVER_MODE)
+/* smoothed duration of logpb_flush_all_append_pages in microseconds; feeds the adaptive group commit window */
+static INT64 logpb_Flush_time_ema_usec = 0;
+/* clock of the most recent group commit request; read and written without a lock, a stale value only costs one
+ * suboptimal batching decision */
+static INT64 logpb_Last_commit_request_msec = 0;
+#endif /* SERVER_MODE */
+
 /*
  * Functions
  */
@@ -3227,6 +3235,8 @@ logpb_flush_all_append_pages (THREAD_ENTRY * thread_p)
 
   int rv;
 #if defined(SERVER_MODE)
+  TSC_TICKS flush_start_tick, flush_end_tick;
+  TSCTIMEVAL flush_elapsed;
   INT64 flush_start_time = 0;
   INT64 flush_completed_time = 0;
   INT64 all_writer_thr_end_time = 0;
@@ -3240,6 +3250,10 @@ logpb_flush_all_append_pages (THREAD_ENTRY * thread_p)
 
   logpb_log ("called logpb_flush_all_append_pages\n");
 
+#if defined(SERVER_MODE)
+  tsc_getticks (&flush_start_tick);
+#endif /* SERVER_MODE */
+
 #if defined(CUBRID_DEBUG)
   er_log_debug (ARG_FILE_LINE, "logpb_flush_all_append_pages: start\n");
 
@@ -3887,6 +3901,19 @@ logpb_flush_all_append_pages (THREAD_ENTRY * thread_p)
       /* reset event logging parameter */
       thread_p->event_stats.trace_log_flush_time = 0;
     }
+
+  /* fold the duration of this flush into the moving average that drives the adaptive group commit window. Only the
+   * flush holder writes it, so no lock is needed. */
+  tsc_getticks (&flush_end_tick);
+  tsc_elapsed_time_usec (&flush_elapsed, flush_end_tick, flush_start_tick);
+  logpb_Flush_time_ema_usec =
+    (logpb_Flush_time_ema_usec * 7 + flush_elapsed.tv_sec * 1000000LL + flush_elapsed.tv_usec) / 8;
+
+  if (perfmon_is_perf_tracking ())
+    {
+      perfmon_time_histogram (thread_p, PSTAT_LOG_FLUSH_TIME_HISTOGRAM,
+			      (UINT64) (flush_elapsed.tv_sec * 1000000LL + flush_elapsed.tv_usec));
+    }
 #endif /* SERVER_MODE */
 
   return 1;
@@ -3931,6 +3958,41 @@ logpb_flush_pages_direct (THREAD_ENTRY * thread_p)
   log_Stat.direct_flush_count++;
 }
 
+/*
+ * logpb_get_group_commit_interval_msec - compute the effective group commit batching window
+ *
+ * return: window for the log flush daemon in milliseconds
+ *
+ * NOTE: With adaptive_group_commit enabled the window follows the measured flush latency instead of the raw
+ *       parameter value: there is no benefit in waking the flush daemon more often than one flush takes, and
+ *       waiting much longer than that only adds commit latency without growing the group. The configured
+ *       group_commit_interval_in_msecs remains the upper bound, so the window can only get shorter.
+ */
+int
+logpb_get_group_commit_interval_msec (void)
+{
+  int interval_msec = sysprm_get_hot_params ()->log_group_commit_interval_msecs;
+
+#if defined(SERVER_MODE)
+  if (interval_msec > 0 && prm_get_bool_value (PRM_ID_ADAPTIVE_GROUP_COMMIT))
+    {
+      /* give concurrent committers twice the flush time to join the group, but at least one millisecond */
+      INT64 adaptive_msec = (logpb_Flush_time_ema_usec * 2) / 1000;
+
+      if (adaptive_msec < 1)
+	{
+	  adaptive_msec = 1;
+	}
+      if (adaptive_msec < interval_msec)
+	{
+	  interval_msec = (int) adaptive_msec;
+	}
+    }
+#endif /* SERVER_MODE */
+
+  return interval_msec;
+}
+
 /*
  * logpb_flush_pages - FLUSH LOG APPEND PAGES
  *
@@ -3984,7 +4046,9 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
       return;
     }
 
-  async_commit = prm_get_bool_value (PRM_ID_LOG_ASYNC_COMMIT);
+  /* relaxed_commit_durability is a session parameter: a transaction that can tolerate losing its last commits on a
+   * crash opts out of waiting for the flush without changing the server-wide async_commit setting */
+  async_commit = sysprm_get_hot_params ()->log_async_commit || prm_get_bool_value (PRM_ID_RELAXED_COMMIT_DURABILITY);
   group_commit = LOG_IS_GROUP_COMMIT_ACTIVE ();
 
   if (async_commit == false)
@@ -4020,6 +4084,19 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	}
     }
 
+  if (group_commit == true && prm_get_bool_value (PRM_ID_ADAPTIVE_GROUP_COMMIT))
+    {
+      INT64 now_msec = log_get_clock_msec ();
+
+      if (now_msec - logpb_Last_commit_request_msec > sysprm_get_hot_params ()->log_group_commit_interval_msecs)
+	{
+	  /* the log has been idle for longer than one batching window; no other commit is likely to join this group,
+	   * so wake the flush daemon immediately instead of sitting out the window */
+	  need_wakeup_LFT = true;
+	}
+      logpb_Last_commit_request_msec = now_msec;
+    }
+
   if (need_wakeup_LFT == true && need_wait == false)
     {
       log_wakeup_log_flush_daemon ();
@@ -7126,6 +7203,9 @@ logpb_checkpoint (THREAD_ENTRY * thread_p)
 
   pthread_mutex_unlock (&log_Gl.chkpt_lsa_lock);
 
+  /* pages not flushed after a checkpoint logged by this process can now be recognized by incremental backups */
+  fileio_activate_changed_page_tracker (&chkpt_lsa);
+
   detailed_er_log ("logpb_checkpoint: call logpb_flush_header()\n");
   logpb_flush_header (thread_p);
 
@@ -52,8 +52,11 @@
 #include "porting_inline.hpp"
 #include "log_compress.h"
 #include "thread_entry.hpp"
+#include "thread_entry_task.hpp"
 #include "thread_manager.hpp"
 
+#include <memory>
+
 static void log_rv_undo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				LOG_RCVINDEX rcvindex, const VPID * rcv_vpid, LOG_RCV * rcv,
 				const LOG_LSA * rcv_lsa_ptr, LOG_TDES * tdes, LOG_ZIP * undo_unzip_ptr);
@@ -3035,6 +3038,320 @@ log_recovery_needs_skip_logical_redo (THREAD_ENTRY * thread_p, TRANID tran_id, L
   return false;
 }
 
+#if defined(SERVER_MODE)
+/* Parallel prefetch of data pages for the redo phase.
+ *
+ * The redo scan itself must stay sequential in this log design: records chain through forw_lsa, several record types
+ * update global state while being scanned (transaction table, MVCC header, unique statistics) and per-page ordering
+ * is guaranteed by the single scan. What dominates elapsed time on a busy instance, however, is faulting the data
+ * pages in one by one. The redo scan therefore parses a window of upcoming log pages ahead of the apply position,
+ * extracts the VPID of every page-bound record and hands them in batches to a small worker pool that fixes and
+ * immediately unfixes each page, so that by the time the sequential apply reaches a record its page is already in
+ * the page buffer. Ordering is untouched because the apply remains the only writer.
+ */
+
+/* number of log pages parsed ahead of the apply position per window extension */
+static const LOG_PAGEID LOG_RV_PREFETCH_WINDOW_PAGES = 32;
+/* extend the window when the apply position gets this close to its end */
+static const LOG_PAGEID LOG_RV_PREFETCH_LEAD_PAGES = LOG_RV_PREFETCH_WINDOW_PAGES / 2;
+/* stop extending the window while the workers are this many batches behind */
+static const INT64 LOG_RV_PREFETCH_MAX_PENDING_BATCHES = 64;
+
+// *INDENT-OFF*
+class log_rv_prefetch_context : public cubthread::entry_manager
+{
+  public:
+    std::atomic<INT64> m_batches_pushed = {0};
+    std::atomic<INT64> m_batches_done = {0};
+
+  protected:
+    void on_create (context_type &context) override
+    {
+      context.claim_system_worker ();
+    }
+};
+
+class log_rv_prefetch_task : public cubthread::entry_task
+{
+  public:
+    static const size_t BATCH_SIZE = 32;
+
+    log_rv_prefetch_task () = delete;
+    log_rv_prefetch_task (log_rv_prefetch_context &context)
+      : m_context (context)
+      , m_vpids ()
+    {
+      m_vpids.reserve (BATCH_SIZE);
+    }
+
+    void add_vpid (const VPID &vpid)
+    {
+      m_vpids.push_back (vpid);
+    }
+
+    bool is_full () const
+    {
+      return m_vpids.size () >= BATCH_SIZE;
+    }
+
+    void execute (cubthread::entry &thread_ref) override
+    {
+      for (const VPID &vpid : m_vpids)
+	{
+	  PAGE_PTR page = pgbuf_fix (&thread_ref, &vpid, RECOVERY_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+	  if (page != NULL)
+	    {
+	      pgbuf_unfix (&thread_ref, page);
+	    }
+	  else
+	    {
+	      /* nothing to do; the sequential redo scan fixes the page itself and reports the real error */
+	      er_clear ();
+	    }
+	}
+      m_context.m_batches_done++;
+    }
+
+  private:
+    log_rv_prefetch_context &m_context;
+    std::vector<VPID> m_vpids;
+};
+// *INDENT-ON*
+
+/*
+ * log_rv_redo_prefetch_window - parse a window of log pages ahead of the redo scan and queue the data pages
+ *                               referenced by page-bound records for prefetch
+ *
+ * return: nothing
+ *
+ *   prefetch_lsa(in/out): address where the previous window ended; advanced to the end of this window and set to
+ *                         NULL when the scan reached the end of the redo range
+ *   end_redo_lsa(in): scanning never goes past this address
+ *   context(in/out): counters shared with the prefetch workers
+ *   pool(in): prefetch worker pool
+ *
+ * NOTE: Runs on the recovery thread, which owns LOG_CS, so log pages are read with LOG_CS_FORCE_USE just like the
+ *       redo scan itself. Any irregularity in the record chain simply ends the window; the sequential scan is the
+ *       one that diagnoses real corruption.
+ */
+static void
+log_rv_redo_prefetch_window (THREAD_ENTRY * thread_p, LOG_LSA * prefetch_lsa, const LOG_LSA * end_redo_lsa,
+			     log_rv_prefetch_context & context, cubthread::entry_workpool * pool)
+{
+  char log_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_log_pgbuf;
+  LOG_PAGE *log_pgptr = NULL;
+  LOG_LSA lsa, log_lsa;
+  LOG_RECORD_HEADER *log_rec = NULL;
+  LOG_PAGEID last_pageid;
+  LOG_RECTYPE log_rtype;
+  VPID vpid;
+  VPID last_vpid;
+  // *INDENT-OFF*
+  std::unique_ptr<log_rv_prefetch_task> task;
+  // *INDENT-ON*
+
+  if (context.m_batches_pushed - context.m_batches_done > LOG_RV_PREFETCH_MAX_PENDING_BATCHES)
+    {
+      /* the workers are far behind; queueing more pages would only get them evicted before the apply arrives */
+      return;
+    }
+
+  aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
+  log_pgptr = (LOG_PAGE *) aligned_log_pgbuf;
+
+  VPID_SET_NULL (&last_vpid);
+  LSA_COPY (&lsa, prefetch_lsa);
+  last_pageid = lsa.pageid + LOG_RV_PREFETCH_WINDOW_PAGES;
+
+  while (!LSA_ISNULL (&lsa) && lsa.pageid <= last_pageid)
+    {
+      LSA_COPY (&log_lsa, &lsa);
+      if (logpb_fetch_page (thread_p, &log_lsa, LOG_CS_FORCE_USE, log_pgptr) != NO_ERROR)
+	{
+	  LSA_SET_NULL (&lsa);
+	  break;
+	}
+
+      while (lsa.pageid == log_lsa.pageid)
+	{
+	  if (LSA_GT (&lsa, end_redo_lsa))
+	    {
+	      LSA_SET_NULL (&lsa);
+	      break;
+	    }
+
+	  if (lsa.offset == NULL_OFFSET && (lsa.offset = log_pgptr->hdr.offset) == NULL_OFFSET)
+	    {
+	      /* incomplete record archived; continue with the next page like the redo scan does */
+	      if (logpb_is_page_in_archive (log_lsa.pageid))
+		{
+		  lsa.pageid = log_lsa.pageid + 1;
+		}
+	      else
+		{
+		  LSA_SET_NULL (&lsa);
+		}
+	      continue;
+	    }
+
+	  log_lsa.offset = lsa.offset;
+	  log_rec = LOG_GET_LOG_RECORD_HEADER (log_pgptr, &log_lsa);
+	  log_rtype = (LOG_RECTYPE) log_rec->type;
+
+	  LSA_COPY (&lsa, &log_rec->forw_lsa);
+	  if (LSA_ISNULL (&lsa) && logpb_is_page_in_archive (log_lsa.pageid))
+	    {
+	      lsa.pageid = log_lsa.pageid + 1;
+	    }
+
+	  if (!LSA_ISNULL (&lsa)
+	      && (lsa.pageid < log_lsa.pageid || (lsa.pageid == log_lsa.pageid && lsa.offset <= log_lsa.offset)))
+	    {
+	      /* broken chain; leave the diagnosis to the redo scan */
+	      LSA_SET_NULL (&lsa);
+	      break;
+	    }
+
+	  VPID_SET_NULL (&vpid);
+	  switch (log_rtype)
+	    {
+	    case LOG_MVCC_UNDOREDO_DATA:
+	    case LOG_MVCC_DIFF_UNDOREDO_DATA:
+	      {
+		LOG_REC_MVCC_UNDOREDO *mvcc_undoredo = NULL;
+
+		LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
+		LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_MVCC_UNDOREDO), &log_lsa, log_pgptr);
+		mvcc_undoredo = (LOG_REC_MVCC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa.offset);
+		vpid.volid = mvcc_undoredo->undoredo.data.volid;
+		vpid.pageid = mvcc_undoredo->undoredo.data.pageid;
+	      }
+	      break;
+
+	    case LOG_UNDOREDO_DATA:
+	    case LOG_DIFF_UNDOREDO_DATA:
+	      {
+		LOG_REC_UNDOREDO *undoredo = NULL;
+
+		LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
+		LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_UNDOREDO), &log_lsa, log_pgptr);
+		undoredo = (LOG_REC_UNDOREDO *) ((char *) log_pgptr->area + log_lsa.offset);
+		vpid.volid = undoredo->data.volid;
+		vpid.pageid = undoredo->data.pageid;
+	      }
+	      break;
+
+	    case LOG_MVCC_REDO_DATA:
+	      {
+		LOG_REC_MVCC_REDO *mvcc_redo = NULL;
+
+		LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
+		LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_MVCC_REDO), &log_lsa, log_pgptr);
+		mvcc_redo = (LOG_REC_MVCC_REDO *) ((char *) log_pgptr->area + log_lsa.offset);
+		vpid.volid = mvcc_redo->redo.data.volid;
+		vpid.pageid = mvcc_redo->redo.data.pageid;
+	      }
+	      break;
+
+	    case LOG_REDO_DATA:
+	      {
+		LOG_REC_REDO *redo = NULL;
+
+		LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
+		LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_REDO), &log_lsa, log_pgptr);
+		redo = (LOG_REC_REDO *) ((char *) log_pgptr->area + log_lsa.offset);
+		vpid.volid = redo->data.volid;
+		vpid.pageid = redo->data.pageid;
+	      }
+	      break;
+
+	    case LOG_RUN_POSTPONE:
+	      {
+		LOG_REC_RUN_POSTPONE *run_posp = NULL;
+
+		LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
+		LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_RUN_POSTPONE), &log_lsa, log_pgptr);
+		run_posp = (LOG_REC_RUN_POSTPONE *) ((char *) log_pgptr->area + log_lsa.offset);
+		vpid.volid = run_posp->data.volid;
+		vpid.pageid = run_posp->data.pageid;
+	      }
+	      break;
+
+	    case LOG_COMPENSATE:
+	      {
+		LOG_REC_COMPENSATE *compensate = NULL;
+
+		LOG_READ_ADD_ALIGN (thread_p, sizeof (LOG_RECORD_HEADER), &log_lsa, log_pgptr);
+		LOG_READ_ADVANCE_WHEN_DOESNT_FIT (thread_p, sizeof (LOG_REC_COMPENSATE), &log_lsa, log_pgptr);
+		compensate = (LOG_REC_COMPENSATE *) ((char *) log_pgptr->area + log_lsa.offset);
+		vpid.volid = compensate->data.volid;
+		vpid.pageid = compensate->data.pageid;
+	      }
+	      break;
+
+	    default:
+	      /* not a page-bound record; nothing to prefetch */
+	      break;
+	    }
+
+	  if (vpid.pageid != NULL_PAGEID && vpid.volid != NULL_VOLID && !VPID_EQ (&vpid, &last_vpid))
+	    {
+	      VPID_COPY (&last_vpid, &vpid);
+	      if (task == NULL)
+		{
+		  // *INDENT-OFF*
+		  task.reset (new log_rv_prefetch_task (context));
+		  // *INDENT-ON*
+		}
+	      task->add_vpid (vpid);
+	      if (task->is_full ())
+		{
+		  context.m_batches_pushed++;
+		  // *INDENT-OFF*
+		  cubthread::get_manager ()->push_task (pool, task.release ());
+		  // *INDENT-ON*
+		}
+	    }
+	}
+    }
+
+  if (task != NULL)
+    {
+      context.m_batches_pushed++;
+      // *INDENT-OFF*
+      cubthread::get_manager ()->push_task (pool, task.release ());
+      // *INDENT-ON*
+    }
+
+  LSA_COPY (prefetch_lsa, &lsa);
+}
+
+/*
+ * log_rv_redo_prefetch_finalize - wait for the outstanding prefetch batches and destroy the worker pool
+ *
+ * return: nothing
+ *
+ *   context(in/out): counters shared with the prefetch workers
+ *   pool(in/out): prefetch worker pool; set to NULL
+ */
+static void
+log_rv_redo_prefetch_finalize (log_rv_prefetch_context & context, cubthread::entry_workpool * &pool)
+{
+  if (pool == NULL)
+    {
+      return;
+    }
+
+  while (context.m_batches_done < context.m_batches_pushed)
+    {
+      thread_sleep (10);
+    }
+
+  cubthread::get_manager ()->destroy_worker_pool (pool);
+  pool = NULL;
+}
+#endif /* SERVER_MODE */
+
 /*
  * log_recovery_redo - SCAN FORWARD REDOING DATA
  *
@@ -3109,6 +3426,11 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   TSCTIMEVAL info_logging_elapsed_time;
   int info_logging_interval_in_secs = 0;
   UINT64 total_page_cnt = log_cnt_pages_containing_lsa (start_redolsa, end_redo_lsa);
+#if defined(SERVER_MODE)
+  cubthread::entry_workpool *prefetch_pool = NULL;
+  log_rv_prefetch_context prefetch_context;
+  LOG_LSA prefetch_lsa = LSA_INITIALIZER;
+#endif /* SERVER_MODE */
 
   aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
@@ -3150,6 +3472,21 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
       return;
     }
 
+#if defined(SERVER_MODE)
+  if (prm_get_integer_value (PRM_ID_RECOVERY_PREFETCH_THREAD_COUNT) > 0 && end_redo_lsa != NULL
+      && !LSA_ISNULL (end_redo_lsa))
+    {
+      int prefetch_threads = prm_get_integer_value (PRM_ID_RECOVERY_PREFETCH_THREAD_COUNT);
+
+      prefetch_pool =
+	cubthread::get_manager ()->create_worker_pool (prefetch_threads,
+						       (size_t) (LOG_RV_PREFETCH_MAX_PENDING_BATCHES
+								 + prefetch_threads),
+						       "Recovery redo prefetch pool", &prefetch_context, 1, false);
+      LSA_COPY (&prefetch_lsa, start_redolsa);
+    }
+#endif /* SERVER_MODE */
+
   info_logging_interval_in_secs = prm_get_integer_value (PRM_ID_RECOVERY_PROGRESS_LOGGING_INTERVAL);
   if (info_logging_interval_in_secs > 0 && info_logging_interval_in_secs < 5)
     {
@@ -3179,6 +3516,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	    }
 	}
 
+#if defined(SERVER_MODE)
+      if (prefetch_pool != NULL && !LSA_ISNULL (&prefetch_lsa)
+	  && prefetch_lsa.pageid <= log_lsa.pageid + LOG_RV_PREFETCH_LEAD_PAGES)
+	{
+	  /* the apply position is getting close to the end of the prefetched range; parse the next window of log
+	   * pages and queue their data pages for the prefetch workers */
+	  log_rv_redo_prefetch_window (thread_p, &prefetch_lsa, end_redo_lsa, prefetch_context, prefetch_pool);
+	}
+#endif /* SERVER_MODE */
+
       /* PRM_ID_RECOVERY_PROGRESS_LOGGING_INTERVAL > 0 */
       if (info_logging_interval_in_secs > 0)
 	{
@@ -4117,6 +4464,10 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   (void) pgbuf_flush_all (thread_p, NULL_VOLID);
 
 exit:
+#if defined(SERVER_MODE)
+  log_rv_redo_prefetch_finalize (prefetch_context, prefetch_pool);
+#endif /* SERVER_MODE */
+
   LSA_SET_NULL (&log_Gl.unique_stats_table.curr_rcv_rec_lsa);
 
   return;
@@ -99,6 +99,9 @@ static BOOT_CLIENT_CREDENTIAL log_Client_credential;
 static const unsigned int LOGTB_RETRY_SLAM_MAX_TIMES = 10;
 
 static int logtb_expand_trantable (THREAD_ENTRY * thread_p, int num_new_indices);
+static int logtb_allocate_tran_index_lockfree (THREAD_ENTRY * thread_p, TRANID trid, TRAN_STATE state,
+					       const BOOT_CLIENT_CREDENTIAL * client_credential,
+					       TRAN_STATE * current_state, int wait_msecs, TRAN_ISOLATION isolation);
 static int logtb_allocate_tran_index (THREAD_ENTRY * thread_p, TRANID trid, TRAN_STATE state,
 				      const BOOT_CLIENT_CREDENTIAL * client_credential, TRAN_STATE * current_state,
 				      int wait_msecs, TRAN_ISOLATION isolation);
@@ -655,12 +658,13 @@ logtb_set_number_of_assigned_tran_indices (int num_trans)
  *
  * return: nothing
  *
- * Note: Callers have to call this function in the 'TR_TABLE' critical section.
+ * Note: The count is kept with atomic operations; the lock-free allocation path updates it outside the 'TR_TABLE'
+ *       critical section.
  */
 static void
 logtb_increment_number_of_assigned_tran_indices (void)
 {
-  log_Gl.trantable.num_assigned_indices++;
+  ATOMIC_INC_32 (&log_Gl.trantable.num_assigned_indices, 1);
 }
 
 /*
@@ -669,12 +673,12 @@ logtb_increment_number_of_assigned_tran_indices (void)
  *
  * return: nothing
  *
- * Note: Callers have to call this function in the 'TR_TABLE' critical section.
+ * Note: The count is kept with atomic operations; see logtb_increment_number_of_assigned_tran_indices.
  */
 static void
 logtb_decrement_number_of_assigned_tran_indices (void)
 {
-  log_Gl.trantable.num_assigned_indices--;
+  ATOMIC_INC_32 (&log_Gl.trantable.num_assigned_indices, -1);
 }
 
 /*
@@ -803,6 +807,21 @@ logtb_assign_tran_index (THREAD_ENTRY * thread_p, TRANID trid, TRAN_STATE state,
 
   LOG_SET_CURRENT_TRAN_INDEX (thread_p, LOG_SYSTEM_TRAN_INDEX);
 
+  if (LOG_ISRESTARTED ())
+    {
+      /* Reconnect storms convoy on the TR_TABLE section. Claim an entry lock-free first; the critical section path
+       * below remains for a miss, since it also handles table expansion during recovery and the too-many-clients
+       * error. */
+      tran_index =
+	logtb_allocate_tran_index_lockfree (thread_p, trid, state, client_credential, current_state, wait_msecs,
+					    isolation);
+      if (tran_index != NULL_TRAN_INDEX)
+	{
+	  LOG_SET_CURRENT_TRAN_INDEX (thread_p, tran_index);
+	  return tran_index;
+	}
+    }
+
   TR_TABLE_CS_ENTER (thread_p);
   tran_index =
     logtb_allocate_tran_index (thread_p, trid, state, client_credential, current_state, wait_msecs, isolation);
@@ -879,6 +898,111 @@ logtb_set_tdes (THREAD_ENTRY * thread_p, LOG_TDES * tdes, const BOOT_CLIENT_CRED
   tdes->m_log_postpone_cache.reset ();
 }
 
+/*
+ * logtb_allocate_tran_index_lockfree - claim and initialize a free transaction table entry without entering the
+ *                       TR_TABLE critical section
+ *
+ * return: tran_index or NULL_TRAN_INDEX when no free entry could be claimed
+ *
+ *   trid(in): Transaction identifier or NULL_TRANID
+ *   state(in): Transaction state (Usually active)
+ *   client_credential(in): Client credentials
+ *   current_state(in/out): Set as a side effect to state of transaction, when a valid pointer is given.
+ *   wait_msecs(in): Wait for at least this number of milliseconds to acquire a lock.
+ *   isolation(in): Isolation level
+ *
+ * Note: An entry is owned by winning a CAS on its slot_claimed flag, so concurrent logins do not serialize on the
+ *       TR_TABLE section. The entry is initialized completely while its trid is still NULL_TRANID - transaction
+ *       table scanners skip such entries - and the trid store publishes it last. Only usable after restart, when
+ *       the table can no longer be expanded and the entry array is stable.
+ */
+static int
+logtb_allocate_tran_index_lockfree (THREAD_ENTRY * thread_p, TRANID trid, TRAN_STATE state,
+				    const BOOT_CLIENT_CREDENTIAL * client_credential, TRAN_STATE * current_state,
+				    int wait_msecs, TRAN_ISOLATION isolation)
+{
+  LOG_TDES *tdes;		/* Transaction descriptor */
+  int num_total_indices;
+  int i, start, tran_index;
+
+  assert (LOG_ISRESTARTED ());
+
+#if defined(SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+#endif /* SERVER_MODE */
+
+  num_total_indices = VOLATILE_ACCESS (NUM_TOTAL_TRAN_INDICES, int);
+  if (num_total_indices <= 0)
+    {
+      return NULL_TRAN_INDEX;
+    }
+
+  start = log_Gl.trantable.hint_free_index % num_total_indices;
+  for (i = 0; i < num_total_indices; i++)
+    {
+      tran_index = (start + i) % num_total_indices;
+      if (tran_index == LOG_SYSTEM_TRAN_INDEX)
+	{
+	  continue;
+	}
+
+      tdes = log_Gl.trantable.all_tdes[tran_index];
+      if (tdes == NULL || tdes->trid != NULL_TRANID)
+	{
+	  continue;
+	}
+
+      if (!ATOMIC_CAS_32 (&tdes->slot_claimed, 0, 1))
+	{
+	  continue;
+	}
+
+      if (tdes->trid != NULL_TRANID)
+	{
+	  /* assigned outside this path between the check and the claim; give it back */
+	  ATOMIC_TAS_32 (&tdes->slot_claimed, 0);
+	  continue;
+	}
+
+      /* the entry is owned now; hint_free_index is only a hint, a stale value just lengthens the next scan */
+      log_Gl.trantable.hint_free_index = (tran_index + 1) % num_total_indices;
+
+      logtb_increment_number_of_assigned_tran_indices ();
+
+      tdes->tran_index = tran_index;
+      logtb_clear_tdes (thread_p, tdes);
+      logtb_set_tdes (thread_p, tdes, client_credential, wait_msecs, isolation);
+      tdes->tran_abort_reason = TRAN_NORMAL;
+
+      if (trid == NULL_TRANID)
+	{
+	  /* the CAS on the global trid counter inside is a full barrier, so the trid store after it publishes a
+	   * completely initialized entry */
+	  logtb_get_new_tran_id (thread_p, tdes);
+	  state = TRAN_ACTIVE;
+	}
+      else
+	{
+	  tdes->state = state;
+	  ATOMIC_TAS_32 (&tdes->trid, trid);
+	}
+
+      if (current_state)
+	{
+	  *current_state = state;
+	}
+
+      LOG_SET_CURRENT_TRAN_INDEX (thread_p, tran_index);
+
+      return tran_index;
+    }
+
+  return NULL_TRAN_INDEX;
+}
+
 /*
  * logtb_allocate_tran_index - allocate a transaction index for a sequence of
  *                       transactions (thread of execution.. a client)
@@ -961,7 +1085,8 @@ logtb_allocate_tran_index (THREAD_ENTRY * thread_p, TRANID trid, TRAN_STATE stat
   for (i = log_Gl.trantable.hint_free_index, visited_loop_start_pos = 0;
        tran_index == NULL_TRAN_INDEX && visited_loop_start_pos < 2; i = (i + 1) % NUM_TOTAL_TRAN_INDICES)
     {
-      if (log_Gl.trantable.all_tdes[i]->trid == NULL_TRANID)
+      if (log_Gl.trantable.all_tdes[i]->trid == NULL_TRANID
+	  && ATOMIC_CAS_32 (&log_Gl.trantable.all_tdes[i]->slot_claimed, 0, 1))
 	{
 	  tran_index = i;
 	}
@@ -1235,6 +1360,9 @@ logtb_free_tran_index (THREAD_ENTRY * thread_p, int tran_index)
       tdes->trid = NULL_TRANID;
       tdes->client_id = -1;
 
+      /* full barrier; all the cleanup stores above must be visible before the entry can be claimed again */
+      ATOMIC_TAS_32 (&tdes->slot_claimed, 0);
+
       TR_TABLE_CS_ENTER (thread_p);
       logtb_decrement_number_of_assigned_tran_indices ();
       if (log_Gl.trantable.hint_free_index > tran_index)
@@ -1604,6 +1732,7 @@ logtb_initialize_tdes (LOG_TDES * tdes, int tran_index)
 
   tdes->tran_index = tran_index;
   tdes->trid = NULL_TRANID;
+  tdes->slot_claimed = 0;
   tdes->isloose_end = false;
   tdes->coord = NULL;
   tdes->client_id = -1;
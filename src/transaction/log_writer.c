@@ -2418,7 +2418,48 @@ logwr_pack_log_pages (THREAD_ENTRY * thread_p, char *logpg_area, int *logpg_used
   /* Fill the page array with the pages to send */
   if (!is_hdr_page_only)
     {
-      for (pageid = fpageid; pageid >= 0 && pageid <= lpageid; pageid++)
+      pageid = fpageid;
+
+      if (copy_from_file == true && !logpb_is_page_in_archive (fpageid))
+	{
+	  /* Bulk catch-up: the run is already on disk in the active log, so read it straight into the send area with
+	   * as few large reads as possible instead of copying one page at a time through the log page buffer. Only
+	   * the pages at or beyond the unflushed tail fall back to the per-page path below. */
+	  LOG_PAGEID batch_lpageid;
+	  int batch_npages, nread, i;
+
+	  nxio_lsa = log_Gl.append.get_nxio_lsa ();
+	  batch_lpageid = MIN (lpageid, nxio_lsa.pageid - 1);
+
+	  while (pageid <= batch_lpageid)
+	    {
+	      /* bounded by the wrap-around of the active log; the call returns the length of the contiguous run read */
+	      batch_npages = (int) (batch_lpageid - pageid + 1);
+
+	      LOG_CS_ENTER_READ_MODE (thread_p);
+	      nread = logpb_read_page_from_active_log (thread_p, pageid, batch_npages, true, (LOG_PAGE *) p);
+	      LOG_CS_EXIT (thread_p);
+
+	      if (nread <= 0)
+		{
+		  /* the run may have been archived and overwritten meanwhile; retry page by page below */
+		  er_clear ();
+		  break;
+		}
+
+	      for (i = 0; i < nread; i++)
+		{
+		  log_pgptr = (LOG_PAGE *) p;
+		  (void) logwr_check_page_checksum (thread_p, log_pgptr);
+
+		  assert (pageid == (log_pgptr->hdr.logical_pageid));
+		  p += LOG_PAGESIZE;
+		  pageid++;
+		}
+	    }
+	}
+
+      for (; pageid >= 0 && pageid <= lpageid; pageid++)
 	{
 	  log_pgptr = (LOG_PAGE *) p;
 	  if (copy_from_file == true)
@@ -646,6 +646,8 @@ mvcc_snapshot::mvcc_snapshot ()
   , m_active_mvccs ()
   , snapshot_fnc (NULL)
   , valid (false)
+  , copied_status_version (0)
+  , copied_status_is_reusable (false)
 {
 }
 
@@ -659,6 +661,7 @@ mvcc_snapshot::reset ()
   m_active_mvccs.reset ();
 
   valid = false;
+  copied_status_is_reusable = false;
 }
 
 void
@@ -671,6 +674,8 @@ mvcc_snapshot::copy_to (mvcc_snapshot & dest) const
   dest.highest_completed_mvccid = highest_completed_mvccid;
   dest.snapshot_fnc = snapshot_fnc;
   dest.valid = valid;
+  dest.copied_status_version = copied_status_version;
+  dest.copied_status_is_reusable = copied_status_is_reusable;
 }
 
 mvcc_info::mvcc_info ()
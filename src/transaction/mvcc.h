@@ -177,6 +177,11 @@ struct mvcc_snapshot
 
   bool valid;			/* true, if the snapshot is valid */
 
+  /* version of the transaction status m_active_mvccs was copied from; while the published status version is unchanged,
+   * the copied bit area can be reused without another copy (see mvcctable::build_mvcc_info) */
+  unsigned int copied_status_version;
+  bool copied_status_is_reusable;	/* false until a copy succeeds and after the bit area is reset */
+
   // *INDENT-OFF*
   mvcc_snapshot ();
   void reset ();
@@ -235,6 +235,7 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
   TSCTIMEVAL tv_diff;
   UINT64 snapshot_wait_time;
   UINT64 snapshot_retry_count = 0;
+  bool reused_copied_status = false;
 
   assert (tdes.tran_index >= 0 && tdes.tran_index < logtb_get_number_of_total_tran_indices ());
 
@@ -295,6 +296,23 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       const mvcc_trans_status &trans_status = m_trans_status_history[index];
 
       trans_status_version = trans_status.m_version.load ();
+
+      if (tdes.mvccinfo.snapshot.copied_status_is_reusable
+	  && tdes.mvccinfo.snapshot.copied_status_version == trans_status_version)
+	{
+	  // the bit area copied for the previous snapshot of this transaction was taken from the status that is still
+	  // the published one; no transaction completed in between, so the copy can be reused as is. observing the
+	  // matching version on the published status is the linearization point of this snapshot, the same way the
+	  // version re-check after a copy is for the slow path.
+	  if (logtb_load_global_statistics_to_tran (thread_get_thread_entry_info ()) != NO_ERROR)
+	    {
+	      /* just error setting without returning for further processing */
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_MVCC_CANT_GET_SNAPSHOT, 0);
+	    }
+	  reused_copied_status = true;
+	  break;
+	}
+
       trans_status.m_active_mvccs.copy_to (tdes.mvccinfo.snapshot.m_active_mvccs,
 					   mvcc_active_tran::copy_safety::THREAD_UNSAFE);
 
@@ -307,21 +325,33 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       if (trans_status_version == trans_status.m_version.load ())
 	{
 	  // no version change; copying status was successful
+	  tdes.mvccinfo.snapshot.copied_status_version = trans_status_version;
+	  tdes.mvccinfo.snapshot.copied_status_is_reusable = true;
 	  break;
 	}
       else
 	{
 	  // a failed copy may break data validity; to make sure next copy is not affected, it is better to reset
 	  // bit area.
+	  tdes.mvccinfo.snapshot.copied_status_is_reusable = false;
 	  tdes.mvccinfo.snapshot.m_active_mvccs.reset_active_transactions ();
 	}
     }
 
-  // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
-  tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
+  if (reused_copied_status)
+    {
+      // the bit area is the one validated when it was first copied and the stored highest completed MVCCID, computed
+      // from that same bit area, is still accurate
+      highest_completed_mvccid = tdes.mvccinfo.snapshot.highest_completed_mvccid;
+    }
+  else
+    {
+      // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
+      tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
 
-  highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
-  MVCCID_FORWARD (highest_completed_mvccid);
+      highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
+      MVCCID_FORWARD (highest_completed_mvccid);
+    }
 
   /* update lowest active mvccid computed for the most recent snapshot */
   tdes.mvccinfo.recent_snapshot_lowest_active_mvccid = crt_status_lowest_active;
@@ -222,6 +222,50 @@ tran_reset_isolation (TRAN_ISOLATION isolation, bool async_ws)
   return error_code;
 }
 
+/*
+ * tran_reset_isolation_and_wait_times - Reset isolation level and future
+ *                     waiting times of client session in one server request
+ *
+ * return:  NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   isolation(in): New Isolation level
+ *   async_ws(in): New async_workspace
+ *   wait_in_msecs(in): Wait for at least this number of milliseconds to
+ *               acquire a lock before the transaction is timed out
+ *
+ * NOTE: Equivalent to tran_reset_isolation() followed by
+ *              tran_reset_wait_times(), but when both settings must change
+ *              they are pipelined into a single client/server round trip.
+ */
+int
+tran_reset_isolation_and_wait_times (TRAN_ISOLATION isolation, bool async_ws, int wait_in_msecs)
+{
+  int error_code = NO_ERROR;
+
+  if (!IS_VALID_ISOLATION_LEVEL (isolation))
+    {
+      er_set (ER_SYNTAX_ERROR_SEVERITY, ARG_FILE_LINE, ER_MVCC_LOG_INVALID_ISOLATION_LEVEL, 0);
+      return ER_MVCC_LOG_INVALID_ISOLATION_LEVEL;
+    }
+
+  if (tm_Tran_isolation == isolation)
+    {
+      tm_Tran_async_ws = async_ws;
+      (void) tran_reset_wait_times (wait_in_msecs);
+      return NO_ERROR;
+    }
+
+  error_code = log_reset_isolation_and_wait_msecs (isolation, wait_in_msecs);
+  if (error_code == NO_ERROR)
+    {
+      tm_Tran_isolation = isolation;
+      tm_Tran_async_ws = async_ws;
+      tm_Tran_wait_msecs = wait_in_msecs;
+    }
+
+  return error_code;
+}
+
 /* only loaddb changes this setting */
 bool tm_Use_OID_preflush = true;
 
@@ -368,6 +412,9 @@ tran_commit (bool retain_lock)
   /* Increment snapshot version in work space */
   ws_increment_mvcc_snapshot_version ();
 
+  /* the next class access must revalidate cached class objects against the server schema generation */
+  locator_reset_class_cache_validation ();
+
   /* clear workspace information and any open query cursors */
   if (error_code == NO_ERROR || BOOT_IS_CLIENT_RESTARTED ())
     {
@@ -490,6 +537,9 @@ tran_abort (void)
   /* Increment snapshot version in work space */
   ws_increment_mvcc_snapshot_version ();
 
+  /* the next class access must revalidate cached class objects against the server schema generation */
+  locator_reset_class_cache_validation ();
+
   er_stack_clearall ();
 
   /* can these do anything useful ? */
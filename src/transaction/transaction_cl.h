@@ -67,6 +67,7 @@ extern void tran_cache_tran_settings (int tran_index, int lock_timeout, TRAN_ISO
 extern void tran_get_tran_settings (int *lock_timeout_in_msecs, TRAN_ISOLATION * tran_isolation, bool * async_ws);
 extern int tran_reset_wait_times (int wait_in_msecs);
 extern int tran_reset_isolation (TRAN_ISOLATION isolation, bool async_ws);
+extern int tran_reset_isolation_and_wait_times (TRAN_ISOLATION isolation, bool async_ws, int wait_in_msecs);
 extern int tran_flush_to_commit (void);
 extern int tran_commit (bool retain_lock);
 extern int tran_abort (void);
@@ -94,6 +94,7 @@ stx_init_xasl_unpack_info (THREAD_ENTRY *thread_p, char *xasl_stream, int xasl_s
       unpack_info->ptr_blocks[n] = (STX_VISITED_PTR *) 0;
       unpack_info->ptr_lwm[n] = 0;
       unpack_info->ptr_max[n] = 0;
+      unpack_info->ptr_block_in_arena[n] = false;
     }
   unpack_info->alloc_size = xasl_stream_size * UNPACK_SCALE;
   unpack_info->alloc_buf = (char *) unpack_info + head_offset;
@@ -129,15 +130,34 @@ stx_mark_struct_visited (THREAD_ENTRY *thread_p, const void *ptr, void *str)
   if (xasl_unpack_info->ptr_max[block_no] == 0)
     {
       xasl_unpack_info->ptr_max[block_no] = START_PTR_PER_BLOCK;
+      /* carve the initial block out of the unpack arena; a heap allocation per touched block (and its free in
+       * stx_free_visited_ptrs) shows up on every plan cache miss */
       xasl_unpack_info->ptr_blocks[block_no] =
-	      (STX_VISITED_PTR *) db_private_alloc (thread_p, sizeof (STX_VISITED_PTR) * xasl_unpack_info->ptr_max[block_no]);
+	      (STX_VISITED_PTR *) stx_alloc_struct (thread_p, sizeof (STX_VISITED_PTR) * xasl_unpack_info->ptr_max[block_no]);
+      xasl_unpack_info->ptr_block_in_arena[block_no] = (xasl_unpack_info->ptr_blocks[block_no] != NULL);
     }
   else if (xasl_unpack_info->ptr_max[block_no] <= new_lwm)
     {
       xasl_unpack_info->ptr_max[block_no] *= 2;
-      xasl_unpack_info->ptr_blocks[block_no] =
-	      (STX_VISITED_PTR *) db_private_realloc (thread_p, xasl_unpack_info->ptr_blocks[block_no],
-		  sizeof (STX_VISITED_PTR) * xasl_unpack_info->ptr_max[block_no]);
+      if (xasl_unpack_info->ptr_block_in_arena[block_no])
+	{
+	  /* arena memory cannot be reallocated; move the entries to a heap block and let the arena copy go unused */
+	  STX_VISITED_PTR *grown =
+		  (STX_VISITED_PTR *) db_private_alloc (thread_p,
+							sizeof (STX_VISITED_PTR) * xasl_unpack_info->ptr_max[block_no]);
+	  if (grown != NULL)
+	    {
+	      memcpy (grown, xasl_unpack_info->ptr_blocks[block_no], sizeof (STX_VISITED_PTR) * new_lwm);
+	      xasl_unpack_info->ptr_block_in_arena[block_no] = false;
+	    }
+	  xasl_unpack_info->ptr_blocks[block_no] = grown;
+	}
+      else
+	{
+	  xasl_unpack_info->ptr_blocks[block_no] =
+		  (STX_VISITED_PTR *) db_private_realloc (thread_p, xasl_unpack_info->ptr_blocks[block_no],
+		      sizeof (STX_VISITED_PTR) * xasl_unpack_info->ptr_max[block_no]);
+	}
     }
 
   if (xasl_unpack_info->ptr_blocks[block_no] == (STX_VISITED_PTR *) NULL)
@@ -206,8 +226,13 @@ stx_free_visited_ptrs (THREAD_ENTRY *thread_p)
       xasl_unpack_info->ptr_max[i] = 0;
       if (xasl_unpack_info->ptr_blocks[i])
 	{
-	  db_private_free_and_init (thread_p, xasl_unpack_info->ptr_blocks[i]);
+	  if (!xasl_unpack_info->ptr_block_in_arena[i])
+	    {
+	      db_private_free_and_init (thread_p, xasl_unpack_info->ptr_blocks[i]);
+	    }
+	  /* arena blocks are released with the unpack buffer itself */
 	  xasl_unpack_info->ptr_blocks[i] = (STX_VISITED_PTR *) 0;
+	  xasl_unpack_info->ptr_block_in_arena[i] = false;
 	}
     }
 }
@@ -57,6 +57,9 @@ struct xasl_unpack_info
   /* blocks of visited pointer constants */
   STX_VISITED_PTR *ptr_blocks[MAX_PTR_BLOCKS];
 
+  /* true for blocks carved out of alloc_buf instead of allocated on the heap */
+  bool ptr_block_in_arena[MAX_PTR_BLOCKS];
+
   char *alloc_buf;		/* alloced buf */
 
   int packed_size;		/* packed xasl tree size */
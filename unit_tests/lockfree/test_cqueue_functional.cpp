@@ -27,6 +27,7 @@
 #undef strlen
 #endif
 
+#include <algorithm>
 #include <cstdint>
 #include <atomic>
 #include <iostream>
@@ -173,6 +174,7 @@ namespace test_lockfree
   }
 
   const size_t MAX_VAL = 100;
+  const size_t BULK_SIZE = 32;
 
   void
   consume_and_track_values (test_cqueue &cqueue, size_t op_count, std::array<atomic_size_t, MAX_VAL> &valcount)
@@ -202,6 +204,54 @@ namespace test_lockfree
       }
   }
 
+  void
+  consume_bulk_and_track_values (test_cqueue &cqueue, size_t op_count, std::array<atomic_size_t, MAX_VAL> &valcount)
+  {
+    int vals[BULK_SIZE];
+    size_t consumed;
+    size_t index;
+
+    while (op_count > 0)
+      {
+	consumed = cqueue.consume_bulk (vals, std::min (op_count, BULK_SIZE));
+	for (index = 0; index < consumed; index++)
+	  {
+	    test_common::custom_assert ((size_t) vals[index] < MAX_VAL);
+	    ++valcount[vals[index]];
+	  }
+	op_count -= consumed;
+      }
+  }
+
+  void
+  produce_bulk_and_track_values (test_cqueue &cqueue, size_t op_count, std::array<atomic_size_t, MAX_VAL> &valcount)
+  {
+    int vals[BULK_SIZE];
+    size_t batch;
+    size_t produced;
+    size_t index;
+
+    while (op_count > 0)
+      {
+	batch = std::min (op_count, BULK_SIZE);
+	for (index = 0; index < batch; index++)
+	  {
+	    vals[index] = std::rand () % MAX_VAL;
+	  }
+	/* loop produce until whole batch is pushed; partial batches are a valid outcome */
+	for (index = 0; index < batch;)
+	  {
+	    produced = cqueue.produce_bulk (&vals[index], batch - index);
+	    index += produced;
+	  }
+	for (index = 0; index < batch; index++)
+	  {
+	    ++valcount[vals[index]];
+	  }
+	op_count -= batch;
+      }
+  }
+
   void
   test_cqueue_values_match (size_t thread_count, size_t ops_per_thread, size_t cqueue_size)
   {
@@ -258,6 +308,133 @@ namespace test_lockfree
     std::cout << "  run successful" << std::endl << std::endl;
   }
 
+  void
+  test_cqueue_bulk_values_match (size_t thread_count, size_t ops_per_thread, size_t cqueue_size)
+  {
+    std::array<atomic_size_t, MAX_VAL> produced_values;
+    std::array<atomic_size_t, MAX_VAL> consumed_values;
+
+    for (size_t index = 0; index < MAX_VAL; index++)
+      {
+	produced_values[index] = 0;
+	consumed_values[index] = 0;
+      }
+
+    std::thread *producers = new std::thread [thread_count];
+    std::thread *consumers = new std::thread [thread_count];
+
+    test_cqueue cqueue (cqueue_size);
+
+    std::cout << "  running test_cqueue_bulk_values_match - " << std::endl;
+    std::cout << "    producer/consumer count = " << thread_count << std::endl;
+    std::cout << "    ops per producer/consumer = " << ops_per_thread << std::endl;
+    std::cout << "    queue size = " << cqueue_size << std::endl;
+    std::cout << "    bulk size = " << BULK_SIZE << std::endl;
+
+    /* mix bulk and single element threads to verify the two protocols cooperate on the same queue */
+    for (size_t index = 0; index < thread_count; index++)
+      {
+	if (index % 2 == 0)
+	  {
+	    producers[index] = std::thread (produce_bulk_and_track_values, std::ref (cqueue), ops_per_thread,
+					    std::ref (produced_values));
+	    consumers[index] = std::thread (consume_bulk_and_track_values, std::ref (cqueue), ops_per_thread,
+					    std::ref (consumed_values));
+	  }
+	else
+	  {
+	    producers[index] = std::thread (produce_and_track_values, std::ref (cqueue), ops_per_thread,
+					    std::ref (produced_values));
+	    consumers[index] = std::thread (consume_and_track_values, std::ref (cqueue), ops_per_thread,
+					    std::ref (consumed_values));
+	  }
+      }
+    /* join all threads */
+    for (size_t index = 0; index < thread_count; index++)
+      {
+	producers[index].join ();
+	consumers[index].join ();
+      }
+
+    /* compare produce and consumed values */
+    for (size_t index = 0; index < MAX_VAL; index++)
+      {
+	if (produced_values[index] != consumed_values[index])
+	  {
+	    /* dump all */
+	    std::cout << "    error!! values do not match" << std::endl;
+	    for (index = 0; index < MAX_VAL; index++)
+	      {
+		std::cout << "    " << std::setw (2) << index << ":  ";
+		std::cout << std::setw (10) << produced_values[index];
+		std::cout << std::setw (10) << consumed_values[index];
+		std::cout << std::endl;
+	      }
+	    test_common::custom_assert (false);
+	  }
+      }
+    std::cout << "  run successful" << std::endl << std::endl;
+  }
+
+  void
+  benchmark_cqueue_bulk (size_t thread_count, size_t ops_per_thread, size_t cqueue_size)
+  {
+    std::array<atomic_size_t, MAX_VAL> produced_values;
+    std::array<atomic_size_t, MAX_VAL> consumed_values;
+
+    std::cout << "  running benchmark_cqueue_bulk - " << std::endl;
+    std::cout << "    producer/consumer count = " << thread_count << std::endl;
+    std::cout << "    ops per producer/consumer = " << ops_per_thread << std::endl;
+    std::cout << "    queue size = " << cqueue_size << std::endl;
+    std::cout << "    bulk size = " << BULK_SIZE << std::endl;
+
+    /* run the same workload once per element and once in batches; report ns/element for both */
+    for (int use_bulk = 0; use_bulk <= 1; use_bulk++)
+      {
+	for (size_t index = 0; index < MAX_VAL; index++)
+	  {
+	    produced_values[index] = 0;
+	    consumed_values[index] = 0;
+	  }
+
+	std::thread *producers = new std::thread [thread_count];
+	std::thread *consumers = new std::thread [thread_count];
+	test_cqueue cqueue (cqueue_size);
+
+	auto start_time = std::chrono::high_resolution_clock::now ();
+	for (size_t index = 0; index < thread_count; index++)
+	  {
+	    if (use_bulk)
+	      {
+		producers[index] = std::thread (produce_bulk_and_track_values, std::ref (cqueue), ops_per_thread,
+						std::ref (produced_values));
+		consumers[index] = std::thread (consume_bulk_and_track_values, std::ref (cqueue), ops_per_thread,
+						std::ref (consumed_values));
+	      }
+	    else
+	      {
+		producers[index] = std::thread (produce_and_track_values, std::ref (cqueue), ops_per_thread,
+						std::ref (produced_values));
+		consumers[index] = std::thread (consume_and_track_values, std::ref (cqueue), ops_per_thread,
+						std::ref (consumed_values));
+	      }
+	  }
+	for (size_t index = 0; index < thread_count; index++)
+	  {
+	    producers[index].join ();
+	    consumers[index].join ();
+	  }
+	std::chrono::nanoseconds nanos = std::chrono::high_resolution_clock::now () - start_time;
+
+	std::cout << "    " << (use_bulk ? "bulk  " : "single") << " = ";
+	std::cout << nanos.count () / (thread_count * ops_per_thread) << " ns/element" << std::endl;
+
+	delete [] producers;
+	delete [] consumers;
+      }
+    std::cout << std::endl;
+  }
+
   int
   test_cqueue_functional (void)
   {
@@ -291,6 +468,10 @@ namespace test_lockfree
 #endif
 
     test_cqueue_values_match (core_count_x2, one_mil_op_count, one_k_cqueue_size);
+    test_cqueue_bulk_values_match (core_count_x2, one_mil_op_count, one_k_cqueue_size);
+
+    benchmark_cqueue_bulk (one_thread_count, one_mil_op_count, one_k_cqueue_size);
+    benchmark_cqueue_bulk (core_count, one_mil_op_count, one_k_cqueue_size);
 
     std::cout << std::endl;
 